@@ -46,6 +46,7 @@
 #include "testing_spmv_coo_aos.hpp"
 #include "testing_spmv_csr.hpp"
 #include "testing_spmv_ell.hpp"
+#include "testing_spmv_semiring.hpp"
 
 // Level3
 #include "testing_bsrmm.hpp"
@@ -58,15 +59,37 @@
 #include "testing_spmm_csr.hpp"
 
 // Extra
+#include "testing_bsrgeam.hpp"
+#include "testing_bsrgemm.hpp"
 #include "testing_csrgeam.hpp"
+#include "testing_csrgeam_multi.hpp"
+#include "testing_csrewise.hpp"
+#include "testing_csrgemm_chunked.hpp"
+#include "testing_csrgemm_masked.hpp"
+#include "testing_csrgemm_nnz_estimate.hpp"
+#include "testing_csrrap.hpp"
 #include "testing_spgemm_csr.hpp"
+#include "testing_spgemm_semiring.hpp"
 
 // Preconditioner
 #include "testing_bsric0.hpp"
 #include "testing_bsrilu0.hpp"
+#include "testing_bsrjacobi.hpp"
+#include "testing_csrcheb.hpp"
+#include "testing_csrcolor.hpp"
+#include "testing_csrfsai.hpp"
 #include "testing_csric0.hpp"
 #include "testing_csrilu0.hpp"
+#include "testing_csriluk.hpp"
+#include "testing_csrilut.hpp"
+#include "testing_csritilu0.hpp"
+#include "testing_csrrcm.hpp"
+#include "testing_gpsv_no_pivot_interleaved_batch.hpp"
+#include "testing_gpsv_no_pivot_strided_batch.hpp"
+#include "testing_gtsv.hpp"
+#include "testing_gtsv_interleaved_batch.hpp"
 #include "testing_gtsv_no_pivot.hpp"
+#include "testing_gtsv_no_pivot_strided_batch.hpp"
 
 // Conversion
 #include "testing_bsr2csr.hpp"
@@ -84,6 +107,7 @@
 #include "testing_csr2gebsr.hpp"
 #include "testing_csr2hyb.hpp"
 #include "testing_csrsort.hpp"
+#include "testing_csrsympermute.hpp"
 #include "testing_dense2coo.hpp"
 #include "testing_dense2csc.hpp"
 #include "testing_dense2csr.hpp"
@@ -130,6 +154,7 @@ int main(int argc, char* argv[])
     std::string   function;
     std::string   filename;
     std::string   rocalution;
+    bool          rmat;
     char          indextype = 's';
     char          precision = 's';
     char          transA;
@@ -143,6 +168,7 @@ int main(int argc, char* argv[])
     char          diag;
     char          uplo;
     char          apol;
+    char          spol;
     rocsparse_int dir;
     rocsparse_int order;
     rocsparse_int format;
@@ -201,6 +227,10 @@ int main(int argc, char* argv[])
         value<std::string>(&rocalution)->default_value(""),
         "read from rocalution matrix binary file. This will override parameter --mtx")
 
+        ("rmat",
+        bool_switch(&rmat)->default_value(false), "generate R-MAT power law matrix "
+        "with dimensions -m and -n. This will override parameter --mtx")
+
         ("dimx",
         value<rocsparse_int>(&arg.dimx)->default_value(0.0), "assemble "
         "laplacian matrix with dimensions <dimx dimy dimz>. dimz is optional. This "
@@ -271,17 +301,21 @@ int main(int argc, char* argv[])
 
         ("apolicy",
         value<char>(&apol)->default_value('R'),
-        "R = reuse meta data, F = force re-build, (default = R)")
+        "R = reuse meta data, F = force re-build, N = numeric only, (default = R)")
+
+        ("spolicy",
+        value<char>(&spol)->default_value('A'),
+        "A = auto, S = sync-free, L = level-set, (default = A)")
 
         ("function,f",
         value<std::string>(&function)->default_value("axpyi"),
         "SPARSE function to test. Options:\n"
         "  Level1: axpyi, doti, dotci, gthr, gthrz, roti, sctr\n"
-        "  Level2: bsrmv, bsrsv, coomv, coomv_aos, csrmv, csrmv_managed, csrsv, ellmv, hybmv, gebsrmv, gemvi\n"
+        "  Level2: bsrmv, bsrsv, coomv, coomv_aos, csrmv, csrmv_managed, csrmv_semiring, csrsv, ellmv, hybmv, gebsrmv, gemvi\n"
         "  Level3: bsrmm, gebsrmm, csrmm, coomm, csrsm, gemmi, sddmm\n"
-        "  Extra: csrgeam, csrgemm\n"
-        "  Preconditioner: bsric0, bsrilu0, csric0, csrilu0, gtsv_no_pivot\n"
-        "  Conversion: csr2coo, csr2csc, gebsr2gebsc, csr2ell, csr2hyb, csr2bsr, csr2gebsr\n"
+        "  Extra: bsrgeam, bsrgemm, csrgeam, csrgeam_multi, csrewise, csrgemm, csrgemm_chunked, csrgemm_masked, csrgemm_nnz_estimate, csrgemm_semiring, csrrap\n"
+        "  Preconditioner: bsric0, bsrilu0, bsrjacobi, csric0, csrilu0, csriluk, csrilut, csritilu0, csrfsai, csrcheb, csrcolor, csrrcm, gtsv, gtsv_no_pivot, gtsv_no_pivot_strided_batch, gtsv_interleaved_batch, gpsv_no_pivot_strided_batch, gpsv_no_pivot_interleaved_batch\n"
+        "  Conversion: csr2coo, csr2csc, gebsr2gebsc, csr2ell, csr2hyb, csr2bsr, csr2gebsr, csrsympermute\n"
         "              coo2csr, ell2csr, hyb2csr, dense2csr, dense2coo, prune_dense2csr, prune_dense2csr_by_percentage, dense2csc\n"
         "              csr2dense, csc2dense, coo2dense, bsr2csr, gebsr2csr, gebsr2gebsr, csr2csr_compress, prune_csr2csr, prune_csr2csr_by_percentage\n"
         "              sparse_to_dense_coo, sparse_to_dense_csr, sparse_to_dense_csc, dense_to_sparse_coo, dense_to_sparse_csr, dense_to_sparse_csc\n"
@@ -319,6 +353,14 @@ int main(int argc, char* argv[])
         value<rocsparse_int>(&format)->default_value(rocsparse_format_coo),
         "Indicates wther a sparse matrix is laid out in coo format: 0, coo_aos format: 1, csr format: 2, csc format: 3 or ell format: 4 (default:0)")
 
+        ("fill_level",
+        value<rocsparse_int>(&arg.fill_level)->default_value(1),
+        "Level of fill of csriluk, maximum fill per row and triangular part of csrilut, sparsity pattern of csrfsai, 0: A, 1: A^2 (default: 1)")
+
+        ("nsweeps",
+        value<rocsparse_int>(&arg.nsweeps)->default_value(10),
+        "Number of fixed-point sweeps of the iterative incomplete factorizations, degree of csrcheb (default: 10)")
+
         ("denseld",
         value<rocsparse_int>(&arg.denseld)->default_value(128),
         "Indicates the leading dimension of a dense matrix >= M, assuming a column-oriented storage.");
@@ -405,8 +447,12 @@ int main(int argc, char* argv[])
                                : rocsparse_hyb_partition_max;
     arg.diag   = (diag == 'N') ? rocsparse_diag_type_non_unit : rocsparse_diag_type_unit;
     arg.uplo   = (uplo == 'L') ? rocsparse_fill_mode_lower : rocsparse_fill_mode_upper;
-    arg.apol   = (apol == 'R') ? rocsparse_analysis_policy_reuse : rocsparse_analysis_policy_force;
-    arg.spol   = rocsparse_solve_policy_auto;
+    arg.apol   = (apol == 'R')   ? rocsparse_analysis_policy_reuse
+                 : (apol == 'N') ? rocsparse_analysis_policy_numeric
+                                 : rocsparse_analysis_policy_force;
+    arg.spol   = (spol == 'S')   ? rocsparse_solve_policy_sync_free
+                 : (spol == 'L') ? rocsparse_solve_policy_level_set
+                                 : rocsparse_solve_policy_auto;
     arg.direction
         = (dir == rocsparse_direction_row) ? rocsparse_direction_row : rocsparse_direction_column;
     arg.order  = (order == rocsparse_order_row) ? rocsparse_order_row : rocsparse_order_column;
@@ -426,6 +472,10 @@ int main(int argc, char* argv[])
     {
         arg.matrix = rocsparse_matrix_laplace_2d;
     }
+    else if(rmat)
+    {
+        arg.matrix = rocsparse_matrix_rmat;
+    }
     else if(filename != "")
     {
         strcpy(arg.filename, filename.c_str());
@@ -748,6 +798,27 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrmv_managed<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrmv_semiring")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spmv_semiring<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spmv_semiring<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spmv_semiring<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spmv_semiring<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spmv_semiring<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spmv_semiring<int64_t, int64_t, double>(arg);
+        }
+    }
     else if(function == "csrsv")
     {
         if(precision == 's')
@@ -937,6 +1008,28 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_gemmi<rocsparse_double_complex>(arg);
     }
+    else if(function == "bsrgeam")
+    {
+        if(precision == 's')
+            testing_bsrgeam<float>(arg);
+        else if(precision == 'd')
+            testing_bsrgeam<double>(arg);
+        else if(precision == 'c')
+            testing_bsrgeam<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrgeam<rocsparse_double_complex>(arg);
+    }
+    else if(function == "bsrgemm")
+    {
+        if(precision == 's')
+            testing_bsrgemm<float>(arg);
+        else if(precision == 'd')
+            testing_bsrgemm<double>(arg);
+        else if(precision == 'c')
+            testing_bsrgemm<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrgemm<rocsparse_double_complex>(arg);
+    }
     else if(function == "csrgeam")
     {
         if(precision == 's')
@@ -948,6 +1041,28 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrgeam<rocsparse_double_complex>(arg);
     }
+    else if(function == "csrgeam_multi")
+    {
+        if(precision == 's')
+            testing_csrgeam_multi<float>(arg);
+        else if(precision == 'd')
+            testing_csrgeam_multi<double>(arg);
+        else if(precision == 'c')
+            testing_csrgeam_multi<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrgeam_multi<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrewise")
+    {
+        if(precision == 's')
+            testing_csrewise<float>(arg);
+        else if(precision == 'd')
+            testing_csrewise<double>(arg);
+        else if(precision == 'c')
+            testing_csrewise<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrewise<rocsparse_double_complex>(arg);
+    }
     else if(function == "csrgemm")
     {
         if(precision == 's')
@@ -987,6 +1102,67 @@ int main(int argc, char* argv[])
                 testing_spgemm_csr<int64_t, int64_t, rocsparse_double_complex>(arg);
         }
     }
+    else if(function == "csrgemm_semiring")
+    {
+        if(precision == 's')
+        {
+            if(indextype == 's')
+                testing_spgemm_semiring<int32_t, int32_t, float>(arg);
+            else if(indextype == 'm')
+                testing_spgemm_semiring<int64_t, int32_t, float>(arg);
+            else if(indextype == 'd')
+                testing_spgemm_semiring<int64_t, int64_t, float>(arg);
+        }
+        else if(precision == 'd')
+        {
+            if(indextype == 's')
+                testing_spgemm_semiring<int32_t, int32_t, double>(arg);
+            else if(indextype == 'm')
+                testing_spgemm_semiring<int64_t, int32_t, double>(arg);
+            else if(indextype == 'd')
+                testing_spgemm_semiring<int64_t, int64_t, double>(arg);
+        }
+    }
+    else if(function == "csrgemm_chunked")
+    {
+        if(precision == 's')
+            testing_csrgemm_chunked<float>(arg);
+        else if(precision == 'd')
+            testing_csrgemm_chunked<double>(arg);
+        else if(precision == 'c')
+            testing_csrgemm_chunked<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrgemm_chunked<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrgemm_masked")
+    {
+        if(precision == 's')
+            testing_csrgemm_masked<float>(arg);
+        else if(precision == 'd')
+            testing_csrgemm_masked<double>(arg);
+        else if(precision == 'c')
+            testing_csrgemm_masked<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrgemm_masked<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrgemm_nnz_estimate")
+    {
+        if(precision == 's')
+            testing_csrgemm_nnz_estimate<float>(arg);
+        else if(precision == 'd')
+            testing_csrgemm_nnz_estimate<double>(arg);
+    }
+    else if(function == "csrrap")
+    {
+        if(precision == 's')
+            testing_csrrap<float>(arg);
+        else if(precision == 'd')
+            testing_csrrap<double>(arg);
+        else if(precision == 'c')
+            testing_csrrap<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrrap<rocsparse_double_complex>(arg);
+    }
     else if(function == "sddmm")
     {
         if(precision == 's')
@@ -1048,6 +1224,17 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_bsrilu0<rocsparse_double_complex>(arg);
     }
+    else if(function == "bsrjacobi")
+    {
+        if(precision == 's')
+            testing_bsrjacobi<float>(arg);
+        else if(precision == 'd')
+            testing_bsrjacobi<double>(arg);
+        else if(precision == 'c')
+            testing_bsrjacobi<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_bsrjacobi<rocsparse_double_complex>(arg);
+    }
     else if(function == "csric0")
     {
         if(precision == 's')
@@ -1070,6 +1257,94 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_csrilu0<rocsparse_double_complex>(arg);
     }
+    else if(function == "csriluk")
+    {
+        if(precision == 's')
+            testing_csriluk<float>(arg);
+        else if(precision == 'd')
+            testing_csriluk<double>(arg);
+        else if(precision == 'c')
+            testing_csriluk<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csriluk<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrilut")
+    {
+        if(precision == 's')
+            testing_csrilut<float>(arg);
+        else if(precision == 'd')
+            testing_csrilut<double>(arg);
+        else if(precision == 'c')
+            testing_csrilut<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrilut<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrfsai")
+    {
+        if(precision == 's')
+            testing_csrfsai<float>(arg);
+        else if(precision == 'd')
+            testing_csrfsai<double>(arg);
+        else if(precision == 'c')
+            testing_csrfsai<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrfsai<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrcheb")
+    {
+        if(precision == 's')
+            testing_csrcheb<float>(arg);
+        else if(precision == 'd')
+            testing_csrcheb<double>(arg);
+        else if(precision == 'c')
+            testing_csrcheb<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrcheb<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csritilu0")
+    {
+        if(precision == 's')
+            testing_csritilu0<float>(arg);
+        else if(precision == 'd')
+            testing_csritilu0<double>(arg);
+        else if(precision == 'c')
+            testing_csritilu0<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csritilu0<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrcolor")
+    {
+        if(precision == 's')
+            testing_csrcolor<float>(arg);
+        else if(precision == 'd')
+            testing_csrcolor<double>(arg);
+        else if(precision == 'c')
+            testing_csrcolor<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrcolor<rocsparse_double_complex>(arg);
+    }
+    else if(function == "csrrcm")
+    {
+        if(precision == 's')
+            testing_csrrcm<float>(arg);
+        else if(precision == 'd')
+            testing_csrrcm<double>(arg);
+        else if(precision == 'c')
+            testing_csrrcm<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrrcm<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gtsv")
+    {
+        if(precision == 's')
+            testing_gtsv<float>(arg);
+        else if(precision == 'd')
+            testing_gtsv<double>(arg);
+        else if(precision == 'c')
+            testing_gtsv<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gtsv<rocsparse_double_complex>(arg);
+    }
     else if(function == "gtsv_no_pivot")
     {
         if(precision == 's')
@@ -1081,6 +1356,50 @@ int main(int argc, char* argv[])
         else if(precision == 'z')
             testing_gtsv_no_pivot<rocsparse_double_complex>(arg);
     }
+    else if(function == "gtsv_no_pivot_strided_batch")
+    {
+        if(precision == 's')
+            testing_gtsv_no_pivot_strided_batch<float>(arg);
+        else if(precision == 'd')
+            testing_gtsv_no_pivot_strided_batch<double>(arg);
+        else if(precision == 'c')
+            testing_gtsv_no_pivot_strided_batch<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gtsv_no_pivot_strided_batch<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gtsv_interleaved_batch")
+    {
+        if(precision == 's')
+            testing_gtsv_interleaved_batch<float>(arg);
+        else if(precision == 'd')
+            testing_gtsv_interleaved_batch<double>(arg);
+        else if(precision == 'c')
+            testing_gtsv_interleaved_batch<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gtsv_interleaved_batch<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gpsv_no_pivot_strided_batch")
+    {
+        if(precision == 's')
+            testing_gpsv_no_pivot_strided_batch<float>(arg);
+        else if(precision == 'd')
+            testing_gpsv_no_pivot_strided_batch<double>(arg);
+        else if(precision == 'c')
+            testing_gpsv_no_pivot_strided_batch<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gpsv_no_pivot_strided_batch<rocsparse_double_complex>(arg);
+    }
+    else if(function == "gpsv_no_pivot_interleaved_batch")
+    {
+        if(precision == 's')
+            testing_gpsv_no_pivot_interleaved_batch<float>(arg);
+        else if(precision == 'd')
+            testing_gpsv_no_pivot_interleaved_batch<double>(arg);
+        else if(precision == 'c')
+            testing_gpsv_no_pivot_interleaved_batch<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_gpsv_no_pivot_interleaved_batch<rocsparse_double_complex>(arg);
+    }
     else if(function == "nnz")
     {
         if(precision == 's')
@@ -1556,6 +1875,17 @@ int main(int argc, char* argv[])
     {
         testing_coosort<float>(arg);
     }
+    else if(function == "csrsympermute")
+    {
+        if(precision == 's')
+            testing_csrsympermute<float>(arg);
+        else if(precision == 'd')
+            testing_csrsympermute<double>(arg);
+        else if(precision == 'c')
+            testing_csrsympermute<rocsparse_float_complex>(arg);
+        else if(precision == 'z')
+            testing_csrsympermute<rocsparse_double_complex>(arg);
+    }
     else if(function == "identity")
     {
         testing_identity<float>(arg);
@@ -24,6 +24,7 @@
 #include "utility.hpp"
 
 #include <limits>
+#include <map>
 
 #ifdef _OPENMP
 #include <omp.h>
@@ -1201,6 +1202,98 @@ void host_csrmv(J                    M,
     }
 }
 
+// Semiring operations, see rocsparse_semiring
+template <typename T>
+static inline T host_semiring_zero(rocsparse_semiring semiring)
+{
+    switch(semiring)
+    {
+    case rocsparse_semiring_min_plus:
+        return std::numeric_limits<T>::infinity();
+    case rocsparse_semiring_max_times:
+        return -std::numeric_limits<T>::infinity();
+    default:
+        return static_cast<T>(0);
+    }
+}
+
+template <typename T>
+static inline T host_semiring_add(rocsparse_semiring semiring, T a, T b)
+{
+    switch(semiring)
+    {
+    case rocsparse_semiring_min_plus:
+        return (b < a) ? b : a;
+    case rocsparse_semiring_max_times:
+        return (b > a) ? b : a;
+    case rocsparse_semiring_or_and:
+        return (a != static_cast<T>(0) || b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    default:
+        return a + b;
+    }
+}
+
+template <typename T>
+static inline T host_semiring_mul(rocsparse_semiring semiring, T a, T b)
+{
+    switch(semiring)
+    {
+    case rocsparse_semiring_min_plus:
+        return a + b;
+    case rocsparse_semiring_or_and:
+        return (a != static_cast<T>(0) && b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    case rocsparse_semiring_plus_pair:
+        return static_cast<T>(1);
+    default:
+        return a * b;
+    }
+}
+
+template <typename I, typename J, typename T>
+void host_csrmv_semiring(rocsparse_semiring   semiring,
+                         J                    M,
+                         T                    alpha,
+                         const I*             csr_row_ptr,
+                         const J*             csr_col_ind,
+                         const T*             csr_val,
+                         const T*             x,
+                         T                    beta,
+                         T*                   y,
+                         rocsparse_index_base base)
+{
+    T zero = host_semiring_zero<T>(semiring);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < M; ++i)
+    {
+        I row_begin = csr_row_ptr[i] - base;
+        I row_end   = csr_row_ptr[i + 1] - base;
+
+        T sum = zero;
+
+        for(I j = row_begin; j < row_end; ++j)
+        {
+            T val = host_semiring_mul(semiring, alpha, csr_val[j]);
+
+            sum = host_semiring_add(
+                semiring, host_semiring_mul(semiring, val, x[csr_col_ind[j] - base]), sum);
+        }
+
+        if(beta == zero)
+        {
+            y[i] = sum;
+        }
+        else
+        {
+            y[i] = host_semiring_add(semiring, host_semiring_mul(semiring, beta, y[i]), sum);
+        }
+    }
+}
+
 template <typename T>
 static void host_csr_lsolve(rocsparse_int        M,
                             T                    alpha,
@@ -1517,6 +1610,68 @@ void host_csrsv(rocsparse_operation  trans,
     *numeric_pivot = (*numeric_pivot == M + 1) ? -1 : *numeric_pivot;
 }
 
+rocsparse_int host_csrsv_levels(rocsparse_operation  trans,
+                                rocsparse_int        M,
+                                const rocsparse_int* csr_row_ptr,
+                                const rocsparse_int* csr_col_ind,
+                                rocsparse_fill_mode  fill_mode,
+                                rocsparse_index_base base)
+{
+    // Triangular part that is solved, after applying the operation
+    bool lower = (fill_mode == rocsparse_fill_mode_lower) == (trans == rocsparse_operation_none);
+
+    // Depth of each unknown, where unknowns without dependencies have depth 1
+    std::vector<rocsparse_int> depth(M, 0);
+
+    rocsparse_int nlevels = 0;
+
+    for(rocsparse_int k = 0; k < M; ++k)
+    {
+        rocsparse_int row = lower ? k : M - 1 - k;
+
+        rocsparse_int row_begin = csr_row_ptr[row] - base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - base;
+
+        if(trans == rocsparse_operation_none)
+        {
+            // Pull the depth from all dependencies of this row
+            rocsparse_int local_max = 0;
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if((lower && col < row) || (!lower && col > row))
+                {
+                    local_max = std::max(local_max, depth[col]);
+                }
+            }
+
+            depth[row] = local_max + 1;
+        }
+        else
+        {
+            // Row of the transposed matrix is complete, push its depth to all unknowns
+            // depending on it
+            depth[row] = depth[row] + 1;
+
+            for(rocsparse_int j = row_begin; j < row_end; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if((lower && col > row) || (!lower && col < row))
+                {
+                    depth[col] = std::max(depth[col], depth[row]);
+                }
+            }
+        }
+
+        nlevels = std::max(nlevels, depth[row]);
+    }
+
+    return nlevels;
+}
+
 template <typename I, typename T>
 void host_ellmv(I                    M,
                 I                    N,
@@ -2721,6 +2876,400 @@ void host_csrgeam(rocsparse_int                     M,
     }
 }
 
+// Binary operators of the element-wise operations, see rocsparse_ewise_op
+template <typename T,
+          typename std::enable_if<std::is_same<T, float>{} || std::is_same<T, double>{}, int>::type
+          = 0>
+static inline T host_ewise_apply(rocsparse_ewise_op op, T a, T b)
+{
+    switch(op)
+    {
+    case rocsparse_ewise_op_sub:
+        return a - b;
+    case rocsparse_ewise_op_mul:
+        return a * b;
+    case rocsparse_ewise_op_div:
+        return a / b;
+    case rocsparse_ewise_op_min:
+        return (b < a) ? b : a;
+    case rocsparse_ewise_op_max:
+        return (b > a) ? b : a;
+    default:
+        return a + b;
+    }
+}
+
+// Complex data types are not ordered, min and max are not supported
+template <typename T,
+          typename std::enable_if<std::is_same<T, rocsparse_float_complex>{}
+                                      || std::is_same<T, rocsparse_double_complex>{},
+                                  int>::type
+          = 0>
+static inline T host_ewise_apply(rocsparse_ewise_op op, T a, T b)
+{
+    switch(op)
+    {
+    case rocsparse_ewise_op_sub:
+        return a - b;
+    case rocsparse_ewise_op_mul:
+        return a * b;
+    case rocsparse_ewise_op_div:
+        return a / b;
+    default:
+        return a + b;
+    }
+}
+
+void host_csrewise_nnz(rocsparse_ewise_pattern           pattern,
+                       rocsparse_int                     M,
+                       const std::vector<rocsparse_int>& csr_row_ptr_A,
+                       const std::vector<rocsparse_int>& csr_col_ind_A,
+                       const std::vector<rocsparse_int>& csr_row_ptr_B,
+                       const std::vector<rocsparse_int>& csr_col_ind_B,
+                       std::vector<rocsparse_int>&       csr_row_ptr_C,
+                       rocsparse_int*                    nnz_C,
+                       rocsparse_index_base              base_A,
+                       rocsparse_index_base              base_B,
+                       rocsparse_index_base              base_C)
+{
+    // Index base
+    csr_row_ptr_C[0] = base_C;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int j_A = csr_row_ptr_A[i] - base_A;
+        rocsparse_int j_B = csr_row_ptr_B[i] - base_B;
+
+        rocsparse_int row_end_A = csr_row_ptr_A[i + 1] - base_A;
+        rocsparse_int row_end_B = csr_row_ptr_B[i + 1] - base_B;
+
+        rocsparse_int both = 0;
+
+        // Merge the sorted rows of A and B to count common columns
+        while(j_A < row_end_A && j_B < row_end_B)
+        {
+            rocsparse_int col_A = csr_col_ind_A[j_A] - base_A;
+            rocsparse_int col_B = csr_col_ind_B[j_B] - base_B;
+
+            if(col_A == col_B)
+            {
+                ++both;
+            }
+
+            j_A += (col_A <= col_B);
+            j_B += (col_B <= col_A);
+        }
+
+        rocsparse_int nnz_A = csr_row_ptr_A[i + 1] - csr_row_ptr_A[i];
+        rocsparse_int nnz_B = csr_row_ptr_B[i + 1] - csr_row_ptr_B[i];
+
+        csr_row_ptr_C[i + 1]
+            = (pattern == rocsparse_ewise_pattern_intersection) ? both : nnz_A + nnz_B - both;
+    }
+
+    // Scan to obtain row offsets
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        csr_row_ptr_C[i + 1] += csr_row_ptr_C[i];
+    }
+
+    *nnz_C = csr_row_ptr_C[M] - base_C;
+}
+
+template <typename T>
+void host_csrewise(rocsparse_ewise_pattern           pattern,
+                   rocsparse_ewise_op                op,
+                   rocsparse_int                     M,
+                   rocsparse_int                     N,
+                   const std::vector<rocsparse_int>& csr_row_ptr_A,
+                   const std::vector<rocsparse_int>& csr_col_ind_A,
+                   const std::vector<T>&             csr_val_A,
+                   const std::vector<rocsparse_int>& csr_row_ptr_B,
+                   const std::vector<rocsparse_int>& csr_col_ind_B,
+                   const std::vector<T>&             csr_val_B,
+                   const std::vector<rocsparse_int>& csr_row_ptr_C,
+                   std::vector<rocsparse_int>&       csr_col_ind_C,
+                   std::vector<T>&                   csr_val_C,
+                   rocsparse_index_base              base_A,
+                   rocsparse_index_base              base_B,
+                   rocsparse_index_base              base_C)
+{
+    bool is_union = (pattern == rocsparse_ewise_pattern_union);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int j_A = csr_row_ptr_A[i] - base_A;
+        rocsparse_int j_B = csr_row_ptr_B[i] - base_B;
+        rocsparse_int j_C = csr_row_ptr_C[i] - base_C;
+
+        rocsparse_int row_end_A = csr_row_ptr_A[i + 1] - base_A;
+        rocsparse_int row_end_B = csr_row_ptr_B[i + 1] - base_B;
+
+        // Merge the sorted rows of A and B
+        while(j_A < row_end_A || j_B < row_end_B)
+        {
+            rocsparse_int col_A = (j_A < row_end_A) ? csr_col_ind_A[j_A] - base_A : N;
+            rocsparse_int col_B = (j_B < row_end_B) ? csr_col_ind_B[j_B] - base_B : N;
+
+            if(col_A == col_B)
+            {
+                csr_col_ind_C[j_C] = col_A + base_C;
+                csr_val_C[j_C]     = host_ewise_apply(op, csr_val_A[j_A], csr_val_B[j_B]);
+                ++j_A;
+                ++j_B;
+                ++j_C;
+            }
+            else if(col_A < col_B)
+            {
+                // Entries of A only are copied for the union
+                if(is_union)
+                {
+                    csr_col_ind_C[j_C] = col_A + base_C;
+                    csr_val_C[j_C]     = csr_val_A[j_A];
+                    ++j_C;
+                }
+
+                ++j_A;
+            }
+            else
+            {
+                // Entries of B only are copied for the union
+                if(is_union)
+                {
+                    csr_col_ind_C[j_C] = col_B + base_C;
+                    csr_val_C[j_C]     = csr_val_B[j_B];
+                    ++j_C;
+                }
+
+                ++j_B;
+            }
+        }
+    }
+}
+
+template <typename T>
+void host_bsrgeam(rocsparse_direction               dir,
+                  rocsparse_int                     Mb,
+                  rocsparse_int                     Nb,
+                  rocsparse_int                     block_dim,
+                  T                                 alpha,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_A,
+                  const std::vector<rocsparse_int>& bsr_col_ind_A,
+                  const std::vector<T>&             bsr_val_A,
+                  T                                 beta,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_B,
+                  const std::vector<rocsparse_int>& bsr_col_ind_B,
+                  const std::vector<T>&             bsr_val_B,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_C,
+                  std::vector<rocsparse_int>&       bsr_col_ind_C,
+                  std::vector<T>&                   bsr_val_C,
+                  rocsparse_index_base              base_A,
+                  rocsparse_index_base              base_B,
+                  rocsparse_index_base              base_C)
+{
+    rocsparse_int bs = block_dim * block_dim;
+
+    // Block row-major and column-major blocks only differ in the order of the entries,
+    // which is the same for A, B and C
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < Mb; ++i)
+    {
+        rocsparse_int j_A   = bsr_row_ptr_A[i] - base_A;
+        rocsparse_int end_A = bsr_row_ptr_A[i + 1] - base_A;
+        rocsparse_int j_B   = bsr_row_ptr_B[i] - base_B;
+        rocsparse_int end_B = bsr_row_ptr_B[i + 1] - base_B;
+        rocsparse_int j_C   = bsr_row_ptr_C[i] - base_C;
+
+        // Merge the block columns of A and B
+        while(j_A < end_A || j_B < end_B)
+        {
+            rocsparse_int col_A = (j_A < end_A) ? bsr_col_ind_A[j_A] - base_A : Nb;
+            rocsparse_int col_B = (j_B < end_B) ? bsr_col_ind_B[j_B] - base_B : Nb;
+            rocsparse_int col_C = std::min(col_A, col_B);
+
+            bsr_col_ind_C[j_C] = col_C + base_C;
+
+            for(rocsparse_int k = 0; k < bs; ++k)
+            {
+                T sum = static_cast<T>(0);
+
+                if(col_A == col_C)
+                {
+                    sum = alpha * bsr_val_A[bs * j_A + k];
+                }
+
+                if(col_B == col_C)
+                {
+                    sum = std::fma(beta, bsr_val_B[bs * j_B + k], sum);
+                }
+
+                bsr_val_C[bs * j_C + k] = sum;
+            }
+
+            j_A += (col_A == col_C);
+            j_B += (col_B == col_C);
+            ++j_C;
+        }
+    }
+}
+
+template <typename T>
+void host_bsrgemm(rocsparse_direction               dir,
+                  rocsparse_int                     Mb,
+                  rocsparse_int                     Nb,
+                  rocsparse_int                     Kb,
+                  rocsparse_int                     block_dim,
+                  const T*                          alpha,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_A,
+                  const std::vector<rocsparse_int>& bsr_col_ind_A,
+                  const std::vector<T>&             bsr_val_A,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_B,
+                  const std::vector<rocsparse_int>& bsr_col_ind_B,
+                  const std::vector<T>&             bsr_val_B,
+                  const T*                          beta,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_D,
+                  const std::vector<rocsparse_int>& bsr_col_ind_D,
+                  const std::vector<T>&             bsr_val_D,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_C,
+                  std::vector<rocsparse_int>&       bsr_col_ind_C,
+                  std::vector<T>&                   bsr_val_C,
+                  rocsparse_index_base              base_A,
+                  rocsparse_index_base              base_B,
+                  rocsparse_index_base              base_C,
+                  rocsparse_index_base              base_D)
+{
+    rocsparse_int bs = block_dim * block_dim;
+
+    // Index of entry (bi, bj) of block j
+    auto idx = [&](rocsparse_int j, rocsparse_int bi, rocsparse_int bj) {
+        return (dir == rocsparse_direction_row) ? bs * j + block_dim * bi + bj
+                                                : bs * j + block_dim * bj + bi;
+    };
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::vector<rocsparse_int> nnz(Nb, -1);
+
+        int nthreads = 1;
+        int tid      = 0;
+
+#ifdef _OPENMP
+        nthreads = omp_get_num_threads();
+        tid      = omp_get_thread_num();
+#endif
+
+        rocsparse_int rows_per_thread = (Mb + nthreads - 1) / nthreads;
+        rocsparse_int chunk_begin     = rows_per_thread * tid;
+        rocsparse_int chunk_end       = std::min(chunk_begin + rows_per_thread, Mb);
+
+        // Loop over block rows of A
+        for(rocsparse_int i = chunk_begin; i < chunk_end; ++i)
+        {
+            rocsparse_int row_begin_C = bsr_row_ptr_C[i] - base_C;
+            rocsparse_int row_end_C   = row_begin_C;
+
+            rocsparse_int row_begin_A = alpha ? bsr_row_ptr_A[i] - base_A : 0;
+            rocsparse_int row_end_A   = alpha ? bsr_row_ptr_A[i + 1] - base_A : 0;
+            rocsparse_int row_begin_D = beta ? bsr_row_ptr_D[i] - base_D : 0;
+            rocsparse_int row_end_D   = beta ? bsr_row_ptr_D[i + 1] - base_D : 0;
+
+            // Gather the block columns of C
+            for(rocsparse_int j = row_begin_A; j < row_end_A; ++j)
+            {
+                rocsparse_int col_A = bsr_col_ind_A[j] - base_A;
+
+                for(rocsparse_int k = bsr_row_ptr_B[col_A] - base_B;
+                    k < bsr_row_ptr_B[col_A + 1] - base_B;
+                    ++k)
+                {
+                    rocsparse_int col_B = bsr_col_ind_B[k] - base_B;
+
+                    if(nnz[col_B] < row_begin_C)
+                    {
+                        nnz[col_B]                 = row_end_C;
+                        bsr_col_ind_C[row_end_C++] = col_B + base_C;
+                    }
+                }
+            }
+
+            for(rocsparse_int j = row_begin_D; j < row_end_D; ++j)
+            {
+                rocsparse_int col_D = bsr_col_ind_D[j] - base_D;
+
+                if(nnz[col_D] < row_begin_C)
+                {
+                    nnz[col_D]                 = row_end_C;
+                    bsr_col_ind_C[row_end_C++] = col_D + base_C;
+                }
+            }
+
+            // Sort the block columns of C and compute the position of each block
+            std::sort(bsr_col_ind_C.begin() + row_begin_C, bsr_col_ind_C.begin() + row_end_C);
+
+            for(rocsparse_int j = row_begin_C; j < row_end_C; ++j)
+            {
+                nnz[bsr_col_ind_C[j] - base_C] = j;
+
+                for(rocsparse_int k = 0; k < bs; ++k)
+                {
+                    bsr_val_C[bs * j + k] = static_cast<T>(0);
+                }
+            }
+
+            // Accumulate the dense block products
+            for(rocsparse_int j = row_begin_A; j < row_end_A; ++j)
+            {
+                rocsparse_int col_A = bsr_col_ind_A[j] - base_A;
+
+                for(rocsparse_int k = bsr_row_ptr_B[col_A] - base_B;
+                    k < bsr_row_ptr_B[col_A + 1] - base_B;
+                    ++k)
+                {
+                    rocsparse_int pos = nnz[bsr_col_ind_B[k] - base_B];
+
+                    for(rocsparse_int bi = 0; bi < block_dim; ++bi)
+                    {
+                        for(rocsparse_int bj = 0; bj < block_dim; ++bj)
+                        {
+                            T sum = static_cast<T>(0);
+
+                            for(rocsparse_int l = 0; l < block_dim; ++l)
+                            {
+                                sum = std::fma(
+                                    bsr_val_A[idx(j, bi, l)], bsr_val_B[idx(k, l, bj)], sum);
+                            }
+
+                            bsr_val_C[idx(pos, bi, bj)]
+                                = std::fma(*alpha, sum, bsr_val_C[idx(pos, bi, bj)]);
+                        }
+                    }
+                }
+            }
+
+            for(rocsparse_int j = row_begin_D; j < row_end_D; ++j)
+            {
+                rocsparse_int pos = nnz[bsr_col_ind_D[j] - base_D];
+
+                for(rocsparse_int k = 0; k < bs; ++k)
+                {
+                    bsr_val_C[bs * pos + k]
+                        = std::fma(*beta, bsr_val_D[bs * j + k], bsr_val_C[bs * pos + k]);
+                }
+            }
+        }
+    }
+}
+
 template <typename I, typename J, typename T>
 void host_csrgemm_nnz(J                     M,
                       J                     N,
@@ -2985,16 +3534,605 @@ void host_csrgemm(J                     M,
     }
 }
 
-template <typename T, typename I, typename J>
-void rocsparse_host<T, I, J>::cooddmm(rocsparse_operation  transA,
-                                      rocsparse_operation  transB,
-                                      rocsparse_order      orderA,
-                                      rocsparse_order      orderB,
-                                      J                    M,
-                                      J                    N,
-                                      J                    K,
-                                      I                    nnz,
-                                      const T*             alpha,
+template <typename I, typename J, typename T>
+void host_csrgemm_esc(J                     M,
+                      J                     N,
+                      J                     L,
+                      const T*              alpha,
+                      const std::vector<I>& csr_row_ptr_A,
+                      const std::vector<J>& csr_col_ind_A,
+                      const std::vector<T>& csr_val_A,
+                      const std::vector<I>& csr_row_ptr_B,
+                      const std::vector<J>& csr_col_ind_B,
+                      const std::vector<T>& csr_val_B,
+                      const T*              beta,
+                      const std::vector<I>& csr_row_ptr_D,
+                      const std::vector<J>& csr_col_ind_D,
+                      const std::vector<T>& csr_val_D,
+                      const std::vector<I>& csr_row_ptr_C,
+                      std::vector<J>&       csr_col_ind_C,
+                      std::vector<T>&       csr_val_C,
+                      rocsparse_index_base  base_A,
+                      rocsparse_index_base  base_B,
+                      rocsparse_index_base  base_C,
+                      rocsparse_index_base  base_D)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(J i = 0; i < M; ++i)
+    {
+        // Expand all intermediate products of row i
+        std::vector<std::pair<J, T>> esc;
+
+        if(alpha)
+        {
+            I row_begin_A = csr_row_ptr_A[i] - base_A;
+            I row_end_A   = csr_row_ptr_A[i + 1] - base_A;
+
+            for(I j = row_begin_A; j < row_end_A; ++j)
+            {
+                J col_A = csr_col_ind_A[j] - base_A;
+                T val_A = *alpha * csr_val_A[j];
+
+                I row_begin_B = csr_row_ptr_B[col_A] - base_B;
+                I row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
+
+                for(I k = row_begin_B; k < row_end_B; ++k)
+                {
+                    esc.push_back(std::make_pair(csr_col_ind_B[k] - base_B, val_A * csr_val_B[k]));
+                }
+            }
+        }
+
+        if(beta)
+        {
+            I row_begin_D = csr_row_ptr_D[i] - base_D;
+            I row_end_D   = csr_row_ptr_D[i + 1] - base_D;
+
+            for(I j = row_begin_D; j < row_end_D; ++j)
+            {
+                esc.push_back(std::make_pair(csr_col_ind_D[j] - base_D, *beta * csr_val_D[j]));
+            }
+        }
+
+        // Sort by column index, duplicates keep their order of expansion
+        std::stable_sort(
+            esc.begin(), esc.end(), [](const std::pair<J, T>& a, const std::pair<J, T>& b) {
+                return a.first < b.first;
+            });
+
+        // Compress duplicates into a single entry of C
+        I idx = csr_row_ptr_C[i] - base_C;
+
+        for(size_t j = 0; j < esc.size(); ++j)
+        {
+            if(j == 0 || esc[j].first != esc[j - 1].first)
+            {
+                csr_col_ind_C[idx] = esc[j].first + base_C;
+                csr_val_C[idx]     = esc[j].second;
+                ++idx;
+            }
+            else
+            {
+                csr_val_C[idx - 1] += esc[j].second;
+            }
+        }
+    }
+}
+
+template <typename T>
+void host_csrrap(rocsparse_operation               trans_R,
+                 rocsparse_int                     M,
+                 rocsparse_int                     N,
+                 rocsparse_int                     K,
+                 T                                 alpha,
+                 const std::vector<rocsparse_int>& csr_row_ptr_R,
+                 const std::vector<rocsparse_int>& csr_col_ind_R,
+                 const std::vector<T>&             csr_val_R,
+                 const std::vector<rocsparse_int>& csr_row_ptr_A,
+                 const std::vector<rocsparse_int>& csr_col_ind_A,
+                 const std::vector<T>&             csr_val_A,
+                 const std::vector<rocsparse_int>& csr_row_ptr_P,
+                 const std::vector<rocsparse_int>& csr_col_ind_P,
+                 const std::vector<T>&             csr_val_P,
+                 std::vector<rocsparse_int>&       csr_row_ptr_C,
+                 rocsparse_int*                    nnz_C,
+                 std::vector<rocsparse_int>&       csr_col_ind_C,
+                 std::vector<T>&                   csr_val_C,
+                 rocsparse_index_base              base_R,
+                 rocsparse_index_base              base_A,
+                 rocsparse_index_base              base_P,
+                 rocsparse_index_base              base_C)
+{
+    // op(R), R is K x M if transposed
+    std::vector<rocsparse_int> op_row_ptr_R;
+    std::vector<rocsparse_int> op_col_ind_R;
+    std::vector<T>             op_val_R;
+
+    if(trans_R == rocsparse_operation_transpose)
+    {
+        host_csr_to_csc(K,
+                        M,
+                        csr_row_ptr_R[K] - base_R,
+                        csr_row_ptr_R.data(),
+                        csr_col_ind_R.data(),
+                        csr_val_R.data(),
+                        op_col_ind_R,
+                        op_row_ptr_R,
+                        op_val_R,
+                        rocsparse_action_numeric,
+                        base_R);
+    }
+    else
+    {
+        op_row_ptr_R = csr_row_ptr_R;
+        op_col_ind_R = csr_col_ind_R;
+        op_val_R     = csr_val_R;
+    }
+
+    // Intermediate product A * P
+    T one = static_cast<T>(1);
+
+    rocsparse_int              nnz_AP;
+    std::vector<rocsparse_int> csr_row_ptr_AP(K + 1);
+
+    host_csrgemm_nnz(K,
+                     N,
+                     K,
+                     &one,
+                     csr_row_ptr_A,
+                     csr_col_ind_A,
+                     csr_row_ptr_P,
+                     csr_col_ind_P,
+                     (const T*)nullptr,
+                     csr_row_ptr_A,
+                     csr_col_ind_A,
+                     csr_row_ptr_AP,
+                     &nnz_AP,
+                     base_A,
+                     base_P,
+                     rocsparse_index_base_zero,
+                     rocsparse_index_base_zero);
+
+    std::vector<rocsparse_int> csr_col_ind_AP(nnz_AP);
+    std::vector<T>             csr_val_AP(nnz_AP);
+
+    host_csrgemm(K,
+                 N,
+                 K,
+                 &one,
+                 csr_row_ptr_A,
+                 csr_col_ind_A,
+                 csr_val_A,
+                 csr_row_ptr_P,
+                 csr_col_ind_P,
+                 csr_val_P,
+                 (const T*)nullptr,
+                 csr_row_ptr_A,
+                 csr_col_ind_A,
+                 csr_val_A,
+                 csr_row_ptr_AP,
+                 csr_col_ind_AP,
+                 csr_val_AP,
+                 base_A,
+                 base_P,
+                 rocsparse_index_base_zero,
+                 rocsparse_index_base_zero);
+
+    // alpha * op(R) * (A * P)
+    csr_row_ptr_C.resize(M + 1);
+
+    host_csrgemm_nnz(M,
+                     N,
+                     K,
+                     &alpha,
+                     op_row_ptr_R,
+                     op_col_ind_R,
+                     csr_row_ptr_AP,
+                     csr_col_ind_AP,
+                     (const T*)nullptr,
+                     op_row_ptr_R,
+                     op_col_ind_R,
+                     csr_row_ptr_C,
+                     nnz_C,
+                     base_R,
+                     rocsparse_index_base_zero,
+                     base_C,
+                     rocsparse_index_base_zero);
+
+    csr_col_ind_C.resize(*nnz_C);
+    csr_val_C.resize(*nnz_C);
+
+    host_csrgemm(M,
+                 N,
+                 K,
+                 &alpha,
+                 op_row_ptr_R,
+                 op_col_ind_R,
+                 op_val_R,
+                 csr_row_ptr_AP,
+                 csr_col_ind_AP,
+                 csr_val_AP,
+                 (const T*)nullptr,
+                 op_row_ptr_R,
+                 op_col_ind_R,
+                 op_val_R,
+                 csr_row_ptr_C,
+                 csr_col_ind_C,
+                 csr_val_C,
+                 base_R,
+                 rocsparse_index_base_zero,
+                 base_C,
+                 rocsparse_index_base_zero);
+}
+
+template <typename T>
+void host_csrgemm_masked(rocsparse_int                     M,
+                         rocsparse_int                     N,
+                         rocsparse_int                     K,
+                         T                                 alpha,
+                         const std::vector<rocsparse_int>& csr_row_ptr_A,
+                         const std::vector<rocsparse_int>& csr_col_ind_A,
+                         const std::vector<T>&             csr_val_A,
+                         const std::vector<rocsparse_int>& csr_row_ptr_B,
+                         const std::vector<rocsparse_int>& csr_col_ind_B,
+                         const std::vector<T>&             csr_val_B,
+                         const std::vector<rocsparse_int>& csr_row_ptr_M,
+                         const std::vector<rocsparse_int>& csr_col_ind_M,
+                         rocsparse_mask_type               mask_type,
+                         std::vector<rocsparse_int>&       csr_row_ptr_C,
+                         rocsparse_int*                    nnz_C,
+                         std::vector<rocsparse_int>&       csr_col_ind_C,
+                         std::vector<T>&                   csr_val_C,
+                         rocsparse_index_base              base_A,
+                         rocsparse_index_base              base_B,
+                         rocsparse_index_base              base_M,
+                         rocsparse_index_base              base_C)
+{
+    // Unmasked product alpha * A * B
+    rocsparse_int              nnz_AB;
+    std::vector<rocsparse_int> csr_row_ptr_AB(M + 1);
+
+    host_csrgemm_nnz(M,
+                     N,
+                     K,
+                     &alpha,
+                     csr_row_ptr_A,
+                     csr_col_ind_A,
+                     csr_row_ptr_B,
+                     csr_col_ind_B,
+                     (const T*)nullptr,
+                     csr_row_ptr_A,
+                     csr_col_ind_A,
+                     csr_row_ptr_AB,
+                     &nnz_AB,
+                     base_A,
+                     base_B,
+                     rocsparse_index_base_zero,
+                     rocsparse_index_base_zero);
+
+    std::vector<rocsparse_int> csr_col_ind_AB(nnz_AB);
+    std::vector<T>             csr_val_AB(nnz_AB);
+
+    host_csrgemm(M,
+                 N,
+                 K,
+                 &alpha,
+                 csr_row_ptr_A,
+                 csr_col_ind_A,
+                 csr_val_A,
+                 csr_row_ptr_B,
+                 csr_col_ind_B,
+                 csr_val_B,
+                 (const T*)nullptr,
+                 csr_row_ptr_A,
+                 csr_col_ind_A,
+                 csr_val_A,
+                 csr_row_ptr_AB,
+                 csr_col_ind_AB,
+                 csr_val_AB,
+                 base_A,
+                 base_B,
+                 rocsparse_index_base_zero,
+                 rocsparse_index_base_zero);
+
+    // Keep only the entries of A * B that pass the mask
+    bool complement = (mask_type == rocsparse_mask_type_complement);
+
+    csr_row_ptr_C.resize(M + 1);
+    csr_col_ind_C.clear();
+    csr_val_C.clear();
+
+    csr_row_ptr_C[0] = base_C;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        const rocsparse_int* mask_begin = csr_col_ind_M.data() + csr_row_ptr_M[i] - base_M;
+        const rocsparse_int* mask_end   = csr_col_ind_M.data() + csr_row_ptr_M[i + 1] - base_M;
+
+        for(rocsparse_int j = csr_row_ptr_AB[i]; j < csr_row_ptr_AB[i + 1]; ++j)
+        {
+            bool found = std::binary_search(mask_begin, mask_end, csr_col_ind_AB[j] + base_M);
+
+            if(found != complement)
+            {
+                csr_col_ind_C.push_back(csr_col_ind_AB[j] + base_C);
+                csr_val_C.push_back(csr_val_AB[j]);
+            }
+        }
+
+        csr_row_ptr_C[i + 1] = static_cast<rocsparse_int>(csr_col_ind_C.size()) + base_C;
+    }
+
+    *nnz_C = csr_row_ptr_C[M] - base_C;
+}
+
+template <typename I, typename J, typename T>
+void host_csrgemm_semiring(rocsparse_semiring    semiring,
+                           J                     M,
+                           J                     N,
+                           T                     alpha,
+                           const std::vector<I>& csr_row_ptr_A,
+                           const std::vector<J>& csr_col_ind_A,
+                           const std::vector<T>& csr_val_A,
+                           const std::vector<I>& csr_row_ptr_B,
+                           const std::vector<J>& csr_col_ind_B,
+                           const std::vector<T>& csr_val_B,
+                           const std::vector<I>& csr_row_ptr_C,
+                           std::vector<J>&       csr_col_ind_C,
+                           std::vector<T>&       csr_val_C,
+                           rocsparse_index_base  base_A,
+                           rocsparse_index_base  base_B,
+                           rocsparse_index_base  base_C)
+{
+    T zero = host_semiring_zero<T>(semiring);
+
+    // Position of each column in the current row of C
+    std::vector<I> nnz(N, -1);
+
+    for(J i = 0; i < M; ++i)
+    {
+        I row_begin_C = csr_row_ptr_C[i] - base_C;
+        I row_end_C   = row_begin_C;
+
+        I row_begin_A = csr_row_ptr_A[i] - base_A;
+        I row_end_A   = csr_row_ptr_A[i + 1] - base_A;
+
+        // Loop over columns of A
+        for(I j = row_begin_A; j < row_end_A; ++j)
+        {
+            J col_A = csr_col_ind_A[j] - base_A;
+            T val_A = host_semiring_mul(semiring, alpha, csr_val_A[j]);
+
+            I row_begin_B = csr_row_ptr_B[col_A] - base_B;
+            I row_end_B   = csr_row_ptr_B[col_A + 1] - base_B;
+
+            // Loop over columns of B in row col_A
+            for(I k = row_begin_B; k < row_end_B; ++k)
+            {
+                J col_B = csr_col_ind_B[k] - base_B;
+                T val   = host_semiring_mul(semiring, val_A, csr_val_B[k]);
+
+                // Check if a new nnz is generated or if the product is accumulated
+                if(nnz[col_B] < row_begin_C)
+                {
+                    nnz[col_B]               = row_end_C;
+                    csr_col_ind_C[row_end_C] = col_B;
+                    csr_val_C[row_end_C]     = host_semiring_add(semiring, zero, val);
+                    ++row_end_C;
+                }
+                else
+                {
+                    csr_val_C[nnz[col_B]] = host_semiring_add(semiring, csr_val_C[nnz[col_B]], val);
+                }
+            }
+        }
+
+        // Sort columns of the current row
+        J row_nnz = row_end_C - row_begin_C;
+
+        std::vector<J> perm(row_nnz);
+        for(J j = 0; j < row_nnz; ++j)
+        {
+            perm[j] = j;
+        }
+
+        std::vector<J> col(csr_col_ind_C.begin() + row_begin_C, csr_col_ind_C.begin() + row_end_C);
+        std::vector<T> val(csr_val_C.begin() + row_begin_C, csr_val_C.begin() + row_end_C);
+
+        std::sort(
+            perm.begin(), perm.end(), [&](const J& a, const J& b) { return col[a] < col[b]; });
+
+        for(J j = 0; j < row_nnz; ++j)
+        {
+            csr_col_ind_C[row_begin_C + j] = col[perm[j]] + base_C;
+            csr_val_C[row_begin_C + j]     = val[perm[j]];
+        }
+    }
+}
+
+template <typename I, typename J>
+void host_csrgemm_nnz_estimate(J                     M,
+                               J                     N,
+                               J                     sample_size,
+                               const std::vector<I>& csr_row_ptr_A,
+                               const std::vector<J>& csr_col_ind_A,
+                               const std::vector<I>& csr_row_ptr_B,
+                               const std::vector<J>& csr_col_ind_B,
+                               rocsparse_index_base  base_A,
+                               rocsparse_index_base  base_B,
+                               int64_t*              nnz_products,
+                               int64_t*              nnz_C,
+                               int64_t*              nnz_C_lower,
+                               int64_t*              nnz_C_upper)
+{
+    static constexpr int64_t      hash_size   = 2048;
+    static constexpr unsigned int bitmap_size = 65536;
+
+    *nnz_products = 0;
+    *nnz_C        = 0;
+    *nnz_C_lower  = 0;
+    *nnz_C_upper  = 0;
+
+    if(M == 0 || N == 0)
+    {
+        return;
+    }
+
+    // Total number of intermediate products
+    I nnz_A = csr_row_ptr_A[M] - base_A;
+
+    for(I j = 0; j < nnz_A; ++j)
+    {
+        J col_A = csr_col_ind_A[j] - base_A;
+
+        *nnz_products += csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A];
+    }
+
+    if(*nnz_products == 0)
+    {
+        return;
+    }
+
+    // Sampled rows
+    J nsamples = std::min(sample_size, M);
+
+    std::vector<int64_t> sample_products(nsamples);
+    std::vector<double>  sample_nnz(nsamples);
+
+    for(J s = 0; s < nsamples; ++s)
+    {
+        J row = (static_cast<int64_t>(s) * M) / nsamples;
+
+        I row_begin_A = csr_row_ptr_A[row] - base_A;
+        I row_end_A   = csr_row_ptr_A[row + 1] - base_A;
+
+        int64_t nprod = 0;
+
+        for(I j = row_begin_A; j < row_end_A; ++j)
+        {
+            J col_A = csr_col_ind_A[j] - base_A;
+
+            nprod += csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A];
+        }
+
+        std::vector<bool> nnz(nprod <= hash_size ? N : bitmap_size, false);
+
+        for(I j = row_begin_A; j < row_end_A; ++j)
+        {
+            J col_A = csr_col_ind_A[j] - base_A;
+
+            for(I k = csr_row_ptr_B[col_A] - base_B; k < csr_row_ptr_B[col_A + 1] - base_B; ++k)
+            {
+                J col_B = csr_col_ind_B[k] - base_B;
+
+                if(nprod <= hash_size)
+                {
+                    nnz[col_B] = true;
+                }
+                else
+                {
+                    // Linear counting, same hash function as the device
+                    unsigned int hash
+                        = ((static_cast<uint64_t>(col_B) * 0x9E3779B97F4A7C15ULL) >> 32)
+                          & (bitmap_size - 1);
+
+                    nnz[hash] = true;
+                }
+            }
+        }
+
+        int64_t count = std::count(nnz.begin(), nnz.end(), true);
+
+        double nnz_row = static_cast<double>(count);
+
+        if(nprod > hash_size)
+        {
+            int64_t zeros = bitmap_size - count;
+
+            nnz_row = (zeros == 0) ? static_cast<double>(nprod)
+                                   : -static_cast<double>(bitmap_size)
+                                         * std::log(static_cast<double>(zeros) / bitmap_size);
+
+            nnz_row = std::min(nnz_row, static_cast<double>(std::min(nprod, (int64_t)N)));
+        }
+
+        sample_products[s] = nprod;
+        sample_nnz[s]      = nnz_row;
+    }
+
+    // Ratio estimator
+    double bound = std::min(static_cast<double>(*nnz_products),
+                            static_cast<double>(M) * static_cast<double>(N));
+
+    double sum_x = 0.0;
+    double sum_y = 0.0;
+
+    for(J s = 0; s < nsamples; ++s)
+    {
+        sum_x += static_cast<double>(sample_products[s]);
+        sum_y += sample_nnz[s];
+    }
+
+    if(sum_x == 0.0)
+    {
+        *nnz_C_upper = static_cast<int64_t>(bound);
+        return;
+    }
+
+    double ratio    = sum_y / sum_x;
+    double estimate = ratio * static_cast<double>(*nnz_products);
+    double f        = static_cast<double>(nsamples) / static_cast<double>(M);
+
+    double lower = estimate;
+    double upper = estimate;
+
+    if(f < 1.0)
+    {
+        if(nsamples < 2)
+        {
+            lower = 0.0;
+            upper = bound;
+        }
+        else
+        {
+            double s2 = 0.0;
+
+            for(J s = 0; s < nsamples; ++s)
+            {
+                double r = sample_nnz[s] - ratio * static_cast<double>(sample_products[s]);
+                s2 += r * r;
+            }
+
+            s2 /= (nsamples - 1);
+
+            double se = static_cast<double>(M) * std::sqrt((1.0 - f) / nsamples * s2);
+
+            lower = estimate - 1.96 * se;
+            upper = estimate + 1.96 * se;
+        }
+    }
+
+    estimate = std::max(0.0, std::min(estimate, bound));
+    lower    = std::max(0.0, std::min(lower, estimate));
+    upper    = std::max(estimate, std::min(upper, bound));
+
+    *nnz_C       = static_cast<int64_t>(std::llround(estimate));
+    *nnz_C_lower = static_cast<int64_t>(std::floor(lower));
+    *nnz_C_upper = static_cast<int64_t>(std::ceil(upper));
+}
+
+template <typename T, typename I, typename J>
+void rocsparse_host<T, I, J>::cooddmm(rocsparse_operation  transA,
+                                      rocsparse_operation  transB,
+                                      rocsparse_order      orderA,
+                                      rocsparse_order      orderB,
+                                      J                    M,
+                                      J                    N,
+                                      J                    K,
+                                      I                    nnz,
+                                      const T*             alpha,
                                       const T*             A,
                                       J                    lda,
                                       const T*             B,
@@ -3726,50 +4864,223 @@ void host_bsrilu0(rocsparse_direction               dir,
 }
 
 template <typename T>
-void host_csric0(rocsparse_int                     M,
-                 const std::vector<rocsparse_int>& csr_row_ptr,
-                 const std::vector<rocsparse_int>& csr_col_ind,
-                 std::vector<T>&                   csr_val,
-                 rocsparse_index_base              base,
-                 rocsparse_int*                    struct_pivot,
-                 rocsparse_int*                    numeric_pivot)
+void host_bsrjacobi_setup(rocsparse_direction               dir,
+                          rocsparse_int                     mb,
+                          const std::vector<rocsparse_int>& bsr_row_ptr,
+                          const std::vector<rocsparse_int>& bsr_col_ind,
+                          const std::vector<T>&             bsr_val,
+                          rocsparse_int                     bsr_dim,
+                          rocsparse_index_base              base,
+                          std::vector<T>&                   bsr_diag_inv,
+                          rocsparse_int*                    zero_pivot)
 {
     // Initialize pivot
-    *struct_pivot  = -1;
-    *numeric_pivot = -1;
+    *zero_pivot = -1;
 
-    // pointer of upper part of each row
-    std::vector<rocsparse_int> diag_offset(M);
-    std::vector<rocsparse_int> nnz_entries(M, 0);
+    bsr_diag_inv.resize(mb * bsr_dim * bsr_dim);
 
-    // ai = 0 to N loop over all rows
-    for(rocsparse_int ai = 0; ai < M; ++ai)
+    // Dense copy of the current diagonal block and its row permutation
+    std::vector<T>             block(bsr_dim * bsr_dim);
+    std::vector<rocsparse_int> perm(bsr_dim);
+
+    for(rocsparse_int row = 0; row < mb; ++row)
     {
-        // ai-th row entries
-        rocsparse_int row_begin = csr_row_ptr[ai] - base;
-        rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
-        rocsparse_int j;
+        rocsparse_int row_begin = bsr_row_ptr[row] - base;
+        rocsparse_int row_end   = bsr_row_ptr[row + 1] - base;
 
-        // nnz position of ai-th row in val array
-        for(j = row_begin; j < row_end; ++j)
+        // Search the diagonal block
+        rocsparse_int row_diag = -1;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
         {
-            nnz_entries[csr_col_ind[j] - base] = j;
+            if(bsr_col_ind[j] - base == row)
+            {
+                row_diag = j;
+                break;
+            }
         }
 
-        T sum = static_cast<T>(0);
+        // Load the diagonal block, a missing block is treated as zero block
+        for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+        {
+            for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+            {
+                block[bi * bsr_dim + bj] = (row_diag != -1)
+                                               ? bsr_val[BSR_IND(row_diag, bi, bj, dir)]
+                                               : static_cast<T>(0);
+            }
+        }
 
-        bool has_diag = false;
+        bool singular = false;
 
-        // loop over ai-th row nnz entries
-        for(j = row_begin; j < row_end; ++j)
+        // Gauss-Jordan elimination with partial pivoting
+        for(rocsparse_int k = 0; k < bsr_dim; ++k)
         {
-            rocsparse_int col_j = csr_col_ind[j] - base;
-            T             val_j = csr_val[j];
+            rocsparse_int p   = k;
+            auto          max = std::abs(block[k * bsr_dim + k]);
 
-            // Mark diagonal and skip row
-            if(col_j == ai)
+            for(rocsparse_int i = k + 1; i < bsr_dim; ++i)
             {
-                has_diag = true;
+                auto val = std::abs(block[i * bsr_dim + k]);
+
+                if(val > max)
+                {
+                    p   = i;
+                    max = val;
+                }
+            }
+
+            perm[k] = p;
+
+            if(p != k)
+            {
+                for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                {
+                    std::swap(block[k * bsr_dim + bj], block[p * bsr_dim + bj]);
+                }
+            }
+
+            T diag = block[k * bsr_dim + k];
+
+            if(diag == static_cast<T>(0))
+            {
+                singular = true;
+                diag     = static_cast<T>(1);
+            }
+
+            for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+            {
+                for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+                {
+                    if(bi != k && bj != k)
+                    {
+                        block[bi * bsr_dim + bj]
+                            -= block[bi * bsr_dim + k] * block[k * bsr_dim + bj] / diag;
+                    }
+                }
+            }
+
+            for(rocsparse_int i = 0; i < bsr_dim; ++i)
+            {
+                if(i != k)
+                {
+                    block[k * bsr_dim + i] /= diag;
+                    block[i * bsr_dim + k] = -block[i * bsr_dim + k] / diag;
+                }
+            }
+
+            block[k * bsr_dim + k] = static_cast<T>(1) / diag;
+        }
+
+        // Undo the row permutations
+        for(rocsparse_int k = bsr_dim - 1; k >= 0; --k)
+        {
+            if(perm[k] != k)
+            {
+                for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+                {
+                    std::swap(block[bi * bsr_dim + k], block[bi * bsr_dim + perm[k]]);
+                }
+            }
+        }
+
+        for(rocsparse_int bi = 0; bi < bsr_dim; ++bi)
+        {
+            for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+            {
+                bsr_diag_inv[BSR_IND(row, bi, bj, dir)] = block[bi * bsr_dim + bj];
+            }
+        }
+
+        // Rows are processed in order, the first singular block is the zero pivot
+        if(singular && *zero_pivot == -1)
+        {
+            *zero_pivot = row + base;
+        }
+    }
+}
+
+template <typename T>
+void host_bsrjacobi_apply(rocsparse_direction   dir,
+                          rocsparse_int         mb,
+                          rocsparse_int         bsr_dim,
+                          T                     alpha,
+                          const std::vector<T>& bsr_diag_inv,
+                          const std::vector<T>& x,
+                          T                     beta,
+                          std::vector<T>&       y)
+{
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for(rocsparse_int i = 0; i < mb * bsr_dim; ++i)
+    {
+        rocsparse_int row = i / bsr_dim;
+        rocsparse_int bi  = i % bsr_dim;
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+        {
+            sum = std::fma(bsr_diag_inv[BSR_IND(row, bi, bj, dir)], x[row * bsr_dim + bj], sum);
+        }
+
+        if(beta != static_cast<T>(0))
+        {
+            y[i] = std::fma(beta, y[i], alpha * sum);
+        }
+        else
+        {
+            y[i] = alpha * sum;
+        }
+    }
+}
+
+template <typename T>
+void host_csric0(rocsparse_int                     M,
+                 const std::vector<rocsparse_int>& csr_row_ptr,
+                 const std::vector<rocsparse_int>& csr_col_ind,
+                 std::vector<T>&                   csr_val,
+                 rocsparse_index_base              base,
+                 rocsparse_int*                    struct_pivot,
+                 rocsparse_int*                    numeric_pivot)
+{
+    // Initialize pivot
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
+
+    // pointer of upper part of each row
+    std::vector<rocsparse_int> diag_offset(M);
+    std::vector<rocsparse_int> nnz_entries(M, 0);
+
+    // ai = 0 to N loop over all rows
+    for(rocsparse_int ai = 0; ai < M; ++ai)
+    {
+        // ai-th row entries
+        rocsparse_int row_begin = csr_row_ptr[ai] - base;
+        rocsparse_int row_end   = csr_row_ptr[ai + 1] - base;
+        rocsparse_int j;
+
+        // nnz position of ai-th row in val array
+        for(j = row_begin; j < row_end; ++j)
+        {
+            nnz_entries[csr_col_ind[j] - base] = j;
+        }
+
+        T sum = static_cast<T>(0);
+
+        bool has_diag = false;
+
+        // loop over ai-th row nnz entries
+        for(j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col_j = csr_col_ind[j] - base;
+            T             val_j = csr_val[j];
+
+            // Mark diagonal and skip row
+            if(col_j == ai)
+            {
+                has_diag = true;
                 break;
             }
 
@@ -3900,157 +5211,1516 @@ void host_csrilu0(rocsparse_int                     M,
                     }
                 }
 
-                // multiplication factor
-                csr_val[j] = csr_val[j] / diag_val;
+                // multiplication factor
+                csr_val[j] = csr_val[j] / diag_val;
+
+                // loop over upper offset pointer and do linear combination for nnz entry
+                for(rocsparse_int k = diag_j + 1; k < csr_row_ptr[col_j + 1] - base; ++k)
+                {
+                    // if nnz at this position do linear combination
+                    if(nnz_entries[csr_col_ind[k] - base] != 0)
+                    {
+                        rocsparse_int idx = nnz_entries[csr_col_ind[k] - base];
+                        csr_val[idx]      = std::fma(-csr_val[j], csr_val[k], csr_val[idx]);
+                    }
+                }
+            }
+            else if(csr_col_ind[j] - base == ai)
+            {
+                has_diag = true;
+                break;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if(!has_diag)
+        {
+            // Structural (and numerical) zero diagonal
+            *struct_pivot  = ai + base;
+            *numeric_pivot = ai + base;
+            return;
+        }
+
+        // set diagonal pointer to diagonal element
+        diag_offset[ai] = j;
+
+        // clear nnz entries
+        for(j = row_begin; j < row_end; ++j)
+        {
+            nnz_entries[csr_col_ind[j] - base] = 0;
+        }
+    }
+}
+
+template <typename T, typename U>
+void host_csritilu0(rocsparse_int                     M,
+                    const std::vector<rocsparse_int>& csr_row_ptr,
+                    const std::vector<rocsparse_int>& csr_col_ind,
+                    std::vector<T>&                   csr_val,
+                    rocsparse_index_base              base,
+                    bool                              ichol,
+                    rocsparse_int                     nsweeps,
+                    std::vector<U>&                   history,
+                    rocsparse_int*                    struct_pivot,
+                    rocsparse_int*                    numeric_pivot)
+{
+    // Initialize pivot
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
+
+    history.assign(nsweeps, static_cast<U>(0));
+
+    // Position of the diagonal entry of each row
+    std::vector<rocsparse_int> diag_offset(M, -1);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            if(csr_col_ind[j] - base == i)
+            {
+                diag_offset[i] = j;
+            }
+        }
+
+        if(diag_offset[i] == -1 && *struct_pivot == -1)
+        {
+            *struct_pivot = i + base;
+        }
+    }
+
+    *numeric_pivot = *struct_pivot;
+
+    // Position of column col in row, or -1
+    auto find = [&](rocsparse_int row, rocsparse_int col) {
+        for(rocsparse_int j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base; ++j)
+        {
+            if(csr_col_ind[j] - base == col)
+            {
+                return j;
+            }
+        }
+
+        return -1;
+    };
+
+    std::vector<T> a_val(csr_val);
+
+    // Initial guess
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            if(col < i && diag_offset[col] != -1)
+            {
+                T diag = a_val[diag_offset[col]];
+
+                if(ichol)
+                {
+                    diag = std::sqrt(std::abs(diag));
+                }
+
+                if(diag != static_cast<T>(0))
+                {
+                    csr_val[j] = a_val[j] / diag;
+                }
+            }
+            else if(ichol && col == i)
+            {
+                csr_val[j] = std::sqrt(std::abs(a_val[j]));
+            }
+        }
+    }
+
+    // Fixed-point sweeps
+    for(rocsparse_int sweep = 0; sweep < nsweeps; ++sweep)
+    {
+        std::vector<T> prev(csr_val);
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if(ichol && col > i)
+                {
+                    continue;
+                }
+
+                T sum = static_cast<T>(0);
+
+                for(rocsparse_int k = csr_row_ptr[i] - base; k < csr_row_ptr[i + 1] - base; ++k)
+                {
+                    rocsparse_int kcol = csr_col_ind[k] - base;
+
+                    if(kcol >= std::min(i, col))
+                    {
+                        break;
+                    }
+
+                    rocsparse_int idx = ichol ? find(col, kcol) : find(kcol, col);
+
+                    if(idx != -1)
+                    {
+                        sum = ichol ? std::fma(prev[idx], rocsparse_conj(prev[k]), sum)
+                                    : std::fma(prev[k], prev[idx], sum);
+                    }
+                }
+
+                T s = a_val[j] - sum;
+                T r = static_cast<T>(0);
+
+                if(col < i)
+                {
+                    if(diag_offset[col] != -1)
+                    {
+                        T diag = prev[diag_offset[col]];
+
+                        if(diag == static_cast<T>(0))
+                        {
+                            if(*numeric_pivot == -1 || col + base < *numeric_pivot)
+                            {
+                                *numeric_pivot = col + base;
+                            }
+
+                            r = s;
+                        }
+                        else
+                        {
+                            csr_val[j] = s / diag;
+                            r          = s - prev[j] * (ichol ? rocsparse_conj(diag) : diag);
+                        }
+                    }
+                }
+                else if(ichol)
+                {
+                    csr_val[j] = std::sqrt(std::abs(s));
+                    r          = s - prev[j] * rocsparse_conj(prev[j]);
+                }
+                else
+                {
+                    csr_val[j] = s;
+                    r          = s - prev[j];
+                }
+
+                history[sweep] += std::abs(r) * std::abs(r);
+            }
+        }
+
+        history[sweep] = std::sqrt(history[sweep]);
+    }
+}
+
+template <typename T, typename U>
+void host_csrilut(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  const std::vector<T>&             csr_val,
+                  rocsparse_index_base              base,
+                  bool                              ichol,
+                  U                                 tol,
+                  rocsparse_int                     max_fill,
+                  bool                              boost,
+                  U                                 boost_tol,
+                  T                                 boost_val,
+                  std::vector<rocsparse_int>&       lu_row_ptr,
+                  std::vector<rocsparse_int>&       lu_col_ind,
+                  std::vector<T>&                   lu_val,
+                  rocsparse_int*                    struct_pivot,
+                  rocsparse_int*                    numeric_pivot)
+{
+    // Initialize pivot
+    *struct_pivot  = -1;
+    *numeric_pivot = -1;
+
+    // Fill per row in each triangular part
+    size_t p = std::min(max_fill, std::max(M - 1, 0));
+
+    typedef std::pair<rocsparse_int, T> entry_t;
+
+    // Rows of L and U, the diagonal is stored in front of U
+    std::vector<std::vector<entry_t>> l_rows(M);
+    std::vector<std::vector<entry_t>> u_rows(M);
+
+    // Order by decreasing magnitude, ties are broken by the column index
+    auto by_magnitude = [](const entry_t& a, const entry_t& b) {
+        return std::abs(a.second) > std::abs(b.second)
+               || (std::abs(a.second) == std::abs(b.second) && a.first < b.first);
+    };
+
+    auto by_column = [](const entry_t& a, const entry_t& b) { return a.first < b.first; };
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        // Working row, initialized with row i of A
+        std::map<rocsparse_int, T> w;
+
+        U    nrm      = static_cast<U>(0);
+        bool has_diag = false;
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - base;
+
+            w[col] = csr_val[j];
+            nrm += std::abs(csr_val[j]) * std::abs(csr_val[j]);
+
+            if(col == i)
+            {
+                has_diag = true;
+            }
+        }
+
+        if(!has_diag && *struct_pivot == -1)
+        {
+            *struct_pivot = i + base;
+        }
+
+        // Drop tolerance of the current row
+        U tau = tol * std::sqrt(nrm);
+
+        // Eliminate the strictly lower part in increasing column order, fill-in is
+        // inserted behind the current position
+        for(auto it = w.begin(); it != w.end() && it->first < i; ++it)
+        {
+            rocsparse_int k = it->first;
+
+            T diag_val = u_rows[k][0].second;
+
+            // Skip this row if it has a zero pivot
+            if(diag_val == static_cast<T>(0))
+            {
+                break;
+            }
+
+            T val = it->second / diag_val;
+
+            // Drop small multipliers
+            if(std::abs(val) <= tau)
+            {
+                val = static_cast<T>(0);
+            }
+
+            it->second = val;
+
+            if(val == static_cast<T>(0))
+            {
+                continue;
+            }
+
+            for(size_t t = 1; t < u_rows[k].size(); ++t)
+            {
+                T& entry = w[u_rows[k][t].first];
+                entry    = std::fma(-val, u_rows[k][t].second, entry);
+            }
+        }
+
+        // Keep the max_fill largest entries of each triangular part that exceed tau
+        for(int part = 0; part < 2; ++part)
+        {
+            std::vector<entry_t> entries;
+
+            for(auto& entry : w)
+            {
+                if(entry.first != i && (entry.first < i) == (part == 0)
+                   && std::abs(entry.second) > tau)
+                {
+                    entries.push_back(entry);
+                }
+            }
+
+            std::sort(entries.begin(), entries.end(), by_magnitude);
+
+            if(entries.size() > p)
+            {
+                entries.resize(p);
+            }
+
+            std::sort(entries.begin(), entries.end(), by_column);
+
+            if(part == 0)
+            {
+                l_rows[i] = entries;
+            }
+            else
+            {
+                auto diag = w.find(i);
+
+                T diag_val = (diag != w.end()) ? diag->second : static_cast<T>(0);
+
+                // Numeric boost
+                if(boost)
+                {
+                    diag_val = (boost_tol >= std::abs(diag_val)) ? boost_val : diag_val;
+                }
+                else if(diag_val == static_cast<T>(0) && *numeric_pivot == -1)
+                {
+                    *numeric_pivot = i + base;
+                }
+
+                u_rows[i].push_back(std::make_pair(i, diag_val));
+                u_rows[i].insert(u_rows[i].end(), entries.begin(), entries.end());
+            }
+        }
+    }
+
+    // The first zero pivot is either numerical or structural
+    if(*struct_pivot != -1 && (*numeric_pivot == -1 || *struct_pivot < *numeric_pivot))
+    {
+        *numeric_pivot = *struct_pivot;
+    }
+
+    // Assemble the factorization. For ICT, the lower factor is L D^1/2.
+    lu_row_ptr.resize(M + 1);
+    lu_col_ind.clear();
+    lu_val.clear();
+
+    lu_row_ptr[0] = base;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(auto& entry : l_rows[i])
+        {
+            T val = entry.second;
+
+            if(ichol)
+            {
+                val = val * static_cast<T>(std::sqrt(std::abs(u_rows[entry.first][0].second)));
+            }
+
+            lu_col_ind.push_back(entry.first + base);
+            lu_val.push_back(val);
+        }
+
+        if(ichol)
+        {
+            lu_col_ind.push_back(i + base);
+            lu_val.push_back(static_cast<T>(std::sqrt(std::abs(u_rows[i][0].second))));
+        }
+        else
+        {
+            for(auto& entry : u_rows[i])
+            {
+                lu_col_ind.push_back(entry.first + base);
+                lu_val.push_back(entry.second);
+            }
+        }
+
+        lu_row_ptr[i + 1] = lu_col_ind.size() + base;
+    }
+}
+
+template <typename T>
+void host_csrfsai(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr_A,
+                  const std::vector<rocsparse_int>& csr_col_ind_A,
+                  const std::vector<T>&             csr_val_A,
+                  rocsparse_index_base              base_A,
+                  const std::vector<rocsparse_int>& csr_row_ptr_S,
+                  const std::vector<rocsparse_int>& csr_col_ind_S,
+                  rocsparse_index_base              base_S,
+                  rocsparse_index_base              base_G,
+                  std::vector<rocsparse_int>&       csr_row_ptr_G,
+                  std::vector<rocsparse_int>&       csr_col_ind_G,
+                  std::vector<T>&                   csr_val_G,
+                  rocsparse_int*                    zero_pivot)
+{
+    // Initialize pivot
+    *zero_pivot = -1;
+
+    // Row i of G holds the strictly lower part of row i of S and the diagonal
+    csr_row_ptr_G.resize(M + 1);
+    csr_row_ptr_G[0] = base_G;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int nnz_row = 1;
+
+        for(rocsparse_int j = csr_row_ptr_S[i] - base_S; j < csr_row_ptr_S[i + 1] - base_S; ++j)
+        {
+            if(csr_col_ind_S[j] - base_S < i)
+            {
+                ++nnz_row;
+            }
+        }
+
+        csr_row_ptr_G[i + 1] = csr_row_ptr_G[i] + nnz_row;
+    }
+
+    rocsparse_int nnz_G = csr_row_ptr_G[M] - base_G;
+
+    csr_col_ind_G.resize(nnz_G);
+    csr_val_G.resize(nnz_G);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int row_begin = csr_row_ptr_G[i] - base_G;
+        rocsparse_int n         = csr_row_ptr_G[i + 1] - base_G - row_begin;
+
+        // Column indices of the row
+        for(rocsparse_int j = 0; j < n - 1; ++j)
+        {
+            csr_col_ind_G[row_begin + j] = csr_col_ind_S[csr_row_ptr_S[i] - base_S + j] - base_S;
+        }
+
+        csr_col_ind_G[row_begin + n - 1] = i;
+
+        // Assemble the lower part of the local problem A(J, J)
+        std::vector<T> local(n * n, static_cast<T>(0));
+
+        for(rocsparse_int q = 0; q < n; ++q)
+        {
+            for(rocsparse_int p = q; p < n; ++p)
+            {
+                rocsparse_int row_A = csr_col_ind_G[row_begin + p];
+                rocsparse_int col_A = csr_col_ind_G[row_begin + q];
+
+                for(rocsparse_int k = csr_row_ptr_A[row_A] - base_A;
+                    k < csr_row_ptr_A[row_A + 1] - base_A;
+                    ++k)
+                {
+                    if(csr_col_ind_A[k] - base_A == col_A)
+                    {
+                        local[p + q * n] = csr_val_A[k];
+                        break;
+                    }
+                }
+            }
+        }
+
+        bool singular = false;
+
+        // Cholesky decomposition
+        for(rocsparse_int k = 0; k < n; ++k)
+        {
+            auto diag = std::real(local[k + k * n]);
+
+            if(diag <= static_cast<decltype(diag)>(0))
+            {
+                singular = true;
+                diag     = static_cast<decltype(diag)>(1);
+            }
+
+            diag = std::sqrt(diag);
+
+            for(rocsparse_int p = k + 1; p < n; ++p)
+            {
+                local[p + k * n] /= diag;
+            }
+
+            local[k + k * n] = static_cast<T>(diag);
+
+            for(rocsparse_int q = k + 1; q < n; ++q)
+            {
+                for(rocsparse_int p = q; p < n; ++p)
+                {
+                    local[p + q * n] -= local[p + k * n] * rocsparse_conj(local[q + k * n]);
+                }
+            }
+        }
+
+        // Solve L^H g = e_n, the conjugate is stored as row of G
+        T* g = &csr_val_G[row_begin];
+
+        for(rocsparse_int j = 0; j < n; ++j)
+        {
+            g[j] = (j == n - 1) ? static_cast<T>(1) : static_cast<T>(0);
+        }
+
+        for(rocsparse_int k = n - 1; k >= 0; --k)
+        {
+            g[k] /= local[k + k * n];
+
+            for(rocsparse_int j = 0; j < k; ++j)
+            {
+                g[j] -= rocsparse_conj(local[k + j * n]) * g[k];
+            }
+        }
+
+        for(rocsparse_int j = 0; j < n; ++j)
+        {
+            g[j]                         = rocsparse_conj(g[j]);
+            csr_col_ind_G[row_begin + j] += base_G;
+        }
+
+        // Rows are processed in order, the first singular row is the zero pivot
+        if(singular && *zero_pivot == -1)
+        {
+            *zero_pivot = i + base_A;
+        }
+    }
+}
+
+template <typename T, typename U>
+void host_csrcheb_estimate(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           const std::vector<T>&             csr_val,
+                           rocsparse_index_base              base,
+                           rocsparse_int                     iters,
+                           U*                                lambda_max)
+{
+    // Deterministic start vector, matches the device implementation
+    std::vector<T> v(M);
+    std::vector<T> w(M);
+
+    U nrm2 = static_cast<U>(0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        uint32_t hash = static_cast<uint32_t>(i) * 2654435761u;
+        U        val  = static_cast<U>((hash >> 16) & 0xffff) / static_cast<U>(32768) - 1;
+
+        v[i] = static_cast<T>(val);
+        nrm2 += val * val;
+    }
+
+    *lambda_max = static_cast<U>(0);
+
+    for(rocsparse_int iter = 0; iter < iters; ++iter)
+    {
+        U scale = (nrm2 > static_cast<U>(0)) ? static_cast<U>(1) / std::sqrt(nrm2)
+                                             : static_cast<U>(0);
+
+        T dot = static_cast<T>(0);
+        U nrm = static_cast<U>(0);
+
+        // w = A v / ||v||
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                sum = std::fma(csr_val[j], v[csr_col_ind[j] - base], sum);
+            }
+
+            sum = sum * static_cast<T>(scale);
+
+            w[i] = sum;
+
+            dot = std::fma(rocsparse_conj(v[i]) * static_cast<T>(scale), sum, dot);
+            nrm += std::real(rocsparse_conj(sum) * sum);
+        }
+
+        // Rayleigh quotient
+        *lambda_max = std::real(dot);
+        nrm2        = nrm;
+
+        std::swap(v, w);
+    }
+}
+
+template <typename T, typename U>
+void host_csrcheb(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  const std::vector<T>&             csr_val,
+                  rocsparse_index_base              base,
+                  rocsparse_int                     degree,
+                  U                                 lambda_min,
+                  U                                 lambda_max,
+                  const std::vector<T>&             b,
+                  std::vector<T>&                   x)
+{
+    if(degree == 0)
+    {
+        return;
+    }
+
+    std::vector<T> r(M);
+    std::vector<T> d(M);
+    std::vector<T> d_next(M);
+
+    // Center and half width of the eigenvalue interval
+    U theta = (lambda_max + lambda_min) / 2;
+    U delta = (lambda_max - lambda_min) / 2;
+    U sigma = theta / delta;
+    U rho   = static_cast<U>(1) / sigma;
+
+    // r = b - A x, d = r / theta
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            sum = std::fma(csr_val[j], x[csr_col_ind[j] - base], sum);
+        }
+
+        r[i] = b[i] - sum;
+        d[i] = r[i] * static_cast<T>(static_cast<U>(1) / theta);
+    }
+
+    for(rocsparse_int k = 1; k < degree; ++k)
+    {
+        U rho_next = static_cast<U>(1) / (2 * sigma - rho);
+
+        T alpha = static_cast<T>(rho_next * rho);
+        T beta  = static_cast<T>(2 * rho_next / delta);
+
+        // x = x + d, r = r - A d, d = alpha * d + beta * r
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            T sum = static_cast<T>(0);
+
+            for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                sum = std::fma(csr_val[j], d[csr_col_ind[j] - base], sum);
+            }
+
+            x[i] = x[i] + d[i];
+            r[i] = r[i] - sum;
+
+            d_next[i] = alpha * d[i] + beta * r[i];
+        }
+
+        std::swap(d, d_next);
+        rho = rho_next;
+    }
+
+    // x = x + d
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        x[i] = x[i] + d[i];
+    }
+}
+
+
+// Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
+template <typename T>
+void host_gtsv_no_pivot(rocsparse_int         m,
+                        rocsparse_int         n,
+                        const std::vector<T>& dl,
+                        const std::vector<T>& d,
+                        const std::vector<T>& du,
+                        std::vector<T>&       B,
+                        rocsparse_int         ldb)
+{
+    rocsparse_int BLOCKSIZE = 0;
+    if((m & (m - 1)) == 0)
+    {
+        BLOCKSIZE = m;
+    }
+    else
+    {
+        BLOCKSIZE = pow(2, static_cast<rocsparse_int>(log2(m)) + 1);
+    }
+
+    for(rocsparse_int col = 0; col < n; col++)
+    {
+        rocsparse_int iter   = static_cast<rocsparse_int>(log2(BLOCKSIZE / 2));
+        rocsparse_int stride = 1;
+
+        std::vector<T> sa(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> sb(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> sc(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
+
+        std::vector<T> a(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> b(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> c(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
+        std::vector<T> x(BLOCKSIZE, static_cast<T>(0));
+
+        for(rocsparse_int i = 0; i < m; i++)
+        {
+            a[i]   = dl[i];
+            b[i]   = d[i];
+            c[i]   = du[i];
+            rhs[i] = B[ldb * col + i];
+        }
+
+        for(rocsparse_int j = 0; j < iter; j++)
+        {
+            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+            {
+                rocsparse_int right = tid + stride;
+                if(right >= m)
+                    right = m - 1;
+
+                rocsparse_int left = tid - stride;
+                if(left < 0)
+                    left = 0;
+
+                T k1 = a[tid] / b[left];
+                T k2 = c[tid] / b[right];
+
+                T tb   = b[tid] - c[left] * k1 - a[right] * k2;
+                T trhs = rhs[tid] - rhs[left] * k1 - rhs[right] * k2;
+                T ta   = -a[left] * k1;
+                T tc   = -c[right] * k2;
+
+                sb[tid]   = tb;
+                srhs[tid] = trhs;
+                sa[tid]   = ta;
+                sc[tid]   = tc;
+            }
+
+            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+            {
+                a[tid]   = sa[tid];
+                b[tid]   = sb[tid];
+                c[tid]   = sc[tid];
+                rhs[tid] = srhs[tid];
+            }
+
+            stride *= 2;
+        }
+
+        for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+        {
+            if(tid < BLOCKSIZE / 2)
+            {
+                rocsparse_int i = tid;
+                rocsparse_int j = tid + stride;
+
+                if(j < m)
+                {
+                    // Solve 2x2 systems
+                    T det = b[j] * b[i] - c[i] * a[j];
+                    x[i]  = (b[j] * rhs[i] - c[i] * rhs[j]) / det;
+                    x[j]  = (rhs[j] * b[i] - rhs[i] * a[j]) / det;
+                }
+                else
+                {
+                    // Solve 1x1 systems
+                    x[i] = rhs[i] / b[i];
+                }
+            }
+        }
+
+        for(rocsparse_int i = 0; i < m; i++)
+        {
+            B[ldb * col + i] = x[i];
+        }
+    }
+}
+
+// Gaussian elimination with partial pivoting for a single tri-diagonal system, where
+// consecutive entries of the system are inc elements apart
+template <typename T>
+static void host_gtsv_lu_solve(
+    rocsparse_int m, const T* dl, const T* d, const T* du, T* x, rocsparse_int inc)
+{
+    std::vector<T> u0(m);
+    std::vector<T> u1(m);
+    std::vector<T> u2(m);
+
+    // Active row of the elimination, holding the entries of columns i and i + 1
+    T a = d[0];
+    T b = du[0];
+    T r = x[0];
+
+    for(rocsparse_int i = 0; i < m - 1; ++i)
+    {
+        T l  = dl[inc * (i + 1)];
+        T dn = d[inc * (i + 1)];
+        T un = (i + 2 < m) ? du[inc * (i + 1)] : static_cast<T>(0);
+        T rn = x[inc * (i + 1)];
+
+        if(std::abs(a) >= std::abs(l))
+        {
+            T f = (a != static_cast<T>(0)) ? l / a : static_cast<T>(0);
+
+            u0[i]      = a;
+            u1[i]      = b;
+            u2[i]      = static_cast<T>(0);
+            x[inc * i] = r;
+
+            a = dn - f * b;
+            b = un;
+            r = rn - f * r;
+        }
+        else
+        {
+            T f = a / l;
+
+            u0[i]      = l;
+            u1[i]      = dn;
+            u2[i]      = un;
+            x[inc * i] = rn;
+
+            a = b - f * dn;
+            b = -f * un;
+            r = r - f * rn;
+        }
+    }
+
+    x[inc * (m - 1)] = r / a;
+
+    for(rocsparse_int i = m - 2; i >= 0; --i)
+    {
+        T sum = x[inc * i] - u1[i] * x[inc * (i + 1)];
+
+        if(i + 2 < m)
+        {
+            sum -= u2[i] * x[inc * (i + 2)];
+        }
+
+        x[inc * i] = sum / u0[i];
+    }
+}
+
+// Thomas algorithm for a single tri-diagonal system, where consecutive entries of the
+// system are inc elements apart
+template <typename T>
+static void host_gtsv_thomas_solve(
+    rocsparse_int m, const T* dl, const T* d, const T* du, T* x, rocsparse_int inc)
+{
+    std::vector<T> c(m);
+
+    c[0] = du[0] / d[0];
+    x[0] = x[0] / d[0];
+
+    for(rocsparse_int i = 1; i < m; ++i)
+    {
+        T denom = d[inc * i] - dl[inc * i] * c[i - 1];
+
+        c[i]       = du[inc * i] / denom;
+        x[inc * i] = (x[inc * i] - dl[inc * i] * x[inc * (i - 1)]) / denom;
+    }
+
+    for(rocsparse_int i = m - 2; i >= 0; --i)
+    {
+        x[inc * i] -= c[i] * x[inc * (i + 1)];
+    }
+}
+
+template <typename T>
+void host_gtsv(rocsparse_int         m,
+               rocsparse_int         n,
+               const std::vector<T>& dl,
+               const std::vector<T>& d,
+               const std::vector<T>& du,
+               std::vector<T>&       B,
+               rocsparse_int         ldb)
+{
+    for(rocsparse_int col = 0; col < n; col++)
+    {
+        host_gtsv_lu_solve(m, dl.data(), d.data(), du.data(), B.data() + ldb * col, 1);
+    }
+}
+
+template <typename T>
+void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
+                                      const std::vector<T>& dl,
+                                      const std::vector<T>& d,
+                                      const std::vector<T>& du,
+                                      std::vector<T>&       x,
+                                      rocsparse_int         batch_count,
+                                      rocsparse_int         batch_stride)
+{
+    for(rocsparse_int j = 0; j < batch_count; j++)
+    {
+        rocsparse_int offset = batch_stride * j;
+
+        host_gtsv_thomas_solve(
+            m, dl.data() + offset, d.data() + offset, du.data() + offset, x.data() + offset, 1);
+    }
+}
+
+template <typename T>
+void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg alg,
+                                 rocsparse_int                  m,
+                                 const std::vector<T>&          dl,
+                                 const std::vector<T>&          d,
+                                 const std::vector<T>&          du,
+                                 std::vector<T>&                x,
+                                 rocsparse_int                  batch_count,
+                                 rocsparse_int                  batch_stride)
+{
+    for(rocsparse_int j = 0; j < batch_count; j++)
+    {
+        if(alg == rocsparse_gtsv_interleaved_alg_thomas)
+        {
+            host_gtsv_thomas_solve(
+                m, dl.data() + j, d.data() + j, du.data() + j, x.data() + j, batch_stride);
+        }
+        else
+        {
+            host_gtsv_lu_solve(
+                m, dl.data() + j, d.data() + j, du.data() + j, x.data() + j, batch_stride);
+        }
+    }
+}
+
+// Gaussian elimination without pivoting for a single penta-diagonal system, where
+// consecutive entries of the system are inc elements apart
+template <typename T>
+static void host_gpsv_solve(rocsparse_int m,
+                            const T*      ds,
+                            const T*      dl,
+                            const T*      d,
+                            const T*      du,
+                            const T*      dw,
+                            T*            x,
+                            rocsparse_int inc)
+{
+    std::vector<T> u1(m + 2, static_cast<T>(0));
+    std::vector<T> u2(m + 2, static_cast<T>(0));
+    std::vector<T> y(m + 2, static_cast<T>(0));
+
+    // Forward elimination, the first two entries of u1, u2 and y are padding
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        T a = ds[inc * i];
+        T b = dl[inc * i] - a * u1[i];
+        T c = d[inc * i] - a * u2[i] - b * u1[i + 1];
+
+        u1[i + 2] = (du[inc * i] - b * u2[i + 1]) / c;
+        u2[i + 2] = dw[inc * i] / c;
+        y[i + 2]  = (x[inc * i] - a * y[i] - b * y[i + 1]) / c;
+    }
+
+    // Backward substitution
+    x[inc * (m - 1)] = y[m + 1];
+    x[inc * (m - 2)] = y[m] - u1[m] * x[inc * (m - 1)];
+
+    for(rocsparse_int i = m - 3; i >= 0; --i)
+    {
+        x[inc * i] = y[i + 2] - u1[i + 2] * x[inc * (i + 1)] - u2[i + 2] * x[inc * (i + 2)];
+    }
+}
+
+template <typename T>
+void host_gpsv_no_pivot_strided_batch(rocsparse_int         m,
+                                      const std::vector<T>& ds,
+                                      const std::vector<T>& dl,
+                                      const std::vector<T>& d,
+                                      const std::vector<T>& du,
+                                      const std::vector<T>& dw,
+                                      std::vector<T>&       x,
+                                      rocsparse_int         batch_count,
+                                      rocsparse_int         batch_stride)
+{
+    for(rocsparse_int j = 0; j < batch_count; j++)
+    {
+        rocsparse_int offset = batch_stride * j;
+
+        host_gpsv_solve(m,
+                        ds.data() + offset,
+                        dl.data() + offset,
+                        d.data() + offset,
+                        du.data() + offset,
+                        dw.data() + offset,
+                        x.data() + offset,
+                        1);
+    }
+}
+
+template <typename T>
+void host_gpsv_no_pivot_interleaved_batch(rocsparse_int         m,
+                                          const std::vector<T>& ds,
+                                          const std::vector<T>& dl,
+                                          const std::vector<T>& d,
+                                          const std::vector<T>& du,
+                                          const std::vector<T>& dw,
+                                          std::vector<T>&       x,
+                                          rocsparse_int         batch_count,
+                                          rocsparse_int         batch_stride)
+{
+    for(rocsparse_int j = 0; j < batch_count; j++)
+    {
+        host_gpsv_solve(m,
+                        ds.data() + j,
+                        dl.data() + j,
+                        d.data() + j,
+                        du.data() + j,
+                        dw.data() + j,
+                        x.data() + j,
+                        batch_stride);
+    }
+}
+
+// Priority of a row, must match the hash that is used by rocsparse_csrcolor()
+static inline unsigned int host_csrcolor_hash(unsigned int x)
+{
+    x = ((x >> 16) ^ x) * 0x45d9f3b;
+    x = ((x >> 16) ^ x) * 0x45d9f3b;
+    x = (x >> 16) ^ x;
+
+    return x;
+}
+
+static inline bool host_csrcolor_greater(rocsparse_int j, rocsparse_int i)
+{
+    unsigned int hj = host_csrcolor_hash(j);
+    unsigned int hi = host_csrcolor_hash(i);
+
+    return (hj > hi) || (hj == hi && j > i);
+}
+
+void host_csrcolor(rocsparse_int                     M,
+                   const std::vector<rocsparse_int>& csr_row_ptr,
+                   const std::vector<rocsparse_int>& csr_col_ind,
+                   rocsparse_index_base              base,
+                   rocsparse_int&                    ncolors,
+                   std::vector<rocsparse_int>&       coloring,
+                   std::vector<rocsparse_int>&       reordering)
+{
+    coloring.assign(M, -1);
+
+    rocsparse_int remaining = M;
+
+    for(rocsparse_int round = 0; remaining > 0; ++round)
+    {
+        rocsparse_int first_color = 2 * round;
+
+        // Rows that are colored in this round still count as uncolored
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            if(coloring[i] != -1)
+            {
+                continue;
+            }
+
+            bool is_max = true;
+            bool is_min = true;
+
+            for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if(col == i || (coloring[col] != -1 && coloring[col] < first_color))
+                {
+                    continue;
+                }
+
+                if(host_csrcolor_greater(col, i))
+                {
+                    is_max = false;
+                }
+                else
+                {
+                    is_min = false;
+                }
+            }
+
+            if(is_max)
+            {
+                coloring[i] = first_color;
+            }
+            else if(is_min)
+            {
+                coloring[i] = first_color + 1;
+            }
+        }
+
+        // Resolve conflicts of unsymmetric patterns
+        std::vector<bool> conflict(M, false);
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            if(coloring[i] < first_color)
+            {
+                continue;
+            }
+
+            for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if(col != i && coloring[col] == coloring[i])
+                {
+                    conflict[host_csrcolor_greater(col, i) ? i : col] = true;
+                }
+            }
+        }
+
+        remaining = 0;
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            if(conflict[i])
+            {
+                coloring[i] = -1;
+            }
+
+            remaining += (coloring[i] == -1);
+        }
+    }
+
+    ncolors = 0;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        ncolors = std::max(ncolors, coloring[i] + 1);
+    }
+
+    // Balance the color classes, must match the rounds of rocsparse_csrcolor()
+    rocsparse_int target = M > 0 ? (M - 1) / ncolors + 1 : 0;
+
+    for(rocsparse_int round = 0; round < 4 && M > 0; ++round)
+    {
+        std::vector<rocsparse_int> prev_coloring(coloring);
+        std::vector<rocsparse_int> color_size(ncolors, 0);
+        std::vector<rocsparse_int> color_keeper(ncolors, M);
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            ++color_size[coloring[i]];
+            color_keeper[coloring[i]] = std::min(color_keeper[coloring[i]], i);
+        }
+
+        // Move rows of over-full colors into under-full colors
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            rocsparse_int color = prev_coloring[i];
+            rocsparse_int size  = color_size[color];
+
+            if(size <= target || color_keeper[color] == i)
+            {
+                continue;
+            }
+
+            unsigned int h = host_csrcolor_hash(host_csrcolor_hash(i) + round);
+
+            if(h % size >= static_cast<unsigned int>(size - target))
+            {
+                continue;
+            }
+
+            rocsparse_int start = h % ncolors;
+
+            for(rocsparse_int k = 0; k < ncolors; ++k)
+            {
+                rocsparse_int c = (start + k) % ncolors;
+
+                if(color_size[c] >= target)
+                {
+                    continue;
+                }
+
+                bool admissible = true;
+
+                for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+                {
+                    if(prev_coloring[csr_col_ind[j] - base] == c)
+                    {
+                        admissible = false;
+                        break;
+                    }
+                }
+
+                if(admissible)
+                {
+                    coloring[i] = c;
+                    break;
+                }
+            }
+        }
+
+        // Moved rows that conflict are reset to their previous color
+        std::vector<bool> conflict(M, false);
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            bool row_moved = (coloring[i] != prev_coloring[i]);
+
+            for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if(col == i || coloring[col] != coloring[i])
+                {
+                    continue;
+                }
+
+                bool col_moved = (coloring[col] != prev_coloring[col]);
+
+                if(row_moved && col_moved)
+                {
+                    conflict[host_csrcolor_greater(col, i) ? i : col] = true;
+                }
+                else if(row_moved)
+                {
+                    conflict[i] = true;
+                }
+                else if(col_moved)
+                {
+                    conflict[col] = true;
+                }
+            }
+        }
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            if(conflict[i])
+            {
+                coloring[i] = prev_coloring[i];
+            }
+        }
+    }
+
+    // Rows ordered by color, rows of the same color keep their order
+    reordering.resize(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        reordering[i] = i;
+    }
+
+    std::stable_sort(reordering.begin(),
+                     reordering.end(),
+                     [&](rocsparse_int a, rocsparse_int b) { return coloring[a] < coloring[b]; });
+}
+
+void host_csrrcm(rocsparse_int                     M,
+                 const std::vector<rocsparse_int>& csr_row_ptr,
+                 const std::vector<rocsparse_int>& csr_col_ind,
+                 rocsparse_index_base              base,
+                 std::vector<rocsparse_int>&       perm)
+{
+    // Degree of each row, ignoring the diagonal
+    std::vector<rocsparse_int> degree(M, 0);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            degree[i] += (csr_col_ind[j] - base != i);
+        }
+    }
+
+    // Row a comes before row b, if it has smaller degree or equal degree and smaller index
+    auto less = [&](rocsparse_int a, rocsparse_int b) {
+        return degree[a] < degree[b] || (degree[a] == degree[b] && a < b);
+    };
+
+    std::vector<rocsparse_int> order(M, -1);
+    std::vector<rocsparse_int> dist(M, -1);
+    std::vector<rocsparse_int> list;
+
+    // Breadth first search over all unordered rows, returns the eccentricity of root.
+    // The last level starts at list[level_begin].
+    auto bfs = [&](rocsparse_int root, rocsparse_int& level_begin) {
+        list.assign(1, root);
+        dist[root] = 0;
+
+        rocsparse_int begin = 0;
+        rocsparse_int level = 0;
+
+        while(true)
+        {
+            rocsparse_int end = list.size();
+
+            for(rocsparse_int k = begin; k < end; ++k)
+            {
+                rocsparse_int row = list[k];
+
+                for(rocsparse_int j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base;
+                    ++j)
+                {
+                    rocsparse_int col = csr_col_ind[j] - base;
+
+                    if(col != row && order[col] == -1 && dist[col] == -1)
+                    {
+                        dist[col] = level + 1;
+                        list.push_back(col);
+                    }
+                }
+            }
+
+            if(static_cast<rocsparse_int>(list.size()) == end)
+            {
+                break;
+            }
+
+            begin = end;
+            ++level;
+        }
+
+        level_begin = begin;
+
+        return level;
+    };
+
+    auto reset = [&]() {
+        for(size_t k = 0; k < list.size(); ++k)
+        {
+            dist[list[k]] = -1;
+        }
+    };
+
+    perm.resize(M);
+
+    rocsparse_int placed = 0;
+
+    while(placed < M)
+    {
+        // Unordered row of minimum degree
+        rocsparse_int root = -1;
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            if(order[i] == -1 && (root == -1 || less(i, root)))
+            {
+                root = i;
+            }
+        }
+
+        // George-Liu pseudo-peripheral row
+        rocsparse_int level_begin;
+        rocsparse_int ecc = bfs(root, level_begin);
 
-                // loop over upper offset pointer and do linear combination for nnz entry
-                for(rocsparse_int k = diag_j + 1; k < csr_row_ptr[col_j + 1] - base; ++k)
+        while(true)
+        {
+            rocsparse_int candidate = list[level_begin];
+
+            for(size_t k = level_begin; k < list.size(); ++k)
+            {
+                if(less(list[k], candidate))
                 {
-                    // if nnz at this position do linear combination
-                    if(nnz_entries[csr_col_ind[k] - base] != 0)
-                    {
-                        rocsparse_int idx = nnz_entries[csr_col_ind[k] - base];
-                        csr_val[idx]      = std::fma(-csr_val[j], csr_val[k], csr_val[idx]);
-                    }
+                    candidate = list[k];
                 }
             }
-            else if(csr_col_ind[j] - base == ai)
-            {
-                has_diag = true;
-                break;
-            }
-            else
+
+            reset();
+
+            rocsparse_int candidate_begin;
+            rocsparse_int candidate_ecc = bfs(candidate, candidate_begin);
+
+            if(candidate_ecc <= ecc)
             {
+                reset();
                 break;
             }
-        }
 
-        if(!has_diag)
-        {
-            // Structural (and numerical) zero diagonal
-            *struct_pivot  = ai + base;
-            *numeric_pivot = ai + base;
-            return;
+            root        = candidate;
+            ecc         = candidate_ecc;
+            level_begin = candidate_begin;
         }
 
-        // set diagonal pointer to diagonal element
-        diag_offset[ai] = j;
+        // Cuthill-McKee ordering of the component
+        perm[placed] = root;
+        order[root]  = placed;
 
-        // clear nnz entries
-        for(j = row_begin; j < row_end; ++j)
+        rocsparse_int end = placed + 1;
+
+        for(rocsparse_int pos = placed; pos < end; ++pos)
         {
-            nnz_entries[csr_col_ind[j] - base] = 0;
+            rocsparse_int row = perm[pos];
+
+            std::vector<rocsparse_int> children;
+
+            for(rocsparse_int j = csr_row_ptr[row] - base; j < csr_row_ptr[row + 1] - base; ++j)
+            {
+                rocsparse_int col = csr_col_ind[j] - base;
+
+                if(col != row && order[col] == -1)
+                {
+                    children.push_back(col);
+                }
+            }
+
+            std::sort(children.begin(), children.end(), less);
+
+            for(size_t k = 0; k < children.size(); ++k)
+            {
+                perm[end]          = children[k];
+                order[children[k]] = end;
+                ++end;
+            }
         }
+
+        placed = end;
     }
+
+    // Reverse Cuthill-McKee ordering
+    std::reverse(perm.begin(), perm.end());
 }
 
-// Parallel Cyclic reduction based on paper "Fast Tridiagonal Solvers on the GPU" by Yao Zhang
-template <typename T>
-void host_gtsv_no_pivot(rocsparse_int         m,
-                        rocsparse_int         n,
-                        const std::vector<T>& dl,
-                        const std::vector<T>& d,
-                        const std::vector<T>& du,
-                        std::vector<T>&       B,
-                        rocsparse_int         ldb)
+void host_csrbandwidth(rocsparse_int                     M,
+                       const std::vector<rocsparse_int>& csr_row_ptr,
+                       const std::vector<rocsparse_int>& csr_col_ind,
+                       rocsparse_index_base              base,
+                       rocsparse_int&                    bandwidth,
+                       int64_t&                          profile)
 {
-    rocsparse_int BLOCKSIZE = 0;
-    if((m & (m - 1)) == 0)
-    {
-        BLOCKSIZE = m;
-    }
-    else
-    {
-        BLOCKSIZE = pow(2, static_cast<rocsparse_int>(log2(m)) + 1);
-    }
+    bandwidth = 0;
+    profile   = 0;
 
-    for(rocsparse_int col = 0; col < n; col++)
+    for(rocsparse_int i = 0; i < M; ++i)
     {
-        rocsparse_int iter   = static_cast<rocsparse_int>(log2(BLOCKSIZE / 2));
-        rocsparse_int stride = 1;
-
-        std::vector<T> sa(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sb(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> sc(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> srhs(BLOCKSIZE, static_cast<T>(0));
+        rocsparse_int first = i;
 
-        std::vector<T> a(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> b(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> c(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> rhs(BLOCKSIZE, static_cast<T>(0));
-        std::vector<T> x(BLOCKSIZE, static_cast<T>(0));
-
-        for(rocsparse_int i = 0; i < m; i++)
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
         {
-            a[i]   = dl[i];
-            b[i]   = d[i];
-            c[i]   = du[i];
-            rhs[i] = B[ldb * col + i];
-        }
+            rocsparse_int col = csr_col_ind[j] - base;
 
-        for(rocsparse_int j = 0; j < iter; j++)
-        {
-            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
-            {
-                rocsparse_int right = tid + stride;
-                if(right >= m)
-                    right = m - 1;
+            bandwidth = std::max(bandwidth, std::abs(i - col));
+            first     = std::min(first, col);
+        }
 
-                rocsparse_int left = tid - stride;
-                if(left < 0)
-                    left = 0;
+        profile += i - first;
+    }
+}
 
-                T k1 = a[tid] / b[left];
-                T k2 = c[tid] / b[right];
+void host_csriluk_symbolic(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           rocsparse_index_base              base,
+                           rocsparse_int                     level_of_fill,
+                           std::vector<rocsparse_int>&       lu_row_ptr,
+                           std::vector<rocsparse_int>&       lu_col_ind)
+{
+    // Level of each entry of the factorization
+    std::vector<std::map<rocsparse_int, rocsparse_int>> lev(M);
 
-                T tb   = b[tid] - c[left] * k1 - a[right] * k2;
-                T trhs = rhs[tid] - rhs[left] * k1 - rhs[right] * k2;
-                T ta   = -a[left] * k1;
-                T tc   = -c[right] * k2;
+    lu_row_ptr.resize(M + 1, 0);
+    lu_col_ind.clear();
 
-                sb[tid]   = tb;
-                srhs[tid] = trhs;
-                sa[tid]   = ta;
-                sc[tid]   = tc;
-            }
+    lu_row_ptr[0] = base;
 
-            for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
-            {
-                a[tid]   = sa[tid];
-                b[tid]   = sb[tid];
-                c[tid]   = sc[tid];
-                rhs[tid] = srhs[tid];
-            }
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        std::map<rocsparse_int, rocsparse_int>& row = lev[i];
 
-            stride *= 2;
+        for(rocsparse_int j = csr_row_ptr[i] - base; j < csr_row_ptr[i + 1] - base; ++j)
+        {
+            row[csr_col_ind[j] - base] = 0;
         }
 
-        for(rocsparse_int tid = 0; tid < BLOCKSIZE; tid++)
+        // Entries that are inserted during elimination are visited by the iterator
+        for(auto it = row.begin(); it != row.end() && it->first < i; ++it)
         {
-            if(tid < BLOCKSIZE / 2)
+            rocsparse_int h = it->first;
+
+            for(auto ut = lev[h].upper_bound(h); ut != lev[h].end(); ++ut)
             {
-                rocsparse_int i = tid;
-                rocsparse_int j = tid + stride;
+                rocsparse_int level = it->second + ut->second + 1;
 
-                if(j < m)
+                if(level > level_of_fill)
                 {
-                    // Solve 2x2 systems
-                    T det = b[j] * b[i] - c[i] * a[j];
-                    x[i]  = (b[j] * rhs[i] - c[i] * rhs[j]) / det;
-                    x[j]  = (rhs[j] * b[i] - rhs[i] * a[j]) / det;
+                    continue;
+                }
+
+                auto entry = row.find(ut->first);
+
+                if(entry == row.end())
+                {
+                    row[ut->first] = level;
                 }
                 else
                 {
-                    // Solve 1x1 systems
-                    x[i] = rhs[i] / b[i];
+                    entry->second = std::min(entry->second, level);
                 }
             }
         }
 
-        for(rocsparse_int i = 0; i < m; i++)
+        for(auto it = row.begin(); it != row.end(); ++it)
         {
-            B[ldb * col + i] = x[i];
+            lu_col_ind.push_back(it->first + base);
         }
+
+        lu_row_ptr[i + 1] = lu_col_ind.size() + base;
     }
 }
 
@@ -4499,6 +7169,65 @@ void host_csr_to_csc(rocsparse_int               M,
     csc_col_ptr[0] = base;
 }
 
+template <typename T>
+void host_csrsympermute(rocsparse_int                     M,
+                        const std::vector<rocsparse_int>& csr_row_ptr,
+                        const std::vector<rocsparse_int>& csr_col_ind,
+                        const std::vector<T>&             csr_val,
+                        const std::vector<rocsparse_int>& perm,
+                        std::vector<rocsparse_int>&       csr_row_ptr_out,
+                        std::vector<rocsparse_int>&       csr_col_ind_out,
+                        std::vector<T>&                   csr_val_out,
+                        rocsparse_index_base              base)
+{
+    rocsparse_int nnz = csr_row_ptr[M] - base;
+
+    // Inverse permutation
+    std::vector<rocsparse_int> iperm(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        iperm[perm[i]] = i;
+    }
+
+    csr_row_ptr_out.resize(M + 1);
+    csr_col_ind_out.resize(nnz);
+    csr_val_out.resize(nnz);
+
+    csr_row_ptr_out[0] = base;
+
+    std::vector<std::pair<rocsparse_int, T>> row;
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        rocsparse_int old_row   = perm[i];
+        rocsparse_int row_begin = csr_row_ptr[old_row] - base;
+        rocsparse_int row_end   = csr_row_ptr[old_row + 1] - base;
+
+        row.clear();
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            row.push_back(std::make_pair(iperm[csr_col_ind[j] - base], csr_val[j]));
+        }
+
+        std::stable_sort(row.begin(),
+                         row.end(),
+                         [](const std::pair<rocsparse_int, T>& a,
+                            const std::pair<rocsparse_int, T>& b) { return a.first < b.first; });
+
+        rocsparse_int offset = csr_row_ptr_out[i] - base;
+
+        for(size_t j = 0; j < row.size(); ++j)
+        {
+            csr_col_ind_out[offset + j] = row[j].first + base;
+            csr_val_out[offset + j]     = row[j].second;
+        }
+
+        csr_row_ptr_out[i + 1] = csr_row_ptr_out[i] + static_cast<rocsparse_int>(row.size());
+    }
+}
+
 template <typename T>
 void host_csr_to_gebsr(rocsparse_direction               direction,
                        rocsparse_int                     m,
@@ -5601,6 +8330,51 @@ template void host_csrgeam(rocsparse_int                     M,
                            rocsparse_index_base              base_B,
                            rocsparse_index_base              base_C);
 
+template void host_csrrap(rocsparse_operation               trans_R,
+                          rocsparse_int                     M,
+                          rocsparse_int                     N,
+                          rocsparse_int                     K,
+                          float                             alpha,
+                          const std::vector<rocsparse_int>& csr_row_ptr_R,
+                          const std::vector<rocsparse_int>& csr_col_ind_R,
+                          const std::vector<float>&         csr_val_R,
+                          const std::vector<rocsparse_int>& csr_row_ptr_A,
+                          const std::vector<rocsparse_int>& csr_col_ind_A,
+                          const std::vector<float>&         csr_val_A,
+                          const std::vector<rocsparse_int>& csr_row_ptr_P,
+                          const std::vector<rocsparse_int>& csr_col_ind_P,
+                          const std::vector<float>&         csr_val_P,
+                          std::vector<rocsparse_int>&       csr_row_ptr_C,
+                          rocsparse_int*                    nnz_C,
+                          std::vector<rocsparse_int>&       csr_col_ind_C,
+                          std::vector<float>&               csr_val_C,
+                          rocsparse_index_base              base_R,
+                          rocsparse_index_base              base_A,
+                          rocsparse_index_base              base_P,
+                          rocsparse_index_base              base_C);
+
+template void host_csrgemm_masked(rocsparse_int                     M,
+                                  rocsparse_int                     N,
+                                  rocsparse_int                     K,
+                                  float                             alpha,
+                                  const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                  const std::vector<rocsparse_int>& csr_col_ind_A,
+                                  const std::vector<float>&         csr_val_A,
+                                  const std::vector<rocsparse_int>& csr_row_ptr_B,
+                                  const std::vector<rocsparse_int>& csr_col_ind_B,
+                                  const std::vector<float>&         csr_val_B,
+                                  const std::vector<rocsparse_int>& csr_row_ptr_M,
+                                  const std::vector<rocsparse_int>& csr_col_ind_M,
+                                  rocsparse_mask_type               mask_type,
+                                  std::vector<rocsparse_int>&       csr_row_ptr_C,
+                                  rocsparse_int*                    nnz_C,
+                                  std::vector<rocsparse_int>&       csr_col_ind_C,
+                                  std::vector<float>&               csr_val_C,
+                                  rocsparse_index_base              base_A,
+                                  rocsparse_index_base              base_B,
+                                  rocsparse_index_base              base_M,
+                                  rocsparse_index_base              base_C);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -5629,6 +8403,25 @@ template void host_bsrilu0(rocsparse_direction               dir,
                            float                             boost_tol,
                            float                             boost_val);
 
+template void host_bsrjacobi_setup(rocsparse_direction               dir,
+                                   rocsparse_int                     mb,
+                                   const std::vector<rocsparse_int>& bsr_row_ptr,
+                                   const std::vector<rocsparse_int>& bsr_col_ind,
+                                   const std::vector<float>&         bsr_val,
+                                   rocsparse_int                     bsr_dim,
+                                   rocsparse_index_base              base,
+                                   std::vector<float>&               bsr_diag_inv,
+                                   rocsparse_int*                    zero_pivot);
+
+template void host_bsrjacobi_apply(rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             bsr_dim,
+                                   float                     alpha,
+                                   const std::vector<float>& bsr_diag_inv,
+                                   const std::vector<float>& x,
+                                   float                     beta,
+                                   std::vector<float>&       y);
+
 template void host_csric0(rocsparse_int                     M,
                           const std::vector<rocsparse_int>& csr_row_ptr,
                           const std::vector<rocsparse_int>& csr_col_ind,
@@ -5648,6 +8441,67 @@ template void host_csrilu0(rocsparse_int                     M,
                            float                             boost_tol,
                            float                             boost_val);
 
+template void host_csritilu0(rocsparse_int                     M,
+                             const std::vector<rocsparse_int>& csr_row_ptr,
+                             const std::vector<rocsparse_int>& csr_col_ind,
+                             std::vector<float>&               csr_val,
+                             rocsparse_index_base              base,
+                             bool                              ichol,
+                             rocsparse_int                     nsweeps,
+                             std::vector<float>&               history,
+                             rocsparse_int*                    struct_pivot,
+                             rocsparse_int*                    numeric_pivot);
+
+template void host_csrilut(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           const std::vector<float>&         csr_val,
+                           rocsparse_index_base              base,
+                           bool                              ichol,
+                           float                             tol,
+                           rocsparse_int                     max_fill,
+                           bool                              boost,
+                           float                             boost_tol,
+                           float                             boost_val,
+                           std::vector<rocsparse_int>&       lu_row_ptr,
+                           std::vector<rocsparse_int>&       lu_col_ind,
+                           std::vector<float>&               lu_val,
+                           rocsparse_int*                    struct_pivot,
+                           rocsparse_int*                    numeric_pivot);
+
+template void host_csrfsai(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr_A,
+                           const std::vector<rocsparse_int>& csr_col_ind_A,
+                           const std::vector<float>&         csr_val_A,
+                           rocsparse_index_base              base_A,
+                           const std::vector<rocsparse_int>& csr_row_ptr_S,
+                           const std::vector<rocsparse_int>& csr_col_ind_S,
+                           rocsparse_index_base              base_S,
+                           rocsparse_index_base              base_G,
+                           std::vector<rocsparse_int>&       csr_row_ptr_G,
+                           std::vector<rocsparse_int>&       csr_col_ind_G,
+                           std::vector<float>&               csr_val_G,
+                           rocsparse_int*                    zero_pivot);
+
+template void host_csrcheb_estimate(rocsparse_int                     M,
+                                    const std::vector<rocsparse_int>& csr_row_ptr,
+                                    const std::vector<rocsparse_int>& csr_col_ind,
+                                    const std::vector<float>&         csr_val,
+                                    rocsparse_index_base              base,
+                                    rocsparse_int                     iters,
+                                    float*                            lambda_max);
+
+template void host_csrcheb(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           const std::vector<float>&         csr_val,
+                           rocsparse_index_base              base,
+                           rocsparse_int                     degree,
+                           float                             lambda_min,
+                           float                             lambda_max,
+                           const std::vector<float>&         b,
+                           std::vector<float>&               x);
+
 template void host_gtsv_no_pivot(rocsparse_int             m,
                                  rocsparse_int             n,
                                  const std::vector<float>& dl,
@@ -5656,6 +8510,51 @@ template void host_gtsv_no_pivot(rocsparse_int             m,
                                  std::vector<float>&       B,
                                  rocsparse_int             ldb);
 
+template void host_gtsv(rocsparse_int             m,
+                        rocsparse_int             n,
+                        const std::vector<float>& dl,
+                        const std::vector<float>& d,
+                        const std::vector<float>& du,
+                        std::vector<float>&       B,
+                        rocsparse_int             ldb);
+
+template void host_gtsv_no_pivot_strided_batch(rocsparse_int             m,
+                                               const std::vector<float>& dl,
+                                               const std::vector<float>& d,
+                                               const std::vector<float>& du,
+                                               std::vector<float>&       x,
+                                               rocsparse_int             batch_count,
+                                               rocsparse_int             batch_stride);
+
+template void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg alg,
+                                          rocsparse_int                  m,
+                                          const std::vector<float>&      dl,
+                                          const std::vector<float>&      d,
+                                          const std::vector<float>&      du,
+                                          std::vector<float>&            x,
+                                          rocsparse_int                  batch_count,
+                                          rocsparse_int                  batch_stride);
+
+template void host_gpsv_no_pivot_strided_batch(rocsparse_int             m,
+                                               const std::vector<float>& ds,
+                                               const std::vector<float>& dl,
+                                               const std::vector<float>& d,
+                                               const std::vector<float>& du,
+                                               const std::vector<float>& dw,
+                                               std::vector<float>&       x,
+                                               rocsparse_int             batch_count,
+                                               rocsparse_int             batch_stride);
+
+template void host_gpsv_no_pivot_interleaved_batch(rocsparse_int             m,
+                                                   const std::vector<float>& ds,
+                                                   const std::vector<float>& dl,
+                                                   const std::vector<float>& d,
+                                                   const std::vector<float>& du,
+                                                   const std::vector<float>& dw,
+                                                   std::vector<float>&       x,
+                                                   rocsparse_int             batch_count,
+                                                   rocsparse_int             batch_stride);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -5703,6 +8602,16 @@ template void host_csr_to_csc(rocsparse_int               M,
                               rocsparse_action            action,
                               rocsparse_index_base        base);
 
+template void host_csrsympermute(rocsparse_int                     M,
+                                 const std::vector<rocsparse_int>& csr_row_ptr,
+                                 const std::vector<rocsparse_int>& csr_col_ind,
+                                 const std::vector<float>&         csr_val,
+                                 const std::vector<rocsparse_int>& perm,
+                                 std::vector<rocsparse_int>&       csr_row_ptr_out,
+                                 std::vector<rocsparse_int>&       csr_col_ind_out,
+                                 std::vector<float>&               csr_val_out,
+                                 rocsparse_index_base              base);
+
 template void host_csr_to_gebsr(rocsparse_direction               direction,
                                 rocsparse_int                     m,
                                 rocsparse_int                     n,
@@ -6039,6 +8948,51 @@ template void host_csrgeam(rocsparse_int                     M,
                            rocsparse_index_base              base_B,
                            rocsparse_index_base              base_C);
 
+template void host_csrrap(rocsparse_operation               trans_R,
+                          rocsparse_int                     M,
+                          rocsparse_int                     N,
+                          rocsparse_int                     K,
+                          double                            alpha,
+                          const std::vector<rocsparse_int>& csr_row_ptr_R,
+                          const std::vector<rocsparse_int>& csr_col_ind_R,
+                          const std::vector<double>&        csr_val_R,
+                          const std::vector<rocsparse_int>& csr_row_ptr_A,
+                          const std::vector<rocsparse_int>& csr_col_ind_A,
+                          const std::vector<double>&        csr_val_A,
+                          const std::vector<rocsparse_int>& csr_row_ptr_P,
+                          const std::vector<rocsparse_int>& csr_col_ind_P,
+                          const std::vector<double>&        csr_val_P,
+                          std::vector<rocsparse_int>&       csr_row_ptr_C,
+                          rocsparse_int*                    nnz_C,
+                          std::vector<rocsparse_int>&       csr_col_ind_C,
+                          std::vector<double>&              csr_val_C,
+                          rocsparse_index_base              base_R,
+                          rocsparse_index_base              base_A,
+                          rocsparse_index_base              base_P,
+                          rocsparse_index_base              base_C);
+
+template void host_csrgemm_masked(rocsparse_int                     M,
+                                  rocsparse_int                     N,
+                                  rocsparse_int                     K,
+                                  double                            alpha,
+                                  const std::vector<rocsparse_int>& csr_row_ptr_A,
+                                  const std::vector<rocsparse_int>& csr_col_ind_A,
+                                  const std::vector<double>&        csr_val_A,
+                                  const std::vector<rocsparse_int>& csr_row_ptr_B,
+                                  const std::vector<rocsparse_int>& csr_col_ind_B,
+                                  const std::vector<double>&        csr_val_B,
+                                  const std::vector<rocsparse_int>& csr_row_ptr_M,
+                                  const std::vector<rocsparse_int>& csr_col_ind_M,
+                                  rocsparse_mask_type               mask_type,
+                                  std::vector<rocsparse_int>&       csr_row_ptr_C,
+                                  rocsparse_int*                    nnz_C,
+                                  std::vector<rocsparse_int>&       csr_col_ind_C,
+                                  std::vector<double>&              csr_val_C,
+                                  rocsparse_index_base              base_A,
+                                  rocsparse_index_base              base_B,
+                                  rocsparse_index_base              base_M,
+                                  rocsparse_index_base              base_C);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -6067,6 +9021,25 @@ template void host_bsrilu0(rocsparse_direction               dir,
                            double                            boost_tol,
                            double                            boost_val);
 
+template void host_bsrjacobi_setup(rocsparse_direction               dir,
+                                   rocsparse_int                     mb,
+                                   const std::vector<rocsparse_int>& bsr_row_ptr,
+                                   const std::vector<rocsparse_int>& bsr_col_ind,
+                                   const std::vector<double>&        bsr_val,
+                                   rocsparse_int                     bsr_dim,
+                                   rocsparse_index_base              base,
+                                   std::vector<double>&              bsr_diag_inv,
+                                   rocsparse_int*                    zero_pivot);
+
+template void host_bsrjacobi_apply(rocsparse_direction        dir,
+                                   rocsparse_int              mb,
+                                   rocsparse_int              bsr_dim,
+                                   double                     alpha,
+                                   const std::vector<double>& bsr_diag_inv,
+                                   const std::vector<double>& x,
+                                   double                     beta,
+                                   std::vector<double>&       y);
+
 template void host_csric0(rocsparse_int                     M,
                           const std::vector<rocsparse_int>& csr_row_ptr,
                           const std::vector<rocsparse_int>& csr_col_ind,
@@ -6086,6 +9059,67 @@ template void host_csrilu0(rocsparse_int                     M,
                            double                            boost_tol,
                            double                            boost_val);
 
+template void host_csritilu0(rocsparse_int                     M,
+                             const std::vector<rocsparse_int>& csr_row_ptr,
+                             const std::vector<rocsparse_int>& csr_col_ind,
+                             std::vector<double>&              csr_val,
+                             rocsparse_index_base              base,
+                             bool                              ichol,
+                             rocsparse_int                     nsweeps,
+                             std::vector<double>&              history,
+                             rocsparse_int*                    struct_pivot,
+                             rocsparse_int*                    numeric_pivot);
+
+template void host_csrilut(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           const std::vector<double>&        csr_val,
+                           rocsparse_index_base              base,
+                           bool                              ichol,
+                           double                            tol,
+                           rocsparse_int                     max_fill,
+                           bool                              boost,
+                           double                            boost_tol,
+                           double                            boost_val,
+                           std::vector<rocsparse_int>&       lu_row_ptr,
+                           std::vector<rocsparse_int>&       lu_col_ind,
+                           std::vector<double>&              lu_val,
+                           rocsparse_int*                    struct_pivot,
+                           rocsparse_int*                    numeric_pivot);
+
+template void host_csrfsai(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr_A,
+                           const std::vector<rocsparse_int>& csr_col_ind_A,
+                           const std::vector<double>&        csr_val_A,
+                           rocsparse_index_base              base_A,
+                           const std::vector<rocsparse_int>& csr_row_ptr_S,
+                           const std::vector<rocsparse_int>& csr_col_ind_S,
+                           rocsparse_index_base              base_S,
+                           rocsparse_index_base              base_G,
+                           std::vector<rocsparse_int>&       csr_row_ptr_G,
+                           std::vector<rocsparse_int>&       csr_col_ind_G,
+                           std::vector<double>&              csr_val_G,
+                           rocsparse_int*                    zero_pivot);
+
+template void host_csrcheb_estimate(rocsparse_int                     M,
+                                    const std::vector<rocsparse_int>& csr_row_ptr,
+                                    const std::vector<rocsparse_int>& csr_col_ind,
+                                    const std::vector<double>&        csr_val,
+                                    rocsparse_index_base              base,
+                                    rocsparse_int                     iters,
+                                    double*                           lambda_max);
+
+template void host_csrcheb(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           const std::vector<double>&        csr_val,
+                           rocsparse_index_base              base,
+                           rocsparse_int                     degree,
+                           double                            lambda_min,
+                           double                            lambda_max,
+                           const std::vector<double>&        b,
+                           std::vector<double>&              x);
+
 template void host_gtsv_no_pivot(rocsparse_int              m,
                                  rocsparse_int              n,
                                  const std::vector<double>& dl,
@@ -6094,6 +9128,51 @@ template void host_gtsv_no_pivot(rocsparse_int              m,
                                  std::vector<double>&       B,
                                  rocsparse_int              ldb);
 
+template void host_gtsv(rocsparse_int              m,
+                        rocsparse_int              n,
+                        const std::vector<double>& dl,
+                        const std::vector<double>& d,
+                        const std::vector<double>& du,
+                        std::vector<double>&       B,
+                        rocsparse_int              ldb);
+
+template void host_gtsv_no_pivot_strided_batch(rocsparse_int              m,
+                                               const std::vector<double>& dl,
+                                               const std::vector<double>& d,
+                                               const std::vector<double>& du,
+                                               std::vector<double>&       x,
+                                               rocsparse_int              batch_count,
+                                               rocsparse_int              batch_stride);
+
+template void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg alg,
+                                          rocsparse_int                  m,
+                                          const std::vector<double>&     dl,
+                                          const std::vector<double>&     d,
+                                          const std::vector<double>&     du,
+                                          std::vector<double>&           x,
+                                          rocsparse_int                  batch_count,
+                                          rocsparse_int                  batch_stride);
+
+template void host_gpsv_no_pivot_strided_batch(rocsparse_int              m,
+                                               const std::vector<double>& ds,
+                                               const std::vector<double>& dl,
+                                               const std::vector<double>& d,
+                                               const std::vector<double>& du,
+                                               const std::vector<double>& dw,
+                                               std::vector<double>&       x,
+                                               rocsparse_int              batch_count,
+                                               rocsparse_int              batch_stride);
+
+template void host_gpsv_no_pivot_interleaved_batch(rocsparse_int              m,
+                                                   const std::vector<double>& ds,
+                                                   const std::vector<double>& dl,
+                                                   const std::vector<double>& d,
+                                                   const std::vector<double>& du,
+                                                   const std::vector<double>& dw,
+                                                   std::vector<double>&       x,
+                                                   rocsparse_int              batch_count,
+                                                   rocsparse_int              batch_stride);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -6141,6 +9220,16 @@ template void host_csr_to_csc(rocsparse_int               M,
                               rocsparse_action            action,
                               rocsparse_index_base        base);
 
+template void host_csrsympermute(rocsparse_int                     M,
+                                 const std::vector<rocsparse_int>& csr_row_ptr,
+                                 const std::vector<rocsparse_int>& csr_col_ind,
+                                 const std::vector<double>&        csr_val,
+                                 const std::vector<rocsparse_int>& perm,
+                                 std::vector<rocsparse_int>&       csr_row_ptr_out,
+                                 std::vector<rocsparse_int>&       csr_col_ind_out,
+                                 std::vector<double>&              csr_val_out,
+                                 rocsparse_index_base              base);
+
 template void host_csr_to_gebsr(rocsparse_direction               direction,
                                 rocsparse_int                     m,
                                 rocsparse_int                     n,
@@ -6478,6 +9567,51 @@ template void host_csrgeam(rocsparse_int                                M,
                            rocsparse_index_base                         base_B,
                            rocsparse_index_base                         base_C);
 
+template void host_csrrap(rocsparse_operation                          trans_R,
+                          rocsparse_int                                M,
+                          rocsparse_int                                N,
+                          rocsparse_int                                K,
+                          rocsparse_double_complex                     alpha,
+                          const std::vector<rocsparse_int>&            csr_row_ptr_R,
+                          const std::vector<rocsparse_int>&            csr_col_ind_R,
+                          const std::vector<rocsparse_double_complex>& csr_val_R,
+                          const std::vector<rocsparse_int>&            csr_row_ptr_A,
+                          const std::vector<rocsparse_int>&            csr_col_ind_A,
+                          const std::vector<rocsparse_double_complex>& csr_val_A,
+                          const std::vector<rocsparse_int>&            csr_row_ptr_P,
+                          const std::vector<rocsparse_int>&            csr_col_ind_P,
+                          const std::vector<rocsparse_double_complex>& csr_val_P,
+                          std::vector<rocsparse_int>&                  csr_row_ptr_C,
+                          rocsparse_int*                               nnz_C,
+                          std::vector<rocsparse_int>&                  csr_col_ind_C,
+                          std::vector<rocsparse_double_complex>&       csr_val_C,
+                          rocsparse_index_base                         base_R,
+                          rocsparse_index_base                         base_A,
+                          rocsparse_index_base                         base_P,
+                          rocsparse_index_base                         base_C);
+
+template void host_csrgemm_masked(rocsparse_int                                M,
+                                  rocsparse_int                                N,
+                                  rocsparse_int                                K,
+                                  rocsparse_double_complex                     alpha,
+                                  const std::vector<rocsparse_int>&            csr_row_ptr_A,
+                                  const std::vector<rocsparse_int>&            csr_col_ind_A,
+                                  const std::vector<rocsparse_double_complex>& csr_val_A,
+                                  const std::vector<rocsparse_int>&            csr_row_ptr_B,
+                                  const std::vector<rocsparse_int>&            csr_col_ind_B,
+                                  const std::vector<rocsparse_double_complex>& csr_val_B,
+                                  const std::vector<rocsparse_int>&            csr_row_ptr_M,
+                                  const std::vector<rocsparse_int>&            csr_col_ind_M,
+                                  rocsparse_mask_type                          mask_type,
+                                  std::vector<rocsparse_int>&                  csr_row_ptr_C,
+                                  rocsparse_int*                               nnz_C,
+                                  std::vector<rocsparse_int>&                  csr_col_ind_C,
+                                  std::vector<rocsparse_double_complex>&       csr_val_C,
+                                  rocsparse_index_base                         base_A,
+                                  rocsparse_index_base                         base_B,
+                                  rocsparse_index_base                         base_M,
+                                  rocsparse_index_base                         base_C);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -6506,6 +9640,25 @@ template void host_bsrilu0(rocsparse_direction                    dir,
                            double                                 boost_tol,
                            rocsparse_double_complex               boost_val);
 
+template void host_bsrjacobi_setup(rocsparse_direction                          dir,
+                                   rocsparse_int                                mb,
+                                   const std::vector<rocsparse_int>&            bsr_row_ptr,
+                                   const std::vector<rocsparse_int>&            bsr_col_ind,
+                                   const std::vector<rocsparse_double_complex>& bsr_val,
+                                   rocsparse_int                                bsr_dim,
+                                   rocsparse_index_base                         base,
+                                   std::vector<rocsparse_double_complex>&       bsr_diag_inv,
+                                   rocsparse_int*                               zero_pivot);
+
+template void host_bsrjacobi_apply(rocsparse_direction                          dir,
+                                   rocsparse_int                                mb,
+                                   rocsparse_int                                bsr_dim,
+                                   rocsparse_double_complex                     alpha,
+                                   const std::vector<rocsparse_double_complex>& bsr_diag_inv,
+                                   const std::vector<rocsparse_double_complex>& x,
+                                   rocsparse_double_complex                     beta,
+                                   std::vector<rocsparse_double_complex>&       y);
+
 template void host_csric0(rocsparse_int                          M,
                           const std::vector<rocsparse_int>&      csr_row_ptr,
                           const std::vector<rocsparse_int>&      csr_col_ind,
@@ -6525,6 +9678,67 @@ template void host_csrilu0(rocsparse_int                          M,
                            double                                 boost_tol,
                            rocsparse_double_complex               boost_val);
 
+template void host_csritilu0(rocsparse_int                          M,
+                             const std::vector<rocsparse_int>&      csr_row_ptr,
+                             const std::vector<rocsparse_int>&      csr_col_ind,
+                             std::vector<rocsparse_double_complex>& csr_val,
+                             rocsparse_index_base                   base,
+                             bool                                   ichol,
+                             rocsparse_int                          nsweeps,
+                             std::vector<double>&                   history,
+                             rocsparse_int*                         struct_pivot,
+                             rocsparse_int*                         numeric_pivot);
+
+template void host_csrilut(rocsparse_int                                M,
+                           const std::vector<rocsparse_int>&            csr_row_ptr,
+                           const std::vector<rocsparse_int>&            csr_col_ind,
+                           const std::vector<rocsparse_double_complex>& csr_val,
+                           rocsparse_index_base                         base,
+                           bool                                         ichol,
+                           double                                       tol,
+                           rocsparse_int                                max_fill,
+                           bool                                         boost,
+                           double                                       boost_tol,
+                           rocsparse_double_complex                     boost_val,
+                           std::vector<rocsparse_int>&                  lu_row_ptr,
+                           std::vector<rocsparse_int>&                  lu_col_ind,
+                           std::vector<rocsparse_double_complex>&       lu_val,
+                           rocsparse_int*                               struct_pivot,
+                           rocsparse_int*                               numeric_pivot);
+
+template void host_csrfsai(rocsparse_int                                M,
+                           const std::vector<rocsparse_int>&            csr_row_ptr_A,
+                           const std::vector<rocsparse_int>&            csr_col_ind_A,
+                           const std::vector<rocsparse_double_complex>& csr_val_A,
+                           rocsparse_index_base                         base_A,
+                           const std::vector<rocsparse_int>&            csr_row_ptr_S,
+                           const std::vector<rocsparse_int>&            csr_col_ind_S,
+                           rocsparse_index_base                         base_S,
+                           rocsparse_index_base                         base_G,
+                           std::vector<rocsparse_int>&                  csr_row_ptr_G,
+                           std::vector<rocsparse_int>&                  csr_col_ind_G,
+                           std::vector<rocsparse_double_complex>&       csr_val_G,
+                           rocsparse_int*                               zero_pivot);
+
+template void host_csrcheb_estimate(rocsparse_int                                M,
+                                    const std::vector<rocsparse_int>&            csr_row_ptr,
+                                    const std::vector<rocsparse_int>&            csr_col_ind,
+                                    const std::vector<rocsparse_double_complex>& csr_val,
+                                    rocsparse_index_base                         base,
+                                    rocsparse_int                                iters,
+                                    double*                                      lambda_max);
+
+template void host_csrcheb(rocsparse_int                                M,
+                           const std::vector<rocsparse_int>&            csr_row_ptr,
+                           const std::vector<rocsparse_int>&            csr_col_ind,
+                           const std::vector<rocsparse_double_complex>& csr_val,
+                           rocsparse_index_base                         base,
+                           rocsparse_int                                degree,
+                           double                                       lambda_min,
+                           double                                       lambda_max,
+                           const std::vector<rocsparse_double_complex>& b,
+                           std::vector<rocsparse_double_complex>&       x);
+
 template void host_gtsv_no_pivot(rocsparse_int                                m,
                                  rocsparse_int                                n,
                                  const std::vector<rocsparse_double_complex>& dl,
@@ -6533,6 +9747,51 @@ template void host_gtsv_no_pivot(rocsparse_int                                m,
                                  std::vector<rocsparse_double_complex>&       B,
                                  rocsparse_int                                ldb);
 
+template void host_gtsv(rocsparse_int                               m,
+                        rocsparse_int                               n,
+                        const std::vector<rocsparse_float_complex>& dl,
+                        const std::vector<rocsparse_float_complex>& d,
+                        const std::vector<rocsparse_float_complex>& du,
+                        std::vector<rocsparse_float_complex>&       B,
+                        rocsparse_int                               ldb);
+
+template void host_gtsv_no_pivot_strided_batch(rocsparse_int                               m,
+                                               const std::vector<rocsparse_float_complex>& dl,
+                                               const std::vector<rocsparse_float_complex>& d,
+                                               const std::vector<rocsparse_float_complex>& du,
+                                               std::vector<rocsparse_float_complex>&       x,
+                                               rocsparse_int                               batch_count,
+                                               rocsparse_int                               batch_stride);
+
+template void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg              alg,
+                                          rocsparse_int                               m,
+                                          const std::vector<rocsparse_float_complex>& dl,
+                                          const std::vector<rocsparse_float_complex>& d,
+                                          const std::vector<rocsparse_float_complex>& du,
+                                          std::vector<rocsparse_float_complex>&       x,
+                                          rocsparse_int                               batch_count,
+                                          rocsparse_int                               batch_stride);
+
+template void host_gpsv_no_pivot_strided_batch(rocsparse_int                               m,
+                                               const std::vector<rocsparse_float_complex>& ds,
+                                               const std::vector<rocsparse_float_complex>& dl,
+                                               const std::vector<rocsparse_float_complex>& d,
+                                               const std::vector<rocsparse_float_complex>& du,
+                                               const std::vector<rocsparse_float_complex>& dw,
+                                               std::vector<rocsparse_float_complex>&       x,
+                                               rocsparse_int                               batch_count,
+                                               rocsparse_int                               batch_stride);
+
+template void host_gpsv_no_pivot_interleaved_batch(rocsparse_int                               m,
+                                                   const std::vector<rocsparse_float_complex>& ds,
+                                                   const std::vector<rocsparse_float_complex>& dl,
+                                                   const std::vector<rocsparse_float_complex>& d,
+                                                   const std::vector<rocsparse_float_complex>& du,
+                                                   const std::vector<rocsparse_float_complex>& dw,
+                                                   std::vector<rocsparse_float_complex>&       x,
+                                                   rocsparse_int                               batch_count,
+                                                   rocsparse_int                               batch_stride);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -6558,6 +9817,16 @@ template void host_csr_to_csc(rocsparse_int                          M,
                               rocsparse_action                       action,
                               rocsparse_index_base                   base);
 
+template void host_csrsympermute(rocsparse_int                                M,
+                                 const std::vector<rocsparse_int>&            csr_row_ptr,
+                                 const std::vector<rocsparse_int>&            csr_col_ind,
+                                 const std::vector<rocsparse_double_complex>& csr_val,
+                                 const std::vector<rocsparse_int>&            perm,
+                                 std::vector<rocsparse_int>&                  csr_row_ptr_out,
+                                 std::vector<rocsparse_int>&                  csr_col_ind_out,
+                                 std::vector<rocsparse_double_complex>&       csr_val_out,
+                                 rocsparse_index_base                         base);
+
 template void host_csr_to_gebsr(rocsparse_direction                          direction,
                                 rocsparse_int                                m,
                                 rocsparse_int                                n,
@@ -6868,6 +10137,51 @@ template void host_csrgeam(rocsparse_int                               M,
                            rocsparse_index_base                        base_B,
                            rocsparse_index_base                        base_C);
 
+template void host_csrrap(rocsparse_operation                         trans_R,
+                          rocsparse_int                               M,
+                          rocsparse_int                               N,
+                          rocsparse_int                               K,
+                          rocsparse_float_complex                     alpha,
+                          const std::vector<rocsparse_int>&           csr_row_ptr_R,
+                          const std::vector<rocsparse_int>&           csr_col_ind_R,
+                          const std::vector<rocsparse_float_complex>& csr_val_R,
+                          const std::vector<rocsparse_int>&           csr_row_ptr_A,
+                          const std::vector<rocsparse_int>&           csr_col_ind_A,
+                          const std::vector<rocsparse_float_complex>& csr_val_A,
+                          const std::vector<rocsparse_int>&           csr_row_ptr_P,
+                          const std::vector<rocsparse_int>&           csr_col_ind_P,
+                          const std::vector<rocsparse_float_complex>& csr_val_P,
+                          std::vector<rocsparse_int>&                 csr_row_ptr_C,
+                          rocsparse_int*                              nnz_C,
+                          std::vector<rocsparse_int>&                 csr_col_ind_C,
+                          std::vector<rocsparse_float_complex>&       csr_val_C,
+                          rocsparse_index_base                        base_R,
+                          rocsparse_index_base                        base_A,
+                          rocsparse_index_base                        base_P,
+                          rocsparse_index_base                        base_C);
+
+template void host_csrgemm_masked(rocsparse_int                               M,
+                                  rocsparse_int                               N,
+                                  rocsparse_int                               K,
+                                  rocsparse_float_complex                     alpha,
+                                  const std::vector<rocsparse_int>&           csr_row_ptr_A,
+                                  const std::vector<rocsparse_int>&           csr_col_ind_A,
+                                  const std::vector<rocsparse_float_complex>& csr_val_A,
+                                  const std::vector<rocsparse_int>&           csr_row_ptr_B,
+                                  const std::vector<rocsparse_int>&           csr_col_ind_B,
+                                  const std::vector<rocsparse_float_complex>& csr_val_B,
+                                  const std::vector<rocsparse_int>&           csr_row_ptr_M,
+                                  const std::vector<rocsparse_int>&           csr_col_ind_M,
+                                  rocsparse_mask_type                         mask_type,
+                                  std::vector<rocsparse_int>&                 csr_row_ptr_C,
+                                  rocsparse_int*                              nnz_C,
+                                  std::vector<rocsparse_int>&                 csr_col_ind_C,
+                                  std::vector<rocsparse_float_complex>&       csr_val_C,
+                                  rocsparse_index_base                        base_A,
+                                  rocsparse_index_base                        base_B,
+                                  rocsparse_index_base                        base_M,
+                                  rocsparse_index_base                        base_C);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -6896,6 +10210,25 @@ template void host_bsrilu0(rocsparse_direction                   dir,
                            float                                 boost_tol,
                            rocsparse_float_complex               boost_val);
 
+template void host_bsrjacobi_setup(rocsparse_direction                         dir,
+                                   rocsparse_int                               mb,
+                                   const std::vector<rocsparse_int>&           bsr_row_ptr,
+                                   const std::vector<rocsparse_int>&           bsr_col_ind,
+                                   const std::vector<rocsparse_float_complex>& bsr_val,
+                                   rocsparse_int                               bsr_dim,
+                                   rocsparse_index_base                        base,
+                                   std::vector<rocsparse_float_complex>&       bsr_diag_inv,
+                                   rocsparse_int*                              zero_pivot);
+
+template void host_bsrjacobi_apply(rocsparse_direction                         dir,
+                                   rocsparse_int                               mb,
+                                   rocsparse_int                               bsr_dim,
+                                   rocsparse_float_complex                     alpha,
+                                   const std::vector<rocsparse_float_complex>& bsr_diag_inv,
+                                   const std::vector<rocsparse_float_complex>& x,
+                                   rocsparse_float_complex                     beta,
+                                   std::vector<rocsparse_float_complex>&       y);
+
 template void host_csric0(rocsparse_int                         M,
                           const std::vector<rocsparse_int>&     csr_row_ptr,
                           const std::vector<rocsparse_int>&     csr_col_ind,
@@ -6915,6 +10248,67 @@ template void host_csrilu0(rocsparse_int                         M,
                            float                                 boost_tol,
                            rocsparse_float_complex               boost_val);
 
+template void host_csritilu0(rocsparse_int                         M,
+                             const std::vector<rocsparse_int>&     csr_row_ptr,
+                             const std::vector<rocsparse_int>&     csr_col_ind,
+                             std::vector<rocsparse_float_complex>& csr_val,
+                             rocsparse_index_base                  base,
+                             bool                                  ichol,
+                             rocsparse_int                         nsweeps,
+                             std::vector<float>&                   history,
+                             rocsparse_int*                        struct_pivot,
+                             rocsparse_int*                        numeric_pivot);
+
+template void host_csrilut(rocsparse_int                               M,
+                           const std::vector<rocsparse_int>&           csr_row_ptr,
+                           const std::vector<rocsparse_int>&           csr_col_ind,
+                           const std::vector<rocsparse_float_complex>& csr_val,
+                           rocsparse_index_base                        base,
+                           bool                                        ichol,
+                           float                                       tol,
+                           rocsparse_int                               max_fill,
+                           bool                                        boost,
+                           float                                       boost_tol,
+                           rocsparse_float_complex                     boost_val,
+                           std::vector<rocsparse_int>&                 lu_row_ptr,
+                           std::vector<rocsparse_int>&                 lu_col_ind,
+                           std::vector<rocsparse_float_complex>&       lu_val,
+                           rocsparse_int*                              struct_pivot,
+                           rocsparse_int*                              numeric_pivot);
+
+template void host_csrfsai(rocsparse_int                               M,
+                           const std::vector<rocsparse_int>&           csr_row_ptr_A,
+                           const std::vector<rocsparse_int>&           csr_col_ind_A,
+                           const std::vector<rocsparse_float_complex>& csr_val_A,
+                           rocsparse_index_base                        base_A,
+                           const std::vector<rocsparse_int>&           csr_row_ptr_S,
+                           const std::vector<rocsparse_int>&           csr_col_ind_S,
+                           rocsparse_index_base                        base_S,
+                           rocsparse_index_base                        base_G,
+                           std::vector<rocsparse_int>&                 csr_row_ptr_G,
+                           std::vector<rocsparse_int>&                 csr_col_ind_G,
+                           std::vector<rocsparse_float_complex>&       csr_val_G,
+                           rocsparse_int*                              zero_pivot);
+
+template void host_csrcheb_estimate(rocsparse_int                               M,
+                                    const std::vector<rocsparse_int>&           csr_row_ptr,
+                                    const std::vector<rocsparse_int>&           csr_col_ind,
+                                    const std::vector<rocsparse_float_complex>& csr_val,
+                                    rocsparse_index_base                        base,
+                                    rocsparse_int                               iters,
+                                    float*                                      lambda_max);
+
+template void host_csrcheb(rocsparse_int                               M,
+                           const std::vector<rocsparse_int>&           csr_row_ptr,
+                           const std::vector<rocsparse_int>&           csr_col_ind,
+                           const std::vector<rocsparse_float_complex>& csr_val,
+                           rocsparse_index_base                        base,
+                           rocsparse_int                               degree,
+                           float                                       lambda_min,
+                           float                                       lambda_max,
+                           const std::vector<rocsparse_float_complex>& b,
+                           std::vector<rocsparse_float_complex>&       x);
+
 template void host_gtsv_no_pivot(rocsparse_int                               m,
                                  rocsparse_int                               n,
                                  const std::vector<rocsparse_float_complex>& dl,
@@ -6923,6 +10317,51 @@ template void host_gtsv_no_pivot(rocsparse_int                               m,
                                  std::vector<rocsparse_float_complex>&       B,
                                  rocsparse_int                               ldb);
 
+template void host_gtsv(rocsparse_int                                m,
+                        rocsparse_int                                n,
+                        const std::vector<rocsparse_double_complex>& dl,
+                        const std::vector<rocsparse_double_complex>& d,
+                        const std::vector<rocsparse_double_complex>& du,
+                        std::vector<rocsparse_double_complex>&       B,
+                        rocsparse_int                                ldb);
+
+template void host_gtsv_no_pivot_strided_batch(rocsparse_int                                m,
+                                               const std::vector<rocsparse_double_complex>& dl,
+                                               const std::vector<rocsparse_double_complex>& d,
+                                               const std::vector<rocsparse_double_complex>& du,
+                                               std::vector<rocsparse_double_complex>&       x,
+                                               rocsparse_int                                batch_count,
+                                               rocsparse_int                                batch_stride);
+
+template void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg               alg,
+                                          rocsparse_int                                m,
+                                          const std::vector<rocsparse_double_complex>& dl,
+                                          const std::vector<rocsparse_double_complex>& d,
+                                          const std::vector<rocsparse_double_complex>& du,
+                                          std::vector<rocsparse_double_complex>&       x,
+                                          rocsparse_int                                batch_count,
+                                          rocsparse_int                                batch_stride);
+
+template void host_gpsv_no_pivot_strided_batch(rocsparse_int                                m,
+                                               const std::vector<rocsparse_double_complex>& ds,
+                                               const std::vector<rocsparse_double_complex>& dl,
+                                               const std::vector<rocsparse_double_complex>& d,
+                                               const std::vector<rocsparse_double_complex>& du,
+                                               const std::vector<rocsparse_double_complex>& dw,
+                                               std::vector<rocsparse_double_complex>&       x,
+                                               rocsparse_int                                batch_count,
+                                               rocsparse_int                                batch_stride);
+
+template void host_gpsv_no_pivot_interleaved_batch(rocsparse_int                                m,
+                                                   const std::vector<rocsparse_double_complex>& ds,
+                                                   const std::vector<rocsparse_double_complex>& dl,
+                                                   const std::vector<rocsparse_double_complex>& d,
+                                                   const std::vector<rocsparse_double_complex>& du,
+                                                   const std::vector<rocsparse_double_complex>& dw,
+                                                   std::vector<rocsparse_double_complex>&       x,
+                                                   rocsparse_int                                batch_count,
+                                                   rocsparse_int                                batch_stride);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -6948,6 +10387,16 @@ template void host_csr_to_csc(rocsparse_int                         M,
                               rocsparse_action                      action,
                               rocsparse_index_base                  base);
 
+template void host_csrsympermute(rocsparse_int                               M,
+                                 const std::vector<rocsparse_int>&           csr_row_ptr,
+                                 const std::vector<rocsparse_int>&           csr_col_ind,
+                                 const std::vector<rocsparse_float_complex>& csr_val,
+                                 const std::vector<rocsparse_int>&           perm,
+                                 std::vector<rocsparse_int>&                 csr_row_ptr_out,
+                                 std::vector<rocsparse_int>&                 csr_col_ind_out,
+                                 std::vector<rocsparse_float_complex>&       csr_val_out,
+                                 rocsparse_index_base                        base);
+
 template void host_csr_to_gebsr(rocsparse_direction                         direction,
                                 rocsparse_int                               m,
                                 rocsparse_int                               n,
@@ -7239,7 +10688,28 @@ template void host_coosort_by_column(rocsparse_int                         M,
                                                     rocsparse_index_base      base_A,            \
                                                     rocsparse_index_base      base_B,            \
                                                     rocsparse_index_base      base_C,            \
-                                                    rocsparse_index_base      base_D);
+                                                    rocsparse_index_base      base_D);           \
+    template void host_csrgemm_esc<ITYPE, JTYPE, TTYPE>(JTYPE                     M,             \
+                                                        JTYPE                     N,             \
+                                                        JTYPE                     L,             \
+                                                        const TTYPE*              alpha,         \
+                                                        const std::vector<ITYPE>& csr_row_ptr_A, \
+                                                        const std::vector<JTYPE>& csr_col_ind_A, \
+                                                        const std::vector<TTYPE>& csr_val_A,     \
+                                                        const std::vector<ITYPE>& csr_row_ptr_B, \
+                                                        const std::vector<JTYPE>& csr_col_ind_B, \
+                                                        const std::vector<TTYPE>& csr_val_B,     \
+                                                        const TTYPE*              beta,          \
+                                                        const std::vector<ITYPE>& csr_row_ptr_D, \
+                                                        const std::vector<JTYPE>& csr_col_ind_D, \
+                                                        const std::vector<TTYPE>& csr_val_D,     \
+                                                        const std::vector<ITYPE>& csr_row_ptr_C, \
+                                                        std::vector<JTYPE>&       csr_col_ind_C, \
+                                                        std::vector<TTYPE>&       csr_val_C,     \
+                                                        rocsparse_index_base      base_A,        \
+                                                        rocsparse_index_base      base_B,        \
+                                                        rocsparse_index_base      base_C,        \
+                                                        rocsparse_index_base      base_D);
 
 #define INSTANTIATE4(DIR, ITYPE, JTYPE, TTYPE)                                                       \
     template void host_dense2csx<DIR, ITYPE, JTYPE, TTYPE>(JTYPE                m,                   \
@@ -7308,3 +10778,129 @@ INSTANTIATE4(rocsparse_direction_column, int64_t, int64_t, float);
 INSTANTIATE4(rocsparse_direction_column, int64_t, int64_t, double);
 INSTANTIATE4(rocsparse_direction_column, int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE4(rocsparse_direction_column, int64_t, int64_t, rocsparse_double_complex);
+
+#define INSTANTIATE_SEMIRING(ITYPE, JTYPE, TTYPE)                                            \
+    template void host_csrmv_semiring<ITYPE, JTYPE, TTYPE>(rocsparse_semiring   semiring,    \
+                                                           JTYPE                M,           \
+                                                           TTYPE                alpha,       \
+                                                           const ITYPE*         csr_row_ptr, \
+                                                           const JTYPE*         csr_col_ind, \
+                                                           const TTYPE*         csr_val,     \
+                                                           const TTYPE*         x,           \
+                                                           TTYPE                beta,        \
+                                                           TTYPE*               y,           \
+                                                           rocsparse_index_base base);       \
+    template void host_csrgemm_semiring<ITYPE, JTYPE, TTYPE>(                                \
+        rocsparse_semiring        semiring,                                                  \
+        JTYPE                     M,                                                         \
+        JTYPE                     N,                                                         \
+        TTYPE                     alpha,                                                     \
+        const std::vector<ITYPE>& csr_row_ptr_A,                                             \
+        const std::vector<JTYPE>& csr_col_ind_A,                                             \
+        const std::vector<TTYPE>& csr_val_A,                                                 \
+        const std::vector<ITYPE>& csr_row_ptr_B,                                             \
+        const std::vector<JTYPE>& csr_col_ind_B,                                             \
+        const std::vector<TTYPE>& csr_val_B,                                                 \
+        const std::vector<ITYPE>& csr_row_ptr_C,                                             \
+        std::vector<JTYPE>&       csr_col_ind_C,                                             \
+        std::vector<TTYPE>&       csr_val_C,                                                 \
+        rocsparse_index_base      base_A,                                                    \
+        rocsparse_index_base      base_B,                                                    \
+        rocsparse_index_base      base_C);
+
+INSTANTIATE_SEMIRING(int32_t, int32_t, float);
+INSTANTIATE_SEMIRING(int32_t, int32_t, double);
+INSTANTIATE_SEMIRING(int64_t, int32_t, float);
+INSTANTIATE_SEMIRING(int64_t, int32_t, double);
+INSTANTIATE_SEMIRING(int64_t, int64_t, float);
+INSTANTIATE_SEMIRING(int64_t, int64_t, double);
+
+#define INSTANTIATE_ESTIMATE(ITYPE, JTYPE)                                                         \
+    template void host_csrgemm_nnz_estimate<ITYPE, JTYPE>(JTYPE                     M,             \
+                                                          JTYPE                     N,             \
+                                                          JTYPE                     sample_size,   \
+                                                          const std::vector<ITYPE>& csr_row_ptr_A, \
+                                                          const std::vector<JTYPE>& csr_col_ind_A, \
+                                                          const std::vector<ITYPE>& csr_row_ptr_B, \
+                                                          const std::vector<JTYPE>& csr_col_ind_B, \
+                                                          rocsparse_index_base      base_A,        \
+                                                          rocsparse_index_base      base_B,        \
+                                                          int64_t*                  nnz_products,  \
+                                                          int64_t*                  nnz_C,         \
+                                                          int64_t*                  nnz_C_lower,   \
+                                                          int64_t*                  nnz_C_upper);
+
+INSTANTIATE_ESTIMATE(int32_t, int32_t);
+INSTANTIATE_ESTIMATE(int64_t, int32_t);
+INSTANTIATE_ESTIMATE(int64_t, int64_t);
+
+#define INSTANTIATE_EWISE(TTYPE)                                                        \
+    template void host_csrewise<TTYPE>(rocsparse_ewise_pattern           pattern,       \
+                                       rocsparse_ewise_op                op,            \
+                                       rocsparse_int                     M,             \
+                                       rocsparse_int                     N,             \
+                                       const std::vector<rocsparse_int>& csr_row_ptr_A, \
+                                       const std::vector<rocsparse_int>& csr_col_ind_A, \
+                                       const std::vector<TTYPE>&         csr_val_A,     \
+                                       const std::vector<rocsparse_int>& csr_row_ptr_B, \
+                                       const std::vector<rocsparse_int>& csr_col_ind_B, \
+                                       const std::vector<TTYPE>&         csr_val_B,     \
+                                       const std::vector<rocsparse_int>& csr_row_ptr_C, \
+                                       std::vector<rocsparse_int>&       csr_col_ind_C, \
+                                       std::vector<TTYPE>&               csr_val_C,     \
+                                       rocsparse_index_base              base_A,        \
+                                       rocsparse_index_base              base_B,        \
+                                       rocsparse_index_base              base_C);
+
+INSTANTIATE_EWISE(float);
+INSTANTIATE_EWISE(double);
+INSTANTIATE_EWISE(rocsparse_float_complex);
+INSTANTIATE_EWISE(rocsparse_double_complex);
+
+#define INSTANTIATE_BSRGEMM(TTYPE)                                                     \
+    template void host_bsrgeam<TTYPE>(rocsparse_direction               dir,           \
+                                      rocsparse_int                     Mb,            \
+                                      rocsparse_int                     Nb,            \
+                                      rocsparse_int                     block_dim,     \
+                                      TTYPE                             alpha,         \
+                                      const std::vector<rocsparse_int>& bsr_row_ptr_A, \
+                                      const std::vector<rocsparse_int>& bsr_col_ind_A, \
+                                      const std::vector<TTYPE>&         bsr_val_A,     \
+                                      TTYPE                             beta,          \
+                                      const std::vector<rocsparse_int>& bsr_row_ptr_B, \
+                                      const std::vector<rocsparse_int>& bsr_col_ind_B, \
+                                      const std::vector<TTYPE>&         bsr_val_B,     \
+                                      const std::vector<rocsparse_int>& bsr_row_ptr_C, \
+                                      std::vector<rocsparse_int>&       bsr_col_ind_C, \
+                                      std::vector<TTYPE>&               bsr_val_C,     \
+                                      rocsparse_index_base              base_A,        \
+                                      rocsparse_index_base              base_B,        \
+                                      rocsparse_index_base              base_C);       \
+    template void host_bsrgemm<TTYPE>(rocsparse_direction               dir,           \
+                                      rocsparse_int                     Mb,            \
+                                      rocsparse_int                     Nb,            \
+                                      rocsparse_int                     Kb,            \
+                                      rocsparse_int                     block_dim,     \
+                                      const TTYPE*                      alpha,         \
+                                      const std::vector<rocsparse_int>& bsr_row_ptr_A, \
+                                      const std::vector<rocsparse_int>& bsr_col_ind_A, \
+                                      const std::vector<TTYPE>&         bsr_val_A,     \
+                                      const std::vector<rocsparse_int>& bsr_row_ptr_B, \
+                                      const std::vector<rocsparse_int>& bsr_col_ind_B, \
+                                      const std::vector<TTYPE>&         bsr_val_B,     \
+                                      const TTYPE*                      beta,          \
+                                      const std::vector<rocsparse_int>& bsr_row_ptr_D, \
+                                      const std::vector<rocsparse_int>& bsr_col_ind_D, \
+                                      const std::vector<TTYPE>&         bsr_val_D,     \
+                                      const std::vector<rocsparse_int>& bsr_row_ptr_C, \
+                                      std::vector<rocsparse_int>&       bsr_col_ind_C, \
+                                      std::vector<TTYPE>&               bsr_val_C,     \
+                                      rocsparse_index_base              base_A,        \
+                                      rocsparse_index_base              base_B,        \
+                                      rocsparse_index_base              base_C,        \
+                                      rocsparse_index_base              base_D);
+
+INSTANTIATE_BSRGEMM(float);
+INSTANTIATE_BSRGEMM(double);
+INSTANTIATE_BSRGEMM(rocsparse_float_complex);
+INSTANTIATE_BSRGEMM(rocsparse_double_complex);
@@ -1254,6 +1254,101 @@ void rocsparse_init_csr_random(std::vector<I>&      csr_row_ptr,
     host_coo_to_csr(M, coo_row_ind, csr_row_ptr, base);
 }
 
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT power law sparse matrix in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_rmat(std::vector<I>&      csr_row_ptr,
+                             std::vector<J>&      csr_col_ind,
+                             std::vector<T>&      csr_val,
+                             J                    M,
+                             J                    N,
+                             I&                   nnz,
+                             rocsparse_index_base base,
+                             bool                 to_int)
+{
+    // Quadrant probabilities of the recursive partitioning (Graph500 parameters)
+    static constexpr double a = 0.57;
+    static constexpr double b = 0.19;
+    static constexpr double c = 0.19;
+
+    // Average number of samples per row
+    static constexpr int64_t edge_factor = 16;
+
+    // Number of recursion levels
+    int scale = 0;
+    while((static_cast<int64_t>(1) << scale) < std::max(M, N))
+    {
+        ++scale;
+    }
+
+    // Sample entries by recursively descending into one of the four quadrants
+    int64_t nsamples = std::min(static_cast<int64_t>(M) * edge_factor,
+                                static_cast<int64_t>(M) * static_cast<int64_t>(N));
+
+    std::vector<std::pair<J, J>> entries;
+    entries.reserve(nsamples);
+
+    for(int64_t i = 0; i < nsamples; ++i)
+    {
+        int64_t row = 0;
+        int64_t col = 0;
+
+        for(int s = 0; s < scale; ++s)
+        {
+            double r = random_generator<double>();
+
+            row <<= 1;
+            col <<= 1;
+
+            if(r >= a + b + c)
+            {
+                row |= 1;
+                col |= 1;
+            }
+            else if(r >= a + b)
+            {
+                row |= 1;
+            }
+            else if(r >= a)
+            {
+                col |= 1;
+            }
+        }
+
+        // Reject samples outside of the matrix
+        if(row < M && col < N)
+        {
+            entries.push_back(std::make_pair(static_cast<J>(row), static_cast<J>(col)));
+        }
+    }
+
+    // Remove duplicate entries
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+    nnz = static_cast<I>(entries.size());
+
+    csr_row_ptr.resize(M + 1, 0);
+    csr_col_ind.resize(nnz);
+    csr_val.resize(nnz);
+
+    for(I i = 0; i < nnz; ++i)
+    {
+        ++csr_row_ptr[entries[i].first + 1];
+
+        csr_col_ind[i] = entries[i].second + base;
+        csr_val[i]     = to_int ? random_generator_exact<T>()
+                                : random_generator<T>(static_cast<T>(-1.0), static_cast<T>(1.0));
+    }
+
+    // Exclusive scan
+    csr_row_ptr[0] = base;
+    for(J i = 0; i < M; ++i)
+    {
+        csr_row_ptr[i + 1] += csr_row_ptr[i];
+    }
+}
+
 /* ==================================================================================== */
 /*! \brief  Generate a random sparse matrix in COO format */
 template <typename I, typename T>
@@ -1317,6 +1412,10 @@ void rocsparse_init_csr_matrix(std::vector<I>&       csr_row_ptr,
     {
         rocsparse_init_csr_mtx(filename, csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base);
     }
+    else if(matrix == rocsparse_matrix_rmat)
+    {
+        rocsparse_init_csr_rmat(csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base, toint);
+    }
 }
 
 /* ==================================================================================== */
@@ -1602,6 +1701,14 @@ void rocsparse_init_coo_matrix(std::vector<I>&       coo_row_ind,
                                                                  rocsparse_index_base base,         \
                                                                  bool                 full_rank,    \
                                                                  bool                 to_int);                      \
+    template void rocsparse_init_csr_rmat<ITYPE, JTYPE, TTYPE>(std::vector<ITYPE> & row_ptr,        \
+                                                               std::vector<JTYPE> & col_ind,        \
+                                                               std::vector<TTYPE> & val,            \
+                                                               JTYPE M,                             \
+                                                               JTYPE N,                             \
+                                                               ITYPE & nnz,                         \
+                                                               rocsparse_index_base base,           \
+                                                               bool                 to_int);        \
     template void rocsparse_init_csr_matrix<ITYPE, JTYPE, TTYPE>(std::vector<ITYPE> & csr_row_ptr,  \
                                                                  std::vector<JTYPE> & csr_col_ind,  \
                                                                  std::vector<TTYPE> & csr_val,      \
@@ -2907,1863 +2907,5280 @@ rocsparse_status rocsparse_gemmi(rocsparse_handle                handle,
  *    extra SPARSE
  * ===========================================================================
  */
-// csrgeam
+// bsrgeam
 template <>
-rocsparse_status rocsparse_csrgeam(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             n,
+rocsparse_status rocsparse_bsrgeam(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nb,
+                                   rocsparse_int             block_dim,
                                    const float*              alpha,
                                    const rocsparse_mat_descr descr_A,
-                                   rocsparse_int             nnz_A,
-                                   const float*              csr_val_A,
-                                   const rocsparse_int*      csr_row_ptr_A,
-                                   const rocsparse_int*      csr_col_ind_A,
+                                   rocsparse_int             nnzb_A,
+                                   const float*              bsr_val_A,
+                                   const rocsparse_int*      bsr_row_ptr_A,
+                                   const rocsparse_int*      bsr_col_ind_A,
                                    const float*              beta,
                                    const rocsparse_mat_descr descr_B,
-                                   rocsparse_int             nnz_B,
-                                   const float*              csr_val_B,
-                                   const rocsparse_int*      csr_row_ptr_B,
-                                   const rocsparse_int*      csr_col_ind_B,
+                                   rocsparse_int             nnzb_B,
+                                   const float*              bsr_val_B,
+                                   const rocsparse_int*      bsr_row_ptr_B,
+                                   const rocsparse_int*      bsr_col_ind_B,
                                    const rocsparse_mat_descr descr_C,
-                                   float*                    csr_val_C,
-                                   const rocsparse_int*      csr_row_ptr_C,
-                                   rocsparse_int*            csr_col_ind_C)
+                                   float*                    bsr_val_C,
+                                   const rocsparse_int*      bsr_row_ptr_C,
+                                   rocsparse_int*            bsr_col_ind_C)
 {
-    return rocsparse_scsrgeam(handle,
-                              m,
-                              n,
+    return rocsparse_sbsrgeam(handle,
+                              dir,
+                              mb,
+                              nb,
+                              block_dim,
                               alpha,
                               descr_A,
-                              nnz_A,
-                              csr_val_A,
-                              csr_row_ptr_A,
-                              csr_col_ind_A,
+                              nnzb_A,
+                              bsr_val_A,
+                              bsr_row_ptr_A,
+                              bsr_col_ind_A,
                               beta,
                               descr_B,
-                              nnz_B,
-                              csr_val_B,
-                              csr_row_ptr_B,
-                              csr_col_ind_B,
+                              nnzb_B,
+                              bsr_val_B,
+                              bsr_row_ptr_B,
+                              bsr_col_ind_B,
                               descr_C,
-                              csr_val_C,
-                              csr_row_ptr_C,
-                              csr_col_ind_C);
+                              bsr_val_C,
+                              bsr_row_ptr_C,
+                              bsr_col_ind_C);
 }
 
 template <>
-rocsparse_status rocsparse_csrgeam(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             n,
+rocsparse_status rocsparse_bsrgeam(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nb,
+                                   rocsparse_int             block_dim,
                                    const double*             alpha,
                                    const rocsparse_mat_descr descr_A,
-                                   rocsparse_int             nnz_A,
-                                   const double*             csr_val_A,
-                                   const rocsparse_int*      csr_row_ptr_A,
-                                   const rocsparse_int*      csr_col_ind_A,
+                                   rocsparse_int             nnzb_A,
+                                   const double*             bsr_val_A,
+                                   const rocsparse_int*      bsr_row_ptr_A,
+                                   const rocsparse_int*      bsr_col_ind_A,
                                    const double*             beta,
                                    const rocsparse_mat_descr descr_B,
-                                   rocsparse_int             nnz_B,
-                                   const double*             csr_val_B,
-                                   const rocsparse_int*      csr_row_ptr_B,
-                                   const rocsparse_int*      csr_col_ind_B,
+                                   rocsparse_int             nnzb_B,
+                                   const double*             bsr_val_B,
+                                   const rocsparse_int*      bsr_row_ptr_B,
+                                   const rocsparse_int*      bsr_col_ind_B,
                                    const rocsparse_mat_descr descr_C,
-                                   double*                   csr_val_C,
-                                   const rocsparse_int*      csr_row_ptr_C,
-                                   rocsparse_int*            csr_col_ind_C)
+                                   double*                   bsr_val_C,
+                                   const rocsparse_int*      bsr_row_ptr_C,
+                                   rocsparse_int*            bsr_col_ind_C)
 {
-    return rocsparse_dcsrgeam(handle,
-                              m,
-                              n,
+    return rocsparse_dbsrgeam(handle,
+                              dir,
+                              mb,
+                              nb,
+                              block_dim,
                               alpha,
                               descr_A,
-                              nnz_A,
-                              csr_val_A,
-                              csr_row_ptr_A,
-                              csr_col_ind_A,
+                              nnzb_A,
+                              bsr_val_A,
+                              bsr_row_ptr_A,
+                              bsr_col_ind_A,
                               beta,
                               descr_B,
-                              nnz_B,
-                              csr_val_B,
-                              csr_row_ptr_B,
-                              csr_col_ind_B,
+                              nnzb_B,
+                              bsr_val_B,
+                              bsr_row_ptr_B,
+                              bsr_col_ind_B,
                               descr_C,
-                              csr_val_C,
-                              csr_row_ptr_C,
-                              csr_col_ind_C);
+                              bsr_val_C,
+                              bsr_row_ptr_C,
+                              bsr_col_ind_C);
 }
 
 template <>
-rocsparse_status rocsparse_csrgeam(rocsparse_handle               handle,
-                                   rocsparse_int                  m,
-                                   rocsparse_int                  n,
+rocsparse_status rocsparse_bsrgeam(rocsparse_handle               handle,
+                                   rocsparse_direction            dir,
+                                   rocsparse_int                  mb,
+                                   rocsparse_int                  nb,
+                                   rocsparse_int                  block_dim,
                                    const rocsparse_float_complex* alpha,
                                    const rocsparse_mat_descr      descr_A,
-                                   rocsparse_int                  nnz_A,
-                                   const rocsparse_float_complex* csr_val_A,
-                                   const rocsparse_int*           csr_row_ptr_A,
-                                   const rocsparse_int*           csr_col_ind_A,
+                                   rocsparse_int                  nnzb_A,
+                                   const rocsparse_float_complex* bsr_val_A,
+                                   const rocsparse_int*           bsr_row_ptr_A,
+                                   const rocsparse_int*           bsr_col_ind_A,
                                    const rocsparse_float_complex* beta,
                                    const rocsparse_mat_descr      descr_B,
-                                   rocsparse_int                  nnz_B,
-                                   const rocsparse_float_complex* csr_val_B,
-                                   const rocsparse_int*           csr_row_ptr_B,
-                                   const rocsparse_int*           csr_col_ind_B,
+                                   rocsparse_int                  nnzb_B,
+                                   const rocsparse_float_complex* bsr_val_B,
+                                   const rocsparse_int*           bsr_row_ptr_B,
+                                   const rocsparse_int*           bsr_col_ind_B,
                                    const rocsparse_mat_descr      descr_C,
-                                   rocsparse_float_complex*       csr_val_C,
-                                   const rocsparse_int*           csr_row_ptr_C,
-                                   rocsparse_int*                 csr_col_ind_C)
+                                   rocsparse_float_complex*       bsr_val_C,
+                                   const rocsparse_int*           bsr_row_ptr_C,
+                                   rocsparse_int*                 bsr_col_ind_C)
 {
-    return rocsparse_ccsrgeam(handle,
-                              m,
-                              n,
-                              (const rocsparse_float_complex*)alpha,
+    return rocsparse_cbsrgeam(handle,
+                              dir,
+                              mb,
+                              nb,
+                              block_dim,
+                              alpha,
                               descr_A,
-                              nnz_A,
-                              (const rocsparse_float_complex*)csr_val_A,
-                              csr_row_ptr_A,
-                              csr_col_ind_A,
-                              (const rocsparse_float_complex*)beta,
+                              nnzb_A,
+                              bsr_val_A,
+                              bsr_row_ptr_A,
+                              bsr_col_ind_A,
+                              beta,
                               descr_B,
-                              nnz_B,
-                              (const rocsparse_float_complex*)csr_val_B,
-                              csr_row_ptr_B,
-                              csr_col_ind_B,
+                              nnzb_B,
+                              bsr_val_B,
+                              bsr_row_ptr_B,
+                              bsr_col_ind_B,
                               descr_C,
-                              (rocsparse_float_complex*)csr_val_C,
-                              csr_row_ptr_C,
-                              csr_col_ind_C);
+                              bsr_val_C,
+                              bsr_row_ptr_C,
+                              bsr_col_ind_C);
 }
 
 template <>
-rocsparse_status rocsparse_csrgeam(rocsparse_handle                handle,
-                                   rocsparse_int                   m,
-                                   rocsparse_int                   n,
+rocsparse_status rocsparse_bsrgeam(rocsparse_handle                handle,
+                                   rocsparse_direction             dir,
+                                   rocsparse_int                   mb,
+                                   rocsparse_int                   nb,
+                                   rocsparse_int                   block_dim,
                                    const rocsparse_double_complex* alpha,
                                    const rocsparse_mat_descr       descr_A,
-                                   rocsparse_int                   nnz_A,
-                                   const rocsparse_double_complex* csr_val_A,
-                                   const rocsparse_int*            csr_row_ptr_A,
-                                   const rocsparse_int*            csr_col_ind_A,
+                                   rocsparse_int                   nnzb_A,
+                                   const rocsparse_double_complex* bsr_val_A,
+                                   const rocsparse_int*            bsr_row_ptr_A,
+                                   const rocsparse_int*            bsr_col_ind_A,
                                    const rocsparse_double_complex* beta,
                                    const rocsparse_mat_descr       descr_B,
-                                   rocsparse_int                   nnz_B,
-                                   const rocsparse_double_complex* csr_val_B,
-                                   const rocsparse_int*            csr_row_ptr_B,
-                                   const rocsparse_int*            csr_col_ind_B,
+                                   rocsparse_int                   nnzb_B,
+                                   const rocsparse_double_complex* bsr_val_B,
+                                   const rocsparse_int*            bsr_row_ptr_B,
+                                   const rocsparse_int*            bsr_col_ind_B,
                                    const rocsparse_mat_descr       descr_C,
-                                   rocsparse_double_complex*       csr_val_C,
-                                   const rocsparse_int*            csr_row_ptr_C,
-                                   rocsparse_int*                  csr_col_ind_C)
+                                   rocsparse_double_complex*       bsr_val_C,
+                                   const rocsparse_int*            bsr_row_ptr_C,
+                                   rocsparse_int*                  bsr_col_ind_C)
 {
-    return rocsparse_zcsrgeam(handle,
-                              m,
-                              n,
-                              (const rocsparse_double_complex*)alpha,
+    return rocsparse_zbsrgeam(handle,
+                              dir,
+                              mb,
+                              nb,
+                              block_dim,
+                              alpha,
                               descr_A,
-                              nnz_A,
-                              (const rocsparse_double_complex*)csr_val_A,
-                              csr_row_ptr_A,
-                              csr_col_ind_A,
-                              (const rocsparse_double_complex*)beta,
+                              nnzb_A,
+                              bsr_val_A,
+                              bsr_row_ptr_A,
+                              bsr_col_ind_A,
+                              beta,
                               descr_B,
-                              nnz_B,
-                              (const rocsparse_double_complex*)csr_val_B,
-                              csr_row_ptr_B,
-                              csr_col_ind_B,
+                              nnzb_B,
+                              bsr_val_B,
+                              bsr_row_ptr_B,
+                              bsr_col_ind_B,
                               descr_C,
-                              (rocsparse_double_complex*)csr_val_C,
-                              csr_row_ptr_C,
-                              csr_col_ind_C);
+                              bsr_val_C,
+                              bsr_row_ptr_C,
+                              bsr_col_ind_C);
 }
 
-// csrgemm
+// bsrgemm
 template <>
-rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle          handle,
+rocsparse_status rocsparse_bsrgemm_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
                                                rocsparse_operation       trans_A,
                                                rocsparse_operation       trans_B,
-                                               rocsparse_int             m,
-                                               rocsparse_int             n,
-                                               rocsparse_int             k,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nb,
+                                               rocsparse_int             kb,
+                                               rocsparse_int             block_dim,
                                                const float*              alpha,
                                                const rocsparse_mat_descr descr_A,
-                                               rocsparse_int             nnz_A,
-                                               const rocsparse_int*      csr_row_ptr_A,
-                                               const rocsparse_int*      csr_col_ind_A,
+                                               rocsparse_int             nnzb_A,
+                                               const rocsparse_int*      bsr_row_ptr_A,
+                                               const rocsparse_int*      bsr_col_ind_A,
                                                const rocsparse_mat_descr descr_B,
-                                               rocsparse_int             nnz_B,
-                                               const rocsparse_int*      csr_row_ptr_B,
-                                               const rocsparse_int*      csr_col_ind_B,
+                                               rocsparse_int             nnzb_B,
+                                               const rocsparse_int*      bsr_row_ptr_B,
+                                               const rocsparse_int*      bsr_col_ind_B,
                                                const float*              beta,
                                                const rocsparse_mat_descr descr_D,
-                                               rocsparse_int             nnz_D,
-                                               const rocsparse_int*      csr_row_ptr_D,
-                                               const rocsparse_int*      csr_col_ind_D,
+                                               rocsparse_int             nnzb_D,
+                                               const rocsparse_int*      bsr_row_ptr_D,
+                                               const rocsparse_int*      bsr_col_ind_D,
                                                rocsparse_mat_info        info_C,
                                                size_t*                   buffer_size)
 {
-    return rocsparse_scsrgemm_buffer_size(handle,
+    return rocsparse_sbsrgemm_buffer_size(handle,
+                                          dir,
                                           trans_A,
                                           trans_B,
-                                          m,
-                                          n,
-                                          k,
+                                          mb,
+                                          nb,
+                                          kb,
+                                          block_dim,
                                           alpha,
                                           descr_A,
-                                          nnz_A,
-                                          csr_row_ptr_A,
-                                          csr_col_ind_A,
+                                          nnzb_A,
+                                          bsr_row_ptr_A,
+                                          bsr_col_ind_A,
                                           descr_B,
-                                          nnz_B,
-                                          csr_row_ptr_B,
-                                          csr_col_ind_B,
+                                          nnzb_B,
+                                          bsr_row_ptr_B,
+                                          bsr_col_ind_B,
                                           beta,
                                           descr_D,
-                                          nnz_D,
-                                          csr_row_ptr_D,
-                                          csr_col_ind_D,
+                                          nnzb_D,
+                                          bsr_row_ptr_D,
+                                          bsr_col_ind_D,
                                           info_C,
                                           buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle          handle,
+rocsparse_status rocsparse_bsrgemm_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
                                                rocsparse_operation       trans_A,
                                                rocsparse_operation       trans_B,
-                                               rocsparse_int             m,
-                                               rocsparse_int             n,
-                                               rocsparse_int             k,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nb,
+                                               rocsparse_int             kb,
+                                               rocsparse_int             block_dim,
                                                const double*             alpha,
                                                const rocsparse_mat_descr descr_A,
-                                               rocsparse_int             nnz_A,
-                                               const rocsparse_int*      csr_row_ptr_A,
-                                               const rocsparse_int*      csr_col_ind_A,
+                                               rocsparse_int             nnzb_A,
+                                               const rocsparse_int*      bsr_row_ptr_A,
+                                               const rocsparse_int*      bsr_col_ind_A,
                                                const rocsparse_mat_descr descr_B,
-                                               rocsparse_int             nnz_B,
-                                               const rocsparse_int*      csr_row_ptr_B,
-                                               const rocsparse_int*      csr_col_ind_B,
+                                               rocsparse_int             nnzb_B,
+                                               const rocsparse_int*      bsr_row_ptr_B,
+                                               const rocsparse_int*      bsr_col_ind_B,
                                                const double*             beta,
                                                const rocsparse_mat_descr descr_D,
-                                               rocsparse_int             nnz_D,
-                                               const rocsparse_int*      csr_row_ptr_D,
-                                               const rocsparse_int*      csr_col_ind_D,
+                                               rocsparse_int             nnzb_D,
+                                               const rocsparse_int*      bsr_row_ptr_D,
+                                               const rocsparse_int*      bsr_col_ind_D,
                                                rocsparse_mat_info        info_C,
                                                size_t*                   buffer_size)
 {
-    return rocsparse_dcsrgemm_buffer_size(handle,
+    return rocsparse_dbsrgemm_buffer_size(handle,
+                                          dir,
                                           trans_A,
                                           trans_B,
-                                          m,
-                                          n,
-                                          k,
+                                          mb,
+                                          nb,
+                                          kb,
+                                          block_dim,
                                           alpha,
                                           descr_A,
-                                          nnz_A,
-                                          csr_row_ptr_A,
-                                          csr_col_ind_A,
+                                          nnzb_A,
+                                          bsr_row_ptr_A,
+                                          bsr_col_ind_A,
                                           descr_B,
-                                          nnz_B,
-                                          csr_row_ptr_B,
-                                          csr_col_ind_B,
+                                          nnzb_B,
+                                          bsr_row_ptr_B,
+                                          bsr_col_ind_B,
                                           beta,
                                           descr_D,
-                                          nnz_D,
-                                          csr_row_ptr_D,
-                                          csr_col_ind_D,
+                                          nnzb_D,
+                                          bsr_row_ptr_D,
+                                          bsr_col_ind_D,
                                           info_C,
                                           buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle               handle,
+rocsparse_status rocsparse_bsrgemm_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_direction            dir,
                                                rocsparse_operation            trans_A,
                                                rocsparse_operation            trans_B,
-                                               rocsparse_int                  m,
-                                               rocsparse_int                  n,
-                                               rocsparse_int                  k,
+                                               rocsparse_int                  mb,
+                                               rocsparse_int                  nb,
+                                               rocsparse_int                  kb,
+                                               rocsparse_int                  block_dim,
                                                const rocsparse_float_complex* alpha,
                                                const rocsparse_mat_descr      descr_A,
-                                               rocsparse_int                  nnz_A,
-                                               const rocsparse_int*           csr_row_ptr_A,
-                                               const rocsparse_int*           csr_col_ind_A,
+                                               rocsparse_int                  nnzb_A,
+                                               const rocsparse_int*           bsr_row_ptr_A,
+                                               const rocsparse_int*           bsr_col_ind_A,
                                                const rocsparse_mat_descr      descr_B,
-                                               rocsparse_int                  nnz_B,
-                                               const rocsparse_int*           csr_row_ptr_B,
-                                               const rocsparse_int*           csr_col_ind_B,
+                                               rocsparse_int                  nnzb_B,
+                                               const rocsparse_int*           bsr_row_ptr_B,
+                                               const rocsparse_int*           bsr_col_ind_B,
                                                const rocsparse_float_complex* beta,
                                                const rocsparse_mat_descr      descr_D,
-                                               rocsparse_int                  nnz_D,
-                                               const rocsparse_int*           csr_row_ptr_D,
-                                               const rocsparse_int*           csr_col_ind_D,
+                                               rocsparse_int                  nnzb_D,
+                                               const rocsparse_int*           bsr_row_ptr_D,
+                                               const rocsparse_int*           bsr_col_ind_D,
                                                rocsparse_mat_info             info_C,
                                                size_t*                        buffer_size)
 {
-    return rocsparse_ccsrgemm_buffer_size(handle,
+    return rocsparse_cbsrgemm_buffer_size(handle,
+                                          dir,
                                           trans_A,
                                           trans_B,
-                                          m,
-                                          n,
-                                          k,
+                                          mb,
+                                          nb,
+                                          kb,
+                                          block_dim,
                                           alpha,
                                           descr_A,
-                                          nnz_A,
-                                          csr_row_ptr_A,
-                                          csr_col_ind_A,
+                                          nnzb_A,
+                                          bsr_row_ptr_A,
+                                          bsr_col_ind_A,
                                           descr_B,
-                                          nnz_B,
-                                          csr_row_ptr_B,
-                                          csr_col_ind_B,
+                                          nnzb_B,
+                                          bsr_row_ptr_B,
+                                          bsr_col_ind_B,
                                           beta,
                                           descr_D,
-                                          nnz_D,
-                                          csr_row_ptr_D,
-                                          csr_col_ind_D,
+                                          nnzb_D,
+                                          bsr_row_ptr_D,
+                                          bsr_col_ind_D,
                                           info_C,
                                           buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle                handle,
+rocsparse_status rocsparse_bsrgemm_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_direction             dir,
                                                rocsparse_operation             trans_A,
                                                rocsparse_operation             trans_B,
-                                               rocsparse_int                   m,
-                                               rocsparse_int                   n,
-                                               rocsparse_int                   k,
-                                               const rocsparse_double_complex* alpha,
+                                               rocsparse_int                   mb,
+                                               rocsparse_int                   nb,
+                                               rocsparse_int                   kb,
+                                               rocsparse_int                   block_dim,
+                                               const rocsparse_double_complex* alpha,
                                                const rocsparse_mat_descr       descr_A,
-                                               rocsparse_int                   nnz_A,
-                                               const rocsparse_int*            csr_row_ptr_A,
-                                               const rocsparse_int*            csr_col_ind_A,
+                                               rocsparse_int                   nnzb_A,
+                                               const rocsparse_int*            bsr_row_ptr_A,
+                                               const rocsparse_int*            bsr_col_ind_A,
                                                const rocsparse_mat_descr       descr_B,
-                                               rocsparse_int                   nnz_B,
-                                               const rocsparse_int*            csr_row_ptr_B,
-                                               const rocsparse_int*            csr_col_ind_B,
+                                               rocsparse_int                   nnzb_B,
+                                               const rocsparse_int*            bsr_row_ptr_B,
+                                               const rocsparse_int*            bsr_col_ind_B,
                                                const rocsparse_double_complex* beta,
                                                const rocsparse_mat_descr       descr_D,
-                                               rocsparse_int                   nnz_D,
-                                               const rocsparse_int*            csr_row_ptr_D,
-                                               const rocsparse_int*            csr_col_ind_D,
+                                               rocsparse_int                   nnzb_D,
+                                               const rocsparse_int*            bsr_row_ptr_D,
+                                               const rocsparse_int*            bsr_col_ind_D,
                                                rocsparse_mat_info              info_C,
                                                size_t*                         buffer_size)
 {
-    return rocsparse_zcsrgemm_buffer_size(handle,
+    return rocsparse_zbsrgemm_buffer_size(handle,
+                                          dir,
                                           trans_A,
                                           trans_B,
-                                          m,
-                                          n,
-                                          k,
+                                          mb,
+                                          nb,
+                                          kb,
+                                          block_dim,
                                           alpha,
                                           descr_A,
-                                          nnz_A,
-                                          csr_row_ptr_A,
-                                          csr_col_ind_A,
+                                          nnzb_A,
+                                          bsr_row_ptr_A,
+                                          bsr_col_ind_A,
                                           descr_B,
-                                          nnz_B,
-                                          csr_row_ptr_B,
-                                          csr_col_ind_B,
+                                          nnzb_B,
+                                          bsr_row_ptr_B,
+                                          bsr_col_ind_B,
                                           beta,
                                           descr_D,
-                                          nnz_D,
-                                          csr_row_ptr_D,
-                                          csr_col_ind_D,
+                                          nnzb_D,
+                                          bsr_row_ptr_D,
+                                          bsr_col_ind_D,
                                           info_C,
                                           buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
+rocsparse_status rocsparse_bsrgemm(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
                                    rocsparse_operation       trans_A,
                                    rocsparse_operation       trans_B,
-                                   rocsparse_int             m,
-                                   rocsparse_int             n,
-                                   rocsparse_int             k,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nb,
+                                   rocsparse_int             kb,
+                                   rocsparse_int             block_dim,
                                    const float*              alpha,
                                    const rocsparse_mat_descr descr_A,
-                                   rocsparse_int             nnz_A,
-                                   const float*              csr_val_A,
-                                   const rocsparse_int*      csr_row_ptr_A,
-                                   const rocsparse_int*      csr_col_ind_A,
+                                   rocsparse_int             nnzb_A,
+                                   const float*              bsr_val_A,
+                                   const rocsparse_int*      bsr_row_ptr_A,
+                                   const rocsparse_int*      bsr_col_ind_A,
                                    const rocsparse_mat_descr descr_B,
-                                   rocsparse_int             nnz_B,
-                                   const float*              csr_val_B,
-                                   const rocsparse_int*      csr_row_ptr_B,
-                                   const rocsparse_int*      csr_col_ind_B,
+                                   rocsparse_int             nnzb_B,
+                                   const float*              bsr_val_B,
+                                   const rocsparse_int*      bsr_row_ptr_B,
+                                   const rocsparse_int*      bsr_col_ind_B,
                                    const float*              beta,
                                    const rocsparse_mat_descr descr_D,
-                                   rocsparse_int             nnz_D,
-                                   const float*              csr_val_D,
-                                   const rocsparse_int*      csr_row_ptr_D,
-                                   const rocsparse_int*      csr_col_ind_D,
+                                   rocsparse_int             nnzb_D,
+                                   const float*              bsr_val_D,
+                                   const rocsparse_int*      bsr_row_ptr_D,
+                                   const rocsparse_int*      bsr_col_ind_D,
                                    const rocsparse_mat_descr descr_C,
-                                   float*                    csr_val_C,
-                                   const rocsparse_int*      csr_row_ptr_C,
-                                   rocsparse_int*            csr_col_ind_C,
+                                   float*                    bsr_val_C,
+                                   const rocsparse_int*      bsr_row_ptr_C,
+                                   rocsparse_int*            bsr_col_ind_C,
                                    const rocsparse_mat_info  info_C,
                                    void*                     temp_buffer)
 {
-    return rocsparse_scsrgemm(handle,
+    return rocsparse_sbsrgemm(handle,
+                              dir,
                               trans_A,
                               trans_B,
-                              m,
-                              n,
-                              k,
+                              mb,
+                              nb,
+                              kb,
+                              block_dim,
                               alpha,
                               descr_A,
-                              nnz_A,
-                              csr_val_A,
-                              csr_row_ptr_A,
-                              csr_col_ind_A,
+                              nnzb_A,
+                              bsr_val_A,
+                              bsr_row_ptr_A,
+                              bsr_col_ind_A,
                               descr_B,
-                              nnz_B,
-                              csr_val_B,
-                              csr_row_ptr_B,
-                              csr_col_ind_B,
+                              nnzb_B,
+                              bsr_val_B,
+                              bsr_row_ptr_B,
+                              bsr_col_ind_B,
                               beta,
                               descr_D,
-                              nnz_D,
-                              csr_val_D,
-                              csr_row_ptr_D,
-                              csr_col_ind_D,
+                              nnzb_D,
+                              bsr_val_D,
+                              bsr_row_ptr_D,
+                              bsr_col_ind_D,
                               descr_C,
-                              csr_val_C,
-                              csr_row_ptr_C,
-                              csr_col_ind_C,
+                              bsr_val_C,
+                              bsr_row_ptr_C,
+                              bsr_col_ind_C,
                               info_C,
                               temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
+rocsparse_status rocsparse_bsrgemm(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
                                    rocsparse_operation       trans_A,
                                    rocsparse_operation       trans_B,
-                                   rocsparse_int             m,
-                                   rocsparse_int             n,
-                                   rocsparse_int             k,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nb,
+                                   rocsparse_int             kb,
+                                   rocsparse_int             block_dim,
                                    const double*             alpha,
                                    const rocsparse_mat_descr descr_A,
-                                   rocsparse_int             nnz_A,
-                                   const double*             csr_val_A,
-                                   const rocsparse_int*      csr_row_ptr_A,
-                                   const rocsparse_int*      csr_col_ind_A,
+                                   rocsparse_int             nnzb_A,
+                                   const double*             bsr_val_A,
+                                   const rocsparse_int*      bsr_row_ptr_A,
+                                   const rocsparse_int*      bsr_col_ind_A,
                                    const rocsparse_mat_descr descr_B,
-                                   rocsparse_int             nnz_B,
-                                   const double*             csr_val_B,
-                                   const rocsparse_int*      csr_row_ptr_B,
-                                   const rocsparse_int*      csr_col_ind_B,
+                                   rocsparse_int             nnzb_B,
+                                   const double*             bsr_val_B,
+                                   const rocsparse_int*      bsr_row_ptr_B,
+                                   const rocsparse_int*      bsr_col_ind_B,
                                    const double*             beta,
                                    const rocsparse_mat_descr descr_D,
-                                   rocsparse_int             nnz_D,
-                                   const double*             csr_val_D,
-                                   const rocsparse_int*      csr_row_ptr_D,
-                                   const rocsparse_int*      csr_col_ind_D,
+                                   rocsparse_int             nnzb_D,
+                                   const double*             bsr_val_D,
+                                   const rocsparse_int*      bsr_row_ptr_D,
+                                   const rocsparse_int*      bsr_col_ind_D,
                                    const rocsparse_mat_descr descr_C,
-                                   double*                   csr_val_C,
-                                   const rocsparse_int*      csr_row_ptr_C,
-                                   rocsparse_int*            csr_col_ind_C,
+                                   double*                   bsr_val_C,
+                                   const rocsparse_int*      bsr_row_ptr_C,
+                                   rocsparse_int*            bsr_col_ind_C,
                                    const rocsparse_mat_info  info_C,
                                    void*                     temp_buffer)
 {
-    return rocsparse_dcsrgemm(handle,
+    return rocsparse_dbsrgemm(handle,
+                              dir,
                               trans_A,
                               trans_B,
-                              m,
-                              n,
-                              k,
+                              mb,
+                              nb,
+                              kb,
+                              block_dim,
                               alpha,
                               descr_A,
-                              nnz_A,
-                              csr_val_A,
-                              csr_row_ptr_A,
-                              csr_col_ind_A,
+                              nnzb_A,
+                              bsr_val_A,
+                              bsr_row_ptr_A,
+                              bsr_col_ind_A,
                               descr_B,
-                              nnz_B,
-                              csr_val_B,
-                              csr_row_ptr_B,
-                              csr_col_ind_B,
+                              nnzb_B,
+                              bsr_val_B,
+                              bsr_row_ptr_B,
+                              bsr_col_ind_B,
                               beta,
                               descr_D,
-                              nnz_D,
-                              csr_val_D,
-                              csr_row_ptr_D,
-                              csr_col_ind_D,
+                              nnzb_D,
+                              bsr_val_D,
+                              bsr_row_ptr_D,
+                              bsr_col_ind_D,
                               descr_C,
-                              csr_val_C,
-                              csr_row_ptr_C,
-                              csr_col_ind_C,
+                              bsr_val_C,
+                              bsr_row_ptr_C,
+                              bsr_col_ind_C,
                               info_C,
                               temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrgemm(rocsparse_handle               handle,
+rocsparse_status rocsparse_bsrgemm(rocsparse_handle               handle,
+                                   rocsparse_direction            dir,
                                    rocsparse_operation            trans_A,
                                    rocsparse_operation            trans_B,
-                                   rocsparse_int                  m,
-                                   rocsparse_int                  n,
-                                   rocsparse_int                  k,
+                                   rocsparse_int                  mb,
+                                   rocsparse_int                  nb,
+                                   rocsparse_int                  kb,
+                                   rocsparse_int                  block_dim,
                                    const rocsparse_float_complex* alpha,
                                    const rocsparse_mat_descr      descr_A,
-                                   rocsparse_int                  nnz_A,
-                                   const rocsparse_float_complex* csr_val_A,
-                                   const rocsparse_int*           csr_row_ptr_A,
-                                   const rocsparse_int*           csr_col_ind_A,
+                                   rocsparse_int                  nnzb_A,
+                                   const rocsparse_float_complex* bsr_val_A,
+                                   const rocsparse_int*           bsr_row_ptr_A,
+                                   const rocsparse_int*           bsr_col_ind_A,
                                    const rocsparse_mat_descr      descr_B,
-                                   rocsparse_int                  nnz_B,
-                                   const rocsparse_float_complex* csr_val_B,
-                                   const rocsparse_int*           csr_row_ptr_B,
-                                   const rocsparse_int*           csr_col_ind_B,
+                                   rocsparse_int                  nnzb_B,
+                                   const rocsparse_float_complex* bsr_val_B,
+                                   const rocsparse_int*           bsr_row_ptr_B,
+                                   const rocsparse_int*           bsr_col_ind_B,
                                    const rocsparse_float_complex* beta,
                                    const rocsparse_mat_descr      descr_D,
-                                   rocsparse_int                  nnz_D,
-                                   const rocsparse_float_complex* csr_val_D,
-                                   const rocsparse_int*           csr_row_ptr_D,
-                                   const rocsparse_int*           csr_col_ind_D,
+                                   rocsparse_int                  nnzb_D,
+                                   const rocsparse_float_complex* bsr_val_D,
+                                   const rocsparse_int*           bsr_row_ptr_D,
+                                   const rocsparse_int*           bsr_col_ind_D,
                                    const rocsparse_mat_descr      descr_C,
-                                   rocsparse_float_complex*       csr_val_C,
-                                   const rocsparse_int*           csr_row_ptr_C,
-                                   rocsparse_int*                 csr_col_ind_C,
+                                   rocsparse_float_complex*       bsr_val_C,
+                                   const rocsparse_int*           bsr_row_ptr_C,
+                                   rocsparse_int*                 bsr_col_ind_C,
                                    const rocsparse_mat_info       info_C,
                                    void*                          temp_buffer)
 {
-    return rocsparse_ccsrgemm(handle,
+    return rocsparse_cbsrgemm(handle,
+                              dir,
                               trans_A,
                               trans_B,
-                              m,
-                              n,
-                              k,
+                              mb,
+                              nb,
+                              kb,
+                              block_dim,
                               alpha,
                               descr_A,
-                              nnz_A,
-                              csr_val_A,
-                              csr_row_ptr_A,
-                              csr_col_ind_A,
+                              nnzb_A,
+                              bsr_val_A,
+                              bsr_row_ptr_A,
+                              bsr_col_ind_A,
                               descr_B,
-                              nnz_B,
-                              csr_val_B,
-                              csr_row_ptr_B,
-                              csr_col_ind_B,
+                              nnzb_B,
+                              bsr_val_B,
+                              bsr_row_ptr_B,
+                              bsr_col_ind_B,
                               beta,
                               descr_D,
-                              nnz_D,
-                              csr_val_D,
-                              csr_row_ptr_D,
-                              csr_col_ind_D,
+                              nnzb_D,
+                              bsr_val_D,
+                              bsr_row_ptr_D,
+                              bsr_col_ind_D,
                               descr_C,
-                              csr_val_C,
-                              csr_row_ptr_C,
-                              csr_col_ind_C,
+                              bsr_val_C,
+                              bsr_row_ptr_C,
+                              bsr_col_ind_C,
                               info_C,
                               temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrgemm(rocsparse_handle                handle,
+rocsparse_status rocsparse_bsrgemm(rocsparse_handle                handle,
+                                   rocsparse_direction             dir,
                                    rocsparse_operation             trans_A,
                                    rocsparse_operation             trans_B,
-                                   rocsparse_int                   m,
-                                   rocsparse_int                   n,
-                                   rocsparse_int                   k,
+                                   rocsparse_int                   mb,
+                                   rocsparse_int                   nb,
+                                   rocsparse_int                   kb,
+                                   rocsparse_int                   block_dim,
                                    const rocsparse_double_complex* alpha,
                                    const rocsparse_mat_descr       descr_A,
-                                   rocsparse_int                   nnz_A,
-                                   const rocsparse_double_complex* csr_val_A,
-                                   const rocsparse_int*            csr_row_ptr_A,
-                                   const rocsparse_int*            csr_col_ind_A,
+                                   rocsparse_int                   nnzb_A,
+                                   const rocsparse_double_complex* bsr_val_A,
+                                   const rocsparse_int*            bsr_row_ptr_A,
+                                   const rocsparse_int*            bsr_col_ind_A,
                                    const rocsparse_mat_descr       descr_B,
-                                   rocsparse_int                   nnz_B,
-                                   const rocsparse_double_complex* csr_val_B,
-                                   const rocsparse_int*            csr_row_ptr_B,
-                                   const rocsparse_int*            csr_col_ind_B,
+                                   rocsparse_int                   nnzb_B,
+                                   const rocsparse_double_complex* bsr_val_B,
+                                   const rocsparse_int*            bsr_row_ptr_B,
+                                   const rocsparse_int*            bsr_col_ind_B,
                                    const rocsparse_double_complex* beta,
                                    const rocsparse_mat_descr       descr_D,
-                                   rocsparse_int                   nnz_D,
-                                   const rocsparse_double_complex* csr_val_D,
-                                   const rocsparse_int*            csr_row_ptr_D,
-                                   const rocsparse_int*            csr_col_ind_D,
+                                   rocsparse_int                   nnzb_D,
+                                   const rocsparse_double_complex* bsr_val_D,
+                                   const rocsparse_int*            bsr_row_ptr_D,
+                                   const rocsparse_int*            bsr_col_ind_D,
                                    const rocsparse_mat_descr       descr_C,
-                                   rocsparse_double_complex*       csr_val_C,
-                                   const rocsparse_int*            csr_row_ptr_C,
-                                   rocsparse_int*                  csr_col_ind_C,
+                                   rocsparse_double_complex*       bsr_val_C,
+                                   const rocsparse_int*            bsr_row_ptr_C,
+                                   rocsparse_int*                  bsr_col_ind_C,
                                    const rocsparse_mat_info        info_C,
                                    void*                           temp_buffer)
 {
-    return rocsparse_zcsrgemm(handle,
+    return rocsparse_zbsrgemm(handle,
+                              dir,
                               trans_A,
                               trans_B,
+                              mb,
+                              nb,
+                              kb,
+                              block_dim,
+                              alpha,
+                              descr_A,
+                              nnzb_A,
+                              bsr_val_A,
+                              bsr_row_ptr_A,
+                              bsr_col_ind_A,
+                              descr_B,
+                              nnzb_B,
+                              bsr_val_B,
+                              bsr_row_ptr_B,
+                              bsr_col_ind_B,
+                              beta,
+                              descr_D,
+                              nnzb_D,
+                              bsr_val_D,
+                              bsr_row_ptr_D,
+                              bsr_col_ind_D,
+                              descr_C,
+                              bsr_val_C,
+                              bsr_row_ptr_C,
+                              bsr_col_ind_C,
+                              info_C,
+                              temp_buffer);
+}
+
+// csrgeam
+template <>
+rocsparse_status rocsparse_csrgeam(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr_A,
+                                   rocsparse_int             nnz_A,
+                                   const float*              csr_val_A,
+                                   const rocsparse_int*      csr_row_ptr_A,
+                                   const rocsparse_int*      csr_col_ind_A,
+                                   const float*              beta,
+                                   const rocsparse_mat_descr descr_B,
+                                   rocsparse_int             nnz_B,
+                                   const float*              csr_val_B,
+                                   const rocsparse_int*      csr_row_ptr_B,
+                                   const rocsparse_int*      csr_col_ind_B,
+                                   const rocsparse_mat_descr descr_C,
+                                   float*                    csr_val_C,
+                                   const rocsparse_int*      csr_row_ptr_C,
+                                   rocsparse_int*            csr_col_ind_C)
+{
+    return rocsparse_scsrgeam(handle,
                               m,
                               n,
-                              k,
                               alpha,
                               descr_A,
                               nnz_A,
                               csr_val_A,
                               csr_row_ptr_A,
                               csr_col_ind_A,
+                              beta,
                               descr_B,
                               nnz_B,
                               csr_val_B,
                               csr_row_ptr_B,
                               csr_col_ind_B,
-                              beta,
-                              descr_D,
-                              nnz_D,
-                              csr_val_D,
-                              csr_row_ptr_D,
-                              csr_col_ind_D,
                               descr_C,
                               csr_val_C,
                               csr_row_ptr_C,
-                              csr_col_ind_C,
-                              info_C,
-                              temp_buffer);
+                              csr_col_ind_C);
 }
 
-/*
- * ===========================================================================
- *    precond SPARSE
- * ===========================================================================
- */
-// bsric0
 template <>
-rocsparse_status rocsparse_bsric0_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_direction       dir,
-                                              rocsparse_int             mb,
+rocsparse_status rocsparse_csrgeam(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr_A,
+                                   rocsparse_int             nnz_A,
+                                   const double*             csr_val_A,
+                                   const rocsparse_int*      csr_row_ptr_A,
+                                   const rocsparse_int*      csr_col_ind_A,
+                                   const double*             beta,
+                                   const rocsparse_mat_descr descr_B,
+                                   rocsparse_int             nnz_B,
+                                   const double*             csr_val_B,
+                                   const rocsparse_int*      csr_row_ptr_B,
+                                   const rocsparse_int*      csr_col_ind_B,
+                                   const rocsparse_mat_descr descr_C,
+                                   double*                   csr_val_C,
+                                   const rocsparse_int*      csr_row_ptr_C,
+                                   rocsparse_int*            csr_col_ind_C)
+{
+    return rocsparse_dcsrgeam(handle,
+                              m,
+                              n,
+                              alpha,
+                              descr_A,
+                              nnz_A,
+                              csr_val_A,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              beta,
+                              descr_B,
+                              nnz_B,
+                              csr_val_B,
+                              csr_row_ptr_B,
+                              csr_col_ind_B,
+                              descr_C,
+                              csr_val_C,
+                              csr_row_ptr_C,
+                              csr_col_ind_C);
+}
+
+template <>
+rocsparse_status rocsparse_csrgeam(rocsparse_handle               handle,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  n,
+                                   const rocsparse_float_complex* alpha,
+                                   const rocsparse_mat_descr      descr_A,
+                                   rocsparse_int                  nnz_A,
+                                   const rocsparse_float_complex* csr_val_A,
+                                   const rocsparse_int*           csr_row_ptr_A,
+                                   const rocsparse_int*           csr_col_ind_A,
+                                   const rocsparse_float_complex* beta,
+                                   const rocsparse_mat_descr      descr_B,
+                                   rocsparse_int                  nnz_B,
+                                   const rocsparse_float_complex* csr_val_B,
+                                   const rocsparse_int*           csr_row_ptr_B,
+                                   const rocsparse_int*           csr_col_ind_B,
+                                   const rocsparse_mat_descr      descr_C,
+                                   rocsparse_float_complex*       csr_val_C,
+                                   const rocsparse_int*           csr_row_ptr_C,
+                                   rocsparse_int*                 csr_col_ind_C)
+{
+    return rocsparse_ccsrgeam(handle,
+                              m,
+                              n,
+                              (const rocsparse_float_complex*)alpha,
+                              descr_A,
+                              nnz_A,
+                              (const rocsparse_float_complex*)csr_val_A,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              (const rocsparse_float_complex*)beta,
+                              descr_B,
+                              nnz_B,
+                              (const rocsparse_float_complex*)csr_val_B,
+                              csr_row_ptr_B,
+                              csr_col_ind_B,
+                              descr_C,
+                              (rocsparse_float_complex*)csr_val_C,
+                              csr_row_ptr_C,
+                              csr_col_ind_C);
+}
+
+template <>
+rocsparse_status rocsparse_csrgeam(rocsparse_handle                handle,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   n,
+                                   const rocsparse_double_complex* alpha,
+                                   const rocsparse_mat_descr       descr_A,
+                                   rocsparse_int                   nnz_A,
+                                   const rocsparse_double_complex* csr_val_A,
+                                   const rocsparse_int*            csr_row_ptr_A,
+                                   const rocsparse_int*            csr_col_ind_A,
+                                   const rocsparse_double_complex* beta,
+                                   const rocsparse_mat_descr       descr_B,
+                                   rocsparse_int                   nnz_B,
+                                   const rocsparse_double_complex* csr_val_B,
+                                   const rocsparse_int*            csr_row_ptr_B,
+                                   const rocsparse_int*            csr_col_ind_B,
+                                   const rocsparse_mat_descr       descr_C,
+                                   rocsparse_double_complex*       csr_val_C,
+                                   const rocsparse_int*            csr_row_ptr_C,
+                                   rocsparse_int*                  csr_col_ind_C)
+{
+    return rocsparse_zcsrgeam(handle,
+                              m,
+                              n,
+                              (const rocsparse_double_complex*)alpha,
+                              descr_A,
+                              nnz_A,
+                              (const rocsparse_double_complex*)csr_val_A,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              (const rocsparse_double_complex*)beta,
+                              descr_B,
+                              nnz_B,
+                              (const rocsparse_double_complex*)csr_val_B,
+                              csr_row_ptr_B,
+                              csr_col_ind_B,
+                              descr_C,
+                              (rocsparse_double_complex*)csr_val_C,
+                              csr_row_ptr_C,
+                              csr_col_ind_C);
+}
+
+// csrgeam_multi
+template <>
+rocsparse_status rocsparse_csrgeam_multi(rocsparse_handle            handle,
+                                         rocsparse_int               m,
+                                         rocsparse_int               n,
+                                         rocsparse_int               num_mat,
+                                         const float*                alpha,
+                                         const rocsparse_mat_descr*  descr_A,
+                                         const rocsparse_int*        nnz_A,
+                                         const float* const*         csr_val_A,
+                                         const rocsparse_int* const* csr_row_ptr_A,
+                                         const rocsparse_int* const* csr_col_ind_A,
+                                         const rocsparse_mat_descr   descr_C,
+                                         float*                      csr_val_C,
+                                         const rocsparse_int*        csr_row_ptr_C,
+                                         rocsparse_int*              csr_col_ind_C)
+{
+    return rocsparse_scsrgeam_multi(handle,
+                                    m,
+                                    n,
+                                    num_mat,
+                                    alpha,
+                                    descr_A,
+                                    nnz_A,
+                                    csr_val_A,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    descr_C,
+                                    csr_val_C,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C);
+}
+
+template <>
+rocsparse_status rocsparse_csrgeam_multi(rocsparse_handle            handle,
+                                         rocsparse_int               m,
+                                         rocsparse_int               n,
+                                         rocsparse_int               num_mat,
+                                         const double*               alpha,
+                                         const rocsparse_mat_descr*  descr_A,
+                                         const rocsparse_int*        nnz_A,
+                                         const double* const*        csr_val_A,
+                                         const rocsparse_int* const* csr_row_ptr_A,
+                                         const rocsparse_int* const* csr_col_ind_A,
+                                         const rocsparse_mat_descr   descr_C,
+                                         double*                     csr_val_C,
+                                         const rocsparse_int*        csr_row_ptr_C,
+                                         rocsparse_int*              csr_col_ind_C)
+{
+    return rocsparse_dcsrgeam_multi(handle,
+                                    m,
+                                    n,
+                                    num_mat,
+                                    alpha,
+                                    descr_A,
+                                    nnz_A,
+                                    csr_val_A,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    descr_C,
+                                    csr_val_C,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C);
+}
+
+template <>
+rocsparse_status rocsparse_csrgeam_multi(rocsparse_handle                      handle,
+                                         rocsparse_int                         m,
+                                         rocsparse_int                         n,
+                                         rocsparse_int                         num_mat,
+                                         const rocsparse_float_complex*        alpha,
+                                         const rocsparse_mat_descr*            descr_A,
+                                         const rocsparse_int*                  nnz_A,
+                                         const rocsparse_float_complex* const* csr_val_A,
+                                         const rocsparse_int* const*           csr_row_ptr_A,
+                                         const rocsparse_int* const*           csr_col_ind_A,
+                                         const rocsparse_mat_descr             descr_C,
+                                         rocsparse_float_complex*              csr_val_C,
+                                         const rocsparse_int*                  csr_row_ptr_C,
+                                         rocsparse_int*                        csr_col_ind_C)
+{
+    return rocsparse_ccsrgeam_multi(handle,
+                                    m,
+                                    n,
+                                    num_mat,
+                                    alpha,
+                                    descr_A,
+                                    nnz_A,
+                                    csr_val_A,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    descr_C,
+                                    csr_val_C,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C);
+}
+
+template <>
+rocsparse_status rocsparse_csrgeam_multi(rocsparse_handle                       handle,
+                                         rocsparse_int                          m,
+                                         rocsparse_int                          n,
+                                         rocsparse_int                          num_mat,
+                                         const rocsparse_double_complex*        alpha,
+                                         const rocsparse_mat_descr*             descr_A,
+                                         const rocsparse_int*                   nnz_A,
+                                         const rocsparse_double_complex* const* csr_val_A,
+                                         const rocsparse_int* const*            csr_row_ptr_A,
+                                         const rocsparse_int* const*            csr_col_ind_A,
+                                         const rocsparse_mat_descr              descr_C,
+                                         rocsparse_double_complex*              csr_val_C,
+                                         const rocsparse_int*                   csr_row_ptr_C,
+                                         rocsparse_int*                         csr_col_ind_C)
+{
+    return rocsparse_zcsrgeam_multi(handle,
+                                    m,
+                                    n,
+                                    num_mat,
+                                    alpha,
+                                    descr_A,
+                                    nnz_A,
+                                    csr_val_A,
+                                    csr_row_ptr_A,
+                                    csr_col_ind_A,
+                                    descr_C,
+                                    csr_val_C,
+                                    csr_row_ptr_C,
+                                    csr_col_ind_C);
+}
+
+// csrewise
+template <>
+rocsparse_status rocsparse_csrewise(rocsparse_handle          handle,
+                                    rocsparse_ewise_pattern   pattern,
+                                    rocsparse_ewise_op        op,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const float*              csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const float*              csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    float*                    csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C)
+{
+    return rocsparse_scsrewise(handle,
+                               pattern,
+                               op,
+                               m,
+                               n,
+                               descr_A,
+                               nnz_A,
+                               csr_val_A,
+                               csr_row_ptr_A,
+                               csr_col_ind_A,
+                               descr_B,
+                               nnz_B,
+                               csr_val_B,
+                               csr_row_ptr_B,
+                               csr_col_ind_B,
+                               descr_C,
+                               csr_val_C,
+                               csr_row_ptr_C,
+                               csr_col_ind_C);
+}
+
+template <>
+rocsparse_status rocsparse_csrewise(rocsparse_handle          handle,
+                                    rocsparse_ewise_pattern   pattern,
+                                    rocsparse_ewise_op        op,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const double*             csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const double*             csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    double*                   csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C)
+{
+    return rocsparse_dcsrewise(handle,
+                               pattern,
+                               op,
+                               m,
+                               n,
+                               descr_A,
+                               nnz_A,
+                               csr_val_A,
+                               csr_row_ptr_A,
+                               csr_col_ind_A,
+                               descr_B,
+                               nnz_B,
+                               csr_val_B,
+                               csr_row_ptr_B,
+                               csr_col_ind_B,
+                               descr_C,
+                               csr_val_C,
+                               csr_row_ptr_C,
+                               csr_col_ind_C);
+}
+
+template <>
+rocsparse_status rocsparse_csrewise(rocsparse_handle               handle,
+                                    rocsparse_ewise_pattern        pattern,
+                                    rocsparse_ewise_op             op,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    const rocsparse_mat_descr      descr_A,
+                                    rocsparse_int                  nnz_A,
+                                    const rocsparse_float_complex* csr_val_A,
+                                    const rocsparse_int*           csr_row_ptr_A,
+                                    const rocsparse_int*           csr_col_ind_A,
+                                    const rocsparse_mat_descr      descr_B,
+                                    rocsparse_int                  nnz_B,
+                                    const rocsparse_float_complex* csr_val_B,
+                                    const rocsparse_int*           csr_row_ptr_B,
+                                    const rocsparse_int*           csr_col_ind_B,
+                                    const rocsparse_mat_descr      descr_C,
+                                    rocsparse_float_complex*       csr_val_C,
+                                    const rocsparse_int*           csr_row_ptr_C,
+                                    rocsparse_int*                 csr_col_ind_C)
+{
+    return rocsparse_ccsrewise(handle,
+                               pattern,
+                               op,
+                               m,
+                               n,
+                               descr_A,
+                               nnz_A,
+                               csr_val_A,
+                               csr_row_ptr_A,
+                               csr_col_ind_A,
+                               descr_B,
+                               nnz_B,
+                               csr_val_B,
+                               csr_row_ptr_B,
+                               csr_col_ind_B,
+                               descr_C,
+                               csr_val_C,
+                               csr_row_ptr_C,
+                               csr_col_ind_C);
+}
+
+template <>
+rocsparse_status rocsparse_csrewise(rocsparse_handle                handle,
+                                    rocsparse_ewise_pattern         pattern,
+                                    rocsparse_ewise_op              op,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    const rocsparse_mat_descr       descr_A,
+                                    rocsparse_int                   nnz_A,
+                                    const rocsparse_double_complex* csr_val_A,
+                                    const rocsparse_int*            csr_row_ptr_A,
+                                    const rocsparse_int*            csr_col_ind_A,
+                                    const rocsparse_mat_descr       descr_B,
+                                    rocsparse_int                   nnz_B,
+                                    const rocsparse_double_complex* csr_val_B,
+                                    const rocsparse_int*            csr_row_ptr_B,
+                                    const rocsparse_int*            csr_col_ind_B,
+                                    const rocsparse_mat_descr       descr_C,
+                                    rocsparse_double_complex*       csr_val_C,
+                                    const rocsparse_int*            csr_row_ptr_C,
+                                    rocsparse_int*                  csr_col_ind_C)
+{
+    return rocsparse_zcsrewise(handle,
+                               pattern,
+                               op,
+                               m,
+                               n,
+                               descr_A,
+                               nnz_A,
+                               csr_val_A,
+                               csr_row_ptr_A,
+                               csr_col_ind_A,
+                               descr_B,
+                               nnz_B,
+                               csr_val_B,
+                               csr_row_ptr_B,
+                               csr_col_ind_B,
+                               descr_C,
+                               csr_val_C,
+                               csr_row_ptr_C,
+                               csr_col_ind_C);
+}
+
+// csrgemm
+template <>
+rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_operation       trans_A,
+                                               rocsparse_operation       trans_B,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             k,
+                                               const float*              alpha,
+                                               const rocsparse_mat_descr descr_A,
+                                               rocsparse_int             nnz_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const rocsparse_mat_descr descr_B,
+                                               rocsparse_int             nnz_B,
+                                               const rocsparse_int*      csr_row_ptr_B,
+                                               const rocsparse_int*      csr_col_ind_B,
+                                               const float*              beta,
+                                               const rocsparse_mat_descr descr_D,
+                                               rocsparse_int             nnz_D,
+                                               const rocsparse_int*      csr_row_ptr_D,
+                                               const rocsparse_int*      csr_col_ind_D,
+                                               rocsparse_mat_info        info_C,
+                                               size_t*                   buffer_size)
+{
+    return rocsparse_scsrgemm_buffer_size(handle,
+                                          trans_A,
+                                          trans_B,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          descr_A,
+                                          nnz_A,
+                                          csr_row_ptr_A,
+                                          csr_col_ind_A,
+                                          descr_B,
+                                          nnz_B,
+                                          csr_row_ptr_B,
+                                          csr_col_ind_B,
+                                          beta,
+                                          descr_D,
+                                          nnz_D,
+                                          csr_row_ptr_D,
+                                          csr_col_ind_D,
+                                          info_C,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_operation       trans_A,
+                                               rocsparse_operation       trans_B,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             k,
+                                               const double*             alpha,
+                                               const rocsparse_mat_descr descr_A,
+                                               rocsparse_int             nnz_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const rocsparse_mat_descr descr_B,
+                                               rocsparse_int             nnz_B,
+                                               const rocsparse_int*      csr_row_ptr_B,
+                                               const rocsparse_int*      csr_col_ind_B,
+                                               const double*             beta,
+                                               const rocsparse_mat_descr descr_D,
+                                               rocsparse_int             nnz_D,
+                                               const rocsparse_int*      csr_row_ptr_D,
+                                               const rocsparse_int*      csr_col_ind_D,
+                                               rocsparse_mat_info        info_C,
+                                               size_t*                   buffer_size)
+{
+    return rocsparse_dcsrgemm_buffer_size(handle,
+                                          trans_A,
+                                          trans_B,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          descr_A,
+                                          nnz_A,
+                                          csr_row_ptr_A,
+                                          csr_col_ind_A,
+                                          descr_B,
+                                          nnz_B,
+                                          csr_row_ptr_B,
+                                          csr_col_ind_B,
+                                          beta,
+                                          descr_D,
+                                          nnz_D,
+                                          csr_row_ptr_D,
+                                          csr_col_ind_D,
+                                          info_C,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_operation            trans_A,
+                                               rocsparse_operation            trans_B,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  n,
+                                               rocsparse_int                  k,
+                                               const rocsparse_float_complex* alpha,
+                                               const rocsparse_mat_descr      descr_A,
+                                               rocsparse_int                  nnz_A,
+                                               const rocsparse_int*           csr_row_ptr_A,
+                                               const rocsparse_int*           csr_col_ind_A,
+                                               const rocsparse_mat_descr      descr_B,
+                                               rocsparse_int                  nnz_B,
+                                               const rocsparse_int*           csr_row_ptr_B,
+                                               const rocsparse_int*           csr_col_ind_B,
+                                               const rocsparse_float_complex* beta,
+                                               const rocsparse_mat_descr      descr_D,
+                                               rocsparse_int                  nnz_D,
+                                               const rocsparse_int*           csr_row_ptr_D,
+                                               const rocsparse_int*           csr_col_ind_D,
+                                               rocsparse_mat_info             info_C,
+                                               size_t*                        buffer_size)
+{
+    return rocsparse_ccsrgemm_buffer_size(handle,
+                                          trans_A,
+                                          trans_B,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          descr_A,
+                                          nnz_A,
+                                          csr_row_ptr_A,
+                                          csr_col_ind_A,
+                                          descr_B,
+                                          nnz_B,
+                                          csr_row_ptr_B,
+                                          csr_col_ind_B,
+                                          beta,
+                                          descr_D,
+                                          nnz_D,
+                                          csr_row_ptr_D,
+                                          csr_col_ind_D,
+                                          info_C,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_operation             trans_A,
+                                               rocsparse_operation             trans_B,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   n,
+                                               rocsparse_int                   k,
+                                               const rocsparse_double_complex* alpha,
+                                               const rocsparse_mat_descr       descr_A,
+                                               rocsparse_int                   nnz_A,
+                                               const rocsparse_int*            csr_row_ptr_A,
+                                               const rocsparse_int*            csr_col_ind_A,
+                                               const rocsparse_mat_descr       descr_B,
+                                               rocsparse_int                   nnz_B,
+                                               const rocsparse_int*            csr_row_ptr_B,
+                                               const rocsparse_int*            csr_col_ind_B,
+                                               const rocsparse_double_complex* beta,
+                                               const rocsparse_mat_descr       descr_D,
+                                               rocsparse_int                   nnz_D,
+                                               const rocsparse_int*            csr_row_ptr_D,
+                                               const rocsparse_int*            csr_col_ind_D,
+                                               rocsparse_mat_info              info_C,
+                                               size_t*                         buffer_size)
+{
+    return rocsparse_zcsrgemm_buffer_size(handle,
+                                          trans_A,
+                                          trans_B,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          descr_A,
+                                          nnz_A,
+                                          csr_row_ptr_A,
+                                          csr_col_ind_A,
+                                          descr_B,
+                                          nnz_B,
+                                          csr_row_ptr_B,
+                                          csr_col_ind_B,
+                                          beta,
+                                          descr_D,
+                                          nnz_D,
+                                          csr_row_ptr_D,
+                                          csr_col_ind_D,
+                                          info_C,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
+                                   rocsparse_operation       trans_A,
+                                   rocsparse_operation       trans_B,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             k,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr_A,
+                                   rocsparse_int             nnz_A,
+                                   const float*              csr_val_A,
+                                   const rocsparse_int*      csr_row_ptr_A,
+                                   const rocsparse_int*      csr_col_ind_A,
+                                   const rocsparse_mat_descr descr_B,
+                                   rocsparse_int             nnz_B,
+                                   const float*              csr_val_B,
+                                   const rocsparse_int*      csr_row_ptr_B,
+                                   const rocsparse_int*      csr_col_ind_B,
+                                   const float*              beta,
+                                   const rocsparse_mat_descr descr_D,
+                                   rocsparse_int             nnz_D,
+                                   const float*              csr_val_D,
+                                   const rocsparse_int*      csr_row_ptr_D,
+                                   const rocsparse_int*      csr_col_ind_D,
+                                   const rocsparse_mat_descr descr_C,
+                                   float*                    csr_val_C,
+                                   const rocsparse_int*      csr_row_ptr_C,
+                                   rocsparse_int*            csr_col_ind_C,
+                                   const rocsparse_mat_info  info_C,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_scsrgemm(handle,
+                              trans_A,
+                              trans_B,
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              descr_A,
+                              nnz_A,
+                              csr_val_A,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              descr_B,
+                              nnz_B,
+                              csr_val_B,
+                              csr_row_ptr_B,
+                              csr_col_ind_B,
+                              beta,
+                              descr_D,
+                              nnz_D,
+                              csr_val_D,
+                              csr_row_ptr_D,
+                              csr_col_ind_D,
+                              descr_C,
+                              csr_val_C,
+                              csr_row_ptr_C,
+                              csr_col_ind_C,
+                              info_C,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
+                                   rocsparse_operation       trans_A,
+                                   rocsparse_operation       trans_B,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             k,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr_A,
+                                   rocsparse_int             nnz_A,
+                                   const double*             csr_val_A,
+                                   const rocsparse_int*      csr_row_ptr_A,
+                                   const rocsparse_int*      csr_col_ind_A,
+                                   const rocsparse_mat_descr descr_B,
+                                   rocsparse_int             nnz_B,
+                                   const double*             csr_val_B,
+                                   const rocsparse_int*      csr_row_ptr_B,
+                                   const rocsparse_int*      csr_col_ind_B,
+                                   const double*             beta,
+                                   const rocsparse_mat_descr descr_D,
+                                   rocsparse_int             nnz_D,
+                                   const double*             csr_val_D,
+                                   const rocsparse_int*      csr_row_ptr_D,
+                                   const rocsparse_int*      csr_col_ind_D,
+                                   const rocsparse_mat_descr descr_C,
+                                   double*                   csr_val_C,
+                                   const rocsparse_int*      csr_row_ptr_C,
+                                   rocsparse_int*            csr_col_ind_C,
+                                   const rocsparse_mat_info  info_C,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_dcsrgemm(handle,
+                              trans_A,
+                              trans_B,
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              descr_A,
+                              nnz_A,
+                              csr_val_A,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              descr_B,
+                              nnz_B,
+                              csr_val_B,
+                              csr_row_ptr_B,
+                              csr_col_ind_B,
+                              beta,
+                              descr_D,
+                              nnz_D,
+                              csr_val_D,
+                              csr_row_ptr_D,
+                              csr_col_ind_D,
+                              descr_C,
+                              csr_val_C,
+                              csr_row_ptr_C,
+                              csr_col_ind_C,
+                              info_C,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm(rocsparse_handle               handle,
+                                   rocsparse_operation            trans_A,
+                                   rocsparse_operation            trans_B,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  n,
+                                   rocsparse_int                  k,
+                                   const rocsparse_float_complex* alpha,
+                                   const rocsparse_mat_descr      descr_A,
+                                   rocsparse_int                  nnz_A,
+                                   const rocsparse_float_complex* csr_val_A,
+                                   const rocsparse_int*           csr_row_ptr_A,
+                                   const rocsparse_int*           csr_col_ind_A,
+                                   const rocsparse_mat_descr      descr_B,
+                                   rocsparse_int                  nnz_B,
+                                   const rocsparse_float_complex* csr_val_B,
+                                   const rocsparse_int*           csr_row_ptr_B,
+                                   const rocsparse_int*           csr_col_ind_B,
+                                   const rocsparse_float_complex* beta,
+                                   const rocsparse_mat_descr      descr_D,
+                                   rocsparse_int                  nnz_D,
+                                   const rocsparse_float_complex* csr_val_D,
+                                   const rocsparse_int*           csr_row_ptr_D,
+                                   const rocsparse_int*           csr_col_ind_D,
+                                   const rocsparse_mat_descr      descr_C,
+                                   rocsparse_float_complex*       csr_val_C,
+                                   const rocsparse_int*           csr_row_ptr_C,
+                                   rocsparse_int*                 csr_col_ind_C,
+                                   const rocsparse_mat_info       info_C,
+                                   void*                          temp_buffer)
+{
+    return rocsparse_ccsrgemm(handle,
+                              trans_A,
+                              trans_B,
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              descr_A,
+                              nnz_A,
+                              csr_val_A,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              descr_B,
+                              nnz_B,
+                              csr_val_B,
+                              csr_row_ptr_B,
+                              csr_col_ind_B,
+                              beta,
+                              descr_D,
+                              nnz_D,
+                              csr_val_D,
+                              csr_row_ptr_D,
+                              csr_col_ind_D,
+                              descr_C,
+                              csr_val_C,
+                              csr_row_ptr_C,
+                              csr_col_ind_C,
+                              info_C,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm(rocsparse_handle                handle,
+                                   rocsparse_operation             trans_A,
+                                   rocsparse_operation             trans_B,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   n,
+                                   rocsparse_int                   k,
+                                   const rocsparse_double_complex* alpha,
+                                   const rocsparse_mat_descr       descr_A,
+                                   rocsparse_int                   nnz_A,
+                                   const rocsparse_double_complex* csr_val_A,
+                                   const rocsparse_int*            csr_row_ptr_A,
+                                   const rocsparse_int*            csr_col_ind_A,
+                                   const rocsparse_mat_descr       descr_B,
+                                   rocsparse_int                   nnz_B,
+                                   const rocsparse_double_complex* csr_val_B,
+                                   const rocsparse_int*            csr_row_ptr_B,
+                                   const rocsparse_int*            csr_col_ind_B,
+                                   const rocsparse_double_complex* beta,
+                                   const rocsparse_mat_descr       descr_D,
+                                   rocsparse_int                   nnz_D,
+                                   const rocsparse_double_complex* csr_val_D,
+                                   const rocsparse_int*            csr_row_ptr_D,
+                                   const rocsparse_int*            csr_col_ind_D,
+                                   const rocsparse_mat_descr       descr_C,
+                                   rocsparse_double_complex*       csr_val_C,
+                                   const rocsparse_int*            csr_row_ptr_C,
+                                   rocsparse_int*                  csr_col_ind_C,
+                                   const rocsparse_mat_info        info_C,
+                                   void*                           temp_buffer)
+{
+    return rocsparse_zcsrgemm(handle,
+                              trans_A,
+                              trans_B,
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              descr_A,
+                              nnz_A,
+                              csr_val_A,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              descr_B,
+                              nnz_B,
+                              csr_val_B,
+                              csr_row_ptr_B,
+                              csr_col_ind_B,
+                              beta,
+                              descr_D,
+                              nnz_D,
+                              csr_val_D,
+                              csr_row_ptr_D,
+                              csr_col_ind_D,
+                              descr_C,
+                              csr_val_C,
+                              csr_row_ptr_C,
+                              csr_col_ind_C,
+                              info_C,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_chunked(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const float*              csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_B,
+                                           rocsparse_int             nnz_B,
+                                           const float*              csr_val_B,
+                                           const rocsparse_int*      csr_row_ptr_B,
+                                           const rocsparse_int*      csr_col_ind_B,
+                                           const float*              beta,
+                                           const rocsparse_mat_descr descr_D,
+                                           rocsparse_int             nnz_D,
+                                           const float*              csr_val_D,
+                                           const rocsparse_int*      csr_row_ptr_D,
+                                           const rocsparse_int*      csr_col_ind_D,
+                                           const rocsparse_mat_descr descr_C,
+                                           float*                    csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           rocsparse_int*            csr_col_ind_C,
+                                           const rocsparse_mat_info  info_C,
+                                           size_t                    panel_buffer_size,
+                                           void*                     panel_buffer,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_scsrgemm_chunked(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      panel_buffer_size,
+                                      panel_buffer,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_chunked(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const double*             csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_B,
+                                           rocsparse_int             nnz_B,
+                                           const double*             csr_val_B,
+                                           const rocsparse_int*      csr_row_ptr_B,
+                                           const rocsparse_int*      csr_col_ind_B,
+                                           const double*             beta,
+                                           const rocsparse_mat_descr descr_D,
+                                           rocsparse_int             nnz_D,
+                                           const double*             csr_val_D,
+                                           const rocsparse_int*      csr_row_ptr_D,
+                                           const rocsparse_int*      csr_col_ind_D,
+                                           const rocsparse_mat_descr descr_C,
+                                           double*                   csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           rocsparse_int*            csr_col_ind_C,
+                                           const rocsparse_mat_info  info_C,
+                                           size_t                    panel_buffer_size,
+                                           void*                     panel_buffer,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_dcsrgemm_chunked(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      panel_buffer_size,
+                                      panel_buffer,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_chunked(rocsparse_handle               handle,
+                                           rocsparse_operation            trans_A,
+                                           rocsparse_operation            trans_B,
+                                           rocsparse_int                  m,
+                                           rocsparse_int                  n,
+                                           rocsparse_int                  k,
+                                           const rocsparse_float_complex* alpha,
+                                           const rocsparse_mat_descr      descr_A,
+                                           rocsparse_int                  nnz_A,
+                                           const rocsparse_float_complex* csr_val_A,
+                                           const rocsparse_int*           csr_row_ptr_A,
+                                           const rocsparse_int*           csr_col_ind_A,
+                                           const rocsparse_mat_descr      descr_B,
+                                           rocsparse_int                  nnz_B,
+                                           const rocsparse_float_complex* csr_val_B,
+                                           const rocsparse_int*           csr_row_ptr_B,
+                                           const rocsparse_int*           csr_col_ind_B,
+                                           const rocsparse_float_complex* beta,
+                                           const rocsparse_mat_descr      descr_D,
+                                           rocsparse_int                  nnz_D,
+                                           const rocsparse_float_complex* csr_val_D,
+                                           const rocsparse_int*           csr_row_ptr_D,
+                                           const rocsparse_int*           csr_col_ind_D,
+                                           const rocsparse_mat_descr      descr_C,
+                                           rocsparse_float_complex*       csr_val_C,
+                                           const rocsparse_int*           csr_row_ptr_C,
+                                           rocsparse_int*                 csr_col_ind_C,
+                                           const rocsparse_mat_info       info_C,
+                                           size_t                         panel_buffer_size,
+                                           void*                          panel_buffer,
+                                           void*                          temp_buffer)
+{
+    return rocsparse_ccsrgemm_chunked(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      panel_buffer_size,
+                                      panel_buffer,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_chunked(rocsparse_handle                handle,
+                                           rocsparse_operation             trans_A,
+                                           rocsparse_operation             trans_B,
+                                           rocsparse_int                   m,
+                                           rocsparse_int                   n,
+                                           rocsparse_int                   k,
+                                           const rocsparse_double_complex* alpha,
+                                           const rocsparse_mat_descr       descr_A,
+                                           rocsparse_int                   nnz_A,
+                                           const rocsparse_double_complex* csr_val_A,
+                                           const rocsparse_int*            csr_row_ptr_A,
+                                           const rocsparse_int*            csr_col_ind_A,
+                                           const rocsparse_mat_descr       descr_B,
+                                           rocsparse_int                   nnz_B,
+                                           const rocsparse_double_complex* csr_val_B,
+                                           const rocsparse_int*            csr_row_ptr_B,
+                                           const rocsparse_int*            csr_col_ind_B,
+                                           const rocsparse_double_complex* beta,
+                                           const rocsparse_mat_descr       descr_D,
+                                           rocsparse_int                   nnz_D,
+                                           const rocsparse_double_complex* csr_val_D,
+                                           const rocsparse_int*            csr_row_ptr_D,
+                                           const rocsparse_int*            csr_col_ind_D,
+                                           const rocsparse_mat_descr       descr_C,
+                                           rocsparse_double_complex*       csr_val_C,
+                                           const rocsparse_int*            csr_row_ptr_C,
+                                           rocsparse_int*                  csr_col_ind_C,
+                                           const rocsparse_mat_info        info_C,
+                                           size_t                          panel_buffer_size,
+                                           void*                           panel_buffer,
+                                           void*                           temp_buffer)
+{
+    return rocsparse_zcsrgemm_chunked(handle,
+                                      trans_A,
+                                      trans_B,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_A,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_B,
+                                      csr_row_ptr_B,
+                                      csr_col_ind_B,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      panel_buffer_size,
+                                      panel_buffer,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_masked(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             k,
+                                          const float*              alpha,
+                                          const rocsparse_mat_descr descr_A,
+                                          rocsparse_int             nnz_A,
+                                          const float*              csr_val_A,
+                                          const rocsparse_int*      csr_row_ptr_A,
+                                          const rocsparse_int*      csr_col_ind_A,
+                                          const rocsparse_mat_descr descr_B,
+                                          rocsparse_int             nnz_B,
+                                          const float*              csr_val_B,
+                                          const rocsparse_int*      csr_row_ptr_B,
+                                          const rocsparse_int*      csr_col_ind_B,
+                                          const rocsparse_mat_descr descr_M,
+                                          rocsparse_int             nnz_M,
+                                          const rocsparse_int*      csr_row_ptr_M,
+                                          const rocsparse_int*      csr_col_ind_M,
+                                          rocsparse_mask_type       mask_type,
+                                          const rocsparse_mat_descr descr_C,
+                                          float*                    csr_val_C,
+                                          const rocsparse_int*      csr_row_ptr_C,
+                                          rocsparse_int*            csr_col_ind_C,
+                                          const rocsparse_mat_info  info_C,
+                                          void*                     temp_buffer)
+{
+    return rocsparse_scsrgemm_masked(handle,
+                                     trans_A,
+                                     trans_B,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     descr_A,
+                                     nnz_A,
+                                     csr_val_A,
+                                     csr_row_ptr_A,
+                                     csr_col_ind_A,
+                                     descr_B,
+                                     nnz_B,
+                                     csr_val_B,
+                                     csr_row_ptr_B,
+                                     csr_col_ind_B,
+                                     descr_M,
+                                     nnz_M,
+                                     csr_row_ptr_M,
+                                     csr_col_ind_M,
+                                     mask_type,
+                                     descr_C,
+                                     csr_val_C,
+                                     csr_row_ptr_C,
+                                     csr_col_ind_C,
+                                     info_C,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_masked(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             k,
+                                          const double*             alpha,
+                                          const rocsparse_mat_descr descr_A,
+                                          rocsparse_int             nnz_A,
+                                          const double*             csr_val_A,
+                                          const rocsparse_int*      csr_row_ptr_A,
+                                          const rocsparse_int*      csr_col_ind_A,
+                                          const rocsparse_mat_descr descr_B,
+                                          rocsparse_int             nnz_B,
+                                          const double*             csr_val_B,
+                                          const rocsparse_int*      csr_row_ptr_B,
+                                          const rocsparse_int*      csr_col_ind_B,
+                                          const rocsparse_mat_descr descr_M,
+                                          rocsparse_int             nnz_M,
+                                          const rocsparse_int*      csr_row_ptr_M,
+                                          const rocsparse_int*      csr_col_ind_M,
+                                          rocsparse_mask_type       mask_type,
+                                          const rocsparse_mat_descr descr_C,
+                                          double*                   csr_val_C,
+                                          const rocsparse_int*      csr_row_ptr_C,
+                                          rocsparse_int*            csr_col_ind_C,
+                                          const rocsparse_mat_info  info_C,
+                                          void*                     temp_buffer)
+{
+    return rocsparse_dcsrgemm_masked(handle,
+                                     trans_A,
+                                     trans_B,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     descr_A,
+                                     nnz_A,
+                                     csr_val_A,
+                                     csr_row_ptr_A,
+                                     csr_col_ind_A,
+                                     descr_B,
+                                     nnz_B,
+                                     csr_val_B,
+                                     csr_row_ptr_B,
+                                     csr_col_ind_B,
+                                     descr_M,
+                                     nnz_M,
+                                     csr_row_ptr_M,
+                                     csr_col_ind_M,
+                                     mask_type,
+                                     descr_C,
+                                     csr_val_C,
+                                     csr_row_ptr_C,
+                                     csr_col_ind_C,
+                                     info_C,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_masked(rocsparse_handle               handle,
+                                          rocsparse_operation            trans_A,
+                                          rocsparse_operation            trans_B,
+                                          rocsparse_int                  m,
+                                          rocsparse_int                  n,
+                                          rocsparse_int                  k,
+                                          const rocsparse_float_complex* alpha,
+                                          const rocsparse_mat_descr      descr_A,
+                                          rocsparse_int                  nnz_A,
+                                          const rocsparse_float_complex* csr_val_A,
+                                          const rocsparse_int*           csr_row_ptr_A,
+                                          const rocsparse_int*           csr_col_ind_A,
+                                          const rocsparse_mat_descr      descr_B,
+                                          rocsparse_int                  nnz_B,
+                                          const rocsparse_float_complex* csr_val_B,
+                                          const rocsparse_int*           csr_row_ptr_B,
+                                          const rocsparse_int*           csr_col_ind_B,
+                                          const rocsparse_mat_descr      descr_M,
+                                          rocsparse_int                  nnz_M,
+                                          const rocsparse_int*           csr_row_ptr_M,
+                                          const rocsparse_int*           csr_col_ind_M,
+                                          rocsparse_mask_type            mask_type,
+                                          const rocsparse_mat_descr      descr_C,
+                                          rocsparse_float_complex*       csr_val_C,
+                                          const rocsparse_int*           csr_row_ptr_C,
+                                          rocsparse_int*                 csr_col_ind_C,
+                                          const rocsparse_mat_info       info_C,
+                                          void*                          temp_buffer)
+{
+    return rocsparse_ccsrgemm_masked(handle,
+                                     trans_A,
+                                     trans_B,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     descr_A,
+                                     nnz_A,
+                                     csr_val_A,
+                                     csr_row_ptr_A,
+                                     csr_col_ind_A,
+                                     descr_B,
+                                     nnz_B,
+                                     csr_val_B,
+                                     csr_row_ptr_B,
+                                     csr_col_ind_B,
+                                     descr_M,
+                                     nnz_M,
+                                     csr_row_ptr_M,
+                                     csr_col_ind_M,
+                                     mask_type,
+                                     descr_C,
+                                     csr_val_C,
+                                     csr_row_ptr_C,
+                                     csr_col_ind_C,
+                                     info_C,
+                                     temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrgemm_masked(rocsparse_handle                handle,
+                                          rocsparse_operation             trans_A,
+                                          rocsparse_operation             trans_B,
+                                          rocsparse_int                   m,
+                                          rocsparse_int                   n,
+                                          rocsparse_int                   k,
+                                          const rocsparse_double_complex* alpha,
+                                          const rocsparse_mat_descr       descr_A,
+                                          rocsparse_int                   nnz_A,
+                                          const rocsparse_double_complex* csr_val_A,
+                                          const rocsparse_int*            csr_row_ptr_A,
+                                          const rocsparse_int*            csr_col_ind_A,
+                                          const rocsparse_mat_descr       descr_B,
+                                          rocsparse_int                   nnz_B,
+                                          const rocsparse_double_complex* csr_val_B,
+                                          const rocsparse_int*            csr_row_ptr_B,
+                                          const rocsparse_int*            csr_col_ind_B,
+                                          const rocsparse_mat_descr       descr_M,
+                                          rocsparse_int                   nnz_M,
+                                          const rocsparse_int*            csr_row_ptr_M,
+                                          const rocsparse_int*            csr_col_ind_M,
+                                          rocsparse_mask_type             mask_type,
+                                          const rocsparse_mat_descr       descr_C,
+                                          rocsparse_double_complex*       csr_val_C,
+                                          const rocsparse_int*            csr_row_ptr_C,
+                                          rocsparse_int*                  csr_col_ind_C,
+                                          const rocsparse_mat_info        info_C,
+                                          void*                           temp_buffer)
+{
+    return rocsparse_zcsrgemm_masked(handle,
+                                     trans_A,
+                                     trans_B,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     descr_A,
+                                     nnz_A,
+                                     csr_val_A,
+                                     csr_row_ptr_A,
+                                     csr_col_ind_A,
+                                     descr_B,
+                                     nnz_B,
+                                     csr_val_B,
+                                     csr_row_ptr_B,
+                                     csr_col_ind_B,
+                                     descr_M,
+                                     nnz_M,
+                                     csr_row_ptr_M,
+                                     csr_col_ind_M,
+                                     mask_type,
+                                     descr_C,
+                                     csr_val_C,
+                                     csr_row_ptr_C,
+                                     csr_col_ind_C,
+                                     info_C,
+                                     temp_buffer);
+}
+
+// csrrap
+template <>
+rocsparse_status rocsparse_csrrap_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_R,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              const float*              alpha,
+                                              const rocsparse_mat_descr descr_R,
+                                              rocsparse_int             nnz_R,
+                                              const rocsparse_int*      csr_row_ptr_R,
+                                              const rocsparse_int*      csr_col_ind_R,
+                                              const rocsparse_mat_descr descr_A,
+                                              rocsparse_int             nnz_A,
+                                              const rocsparse_int*      csr_row_ptr_A,
+                                              const rocsparse_int*      csr_col_ind_A,
+                                              const rocsparse_mat_descr descr_P,
+                                              rocsparse_int             nnz_P,
+                                              const rocsparse_int*      csr_row_ptr_P,
+                                              const rocsparse_int*      csr_col_ind_P,
+                                              rocsparse_mat_info        info_C,
+                                              size_t*                   buffer_size)
+{
+    return rocsparse_scsrrap_buffer_size(handle,
+                                         trans_R,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         descr_R,
+                                         nnz_R,
+                                         csr_row_ptr_R,
+                                         csr_col_ind_R,
+                                         descr_A,
+                                         nnz_A,
+                                         csr_row_ptr_A,
+                                         csr_col_ind_A,
+                                         descr_P,
+                                         nnz_P,
+                                         csr_row_ptr_P,
+                                         csr_col_ind_P,
+                                         info_C,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrrap_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_R,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              const double*             alpha,
+                                              const rocsparse_mat_descr descr_R,
+                                              rocsparse_int             nnz_R,
+                                              const rocsparse_int*      csr_row_ptr_R,
+                                              const rocsparse_int*      csr_col_ind_R,
+                                              const rocsparse_mat_descr descr_A,
+                                              rocsparse_int             nnz_A,
+                                              const rocsparse_int*      csr_row_ptr_A,
+                                              const rocsparse_int*      csr_col_ind_A,
+                                              const rocsparse_mat_descr descr_P,
+                                              rocsparse_int             nnz_P,
+                                              const rocsparse_int*      csr_row_ptr_P,
+                                              const rocsparse_int*      csr_col_ind_P,
+                                              rocsparse_mat_info        info_C,
+                                              size_t*                   buffer_size)
+{
+    return rocsparse_dcsrrap_buffer_size(handle,
+                                         trans_R,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         descr_R,
+                                         nnz_R,
+                                         csr_row_ptr_R,
+                                         csr_col_ind_R,
+                                         descr_A,
+                                         nnz_A,
+                                         csr_row_ptr_A,
+                                         csr_col_ind_A,
+                                         descr_P,
+                                         nnz_P,
+                                         csr_row_ptr_P,
+                                         csr_col_ind_P,
+                                         info_C,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrrap_buffer_size(rocsparse_handle               handle,
+                                              rocsparse_operation            trans_R,
+                                              rocsparse_int                  m,
+                                              rocsparse_int                  n,
+                                              rocsparse_int                  k,
+                                              const rocsparse_float_complex* alpha,
+                                              const rocsparse_mat_descr      descr_R,
+                                              rocsparse_int                  nnz_R,
+                                              const rocsparse_int*           csr_row_ptr_R,
+                                              const rocsparse_int*           csr_col_ind_R,
+                                              const rocsparse_mat_descr      descr_A,
+                                              rocsparse_int                  nnz_A,
+                                              const rocsparse_int*           csr_row_ptr_A,
+                                              const rocsparse_int*           csr_col_ind_A,
+                                              const rocsparse_mat_descr      descr_P,
+                                              rocsparse_int                  nnz_P,
+                                              const rocsparse_int*           csr_row_ptr_P,
+                                              const rocsparse_int*           csr_col_ind_P,
+                                              rocsparse_mat_info             info_C,
+                                              size_t*                        buffer_size)
+{
+    return rocsparse_ccsrrap_buffer_size(handle,
+                                         trans_R,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         descr_R,
+                                         nnz_R,
+                                         csr_row_ptr_R,
+                                         csr_col_ind_R,
+                                         descr_A,
+                                         nnz_A,
+                                         csr_row_ptr_A,
+                                         csr_col_ind_A,
+                                         descr_P,
+                                         nnz_P,
+                                         csr_row_ptr_P,
+                                         csr_col_ind_P,
+                                         info_C,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrrap_buffer_size(rocsparse_handle                handle,
+                                              rocsparse_operation             trans_R,
+                                              rocsparse_int                   m,
+                                              rocsparse_int                   n,
+                                              rocsparse_int                   k,
+                                              const rocsparse_double_complex* alpha,
+                                              const rocsparse_mat_descr       descr_R,
+                                              rocsparse_int                   nnz_R,
+                                              const rocsparse_int*            csr_row_ptr_R,
+                                              const rocsparse_int*            csr_col_ind_R,
+                                              const rocsparse_mat_descr       descr_A,
+                                              rocsparse_int                   nnz_A,
+                                              const rocsparse_int*            csr_row_ptr_A,
+                                              const rocsparse_int*            csr_col_ind_A,
+                                              const rocsparse_mat_descr       descr_P,
+                                              rocsparse_int                   nnz_P,
+                                              const rocsparse_int*            csr_row_ptr_P,
+                                              const rocsparse_int*            csr_col_ind_P,
+                                              rocsparse_mat_info              info_C,
+                                              size_t*                         buffer_size)
+{
+    return rocsparse_zcsrrap_buffer_size(handle,
+                                         trans_R,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         descr_R,
+                                         nnz_R,
+                                         csr_row_ptr_R,
+                                         csr_col_ind_R,
+                                         descr_A,
+                                         nnz_A,
+                                         csr_row_ptr_A,
+                                         csr_col_ind_A,
+                                         descr_P,
+                                         nnz_P,
+                                         csr_row_ptr_P,
+                                         csr_col_ind_P,
+                                         info_C,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csrrap(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_R,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  const float*              alpha,
+                                  const rocsparse_mat_descr descr_R,
+                                  rocsparse_int             nnz_R,
+                                  const float*              csr_val_R,
+                                  const rocsparse_int*      csr_row_ptr_R,
+                                  const rocsparse_int*      csr_col_ind_R,
+                                  const rocsparse_mat_descr descr_A,
+                                  rocsparse_int             nnz_A,
+                                  const float*              csr_val_A,
+                                  const rocsparse_int*      csr_row_ptr_A,
+                                  const rocsparse_int*      csr_col_ind_A,
+                                  const rocsparse_mat_descr descr_P,
+                                  rocsparse_int             nnz_P,
+                                  const float*              csr_val_P,
+                                  const rocsparse_int*      csr_row_ptr_P,
+                                  const rocsparse_int*      csr_col_ind_P,
+                                  const rocsparse_mat_descr descr_C,
+                                  float*                    csr_val_C,
+                                  const rocsparse_int*      csr_row_ptr_C,
+                                  rocsparse_int*            csr_col_ind_C,
+                                  const rocsparse_mat_info  info_C,
+                                  void*                     temp_buffer)
+{
+    return rocsparse_scsrrap(handle,
+                             trans_R,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             descr_R,
+                             nnz_R,
+                             csr_val_R,
+                             csr_row_ptr_R,
+                             csr_col_ind_R,
+                             descr_A,
+                             nnz_A,
+                             csr_val_A,
+                             csr_row_ptr_A,
+                             csr_col_ind_A,
+                             descr_P,
+                             nnz_P,
+                             csr_val_P,
+                             csr_row_ptr_P,
+                             csr_col_ind_P,
+                             descr_C,
+                             csr_val_C,
+                             csr_row_ptr_C,
+                             csr_col_ind_C,
+                             info_C,
+                             temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrrap(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_R,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  const double*             alpha,
+                                  const rocsparse_mat_descr descr_R,
+                                  rocsparse_int             nnz_R,
+                                  const double*             csr_val_R,
+                                  const rocsparse_int*      csr_row_ptr_R,
+                                  const rocsparse_int*      csr_col_ind_R,
+                                  const rocsparse_mat_descr descr_A,
+                                  rocsparse_int             nnz_A,
+                                  const double*             csr_val_A,
+                                  const rocsparse_int*      csr_row_ptr_A,
+                                  const rocsparse_int*      csr_col_ind_A,
+                                  const rocsparse_mat_descr descr_P,
+                                  rocsparse_int             nnz_P,
+                                  const double*             csr_val_P,
+                                  const rocsparse_int*      csr_row_ptr_P,
+                                  const rocsparse_int*      csr_col_ind_P,
+                                  const rocsparse_mat_descr descr_C,
+                                  double*                   csr_val_C,
+                                  const rocsparse_int*      csr_row_ptr_C,
+                                  rocsparse_int*            csr_col_ind_C,
+                                  const rocsparse_mat_info  info_C,
+                                  void*                     temp_buffer)
+{
+    return rocsparse_dcsrrap(handle,
+                             trans_R,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             descr_R,
+                             nnz_R,
+                             csr_val_R,
+                             csr_row_ptr_R,
+                             csr_col_ind_R,
+                             descr_A,
+                             nnz_A,
+                             csr_val_A,
+                             csr_row_ptr_A,
+                             csr_col_ind_A,
+                             descr_P,
+                             nnz_P,
+                             csr_val_P,
+                             csr_row_ptr_P,
+                             csr_col_ind_P,
+                             descr_C,
+                             csr_val_C,
+                             csr_row_ptr_C,
+                             csr_col_ind_C,
+                             info_C,
+                             temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrrap(rocsparse_handle               handle,
+                                  rocsparse_operation            trans_R,
+                                  rocsparse_int                  m,
+                                  rocsparse_int                  n,
+                                  rocsparse_int                  k,
+                                  const rocsparse_float_complex* alpha,
+                                  const rocsparse_mat_descr      descr_R,
+                                  rocsparse_int                  nnz_R,
+                                  const rocsparse_float_complex* csr_val_R,
+                                  const rocsparse_int*           csr_row_ptr_R,
+                                  const rocsparse_int*           csr_col_ind_R,
+                                  const rocsparse_mat_descr      descr_A,
+                                  rocsparse_int                  nnz_A,
+                                  const rocsparse_float_complex* csr_val_A,
+                                  const rocsparse_int*           csr_row_ptr_A,
+                                  const rocsparse_int*           csr_col_ind_A,
+                                  const rocsparse_mat_descr      descr_P,
+                                  rocsparse_int                  nnz_P,
+                                  const rocsparse_float_complex* csr_val_P,
+                                  const rocsparse_int*           csr_row_ptr_P,
+                                  const rocsparse_int*           csr_col_ind_P,
+                                  const rocsparse_mat_descr      descr_C,
+                                  rocsparse_float_complex*       csr_val_C,
+                                  const rocsparse_int*           csr_row_ptr_C,
+                                  rocsparse_int*                 csr_col_ind_C,
+                                  const rocsparse_mat_info       info_C,
+                                  void*                          temp_buffer)
+{
+    return rocsparse_ccsrrap(handle,
+                             trans_R,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             descr_R,
+                             nnz_R,
+                             csr_val_R,
+                             csr_row_ptr_R,
+                             csr_col_ind_R,
+                             descr_A,
+                             nnz_A,
+                             csr_val_A,
+                             csr_row_ptr_A,
+                             csr_col_ind_A,
+                             descr_P,
+                             nnz_P,
+                             csr_val_P,
+                             csr_row_ptr_P,
+                             csr_col_ind_P,
+                             descr_C,
+                             csr_val_C,
+                             csr_row_ptr_C,
+                             csr_col_ind_C,
+                             info_C,
+                             temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrrap(rocsparse_handle                handle,
+                                  rocsparse_operation             trans_R,
+                                  rocsparse_int                   m,
+                                  rocsparse_int                   n,
+                                  rocsparse_int                   k,
+                                  const rocsparse_double_complex* alpha,
+                                  const rocsparse_mat_descr       descr_R,
+                                  rocsparse_int                   nnz_R,
+                                  const rocsparse_double_complex* csr_val_R,
+                                  const rocsparse_int*            csr_row_ptr_R,
+                                  const rocsparse_int*            csr_col_ind_R,
+                                  const rocsparse_mat_descr       descr_A,
+                                  rocsparse_int                   nnz_A,
+                                  const rocsparse_double_complex* csr_val_A,
+                                  const rocsparse_int*            csr_row_ptr_A,
+                                  const rocsparse_int*            csr_col_ind_A,
+                                  const rocsparse_mat_descr       descr_P,
+                                  rocsparse_int                   nnz_P,
+                                  const rocsparse_double_complex* csr_val_P,
+                                  const rocsparse_int*            csr_row_ptr_P,
+                                  const rocsparse_int*            csr_col_ind_P,
+                                  const rocsparse_mat_descr       descr_C,
+                                  rocsparse_double_complex*       csr_val_C,
+                                  const rocsparse_int*            csr_row_ptr_C,
+                                  rocsparse_int*                  csr_col_ind_C,
+                                  const rocsparse_mat_info        info_C,
+                                  void*                           temp_buffer)
+{
+    return rocsparse_zcsrrap(handle,
+                             trans_R,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             descr_R,
+                             nnz_R,
+                             csr_val_R,
+                             csr_row_ptr_R,
+                             csr_col_ind_R,
+                             descr_A,
+                             nnz_A,
+                             csr_val_A,
+                             csr_row_ptr_A,
+                             csr_col_ind_A,
+                             descr_P,
+                             nnz_P,
+                             csr_val_P,
+                             csr_row_ptr_P,
+                             csr_col_ind_P,
+                             descr_C,
+                             csr_val_C,
+                             csr_row_ptr_C,
+                             csr_col_ind_C,
+                             info_C,
+                             temp_buffer);
+}
+
+/*
+ * ===========================================================================
+ *    precond SPARSE
+ * ===========================================================================
+ */
+// bsric0
+template <>
+rocsparse_status rocsparse_bsric0_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_direction       dir,
+                                              rocsparse_int             mb,
+                                              rocsparse_int             nnzb,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              bsr_val,
+                                              const rocsparse_int*      bsr_row_ptr,
+                                              const rocsparse_int*      bsr_col_ind,
+                                              rocsparse_int             block_dim,
+                                              rocsparse_mat_info        info,
+                                              size_t*                   buffer_size)
+{
+    return rocsparse_sbsric0_buffer_size(handle,
+                                         dir,
+                                         mb,
+                                         nnzb,
+                                         descr,
+                                         bsr_val,
+                                         bsr_row_ptr,
+                                         bsr_col_ind,
+                                         block_dim,
+                                         info,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsric0_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_direction       dir,
+                                              rocsparse_int             mb,
                                               rocsparse_int             nnzb,
                                               const rocsparse_mat_descr descr,
-                                              const float*              bsr_val,
-                                              const rocsparse_int*      bsr_row_ptr,
-                                              const rocsparse_int*      bsr_col_ind,
-                                              rocsparse_int             block_dim,
+                                              const double*             bsr_val,
+                                              const rocsparse_int*      bsr_row_ptr,
+                                              const rocsparse_int*      bsr_col_ind,
+                                              rocsparse_int             block_dim,
+                                              rocsparse_mat_info        info,
+                                              size_t*                   buffer_size)
+{
+    return rocsparse_dbsric0_buffer_size(handle,
+                                         dir,
+                                         mb,
+                                         nnzb,
+                                         descr,
+                                         bsr_val,
+                                         bsr_row_ptr,
+                                         bsr_col_ind,
+                                         block_dim,
+                                         info,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsric0_buffer_size(rocsparse_handle               handle,
+                                              rocsparse_direction            dir,
+                                              rocsparse_int                  mb,
+                                              rocsparse_int                  nnzb,
+                                              const rocsparse_mat_descr      descr,
+                                              const rocsparse_float_complex* bsr_val,
+                                              const rocsparse_int*           bsr_row_ptr,
+                                              const rocsparse_int*           bsr_col_ind,
+                                              rocsparse_int                  block_dim,
+                                              rocsparse_mat_info             info,
+                                              size_t*                        buffer_size)
+{
+    return rocsparse_cbsric0_buffer_size(handle,
+                                         dir,
+                                         mb,
+                                         nnzb,
+                                         descr,
+                                         (const rocsparse_float_complex*)bsr_val,
+                                         bsr_row_ptr,
+                                         bsr_col_ind,
+                                         block_dim,
+                                         info,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsric0_buffer_size(rocsparse_handle                handle,
+                                              rocsparse_direction             dir,
+                                              rocsparse_int                   mb,
+                                              rocsparse_int                   nnzb,
+                                              const rocsparse_mat_descr       descr,
+                                              const rocsparse_double_complex* bsr_val,
+                                              const rocsparse_int*            bsr_row_ptr,
+                                              const rocsparse_int*            bsr_col_ind,
+                                              rocsparse_int                   block_dim,
+                                              rocsparse_mat_info              info,
+                                              size_t*                         buffer_size)
+{
+    return rocsparse_zbsric0_buffer_size(handle,
+                                         dir,
+                                         mb,
+                                         nnzb,
+                                         descr,
+                                         (const rocsparse_double_complex*)bsr_val,
+                                         bsr_row_ptr,
+                                         bsr_col_ind,
+                                         block_dim,
+                                         info,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsric0_analysis(rocsparse_handle          handle,
+                                           rocsparse_direction       dir,
+                                           rocsparse_int             mb,
+                                           rocsparse_int             nnzb,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              bsr_val,
+                                           const rocsparse_int*      bsr_row_ptr,
+                                           const rocsparse_int*      bsr_col_ind,
+                                           rocsparse_int             block_dim,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_sbsric0_analysis(handle,
+                                      dir,
+                                      mb,
+                                      nnzb,
+                                      descr,
+                                      bsr_val,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      block_dim,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsric0_analysis(rocsparse_handle          handle,
+                                           rocsparse_direction       dir,
+                                           rocsparse_int             mb,
+                                           rocsparse_int             nnzb,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             bsr_val,
+                                           const rocsparse_int*      bsr_row_ptr,
+                                           const rocsparse_int*      bsr_col_ind,
+                                           rocsparse_int             block_dim,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_dbsric0_analysis(handle,
+                                      dir,
+                                      mb,
+                                      nnzb,
+                                      descr,
+                                      bsr_val,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      block_dim,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsric0_analysis(rocsparse_handle               handle,
+                                           rocsparse_direction            dir,
+                                           rocsparse_int                  mb,
+                                           rocsparse_int                  nnzb,
+                                           const rocsparse_mat_descr      descr,
+                                           const rocsparse_float_complex* bsr_val,
+                                           const rocsparse_int*           bsr_row_ptr,
+                                           const rocsparse_int*           bsr_col_ind,
+                                           rocsparse_int                  block_dim,
+                                           rocsparse_mat_info             info,
+                                           rocsparse_analysis_policy      analysis,
+                                           rocsparse_solve_policy         solve,
+                                           void*                          temp_buffer)
+{
+    return rocsparse_cbsric0_analysis(handle,
+                                      dir,
+                                      mb,
+                                      nnzb,
+                                      descr,
+                                      (const rocsparse_float_complex*)bsr_val,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      block_dim,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsric0_analysis(rocsparse_handle                handle,
+                                           rocsparse_direction             dir,
+                                           rocsparse_int                   mb,
+                                           rocsparse_int                   nnzb,
+                                           const rocsparse_mat_descr       descr,
+                                           const rocsparse_double_complex* bsr_val,
+                                           const rocsparse_int*            bsr_row_ptr,
+                                           const rocsparse_int*            bsr_col_ind,
+                                           rocsparse_int                   block_dim,
+                                           rocsparse_mat_info              info,
+                                           rocsparse_analysis_policy       analysis,
+                                           rocsparse_solve_policy          solve,
+                                           void*                           temp_buffer)
+{
+    return rocsparse_zbsric0_analysis(handle,
+                                      dir,
+                                      mb,
+                                      nnzb,
+                                      descr,
+                                      (const rocsparse_double_complex*)bsr_val,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      block_dim,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsric0(rocsparse_handle          handle,
+                                  rocsparse_direction       dir,
+                                  rocsparse_int             mb,
+                                  rocsparse_int             nnzb,
+                                  const rocsparse_mat_descr descr,
+                                  float*                    bsr_val,
+                                  const rocsparse_int*      bsr_row_ptr,
+                                  const rocsparse_int*      bsr_col_ind,
+                                  rocsparse_int             block_dim,
+                                  rocsparse_mat_info        info,
+                                  rocsparse_solve_policy    policy,
+                                  void*                     temp_buffer)
+{
+    return rocsparse_sbsric0(handle,
+                             dir,
+                             mb,
+                             nnzb,
+                             descr,
+                             bsr_val,
+                             bsr_row_ptr,
+                             bsr_col_ind,
+                             block_dim,
+                             info,
+                             policy,
+                             temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsric0(rocsparse_handle          handle,
+                                  rocsparse_direction       dir,
+                                  rocsparse_int             mb,
+                                  rocsparse_int             nnzb,
+                                  const rocsparse_mat_descr descr,
+                                  double*                   bsr_val,
+                                  const rocsparse_int*      bsr_row_ptr,
+                                  const rocsparse_int*      bsr_col_ind,
+                                  rocsparse_int             block_dim,
+                                  rocsparse_mat_info        info,
+                                  rocsparse_solve_policy    policy,
+                                  void*                     temp_buffer)
+{
+    return rocsparse_dbsric0(handle,
+                             dir,
+                             mb,
+                             nnzb,
+                             descr,
+                             bsr_val,
+                             bsr_row_ptr,
+                             bsr_col_ind,
+                             block_dim,
+                             info,
+                             policy,
+                             temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsric0(rocsparse_handle          handle,
+                                  rocsparse_direction       dir,
+                                  rocsparse_int             mb,
+                                  rocsparse_int             nnzb,
+                                  const rocsparse_mat_descr descr,
+                                  rocsparse_float_complex*  bsr_val,
+                                  const rocsparse_int*      bsr_row_ptr,
+                                  const rocsparse_int*      bsr_col_ind,
+                                  rocsparse_int             block_dim,
+                                  rocsparse_mat_info        info,
+                                  rocsparse_solve_policy    policy,
+                                  void*                     temp_buffer)
+{
+    return rocsparse_cbsric0(handle,
+                             dir,
+                             mb,
+                             nnzb,
+                             descr,
+                             (rocsparse_float_complex*)bsr_val,
+                             bsr_row_ptr,
+                             bsr_col_ind,
+                             block_dim,
+                             info,
+                             policy,
+                             temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsric0(rocsparse_handle          handle,
+                                  rocsparse_direction       dir,
+                                  rocsparse_int             mb,
+                                  rocsparse_int             nnzb,
+                                  const rocsparse_mat_descr descr,
+                                  rocsparse_double_complex* bsr_val,
+                                  const rocsparse_int*      bsr_row_ptr,
+                                  const rocsparse_int*      bsr_col_ind,
+                                  rocsparse_int             block_dim,
+                                  rocsparse_mat_info        info,
+                                  rocsparse_solve_policy    policy,
+                                  void*                     temp_buffer)
+{
+    return rocsparse_zbsric0(handle,
+                             dir,
+                             mb,
+                             nnzb,
+                             descr,
+                             (rocsparse_double_complex*)bsr_val,
+                             bsr_row_ptr,
+                             bsr_col_ind,
+                             block_dim,
+                             info,
+                             policy,
+                             temp_buffer);
+}
+
+// bsrilu0
+template <>
+rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nnzb,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              bsr_val,
+                                               const rocsparse_int*      bsr_row_ptr,
+                                               const rocsparse_int*      bsr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size)
+{
+    return rocsparse_sbsrilu0_buffer_size(handle,
+                                          dir,
+                                          mb,
+                                          nnzb,
+                                          descr,
+                                          bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nnzb,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             bsr_val,
+                                               const rocsparse_int*      bsr_row_ptr,
+                                               const rocsparse_int*      bsr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size)
+{
+    return rocsparse_dbsrilu0_buffer_size(handle,
+                                          dir,
+                                          mb,
+                                          nnzb,
+                                          descr,
+                                          bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_direction            dir,
+                                               rocsparse_int                  mb,
+                                               rocsparse_int                  nnzb,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* bsr_val,
+                                               const rocsparse_int*           bsr_row_ptr,
+                                               const rocsparse_int*           bsr_col_ind,
+                                               rocsparse_int                  block_dim,
+                                               rocsparse_mat_info             info,
+                                               size_t*                        buffer_size)
+{
+    return rocsparse_cbsrilu0_buffer_size(handle,
+                                          dir,
+                                          mb,
+                                          nnzb,
+                                          descr,
+                                          (const rocsparse_float_complex*)bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_direction             dir,
+                                               rocsparse_int                   mb,
+                                               rocsparse_int                   nnzb,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* bsr_val,
+                                               const rocsparse_int*            bsr_row_ptr,
+                                               const rocsparse_int*            bsr_col_ind,
+                                               rocsparse_int                   block_dim,
+                                               rocsparse_mat_info              info,
+                                               size_t*                         buffer_size)
+{
+    return rocsparse_zbsrilu0_buffer_size(handle,
+                                          dir,
+                                          mb,
+                                          nnzb,
+                                          descr,
+                                          (const rocsparse_double_complex*)bsr_val,
+                                          bsr_row_ptr,
+                                          bsr_col_ind,
+                                          block_dim,
+                                          info,
+                                          buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                 rocsparse_mat_info info,
+                                                 int                enable_boost,
+                                                 const float*       boost_tol,
+                                                 const float*       boost_val)
+{
+    return rocsparse_sbsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                 rocsparse_mat_info info,
+                                                 int                enable_boost,
+                                                 const double*      boost_tol,
+                                                 const double*      boost_val)
+{
+    return rocsparse_dbsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_numeric_boost(rocsparse_handle               handle,
+                                                 rocsparse_mat_info             info,
+                                                 int                            enable_boost,
+                                                 const float*                   boost_tol,
+                                                 const rocsparse_float_complex* boost_val)
+{
+    return rocsparse_cbsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_numeric_boost(rocsparse_handle                handle,
+                                                 rocsparse_mat_info              info,
+                                                 int                             enable_boost,
+                                                 const double*                   boost_tol,
+                                                 const rocsparse_double_complex* boost_val)
+{
+    return rocsparse_zbsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer)
+{
+    return rocsparse_sbsrilu0_analysis(handle,
+                                       dir,
+                                       mb,
+                                       nnzb,
+                                       descr,
+                                       bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       block_dim,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer)
+{
+    return rocsparse_dbsrilu0_analysis(handle,
+                                       dir,
+                                       mb,
+                                       nnzb,
+                                       descr,
+                                       bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       block_dim,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle               handle,
+                                            rocsparse_direction            dir,
+                                            rocsparse_int                  mb,
+                                            rocsparse_int                  nnzb,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* bsr_val,
+                                            const rocsparse_int*           bsr_row_ptr,
+                                            const rocsparse_int*           bsr_col_ind,
+                                            rocsparse_int                  block_dim,
+                                            rocsparse_mat_info             info,
+                                            rocsparse_analysis_policy      analysis,
+                                            rocsparse_solve_policy         solve,
+                                            void*                          temp_buffer)
+{
+    return rocsparse_cbsrilu0_analysis(handle,
+                                       dir,
+                                       mb,
+                                       nnzb,
+                                       descr,
+                                       (const rocsparse_float_complex*)bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       block_dim,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle                handle,
+                                            rocsparse_direction             dir,
+                                            rocsparse_int                   mb,
+                                            rocsparse_int                   nnzb,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* bsr_val,
+                                            const rocsparse_int*            bsr_row_ptr,
+                                            const rocsparse_int*            bsr_col_ind,
+                                            rocsparse_int                   block_dim,
+                                            rocsparse_mat_info              info,
+                                            rocsparse_analysis_policy       analysis,
+                                            rocsparse_solve_policy          solve,
+                                            void*                           temp_buffer)
+{
+    return rocsparse_zbsrilu0_analysis(handle,
+                                       dir,
+                                       mb,
+                                       nnzb,
+                                       descr,
+                                       (const rocsparse_double_complex*)bsr_val,
+                                       bsr_row_ptr,
+                                       bsr_col_ind,
+                                       block_dim,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_sbsrilu0(handle,
+                              dir,
+                              mb,
+                              nnzb,
+                              descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              info,
+                              policy,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_dbsrilu0(handle,
+                              dir,
+                              mb,
+                              nnzb,
+                              descr,
+                              bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              info,
+                              policy,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex*  bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_cbsrilu0(handle,
+                              dir,
+                              mb,
+                              nnzb,
+                              descr,
+                              (rocsparse_float_complex*)bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              info,
+                              policy,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_zbsrilu0(handle,
+                              dir,
+                              mb,
+                              nnzb,
+                              descr,
+                              (rocsparse_double_complex*)bsr_val,
+                              bsr_row_ptr,
+                              bsr_col_ind,
+                              block_dim,
+                              info,
+                              policy,
+                              temp_buffer);
+}
+
+// bsrjacobi
+template <>
+rocsparse_status rocsparse_bsrjacobi_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_direction       dir,
+                                                 rocsparse_int             mb,
+                                                 rocsparse_int             nnzb,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              bsr_val,
+                                                 const rocsparse_int*      bsr_row_ptr,
+                                                 const rocsparse_int*      bsr_col_ind,
+                                                 rocsparse_int             block_dim,
+                                                 size_t*                   buffer_size)
+{
+    return rocsparse_sbsrjacobi_buffer_size(
+        handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrjacobi_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_direction       dir,
+                                                 rocsparse_int             mb,
+                                                 rocsparse_int             nnzb,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             bsr_val,
+                                                 const rocsparse_int*      bsr_row_ptr,
+                                                 const rocsparse_int*      bsr_col_ind,
+                                                 rocsparse_int             block_dim,
+                                                 size_t*                   buffer_size)
+{
+    return rocsparse_dbsrjacobi_buffer_size(
+        handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrjacobi_buffer_size(rocsparse_handle               handle,
+                                                 rocsparse_direction            dir,
+                                                 rocsparse_int                  mb,
+                                                 rocsparse_int                  nnzb,
+                                                 const rocsparse_mat_descr      descr,
+                                                 const rocsparse_float_complex* bsr_val,
+                                                 const rocsparse_int*           bsr_row_ptr,
+                                                 const rocsparse_int*           bsr_col_ind,
+                                                 rocsparse_int                  block_dim,
+                                                 size_t*                        buffer_size)
+{
+    return rocsparse_cbsrjacobi_buffer_size(
+        handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrjacobi_buffer_size(rocsparse_handle                handle,
+                                                 rocsparse_direction             dir,
+                                                 rocsparse_int                   mb,
+                                                 rocsparse_int                   nnzb,
+                                                 const rocsparse_mat_descr       descr,
+                                                 const rocsparse_double_complex* bsr_val,
+                                                 const rocsparse_int*            bsr_row_ptr,
+                                                 const rocsparse_int*            bsr_col_ind,
+                                                 rocsparse_int                   block_dim,
+                                                 size_t*                         buffer_size)
+{
+    return rocsparse_zbsrjacobi_buffer_size(
+        handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_bsrjacobi_setup(rocsparse_handle          handle,
+                                           rocsparse_direction       dir,
+                                           rocsparse_int             mb,
+                                           rocsparse_int             nnzb,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              bsr_val,
+                                           const rocsparse_int*      bsr_row_ptr,
+                                           const rocsparse_int*      bsr_col_ind,
+                                           rocsparse_int             block_dim,
+                                           rocsparse_mat_info        info,
+                                           float*                    bsr_diag_inv,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_sbsrjacobi_setup(handle,
+                                      dir,
+                                      mb,
+                                      nnzb,
+                                      descr,
+                                      bsr_val,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      block_dim,
+                                      info,
+                                      bsr_diag_inv,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrjacobi_setup(rocsparse_handle          handle,
+                                           rocsparse_direction       dir,
+                                           rocsparse_int             mb,
+                                           rocsparse_int             nnzb,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             bsr_val,
+                                           const rocsparse_int*      bsr_row_ptr,
+                                           const rocsparse_int*      bsr_col_ind,
+                                           rocsparse_int             block_dim,
+                                           rocsparse_mat_info        info,
+                                           double*                   bsr_diag_inv,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_dbsrjacobi_setup(handle,
+                                      dir,
+                                      mb,
+                                      nnzb,
+                                      descr,
+                                      bsr_val,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      block_dim,
+                                      info,
+                                      bsr_diag_inv,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrjacobi_setup(rocsparse_handle               handle,
+                                           rocsparse_direction            dir,
+                                           rocsparse_int                  mb,
+                                           rocsparse_int                  nnzb,
+                                           const rocsparse_mat_descr      descr,
+                                           const rocsparse_float_complex* bsr_val,
+                                           const rocsparse_int*           bsr_row_ptr,
+                                           const rocsparse_int*           bsr_col_ind,
+                                           rocsparse_int                  block_dim,
+                                           rocsparse_mat_info             info,
+                                           rocsparse_float_complex*       bsr_diag_inv,
+                                           void*                          temp_buffer)
+{
+    return rocsparse_cbsrjacobi_setup(handle,
+                                      dir,
+                                      mb,
+                                      nnzb,
+                                      descr,
+                                      bsr_val,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      block_dim,
+                                      info,
+                                      bsr_diag_inv,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrjacobi_setup(rocsparse_handle                handle,
+                                           rocsparse_direction             dir,
+                                           rocsparse_int                   mb,
+                                           rocsparse_int                   nnzb,
+                                           const rocsparse_mat_descr       descr,
+                                           const rocsparse_double_complex* bsr_val,
+                                           const rocsparse_int*            bsr_row_ptr,
+                                           const rocsparse_int*            bsr_col_ind,
+                                           rocsparse_int                   block_dim,
+                                           rocsparse_mat_info              info,
+                                           rocsparse_double_complex*       bsr_diag_inv,
+                                           void*                           temp_buffer)
+{
+    return rocsparse_zbsrjacobi_setup(handle,
+                                      dir,
+                                      mb,
+                                      nnzb,
+                                      descr,
+                                      bsr_val,
+                                      bsr_row_ptr,
+                                      bsr_col_ind,
+                                      block_dim,
+                                      info,
+                                      bsr_diag_inv,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_bsrjacobi_apply(rocsparse_handle    handle,
+                                           rocsparse_direction dir,
+                                           rocsparse_int       mb,
+                                           rocsparse_int       block_dim,
+                                           const float*        alpha,
+                                           const float*        bsr_diag_inv,
+                                           const float*        x,
+                                           const float*        beta,
+                                           float*              y)
+{
+    return rocsparse_sbsrjacobi_apply(handle, dir, mb, block_dim, alpha, bsr_diag_inv, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrjacobi_apply(rocsparse_handle    handle,
+                                           rocsparse_direction dir,
+                                           rocsparse_int       mb,
+                                           rocsparse_int       block_dim,
+                                           const double*       alpha,
+                                           const double*       bsr_diag_inv,
+                                           const double*       x,
+                                           const double*       beta,
+                                           double*             y)
+{
+    return rocsparse_dbsrjacobi_apply(handle, dir, mb, block_dim, alpha, bsr_diag_inv, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrjacobi_apply(rocsparse_handle               handle,
+                                           rocsparse_direction            dir,
+                                           rocsparse_int                  mb,
+                                           rocsparse_int                  block_dim,
+                                           const rocsparse_float_complex* alpha,
+                                           const rocsparse_float_complex* bsr_diag_inv,
+                                           const rocsparse_float_complex* x,
+                                           const rocsparse_float_complex* beta,
+                                           rocsparse_float_complex*       y)
+{
+    return rocsparse_cbsrjacobi_apply(handle, dir, mb, block_dim, alpha, bsr_diag_inv, x, beta, y);
+}
+
+template <>
+rocsparse_status rocsparse_bsrjacobi_apply(rocsparse_handle                handle,
+                                           rocsparse_direction             dir,
+                                           rocsparse_int                   mb,
+                                           rocsparse_int                   block_dim,
+                                           const rocsparse_double_complex* alpha,
+                                           const rocsparse_double_complex* bsr_diag_inv,
+                                           const rocsparse_double_complex* x,
+                                           const rocsparse_double_complex* beta,
+                                           rocsparse_double_complex*       y)
+{
+    return rocsparse_zbsrjacobi_apply(handle, dir, mb, block_dim, alpha, bsr_diag_inv, x, beta, y);
+}
+
+// csric0
+template <>
+rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const float*              csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              size_t*                   buffer_size)
+{
+    return rocsparse_scsric0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const double*             csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
                                               rocsparse_mat_info        info,
                                               size_t*                   buffer_size)
 {
-    return rocsparse_sbsric0_buffer_size(handle,
-                                         dir,
-                                         mb,
-                                         nnzb,
-                                         descr,
-                                         bsr_val,
-                                         bsr_row_ptr,
-                                         bsr_col_ind,
-                                         block_dim,
-                                         info,
-                                         buffer_size);
+    return rocsparse_dcsric0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle               handle,
+                                              rocsparse_int                  m,
+                                              rocsparse_int                  nnz,
+                                              const rocsparse_mat_descr      descr,
+                                              const rocsparse_float_complex* csr_val,
+                                              const rocsparse_int*           csr_row_ptr,
+                                              const rocsparse_int*           csr_col_ind,
+                                              rocsparse_mat_info             info,
+                                              size_t*                        buffer_size)
+{
+    return rocsparse_ccsric0_buffer_size(handle,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         (const rocsparse_float_complex*)csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         info,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle                handle,
+                                              rocsparse_int                   m,
+                                              rocsparse_int                   nnz,
+                                              const rocsparse_mat_descr       descr,
+                                              const rocsparse_double_complex* csr_val,
+                                              const rocsparse_int*            csr_row_ptr,
+                                              const rocsparse_int*            csr_col_ind,
+                                              rocsparse_mat_info              info,
+                                              size_t*                         buffer_size)
+{
+    return rocsparse_zcsric0_buffer_size(handle,
+                                         m,
+                                         nnz,
+                                         descr,
+                                         (const rocsparse_double_complex*)csr_val,
+                                         csr_row_ptr,
+                                         csr_col_ind,
+                                         info,
+                                         buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_analysis(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const float*              csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_scsric0_analysis(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_analysis(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const double*             csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_analysis_policy analysis,
+                                           rocsparse_solve_policy    solve,
+                                           void*                     temp_buffer)
+{
+    return rocsparse_dcsric0_analysis(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_analysis(rocsparse_handle               handle,
+                                           rocsparse_int                  m,
+                                           rocsparse_int                  nnz,
+                                           const rocsparse_mat_descr      descr,
+                                           const rocsparse_float_complex* csr_val,
+                                           const rocsparse_int*           csr_row_ptr,
+                                           const rocsparse_int*           csr_col_ind,
+                                           rocsparse_mat_info             info,
+                                           rocsparse_analysis_policy      analysis,
+                                           rocsparse_solve_policy         solve,
+                                           void*                          temp_buffer)
+{
+    return rocsparse_ccsric0_analysis(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      (const rocsparse_float_complex*)csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0_analysis(rocsparse_handle                handle,
+                                           rocsparse_int                   m,
+                                           rocsparse_int                   nnz,
+                                           const rocsparse_mat_descr       descr,
+                                           const rocsparse_double_complex* csr_val,
+                                           const rocsparse_int*            csr_row_ptr,
+                                           const rocsparse_int*            csr_col_ind,
+                                           rocsparse_mat_info              info,
+                                           rocsparse_analysis_policy       analysis,
+                                           rocsparse_solve_policy          solve,
+                                           void*                           temp_buffer)
+{
+    return rocsparse_zcsric0_analysis(handle,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      (const rocsparse_double_complex*)csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      analysis,
+                                      solve,
+                                      temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  float*                    csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
+                                  rocsparse_solve_policy    policy,
+                                  void*                     temp_buffer)
+{
+    return rocsparse_scsric0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  double*                   csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
+                                  rocsparse_solve_policy    policy,
+                                  void*                     temp_buffer)
+{
+    return rocsparse_dcsric0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  rocsparse_float_complex*  csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
+                                  rocsparse_solve_policy    policy,
+                                  void*                     temp_buffer)
+{
+    return rocsparse_ccsric0(handle,
+                             m,
+                             nnz,
+                             descr,
+                             (rocsparse_float_complex*)csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             policy,
+                             temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  rocsparse_double_complex* csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
+                                  rocsparse_solve_policy    policy,
+                                  void*                     temp_buffer)
+{
+    return rocsparse_zcsric0(handle,
+                             m,
+                             nnz,
+                             descr,
+                             (rocsparse_double_complex*)csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             policy,
+                             temp_buffer);
+}
+
+// csrilu0
+template <>
+rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size)
+{
+    return rocsparse_scsrilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsric0_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_direction       dir,
-                                              rocsparse_int             mb,
-                                              rocsparse_int             nnzb,
-                                              const rocsparse_mat_descr descr,
-                                              const double*             bsr_val,
-                                              const rocsparse_int*      bsr_row_ptr,
-                                              const rocsparse_int*      bsr_col_ind,
-                                              rocsparse_int             block_dim,
-                                              rocsparse_mat_info        info,
-                                              size_t*                   buffer_size)
+rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size)
 {
-    return rocsparse_dbsric0_buffer_size(handle,
-                                         dir,
-                                         mb,
-                                         nnzb,
-                                         descr,
-                                         bsr_val,
-                                         bsr_row_ptr,
-                                         bsr_col_ind,
-                                         block_dim,
-                                         info,
-                                         buffer_size);
+    return rocsparse_dcsrilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsric0_buffer_size(rocsparse_handle               handle,
-                                              rocsparse_direction            dir,
-                                              rocsparse_int                  mb,
-                                              rocsparse_int                  nnzb,
-                                              const rocsparse_mat_descr      descr,
-                                              const rocsparse_float_complex* bsr_val,
-                                              const rocsparse_int*           bsr_row_ptr,
-                                              const rocsparse_int*           bsr_col_ind,
-                                              rocsparse_int                  block_dim,
-                                              rocsparse_mat_info             info,
-                                              size_t*                        buffer_size)
+rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  nnz,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               const rocsparse_int*           csr_col_ind,
+                                               rocsparse_mat_info             info,
+                                               size_t*                        buffer_size)
 {
-    return rocsparse_cbsric0_buffer_size(handle,
-                                         dir,
-                                         mb,
-                                         nnzb,
-                                         descr,
-                                         (const rocsparse_float_complex*)bsr_val,
-                                         bsr_row_ptr,
-                                         bsr_col_ind,
-                                         block_dim,
-                                         info,
-                                         buffer_size);
+    return rocsparse_ccsrilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsric0_buffer_size(rocsparse_handle                handle,
-                                              rocsparse_direction             dir,
-                                              rocsparse_int                   mb,
-                                              rocsparse_int                   nnzb,
-                                              const rocsparse_mat_descr       descr,
-                                              const rocsparse_double_complex* bsr_val,
-                                              const rocsparse_int*            bsr_row_ptr,
-                                              const rocsparse_int*            bsr_col_ind,
-                                              rocsparse_int                   block_dim,
-                                              rocsparse_mat_info              info,
-                                              size_t*                         buffer_size)
+rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   nnz,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               const rocsparse_int*            csr_col_ind,
+                                               rocsparse_mat_info              info,
+                                               size_t*                         buffer_size)
 {
-    return rocsparse_zbsric0_buffer_size(handle,
-                                         dir,
-                                         mb,
-                                         nnzb,
-                                         descr,
-                                         (const rocsparse_double_complex*)bsr_val,
-                                         bsr_row_ptr,
-                                         bsr_col_ind,
-                                         block_dim,
-                                         info,
-                                         buffer_size);
+    return rocsparse_zcsrilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsric0_analysis(rocsparse_handle          handle,
-                                           rocsparse_direction       dir,
-                                           rocsparse_int             mb,
-                                           rocsparse_int             nnzb,
-                                           const rocsparse_mat_descr descr,
-                                           const float*              bsr_val,
-                                           const rocsparse_int*      bsr_row_ptr,
-                                           const rocsparse_int*      bsr_col_ind,
-                                           rocsparse_int             block_dim,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer)
+rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle   handle,
+                                                 rocsparse_mat_info info,
+                                                 int                enable_boost,
+                                                 const float*       boost_tol,
+                                                 const float*       boost_val)
 {
-    return rocsparse_sbsric0_analysis(handle,
-                                      dir,
-                                      mb,
-                                      nnzb,
-                                      descr,
-                                      bsr_val,
-                                      bsr_row_ptr,
-                                      bsr_col_ind,
-                                      block_dim,
-                                      info,
-                                      analysis,
-                                      solve,
-                                      temp_buffer);
+    return rocsparse_scsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle   handle,
+                                                 rocsparse_mat_info info,
+                                                 int                enable_boost,
+                                                 const double*      boost_tol,
+                                                 const double*      boost_val)
+{
+    return rocsparse_dcsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle               handle,
+                                                 rocsparse_mat_info             info,
+                                                 int                            enable_boost,
+                                                 const float*                   boost_tol,
+                                                 const rocsparse_float_complex* boost_val)
+{
+    return rocsparse_ccsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle                handle,
+                                                 rocsparse_mat_info              info,
+                                                 int                             enable_boost,
+                                                 const double*                   boost_tol,
+                                                 const rocsparse_double_complex* boost_val)
+{
+    return rocsparse_zcsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer)
+{
+    return rocsparse_scsrilu0_analysis(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer)
+{
+    return rocsparse_dcsrilu0_analysis(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle               handle,
+                                            rocsparse_int                  m,
+                                            rocsparse_int                  nnz,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* csr_val,
+                                            const rocsparse_int*           csr_row_ptr,
+                                            const rocsparse_int*           csr_col_ind,
+                                            rocsparse_mat_info             info,
+                                            rocsparse_analysis_policy      analysis,
+                                            rocsparse_solve_policy         solve,
+                                            void*                          temp_buffer)
+{
+    return rocsparse_ccsrilu0_analysis(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsric0_analysis(rocsparse_handle          handle,
-                                           rocsparse_direction       dir,
-                                           rocsparse_int             mb,
-                                           rocsparse_int             nnzb,
-                                           const rocsparse_mat_descr descr,
-                                           const double*             bsr_val,
-                                           const rocsparse_int*      bsr_row_ptr,
-                                           const rocsparse_int*      bsr_col_ind,
-                                           rocsparse_int             block_dim,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer)
+rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle                handle,
+                                            rocsparse_int                   m,
+                                            rocsparse_int                   nnz,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* csr_val,
+                                            const rocsparse_int*            csr_row_ptr,
+                                            const rocsparse_int*            csr_col_ind,
+                                            rocsparse_mat_info              info,
+                                            rocsparse_analysis_policy       analysis,
+                                            rocsparse_solve_policy          solve,
+                                            void*                           temp_buffer)
 {
-    return rocsparse_dbsric0_analysis(handle,
-                                      dir,
-                                      mb,
-                                      nnzb,
-                                      descr,
-                                      bsr_val,
-                                      bsr_row_ptr,
-                                      bsr_col_ind,
-                                      block_dim,
-                                      info,
-                                      analysis,
-                                      solve,
-                                      temp_buffer);
+    return rocsparse_zcsrilu0_analysis(handle,
+                                       m,
+                                       nnz,
+                                       descr,
+                                       csr_val,
+                                       csr_row_ptr,
+                                       csr_col_ind,
+                                       info,
+                                       analysis,
+                                       solve,
+                                       temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsric0_analysis(rocsparse_handle               handle,
-                                           rocsparse_direction            dir,
-                                           rocsparse_int                  mb,
-                                           rocsparse_int                  nnzb,
-                                           const rocsparse_mat_descr      descr,
-                                           const rocsparse_float_complex* bsr_val,
-                                           const rocsparse_int*           bsr_row_ptr,
-                                           const rocsparse_int*           bsr_col_ind,
-                                           rocsparse_int                  block_dim,
-                                           rocsparse_mat_info             info,
-                                           rocsparse_analysis_policy      analysis,
-                                           rocsparse_solve_policy         solve,
-                                           void*                          temp_buffer)
+rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
 {
-    return rocsparse_cbsric0_analysis(handle,
-                                      dir,
-                                      mb,
-                                      nnzb,
-                                      descr,
-                                      (const rocsparse_float_complex*)bsr_val,
-                                      bsr_row_ptr,
-                                      bsr_col_ind,
-                                      block_dim,
-                                      info,
-                                      analysis,
-                                      solve,
-                                      temp_buffer);
+    return rocsparse_scsrilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsric0_analysis(rocsparse_handle                handle,
-                                           rocsparse_direction             dir,
-                                           rocsparse_int                   mb,
-                                           rocsparse_int                   nnzb,
-                                           const rocsparse_mat_descr       descr,
-                                           const rocsparse_double_complex* bsr_val,
-                                           const rocsparse_int*            bsr_row_ptr,
-                                           const rocsparse_int*            bsr_col_ind,
-                                           rocsparse_int                   block_dim,
-                                           rocsparse_mat_info              info,
-                                           rocsparse_analysis_policy       analysis,
-                                           rocsparse_solve_policy          solve,
-                                           void*                           temp_buffer)
+rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
 {
-    return rocsparse_zbsric0_analysis(handle,
-                                      dir,
-                                      mb,
-                                      nnzb,
-                                      descr,
-                                      (const rocsparse_double_complex*)bsr_val,
-                                      bsr_row_ptr,
-                                      bsr_col_ind,
-                                      block_dim,
-                                      info,
-                                      analysis,
-                                      solve,
-                                      temp_buffer);
+    return rocsparse_dcsrilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsric0(rocsparse_handle          handle,
-                                  rocsparse_direction       dir,
-                                  rocsparse_int             mb,
-                                  rocsparse_int             nnzb,
-                                  const rocsparse_mat_descr descr,
-                                  float*                    bsr_val,
-                                  const rocsparse_int*      bsr_row_ptr,
-                                  const rocsparse_int*      bsr_col_ind,
-                                  rocsparse_int             block_dim,
-                                  rocsparse_mat_info        info,
-                                  rocsparse_solve_policy    policy,
-                                  void*                     temp_buffer)
+rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex*  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
 {
-    return rocsparse_sbsric0(handle,
-                             dir,
-                             mb,
-                             nnzb,
-                             descr,
-                             bsr_val,
-                             bsr_row_ptr,
-                             bsr_col_ind,
-                             block_dim,
-                             info,
-                             policy,
-                             temp_buffer);
+    return rocsparse_ccsrilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsric0(rocsparse_handle          handle,
-                                  rocsparse_direction       dir,
-                                  rocsparse_int             mb,
-                                  rocsparse_int             nnzb,
-                                  const rocsparse_mat_descr descr,
-                                  double*                   bsr_val,
-                                  const rocsparse_int*      bsr_row_ptr,
-                                  const rocsparse_int*      bsr_col_ind,
-                                  rocsparse_int             block_dim,
-                                  rocsparse_mat_info        info,
-                                  rocsparse_solve_policy    policy,
-                                  void*                     temp_buffer)
+rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
 {
-    return rocsparse_dbsric0(handle,
-                             dir,
-                             mb,
-                             nnzb,
-                             descr,
-                             bsr_val,
-                             bsr_row_ptr,
-                             bsr_col_ind,
-                             block_dim,
-                             info,
-                             policy,
-                             temp_buffer);
+    return rocsparse_zcsrilu0(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
 }
 
+// csriluk
 template <>
-rocsparse_status rocsparse_bsric0(rocsparse_handle          handle,
-                                  rocsparse_direction       dir,
-                                  rocsparse_int             mb,
-                                  rocsparse_int             nnzb,
-                                  const rocsparse_mat_descr descr,
-                                  rocsparse_float_complex*  bsr_val,
-                                  const rocsparse_int*      bsr_row_ptr,
-                                  const rocsparse_int*      bsr_col_ind,
-                                  rocsparse_int             block_dim,
-                                  rocsparse_mat_info        info,
-                                  rocsparse_solve_policy    policy,
-                                  void*                     temp_buffer)
+rocsparse_status rocsparse_csriluk(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   const float*              csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             nnz_lu,
+                                   float*                    csr_val_lu,
+                                   const rocsparse_int*      csr_row_ptr_lu,
+                                   const rocsparse_int*      csr_col_ind_lu,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
 {
-    return rocsparse_cbsric0(handle,
-                             dir,
-                             mb,
-                             nnzb,
-                             descr,
-                             (rocsparse_float_complex*)bsr_val,
-                             bsr_row_ptr,
-                             bsr_col_ind,
-                             block_dim,
-                             info,
-                             policy,
-                             temp_buffer);
+    return rocsparse_scsriluk(handle,
+                              m,
+                              nnz,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              nnz_lu,
+                              csr_val_lu,
+                              csr_row_ptr_lu,
+                              csr_col_ind_lu,
+                              info,
+                              policy,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csriluk(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   const double*             csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             nnz_lu,
+                                   double*                   csr_val_lu,
+                                   const rocsparse_int*      csr_row_ptr_lu,
+                                   const rocsparse_int*      csr_col_ind_lu,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_dcsriluk(handle,
+                              m,
+                              nnz,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              nnz_lu,
+                              csr_val_lu,
+                              csr_row_ptr_lu,
+                              csr_col_ind_lu,
+                              info,
+                              policy,
+                              temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsric0(rocsparse_handle          handle,
-                                  rocsparse_direction       dir,
-                                  rocsparse_int             mb,
-                                  rocsparse_int             nnzb,
-                                  const rocsparse_mat_descr descr,
-                                  rocsparse_double_complex* bsr_val,
-                                  const rocsparse_int*      bsr_row_ptr,
-                                  const rocsparse_int*      bsr_col_ind,
-                                  rocsparse_int             block_dim,
-                                  rocsparse_mat_info        info,
-                                  rocsparse_solve_policy    policy,
-                                  void*                     temp_buffer)
+rocsparse_status rocsparse_csriluk(rocsparse_handle               handle,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  nnz,
+                                   const rocsparse_mat_descr      descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int*           csr_row_ptr,
+                                   const rocsparse_int*           csr_col_ind,
+                                   rocsparse_int                  nnz_lu,
+                                   rocsparse_float_complex*       csr_val_lu,
+                                   const rocsparse_int*           csr_row_ptr_lu,
+                                   const rocsparse_int*           csr_col_ind_lu,
+                                   rocsparse_mat_info             info,
+                                   rocsparse_solve_policy         policy,
+                                   void*                          temp_buffer)
 {
-    return rocsparse_zbsric0(handle,
-                             dir,
-                             mb,
-                             nnzb,
-                             descr,
-                             (rocsparse_double_complex*)bsr_val,
-                             bsr_row_ptr,
-                             bsr_col_ind,
-                             block_dim,
-                             info,
-                             policy,
-                             temp_buffer);
+    return rocsparse_ccsriluk(handle,
+                              m,
+                              nnz,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              nnz_lu,
+                              csr_val_lu,
+                              csr_row_ptr_lu,
+                              csr_col_ind_lu,
+                              info,
+                              policy,
+                              temp_buffer);
 }
 
-// bsrilu0
 template <>
-rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_direction       dir,
-                                               rocsparse_int             mb,
-                                               rocsparse_int             nnzb,
-                                               const rocsparse_mat_descr descr,
-                                               const float*              bsr_val,
-                                               const rocsparse_int*      bsr_row_ptr,
-                                               const rocsparse_int*      bsr_col_ind,
-                                               rocsparse_int             block_dim,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size)
+rocsparse_status rocsparse_csriluk(rocsparse_handle                handle,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   nnz,
+                                   const rocsparse_mat_descr       descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*            csr_row_ptr,
+                                   const rocsparse_int*            csr_col_ind,
+                                   rocsparse_int                   nnz_lu,
+                                   rocsparse_double_complex*       csr_val_lu,
+                                   const rocsparse_int*            csr_row_ptr_lu,
+                                   const rocsparse_int*            csr_col_ind_lu,
+                                   rocsparse_mat_info              info,
+                                   rocsparse_solve_policy          policy,
+                                   void*                           temp_buffer)
 {
-    return rocsparse_sbsrilu0_buffer_size(handle,
-                                          dir,
-                                          mb,
-                                          nnzb,
-                                          descr,
-                                          bsr_val,
-                                          bsr_row_ptr,
-                                          bsr_col_ind,
-                                          block_dim,
-                                          info,
-                                          buffer_size);
+    return rocsparse_zcsriluk(handle,
+                              m,
+                              nnz,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              nnz_lu,
+                              csr_val_lu,
+                              csr_row_ptr_lu,
+                              csr_col_ind_lu,
+                              info,
+                              policy,
+                              temp_buffer);
 }
 
+// csritilu0
 template <>
-rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_direction       dir,
-                                               rocsparse_int             mb,
-                                               rocsparse_int             nnzb,
-                                               const rocsparse_mat_descr descr,
-                                               const double*             bsr_val,
-                                               const rocsparse_int*      bsr_row_ptr,
-                                               const rocsparse_int*      bsr_col_ind,
-                                               rocsparse_int             block_dim,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size)
+rocsparse_status rocsparse_csritilu0_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const float*              csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 size_t*                   buffer_size)
 {
-    return rocsparse_dbsrilu0_buffer_size(handle,
-                                          dir,
-                                          mb,
-                                          nnzb,
-                                          descr,
-                                          bsr_val,
-                                          bsr_row_ptr,
-                                          bsr_col_ind,
-                                          block_dim,
-                                          info,
-                                          buffer_size);
+    return rocsparse_scsritilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle               handle,
-                                               rocsparse_direction            dir,
-                                               rocsparse_int                  mb,
-                                               rocsparse_int                  nnzb,
-                                               const rocsparse_mat_descr      descr,
-                                               const rocsparse_float_complex* bsr_val,
-                                               const rocsparse_int*           bsr_row_ptr,
-                                               const rocsparse_int*           bsr_col_ind,
-                                               rocsparse_int                  block_dim,
-                                               rocsparse_mat_info             info,
-                                               size_t*                        buffer_size)
+rocsparse_status rocsparse_csritilu0_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const double*             csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 size_t*                   buffer_size)
 {
-    return rocsparse_cbsrilu0_buffer_size(handle,
-                                          dir,
-                                          mb,
-                                          nnzb,
-                                          descr,
-                                          (const rocsparse_float_complex*)bsr_val,
-                                          bsr_row_ptr,
-                                          bsr_col_ind,
-                                          block_dim,
-                                          info,
-                                          buffer_size);
+    return rocsparse_dcsritilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0_buffer_size(rocsparse_handle                handle,
-                                               rocsparse_direction             dir,
-                                               rocsparse_int                   mb,
-                                               rocsparse_int                   nnzb,
-                                               const rocsparse_mat_descr       descr,
-                                               const rocsparse_double_complex* bsr_val,
-                                               const rocsparse_int*            bsr_row_ptr,
-                                               const rocsparse_int*            bsr_col_ind,
-                                               rocsparse_int                   block_dim,
-                                               rocsparse_mat_info              info,
-                                               size_t*                         buffer_size)
+rocsparse_status rocsparse_csritilu0_buffer_size(rocsparse_handle               handle,
+                                                 rocsparse_int                  m,
+                                                 rocsparse_int                  nnz,
+                                                 const rocsparse_mat_descr      descr,
+                                                 const rocsparse_float_complex* csr_val,
+                                                 const rocsparse_int*           csr_row_ptr,
+                                                 const rocsparse_int*           csr_col_ind,
+                                                 size_t*                        buffer_size)
 {
-    return rocsparse_zbsrilu0_buffer_size(handle,
-                                          dir,
-                                          mb,
-                                          nnzb,
-                                          descr,
-                                          (const rocsparse_double_complex*)bsr_val,
-                                          bsr_row_ptr,
-                                          bsr_col_ind,
-                                          block_dim,
-                                          info,
-                                          buffer_size);
+    return rocsparse_ccsritilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                 rocsparse_mat_info info,
-                                                 int                enable_boost,
-                                                 const float*       boost_tol,
-                                                 const float*       boost_val)
+rocsparse_status rocsparse_csritilu0_buffer_size(rocsparse_handle                handle,
+                                                 rocsparse_int                   m,
+                                                 rocsparse_int                   nnz,
+                                                 const rocsparse_mat_descr       descr,
+                                                 const rocsparse_double_complex* csr_val,
+                                                 const rocsparse_int*            csr_row_ptr,
+                                                 const rocsparse_int*            csr_col_ind,
+                                                 size_t*                         buffer_size)
 {
-    return rocsparse_sbsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+    return rocsparse_zcsritilu0_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                 rocsparse_mat_info info,
-                                                 int                enable_boost,
-                                                 const double*      boost_tol,
-                                                 const double*      boost_val)
+rocsparse_status rocsparse_csritilu0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     float*                    csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     float*                    history,
+                                     void*                     temp_buffer)
 {
-    return rocsparse_dbsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+    return rocsparse_scsritilu0(handle,
+                                m,
+                                nnz,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                info,
+                                nsweeps,
+                                history,
+                                temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0_numeric_boost(rocsparse_handle               handle,
-                                                 rocsparse_mat_info             info,
-                                                 int                            enable_boost,
-                                                 const float*                   boost_tol,
-                                                 const rocsparse_float_complex* boost_val)
+rocsparse_status rocsparse_csritilu0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     double*                   csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     double*                   history,
+                                     void*                     temp_buffer)
 {
-    return rocsparse_cbsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+    return rocsparse_dcsritilu0(handle,
+                                m,
+                                nnz,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                info,
+                                nsweeps,
+                                history,
+                                temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0_numeric_boost(rocsparse_handle                handle,
-                                                 rocsparse_mat_info              info,
-                                                 int                             enable_boost,
-                                                 const double*                   boost_tol,
-                                                 const rocsparse_double_complex* boost_val)
+rocsparse_status rocsparse_csritilu0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     rocsparse_float_complex*  csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     float*                    history,
+                                     void*                     temp_buffer)
 {
-    return rocsparse_zbsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+    return rocsparse_ccsritilu0(handle,
+                                m,
+                                nnz,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                info,
+                                nsweeps,
+                                history,
+                                temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle          handle,
-                                            rocsparse_direction       dir,
-                                            rocsparse_int             mb,
-                                            rocsparse_int             nnzb,
-                                            const rocsparse_mat_descr descr,
-                                            const float*              bsr_val,
-                                            const rocsparse_int*      bsr_row_ptr,
-                                            const rocsparse_int*      bsr_col_ind,
-                                            rocsparse_int             block_dim,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer)
+rocsparse_status rocsparse_csritilu0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     double*                   history,
+                                     void*                     temp_buffer)
+{
+    return rocsparse_zcsritilu0(handle,
+                                m,
+                                nnz,
+                                descr,
+                                csr_val,
+                                csr_row_ptr,
+                                csr_col_ind,
+                                info,
+                                nsweeps,
+                                history,
+                                temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csritic0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    float*                    csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_int             nsweeps,
+                                    float*                    history,
+                                    void*                     temp_buffer)
+{
+    return rocsparse_scsritic0(handle,
+                               m,
+                               nnz,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               nsweeps,
+                               history,
+                               temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csritic0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    double*                   csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_int             nsweeps,
+                                    double*                   history,
+                                    void*                     temp_buffer)
+{
+    return rocsparse_dcsritic0(handle,
+                               m,
+                               nnz,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               nsweeps,
+                               history,
+                               temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csritic0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_float_complex*  csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_int             nsweeps,
+                                    float*                    history,
+                                    void*                     temp_buffer)
+{
+    return rocsparse_ccsritic0(handle,
+                               m,
+                               nnz,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               nsweeps,
+                               history,
+                               temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csritic0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_int             nsweeps,
+                                    double*                   history,
+                                    void*                     temp_buffer)
+{
+    return rocsparse_zcsritic0(handle,
+                               m,
+                               nnz,
+                               descr,
+                               csr_val,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               info,
+                               nsweeps,
+                               history,
+                               temp_buffer);
+}
+
+// csrilut
+template <>
+rocsparse_status rocsparse_csrilut_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             max_fill,
+                                               size_t*                   buffer_size)
 {
-    return rocsparse_sbsrilu0_analysis(handle,
-                                       dir,
-                                       mb,
-                                       nnzb,
-                                       descr,
-                                       bsr_val,
-                                       bsr_row_ptr,
-                                       bsr_col_ind,
-                                       block_dim,
-                                       info,
-                                       analysis,
-                                       solve,
-                                       temp_buffer);
+    return rocsparse_scsrilut_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, max_fill, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle          handle,
-                                            rocsparse_direction       dir,
-                                            rocsparse_int             mb,
-                                            rocsparse_int             nnzb,
-                                            const rocsparse_mat_descr descr,
-                                            const double*             bsr_val,
-                                            const rocsparse_int*      bsr_row_ptr,
-                                            const rocsparse_int*      bsr_col_ind,
-                                            rocsparse_int             block_dim,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer)
+rocsparse_status rocsparse_csrilut_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             max_fill,
+                                               size_t*                   buffer_size)
 {
-    return rocsparse_dbsrilu0_analysis(handle,
-                                       dir,
-                                       mb,
-                                       nnzb,
-                                       descr,
-                                       bsr_val,
-                                       bsr_row_ptr,
-                                       bsr_col_ind,
-                                       block_dim,
-                                       info,
-                                       analysis,
-                                       solve,
-                                       temp_buffer);
+    return rocsparse_dcsrilut_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, max_fill, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle               handle,
-                                            rocsparse_direction            dir,
-                                            rocsparse_int                  mb,
-                                            rocsparse_int                  nnzb,
-                                            const rocsparse_mat_descr      descr,
-                                            const rocsparse_float_complex* bsr_val,
-                                            const rocsparse_int*           bsr_row_ptr,
-                                            const rocsparse_int*           bsr_col_ind,
-                                            rocsparse_int                  block_dim,
-                                            rocsparse_mat_info             info,
-                                            rocsparse_analysis_policy      analysis,
-                                            rocsparse_solve_policy         solve,
-                                            void*                          temp_buffer)
+rocsparse_status rocsparse_csrilut_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  nnz,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               const rocsparse_int*           csr_col_ind,
+                                               rocsparse_int                  max_fill,
+                                               size_t*                        buffer_size)
 {
-    return rocsparse_cbsrilu0_analysis(handle,
-                                       dir,
-                                       mb,
-                                       nnzb,
-                                       descr,
-                                       (const rocsparse_float_complex*)bsr_val,
-                                       bsr_row_ptr,
-                                       bsr_col_ind,
-                                       block_dim,
-                                       info,
-                                       analysis,
-                                       solve,
-                                       temp_buffer);
+    return rocsparse_ccsrilut_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, max_fill, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0_analysis(rocsparse_handle                handle,
-                                            rocsparse_direction             dir,
-                                            rocsparse_int                   mb,
-                                            rocsparse_int                   nnzb,
-                                            const rocsparse_mat_descr       descr,
-                                            const rocsparse_double_complex* bsr_val,
-                                            const rocsparse_int*            bsr_row_ptr,
-                                            const rocsparse_int*            bsr_col_ind,
-                                            rocsparse_int                   block_dim,
-                                            rocsparse_mat_info              info,
-                                            rocsparse_analysis_policy       analysis,
-                                            rocsparse_solve_policy          solve,
-                                            void*                           temp_buffer)
+rocsparse_status rocsparse_csrilut_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   nnz,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               const rocsparse_int*            csr_col_ind,
+                                               rocsparse_int                   max_fill,
+                                               size_t*                         buffer_size)
 {
-    return rocsparse_zbsrilu0_analysis(handle,
-                                       dir,
-                                       mb,
-                                       nnzb,
-                                       descr,
-                                       (const rocsparse_double_complex*)bsr_val,
-                                       bsr_row_ptr,
-                                       bsr_col_ind,
-                                       block_dim,
-                                       info,
-                                       analysis,
-                                       solve,
-                                       temp_buffer);
+    return rocsparse_zcsrilut_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, max_fill, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
+rocsparse_status rocsparse_csrilut(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
                                    const rocsparse_mat_descr descr,
-                                   float*                    bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
+                                   const float*              csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
                                    rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
+                                   float                     tol,
+                                   rocsparse_int             max_fill,
+                                   rocsparse_int*            csr_row_ptr_lu,
+                                   rocsparse_int*            csr_col_ind_lu,
+                                   float*                    csr_val_lu,
                                    void*                     temp_buffer)
 {
-    return rocsparse_sbsrilu0(handle,
-                              dir,
-                              mb,
-                              nnzb,
+    return rocsparse_scsrilut(handle,
+                              m,
+                              nnz,
                               descr,
-                              bsr_val,
-                              bsr_row_ptr,
-                              bsr_col_ind,
-                              block_dim,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
                               info,
-                              policy,
+                              tol,
+                              max_fill,
+                              csr_row_ptr_lu,
+                              csr_col_ind_lu,
+                              csr_val_lu,
                               temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
+rocsparse_status rocsparse_csrilut(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
                                    const rocsparse_mat_descr descr,
-                                   double*                   bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
+                                   const double*             csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
                                    rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
+                                   double                    tol,
+                                   rocsparse_int             max_fill,
+                                   rocsparse_int*            csr_row_ptr_lu,
+                                   rocsparse_int*            csr_col_ind_lu,
+                                   double*                   csr_val_lu,
                                    void*                     temp_buffer)
 {
-    return rocsparse_dbsrilu0(handle,
-                              dir,
-                              mb,
-                              nnzb,
+    return rocsparse_dcsrilut(handle,
+                              m,
+                              nnz,
                               descr,
-                              bsr_val,
-                              bsr_row_ptr,
-                              bsr_col_ind,
-                              block_dim,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
                               info,
-                              policy,
+                              tol,
+                              max_fill,
+                              csr_row_ptr_lu,
+                              csr_col_ind_lu,
+                              csr_val_lu,
                               temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_float_complex*  bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer)
+rocsparse_status rocsparse_csrilut(rocsparse_handle               handle,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  nnz,
+                                   const rocsparse_mat_descr      descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int*           csr_row_ptr,
+                                   const rocsparse_int*           csr_col_ind,
+                                   rocsparse_mat_info             info,
+                                   float                          tol,
+                                   rocsparse_int                  max_fill,
+                                   rocsparse_int*                 csr_row_ptr_lu,
+                                   rocsparse_int*                 csr_col_ind_lu,
+                                   rocsparse_float_complex*       csr_val_lu,
+                                   void*                          temp_buffer)
 {
-    return rocsparse_cbsrilu0(handle,
-                              dir,
-                              mb,
-                              nnzb,
+    return rocsparse_ccsrilut(handle,
+                              m,
+                              nnz,
                               descr,
-                              (rocsparse_float_complex*)bsr_val,
-                              bsr_row_ptr,
-                              bsr_col_ind,
-                              block_dim,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
                               info,
-                              policy,
+                              tol,
+                              max_fill,
+                              csr_row_ptr_lu,
+                              csr_col_ind_lu,
+                              csr_val_lu,
                               temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_double_complex* bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer)
+rocsparse_status rocsparse_csrilut(rocsparse_handle                handle,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   nnz,
+                                   const rocsparse_mat_descr       descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*            csr_row_ptr,
+                                   const rocsparse_int*            csr_col_ind,
+                                   rocsparse_mat_info              info,
+                                   double                          tol,
+                                   rocsparse_int                   max_fill,
+                                   rocsparse_int*                  csr_row_ptr_lu,
+                                   rocsparse_int*                  csr_col_ind_lu,
+                                   rocsparse_double_complex*       csr_val_lu,
+                                   void*                           temp_buffer)
 {
-    return rocsparse_zbsrilu0(handle,
-                              dir,
-                              mb,
-                              nnzb,
+    return rocsparse_zcsrilut(handle,
+                              m,
+                              nnz,
                               descr,
-                              (rocsparse_double_complex*)bsr_val,
-                              bsr_row_ptr,
-                              bsr_col_ind,
-                              block_dim,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
                               info,
-                              policy,
+                              tol,
+                              max_fill,
+                              csr_row_ptr_lu,
+                              csr_col_ind_lu,
+                              csr_val_lu,
                               temp_buffer);
 }
 
-// csric0
 template <>
-rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_int             m,
-                                              rocsparse_int             nnz,
-                                              const rocsparse_mat_descr descr,
-                                              const float*              csr_val,
-                                              const rocsparse_int*      csr_row_ptr,
-                                              const rocsparse_int*      csr_col_ind,
-                                              rocsparse_mat_info        info,
-                                              size_t*                   buffer_size)
+rocsparse_status rocsparse_csrict(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const float*              csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
+                                  float                     tol,
+                                  rocsparse_int             max_fill,
+                                  rocsparse_int*            csr_row_ptr_l,
+                                  rocsparse_int*            csr_col_ind_l,
+                                  float*                    csr_val_l,
+                                  void*                     temp_buffer)
 {
-    return rocsparse_scsric0_buffer_size(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    return rocsparse_scsrict(handle,
+                             m,
+                             nnz,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             tol,
+                             max_fill,
+                             csr_row_ptr_l,
+                             csr_col_ind_l,
+                             csr_val_l,
+                             temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
-                                              rocsparse_int             m,
-                                              rocsparse_int             nnz,
-                                              const rocsparse_mat_descr descr,
-                                              const double*             csr_val,
-                                              const rocsparse_int*      csr_row_ptr,
-                                              const rocsparse_int*      csr_col_ind,
-                                              rocsparse_mat_info        info,
-                                              size_t*                   buffer_size)
+rocsparse_status rocsparse_csrict(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const double*             csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
+                                  double                    tol,
+                                  rocsparse_int             max_fill,
+                                  rocsparse_int*            csr_row_ptr_l,
+                                  rocsparse_int*            csr_col_ind_l,
+                                  double*                   csr_val_l,
+                                  void*                     temp_buffer)
 {
-    return rocsparse_dcsric0_buffer_size(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    return rocsparse_dcsrict(handle,
+                             m,
+                             nnz,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             tol,
+                             max_fill,
+                             csr_row_ptr_l,
+                             csr_col_ind_l,
+                             csr_val_l,
+                             temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle               handle,
-                                              rocsparse_int                  m,
-                                              rocsparse_int                  nnz,
-                                              const rocsparse_mat_descr      descr,
-                                              const rocsparse_float_complex* csr_val,
-                                              const rocsparse_int*           csr_row_ptr,
-                                              const rocsparse_int*           csr_col_ind,
-                                              rocsparse_mat_info             info,
-                                              size_t*                        buffer_size)
+rocsparse_status rocsparse_csrict(rocsparse_handle               handle,
+                                  rocsparse_int                  m,
+                                  rocsparse_int                  nnz,
+                                  const rocsparse_mat_descr      descr,
+                                  const rocsparse_float_complex* csr_val,
+                                  const rocsparse_int*           csr_row_ptr,
+                                  const rocsparse_int*           csr_col_ind,
+                                  rocsparse_mat_info             info,
+                                  float                          tol,
+                                  rocsparse_int                  max_fill,
+                                  rocsparse_int*                 csr_row_ptr_l,
+                                  rocsparse_int*                 csr_col_ind_l,
+                                  rocsparse_float_complex*       csr_val_l,
+                                  void*                          temp_buffer)
 {
-    return rocsparse_ccsric0_buffer_size(handle,
-                                         m,
-                                         nnz,
-                                         descr,
-                                         (const rocsparse_float_complex*)csr_val,
-                                         csr_row_ptr,
-                                         csr_col_ind,
-                                         info,
-                                         buffer_size);
+    return rocsparse_ccsrict(handle,
+                             m,
+                             nnz,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             tol,
+                             max_fill,
+                             csr_row_ptr_l,
+                             csr_col_ind_l,
+                             csr_val_l,
+                             temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle                handle,
-                                              rocsparse_int                   m,
-                                              rocsparse_int                   nnz,
-                                              const rocsparse_mat_descr       descr,
-                                              const rocsparse_double_complex* csr_val,
-                                              const rocsparse_int*            csr_row_ptr,
-                                              const rocsparse_int*            csr_col_ind,
-                                              rocsparse_mat_info              info,
-                                              size_t*                         buffer_size)
+rocsparse_status rocsparse_csrict(rocsparse_handle                handle,
+                                  rocsparse_int                   m,
+                                  rocsparse_int                   nnz,
+                                  const rocsparse_mat_descr       descr,
+                                  const rocsparse_double_complex* csr_val,
+                                  const rocsparse_int*            csr_row_ptr,
+                                  const rocsparse_int*            csr_col_ind,
+                                  rocsparse_mat_info              info,
+                                  double                          tol,
+                                  rocsparse_int                   max_fill,
+                                  rocsparse_int*                  csr_row_ptr_l,
+                                  rocsparse_int*                  csr_col_ind_l,
+                                  rocsparse_double_complex*       csr_val_l,
+                                  void*                           temp_buffer)
 {
-    return rocsparse_zcsric0_buffer_size(handle,
-                                         m,
-                                         nnz,
-                                         descr,
-                                         (const rocsparse_double_complex*)csr_val,
-                                         csr_row_ptr,
-                                         csr_col_ind,
-                                         info,
-                                         buffer_size);
+    return rocsparse_zcsrict(handle,
+                             m,
+                             nnz,
+                             descr,
+                             csr_val,
+                             csr_row_ptr,
+                             csr_col_ind,
+                             info,
+                             tol,
+                             max_fill,
+                             csr_row_ptr_l,
+                             csr_col_ind_l,
+                             csr_val_l,
+                             temp_buffer);
 }
 
+// csrfsai
 template <>
-rocsparse_status rocsparse_csric0_analysis(rocsparse_handle          handle,
-                                           rocsparse_int             m,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const float*              csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer)
+rocsparse_status rocsparse_csrfsai_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz_A,
+                                               const rocsparse_mat_descr descr_A,
+                                               const float*              csr_val_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const rocsparse_mat_descr descr_G,
+                                               const rocsparse_int*      csr_row_ptr_G,
+                                               size_t*                   buffer_size)
 {
-    return rocsparse_scsric0_analysis(handle,
-                                      m,
-                                      nnz,
-                                      descr,
-                                      csr_val,
-                                      csr_row_ptr,
-                                      csr_col_ind,
-                                      info,
-                                      analysis,
-                                      solve,
-                                      temp_buffer);
+    return rocsparse_scsrfsai_buffer_size(handle,
+                                          m,
+                                          nnz_A,
+                                          descr_A,
+                                          csr_val_A,
+                                          csr_row_ptr_A,
+                                          csr_col_ind_A,
+                                          descr_G,
+                                          csr_row_ptr_G,
+                                          buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csric0_analysis(rocsparse_handle          handle,
-                                           rocsparse_int             m,
-                                           rocsparse_int             nnz,
-                                           const rocsparse_mat_descr descr,
-                                           const double*             csr_val,
-                                           const rocsparse_int*      csr_row_ptr,
-                                           const rocsparse_int*      csr_col_ind,
-                                           rocsparse_mat_info        info,
-                                           rocsparse_analysis_policy analysis,
-                                           rocsparse_solve_policy    solve,
-                                           void*                     temp_buffer)
+rocsparse_status rocsparse_csrfsai_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz_A,
+                                               const rocsparse_mat_descr descr_A,
+                                               const double*             csr_val_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const rocsparse_mat_descr descr_G,
+                                               const rocsparse_int*      csr_row_ptr_G,
+                                               size_t*                   buffer_size)
 {
-    return rocsparse_dcsric0_analysis(handle,
-                                      m,
-                                      nnz,
-                                      descr,
-                                      csr_val,
-                                      csr_row_ptr,
-                                      csr_col_ind,
-                                      info,
-                                      analysis,
-                                      solve,
-                                      temp_buffer);
+    return rocsparse_dcsrfsai_buffer_size(handle,
+                                          m,
+                                          nnz_A,
+                                          descr_A,
+                                          csr_val_A,
+                                          csr_row_ptr_A,
+                                          csr_col_ind_A,
+                                          descr_G,
+                                          csr_row_ptr_G,
+                                          buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csric0_analysis(rocsparse_handle               handle,
-                                           rocsparse_int                  m,
-                                           rocsparse_int                  nnz,
-                                           const rocsparse_mat_descr      descr,
-                                           const rocsparse_float_complex* csr_val,
-                                           const rocsparse_int*           csr_row_ptr,
-                                           const rocsparse_int*           csr_col_ind,
-                                           rocsparse_mat_info             info,
-                                           rocsparse_analysis_policy      analysis,
-                                           rocsparse_solve_policy         solve,
-                                           void*                          temp_buffer)
+rocsparse_status rocsparse_csrfsai_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  nnz_A,
+                                               const rocsparse_mat_descr      descr_A,
+                                               const rocsparse_float_complex* csr_val_A,
+                                               const rocsparse_int*           csr_row_ptr_A,
+                                               const rocsparse_int*           csr_col_ind_A,
+                                               const rocsparse_mat_descr      descr_G,
+                                               const rocsparse_int*           csr_row_ptr_G,
+                                               size_t*                        buffer_size)
 {
-    return rocsparse_ccsric0_analysis(handle,
-                                      m,
-                                      nnz,
-                                      descr,
-                                      (const rocsparse_float_complex*)csr_val,
-                                      csr_row_ptr,
-                                      csr_col_ind,
-                                      info,
-                                      analysis,
-                                      solve,
-                                      temp_buffer);
+    return rocsparse_ccsrfsai_buffer_size(handle,
+                                          m,
+                                          nnz_A,
+                                          descr_A,
+                                          csr_val_A,
+                                          csr_row_ptr_A,
+                                          csr_col_ind_A,
+                                          descr_G,
+                                          csr_row_ptr_G,
+                                          buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csric0_analysis(rocsparse_handle                handle,
-                                           rocsparse_int                   m,
-                                           rocsparse_int                   nnz,
-                                           const rocsparse_mat_descr       descr,
-                                           const rocsparse_double_complex* csr_val,
-                                           const rocsparse_int*            csr_row_ptr,
-                                           const rocsparse_int*            csr_col_ind,
-                                           rocsparse_mat_info              info,
-                                           rocsparse_analysis_policy       analysis,
-                                           rocsparse_solve_policy          solve,
-                                           void*                           temp_buffer)
+rocsparse_status rocsparse_csrfsai_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   nnz_A,
+                                               const rocsparse_mat_descr       descr_A,
+                                               const rocsparse_double_complex* csr_val_A,
+                                               const rocsparse_int*            csr_row_ptr_A,
+                                               const rocsparse_int*            csr_col_ind_A,
+                                               const rocsparse_mat_descr       descr_G,
+                                               const rocsparse_int*            csr_row_ptr_G,
+                                               size_t*                         buffer_size)
 {
-    return rocsparse_zcsric0_analysis(handle,
-                                      m,
-                                      nnz,
-                                      descr,
-                                      (const rocsparse_double_complex*)csr_val,
-                                      csr_row_ptr,
-                                      csr_col_ind,
-                                      info,
-                                      analysis,
-                                      solve,
-                                      temp_buffer);
+    return rocsparse_zcsrfsai_buffer_size(handle,
+                                          m,
+                                          nnz_A,
+                                          descr_A,
+                                          csr_val_A,
+                                          csr_row_ptr_A,
+                                          csr_col_ind_A,
+                                          descr_G,
+                                          csr_row_ptr_G,
+                                          buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
-                                  rocsparse_int             m,
-                                  rocsparse_int             nnz,
-                                  const rocsparse_mat_descr descr,
-                                  float*                    csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  rocsparse_mat_info        info,
-                                  rocsparse_solve_policy    policy,
-                                  void*                     temp_buffer)
+rocsparse_status rocsparse_csrfsai(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz_A,
+                                   const rocsparse_mat_descr descr_A,
+                                   const float*              csr_val_A,
+                                   const rocsparse_int*      csr_row_ptr_A,
+                                   const rocsparse_int*      csr_col_ind_A,
+                                   rocsparse_int             nnz_S,
+                                   const rocsparse_mat_descr descr_S,
+                                   const rocsparse_int*      csr_row_ptr_S,
+                                   const rocsparse_int*      csr_col_ind_S,
+                                   rocsparse_mat_info        info,
+                                   const rocsparse_mat_descr descr_G,
+                                   float*                    csr_val_G,
+                                   const rocsparse_int*      csr_row_ptr_G,
+                                   rocsparse_int*            csr_col_ind_G,
+                                   void*                     temp_buffer)
 {
-    return rocsparse_scsric0(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    return rocsparse_scsrfsai(handle,
+                              m,
+                              nnz_A,
+                              descr_A,
+                              csr_val_A,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              nnz_S,
+                              descr_S,
+                              csr_row_ptr_S,
+                              csr_col_ind_S,
+                              info,
+                              descr_G,
+                              csr_val_G,
+                              csr_row_ptr_G,
+                              csr_col_ind_G,
+                              temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
-                                  rocsparse_int             m,
-                                  rocsparse_int             nnz,
-                                  const rocsparse_mat_descr descr,
-                                  double*                   csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  rocsparse_mat_info        info,
-                                  rocsparse_solve_policy    policy,
-                                  void*                     temp_buffer)
+rocsparse_status rocsparse_csrfsai(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz_A,
+                                   const rocsparse_mat_descr descr_A,
+                                   const double*             csr_val_A,
+                                   const rocsparse_int*      csr_row_ptr_A,
+                                   const rocsparse_int*      csr_col_ind_A,
+                                   rocsparse_int             nnz_S,
+                                   const rocsparse_mat_descr descr_S,
+                                   const rocsparse_int*      csr_row_ptr_S,
+                                   const rocsparse_int*      csr_col_ind_S,
+                                   rocsparse_mat_info        info,
+                                   const rocsparse_mat_descr descr_G,
+                                   double*                   csr_val_G,
+                                   const rocsparse_int*      csr_row_ptr_G,
+                                   rocsparse_int*            csr_col_ind_G,
+                                   void*                     temp_buffer)
 {
-    return rocsparse_dcsric0(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    return rocsparse_dcsrfsai(handle,
+                              m,
+                              nnz_A,
+                              descr_A,
+                              csr_val_A,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              nnz_S,
+                              descr_S,
+                              csr_row_ptr_S,
+                              csr_col_ind_S,
+                              info,
+                              descr_G,
+                              csr_val_G,
+                              csr_row_ptr_G,
+                              csr_col_ind_G,
+                              temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
-                                  rocsparse_int             m,
-                                  rocsparse_int             nnz,
-                                  const rocsparse_mat_descr descr,
-                                  rocsparse_float_complex*  csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  rocsparse_mat_info        info,
-                                  rocsparse_solve_policy    policy,
-                                  void*                     temp_buffer)
+rocsparse_status rocsparse_csrfsai(rocsparse_handle               handle,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  nnz_A,
+                                   const rocsparse_mat_descr      descr_A,
+                                   const rocsparse_float_complex* csr_val_A,
+                                   const rocsparse_int*           csr_row_ptr_A,
+                                   const rocsparse_int*           csr_col_ind_A,
+                                   rocsparse_int                  nnz_S,
+                                   const rocsparse_mat_descr      descr_S,
+                                   const rocsparse_int*           csr_row_ptr_S,
+                                   const rocsparse_int*           csr_col_ind_S,
+                                   rocsparse_mat_info             info,
+                                   const rocsparse_mat_descr      descr_G,
+                                   rocsparse_float_complex*       csr_val_G,
+                                   const rocsparse_int*           csr_row_ptr_G,
+                                   rocsparse_int*                 csr_col_ind_G,
+                                   void*                          temp_buffer)
 {
-    return rocsparse_ccsric0(handle,
-                             m,
-                             nnz,
-                             descr,
-                             (rocsparse_float_complex*)csr_val,
-                             csr_row_ptr,
-                             csr_col_ind,
-                             info,
-                             policy,
-                             temp_buffer);
+    return rocsparse_ccsrfsai(handle,
+                              m,
+                              nnz_A,
+                              descr_A,
+                              csr_val_A,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              nnz_S,
+                              descr_S,
+                              csr_row_ptr_S,
+                              csr_col_ind_S,
+                              info,
+                              descr_G,
+                              csr_val_G,
+                              csr_row_ptr_G,
+                              csr_col_ind_G,
+                              temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csric0(rocsparse_handle          handle,
-                                  rocsparse_int             m,
-                                  rocsparse_int             nnz,
-                                  const rocsparse_mat_descr descr,
-                                  rocsparse_double_complex* csr_val,
-                                  const rocsparse_int*      csr_row_ptr,
-                                  const rocsparse_int*      csr_col_ind,
-                                  rocsparse_mat_info        info,
-                                  rocsparse_solve_policy    policy,
-                                  void*                     temp_buffer)
+rocsparse_status rocsparse_csrfsai(rocsparse_handle                handle,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   nnz_A,
+                                   const rocsparse_mat_descr       descr_A,
+                                   const rocsparse_double_complex* csr_val_A,
+                                   const rocsparse_int*            csr_row_ptr_A,
+                                   const rocsparse_int*            csr_col_ind_A,
+                                   rocsparse_int                   nnz_S,
+                                   const rocsparse_mat_descr       descr_S,
+                                   const rocsparse_int*            csr_row_ptr_S,
+                                   const rocsparse_int*            csr_col_ind_S,
+                                   rocsparse_mat_info              info,
+                                   const rocsparse_mat_descr       descr_G,
+                                   rocsparse_double_complex*       csr_val_G,
+                                   const rocsparse_int*            csr_row_ptr_G,
+                                   rocsparse_int*                  csr_col_ind_G,
+                                   void*                           temp_buffer)
 {
-    return rocsparse_zcsric0(handle,
-                             m,
-                             nnz,
-                             descr,
-                             (rocsparse_double_complex*)csr_val,
-                             csr_row_ptr,
-                             csr_col_ind,
-                             info,
-                             policy,
-                             temp_buffer);
+    return rocsparse_zcsrfsai(handle,
+                              m,
+                              nnz_A,
+                              descr_A,
+                              csr_val_A,
+                              csr_row_ptr_A,
+                              csr_col_ind_A,
+                              nnz_S,
+                              descr_S,
+                              csr_row_ptr_S,
+                              csr_col_ind_S,
+                              info,
+                              descr_G,
+                              csr_val_G,
+                              csr_row_ptr_G,
+                              csr_col_ind_G,
+                              temp_buffer);
 }
 
-// csrilu0
+// csrcheb
 template <>
-rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
+rocsparse_status rocsparse_csrcheb_buffer_size(rocsparse_handle          handle,
                                                rocsparse_int             m,
                                                rocsparse_int             nnz,
                                                const rocsparse_mat_descr descr,
                                                const float*              csr_val,
                                                const rocsparse_int*      csr_row_ptr,
                                                const rocsparse_int*      csr_col_ind,
-                                               rocsparse_mat_info        info,
                                                size_t*                   buffer_size)
 {
-    return rocsparse_scsrilu0_buffer_size(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    return rocsparse_scsrcheb_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle          handle,
+rocsparse_status rocsparse_csrcheb_buffer_size(rocsparse_handle          handle,
                                                rocsparse_int             m,
                                                rocsparse_int             nnz,
                                                const rocsparse_mat_descr descr,
                                                const double*             csr_val,
                                                const rocsparse_int*      csr_row_ptr,
                                                const rocsparse_int*      csr_col_ind,
-                                               rocsparse_mat_info        info,
                                                size_t*                   buffer_size)
 {
-    return rocsparse_dcsrilu0_buffer_size(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    return rocsparse_dcsrcheb_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle               handle,
+rocsparse_status rocsparse_csrcheb_buffer_size(rocsparse_handle               handle,
                                                rocsparse_int                  m,
                                                rocsparse_int                  nnz,
                                                const rocsparse_mat_descr      descr,
                                                const rocsparse_float_complex* csr_val,
                                                const rocsparse_int*           csr_row_ptr,
                                                const rocsparse_int*           csr_col_ind,
-                                               rocsparse_mat_info             info,
                                                size_t*                        buffer_size)
 {
-    return rocsparse_ccsrilu0_buffer_size(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    return rocsparse_ccsrcheb_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_buffer_size(rocsparse_handle                handle,
+rocsparse_status rocsparse_csrcheb_buffer_size(rocsparse_handle                handle,
                                                rocsparse_int                   m,
                                                rocsparse_int                   nnz,
                                                const rocsparse_mat_descr       descr,
                                                const rocsparse_double_complex* csr_val,
                                                const rocsparse_int*            csr_row_ptr,
                                                const rocsparse_int*            csr_col_ind,
-                                               rocsparse_mat_info              info,
                                                size_t*                         buffer_size)
 {
-    return rocsparse_zcsrilu0_buffer_size(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, buffer_size);
+    return rocsparse_zcsrcheb_buffer_size(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle   handle,
-                                                 rocsparse_mat_info info,
-                                                 int                enable_boost,
-                                                 const float*       boost_tol,
-                                                 const float*       boost_val)
+rocsparse_status rocsparse_csrcheb_estimate(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             iters,
+                                            float*                    lambda_max,
+                                            void*                     temp_buffer)
 {
-    return rocsparse_scsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+    return rocsparse_scsrcheb_estimate(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, iters, lambda_max, temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle   handle,
-                                                 rocsparse_mat_info info,
-                                                 int                enable_boost,
-                                                 const double*      boost_tol,
-                                                 const double*      boost_val)
+rocsparse_status rocsparse_csrcheb_estimate(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             iters,
+                                            double*                   lambda_max,
+                                            void*                     temp_buffer)
 {
-    return rocsparse_dcsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+    return rocsparse_dcsrcheb_estimate(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, iters, lambda_max, temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle               handle,
-                                                 rocsparse_mat_info             info,
-                                                 int                            enable_boost,
-                                                 const float*                   boost_tol,
-                                                 const rocsparse_float_complex* boost_val)
+rocsparse_status rocsparse_csrcheb_estimate(rocsparse_handle               handle,
+                                            rocsparse_int                  m,
+                                            rocsparse_int                  nnz,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* csr_val,
+                                            const rocsparse_int*           csr_row_ptr,
+                                            const rocsparse_int*           csr_col_ind,
+                                            rocsparse_int                  iters,
+                                            float*                         lambda_max,
+                                            void*                          temp_buffer)
 {
-    return rocsparse_ccsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+    return rocsparse_ccsrcheb_estimate(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, iters, lambda_max, temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_numeric_boost(rocsparse_handle                handle,
-                                                 rocsparse_mat_info              info,
-                                                 int                             enable_boost,
-                                                 const double*                   boost_tol,
-                                                 const rocsparse_double_complex* boost_val)
+rocsparse_status rocsparse_csrcheb_estimate(rocsparse_handle                handle,
+                                            rocsparse_int                   m,
+                                            rocsparse_int                   nnz,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* csr_val,
+                                            const rocsparse_int*            csr_row_ptr,
+                                            const rocsparse_int*            csr_col_ind,
+                                            rocsparse_int                   iters,
+                                            double*                         lambda_max,
+                                            void*                           temp_buffer)
 {
-    return rocsparse_zcsrilu0_numeric_boost(handle, info, enable_boost, boost_tol, boost_val);
+    return rocsparse_zcsrcheb_estimate(
+        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, iters, lambda_max, temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             nnz,
-                                            const rocsparse_mat_descr descr,
-                                            const float*              csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            const rocsparse_int*      csr_col_ind,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer)
+rocsparse_status rocsparse_csrcheb(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   const float*              csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             degree,
+                                   float                     lambda_min,
+                                   float                     lambda_max,
+                                   const float*              b,
+                                   float*                    x,
+                                   void*                     temp_buffer)
 {
-    return rocsparse_scsrilu0_analysis(handle,
-                                       m,
-                                       nnz,
-                                       descr,
-                                       csr_val,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       info,
-                                       analysis,
-                                       solve,
-                                       temp_buffer);
+    return rocsparse_scsrcheb(handle,
+                              m,
+                              nnz,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              degree,
+                              lambda_min,
+                              lambda_max,
+                              b,
+                              x,
+                              temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             nnz,
-                                            const rocsparse_mat_descr descr,
-                                            const double*             csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            const rocsparse_int*      csr_col_ind,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer)
+rocsparse_status rocsparse_csrcheb(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   const double*             csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             degree,
+                                   double                    lambda_min,
+                                   double                    lambda_max,
+                                   const double*             b,
+                                   double*                   x,
+                                   void*                     temp_buffer)
+{
+    return rocsparse_dcsrcheb(handle,
+                              m,
+                              nnz,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              degree,
+                              lambda_min,
+                              lambda_max,
+                              b,
+                              x,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrcheb(rocsparse_handle               handle,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  nnz,
+                                   const rocsparse_mat_descr      descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int*           csr_row_ptr,
+                                   const rocsparse_int*           csr_col_ind,
+                                   rocsparse_int                  degree,
+                                   float                          lambda_min,
+                                   float                          lambda_max,
+                                   const rocsparse_float_complex* b,
+                                   rocsparse_float_complex*       x,
+                                   void*                          temp_buffer)
+{
+    return rocsparse_ccsrcheb(handle,
+                              m,
+                              nnz,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              degree,
+                              lambda_min,
+                              lambda_max,
+                              b,
+                              x,
+                              temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrcheb(rocsparse_handle                handle,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   nnz,
+                                   const rocsparse_mat_descr       descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*            csr_row_ptr,
+                                   const rocsparse_int*            csr_col_ind,
+                                   rocsparse_int                   degree,
+                                   double                          lambda_min,
+                                   double                          lambda_max,
+                                   const rocsparse_double_complex* b,
+                                   rocsparse_double_complex*       x,
+                                   void*                           temp_buffer)
+{
+    return rocsparse_zcsrcheb(handle,
+                              m,
+                              nnz,
+                              descr,
+                              csr_val,
+                              csr_row_ptr,
+                              csr_col_ind,
+                              degree,
+                              lambda_min,
+                              lambda_max,
+                              b,
+                              x,
+                              temp_buffer);
+}
+
+// gtsv
+template <>
+rocsparse_status rocsparse_gtsv_buffer_size(rocsparse_handle handle,
+                                            rocsparse_int    m,
+                                            rocsparse_int    n,
+                                            const float*     dl,
+                                            const float*     d,
+                                            const float*     du,
+                                            const float*     B,
+                                            rocsparse_int    ldb,
+                                            size_t*          buffer_size)
 {
-    return rocsparse_dcsrilu0_analysis(handle,
-                                       m,
-                                       nnz,
-                                       descr,
-                                       csr_val,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       info,
-                                       analysis,
-                                       solve,
-                                       temp_buffer);
+    return rocsparse_sgtsv_buffer_size(handle, m, n, dl, d, du, B, ldb, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle               handle,
+rocsparse_status rocsparse_gtsv_buffer_size(rocsparse_handle handle,
+                                            rocsparse_int    m,
+                                            rocsparse_int    n,
+                                            const double*    dl,
+                                            const double*    d,
+                                            const double*    du,
+                                            const double*    B,
+                                            rocsparse_int    ldb,
+                                            size_t*          buffer_size)
+{
+    return rocsparse_dgtsv_buffer_size(handle, m, n, dl, d, du, B, ldb, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_gtsv_buffer_size(rocsparse_handle               handle,
                                             rocsparse_int                  m,
-                                            rocsparse_int                  nnz,
-                                            const rocsparse_mat_descr      descr,
-                                            const rocsparse_float_complex* csr_val,
-                                            const rocsparse_int*           csr_row_ptr,
-                                            const rocsparse_int*           csr_col_ind,
-                                            rocsparse_mat_info             info,
-                                            rocsparse_analysis_policy      analysis,
-                                            rocsparse_solve_policy         solve,
-                                            void*                          temp_buffer)
+                                            rocsparse_int                  n,
+                                            const rocsparse_float_complex* dl,
+                                            const rocsparse_float_complex* d,
+                                            const rocsparse_float_complex* du,
+                                            const rocsparse_float_complex* B,
+                                            rocsparse_int                  ldb,
+                                            size_t*                        buffer_size)
 {
-    return rocsparse_ccsrilu0_analysis(handle,
-                                       m,
-                                       nnz,
-                                       descr,
-                                       csr_val,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       info,
-                                       analysis,
-                                       solve,
-                                       temp_buffer);
+    return rocsparse_cgtsv_buffer_size(handle, m, n, dl, d, du, B, ldb, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0_analysis(rocsparse_handle                handle,
+rocsparse_status rocsparse_gtsv_buffer_size(rocsparse_handle                handle,
                                             rocsparse_int                   m,
-                                            rocsparse_int                   nnz,
-                                            const rocsparse_mat_descr       descr,
-                                            const rocsparse_double_complex* csr_val,
-                                            const rocsparse_int*            csr_row_ptr,
-                                            const rocsparse_int*            csr_col_ind,
-                                            rocsparse_mat_info              info,
-                                            rocsparse_analysis_policy       analysis,
-                                            rocsparse_solve_policy          solve,
-                                            void*                           temp_buffer)
+                                            rocsparse_int                   n,
+                                            const rocsparse_double_complex* dl,
+                                            const rocsparse_double_complex* d,
+                                            const rocsparse_double_complex* du,
+                                            const rocsparse_double_complex* B,
+                                            rocsparse_int                   ldb,
+                                            size_t*                         buffer_size)
 {
-    return rocsparse_zcsrilu0_analysis(handle,
-                                       m,
-                                       nnz,
-                                       descr,
-                                       csr_val,
-                                       csr_row_ptr,
-                                       csr_col_ind,
-                                       info,
-                                       analysis,
-                                       solve,
-                                       temp_buffer);
+    return rocsparse_zgtsv_buffer_size(handle, m, n, dl, d, du, B, ldb, buffer_size);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   float*                    csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer)
+rocsparse_status rocsparse_gtsv(rocsparse_handle handle,
+                                rocsparse_int    m,
+                                rocsparse_int    n,
+                                const float*     dl,
+                                const float*     d,
+                                const float*     du,
+                                float*           B,
+                                rocsparse_int    ldb,
+                                void*            temp_buffer)
 {
-    return rocsparse_scsrilu0(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    return rocsparse_sgtsv(handle, m, n, dl, d, du, B, ldb, temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   double*                   csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer)
+rocsparse_status rocsparse_gtsv(rocsparse_handle handle,
+                                rocsparse_int    m,
+                                rocsparse_int    n,
+                                const double*    dl,
+                                const double*    d,
+                                const double*    du,
+                                double*          B,
+                                rocsparse_int    ldb,
+                                void*            temp_buffer)
 {
-    return rocsparse_dcsrilu0(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    return rocsparse_dgtsv(handle, m, n, dl, d, du, B, ldb, temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_float_complex*  csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer)
+rocsparse_status rocsparse_gtsv(rocsparse_handle               handle,
+                                rocsparse_int                  m,
+                                rocsparse_int                  n,
+                                const rocsparse_float_complex* dl,
+                                const rocsparse_float_complex* d,
+                                const rocsparse_float_complex* du,
+                                rocsparse_float_complex*       B,
+                                rocsparse_int                  ldb,
+                                void*                          temp_buffer)
 {
-    return rocsparse_ccsrilu0(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    return rocsparse_cgtsv(handle, m, n, dl, d, du, B, ldb, temp_buffer);
 }
 
 template <>
-rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_double_complex* csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer)
+rocsparse_status rocsparse_gtsv(rocsparse_handle                handle,
+                                rocsparse_int                   m,
+                                rocsparse_int                   n,
+                                const rocsparse_double_complex* dl,
+                                const rocsparse_double_complex* d,
+                                const rocsparse_double_complex* du,
+                                rocsparse_double_complex*       B,
+                                rocsparse_int                   ldb,
+                                void*                           temp_buffer)
 {
-    return rocsparse_zcsrilu0(
-        handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, policy, temp_buffer);
+    return rocsparse_zgtsv(handle, m, n, dl, d, du, B, ldb, temp_buffer);
 }
 
+
 // gtsv_no_pivot
 template <>
 rocsparse_status rocsparse_gtsv_no_pivot_buffer_size(rocsparse_handle handle,
@@ -4877,6 +8294,545 @@ rocsparse_status rocsparse_gtsv_no_pivot(rocsparse_handle                handle,
     return rocsparse_zgtsv_no_pivot(handle, m, n, dl, d, du, B, ldb, temp_buffer);
 }
 
+// gtsv_no_pivot_strided_batch
+template <>
+rocsparse_status rocsparse_gtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   const float*     dl,
+                                                                   const float*     d,
+                                                                   const float*     du,
+                                                                   const float*     x,
+                                                                   rocsparse_int    batch_count,
+                                                                   rocsparse_int    batch_stride,
+                                                                   size_t*          buffer_size)
+{
+    return rocsparse_sgtsv_no_pivot_strided_batch_buffer_size(
+        handle, m, dl, d, du, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_gtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   const double*    dl,
+                                                                   const double*    d,
+                                                                   const double*    du,
+                                                                   const double*    x,
+                                                                   rocsparse_int    batch_count,
+                                                                   rocsparse_int    batch_stride,
+                                                                   size_t*          buffer_size)
+{
+    return rocsparse_dgtsv_no_pivot_strided_batch_buffer_size(
+        handle, m, dl, d, du, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_gtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle               handle,
+                                                      rocsparse_int                  m,
+                                                      const rocsparse_float_complex* dl,
+                                                      const rocsparse_float_complex* d,
+                                                      const rocsparse_float_complex* du,
+                                                      const rocsparse_float_complex* x,
+                                                      rocsparse_int                  batch_count,
+                                                      rocsparse_int                  batch_stride,
+                                                      size_t*                        buffer_size)
+{
+    return rocsparse_cgtsv_no_pivot_strided_batch_buffer_size(
+        handle, m, dl, d, du, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_gtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle                handle,
+                                                      rocsparse_int                   m,
+                                                      const rocsparse_double_complex* dl,
+                                                      const rocsparse_double_complex* d,
+                                                      const rocsparse_double_complex* du,
+                                                      const rocsparse_double_complex* x,
+                                                      rocsparse_int                   batch_count,
+                                                      rocsparse_int                   batch_stride,
+                                                      size_t*                         buffer_size)
+{
+    return rocsparse_zgtsv_no_pivot_strided_batch_buffer_size(
+        handle, m, dl, d, du, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_gtsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       const float*     dl,
+                                                       const float*     d,
+                                                       const float*     du,
+                                                       float*           x,
+                                                       rocsparse_int    batch_count,
+                                                       rocsparse_int    batch_stride,
+                                                       void*            temp_buffer)
+{
+    return rocsparse_sgtsv_no_pivot_strided_batch(
+        handle, m, dl, d, du, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_gtsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       const double*    dl,
+                                                       const double*    d,
+                                                       const double*    du,
+                                                       double*          x,
+                                                       rocsparse_int    batch_count,
+                                                       rocsparse_int    batch_stride,
+                                                       void*            temp_buffer)
+{
+    return rocsparse_dgtsv_no_pivot_strided_batch(
+        handle, m, dl, d, du, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_gtsv_no_pivot_strided_batch(rocsparse_handle               handle,
+                                                       rocsparse_int                  m,
+                                                       const rocsparse_float_complex* dl,
+                                                       const rocsparse_float_complex* d,
+                                                       const rocsparse_float_complex* du,
+                                                       rocsparse_float_complex*       x,
+                                                       rocsparse_int                  batch_count,
+                                                       rocsparse_int                  batch_stride,
+                                                       void*                          temp_buffer)
+{
+    return rocsparse_cgtsv_no_pivot_strided_batch(
+        handle, m, dl, d, du, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_gtsv_no_pivot_strided_batch(rocsparse_handle                handle,
+                                                       rocsparse_int                   m,
+                                                       const rocsparse_double_complex* dl,
+                                                       const rocsparse_double_complex* d,
+                                                       const rocsparse_double_complex* du,
+                                                       rocsparse_double_complex*       x,
+                                                       rocsparse_int                   batch_count,
+                                                       rocsparse_int                   batch_stride,
+                                                       void*                           temp_buffer)
+{
+    return rocsparse_zgtsv_no_pivot_strided_batch(
+        handle, m, dl, d, du, x, batch_count, batch_stride, temp_buffer);
+}
+
+
+// gtsv_interleaved_batch
+template <>
+rocsparse_status
+    rocsparse_gtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                 rocsparse_gtsv_interleaved_alg alg,
+                                                 rocsparse_int                  m,
+                                                 const float*                   dl,
+                                                 const float*                   d,
+                                                 const float*                   du,
+                                                 const float*                   x,
+                                                 rocsparse_int                  batch_count,
+                                                 rocsparse_int                  batch_stride,
+                                                 size_t*                        buffer_size)
+{
+    return rocsparse_sgtsv_interleaved_batch_buffer_size(
+        handle, alg, m, dl, d, du, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_gtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                 rocsparse_gtsv_interleaved_alg alg,
+                                                 rocsparse_int                  m,
+                                                 const double*                  dl,
+                                                 const double*                  d,
+                                                 const double*                  du,
+                                                 const double*                  x,
+                                                 rocsparse_int                  batch_count,
+                                                 rocsparse_int                  batch_stride,
+                                                 size_t*                        buffer_size)
+{
+    return rocsparse_dgtsv_interleaved_batch_buffer_size(
+        handle, alg, m, dl, d, du, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_gtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                 rocsparse_gtsv_interleaved_alg alg,
+                                                 rocsparse_int                  m,
+                                                 const rocsparse_float_complex* dl,
+                                                 const rocsparse_float_complex* d,
+                                                 const rocsparse_float_complex* du,
+                                                 const rocsparse_float_complex* x,
+                                                 rocsparse_int                  batch_count,
+                                                 rocsparse_int                  batch_stride,
+                                                 size_t*                        buffer_size)
+{
+    return rocsparse_cgtsv_interleaved_batch_buffer_size(
+        handle, alg, m, dl, d, du, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_gtsv_interleaved_batch_buffer_size(rocsparse_handle                handle,
+                                                 rocsparse_gtsv_interleaved_alg  alg,
+                                                 rocsparse_int                   m,
+                                                 const rocsparse_double_complex* dl,
+                                                 const rocsparse_double_complex* d,
+                                                 const rocsparse_double_complex* du,
+                                                 const rocsparse_double_complex* x,
+                                                 rocsparse_int                   batch_count,
+                                                 rocsparse_int                   batch_stride,
+                                                 size_t*                         buffer_size)
+{
+    return rocsparse_zgtsv_interleaved_batch_buffer_size(
+        handle, alg, m, dl, d, du, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_gtsv_interleaved_batch(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const float*                   dl,
+                                                  const float*                   d,
+                                                  const float*                   du,
+                                                  float*                         x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  void*                          temp_buffer)
+{
+    return rocsparse_sgtsv_interleaved_batch(
+        handle, alg, m, dl, d, du, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_gtsv_interleaved_batch(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const double*                  dl,
+                                                  const double*                  d,
+                                                  const double*                  du,
+                                                  double*                        x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  void*                          temp_buffer)
+{
+    return rocsparse_dgtsv_interleaved_batch(
+        handle, alg, m, dl, d, du, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_gtsv_interleaved_batch(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const rocsparse_float_complex* dl,
+                                                  const rocsparse_float_complex* d,
+                                                  const rocsparse_float_complex* du,
+                                                  rocsparse_float_complex*       x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  void*                          temp_buffer)
+{
+    return rocsparse_cgtsv_interleaved_batch(
+        handle, alg, m, dl, d, du, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_gtsv_interleaved_batch(rocsparse_handle                handle,
+                                                  rocsparse_gtsv_interleaved_alg  alg,
+                                                  rocsparse_int                   m,
+                                                  const rocsparse_double_complex* dl,
+                                                  const rocsparse_double_complex* d,
+                                                  const rocsparse_double_complex* du,
+                                                  rocsparse_double_complex*       x,
+                                                  rocsparse_int                   batch_count,
+                                                  rocsparse_int                   batch_stride,
+                                                  void*                           temp_buffer)
+{
+    return rocsparse_zgtsv_interleaved_batch(
+        handle, alg, m, dl, d, du, x, batch_count, batch_stride, temp_buffer);
+}
+
+// gpsv_no_pivot_strided_batch
+template <>
+rocsparse_status rocsparse_gpsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   const float*     ds,
+                                                                   const float*     dl,
+                                                                   const float*     d,
+                                                                   const float*     du,
+                                                                   const float*     dw,
+                                                                   const float*     x,
+                                                                   rocsparse_int    batch_count,
+                                                                   rocsparse_int    batch_stride,
+                                                                   size_t*          buffer_size)
+{
+    return rocsparse_sgpsv_no_pivot_strided_batch_buffer_size(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_gpsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   const double*    ds,
+                                                                   const double*    dl,
+                                                                   const double*    d,
+                                                                   const double*    du,
+                                                                   const double*    dw,
+                                                                   const double*    x,
+                                                                   rocsparse_int    batch_count,
+                                                                   rocsparse_int    batch_stride,
+                                                                   size_t*          buffer_size)
+{
+    return rocsparse_dgpsv_no_pivot_strided_batch_buffer_size(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_gpsv_no_pivot_strided_batch_buffer_size(rocsparse_handle               handle,
+                                                      rocsparse_int                  m,
+                                                      const rocsparse_float_complex* ds,
+                                                      const rocsparse_float_complex* dl,
+                                                      const rocsparse_float_complex* d,
+                                                      const rocsparse_float_complex* du,
+                                                      const rocsparse_float_complex* dw,
+                                                      const rocsparse_float_complex* x,
+                                                      rocsparse_int                  batch_count,
+                                                      rocsparse_int                  batch_stride,
+                                                      size_t*                        buffer_size)
+{
+    return rocsparse_cgpsv_no_pivot_strided_batch_buffer_size(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_gpsv_no_pivot_strided_batch_buffer_size(rocsparse_handle                handle,
+                                                      rocsparse_int                   m,
+                                                      const rocsparse_double_complex* ds,
+                                                      const rocsparse_double_complex* dl,
+                                                      const rocsparse_double_complex* d,
+                                                      const rocsparse_double_complex* du,
+                                                      const rocsparse_double_complex* dw,
+                                                      const rocsparse_double_complex* x,
+                                                      rocsparse_int                   batch_count,
+                                                      rocsparse_int                   batch_stride,
+                                                      size_t*                         buffer_size)
+{
+    return rocsparse_zgpsv_no_pivot_strided_batch_buffer_size(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_gpsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       const float*     ds,
+                                                       const float*     dl,
+                                                       const float*     d,
+                                                       const float*     du,
+                                                       const float*     dw,
+                                                       float*           x,
+                                                       rocsparse_int    batch_count,
+                                                       rocsparse_int    batch_stride,
+                                                       void*            temp_buffer)
+{
+    return rocsparse_sgpsv_no_pivot_strided_batch(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_gpsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       const double*    ds,
+                                                       const double*    dl,
+                                                       const double*    d,
+                                                       const double*    du,
+                                                       const double*    dw,
+                                                       double*          x,
+                                                       rocsparse_int    batch_count,
+                                                       rocsparse_int    batch_stride,
+                                                       void*            temp_buffer)
+{
+    return rocsparse_dgpsv_no_pivot_strided_batch(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_gpsv_no_pivot_strided_batch(rocsparse_handle               handle,
+                                                       rocsparse_int                  m,
+                                                       const rocsparse_float_complex* ds,
+                                                       const rocsparse_float_complex* dl,
+                                                       const rocsparse_float_complex* d,
+                                                       const rocsparse_float_complex* du,
+                                                       const rocsparse_float_complex* dw,
+                                                       rocsparse_float_complex*       x,
+                                                       rocsparse_int                  batch_count,
+                                                       rocsparse_int                  batch_stride,
+                                                       void*                          temp_buffer)
+{
+    return rocsparse_cgpsv_no_pivot_strided_batch(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_gpsv_no_pivot_strided_batch(rocsparse_handle                handle,
+                                                       rocsparse_int                   m,
+                                                       const rocsparse_double_complex* ds,
+                                                       const rocsparse_double_complex* dl,
+                                                       const rocsparse_double_complex* d,
+                                                       const rocsparse_double_complex* du,
+                                                       const rocsparse_double_complex* dw,
+                                                       rocsparse_double_complex*       x,
+                                                       rocsparse_int                   batch_count,
+                                                       rocsparse_int                   batch_stride,
+                                                       void*                           temp_buffer)
+{
+    return rocsparse_zgpsv_no_pivot_strided_batch(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer);
+}
+
+// gpsv_no_pivot_interleaved_batch
+template <>
+rocsparse_status
+    rocsparse_gpsv_no_pivot_interleaved_batch_buffer_size(rocsparse_handle handle,
+                                                          rocsparse_int    m,
+                                                          const float*     ds,
+                                                          const float*     dl,
+                                                          const float*     d,
+                                                          const float*     du,
+                                                          const float*     dw,
+                                                          const float*     x,
+                                                          rocsparse_int    batch_count,
+                                                          rocsparse_int    batch_stride,
+                                                          size_t*          buffer_size)
+{
+    return rocsparse_sgpsv_no_pivot_interleaved_batch_buffer_size(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status
+    rocsparse_gpsv_no_pivot_interleaved_batch_buffer_size(rocsparse_handle handle,
+                                                          rocsparse_int    m,
+                                                          const double*    ds,
+                                                          const double*    dl,
+                                                          const double*    d,
+                                                          const double*    du,
+                                                          const double*    dw,
+                                                          const double*    x,
+                                                          rocsparse_int    batch_count,
+                                                          rocsparse_int    batch_stride,
+                                                          size_t*          buffer_size)
+{
+    return rocsparse_dgpsv_no_pivot_interleaved_batch_buffer_size(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_gpsv_no_pivot_interleaved_batch_buffer_size(
+    rocsparse_handle               handle,
+    rocsparse_int                  m,
+    const rocsparse_float_complex* ds,
+    const rocsparse_float_complex* dl,
+    const rocsparse_float_complex* d,
+    const rocsparse_float_complex* du,
+    const rocsparse_float_complex* dw,
+    const rocsparse_float_complex* x,
+    rocsparse_int                  batch_count,
+    rocsparse_int                  batch_stride,
+    size_t*                        buffer_size)
+{
+    return rocsparse_cgpsv_no_pivot_interleaved_batch_buffer_size(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_gpsv_no_pivot_interleaved_batch_buffer_size(
+    rocsparse_handle                handle,
+    rocsparse_int                   m,
+    const rocsparse_double_complex* ds,
+    const rocsparse_double_complex* dl,
+    const rocsparse_double_complex* d,
+    const rocsparse_double_complex* du,
+    const rocsparse_double_complex* dw,
+    const rocsparse_double_complex* x,
+    rocsparse_int                   batch_count,
+    rocsparse_int                   batch_stride,
+    size_t*                         buffer_size)
+{
+    return rocsparse_zgpsv_no_pivot_interleaved_batch_buffer_size(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, buffer_size);
+}
+
+template <>
+rocsparse_status rocsparse_gpsv_no_pivot_interleaved_batch(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           const float*     ds,
+                                                           const float*     dl,
+                                                           const float*     d,
+                                                           const float*     du,
+                                                           const float*     dw,
+                                                           float*           x,
+                                                           rocsparse_int    batch_count,
+                                                           rocsparse_int    batch_stride,
+                                                           void*            temp_buffer)
+{
+    return rocsparse_sgpsv_no_pivot_interleaved_batch(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_gpsv_no_pivot_interleaved_batch(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           const double*    ds,
+                                                           const double*    dl,
+                                                           const double*    d,
+                                                           const double*    du,
+                                                           const double*    dw,
+                                                           double*          x,
+                                                           rocsparse_int    batch_count,
+                                                           rocsparse_int    batch_stride,
+                                                           void*            temp_buffer)
+{
+    return rocsparse_dgpsv_no_pivot_interleaved_batch(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status
+    rocsparse_gpsv_no_pivot_interleaved_batch(rocsparse_handle               handle,
+                                              rocsparse_int                  m,
+                                              const rocsparse_float_complex* ds,
+                                              const rocsparse_float_complex* dl,
+                                              const rocsparse_float_complex* d,
+                                              const rocsparse_float_complex* du,
+                                              const rocsparse_float_complex* dw,
+                                              rocsparse_float_complex*       x,
+                                              rocsparse_int                  batch_count,
+                                              rocsparse_int                  batch_stride,
+                                              void*                          temp_buffer)
+{
+    return rocsparse_cgpsv_no_pivot_interleaved_batch(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer);
+}
+
+template <>
+rocsparse_status
+    rocsparse_gpsv_no_pivot_interleaved_batch(rocsparse_handle                handle,
+                                              rocsparse_int                   m,
+                                              const rocsparse_double_complex* ds,
+                                              const rocsparse_double_complex* dl,
+                                              const rocsparse_double_complex* d,
+                                              const rocsparse_double_complex* du,
+                                              const rocsparse_double_complex* dw,
+                                              rocsparse_double_complex*       x,
+                                              rocsparse_int                   batch_count,
+                                              rocsparse_int                   batch_stride,
+                                              void*                           temp_buffer)
+{
+    return rocsparse_zgpsv_no_pivot_interleaved_batch(
+        handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer);
+}
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -7769,3 +11725,116 @@ rocsparse_status rocsparse_prune_csr2csr_by_percentage(rocsparse_handle
                                                   info,
                                                   temp_buffer);
 }
+
+// csrsympermute
+template <>
+rocsparse_status rocsparse_csrsympermute(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         rocsparse_int             nnz,
+                                         const rocsparse_mat_descr descr,
+                                         const float*              csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         const rocsparse_int*      perm,
+                                         float*                    csr_val_out,
+                                         rocsparse_int*            csr_row_ptr_out,
+                                         rocsparse_int*            csr_col_ind_out,
+                                         void*                     temp_buffer)
+{
+    return rocsparse_scsrsympermute(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    perm,
+                                    csr_val_out,
+                                    csr_row_ptr_out,
+                                    csr_col_ind_out,
+                                    temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsympermute(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         rocsparse_int             nnz,
+                                         const rocsparse_mat_descr descr,
+                                         const double*             csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         const rocsparse_int*      perm,
+                                         double*                   csr_val_out,
+                                         rocsparse_int*            csr_row_ptr_out,
+                                         rocsparse_int*            csr_col_ind_out,
+                                         void*                     temp_buffer)
+{
+    return rocsparse_dcsrsympermute(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    perm,
+                                    csr_val_out,
+                                    csr_row_ptr_out,
+                                    csr_col_ind_out,
+                                    temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsympermute(rocsparse_handle               handle,
+                                         rocsparse_int                  m,
+                                         rocsparse_int                  nnz,
+                                         const rocsparse_mat_descr      descr,
+                                         const rocsparse_float_complex* csr_val,
+                                         const rocsparse_int*           csr_row_ptr,
+                                         const rocsparse_int*           csr_col_ind,
+                                         const rocsparse_int*           perm,
+                                         rocsparse_float_complex*       csr_val_out,
+                                         rocsparse_int*                 csr_row_ptr_out,
+                                         rocsparse_int*                 csr_col_ind_out,
+                                         void*                          temp_buffer)
+{
+    return rocsparse_ccsrsympermute(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    perm,
+                                    csr_val_out,
+                                    csr_row_ptr_out,
+                                    csr_col_ind_out,
+                                    temp_buffer);
+}
+
+template <>
+rocsparse_status rocsparse_csrsympermute(rocsparse_handle                handle,
+                                         rocsparse_int                   m,
+                                         rocsparse_int                   nnz,
+                                         const rocsparse_mat_descr       descr,
+                                         const rocsparse_double_complex* csr_val,
+                                         const rocsparse_int*            csr_row_ptr,
+                                         const rocsparse_int*            csr_col_ind,
+                                         const rocsparse_int*            perm,
+                                         rocsparse_double_complex*       csr_val_out,
+                                         rocsparse_int*                  csr_row_ptr_out,
+                                         rocsparse_int*                  csr_col_ind_out,
+                                         void*                           temp_buffer)
+{
+    return rocsparse_zcsrsympermute(handle,
+                                    m,
+                                    nnz,
+                                    descr,
+                                    csr_val,
+                                    csr_row_ptr,
+                                    csr_col_ind,
+                                    perm,
+                                    csr_val_out,
+                                    csr_row_ptr_out,
+                                    csr_col_ind_out,
+                                    temp_buffer);
+}
@@ -186,6 +186,85 @@ struct rocsparse_gflop_count<rocsparse_format_ell>
  *    extra SPARSE
  * ===========================================================================
  */
+template <typename T>
+constexpr double bsrgeam_gflop_count(rocsparse_int block_dim,
+                                     rocsparse_int nnzb_A,
+                                     rocsparse_int nnzb_B,
+                                     rocsparse_int nnzb_C,
+                                     const T*      alpha,
+                                     const T*      beta)
+{
+    // Each entry of a block is counted like a CSR entry
+    double bs = static_cast<double>(block_dim) * block_dim;
+
+    // Flop counter
+    double flops = 0.0;
+
+    if(alpha && beta)
+    {
+        // Count alpha * A, beta * B and A + B
+        flops += bs * (static_cast<double>(nnzb_A) + nnzb_B + nnzb_C);
+    }
+    else if(!alpha)
+    {
+        // Count beta * B
+        flops += bs * nnzb_B;
+    }
+    else
+    {
+        // Count alpha * A
+        flops += bs * nnzb_A;
+    }
+
+    return flops / 1e9;
+}
+
+template <typename T>
+constexpr double bsrgemm_gflop_count(rocsparse_int        Mb,
+                                     rocsparse_int        block_dim,
+                                     const T*             alpha,
+                                     const rocsparse_int* bsr_row_ptr_A,
+                                     const rocsparse_int* bsr_col_ind_A,
+                                     const rocsparse_int* bsr_row_ptr_B,
+                                     const T*             beta,
+                                     const rocsparse_int* bsr_row_ptr_D,
+                                     rocsparse_index_base baseA)
+{
+    double bs = static_cast<double>(block_dim) * block_dim;
+
+    // Flop counter
+    double flops = 0.0;
+
+    // Loop over block rows of A
+    for(rocsparse_int i = 0; i < Mb; ++i)
+    {
+        if(alpha)
+        {
+            rocsparse_int row_begin_A = bsr_row_ptr_A[i] - baseA;
+            rocsparse_int row_end_A   = bsr_row_ptr_A[i + 1] - baseA;
+
+            // Loop over block columns of A
+            for(rocsparse_int j = row_begin_A; j < row_end_A; ++j)
+            {
+                // Current block column of A
+                rocsparse_int col_A = bsr_col_ind_A[j] - baseA;
+
+                // Count flops generated by the dense block products of alpha * A * B
+                flops += (2.0 * block_dim + 1.0) * bs
+                         * (bsr_row_ptr_B[col_A + 1] - bsr_row_ptr_B[col_A]);
+            }
+        }
+
+        if(beta)
+        {
+            // Count flops generated by beta * D
+            flops += bs * (bsr_row_ptr_D[i + 1] - bsr_row_ptr_D[i]);
+        }
+    }
+
+    return flops / 1e9;
+}
+
 template <typename T>
 constexpr double csrgeam_gflop_count(
     rocsparse_int nnz_A, rocsparse_int nnz_B, rocsparse_int nnz_C, const T* alpha, const T* beta)
@@ -218,6 +297,35 @@ constexpr double csrgeam_gflop_count(
     return flops / 1e9;
 }
 
+constexpr double
+    csrgeam_multi_gflop_count(rocsparse_int num_mat, const rocsparse_int* nnz_A, rocsparse_int nnz_C)
+{
+    // Flop counter
+    double flops = 0.0;
+
+    // Count alpha_i * A_i
+    for(rocsparse_int i = 0; i < num_mat; ++i)
+    {
+        flops += static_cast<double>(nnz_A[i]);
+    }
+
+    // Count sum of all A_i
+    flops += static_cast<double>(nnz_C);
+
+    return flops / 1e9;
+}
+
+constexpr double csrewise_gflop_count(rocsparse_ewise_pattern pattern,
+                                      rocsparse_int           nnz_A,
+                                      rocsparse_int           nnz_B,
+                                      rocsparse_int           nnz_C)
+{
+    // Count the binary operations on entries that are present in A and B
+    return (pattern == rocsparse_ewise_pattern_intersection)
+               ? static_cast<double>(nnz_C) / 1e9
+               : (static_cast<double>(nnz_A) + nnz_B - nnz_C) / 1e9;
+}
+
 template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
 constexpr double csrgemm_gflop_count(J                    M,
                                      const T*             alpha,
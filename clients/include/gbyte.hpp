@@ -268,6 +268,48 @@ struct rocsparse_gbyte_count<rocsparse_format_ell>
  *    extra SPARSE
  * ===========================================================================
  */
+template <typename T>
+constexpr double bsrgeam_gbyte_count(rocsparse_int Mb,
+                                     rocsparse_int block_dim,
+                                     rocsparse_int nnzb_A,
+                                     rocsparse_int nnzb_B,
+                                     rocsparse_int nnzb_C,
+                                     const T*      alpha,
+                                     const T*      beta)
+{
+    double bs     = static_cast<double>(block_dim) * block_dim;
+    double size_A = alpha ? (Mb + 1.0 + nnzb_A) * sizeof(rocsparse_int) + bs * nnzb_A * sizeof(T)
+                          : 0.0;
+    double size_B = beta ? (Mb + 1.0 + nnzb_B) * sizeof(rocsparse_int) + bs * nnzb_B * sizeof(T)
+                         : 0.0;
+    double size_C = (Mb + 1.0 + nnzb_C) * sizeof(rocsparse_int) + bs * nnzb_C * sizeof(T);
+
+    return (size_A + size_B + size_C) / 1e9;
+}
+
+template <typename T>
+constexpr double bsrgemm_gbyte_count(rocsparse_int Mb,
+                                     rocsparse_int Kb,
+                                     rocsparse_int block_dim,
+                                     rocsparse_int nnzb_A,
+                                     rocsparse_int nnzb_B,
+                                     rocsparse_int nnzb_C,
+                                     rocsparse_int nnzb_D,
+                                     const T*      alpha,
+                                     const T*      beta)
+{
+    double bs     = static_cast<double>(block_dim) * block_dim;
+    double size_A = alpha ? (Mb + 1.0 + nnzb_A) * sizeof(rocsparse_int) + bs * nnzb_A * sizeof(T)
+                          : 0.0;
+    double size_B = alpha ? (Kb + 1.0 + nnzb_B) * sizeof(rocsparse_int) + bs * nnzb_B * sizeof(T)
+                          : 0.0;
+    double size_C = (Mb + 1.0 + nnzb_C) * sizeof(rocsparse_int) + bs * nnzb_C * sizeof(T);
+    double size_D = beta ? (Mb + 1.0 + nnzb_D) * sizeof(rocsparse_int) + bs * nnzb_D * sizeof(T)
+                         : 0.0;
+
+    return (size_A + size_B + size_C + size_D) / 1e9;
+}
+
 template <typename T>
 constexpr double csrgeam_gbyte_count(rocsparse_int M,
                                      rocsparse_int nnz_A,
@@ -283,6 +325,37 @@ constexpr double csrgeam_gbyte_count(rocsparse_int M,
     return (size_A + size_B + size_C) / 1e9;
 }
 
+template <typename T>
+constexpr double csrgeam_multi_gbyte_count(rocsparse_int        M,
+                                           rocsparse_int        num_mat,
+                                           const rocsparse_int* nnz_A,
+                                           rocsparse_int        nnz_C)
+{
+    double size_A = 0.0;
+
+    for(rocsparse_int i = 0; i < num_mat; ++i)
+    {
+        size_A += (M + 1.0 + nnz_A[i]) * sizeof(rocsparse_int) + nnz_A[i] * sizeof(T);
+    }
+
+    double size_C = (M + 1.0 + nnz_C) * sizeof(rocsparse_int) + nnz_C * sizeof(T);
+
+    return (size_A + size_C) / 1e9;
+}
+
+template <typename T>
+constexpr double csrewise_gbyte_count(rocsparse_int M,
+                                      rocsparse_int nnz_A,
+                                      rocsparse_int nnz_B,
+                                      rocsparse_int nnz_C)
+{
+    double size_A = (M + 1.0 + nnz_A) * sizeof(rocsparse_int) + nnz_A * sizeof(T);
+    double size_B = (M + 1.0 + nnz_B) * sizeof(rocsparse_int) + nnz_B * sizeof(T);
+    double size_C = (M + 1.0 + nnz_C) * sizeof(rocsparse_int) + nnz_C * sizeof(T);
+
+    return (size_A + size_B + size_C) / 1e9;
+}
+
 template <typename I, typename J, typename T>
 constexpr double csrgemm_gbyte_count(
     J M, J N, J K, I nnz_A, I nnz_B, I nnz_C, I nnz_D, const T* alpha, const T* beta)
@@ -295,6 +368,23 @@ constexpr double csrgemm_gbyte_count(
     return (size_A + size_B + size_C + size_D) / 1e9;
 }
 
+template <typename T>
+constexpr double csrrap_gbyte_count(rocsparse_int M,
+                                    rocsparse_int N,
+                                    rocsparse_int K,
+                                    rocsparse_int nnz_R,
+                                    rocsparse_int nnz_A,
+                                    rocsparse_int nnz_P,
+                                    rocsparse_int nnz_C)
+{
+    // The numerical phase reads R, A and P (P is accessed by both products) and
+    // writes the values of C
+    return ((M + K + 2.0 * K + 3.0) * sizeof(rocsparse_int)
+            + (nnz_R + nnz_A + 2.0 * nnz_P) * (sizeof(rocsparse_int) + sizeof(T))
+            + nnz_C * sizeof(T))
+           / 1e9;
+}
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -316,6 +406,22 @@ constexpr double bsrilu0_gbyte_count(rocsparse_int Mb, rocsparse_int block_dim,
            / 1e9;
 }
 
+template <typename T>
+constexpr double
+    bsrjacobi_setup_gbyte_count(rocsparse_int Mb, rocsparse_int block_dim, rocsparse_int nnzb)
+{
+    // Read the row pointers, search the block column indices, read and write the diagonal blocks
+    return ((Mb + 1 + nnzb) * sizeof(rocsparse_int)
+            + 2.0 * block_dim * block_dim * Mb * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double bsrjacobi_apply_gbyte_count(rocsparse_int Mb, rocsparse_int block_dim, bool beta)
+{
+    return ((block_dim * block_dim * Mb + (beta ? 3.0 : 2.0) * block_dim * Mb) * sizeof(T)) / 1e9;
+}
+
 template <typename T>
 constexpr double csric0_gbyte_count(rocsparse_int M, rocsparse_int nnz)
 {
@@ -328,12 +434,82 @@ constexpr double csrilu0_gbyte_count(rocsparse_int M, rocsparse_int nnz)
     return ((M + 1 + nnz) * sizeof(rocsparse_int) + 2.0 * nnz * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double csriluk_gbyte_count(rocsparse_int M, rocsparse_int nnz, rocsparse_int nnz_lu)
+{
+    // Copy A into the pattern of the factorization
+    size_t scatter = (2 * (M + 1) + nnz + nnz_lu) * sizeof(rocsparse_int)
+                     + (nnz + nnz_lu) * sizeof(T);
+
+    return scatter / 1e9 + csrilu0_gbyte_count<T>(M, nnz_lu);
+}
+
+template <typename T>
+constexpr double csritilu0_gbyte_count(rocsparse_int M, rocsparse_int nnz, rocsparse_int nsweeps)
+{
+    // Each sweep reads the pattern, A and the previous iterate, and writes the new iterate
+    return ((M + 1 + nnz) * sizeof(rocsparse_int) + 3 * nnz * sizeof(T)) * nsweeps / 1e9;
+}
+
+template <typename T>
+constexpr double csrilut_gbyte_count(rocsparse_int M, rocsparse_int nnz, rocsparse_int nnz_lu)
+{
+    // Read A, write the factorization
+    return ((2 * (M + 1) + nnz + nnz_lu) * sizeof(rocsparse_int) + (nnz + nnz_lu) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double csrfsai_gbyte_count(rocsparse_int M, rocsparse_int nnz_A, rocsparse_int nnz_G)
+{
+    // Read A and the pattern of G, write the values of G
+    return ((2 * (M + 1) + nnz_A + nnz_G) * sizeof(rocsparse_int) + (nnz_A + nnz_G) * sizeof(T))
+           / 1e9;
+}
+
+template <typename T>
+constexpr double csrcheb_gbyte_count(rocsparse_int M, rocsparse_int nnz, rocsparse_int degree)
+{
+    // Each step reads A and d, reads and writes x, r and d
+    return degree * ((M + 1 + nnz) * sizeof(rocsparse_int) + (nnz + 7 * M) * sizeof(T)) / 1e9;
+}
+
 template <typename T>
 constexpr double gtsv_gbyte_count(rocsparse_int M, rocsparse_int N)
 {
     return ((3 * M + 2 * M * N) * sizeof(T)) / 1e9;
 }
 
+template <typename T>
+constexpr double gtsv_strided_batch_gbyte_count(rocsparse_int M, rocsparse_int batch_count)
+{
+    // Read the three diagonals, read and write the rhs of each system
+    return ((5 * M * batch_count) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+constexpr double gpsv_strided_batch_gbyte_count(rocsparse_int M, rocsparse_int batch_count)
+{
+    // Read the five diagonals, read and write the rhs of each system
+    return ((7 * M * batch_count) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+constexpr double csrcolor_gbyte_count(rocsparse_int M, rocsparse_int nnz, rocsparse_int ncolors)
+{
+    // Each round reads the matrix and the colors of all neighbours
+    return ((ncolors + 1) / 2 * (M + 1 + 2.0 * nnz + 2.0 * M) * sizeof(rocsparse_int)) / 1e9;
+}
+
+template <typename T>
+constexpr double csrrcm_gbyte_count(rocsparse_int M, rocsparse_int nnz)
+{
+    // Each breadth first search reads the matrix and the state of all neighbours. At
+    // least two searches are required to find a pseudo-peripheral row, followed by the
+    // Cuthill-McKee search, which reads the matrix three times.
+    return ((5 * (M + 1 + 2.0 * nnz) + M) * sizeof(rocsparse_int)) / 1e9;
+}
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -627,6 +803,18 @@ constexpr double cscsort_gbyte_count(rocsparse_int N, rocsparse_int nnz, bool pe
            / 1e9;
 }
 
+template <typename T>
+constexpr double csrsympermute_gbyte_count(rocsparse_int M, rocsparse_int nnz)
+{
+    // reads
+    size_t reads = (2 * M + 1 + nnz) * sizeof(rocsparse_int) + nnz * sizeof(T);
+
+    // writes
+    size_t writes = (M + 1 + nnz) * sizeof(rocsparse_int) + nnz * sizeof(T);
+
+    return (reads + writes) / 1e9;
+}
+
 template <typename T>
 constexpr double coosort_gbyte_count(rocsparse_int nnz, bool permute)
 {
@@ -493,6 +493,90 @@ rocsparse_status rocsparse_gemmi(rocsparse_handle          handle,
  *    extra SPARSE
  * ===========================================================================
  */
+// bsrgeam
+template <typename T>
+rocsparse_status rocsparse_bsrgeam(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nb,
+                                   rocsparse_int             block_dim,
+                                   const T*                  alpha,
+                                   const rocsparse_mat_descr descr_A,
+                                   rocsparse_int             nnzb_A,
+                                   const T*                  bsr_val_A,
+                                   const rocsparse_int*      bsr_row_ptr_A,
+                                   const rocsparse_int*      bsr_col_ind_A,
+                                   const T*                  beta,
+                                   const rocsparse_mat_descr descr_B,
+                                   rocsparse_int             nnzb_B,
+                                   const T*                  bsr_val_B,
+                                   const rocsparse_int*      bsr_row_ptr_B,
+                                   const rocsparse_int*      bsr_col_ind_B,
+                                   const rocsparse_mat_descr descr_C,
+                                   T*                        bsr_val_C,
+                                   const rocsparse_int*      bsr_row_ptr_C,
+                                   rocsparse_int*            bsr_col_ind_C);
+
+// bsrgemm
+template <typename T>
+rocsparse_status rocsparse_bsrgemm_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_operation       trans_A,
+                                               rocsparse_operation       trans_B,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nb,
+                                               rocsparse_int             kb,
+                                               rocsparse_int             block_dim,
+                                               const T*                  alpha,
+                                               const rocsparse_mat_descr descr_A,
+                                               rocsparse_int             nnzb_A,
+                                               const rocsparse_int*      bsr_row_ptr_A,
+                                               const rocsparse_int*      bsr_col_ind_A,
+                                               const rocsparse_mat_descr descr_B,
+                                               rocsparse_int             nnzb_B,
+                                               const rocsparse_int*      bsr_row_ptr_B,
+                                               const rocsparse_int*      bsr_col_ind_B,
+                                               const T*                  beta,
+                                               const rocsparse_mat_descr descr_D,
+                                               rocsparse_int             nnzb_D,
+                                               const rocsparse_int*      bsr_row_ptr_D,
+                                               const rocsparse_int*      bsr_col_ind_D,
+                                               rocsparse_mat_info        info_C,
+                                               size_t*                   buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_bsrgemm(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_operation       trans_A,
+                                   rocsparse_operation       trans_B,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nb,
+                                   rocsparse_int             kb,
+                                   rocsparse_int             block_dim,
+                                   const T*                  alpha,
+                                   const rocsparse_mat_descr descr_A,
+                                   rocsparse_int             nnzb_A,
+                                   const T*                  bsr_val_A,
+                                   const rocsparse_int*      bsr_row_ptr_A,
+                                   const rocsparse_int*      bsr_col_ind_A,
+                                   const rocsparse_mat_descr descr_B,
+                                   rocsparse_int             nnzb_B,
+                                   const T*                  bsr_val_B,
+                                   const rocsparse_int*      bsr_row_ptr_B,
+                                   const rocsparse_int*      bsr_col_ind_B,
+                                   const T*                  beta,
+                                   const rocsparse_mat_descr descr_D,
+                                   rocsparse_int             nnzb_D,
+                                   const T*                  bsr_val_D,
+                                   const rocsparse_int*      bsr_row_ptr_D,
+                                   const rocsparse_int*      bsr_col_ind_D,
+                                   const rocsparse_mat_descr descr_C,
+                                   T*                        bsr_val_C,
+                                   const rocsparse_int*      bsr_row_ptr_C,
+                                   rocsparse_int*            bsr_col_ind_C,
+                                   const rocsparse_mat_info  info_C,
+                                   void*                     temp_buffer);
+
 // csrgeam
 template <typename T>
 rocsparse_status rocsparse_csrgeam(rocsparse_handle          handle,
@@ -515,6 +599,45 @@ rocsparse_status rocsparse_csrgeam(rocsparse_handle          handle,
                                    const rocsparse_int*      csr_row_ptr_C,
                                    rocsparse_int*            csr_col_ind_C);
 
+// csrgeam_multi
+template <typename T>
+rocsparse_status rocsparse_csrgeam_multi(rocsparse_handle            handle,
+                                         rocsparse_int               m,
+                                         rocsparse_int               n,
+                                         rocsparse_int               num_mat,
+                                         const T*                    alpha,
+                                         const rocsparse_mat_descr*  descr_A,
+                                         const rocsparse_int*        nnz_A,
+                                         const T* const*             csr_val_A,
+                                         const rocsparse_int* const* csr_row_ptr_A,
+                                         const rocsparse_int* const* csr_col_ind_A,
+                                         const rocsparse_mat_descr   descr_C,
+                                         T*                          csr_val_C,
+                                         const rocsparse_int*        csr_row_ptr_C,
+                                         rocsparse_int*              csr_col_ind_C);
+
+// csrewise
+template <typename T>
+rocsparse_status rocsparse_csrewise(rocsparse_handle          handle,
+                                    rocsparse_ewise_pattern   pattern,
+                                    rocsparse_ewise_op        op,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const T*                  csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const T*                  csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    T*                        csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C);
+
 // csrgemm
 template <typename T>
 rocsparse_status rocsparse_csrgemm_buffer_size(rocsparse_handle          handle,
@@ -571,6 +694,121 @@ rocsparse_status rocsparse_csrgemm(rocsparse_handle          handle,
                                    const rocsparse_mat_info  info_C,
                                    void*                     temp_buffer);
 
+template <typename T>
+rocsparse_status rocsparse_csrgemm_chunked(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const T*                  csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_B,
+                                           rocsparse_int             nnz_B,
+                                           const T*                  csr_val_B,
+                                           const rocsparse_int*      csr_row_ptr_B,
+                                           const rocsparse_int*      csr_col_ind_B,
+                                           const T*                  beta,
+                                           const rocsparse_mat_descr descr_D,
+                                           rocsparse_int             nnz_D,
+                                           const T*                  csr_val_D,
+                                           const rocsparse_int*      csr_row_ptr_D,
+                                           const rocsparse_int*      csr_col_ind_D,
+                                           const rocsparse_mat_descr descr_C,
+                                           T*                        csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           rocsparse_int*            csr_col_ind_C,
+                                           const rocsparse_mat_info  info_C,
+                                           size_t                    panel_buffer_size,
+                                           void*                     panel_buffer,
+                                           void*                     temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_csrgemm_masked(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             k,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr_A,
+                                          rocsparse_int             nnz_A,
+                                          const T*                  csr_val_A,
+                                          const rocsparse_int*      csr_row_ptr_A,
+                                          const rocsparse_int*      csr_col_ind_A,
+                                          const rocsparse_mat_descr descr_B,
+                                          rocsparse_int             nnz_B,
+                                          const T*                  csr_val_B,
+                                          const rocsparse_int*      csr_row_ptr_B,
+                                          const rocsparse_int*      csr_col_ind_B,
+                                          const rocsparse_mat_descr descr_M,
+                                          rocsparse_int             nnz_M,
+                                          const rocsparse_int*      csr_row_ptr_M,
+                                          const rocsparse_int*      csr_col_ind_M,
+                                          rocsparse_mask_type       mask_type,
+                                          const rocsparse_mat_descr descr_C,
+                                          T*                        csr_val_C,
+                                          const rocsparse_int*      csr_row_ptr_C,
+                                          rocsparse_int*            csr_col_ind_C,
+                                          const rocsparse_mat_info  info_C,
+                                          void*                     temp_buffer);
+
+// csrrap
+template <typename T>
+rocsparse_status rocsparse_csrrap_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_R,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              const T*                  alpha,
+                                              const rocsparse_mat_descr descr_R,
+                                              rocsparse_int             nnz_R,
+                                              const rocsparse_int*      csr_row_ptr_R,
+                                              const rocsparse_int*      csr_col_ind_R,
+                                              const rocsparse_mat_descr descr_A,
+                                              rocsparse_int             nnz_A,
+                                              const rocsparse_int*      csr_row_ptr_A,
+                                              const rocsparse_int*      csr_col_ind_A,
+                                              const rocsparse_mat_descr descr_P,
+                                              rocsparse_int             nnz_P,
+                                              const rocsparse_int*      csr_row_ptr_P,
+                                              const rocsparse_int*      csr_col_ind_P,
+                                              rocsparse_mat_info        info_C,
+                                              size_t*                   buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_csrrap(rocsparse_handle          handle,
+                                  rocsparse_operation       trans_R,
+                                  rocsparse_int             m,
+                                  rocsparse_int             n,
+                                  rocsparse_int             k,
+                                  const T*                  alpha,
+                                  const rocsparse_mat_descr descr_R,
+                                  rocsparse_int             nnz_R,
+                                  const T*                  csr_val_R,
+                                  const rocsparse_int*      csr_row_ptr_R,
+                                  const rocsparse_int*      csr_col_ind_R,
+                                  const rocsparse_mat_descr descr_A,
+                                  rocsparse_int             nnz_A,
+                                  const T*                  csr_val_A,
+                                  const rocsparse_int*      csr_row_ptr_A,
+                                  const rocsparse_int*      csr_col_ind_A,
+                                  const rocsparse_mat_descr descr_P,
+                                  rocsparse_int             nnz_P,
+                                  const T*                  csr_val_P,
+                                  const rocsparse_int*      csr_row_ptr_P,
+                                  const rocsparse_int*      csr_col_ind_P,
+                                  const rocsparse_mat_descr descr_C,
+                                  T*                        csr_val_C,
+                                  const rocsparse_int*      csr_row_ptr_C,
+                                  rocsparse_int*            csr_col_ind_C,
+                                  const rocsparse_mat_info  info_C,
+                                  void*                     temp_buffer);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -669,6 +907,44 @@ rocsparse_status rocsparse_bsrilu0(rocsparse_handle          handle,
                                    rocsparse_solve_policy    policy,
                                    void*                     temp_buffer);
 
+// bsrjacobi
+template <typename T>
+rocsparse_status rocsparse_bsrjacobi_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_direction       dir,
+                                                 rocsparse_int             mb,
+                                                 rocsparse_int             nnzb,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  bsr_val,
+                                                 const rocsparse_int*      bsr_row_ptr,
+                                                 const rocsparse_int*      bsr_col_ind,
+                                                 rocsparse_int             block_dim,
+                                                 size_t*                   buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_bsrjacobi_setup(rocsparse_handle          handle,
+                                           rocsparse_direction       dir,
+                                           rocsparse_int             mb,
+                                           rocsparse_int             nnzb,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  bsr_val,
+                                           const rocsparse_int*      bsr_row_ptr,
+                                           const rocsparse_int*      bsr_col_ind,
+                                           rocsparse_int             block_dim,
+                                           rocsparse_mat_info        info,
+                                           T*                        bsr_diag_inv,
+                                           void*                     temp_buffer);
+
+template <typename T>
+rocsparse_status rocsparse_bsrjacobi_apply(rocsparse_handle    handle,
+                                           rocsparse_direction dir,
+                                           rocsparse_int       mb,
+                                           rocsparse_int       block_dim,
+                                           const T*            alpha,
+                                           const T*            bsr_diag_inv,
+                                           const T*            x,
+                                           const T*            beta,
+                                           T*                  y);
+
 // csric0
 template <typename T>
 rocsparse_status rocsparse_csric0_buffer_size(rocsparse_handle          handle,
@@ -750,6 +1026,197 @@ rocsparse_status rocsparse_csrilu0(rocsparse_handle          handle,
                                    rocsparse_solve_policy    policy,
                                    void*                     temp_buffer);
 
+// csriluk
+template <typename T>
+rocsparse_status rocsparse_csriluk(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   const T*                  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             nnz_lu,
+                                   T*                        csr_val_lu,
+                                   const rocsparse_int*      csr_row_ptr_lu,
+                                   const rocsparse_int*      csr_col_ind_lu,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+// csritilu0
+template <typename T>
+rocsparse_status rocsparse_csritilu0_buffer_size(rocsparse_handle          handle,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             nnz,
+                                                 const rocsparse_mat_descr descr,
+                                                 const T*                  csr_val,
+                                                 const rocsparse_int*      csr_row_ptr,
+                                                 const rocsparse_int*      csr_col_ind,
+                                                 size_t*                   buffer_size);
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csritilu0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     T*                        csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     U*                        history,
+                                     void*                     temp_buffer);
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csritic0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    T*                        csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_int             nsweeps,
+                                    U*                        history,
+                                    void*                     temp_buffer);
+
+// csrilut
+template <typename T>
+rocsparse_status rocsparse_csrilut_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int             max_fill,
+                                               size_t*                   buffer_size);
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrilut(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   const T*                  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   U                         tol,
+                                   rocsparse_int             max_fill,
+                                   rocsparse_int*            csr_row_ptr_lu,
+                                   rocsparse_int*            csr_col_ind_lu,
+                                   T*                        csr_val_lu,
+                                   void*                     temp_buffer);
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrict(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const T*                  csr_val,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_mat_info        info,
+                                  U                         tol,
+                                  rocsparse_int             max_fill,
+                                  rocsparse_int*            csr_row_ptr_l,
+                                  rocsparse_int*            csr_col_ind_l,
+                                  T*                        csr_val_l,
+                                  void*                     temp_buffer);
+
+// csrfsai
+template <typename T>
+rocsparse_status rocsparse_csrfsai_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz_A,
+                                               const rocsparse_mat_descr descr_A,
+                                               const T*                  csr_val_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const rocsparse_mat_descr descr_G,
+                                               const rocsparse_int*      csr_row_ptr_G,
+                                               size_t*                   buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_csrfsai(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz_A,
+                                   const rocsparse_mat_descr descr_A,
+                                   const T*                  csr_val_A,
+                                   const rocsparse_int*      csr_row_ptr_A,
+                                   const rocsparse_int*      csr_col_ind_A,
+                                   rocsparse_int             nnz_S,
+                                   const rocsparse_mat_descr descr_S,
+                                   const rocsparse_int*      csr_row_ptr_S,
+                                   const rocsparse_int*      csr_col_ind_S,
+                                   rocsparse_mat_info        info,
+                                   const rocsparse_mat_descr descr_G,
+                                   T*                        csr_val_G,
+                                   const rocsparse_int*      csr_row_ptr_G,
+                                   rocsparse_int*            csr_col_ind_G,
+                                   void*                     temp_buffer);
+
+// csrcheb
+template <typename T>
+rocsparse_status rocsparse_csrcheb_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const T*                  csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               size_t*                   buffer_size);
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrcheb_estimate(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             iters,
+                                            U*                        lambda_max,
+                                            void*                     temp_buffer);
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrcheb(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   const T*                  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_int             degree,
+                                   U                         lambda_min,
+                                   U                         lambda_max,
+                                   const T*                  b,
+                                   T*                        x,
+                                   void*                     temp_buffer);
+
+// gtsv
+template <typename T>
+rocsparse_status rocsparse_gtsv_buffer_size(rocsparse_handle handle,
+                                            rocsparse_int    m,
+                                            rocsparse_int    n,
+                                            const T*         dl,
+                                            const T*         d,
+                                            const T*         du,
+                                            const T*         B,
+                                            rocsparse_int    ldb,
+                                            size_t*          buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_gtsv(rocsparse_handle handle,
+                                rocsparse_int    m,
+                                rocsparse_int    n,
+                                const T*         dl,
+                                const T*         d,
+                                const T*         du,
+                                T*               B,
+                                rocsparse_int    ldb,
+                                void*            temp_buffer);
+
 // gtsv_no_pivot
 template <typename T>
 rocsparse_status rocsparse_gtsv_no_pivot_buffer_size(rocsparse_handle handle,
@@ -773,6 +1240,110 @@ rocsparse_status rocsparse_gtsv_no_pivot(rocsparse_handle handle,
                                          rocsparse_int    ldb,
                                          void*            temp_buffer);
 
+// gtsv_no_pivot_strided_batch
+template <typename T>
+rocsparse_status rocsparse_gtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   const T*         dl,
+                                                                   const T*         d,
+                                                                   const T*         du,
+                                                                   const T*         x,
+                                                                   rocsparse_int    batch_count,
+                                                                   rocsparse_int    batch_stride,
+                                                                   size_t*          buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_gtsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       const T*         dl,
+                                                       const T*         d,
+                                                       const T*         du,
+                                                       T*               x,
+                                                       rocsparse_int    batch_count,
+                                                       rocsparse_int    batch_stride,
+                                                       void*            temp_buffer);
+
+// gtsv_interleaved_batch
+template <typename T>
+rocsparse_status
+    rocsparse_gtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                 rocsparse_gtsv_interleaved_alg alg,
+                                                 rocsparse_int                  m,
+                                                 const T*                       dl,
+                                                 const T*                       d,
+                                                 const T*                       du,
+                                                 const T*                       x,
+                                                 rocsparse_int                  batch_count,
+                                                 rocsparse_int                  batch_stride,
+                                                 size_t*                        buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_gtsv_interleaved_batch(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const T*                       dl,
+                                                  const T*                       d,
+                                                  const T*                       du,
+                                                  T*                             x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  void*                          temp_buffer);
+
+// gpsv_no_pivot_strided_batch
+template <typename T>
+rocsparse_status rocsparse_gpsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   const T*         ds,
+                                                                   const T*         dl,
+                                                                   const T*         d,
+                                                                   const T*         du,
+                                                                   const T*         dw,
+                                                                   const T*         x,
+                                                                   rocsparse_int    batch_count,
+                                                                   rocsparse_int    batch_stride,
+                                                                   size_t*          buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_gpsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       const T*         ds,
+                                                       const T*         dl,
+                                                       const T*         d,
+                                                       const T*         du,
+                                                       const T*         dw,
+                                                       T*               x,
+                                                       rocsparse_int    batch_count,
+                                                       rocsparse_int    batch_stride,
+                                                       void*            temp_buffer);
+
+// gpsv_no_pivot_interleaved_batch
+template <typename T>
+rocsparse_status
+    rocsparse_gpsv_no_pivot_interleaved_batch_buffer_size(rocsparse_handle handle,
+                                                          rocsparse_int    m,
+                                                          const T*         ds,
+                                                          const T*         dl,
+                                                          const T*         d,
+                                                          const T*         du,
+                                                          const T*         dw,
+                                                          const T*         x,
+                                                          rocsparse_int    batch_count,
+                                                          rocsparse_int    batch_stride,
+                                                          size_t*          buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_gpsv_no_pivot_interleaved_batch(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           const T*         ds,
+                                                           const T*         dl,
+                                                           const T*         d,
+                                                           const T*         du,
+                                                           const T*         dw,
+                                                           T*               x,
+                                                           rocsparse_int    batch_count,
+                                                           rocsparse_int    batch_stride,
+                                                           void*            temp_buffer);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -1298,4 +1869,19 @@ rocsparse_status rocsparse_prune_csr2csr_by_percentage(rocsparse_handle
                                                        rocsparse_mat_info        info,
                                                        void*                     buffer);
 
+// csrsympermute
+template <typename T>
+rocsparse_status rocsparse_csrsympermute(rocsparse_handle          handle,
+                                         rocsparse_int             m,
+                                         rocsparse_int             nnz,
+                                         const rocsparse_mat_descr descr,
+                                         const T*                  csr_val,
+                                         const rocsparse_int*      csr_row_ptr,
+                                         const rocsparse_int*      csr_col_ind,
+                                         const rocsparse_int*      perm,
+                                         T*                        csr_val_out,
+                                         rocsparse_int*            csr_row_ptr_out,
+                                         rocsparse_int*            csr_col_ind_out,
+                                         void*                     temp_buffer);
+
 #endif // ROCSPARSE_HPP
@@ -106,6 +106,9 @@ struct Arguments
 
     double tolm;
 
+    rocsparse_int fill_level;
+    rocsparse_int nsweeps;
+
     char filename[64];
     char function[64];
     char name[64];
@@ -202,6 +205,8 @@ struct Arguments
         ROCSPARSE_FORMAT_CHECK(boostval);
         ROCSPARSE_FORMAT_CHECK(boostvali);
         ROCSPARSE_FORMAT_CHECK(tolm);
+        ROCSPARSE_FORMAT_CHECK(fill_level);
+        ROCSPARSE_FORMAT_CHECK(nsweeps);
         ROCSPARSE_FORMAT_CHECK(filename);
         ROCSPARSE_FORMAT_CHECK(function);
         ROCSPARSE_FORMAT_CHECK(name);
@@ -381,6 +386,8 @@ private:
         print("boost_val", arg.boostval);
         print("boost_vali", arg.boostvali);
         print("tolm", arg.tolm);
+        print("fill_level", arg.fill_level);
+        print("nsweeps", arg.nsweeps);
         print("name", arg.name);
         print("category", arg.category);
         print("unit_check", arg.unit_check);
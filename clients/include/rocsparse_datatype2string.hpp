@@ -52,7 +52,8 @@ typedef enum rocsparse_matrix_init_
     rocsparse_matrix_laplace_2d      = 1, /**< Initialize 2D laplacian matrix */
     rocsparse_matrix_laplace_3d      = 2, /**< Initialize 3D laplacian matrix */
     rocsparse_matrix_file_mtx        = 3, /**< Read from .mtx (matrix market) file */
-    rocsparse_matrix_file_rocalution = 4 /**< Read from .csr (rocALUTION) file */
+    rocsparse_matrix_file_rocalution = 4, /**< Read from .csr (rocALUTION) file */
+    rocsparse_matrix_rmat            = 5 /**< Initialize R-MAT power law matrix */
 } rocsparse_matrix_init;
 
 constexpr auto rocsparse_matrix2string(rocsparse_matrix_init matrix)
@@ -69,6 +70,8 @@ constexpr auto rocsparse_matrix2string(rocsparse_matrix_init matrix)
         return "mtx";
     case rocsparse_matrix_file_rocalution:
         return "csr";
+    case rocsparse_matrix_rmat:
+        return "rmat";
     }
     return "invalid";
 }
@@ -187,6 +190,8 @@ constexpr auto rocsparse_analysis2string(rocsparse_analysis_policy policy)
         return "reuse";
     case rocsparse_analysis_policy_force:
         return "force";
+    case rocsparse_analysis_policy_numeric:
+        return "numeric";
     }
     return "invalid";
 }
@@ -197,6 +202,10 @@ constexpr auto rocsparse_solve2string(rocsparse_solve_policy policy)
     {
     case rocsparse_solve_policy_auto:
         return "auto";
+    case rocsparse_solve_policy_sync_free:
+        return "sync_free";
+    case rocsparse_solve_policy_level_set:
+        return "level_set";
     }
     return "invalid";
 }
@@ -318,6 +327,82 @@ constexpr auto rocsparse_densetosparsealg2string(rocsparse_dense_to_sparse_alg a
     return "invalid";
 }
 
+constexpr auto rocsparse_gtsvinterleavedalg2string(rocsparse_gtsv_interleaved_alg alg)
+{
+    switch(alg)
+    {
+    case rocsparse_gtsv_interleaved_alg_default:
+        return "default";
+    case rocsparse_gtsv_interleaved_alg_thomas:
+        return "thomas";
+    case rocsparse_gtsv_interleaved_alg_lu:
+        return "lu";
+    }
+    return "invalid";
+}
+
+constexpr auto rocsparse_masktype2string(rocsparse_mask_type type)
+{
+    switch(type)
+    {
+    case rocsparse_mask_type_structural:
+        return "structural";
+    case rocsparse_mask_type_complement:
+        return "complement";
+    }
+    return "invalid";
+}
+
+constexpr auto rocsparse_semiring2string(rocsparse_semiring semiring)
+{
+    switch(semiring)
+    {
+    case rocsparse_semiring_plus_times:
+        return "plus_times";
+    case rocsparse_semiring_min_plus:
+        return "min_plus";
+    case rocsparse_semiring_max_times:
+        return "max_times";
+    case rocsparse_semiring_or_and:
+        return "or_and";
+    case rocsparse_semiring_plus_pair:
+        return "plus_pair";
+    }
+    return "invalid";
+}
+
+constexpr auto rocsparse_ewisepattern2string(rocsparse_ewise_pattern pattern)
+{
+    switch(pattern)
+    {
+    case rocsparse_ewise_pattern_intersection:
+        return "intersection";
+    case rocsparse_ewise_pattern_union:
+        return "union";
+    }
+    return "invalid";
+}
+
+constexpr auto rocsparse_ewiseop2string(rocsparse_ewise_op op)
+{
+    switch(op)
+    {
+    case rocsparse_ewise_op_add:
+        return "add";
+    case rocsparse_ewise_op_sub:
+        return "sub";
+    case rocsparse_ewise_op_mul:
+        return "mul";
+    case rocsparse_ewise_op_div:
+        return "div";
+    case rocsparse_ewise_op_min:
+        return "min";
+    case rocsparse_ewise_op_max:
+        return "max";
+    }
+    return "invalid";
+}
+
 // Return a string without '/' or '\\'
 inline std::string rocsparse_filename2string(const std::string& filename)
 {
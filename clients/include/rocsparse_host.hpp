@@ -249,6 +249,19 @@ void host_csrmv(J                    M,
                 rocsparse_index_base base,
                 int                  algo);
 
+// Real data types only
+template <typename I, typename J, typename T>
+void host_csrmv_semiring(rocsparse_semiring   semiring,
+                         J                    M,
+                         T                    alpha,
+                         const I*             csr_row_ptr,
+                         const J*             csr_col_ind,
+                         const T*             csr_val,
+                         const T*             x,
+                         T                    beta,
+                         T*                   y,
+                         rocsparse_index_base base);
+
 template <typename T>
 void host_csrsv(rocsparse_operation  trans,
                 rocsparse_int        M,
@@ -265,6 +278,13 @@ void host_csrsv(rocsparse_operation  trans,
                 rocsparse_int*       struct_pivot,
                 rocsparse_int*       numeric_pivot);
 
+rocsparse_int host_csrsv_levels(rocsparse_operation  trans,
+                                rocsparse_int        M,
+                                const rocsparse_int* csr_row_ptr,
+                                const rocsparse_int* csr_col_ind,
+                                rocsparse_fill_mode  fill_mode,
+                                rocsparse_index_base base);
+
 template <typename I, typename T>
 void host_ellmv(I                    M,
                 I                    N,
@@ -443,6 +463,51 @@ void host_gemmi(rocsparse_int        M,
  * ===========================================================================
  */
 template <typename T>
+void host_bsrgeam(rocsparse_direction               dir,
+                  rocsparse_int                     Mb,
+                  rocsparse_int                     Nb,
+                  rocsparse_int                     block_dim,
+                  T                                 alpha,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_A,
+                  const std::vector<rocsparse_int>& bsr_col_ind_A,
+                  const std::vector<T>&             bsr_val_A,
+                  T                                 beta,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_B,
+                  const std::vector<rocsparse_int>& bsr_col_ind_B,
+                  const std::vector<T>&             bsr_val_B,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_C,
+                  std::vector<rocsparse_int>&       bsr_col_ind_C,
+                  std::vector<T>&                   bsr_val_C,
+                  rocsparse_index_base              base_A,
+                  rocsparse_index_base              base_B,
+                  rocsparse_index_base              base_C);
+
+template <typename T>
+void host_bsrgemm(rocsparse_direction               dir,
+                  rocsparse_int                     Mb,
+                  rocsparse_int                     Nb,
+                  rocsparse_int                     Kb,
+                  rocsparse_int                     block_dim,
+                  const T*                          alpha,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_A,
+                  const std::vector<rocsparse_int>& bsr_col_ind_A,
+                  const std::vector<T>&             bsr_val_A,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_B,
+                  const std::vector<rocsparse_int>& bsr_col_ind_B,
+                  const std::vector<T>&             bsr_val_B,
+                  const T*                          beta,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_D,
+                  const std::vector<rocsparse_int>& bsr_col_ind_D,
+                  const std::vector<T>&             bsr_val_D,
+                  const std::vector<rocsparse_int>& bsr_row_ptr_C,
+                  std::vector<rocsparse_int>&       bsr_col_ind_C,
+                  std::vector<T>&                   bsr_val_C,
+                  rocsparse_index_base              base_A,
+                  rocsparse_index_base              base_B,
+                  rocsparse_index_base              base_C,
+                  rocsparse_index_base              base_D);
+
+template <typename T>
 void host_csrgeam_nnz(rocsparse_int                     M,
                       rocsparse_int                     N,
                       T                                 alpha,
@@ -475,6 +540,36 @@ void host_csrgeam(rocsparse_int                     M,
                   rocsparse_index_base              base_B,
                   rocsparse_index_base              base_C);
 
+void host_csrewise_nnz(rocsparse_ewise_pattern           pattern,
+                       rocsparse_int                     M,
+                       const std::vector<rocsparse_int>& csr_row_ptr_A,
+                       const std::vector<rocsparse_int>& csr_col_ind_A,
+                       const std::vector<rocsparse_int>& csr_row_ptr_B,
+                       const std::vector<rocsparse_int>& csr_col_ind_B,
+                       std::vector<rocsparse_int>&       csr_row_ptr_C,
+                       rocsparse_int*                    nnz_C,
+                       rocsparse_index_base              base_A,
+                       rocsparse_index_base              base_B,
+                       rocsparse_index_base              base_C);
+
+template <typename T>
+void host_csrewise(rocsparse_ewise_pattern           pattern,
+                   rocsparse_ewise_op                op,
+                   rocsparse_int                     M,
+                   rocsparse_int                     N,
+                   const std::vector<rocsparse_int>& csr_row_ptr_A,
+                   const std::vector<rocsparse_int>& csr_col_ind_A,
+                   const std::vector<T>&             csr_val_A,
+                   const std::vector<rocsparse_int>& csr_row_ptr_B,
+                   const std::vector<rocsparse_int>& csr_col_ind_B,
+                   const std::vector<T>&             csr_val_B,
+                   const std::vector<rocsparse_int>& csr_row_ptr_C,
+                   std::vector<rocsparse_int>&       csr_col_ind_C,
+                   std::vector<T>&                   csr_val_C,
+                   rocsparse_index_base              base_A,
+                   rocsparse_index_base              base_B,
+                   rocsparse_index_base              base_C);
+
 template <typename I, typename J, typename T>
 void host_csrgemm_nnz(J                     M,
                       J                     N,
@@ -517,6 +612,111 @@ void host_csrgemm(J                     M,
                   rocsparse_index_base  base_C,
                   rocsparse_index_base  base_D);
 
+// Expand-sort-compress reference of host_csrgemm
+template <typename I, typename J, typename T>
+void host_csrgemm_esc(J                     M,
+                      J                     N,
+                      J                     L,
+                      const T*              alpha,
+                      const std::vector<I>& csr_row_ptr_A,
+                      const std::vector<J>& csr_col_ind_A,
+                      const std::vector<T>& csr_val_A,
+                      const std::vector<I>& csr_row_ptr_B,
+                      const std::vector<J>& csr_col_ind_B,
+                      const std::vector<T>& csr_val_B,
+                      const T*              beta,
+                      const std::vector<I>& csr_row_ptr_D,
+                      const std::vector<J>& csr_col_ind_D,
+                      const std::vector<T>& csr_val_D,
+                      const std::vector<I>& csr_row_ptr_C,
+                      std::vector<J>&       csr_col_ind_C,
+                      std::vector<T>&       csr_val_C,
+                      rocsparse_index_base  base_A,
+                      rocsparse_index_base  base_B,
+                      rocsparse_index_base  base_C,
+                      rocsparse_index_base  base_D);
+
+template <typename T>
+void host_csrrap(rocsparse_operation               trans_R,
+                 rocsparse_int                     M,
+                 rocsparse_int                     N,
+                 rocsparse_int                     K,
+                 T                                 alpha,
+                 const std::vector<rocsparse_int>& csr_row_ptr_R,
+                 const std::vector<rocsparse_int>& csr_col_ind_R,
+                 const std::vector<T>&             csr_val_R,
+                 const std::vector<rocsparse_int>& csr_row_ptr_A,
+                 const std::vector<rocsparse_int>& csr_col_ind_A,
+                 const std::vector<T>&             csr_val_A,
+                 const std::vector<rocsparse_int>& csr_row_ptr_P,
+                 const std::vector<rocsparse_int>& csr_col_ind_P,
+                 const std::vector<T>&             csr_val_P,
+                 std::vector<rocsparse_int>&       csr_row_ptr_C,
+                 rocsparse_int*                    nnz_C,
+                 std::vector<rocsparse_int>&       csr_col_ind_C,
+                 std::vector<T>&                   csr_val_C,
+                 rocsparse_index_base              base_R,
+                 rocsparse_index_base              base_A,
+                 rocsparse_index_base              base_P,
+                 rocsparse_index_base              base_C);
+
+template <typename T>
+void host_csrgemm_masked(rocsparse_int                     M,
+                         rocsparse_int                     N,
+                         rocsparse_int                     K,
+                         T                                 alpha,
+                         const std::vector<rocsparse_int>& csr_row_ptr_A,
+                         const std::vector<rocsparse_int>& csr_col_ind_A,
+                         const std::vector<T>&             csr_val_A,
+                         const std::vector<rocsparse_int>& csr_row_ptr_B,
+                         const std::vector<rocsparse_int>& csr_col_ind_B,
+                         const std::vector<T>&             csr_val_B,
+                         const std::vector<rocsparse_int>& csr_row_ptr_M,
+                         const std::vector<rocsparse_int>& csr_col_ind_M,
+                         rocsparse_mask_type               mask_type,
+                         std::vector<rocsparse_int>&       csr_row_ptr_C,
+                         rocsparse_int*                    nnz_C,
+                         std::vector<rocsparse_int>&       csr_col_ind_C,
+                         std::vector<T>&                   csr_val_C,
+                         rocsparse_index_base              base_A,
+                         rocsparse_index_base              base_B,
+                         rocsparse_index_base              base_M,
+                         rocsparse_index_base              base_C);
+
+// Real data types only
+template <typename I, typename J, typename T>
+void host_csrgemm_semiring(rocsparse_semiring    semiring,
+                           J                     M,
+                           J                     N,
+                           T                     alpha,
+                           const std::vector<I>& csr_row_ptr_A,
+                           const std::vector<J>& csr_col_ind_A,
+                           const std::vector<T>& csr_val_A,
+                           const std::vector<I>& csr_row_ptr_B,
+                           const std::vector<J>& csr_col_ind_B,
+                           const std::vector<T>& csr_val_B,
+                           const std::vector<I>& csr_row_ptr_C,
+                           std::vector<J>&       csr_col_ind_C,
+                           std::vector<T>&       csr_val_C,
+                           rocsparse_index_base  base_A,
+                           rocsparse_index_base  base_B,
+                           rocsparse_index_base  base_C);
+
+template <typename I, typename J>
+void host_csrgemm_nnz_estimate(J                     M,
+                               J                     N,
+                               J                     sample_size,
+                               const std::vector<I>& csr_row_ptr_A,
+                               const std::vector<J>& csr_col_ind_A,
+                               const std::vector<I>& csr_row_ptr_B,
+                               const std::vector<J>& csr_col_ind_B,
+                               rocsparse_index_base  base_A,
+                               rocsparse_index_base  base_B,
+                               int64_t*              nnz_products,
+                               int64_t*              nnz_C,
+                               int64_t*              nnz_C_lower,
+                               int64_t*              nnz_C_upper);
+
 /*
  * ===========================================================================
  *    precond SPARSE
@@ -547,6 +747,27 @@ void host_bsrilu0(rocsparse_direction               dir,
                   U                                 boost_tol,
                   T                                 boost_val);
 
+template <typename T>
+void host_bsrjacobi_setup(rocsparse_direction               dir,
+                          rocsparse_int                     mb,
+                          const std::vector<rocsparse_int>& bsr_row_ptr,
+                          const std::vector<rocsparse_int>& bsr_col_ind,
+                          const std::vector<T>&             bsr_val,
+                          rocsparse_int                     bsr_dim,
+                          rocsparse_index_base              base,
+                          std::vector<T>&                   bsr_diag_inv,
+                          rocsparse_int*                    zero_pivot);
+
+template <typename T>
+void host_bsrjacobi_apply(rocsparse_direction   dir,
+                          rocsparse_int         mb,
+                          rocsparse_int         bsr_dim,
+                          T                     alpha,
+                          const std::vector<T>& bsr_diag_inv,
+                          const std::vector<T>& x,
+                          T                     beta,
+                          std::vector<T>&       y);
+
 template <typename T>
 void host_csric0(rocsparse_int                     M,
                  const std::vector<rocsparse_int>& csr_row_ptr,
@@ -568,6 +789,80 @@ void host_csrilu0(rocsparse_int                     M,
                   U                                 boost_tol,
                   T                                 boost_val);
 
+template <typename T, typename U>
+void host_csritilu0(rocsparse_int                     M,
+                    const std::vector<rocsparse_int>& csr_row_ptr,
+                    const std::vector<rocsparse_int>& csr_col_ind,
+                    std::vector<T>&                   csr_val,
+                    rocsparse_index_base              base,
+                    bool                              ichol,
+                    rocsparse_int                     nsweeps,
+                    std::vector<U>&                   history,
+                    rocsparse_int*                    struct_pivot,
+                    rocsparse_int*                    numeric_pivot);
+
+template <typename T, typename U>
+void host_csrilut(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  const std::vector<T>&             csr_val,
+                  rocsparse_index_base              base,
+                  bool                              ichol,
+                  U                                 tol,
+                  rocsparse_int                     max_fill,
+                  bool                              boost,
+                  U                                 boost_tol,
+                  T                                 boost_val,
+                  std::vector<rocsparse_int>&       lu_row_ptr,
+                  std::vector<rocsparse_int>&       lu_col_ind,
+                  std::vector<T>&                   lu_val,
+                  rocsparse_int*                    struct_pivot,
+                  rocsparse_int*                    numeric_pivot);
+
+template <typename T>
+void host_csrfsai(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr_A,
+                  const std::vector<rocsparse_int>& csr_col_ind_A,
+                  const std::vector<T>&             csr_val_A,
+                  rocsparse_index_base              base_A,
+                  const std::vector<rocsparse_int>& csr_row_ptr_S,
+                  const std::vector<rocsparse_int>& csr_col_ind_S,
+                  rocsparse_index_base              base_S,
+                  rocsparse_index_base              base_G,
+                  std::vector<rocsparse_int>&       csr_row_ptr_G,
+                  std::vector<rocsparse_int>&       csr_col_ind_G,
+                  std::vector<T>&                   csr_val_G,
+                  rocsparse_int*                    zero_pivot);
+
+template <typename T, typename U>
+void host_csrcheb_estimate(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           const std::vector<T>&             csr_val,
+                           rocsparse_index_base              base,
+                           rocsparse_int                     iters,
+                           U*                                lambda_max);
+
+template <typename T, typename U>
+void host_csrcheb(rocsparse_int                     M,
+                  const std::vector<rocsparse_int>& csr_row_ptr,
+                  const std::vector<rocsparse_int>& csr_col_ind,
+                  const std::vector<T>&             csr_val,
+                  rocsparse_index_base              base,
+                  rocsparse_int                     degree,
+                  U                                 lambda_min,
+                  U                                 lambda_max,
+                  const std::vector<T>&             b,
+                  std::vector<T>&                   x);
+
+void host_csriluk_symbolic(rocsparse_int                     M,
+                           const std::vector<rocsparse_int>& csr_row_ptr,
+                           const std::vector<rocsparse_int>& csr_col_ind,
+                           rocsparse_index_base              base,
+                           rocsparse_int                     level_of_fill,
+                           std::vector<rocsparse_int>&       lu_row_ptr,
+                           std::vector<rocsparse_int>&       lu_col_ind);
+
 template <typename T>
 void host_gtsv_no_pivot(rocsparse_int         m,
                         rocsparse_int         n,
@@ -577,6 +872,77 @@ void host_gtsv_no_pivot(rocsparse_int         m,
                         std::vector<T>&       B,
                         rocsparse_int         ldb);
 
+template <typename T>
+void host_gtsv(rocsparse_int         m,
+               rocsparse_int         n,
+               const std::vector<T>& dl,
+               const std::vector<T>& d,
+               const std::vector<T>& du,
+               std::vector<T>&       B,
+               rocsparse_int         ldb);
+
+template <typename T>
+void host_gtsv_no_pivot_strided_batch(rocsparse_int         m,
+                                      const std::vector<T>& dl,
+                                      const std::vector<T>& d,
+                                      const std::vector<T>& du,
+                                      std::vector<T>&       x,
+                                      rocsparse_int         batch_count,
+                                      rocsparse_int         batch_stride);
+
+template <typename T>
+void host_gtsv_interleaved_batch(rocsparse_gtsv_interleaved_alg alg,
+                                 rocsparse_int                  m,
+                                 const std::vector<T>&          dl,
+                                 const std::vector<T>&          d,
+                                 const std::vector<T>&          du,
+                                 std::vector<T>&                x,
+                                 rocsparse_int                  batch_count,
+                                 rocsparse_int                  batch_stride);
+
+template <typename T>
+void host_gpsv_no_pivot_strided_batch(rocsparse_int         m,
+                                      const std::vector<T>& ds,
+                                      const std::vector<T>& dl,
+                                      const std::vector<T>& d,
+                                      const std::vector<T>& du,
+                                      const std::vector<T>& dw,
+                                      std::vector<T>&       x,
+                                      rocsparse_int         batch_count,
+                                      rocsparse_int         batch_stride);
+
+template <typename T>
+void host_gpsv_no_pivot_interleaved_batch(rocsparse_int         m,
+                                          const std::vector<T>& ds,
+                                          const std::vector<T>& dl,
+                                          const std::vector<T>& d,
+                                          const std::vector<T>& du,
+                                          const std::vector<T>& dw,
+                                          std::vector<T>&       x,
+                                          rocsparse_int         batch_count,
+                                          rocsparse_int         batch_stride);
+
+void host_csrcolor(rocsparse_int                     M,
+                   const std::vector<rocsparse_int>& csr_row_ptr,
+                   const std::vector<rocsparse_int>& csr_col_ind,
+                   rocsparse_index_base              base,
+                   rocsparse_int&                    ncolors,
+                   std::vector<rocsparse_int>&       coloring,
+                   std::vector<rocsparse_int>&       reordering);
+
+void host_csrrcm(rocsparse_int                     M,
+                 const std::vector<rocsparse_int>& csr_row_ptr,
+                 const std::vector<rocsparse_int>& csr_col_ind,
+                 rocsparse_index_base              base,
+                 std::vector<rocsparse_int>&       perm);
+
+void host_csrbandwidth(rocsparse_int                     M,
+                       const std::vector<rocsparse_int>& csr_row_ptr,
+                       const std::vector<rocsparse_int>& csr_col_ind,
+                       rocsparse_index_base              base,
+                       rocsparse_int&                    bandwidth,
+                       int64_t&                          profile);
+
 /*
  * ===========================================================================
  *    conversion SPARSE
@@ -690,6 +1056,17 @@ void host_csr_to_csc(rocsparse_int               M,
                      rocsparse_action            action,
                      rocsparse_index_base        base);
 
+template <typename T>
+void host_csrsympermute(rocsparse_int                     M,
+                        const std::vector<rocsparse_int>& csr_row_ptr,
+                        const std::vector<rocsparse_int>& csr_col_ind,
+                        const std::vector<T>&             csr_val,
+                        const std::vector<rocsparse_int>& perm,
+                        std::vector<rocsparse_int>&       csr_row_ptr_out,
+                        std::vector<rocsparse_int>&       csr_col_ind_out,
+                        std::vector<T>&                   csr_val_out,
+                        rocsparse_index_base              base);
+
 template <typename T>
 void host_gebsr_to_gebsc(rocsparse_int                     Mb,
                          rocsparse_int                     Nb,
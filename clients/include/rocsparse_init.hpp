@@ -235,6 +235,18 @@ void rocsparse_init_csr_random(std::vector<I>&      row_ptr,
                                bool                 full_rank = false,
                                bool                 to_int    = false);
 
+/* ==================================================================================== */
+/*! \brief  Generate a R-MAT power law sparse matrix in CSR format */
+template <typename I, typename J, typename T>
+void rocsparse_init_csr_rmat(std::vector<I>&      row_ptr,
+                             std::vector<J>&      col_ind,
+                             std::vector<T>&      val,
+                             J                    M,
+                             J                    N,
+                             I&                   nnz,
+                             rocsparse_index_base base,
+                             bool                 to_int = false);
+
 /* ==================================================================================== */
 /*! \brief  Generate a random sparse matrix in COO format */
 template <typename I, typename T>
@@ -1291,6 +1291,64 @@ public:
     }
 };
 
+template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
+struct rocsparse_matrix_factory_rmat : public rocsparse_matrix_factory_base<T, I, J>
+{
+private:
+    bool m_to_int;
+
+public:
+    rocsparse_matrix_factory_rmat(bool to_int = false)
+        : m_to_int(to_int){};
+
+    virtual void init_gebsr(std::vector<I>&      bsr_row_ptr,
+                            std::vector<J>&      bsr_col_ind,
+                            std::vector<T>&      bsr_val,
+                            rocsparse_direction  dirb,
+                            J&                   Mb,
+                            J&                   Nb,
+                            I&                   nnzb,
+                            J&                   row_block_dim,
+                            J&                   col_block_dim,
+                            rocsparse_index_base base)
+    {
+        this->init_csr(bsr_row_ptr, bsr_col_ind, bsr_val, Mb, Nb, nnzb, base);
+
+        I nvalues = nnzb * row_block_dim * col_block_dim;
+        bsr_val.resize(nvalues);
+        for(I i = 0; i < nvalues; ++i)
+        {
+            bsr_val[i] = this->m_to_int ? random_generator_exact<T>() : random_generator<T>();
+        }
+    }
+
+    virtual void init_csr(std::vector<I>&      csr_row_ptr,
+                          std::vector<J>&      csr_col_ind,
+                          std::vector<T>&      csr_val,
+                          J&                   M,
+                          J&                   N,
+                          I&                   nnz,
+                          rocsparse_index_base base)
+    {
+        rocsparse_init_csr_rmat(csr_row_ptr, csr_col_ind, csr_val, M, N, nnz, base, this->m_to_int);
+    }
+
+    virtual void init_coo(std::vector<I>&      coo_row_ind,
+                          std::vector<I>&      coo_col_ind,
+                          std::vector<T>&      coo_val,
+                          I&                   M,
+                          I&                   N,
+                          I&                   nnz,
+                          rocsparse_index_base base)
+    {
+        std::vector<I> csr_row_ptr;
+        rocsparse_init_csr_rmat(csr_row_ptr, coo_col_ind, coo_val, M, N, nnz, base, this->m_to_int);
+
+        // Convert to COO
+        host_csr_to_coo(M, nnz, csr_row_ptr, coo_row_ind, base);
+    }
+};
+
 template <typename T, typename I = rocsparse_int, typename J = rocsparse_int>
 struct rocsparse_matrix_factory : public rocsparse_matrix_factory_base<T, I, J>
 {
@@ -1366,6 +1424,12 @@ public:
             break;
         }
 
+        case rocsparse_matrix_rmat:
+        {
+            this->m_instance = new rocsparse_matrix_factory_rmat<T, I, J>(to_int);
+            break;
+        }
+
         default:
         {
             this->m_instance = nullptr;
@@ -30,5 +30,7 @@ template <typename T>
 void testing_csrgemm_bad_arg(const Arguments& arg);
 template <typename T>
 void testing_csrgemm(const Arguments& arg);
+template <typename T>
+void testing_csrgemm_symmetric(const Arguments& arg);
 
 #endif // TESTING_CSRGEMM_HPP
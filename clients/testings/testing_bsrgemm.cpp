@@ -0,0 +1,911 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_bsrgemm.hpp"
+
+template <typename T>
+void testing_bsrgemm_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    T h_alpha = static_cast<T>(1);
+    T h_beta  = static_cast<T>(1);
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr local_descr_A;
+    rocsparse_local_mat_descr local_descr_B;
+    rocsparse_local_mat_descr local_descr_C;
+    rocsparse_local_mat_descr local_descr_D;
+
+    // Create matrix info for C
+    rocsparse_local_mat_info local_info_C;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dbsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dbsr_col_ind(safe_size);
+    device_vector<T>             dbsr_val(safe_size);
+    device_vector<T>             dbuffer(safe_size);
+
+    if(!dbsr_row_ptr || !dbsr_col_ind || !dbsr_val || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    size_t        h_buffer_size;
+    rocsparse_int h_nnzb_C;
+
+    rocsparse_handle     handle        = local_handle;
+    rocsparse_direction  dir           = rocsparse_direction_row;
+    rocsparse_operation  trans_A       = rocsparse_operation_none;
+    rocsparse_operation  trans_B       = rocsparse_operation_none;
+    rocsparse_int        mb            = safe_size;
+    rocsparse_int        nb            = safe_size;
+    rocsparse_int        kb            = safe_size;
+    rocsparse_int        block_dim     = 2;
+    const T*             alpha         = &h_alpha;
+    rocsparse_mat_descr  descr_A       = local_descr_A;
+    rocsparse_int        nnzb_A        = safe_size;
+    const T*             bsr_val_A     = dbsr_val;
+    const rocsparse_int* bsr_row_ptr_A = dbsr_row_ptr;
+    const rocsparse_int* bsr_col_ind_A = dbsr_col_ind;
+    rocsparse_mat_descr  descr_B       = local_descr_B;
+    rocsparse_int        nnzb_B        = safe_size;
+    const T*             bsr_val_B     = dbsr_val;
+    const rocsparse_int* bsr_row_ptr_B = dbsr_row_ptr;
+    const rocsparse_int* bsr_col_ind_B = dbsr_col_ind;
+    const T*             beta          = &h_beta;
+    rocsparse_mat_descr  descr_D       = local_descr_D;
+    rocsparse_int        nnzb_D        = safe_size;
+    const T*             bsr_val_D     = dbsr_val;
+    const rocsparse_int* bsr_row_ptr_D = dbsr_row_ptr;
+    const rocsparse_int* bsr_col_ind_D = dbsr_col_ind;
+    rocsparse_mat_descr  descr_C       = local_descr_C;
+    T*                   bsr_val_C     = dbsr_val;
+    rocsparse_int*       bsr_row_ptr_C = dbsr_row_ptr;
+    rocsparse_int*       bsr_col_ind_C = dbsr_col_ind;
+    rocsparse_int*       nnzb_C        = &h_nnzb_C;
+    rocsparse_mat_info   info_C        = local_info_C;
+    size_t*              buffer_size   = &h_buffer_size;
+    void*                temp_buffer   = dbuffer;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+#define PARAMS_BUFFER_SIZE                                                                       \
+    handle, dir, trans_A, trans_B, mb, nb, kb, block_dim, alpha, descr_A, nnzb_A, bsr_row_ptr_A, \
+        bsr_col_ind_A, descr_B, nnzb_B, bsr_row_ptr_B, bsr_col_ind_B, beta, descr_D, nnzb_D,     \
+        bsr_row_ptr_D, bsr_col_ind_D, info_C, buffer_size
+#define PARAMS_NNZB                                                                       \
+    handle, dir, trans_A, trans_B, mb, nb, kb, block_dim, descr_A, nnzb_A, bsr_row_ptr_A, \
+        bsr_col_ind_A, descr_B, nnzb_B, bsr_row_ptr_B, bsr_col_ind_B, descr_D, nnzb_D,    \
+        bsr_row_ptr_D, bsr_col_ind_D, descr_C, bsr_row_ptr_C, nnzb_C, info_C, temp_buffer
+#define PARAMS                                                                                  \
+    handle, dir, trans_A, trans_B, mb, nb, kb, block_dim, alpha, descr_A, nnzb_A, bsr_val_A,    \
+        bsr_row_ptr_A, bsr_col_ind_A, descr_B, nnzb_B, bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, \
+        beta, descr_D, nnzb_D, bsr_val_D, bsr_row_ptr_D, bsr_col_ind_D, descr_C, bsr_val_C,     \
+        bsr_row_ptr_C, bsr_col_ind_C, info_C, temp_buffer
+
+    // Invalid handle
+    handle = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_nnzb(PARAMS_NNZB), rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_handle);
+    handle = local_handle;
+
+    // Invalid block direction and operations
+    dir = (rocsparse_direction)-1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_nnzb(PARAMS_NNZB), rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_value);
+    dir = rocsparse_direction_row;
+
+    trans_A = (rocsparse_operation)-1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_nnzb(PARAMS_NNZB), rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_value);
+    trans_A = rocsparse_operation_none;
+
+    // Transposed operands are not supported
+    trans_A = rocsparse_operation_transpose;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_nnzb(PARAMS_NNZB), rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_not_implemented);
+    trans_A = rocsparse_operation_none;
+
+    trans_B = rocsparse_operation_transpose;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_nnzb(PARAMS_NNZB), rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_not_implemented);
+    trans_B = rocsparse_operation_none;
+
+    // Invalid block dimension
+    block_dim = 0;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_nnzb(PARAMS_NNZB), rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_size);
+    block_dim = 2;
+
+    // Invalid sizes
+    mb = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_size);
+    mb = safe_size;
+
+    nb = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_size);
+    nb = safe_size;
+
+    kb = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_size);
+    kb = safe_size;
+
+    nnzb_A = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_size);
+    nnzb_A = safe_size;
+
+    nnzb_B = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_size);
+    nnzb_B = safe_size;
+
+    nnzb_D = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_size);
+    nnzb_D = safe_size;
+
+    // Invalid matrix info
+    info_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm_nnzb(PARAMS_NNZB), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_pointer);
+    info_C = local_info_C;
+
+    // Matrix info that has not been set up by rocsparse_bsrgemm_buffer_size()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrgemm<T>(PARAMS), rocsparse_status_invalid_pointer);
+
+#undef PARAMS
+#undef PARAMS_NNZB
+#undef PARAMS_BUFFER_SIZE
+}
+
+template <typename T>
+void testing_bsrgemm(const Arguments& arg)
+{
+    rocsparse_int                      Mb        = arg.M;
+    rocsparse_int                      Nb        = arg.N;
+    rocsparse_int                      Kb        = arg.K;
+    rocsparse_int                      block_dim = arg.block_dim;
+    rocsparse_direction                dir       = arg.direction;
+    rocsparse_operation                transA    = arg.transA;
+    rocsparse_operation                transB    = arg.transB;
+    rocsparse_index_base               baseA     = arg.baseA;
+    rocsparse_index_base               baseB     = arg.baseB;
+    rocsparse_index_base               baseC     = arg.baseC;
+    rocsparse_index_base               baseD     = arg.baseD;
+    static constexpr bool              full_rank = false;
+    rocsparse_matrix_factory<T>        matrix_factory(arg, arg.timing ? false : true, full_rank);
+    rocsparse_matrix_factory_random<T> matrix_factory_random(full_rank);
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // alpha == -99 means test for alpha == nullptr
+    // beta  == -99 means test for beta == nullptr
+    T* halpha_ptr = (h_alpha == static_cast<T>(-99)) ? nullptr : &h_alpha;
+    T* hbeta_ptr  = (h_beta == static_cast<T>(-99)) ? nullptr : &h_beta;
+
+    // C = 0 is not a valid product
+    if(halpha_ptr == nullptr && hbeta_ptr == nullptr)
+    {
+        return;
+    }
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descrA;
+    rocsparse_local_mat_descr descrB;
+    rocsparse_local_mat_descr descrC;
+    rocsparse_local_mat_descr descrD;
+
+    // Create matrix info for C
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrB, baseB));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrC, baseC));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrD, baseD));
+
+    // Argument sanity check before allocating invalid memory
+    if(Mb <= 0 || Nb <= 0 || Kb <= 0 || block_dim <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dbsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dbsr_col_ind(safe_size);
+        device_vector<T>             dbsr_val(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dbsr_row_ptr || !dbsr_col_ind || !dbsr_val || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        size_t        buffer_size;
+        rocsparse_int nnzb_C;
+
+        rocsparse_status status_1 = rocsparse_bsrgemm_buffer_size<T>(handle,
+                                                                     dir,
+                                                                     transA,
+                                                                     transB,
+                                                                     Mb,
+                                                                     Nb,
+                                                                     Kb,
+                                                                     block_dim,
+                                                                     halpha_ptr,
+                                                                     descrA,
+                                                                     safe_size,
+                                                                     dbsr_row_ptr,
+                                                                     dbsr_col_ind,
+                                                                     descrB,
+                                                                     safe_size,
+                                                                     dbsr_row_ptr,
+                                                                     dbsr_col_ind,
+                                                                     hbeta_ptr,
+                                                                     descrD,
+                                                                     safe_size,
+                                                                     dbsr_row_ptr,
+                                                                     dbsr_col_ind,
+                                                                     info,
+                                                                     &buffer_size);
+        rocsparse_status status_2 = rocsparse_bsrgemm_nnzb(handle,
+                                                           dir,
+                                                           transA,
+                                                           transB,
+                                                           Mb,
+                                                           Nb,
+                                                           Kb,
+                                                           block_dim,
+                                                           descrA,
+                                                           safe_size,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           descrB,
+                                                           safe_size,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           descrD,
+                                                           safe_size,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           descrC,
+                                                           dbsr_row_ptr,
+                                                           &nnzb_C,
+                                                           info,
+                                                           dbuffer);
+        rocsparse_status status_3 = rocsparse_bsrgemm<T>(handle,
+                                                         dir,
+                                                         transA,
+                                                         transB,
+                                                         Mb,
+                                                         Nb,
+                                                         Kb,
+                                                         block_dim,
+                                                         halpha_ptr,
+                                                         descrA,
+                                                         safe_size,
+                                                         dbsr_val,
+                                                         dbsr_row_ptr,
+                                                         dbsr_col_ind,
+                                                         descrB,
+                                                         safe_size,
+                                                         dbsr_val,
+                                                         dbsr_row_ptr,
+                                                         dbsr_col_ind,
+                                                         hbeta_ptr,
+                                                         descrD,
+                                                         safe_size,
+                                                         dbsr_val,
+                                                         dbsr_row_ptr,
+                                                         dbsr_col_ind,
+                                                         descrC,
+                                                         dbsr_val,
+                                                         dbsr_row_ptr,
+                                                         dbsr_col_ind,
+                                                         info,
+                                                         dbuffer);
+
+        // Negative sizes and block dimensions are rejected by all stages, empty
+        // products are forwarded to csrgemm and tested there
+        if(Mb < 0 || Nb < 0 || Kb < 0 || block_dim <= 0)
+        {
+            EXPECT_ROCSPARSE_STATUS(status_1, rocsparse_status_invalid_size);
+            EXPECT_ROCSPARSE_STATUS(status_2, rocsparse_status_invalid_size);
+            EXPECT_ROCSPARSE_STATUS(status_3, rocsparse_status_invalid_size);
+        }
+
+        return;
+    }
+
+    // Allocate host memory for matrices
+    host_vector<rocsparse_int> hbsr_row_ptr_A;
+    host_vector<rocsparse_int> hbsr_col_ind_A;
+    host_vector<T>             hbsr_val_A;
+    host_vector<rocsparse_int> hbsr_row_ptr_B;
+    host_vector<rocsparse_int> hbsr_col_ind_B;
+    host_vector<T>             hbsr_val_B;
+    host_vector<rocsparse_int> hbsr_row_ptr_D;
+    host_vector<rocsparse_int> hbsr_col_ind_D;
+    host_vector<T>             hbsr_val_D;
+
+    // Sample matrices with square blocks
+    rocsparse_int nnzb_A;
+    rocsparse_int nnzb_B;
+    rocsparse_int nnzb_D;
+    rocsparse_int row_block_dim = block_dim;
+    rocsparse_int col_block_dim = block_dim;
+    matrix_factory.init_gebsr(hbsr_row_ptr_A,
+                              hbsr_col_ind_A,
+                              hbsr_val_A,
+                              dir,
+                              Mb,
+                              Kb,
+                              nnzb_A,
+                              row_block_dim,
+                              col_block_dim,
+                              baseA);
+    matrix_factory_random.init_gebsr(hbsr_row_ptr_B,
+                                     hbsr_col_ind_B,
+                                     hbsr_val_B,
+                                     dir,
+                                     Kb,
+                                     Nb,
+                                     nnzb_B,
+                                     row_block_dim,
+                                     col_block_dim,
+                                     baseB);
+    matrix_factory_random.init_gebsr(hbsr_row_ptr_D,
+                                     hbsr_col_ind_D,
+                                     hbsr_val_D,
+                                     dir,
+                                     Mb,
+                                     Nb,
+                                     nnzb_D,
+                                     row_block_dim,
+                                     col_block_dim,
+                                     baseD);
+
+    rocsparse_int bs = block_dim * block_dim;
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dbsr_row_ptr_A(Mb + 1);
+    device_vector<rocsparse_int> dbsr_col_ind_A(nnzb_A);
+    device_vector<T>             dbsr_val_A(nnzb_A * bs);
+    device_vector<rocsparse_int> dbsr_row_ptr_B(Kb + 1);
+    device_vector<rocsparse_int> dbsr_col_ind_B(nnzb_B);
+    device_vector<T>             dbsr_val_B(nnzb_B * bs);
+    device_vector<rocsparse_int> dbsr_row_ptr_D(Mb + 1);
+    device_vector<rocsparse_int> dbsr_col_ind_D(nnzb_D);
+    device_vector<T>             dbsr_val_D(nnzb_D * bs);
+    device_vector<T>             d_alpha(1);
+    device_vector<T>             d_beta(1);
+    device_vector<rocsparse_int> dbsr_row_ptr_C_1(Mb + 1);
+    device_vector<rocsparse_int> dbsr_row_ptr_C_2(Mb + 1);
+    device_vector<rocsparse_int> dnnzb_C_2(1);
+
+    if(!dbsr_row_ptr_A || !dbsr_col_ind_A || !dbsr_val_A || !dbsr_row_ptr_B || !dbsr_col_ind_B
+       || !dbsr_val_B || !dbsr_row_ptr_D || !dbsr_col_ind_D || !dbsr_val_D || !d_alpha || !d_beta
+       || !dbsr_row_ptr_C_1 || !dbsr_row_ptr_C_2 || !dnnzb_C_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_row_ptr_A, hbsr_row_ptr_A, sizeof(rocsparse_int) * (Mb + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_col_ind_A, hbsr_col_ind_A, sizeof(rocsparse_int) * nnzb_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbsr_val_A, hbsr_val_A, sizeof(T) * nnzb_A * bs, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_row_ptr_B, hbsr_row_ptr_B, sizeof(rocsparse_int) * (Kb + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_col_ind_B, hbsr_col_ind_B, sizeof(rocsparse_int) * nnzb_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbsr_val_B, hbsr_val_B, sizeof(T) * nnzb_B * bs, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_row_ptr_D, hbsr_row_ptr_D, sizeof(rocsparse_int) * (Mb + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dbsr_col_ind_D, hbsr_col_ind_D, sizeof(rocsparse_int) * nnzb_D, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbsr_val_D, hbsr_val_D, sizeof(T) * nnzb_D * bs, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    T* dalpha_ptr = (halpha_ptr != nullptr) ? (T*)d_alpha : nullptr;
+    T* dbeta_ptr  = (hbeta_ptr != nullptr) ? (T*)d_beta : nullptr;
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_bsrgemm_buffer_size<T>(handle,
+                                                           dir,
+                                                           transA,
+                                                           transB,
+                                                           Mb,
+                                                           Nb,
+                                                           Kb,
+                                                           block_dim,
+                                                           halpha_ptr,
+                                                           descrA,
+                                                           nnzb_A,
+                                                           dbsr_row_ptr_A,
+                                                           dbsr_col_ind_A,
+                                                           descrB,
+                                                           nnzb_B,
+                                                           dbsr_row_ptr_B,
+                                                           dbsr_col_ind_B,
+                                                           hbeta_ptr,
+                                                           descrD,
+                                                           nnzb_D,
+                                                           dbsr_row_ptr_D,
+                                                           dbsr_col_ind_D,
+                                                           info,
+                                                           &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        rocsparse_int hnnzb_C_gold;
+        rocsparse_int hnnzb_C_1;
+        rocsparse_int hnnzb_C_2;
+
+        // Obtain nnzb of C
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrgemm_nnzb(handle,
+                                                     dir,
+                                                     transA,
+                                                     transB,
+                                                     Mb,
+                                                     Nb,
+                                                     Kb,
+                                                     block_dim,
+                                                     descrA,
+                                                     nnzb_A,
+                                                     dbsr_row_ptr_A,
+                                                     dbsr_col_ind_A,
+                                                     descrB,
+                                                     nnzb_B,
+                                                     dbsr_row_ptr_B,
+                                                     dbsr_col_ind_B,
+                                                     descrD,
+                                                     nnzb_D,
+                                                     dbsr_row_ptr_D,
+                                                     dbsr_col_ind_D,
+                                                     descrC,
+                                                     dbsr_row_ptr_C_1,
+                                                     &hnnzb_C_1,
+                                                     info,
+                                                     dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrgemm_nnzb(handle,
+                                                     dir,
+                                                     transA,
+                                                     transB,
+                                                     Mb,
+                                                     Nb,
+                                                     Kb,
+                                                     block_dim,
+                                                     descrA,
+                                                     nnzb_A,
+                                                     dbsr_row_ptr_A,
+                                                     dbsr_col_ind_A,
+                                                     descrB,
+                                                     nnzb_B,
+                                                     dbsr_row_ptr_B,
+                                                     dbsr_col_ind_B,
+                                                     descrD,
+                                                     nnzb_D,
+                                                     dbsr_row_ptr_D,
+                                                     dbsr_col_ind_D,
+                                                     descrC,
+                                                     dbsr_row_ptr_C_2,
+                                                     dnnzb_C_2,
+                                                     info,
+                                                     dbuffer));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hbsr_row_ptr_C_1(Mb + 1);
+        host_vector<rocsparse_int> hbsr_row_ptr_C_2(Mb + 1);
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hnnzb_C_2, dnnzb_C_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_row_ptr_C_1,
+                                  dbsr_row_ptr_C_1,
+                                  sizeof(rocsparse_int) * (Mb + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_row_ptr_C_2,
+                                  dbsr_row_ptr_C_2,
+                                  sizeof(rocsparse_int) * (Mb + 1),
+                                  hipMemcpyDeviceToHost));
+
+        // The block pattern of C is the csrgemm pattern of the block patterns of A, B and D
+        host_vector<rocsparse_int> hbsr_row_ptr_C_gold(Mb + 1);
+        host_csrgemm_nnz(Mb,
+                         Nb,
+                         Kb,
+                         halpha_ptr,
+                         hbsr_row_ptr_A,
+                         hbsr_col_ind_A,
+                         hbsr_row_ptr_B,
+                         hbsr_col_ind_B,
+                         hbeta_ptr,
+                         hbsr_row_ptr_D,
+                         hbsr_col_ind_D,
+                         hbsr_row_ptr_C_gold,
+                         &hnnzb_C_gold,
+                         baseA,
+                         baseB,
+                         baseC,
+                         baseD);
+
+        // Check nnzb of C
+        unit_check_general(1, 1, 1, &hnnzb_C_gold, &hnnzb_C_1);
+        unit_check_general(1, 1, 1, &hnnzb_C_gold, &hnnzb_C_2);
+
+        // Check block row pointers of C
+        unit_check_general<rocsparse_int>(1, Mb + 1, 1, hbsr_row_ptr_C_gold, hbsr_row_ptr_C_1);
+        unit_check_general<rocsparse_int>(1, Mb + 1, 1, hbsr_row_ptr_C_gold, hbsr_row_ptr_C_2);
+
+        // Allocate device memory for C
+        device_vector<rocsparse_int> dbsr_col_ind_C_1(hnnzb_C_1);
+        device_vector<rocsparse_int> dbsr_col_ind_C_2(hnnzb_C_2);
+        device_vector<T>             dbsr_val_C_1(hnnzb_C_1 * bs);
+        device_vector<T>             dbsr_val_C_2(hnnzb_C_2 * bs);
+
+        if(!dbsr_col_ind_C_1 || !dbsr_col_ind_C_2 || !dbsr_val_C_1 || !dbsr_val_C_2)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Perform matrix matrix multiplication
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrgemm<T>(handle,
+                                                   dir,
+                                                   transA,
+                                                   transB,
+                                                   Mb,
+                                                   Nb,
+                                                   Kb,
+                                                   block_dim,
+                                                   halpha_ptr,
+                                                   descrA,
+                                                   nnzb_A,
+                                                   dbsr_val_A,
+                                                   dbsr_row_ptr_A,
+                                                   dbsr_col_ind_A,
+                                                   descrB,
+                                                   nnzb_B,
+                                                   dbsr_val_B,
+                                                   dbsr_row_ptr_B,
+                                                   dbsr_col_ind_B,
+                                                   hbeta_ptr,
+                                                   descrD,
+                                                   nnzb_D,
+                                                   dbsr_val_D,
+                                                   dbsr_row_ptr_D,
+                                                   dbsr_col_ind_D,
+                                                   descrC,
+                                                   dbsr_val_C_1,
+                                                   dbsr_row_ptr_C_1,
+                                                   dbsr_col_ind_C_1,
+                                                   info,
+                                                   dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrgemm<T>(handle,
+                                                   dir,
+                                                   transA,
+                                                   transB,
+                                                   Mb,
+                                                   Nb,
+                                                   Kb,
+                                                   block_dim,
+                                                   dalpha_ptr,
+                                                   descrA,
+                                                   nnzb_A,
+                                                   dbsr_val_A,
+                                                   dbsr_row_ptr_A,
+                                                   dbsr_col_ind_A,
+                                                   descrB,
+                                                   nnzb_B,
+                                                   dbsr_val_B,
+                                                   dbsr_row_ptr_B,
+                                                   dbsr_col_ind_B,
+                                                   dbeta_ptr,
+                                                   descrD,
+                                                   nnzb_D,
+                                                   dbsr_val_D,
+                                                   dbsr_row_ptr_D,
+                                                   dbsr_col_ind_D,
+                                                   descrC,
+                                                   dbsr_val_C_2,
+                                                   dbsr_row_ptr_C_2,
+                                                   dbsr_col_ind_C_2,
+                                                   info,
+                                                   dbuffer));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hbsr_col_ind_C_1(hnnzb_C_1);
+        host_vector<rocsparse_int> hbsr_col_ind_C_2(hnnzb_C_2);
+        host_vector<T>             hbsr_val_C_1(hnnzb_C_1 * bs);
+        host_vector<T>             hbsr_val_C_2(hnnzb_C_2 * bs);
+
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_col_ind_C_1,
+                                  dbsr_col_ind_C_1,
+                                  sizeof(rocsparse_int) * hnnzb_C_1,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_col_ind_C_2,
+                                  dbsr_col_ind_C_2,
+                                  sizeof(rocsparse_int) * hnnzb_C_2,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hbsr_val_C_1, dbsr_val_C_1, sizeof(T) * hnnzb_C_1 * bs, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hbsr_val_C_2, dbsr_val_C_2, sizeof(T) * hnnzb_C_2 * bs, hipMemcpyDeviceToHost));
+
+        // CPU bsrgemm
+        host_vector<rocsparse_int> hbsr_col_ind_C_gold(hnnzb_C_gold);
+        host_vector<T>             hbsr_val_C_gold(hnnzb_C_gold * bs);
+        host_bsrgemm<T>(dir,
+                        Mb,
+                        Nb,
+                        Kb,
+                        block_dim,
+                        halpha_ptr,
+                        hbsr_row_ptr_A,
+                        hbsr_col_ind_A,
+                        hbsr_val_A,
+                        hbsr_row_ptr_B,
+                        hbsr_col_ind_B,
+                        hbsr_val_B,
+                        hbeta_ptr,
+                        hbsr_row_ptr_D,
+                        hbsr_col_ind_D,
+                        hbsr_val_D,
+                        hbsr_row_ptr_C_gold,
+                        hbsr_col_ind_C_gold,
+                        hbsr_val_C_gold,
+                        baseA,
+                        baseB,
+                        baseC,
+                        baseD);
+
+        // Check C
+        unit_check_general<rocsparse_int>(
+            1, hnnzb_C_gold, 1, hbsr_col_ind_C_gold, hbsr_col_ind_C_1);
+        unit_check_general<rocsparse_int>(
+            1, hnnzb_C_gold, 1, hbsr_col_ind_C_gold, hbsr_col_ind_C_2);
+        near_check_general<T>(1, hnnzb_C_gold * bs, 1, hbsr_val_C_gold, hbsr_val_C_1);
+        near_check_general<T>(1, hnnzb_C_gold * bs, 1, hbsr_val_C_gold, hbsr_val_C_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        rocsparse_int nnzb_C;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        double gpu_analysis_time_used = get_time_us();
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrgemm_nnzb(handle,
+                                                     dir,
+                                                     transA,
+                                                     transB,
+                                                     Mb,
+                                                     Nb,
+                                                     Kb,
+                                                     block_dim,
+                                                     descrA,
+                                                     nnzb_A,
+                                                     dbsr_row_ptr_A,
+                                                     dbsr_col_ind_A,
+                                                     descrB,
+                                                     nnzb_B,
+                                                     dbsr_row_ptr_B,
+                                                     dbsr_col_ind_B,
+                                                     descrD,
+                                                     nnzb_D,
+                                                     dbsr_row_ptr_D,
+                                                     dbsr_col_ind_D,
+                                                     descrC,
+                                                     dbsr_row_ptr_C_1,
+                                                     &nnzb_C,
+                                                     info,
+                                                     dbuffer));
+
+        gpu_analysis_time_used = get_time_us() - gpu_analysis_time_used;
+
+        device_vector<rocsparse_int> dbsr_col_ind_C(nnzb_C);
+        device_vector<T>             dbsr_val_C(nnzb_C * bs);
+
+        if(!dbsr_col_ind_C || !dbsr_val_C)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrgemm<T>(handle,
+                                                       dir,
+                                                       transA,
+                                                       transB,
+                                                       Mb,
+                                                       Nb,
+                                                       Kb,
+                                                       block_dim,
+                                                       halpha_ptr,
+                                                       descrA,
+                                                       nnzb_A,
+                                                       dbsr_val_A,
+                                                       dbsr_row_ptr_A,
+                                                       dbsr_col_ind_A,
+                                                       descrB,
+                                                       nnzb_B,
+                                                       dbsr_val_B,
+                                                       dbsr_row_ptr_B,
+                                                       dbsr_col_ind_B,
+                                                       hbeta_ptr,
+                                                       descrD,
+                                                       nnzb_D,
+                                                       dbsr_val_D,
+                                                       dbsr_row_ptr_D,
+                                                       dbsr_col_ind_D,
+                                                       descrC,
+                                                       dbsr_val_C,
+                                                       dbsr_row_ptr_C_1,
+                                                       dbsr_col_ind_C,
+                                                       info,
+                                                       dbuffer));
+        }
+
+        double gpu_solve_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrgemm<T>(handle,
+                                                       dir,
+                                                       transA,
+                                                       transB,
+                                                       Mb,
+                                                       Nb,
+                                                       Kb,
+                                                       block_dim,
+                                                       halpha_ptr,
+                                                       descrA,
+                                                       nnzb_A,
+                                                       dbsr_val_A,
+                                                       dbsr_row_ptr_A,
+                                                       dbsr_col_ind_A,
+                                                       descrB,
+                                                       nnzb_B,
+                                                       dbsr_val_B,
+                                                       dbsr_row_ptr_B,
+                                                       dbsr_col_ind_B,
+                                                       hbeta_ptr,
+                                                       descrD,
+                                                       nnzb_D,
+                                                       dbsr_val_D,
+                                                       dbsr_row_ptr_D,
+                                                       dbsr_col_ind_D,
+                                                       descrC,
+                                                       dbsr_val_C,
+                                                       dbsr_row_ptr_C_1,
+                                                       dbsr_col_ind_C,
+                                                       info,
+                                                       dbuffer));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+        double gpu_gflops = bsrgemm_gflop_count<T>(Mb,
+                                                   block_dim,
+                                                   halpha_ptr,
+                                                   hbsr_row_ptr_A.data(),
+                                                   hbsr_col_ind_A.data(),
+                                                   hbsr_row_ptr_B.data(),
+                                                   hbeta_ptr,
+                                                   hbsr_row_ptr_D.data(),
+                                                   baseA)
+                            / gpu_solve_time_used * 1e6;
+        double gpu_gbyte
+            = bsrgemm_gbyte_count<T>(
+                  Mb, Kb, block_dim, nnzb_A, nnzb_B, nnzb_C, nnzb_D, halpha_ptr, hbeta_ptr)
+              / gpu_solve_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "Mb" << std::setw(12) << "Nb" << std::setw(12) << "Kb"
+                  << std::setw(12) << "block_dim" << std::setw(12) << "dir" << std::setw(12)
+                  << "nnzb_A" << std::setw(12) << "nnzb_B" << std::setw(12) << "nnzb_C"
+                  << std::setw(12) << "nnzb_D" << std::setw(12) << "alpha" << std::setw(12)
+                  << "beta" << std::setw(12) << "GFlop/s" << std::setw(12) << "GB/s"
+                  << std::setw(16) << "nnzb msec" << std::setw(16) << "gemm msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << Mb << std::setw(12) << Nb << std::setw(12) << Kb
+                  << std::setw(12) << block_dim << std::setw(12) << rocsparse_direction2string(dir)
+                  << std::setw(12) << nnzb_A << std::setw(12) << nnzb_B << std::setw(12) << nnzb_C
+                  << std::setw(12) << nnzb_D << std::setw(12)
+                  << (halpha_ptr ? *halpha_ptr : static_cast<T>(0)) << std::setw(12)
+                  << (hbeta_ptr ? *hbeta_ptr : static_cast<T>(0)) << std::setw(12) << gpu_gflops
+                  << std::setw(12) << gpu_gbyte << std::setw(16) << gpu_analysis_time_used / 1e3
+                  << std::setw(16) << gpu_solve_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << std::endl;
+    }
+
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_bsrgemm_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_bsrgemm<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,507 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "testing_bsrjacobi.hpp"
+
+template <typename T>
+void testing_bsrjacobi_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 10;
+    const T             h_alpha   = static_cast<T>(1);
+    const T             h_beta    = static_cast<T>(0);
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle            = local_handle;
+    rocsparse_direction       dir               = rocsparse_direction_row;
+    rocsparse_int             mb                = safe_size;
+    rocsparse_int             nnzb              = safe_size;
+    const rocsparse_mat_descr descr             = local_descr;
+    const T*                  bsr_val           = (const T*)0x4;
+    const rocsparse_int*      bsr_row_ptr       = (const rocsparse_int*)0x4;
+    const rocsparse_int*      bsr_col_ind       = (const rocsparse_int*)0x4;
+    rocsparse_int             block_dim         = safe_size;
+    rocsparse_mat_info        info              = local_info;
+    T*                        bsr_diag_inv      = (T*)0x4;
+    void*                     temp_buffer       = (void*)0x4;
+    size_t*                   buffer_size       = (size_t*)0x4;
+    const T*                  alpha_device_host = (const T*)&h_alpha;
+    const T*                  x                 = (const T*)0x4;
+    const T*                  beta_device_host  = (const T*)&h_beta;
+    T*                        y                 = (T*)0x4;
+
+#define PARAMS_BUFFER_SIZE \
+    handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, buffer_size
+
+#define PARAMS_SETUP                                                                  \
+    handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, bsr_col_ind, block_dim, info, \
+        bsr_diag_inv, temp_buffer
+
+#define PARAMS_APPLY \
+    handle, dir, mb, block_dim, alpha_device_host, bsr_diag_inv, x, beta_device_host, y
+
+    auto_testing_bad_arg(rocsparse_bsrjacobi_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_bsrjacobi_setup<T>, PARAMS_SETUP);
+    auto_testing_bad_arg(rocsparse_bsrjacobi_apply<T>, PARAMS_APPLY);
+
+    // Only general matrices are supported
+    for(auto matrix_type : rocsparse_matrix_type_t::values)
+    {
+        if(matrix_type != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_bsrjacobi_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_bsrjacobi_setup<T>(PARAMS_SETUP),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+
+#undef PARAMS_APPLY
+#undef PARAMS_SETUP
+#undef PARAMS_BUFFER_SIZE
+
+    // Test rocsparse_bsrjacobi_zero_pivot()
+    rocsparse_int position;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrjacobi_zero_pivot(nullptr, info, &position),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrjacobi_zero_pivot(handle, nullptr, &position),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_bsrjacobi_zero_pivot(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_bsrjacobi(const Arguments& arg)
+{
+    static constexpr bool       to_int    = false;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+    rocsparse_int               M         = arg.M;
+    rocsparse_int               N         = arg.N;
+    rocsparse_int               block_dim = arg.block_dim;
+    rocsparse_index_base        base      = arg.baseA;
+    rocsparse_direction         direction = arg.direction;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>()), h_beta(arg.get_beta<T>());
+
+    rocsparse_int Mb = -1;
+    if(block_dim > 0)
+    {
+        Mb = (M + block_dim - 1) / block_dim;
+    }
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(Mb <= 0 || block_dim <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              buffer_size;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_bsrjacobi_buffer_size<T>(handle,
+                                                                   direction,
+                                                                   Mb,
+                                                                   safe_size,
+                                                                   descr,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   nullptr,
+                                                                   block_dim,
+                                                                   &buffer_size),
+                                (Mb < 0 || block_dim <= 0) ? rocsparse_status_invalid_size
+                                                           : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_bsrjacobi_setup<T>(handle,
+                                                             direction,
+                                                             Mb,
+                                                             safe_size,
+                                                             descr,
+                                                             nullptr,
+                                                             nullptr,
+                                                             nullptr,
+                                                             block_dim,
+                                                             info,
+                                                             nullptr,
+                                                             nullptr),
+                                (Mb < 0 || block_dim <= 0) ? rocsparse_status_invalid_size
+                                                           : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_bsrjacobi_apply<T>(
+                handle, direction, Mb, block_dim, h_alpha, nullptr, nullptr, h_beta, nullptr),
+            (Mb < 0 || block_dim <= 0) ? rocsparse_status_invalid_size
+                                       : rocsparse_status_success);
+
+        return;
+    }
+
+    // Generated matrices are sized to a multiple of the block dimension, such that the diagonal
+    // blocks are not padded by the conversion
+    if(arg.matrix != rocsparse_matrix_file_rocalution && arg.matrix != rocsparse_matrix_file_mtx)
+    {
+        M = Mb * block_dim;
+        N = M;
+    }
+
+    // Allocate host memory for original CSR matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Generate CSR matrix on host (or read from file)
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // M can be modified by rocsparse_init_csr_matrix if reading from a file
+    Mb = (M + block_dim - 1) / block_dim;
+
+    // Allocate device memory for original CSR matrix
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dbsr_row_ptr(Mb + 1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dbsr_row_ptr)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy CSR matrix to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    // Convert sample CSR matrix to bsr
+    rocsparse_int nnzb;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr_nnz(handle,
+                                                direction,
+                                                M,
+                                                N,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                block_dim,
+                                                descr,
+                                                dbsr_row_ptr,
+                                                &nnzb));
+
+    // Allocate device memory for BSR col indices and values array
+    device_vector<rocsparse_int> dbsr_col_ind(nnzb);
+    device_vector<T>             dbsr_val(nnzb * block_dim * block_dim);
+    device_vector<T>             dbsr_diag_inv(Mb * block_dim * block_dim);
+    device_vector<T>             dx(Mb * block_dim);
+    device_vector<T>             dy_1(Mb * block_dim);
+    device_vector<T>             dy_2(Mb * block_dim);
+    device_vector<rocsparse_int> dpivot(1);
+
+    if(!dbsr_col_ind || !dbsr_val || !dbsr_diag_inv || !dx || !dy_1 || !dy_2 || !dpivot)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csr2bsr<T>(handle,
+                                               direction,
+                                               M,
+                                               N,
+                                               descr,
+                                               dcsr_val,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               block_dim,
+                                               descr,
+                                               dbsr_val,
+                                               dbsr_row_ptr,
+                                               dbsr_col_ind));
+
+    // Initialize vectors
+    host_vector<T> hx(Mb * block_dim);
+    host_vector<T> hy_1(Mb * block_dim);
+    host_vector<T> hy_2(Mb * block_dim);
+    host_vector<T> hy_gold(Mb * block_dim);
+
+    rocsparse_init<T>(hx, 1, Mb * block_dim, 1);
+    rocsparse_init<T>(hy_1, 1, Mb * block_dim, 1);
+
+    hy_2    = hy_1;
+    hy_gold = hy_1;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(T) * Mb * block_dim, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_1, hy_1, sizeof(T) * Mb * block_dim, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_2, hy_2, sizeof(T) * Mb * block_dim, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_bsrjacobi_buffer_size<T>(handle,
+                                                             direction,
+                                                             Mb,
+                                                             nnzb,
+                                                             descr,
+                                                             dbsr_val,
+                                                             dbsr_row_ptr,
+                                                             dbsr_col_ind,
+                                                             block_dim,
+                                                             &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        // Copy BSR matrix to host
+        host_vector<rocsparse_int> hbsr_row_ptr(Mb + 1);
+        host_vector<rocsparse_int> hbsr_col_ind(nnzb);
+        host_vector<T>             hbsr_val(nnzb * block_dim * block_dim);
+
+        CHECK_HIP_ERROR(hipMemcpy(hbsr_row_ptr,
+                                  dbsr_row_ptr,
+                                  sizeof(rocsparse_int) * (Mb + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hbsr_col_ind, dbsr_col_ind, sizeof(rocsparse_int) * nnzb, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hbsr_val, dbsr_val, sizeof(T) * nnzb * block_dim * block_dim, hipMemcpyDeviceToHost));
+
+        // Inversion of the diagonal blocks
+        CHECK_ROCSPARSE_ERROR(rocsparse_bsrjacobi_setup<T>(handle,
+                                                           direction,
+                                                           Mb,
+                                                           nnzb,
+                                                           descr,
+                                                           dbsr_val,
+                                                           dbsr_row_ptr,
+                                                           dbsr_col_ind,
+                                                           block_dim,
+                                                           info,
+                                                           dbsr_diag_inv,
+                                                           dbuffer));
+
+        // Zero pivot in host and device pointer mode
+        host_vector<rocsparse_int> hpivot_1(1);
+        host_vector<rocsparse_int> hpivot_2(1);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_bsrjacobi_zero_pivot(handle, info, hpivot_1),
+                                (hpivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                    : rocsparse_status_success);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_bsrjacobi_zero_pivot(handle, info, dpivot),
+                                (hpivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                    : rocsparse_status_success);
+        CHECK_HIP_ERROR(hipMemcpy(hpivot_2, dpivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // CPU inversion of the diagonal blocks
+        std::vector<T> hbsr_diag_inv_gold;
+        rocsparse_int  hpivot_gold;
+
+        host_bsrjacobi_setup<T>(direction,
+                                Mb,
+                                hbsr_row_ptr,
+                                hbsr_col_ind,
+                                hbsr_val,
+                                block_dim,
+                                base,
+                                hbsr_diag_inv_gold,
+                                &hpivot_gold);
+
+        // Check pivot
+        unit_check_general<rocsparse_int>(1, 1, 1, &hpivot_gold, hpivot_1);
+        unit_check_general<rocsparse_int>(1, 1, 1, &hpivot_gold, hpivot_2);
+
+        // Check the inverted blocks if no pivot has been found
+        if(hpivot_gold == -1)
+        {
+            host_vector<T> hbsr_diag_inv(Mb * block_dim * block_dim);
+
+            CHECK_HIP_ERROR(hipMemcpy(hbsr_diag_inv,
+                                      dbsr_diag_inv,
+                                      sizeof(T) * Mb * block_dim * block_dim,
+                                      hipMemcpyDeviceToHost));
+
+            near_check_general<T>(
+                1, Mb * block_dim * block_dim, 1, hbsr_diag_inv_gold.data(), hbsr_diag_inv);
+
+            // Pointer mode host
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrjacobi_apply<T>(
+                handle, direction, Mb, block_dim, h_alpha, dbsr_diag_inv, dx, h_beta, dy_1));
+
+            // Pointer mode device
+            device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrjacobi_apply<T>(
+                handle, direction, Mb, block_dim, d_alpha, dbsr_diag_inv, dx, d_beta, dy_2));
+
+            // CPU application of the preconditioner
+            host_bsrjacobi_apply<T>(
+                direction, Mb, block_dim, *h_alpha, hbsr_diag_inv_gold, hx, *h_beta, hy_gold);
+
+            // Copy output to host
+            CHECK_HIP_ERROR(
+                hipMemcpy(hy_1, dy_1, sizeof(T) * Mb * block_dim, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hy_2, dy_2, sizeof(T) * Mb * block_dim, hipMemcpyDeviceToHost));
+
+            near_check_general<T>(1, Mb * block_dim, 1, hy_gold.data(), hy_1);
+            near_check_general<T>(1, Mb * block_dim, 1, hy_gold.data(), hy_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrjacobi_setup<T>(handle,
+                                                               direction,
+                                                               Mb,
+                                                               nnzb,
+                                                               descr,
+                                                               dbsr_val,
+                                                               dbsr_row_ptr,
+                                                               dbsr_col_ind,
+                                                               block_dim,
+                                                               info,
+                                                               dbsr_diag_inv,
+                                                               dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrjacobi_apply<T>(
+                handle, direction, Mb, block_dim, h_alpha, dbsr_diag_inv, dx, h_beta, dy_1));
+        }
+
+        double gpu_setup_time_used = 0;
+        double gpu_apply_time_used = 0;
+
+        // Setup run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            double gpu_time_start = get_time_us();
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrjacobi_setup<T>(handle,
+                                                               direction,
+                                                               Mb,
+                                                               nnzb,
+                                                               descr,
+                                                               dbsr_val,
+                                                               dbsr_row_ptr,
+                                                               dbsr_col_ind,
+                                                               block_dim,
+                                                               info,
+                                                               dbsr_diag_inv,
+                                                               dbuffer));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            gpu_setup_time_used += get_time_us() - gpu_time_start;
+        }
+
+        // Apply run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            double gpu_time_start = get_time_us();
+            CHECK_ROCSPARSE_ERROR(rocsparse_bsrjacobi_apply<T>(
+                handle, direction, Mb, block_dim, h_alpha, dbsr_diag_inv, dx, h_beta, dy_1));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            gpu_apply_time_used += get_time_us() - gpu_time_start;
+        }
+
+        gpu_setup_time_used /= number_hot_calls;
+        gpu_apply_time_used /= number_hot_calls;
+
+        double gpu_setup_gbyte
+            = bsrjacobi_setup_gbyte_count<T>(Mb, block_dim, nnzb) / gpu_setup_time_used * 1e6;
+        double gpu_apply_gbyte
+            = bsrjacobi_apply_gbyte_count<T>(Mb, block_dim, *h_beta != static_cast<T>(0))
+              / gpu_apply_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "block_dim" << std::setw(12)
+                  << "nnzb" << std::setw(12) << "alpha" << std::setw(12) << "beta"
+                  << std::setw(12) << "setup GB/s" << std::setw(12) << "setup msec"
+                  << std::setw(12) << "apply GB/s" << std::setw(12) << "apply msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << block_dim << std::setw(12) << nnzb
+                  << std::setw(12) << *h_alpha << std::setw(12) << *h_beta << std::setw(12)
+                  << gpu_setup_gbyte << std::setw(12) << gpu_setup_time_used / 1e3
+                  << std::setw(12) << gpu_apply_gbyte << std::setw(12)
+                  << gpu_apply_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                \
+    template void testing_bsrjacobi_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_bsrjacobi<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
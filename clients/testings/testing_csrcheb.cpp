@@ -0,0 +1,427 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "testing_csrcheb.hpp"
+
+template <typename T>
+void testing_csrcheb_bad_arg(const Arguments& arg)
+{
+    typedef floating_data_t<T> U;
+
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    const T*                  csr_val     = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_int             iters       = 1;
+    rocsparse_int             degree      = 1;
+    U*                        lambda      = (U*)0x4;
+    U                         lambda_min  = static_cast<U>(1);
+    U                         lambda_max  = static_cast<U>(2);
+    const T*                  b           = (const T*)0x4;
+    T*                        x           = (T*)0x4;
+    size_t*                   buffer_size = (size_t*)0x4;
+    void*                     temp_buffer = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size
+
+#define PARAMS_ESTIMATE \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, iters, lambda, temp_buffer
+
+#define PARAMS                                                                                \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, degree, lambda_min, lambda_max, \
+        b, x, temp_buffer
+
+    // The eigenvalue bounds are checked separately
+    static const int nex   = 2;
+    static const int ex[2] = {8, 9};
+
+    auto_testing_bad_arg(rocsparse_csrcheb_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csrcheb_estimate<T, U>, PARAMS_ESTIMATE);
+    auto_testing_bad_arg(rocsparse_csrcheb<T, U>, nex, ex, PARAMS);
+
+    // The eigenvalue interval must be positive and non-empty
+    lambda_min = static_cast<U>(0);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcheb<T>(PARAMS), rocsparse_status_invalid_value);
+    lambda_min = static_cast<U>(2);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcheb<T>(PARAMS), rocsparse_status_invalid_value);
+    lambda_min = static_cast<U>(1);
+
+    // Only general matrices are supported
+    for(auto matrix_type : rocsparse_matrix_type_t::values)
+    {
+        if(matrix_type != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrcheb_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrcheb_estimate<T>(PARAMS_ESTIMATE),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrcheb<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+
+#undef PARAMS
+#undef PARAMS_ESTIMATE
+#undef PARAMS_BUFFER_SIZE
+}
+
+template <typename T>
+void testing_csrcheb(const Arguments& arg)
+{
+    typedef floating_data_t<T> U;
+
+    // Number of power iteration steps of the eigenvalue estimate
+    static constexpr rocsparse_int iters = 20;
+
+    rocsparse_int        M      = arg.M;
+    rocsparse_int        N      = arg.N;
+    rocsparse_int        degree = arg.nsweeps;
+    rocsparse_index_base base   = arg.baseA;
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              buffer_size;
+        U                   lambda_max;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<T>             db(safe_size);
+        device_vector<T>             dx(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !db || !dx || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrcheb_buffer_size<T>(handle,
+                                                                 M,
+                                                                 safe_size,
+                                                                 descr,
+                                                                 dcsr_val,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 &buffer_size),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrcheb_estimate<T>(handle,
+                                                              M,
+                                                              safe_size,
+                                                              descr,
+                                                              dcsr_val,
+                                                              dcsr_row_ptr,
+                                                              dcsr_col_ind,
+                                                              iters,
+                                                              &lambda_max,
+                                                              dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrcheb<T>(handle,
+                                                     M,
+                                                     safe_size,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     degree,
+                                                     static_cast<U>(1),
+                                                     static_cast<U>(2),
+                                                     db,
+                                                     dx,
+                                                     dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // Allocate host memory for vectors
+    host_vector<T> hb(M);
+    host_vector<T> hx(M);
+    host_vector<T> hx_1(M);
+    host_vector<T> hx_2(M);
+    host_vector<T> hx_gold(M);
+
+    // Initialize data on CPU
+    rocsparse_init<T>(hb, 1, M, 1);
+    rocsparse_init<T>(hx, 1, M, 1);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<T>             db(M);
+    device_vector<T>             dx_1(M);
+    device_vector<T>             dx_2(M);
+    device_vector<U>             dlambda_max(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !db || !dx_1 || !dx_2 || !dlambda_max)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(db, hb, sizeof(T) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_1, hx, sizeof(T) * M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx_2, hx, sizeof(T) * M, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrcheb_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // CPU eigenvalue estimate, the bounds of the spectrum are derived from it
+    U hlambda_gold;
+    host_csrcheb_estimate<T>(M, hcsr_row_ptr, hcsr_col_ind, hcsr_val, base, iters, &hlambda_gold);
+
+    U lambda_max = (hlambda_gold > static_cast<U>(0)) ? static_cast<U>(1.1) * hlambda_gold
+                                                      : static_cast<U>(1);
+    U lambda_min = lambda_max / 30;
+
+    if(arg.unit_check)
+    {
+        // Eigenvalue estimate in host and device pointer mode
+        U hlambda_1;
+        U hlambda_2;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcheb_estimate<T>(handle,
+                                                            M,
+                                                            nnz,
+                                                            descr,
+                                                            dcsr_val,
+                                                            dcsr_row_ptr,
+                                                            dcsr_col_ind,
+                                                            iters,
+                                                            &hlambda_1,
+                                                            dbuffer));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcheb_estimate<T>(handle,
+                                                            M,
+                                                            nnz,
+                                                            descr,
+                                                            dcsr_val,
+                                                            dcsr_row_ptr,
+                                                            dcsr_col_ind,
+                                                            iters,
+                                                            dlambda_max,
+                                                            dbuffer));
+
+        CHECK_HIP_ERROR(hipMemcpy(&hlambda_2, dlambda_max, sizeof(U), hipMemcpyDeviceToHost));
+
+        near_check_general<U>(1, 1, 1, &hlambda_gold, &hlambda_1);
+        near_check_general<U>(1, 1, 1, &hlambda_gold, &hlambda_2);
+
+        // Chebyshev smoother, the bounds are passed by value in both pointer modes
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcheb<T>(handle,
+                                                   M,
+                                                   nnz,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   degree,
+                                                   lambda_min,
+                                                   lambda_max,
+                                                   db,
+                                                   dx_1,
+                                                   dbuffer));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcheb<T>(handle,
+                                                   M,
+                                                   nnz,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   degree,
+                                                   lambda_min,
+                                                   lambda_max,
+                                                   db,
+                                                   dx_2,
+                                                   dbuffer));
+
+        // CPU Chebyshev smoother
+        hx_gold = hx;
+        host_csrcheb<T>(M,
+                        hcsr_row_ptr,
+                        hcsr_col_ind,
+                        hcsr_val,
+                        base,
+                        degree,
+                        lambda_min,
+                        lambda_max,
+                        hb,
+                        hx_gold);
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hx_1, dx_1, sizeof(T) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hx_2, dx_2, sizeof(T) * M, hipMemcpyDeviceToHost));
+
+        near_check_general<T>(1, M, 1, hx_gold, hx_1);
+        near_check_general<T>(1, M, 1, hx_gold, hx_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcheb<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       degree,
+                                                       lambda_min,
+                                                       lambda_max,
+                                                       db,
+                                                       dx_1,
+                                                       dbuffer));
+        }
+
+        double gpu_time_used = 0;
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            double gpu_time_start = get_time_us();
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcheb<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       degree,
+                                                       lambda_min,
+                                                       lambda_max,
+                                                       db,
+                                                       dx_1,
+                                                       dbuffer));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            gpu_time_used += get_time_us() - gpu_time_start;
+        }
+
+        gpu_time_used /= number_hot_calls;
+
+        double gpu_gbyte = csrcheb_gbyte_count<T>(M, nnz, degree) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "degree"
+                  << std::setw(12) << "lambda_min" << std::setw(12) << "lambda_max"
+                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12)
+                  << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << degree
+                  << std::setw(12) << lambda_min << std::setw(12) << lambda_max
+                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_csrcheb_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrcheb<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,537 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_csrcolor.hpp"
+
+template <typename T>
+void testing_csrcolor_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<rocsparse_int> dcoloring(safe_size);
+    device_vector<rocsparse_int> dreordering(safe_size);
+    device_vector<rocsparse_int> dbuffer(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcoloring || !dreordering || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrcolor_buffer_size()
+    size_t buffer_size;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrcolor_buffer_size(
+            nullptr, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrcolor_buffer_size(
+            handle, safe_size, safe_size, nullptr, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrcolor_buffer_size(
+            handle, safe_size, safe_size, descr, nullptr, dcsr_col_ind, &buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrcolor_buffer_size(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, nullptr, &buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrcolor_buffer_size(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, nullptr),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrcolor_buffer_size(
+            handle, -1, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrcolor_buffer_size(
+            handle, safe_size, -1, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+        rocsparse_status_invalid_size);
+
+    // Test rocsparse_csrcolor()
+    rocsparse_int ncolors;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor(nullptr,
+                                               safe_size,
+                                               safe_size,
+                                               descr,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               &ncolors,
+                                               dcoloring,
+                                               dreordering,
+                                               dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor(handle,
+                                               safe_size,
+                                               safe_size,
+                                               nullptr,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               &ncolors,
+                                               dcoloring,
+                                               dreordering,
+                                               dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor(handle,
+                                               safe_size,
+                                               safe_size,
+                                               descr,
+                                               nullptr,
+                                               dcsr_col_ind,
+                                               &ncolors,
+                                               dcoloring,
+                                               dreordering,
+                                               dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor(handle,
+                                               safe_size,
+                                               safe_size,
+                                               descr,
+                                               dcsr_row_ptr,
+                                               nullptr,
+                                               &ncolors,
+                                               dcoloring,
+                                               dreordering,
+                                               dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor(handle,
+                                               safe_size,
+                                               safe_size,
+                                               descr,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               nullptr,
+                                               dcoloring,
+                                               dreordering,
+                                               dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor(handle,
+                                               safe_size,
+                                               safe_size,
+                                               descr,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               &ncolors,
+                                               nullptr,
+                                               dreordering,
+                                               dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor(handle,
+                                               safe_size,
+                                               safe_size,
+                                               descr,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               &ncolors,
+                                               dcoloring,
+                                               dreordering,
+                                               nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor(handle,
+                                               -1,
+                                               safe_size,
+                                               descr,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               &ncolors,
+                                               dcoloring,
+                                               dreordering,
+                                               dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor(handle,
+                                               safe_size,
+                                               -1,
+                                               descr,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               &ncolors,
+                                               dcoloring,
+                                               dreordering,
+                                               dbuffer),
+                            rocsparse_status_invalid_size);
+
+    // Only general matrices are supported
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrcolor(handle,
+                                               safe_size,
+                                               safe_size,
+                                               descr,
+                                               dcsr_row_ptr,
+                                               dcsr_col_ind,
+                                               &ncolors,
+                                               dcoloring,
+                                               dreordering,
+                                               dbuffer),
+                            rocsparse_status_not_implemented);
+}
+
+template <typename T>
+void testing_csrcolor(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M    = arg.M;
+    rocsparse_int               N    = arg.N;
+    rocsparse_index_base        base = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<rocsparse_int> dcoloring(safe_size);
+        device_vector<rocsparse_int> dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcoloring || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrcolor_buffer_size(
+                handle, M, 0, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        rocsparse_int ncolors;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrcolor(handle,
+                               M,
+                               0,
+                               descr,
+                               dcsr_row_ptr,
+                               dcsr_col_ind,
+                               &ncolors,
+                               dcoloring,
+                               nullptr,
+                               dbuffer),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for CSR matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dcoloring(M);
+    device_vector<rocsparse_int> dreordering(M);
+    device_vector<rocsparse_int> dncolors(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dcoloring || !dreordering || !dncolors)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor_buffer_size(
+        handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        host_vector<rocsparse_int> hcoloring(M);
+        host_vector<rocsparse_int> hreordering(M);
+        host_vector<rocsparse_int> hcoloring_gold;
+        host_vector<rocsparse_int> hreordering_gold;
+        rocsparse_int              hncolors_1;
+        rocsparse_int              hncolors_2;
+        rocsparse_int              hncolors_gold;
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor(handle,
+                                                 M,
+                                                 nnz,
+                                                 descr,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 &hncolors_1,
+                                                 dcoloring,
+                                                 dreordering,
+                                                 dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor(handle,
+                                                 M,
+                                                 nnz,
+                                                 descr,
+                                                 dcsr_row_ptr,
+                                                 dcsr_col_ind,
+                                                 dncolors,
+                                                 dcoloring,
+                                                 dreordering,
+                                                 dbuffer));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hncolors_2, dncolors, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcoloring, dcoloring, sizeof(rocsparse_int) * M, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hreordering, dreordering, sizeof(rocsparse_int) * M, hipMemcpyDeviceToHost));
+
+        // CPU csrcolor
+        host_csrcolor(M,
+                      hcsr_row_ptr,
+                      hcsr_col_ind,
+                      base,
+                      hncolors_gold,
+                      hcoloring_gold,
+                      hreordering_gold);
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &hncolors_gold, &hncolors_1);
+        unit_check_general<rocsparse_int>(1, 1, 1, &hncolors_gold, &hncolors_2);
+        unit_check_general<rocsparse_int>(1, M, 1, hcoloring_gold, hcoloring);
+        unit_check_general<rocsparse_int>(1, M, 1, hreordering_gold, hreordering);
+
+        // Rows of the same color must not be coupled
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            for(rocsparse_int j = hcsr_row_ptr[i] - base; j < hcsr_row_ptr[i + 1] - base; ++j)
+            {
+                rocsparse_int col = hcsr_col_ind[j] - base;
+
+                if(col != i)
+                {
+                    EXPECT_NE(hcoloring[i], hcoloring[col]);
+                }
+            }
+        }
+
+        // After reordering by color, each triangular part has at most ncolors levels
+        device_vector<rocsparse_int> dperm_row_ptr(M + 1);
+        device_vector<rocsparse_int> dperm_col_ind(nnz);
+        device_vector<T>             dperm_val(nnz);
+
+        if(!dperm_row_ptr || !dperm_col_ind || !dperm_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        size_t perm_buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsympermute_buffer_size(handle,
+                                                                  M,
+                                                                  nnz,
+                                                                  descr,
+                                                                  dcsr_row_ptr,
+                                                                  dcsr_col_ind,
+                                                                  dreordering,
+                                                                  &perm_buffer_size));
+
+        void* dperm_buffer;
+        CHECK_HIP_ERROR(hipMalloc(&dperm_buffer, perm_buffer_size));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsympermute<T>(handle,
+                                                         M,
+                                                         nnz,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         dreordering,
+                                                         dperm_val,
+                                                         dperm_row_ptr,
+                                                         dperm_col_ind,
+                                                         dperm_buffer));
+
+        CHECK_HIP_ERROR(hipFree(dperm_buffer));
+
+        rocsparse_local_mat_info info;
+
+        size_t sv_buffer_size;
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_buffer_size<T>(handle,
+                                                             rocsparse_operation_none,
+                                                             M,
+                                                             nnz,
+                                                             descr,
+                                                             dperm_val,
+                                                             dperm_row_ptr,
+                                                             dperm_col_ind,
+                                                             info,
+                                                             &sv_buffer_size));
+
+        void* dsv_buffer;
+        CHECK_HIP_ERROR(hipMalloc(&dsv_buffer, sv_buffer_size));
+
+        for(int f = 0; f < 2; ++f)
+        {
+            rocsparse_fill_mode uplo
+                = (f == 0) ? rocsparse_fill_mode_lower : rocsparse_fill_mode_upper;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descr, uplo));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                              rocsparse_operation_none,
+                                                              M,
+                                                              nnz,
+                                                              descr,
+                                                              dperm_val,
+                                                              dperm_row_ptr,
+                                                              dperm_col_ind,
+                                                              info,
+                                                              rocsparse_analysis_policy_force,
+                                                              rocsparse_solve_policy_auto,
+                                                              dsv_buffer));
+
+            rocsparse_int nlevels;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_level_info(
+                handle, rocsparse_operation_none, descr, info, &nlevels));
+
+            EXPECT_LE(nlevels, hncolors_gold);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_clear(handle, descr, info));
+        }
+
+        CHECK_HIP_ERROR(hipFree(dsv_buffer));
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        rocsparse_int ncolors;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor(handle,
+                                                     M,
+                                                     nnz,
+                                                     descr,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     &ncolors,
+                                                     dcoloring,
+                                                     dreordering,
+                                                     dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrcolor(handle,
+                                                     M,
+                                                     nnz,
+                                                     descr,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     &ncolors,
+                                                     dcoloring,
+                                                     dreordering,
+                                                     dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csrcolor_gbyte_count<T>(M, nnz, ncolors) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "ncolors"
+                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << ncolors
+                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Clear buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_csrcolor_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrcolor<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,637 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_csrewise.hpp"
+
+static const rocsparse_ewise_pattern patterns[]
+    = {rocsparse_ewise_pattern_intersection, rocsparse_ewise_pattern_union};
+
+static const rocsparse_ewise_op ops[] = {rocsparse_ewise_op_add,
+                                         rocsparse_ewise_op_sub,
+                                         rocsparse_ewise_op_mul,
+                                         rocsparse_ewise_op_div,
+                                         rocsparse_ewise_op_min,
+                                         rocsparse_ewise_op_max};
+
+// Complex data types do not support min and max
+template <typename T>
+static bool testing_csrewise_is_supported(rocsparse_ewise_op op)
+{
+    return (op != rocsparse_ewise_op_min && op != rocsparse_ewise_op_max)
+           || std::is_same<T, float>{} || std::is_same<T, double>{};
+}
+
+template <typename T>
+void testing_csrewise_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr local_descr_A;
+    rocsparse_local_mat_descr local_descr_B;
+    rocsparse_local_mat_descr local_descr_C;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    rocsparse_int h_nnz_C;
+
+    rocsparse_handle        handle        = local_handle;
+    rocsparse_ewise_pattern pattern       = rocsparse_ewise_pattern_union;
+    rocsparse_ewise_op      op            = rocsparse_ewise_op_mul;
+    rocsparse_int           m             = safe_size;
+    rocsparse_int           n             = safe_size;
+    rocsparse_mat_descr     descr_A       = local_descr_A;
+    rocsparse_int           nnz_A         = safe_size;
+    const T*                csr_val_A     = dcsr_val;
+    const rocsparse_int*    csr_row_ptr_A = dcsr_row_ptr;
+    const rocsparse_int*    csr_col_ind_A = dcsr_col_ind;
+    rocsparse_mat_descr     descr_B       = local_descr_B;
+    rocsparse_int           nnz_B         = safe_size;
+    const T*                csr_val_B     = dcsr_val;
+    const rocsparse_int*    csr_row_ptr_B = dcsr_row_ptr;
+    const rocsparse_int*    csr_col_ind_B = dcsr_col_ind;
+    rocsparse_mat_descr     descr_C       = local_descr_C;
+    T*                      csr_val_C     = dcsr_val;
+    rocsparse_int*          csr_row_ptr_C = dcsr_row_ptr;
+    rocsparse_int*          csr_col_ind_C = dcsr_col_ind;
+    rocsparse_int*          nnz_C         = &h_nnz_C;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+#define PARAMS_NNZ                                                                       \
+    handle, pattern, m, n, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, \
+        csr_row_ptr_B, csr_col_ind_B, descr_C, csr_row_ptr_C, nnz_C
+#define PARAMS                                                                           \
+    handle, pattern, op, m, n, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A,  \
+        descr_B, nnz_B, csr_val_B, csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C,     \
+        csr_row_ptr_C, csr_col_ind_C
+
+    // Invalid handle
+    handle = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_handle);
+    handle = local_handle;
+
+    // Invalid pattern and binary operator
+    pattern = (rocsparse_ewise_pattern)-1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_value);
+    pattern = rocsparse_ewise_pattern_union;
+
+    op = (rocsparse_ewise_op)-1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_value);
+    op = rocsparse_ewise_op_mul;
+
+    // Invalid sizes
+    m = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_size);
+    m = safe_size;
+
+    n = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_size);
+    n = safe_size;
+
+    nnz_A = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_size);
+    nnz_A = safe_size;
+
+    nnz_B = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_size);
+    nnz_B = safe_size;
+
+    // Invalid pointers
+    descr_A = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    descr_A = local_descr_A;
+
+    descr_B = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    descr_B = local_descr_B;
+
+    descr_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    descr_C = local_descr_C;
+
+    csr_row_ptr_A = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_row_ptr_A = dcsr_row_ptr;
+
+    csr_col_ind_A = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_col_ind_A = dcsr_col_ind;
+
+    csr_val_A = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_val_A = dcsr_val;
+
+    csr_row_ptr_B = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_row_ptr_B = dcsr_row_ptr;
+
+    csr_col_ind_B = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_col_ind_B = dcsr_col_ind;
+
+    csr_val_B = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_val_B = dcsr_val;
+
+    csr_row_ptr_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_row_ptr_C = dcsr_row_ptr;
+
+    nnz_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_invalid_pointer);
+    nnz_C = &h_nnz_C;
+
+    csr_col_ind_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_col_ind_C = dcsr_col_ind;
+
+    csr_val_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_val_C = dcsr_val;
+
+    // Only general matrices are supported
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(local_descr_B, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise_nnz(PARAMS_NNZ), rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(PARAMS), rocsparse_status_not_implemented);
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(local_descr_B, rocsparse_matrix_type_general));
+
+#undef PARAMS
+#undef PARAMS_NNZ
+}
+
+template <typename T>
+void testing_csrewise(const Arguments& arg)
+{
+    rocsparse_int                      M         = arg.M;
+    rocsparse_int                      N         = arg.N;
+    rocsparse_index_base               baseA     = arg.baseA;
+    rocsparse_index_base               baseB     = arg.baseB;
+    rocsparse_index_base               baseC     = arg.baseC;
+    static constexpr bool              full_rank = false;
+    rocsparse_matrix_factory<T>        matrix_factory(arg, arg.timing ? false : true, full_rank);
+    rocsparse_matrix_factory_random<T> matrix_factory_random(full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descrA;
+    rocsparse_local_mat_descr descrB;
+    rocsparse_local_mat_descr descrC;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrB, baseB));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrC, baseC));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int nnz_C;
+
+        rocsparse_status status_1 = rocsparse_csrewise_nnz(handle,
+                                                           rocsparse_ewise_pattern_union,
+                                                           M,
+                                                           N,
+                                                           descrA,
+                                                           safe_size,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           descrB,
+                                                           safe_size,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           descrC,
+                                                           dcsr_row_ptr,
+                                                           &nnz_C);
+        rocsparse_status status_2 = rocsparse_csrewise<T>(handle,
+                                                          rocsparse_ewise_pattern_union,
+                                                          rocsparse_ewise_op_mul,
+                                                          M,
+                                                          N,
+                                                          descrA,
+                                                          safe_size,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          descrB,
+                                                          safe_size,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          descrC,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind);
+
+        EXPECT_ROCSPARSE_STATUS(status_1,
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(status_2,
+                                (M < 0 || N < 0) ? rocsparse_status_invalid_size
+                                                 : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrices
+    host_vector<rocsparse_int> hcsr_row_ptr_A;
+    host_vector<rocsparse_int> hcsr_col_ind_A;
+    host_vector<T>             hcsr_val_A;
+    host_vector<rocsparse_int> hcsr_row_ptr_B;
+    host_vector<rocsparse_int> hcsr_col_ind_B;
+    host_vector<T>             hcsr_val_B;
+
+    // Sample matrix
+    rocsparse_int nnz_A;
+    rocsparse_int nnz_B;
+    matrix_factory.init_csr(hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, M, N, nnz_A, baseA);
+    matrix_factory_random.init_csr(hcsr_row_ptr_B, hcsr_col_ind_B, hcsr_val_B, M, N, nnz_B, baseB);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr_A(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_A(nnz_A);
+    device_vector<T>             dcsr_val_A(nnz_A);
+    device_vector<rocsparse_int> dcsr_row_ptr_B(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_B(nnz_B);
+    device_vector<T>             dcsr_val_B(nnz_B);
+    device_vector<rocsparse_int> dcsr_row_ptr_C_1(M + 1);
+    device_vector<rocsparse_int> dcsr_row_ptr_C_2(M + 1);
+    device_vector<rocsparse_int> dnnz_C_2(1);
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || !dcsr_row_ptr_B || !dcsr_col_ind_B
+       || !dcsr_val_B || !dcsr_row_ptr_C_1 || !dcsr_row_ptr_C_2 || !dnnz_C_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_A, hcsr_row_ptr_A, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_A, hcsr_col_ind_A, sizeof(rocsparse_int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_B, hcsr_row_ptr_B, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_B, hcsr_col_ind_B, sizeof(rocsparse_int) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_B, hcsr_val_B, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+
+    for(rocsparse_ewise_pattern pattern : patterns)
+    {
+        rocsparse_int hnnz_C_1;
+        rocsparse_int hnnz_C_2;
+
+        // Obtain nnz of C
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrewise_nnz(handle,
+                                                     pattern,
+                                                     M,
+                                                     N,
+                                                     descrA,
+                                                     nnz_A,
+                                                     dcsr_row_ptr_A,
+                                                     dcsr_col_ind_A,
+                                                     descrB,
+                                                     nnz_B,
+                                                     dcsr_row_ptr_B,
+                                                     dcsr_col_ind_B,
+                                                     descrC,
+                                                     dcsr_row_ptr_C_1,
+                                                     &hnnz_C_1));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrewise_nnz(handle,
+                                                     pattern,
+                                                     M,
+                                                     N,
+                                                     descrA,
+                                                     nnz_A,
+                                                     dcsr_row_ptr_A,
+                                                     dcsr_col_ind_A,
+                                                     descrB,
+                                                     nnz_B,
+                                                     dcsr_row_ptr_B,
+                                                     dcsr_col_ind_B,
+                                                     descrC,
+                                                     dcsr_row_ptr_C_2,
+                                                     dnnz_C_2));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hnnz_C_2, dnnz_C_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Allocate device memory for C
+        device_vector<rocsparse_int> dcsr_col_ind_C(hnnz_C_1);
+        device_vector<T>             dcsr_val_C(hnnz_C_1);
+
+        if(!dcsr_col_ind_C || !dcsr_val_C)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // CPU csrewise_nnz
+        host_vector<rocsparse_int> hcsr_row_ptr_C_gold(M + 1);
+        rocsparse_int              hnnz_C_gold;
+
+        if(arg.unit_check)
+        {
+            host_vector<rocsparse_int> hcsr_row_ptr_C_1(M + 1);
+            host_vector<rocsparse_int> hcsr_row_ptr_C_2(M + 1);
+
+            CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C_1,
+                                      dcsr_row_ptr_C_1,
+                                      sizeof(rocsparse_int) * (M + 1),
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C_2,
+                                      dcsr_row_ptr_C_2,
+                                      sizeof(rocsparse_int) * (M + 1),
+                                      hipMemcpyDeviceToHost));
+
+            host_csrewise_nnz(pattern,
+                              M,
+                              hcsr_row_ptr_A,
+                              hcsr_col_ind_A,
+                              hcsr_row_ptr_B,
+                              hcsr_col_ind_B,
+                              hcsr_row_ptr_C_gold,
+                              &hnnz_C_gold,
+                              baseA,
+                              baseB,
+                              baseC);
+
+            // Check nnz of C
+            unit_check_general(1, 1, 1, &hnnz_C_gold, &hnnz_C_1);
+            unit_check_general(1, 1, 1, &hnnz_C_gold, &hnnz_C_2);
+
+            // Check row pointers of C
+            unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C_1);
+            unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C_2);
+        }
+
+        for(rocsparse_ewise_op op : ops)
+        {
+            // Complex data types do not support min and max
+            if(!testing_csrewise_is_supported<T>(op))
+            {
+                bool quick_return
+                    = (nnz_A == 0 && nnz_B == 0)
+                      || (pattern == rocsparse_ewise_pattern_intersection
+                          && (nnz_A == 0 || nnz_B == 0));
+
+                EXPECT_ROCSPARSE_STATUS(rocsparse_csrewise<T>(handle,
+                                                              pattern,
+                                                              op,
+                                                              M,
+                                                              N,
+                                                              descrA,
+                                                              nnz_A,
+                                                              dcsr_val_A,
+                                                              dcsr_row_ptr_A,
+                                                              dcsr_col_ind_A,
+                                                              descrB,
+                                                              nnz_B,
+                                                              dcsr_val_B,
+                                                              dcsr_row_ptr_B,
+                                                              dcsr_col_ind_B,
+                                                              descrC,
+                                                              dcsr_val_C,
+                                                              dcsr_row_ptr_C_1,
+                                                              dcsr_col_ind_C),
+                                        quick_return ? rocsparse_status_success
+                                                     : rocsparse_status_not_implemented);
+                continue;
+            }
+
+            if(arg.unit_check)
+            {
+                // Perform element-wise operation
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrewise<T>(handle,
+                                                            pattern,
+                                                            op,
+                                                            M,
+                                                            N,
+                                                            descrA,
+                                                            nnz_A,
+                                                            dcsr_val_A,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrB,
+                                                            nnz_B,
+                                                            dcsr_val_B,
+                                                            dcsr_row_ptr_B,
+                                                            dcsr_col_ind_B,
+                                                            descrC,
+                                                            dcsr_val_C,
+                                                            dcsr_row_ptr_C_1,
+                                                            dcsr_col_ind_C));
+
+                // Copy output to host
+                host_vector<rocsparse_int> hcsr_col_ind_C(hnnz_C_1);
+                host_vector<T>             hcsr_val_C(hnnz_C_1);
+
+                CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C,
+                                          dcsr_col_ind_C,
+                                          sizeof(rocsparse_int) * hnnz_C_1,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(hipMemcpy(
+                    hcsr_val_C, dcsr_val_C, sizeof(T) * hnnz_C_1, hipMemcpyDeviceToHost));
+
+                // CPU csrewise
+                host_vector<rocsparse_int> hcsr_col_ind_C_gold(hnnz_C_gold);
+                host_vector<T>             hcsr_val_C_gold(hnnz_C_gold);
+
+                host_csrewise<T>(pattern,
+                                 op,
+                                 M,
+                                 N,
+                                 hcsr_row_ptr_A,
+                                 hcsr_col_ind_A,
+                                 hcsr_val_A,
+                                 hcsr_row_ptr_B,
+                                 hcsr_col_ind_B,
+                                 hcsr_val_B,
+                                 hcsr_row_ptr_C_gold,
+                                 hcsr_col_ind_C_gold,
+                                 hcsr_val_C_gold,
+                                 baseA,
+                                 baseB,
+                                 baseC);
+
+                // Check C
+                unit_check_general<rocsparse_int>(
+                    1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C);
+                near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C);
+            }
+
+            if(arg.timing)
+            {
+                int number_cold_calls = 2;
+                int number_hot_calls  = arg.iters;
+
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+                // Warm up
+                for(int iter = 0; iter < number_cold_calls; ++iter)
+                {
+                    CHECK_ROCSPARSE_ERROR(rocsparse_csrewise<T>(handle,
+                                                                pattern,
+                                                                op,
+                                                                M,
+                                                                N,
+                                                                descrA,
+                                                                nnz_A,
+                                                                dcsr_val_A,
+                                                                dcsr_row_ptr_A,
+                                                                dcsr_col_ind_A,
+                                                                descrB,
+                                                                nnz_B,
+                                                                dcsr_val_B,
+                                                                dcsr_row_ptr_B,
+                                                                dcsr_col_ind_B,
+                                                                descrC,
+                                                                dcsr_val_C,
+                                                                dcsr_row_ptr_C_1,
+                                                                dcsr_col_ind_C));
+                }
+
+                double gpu_time_used = get_time_us();
+
+                // Performance run
+                for(int iter = 0; iter < number_hot_calls; ++iter)
+                {
+                    CHECK_ROCSPARSE_ERROR(rocsparse_csrewise<T>(handle,
+                                                                pattern,
+                                                                op,
+                                                                M,
+                                                                N,
+                                                                descrA,
+                                                                nnz_A,
+                                                                dcsr_val_A,
+                                                                dcsr_row_ptr_A,
+                                                                dcsr_col_ind_A,
+                                                                descrB,
+                                                                nnz_B,
+                                                                dcsr_val_B,
+                                                                dcsr_row_ptr_B,
+                                                                dcsr_col_ind_B,
+                                                                descrC,
+                                                                dcsr_val_C,
+                                                                dcsr_row_ptr_C_1,
+                                                                dcsr_col_ind_C));
+                }
+
+                gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+                double gflop_count = csrewise_gflop_count(pattern, nnz_A, nnz_B, hnnz_C_1);
+                double gbyte_count = csrewise_gbyte_count<T>(M, nnz_A, nnz_B, hnnz_C_1);
+
+                double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+                double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+                display_timing_info("M",
+                                    M,
+                                    "N",
+                                    N,
+                                    "nnz_A",
+                                    nnz_A,
+                                    "nnz_B",
+                                    nnz_B,
+                                    "nnz_C",
+                                    hnnz_C_1,
+                                    "pattern",
+                                    rocsparse_ewisepattern2string(pattern),
+                                    "op",
+                                    rocsparse_ewiseop2string(op),
+                                    "GFlop/s",
+                                    gpu_gflops,
+                                    "GB/s",
+                                    gpu_gbyte,
+                                    "msec",
+                                    get_gpu_time_msec(gpu_time_used),
+                                    "iter",
+                                    number_hot_calls,
+                                    "verified",
+                                    (arg.unit_check ? "yes" : "no"));
+            }
+        }
+    }
+}
+
+#define INSTANTIATE(TYPE)                                               \
+    template void testing_csrewise_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrewise<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,525 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "testing_csrfsai.hpp"
+
+template <typename T>
+void testing_csrfsai_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle          = local_handle;
+    rocsparse_int             m               = safe_size;
+    rocsparse_int             nnz_A           = safe_size;
+    rocsparse_int             nnz_S           = safe_size;
+    const rocsparse_mat_descr descr           = local_descr;
+    const T*                  csr_val_A       = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr_A   = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind_A   = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_row_ptr_S   = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind_S   = (const rocsparse_int*)0x4;
+    rocsparse_mat_info        info            = local_info;
+    T*                        csr_val_G       = (T*)0x4;
+    rocsparse_int*            csr_row_ptr_G   = (rocsparse_int*)0x4;
+    const rocsparse_int*      csr_row_ptr_G_c = (const rocsparse_int*)0x4;
+    rocsparse_int*            csr_col_ind_G   = (rocsparse_int*)0x4;
+    rocsparse_int*            nnz_G           = (rocsparse_int*)0x4;
+    size_t*                   buffer_size     = (size_t*)0x4;
+    void*                     temp_buffer     = (void*)0x4;
+
+#define PARAMS_NNZ \
+    handle, m, nnz_S, descr, csr_row_ptr_S, csr_col_ind_S, descr, csr_row_ptr_G, nnz_G
+
+#define PARAMS_BUFFER_SIZE                                                                    \
+    handle, m, nnz_A, descr, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr, csr_row_ptr_G_c, \
+        buffer_size
+
+#define PARAMS                                                                                  \
+    handle, m, nnz_A, descr, csr_val_A, csr_row_ptr_A, csr_col_ind_A, nnz_S, descr,             \
+        csr_row_ptr_S, csr_col_ind_S, info, descr, csr_val_G, csr_row_ptr_G_c, csr_col_ind_G, \
+        temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csrfsai_nnz, PARAMS_NNZ);
+    auto_testing_bad_arg(rocsparse_csrfsai_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csrfsai<T>, PARAMS);
+
+    // Only general matrices are supported
+    for(auto matrix_type : rocsparse_matrix_type_t::values)
+    {
+        if(matrix_type != rocsparse_matrix_type_general)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, matrix_type));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_nnz(PARAMS_NNZ),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                                    rocsparse_status_not_implemented);
+            EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai<T>(PARAMS),
+                                    rocsparse_status_not_implemented);
+        }
+    }
+
+#undef PARAMS
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_NNZ
+
+    // Test rocsparse_csrfsai_zero_pivot()
+    rocsparse_int position;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_zero_pivot(nullptr, info, &position),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_zero_pivot(handle, nullptr, &position),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_zero_pivot(handle, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+}
+
+template <typename T>
+void testing_csrfsai(const Arguments& arg)
+{
+    rocsparse_int M = arg.M;
+    rocsparse_int N = arg.N;
+
+    // Level 0 uses the pattern of A, level 1 the pattern of A^2
+    rocsparse_int        level  = arg.fill_level;
+    rocsparse_index_base base_A = arg.baseA;
+    rocsparse_index_base base_G = arg.baseB;
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors, the pattern S shares the index base of A
+    rocsparse_local_mat_descr descr_A;
+    rocsparse_local_mat_descr descr_S;
+    rocsparse_local_mat_descr descr_G;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_A, base_A));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_S, base_A));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_G, base_G));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              buffer_size;
+        rocsparse_int       nnz_G;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dG_row_ptr(safe_size);
+        device_vector<rocsparse_int> dG_col_ind(safe_size);
+        device_vector<T>             dG_val(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dG_row_ptr || !dG_col_ind || !dG_val
+           || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_nnz(handle,
+                                                      M,
+                                                      safe_size,
+                                                      descr_S,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      descr_G,
+                                                      dG_row_ptr,
+                                                      &nnz_G),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_buffer_size<T>(handle,
+                                                                 M,
+                                                                 safe_size,
+                                                                 descr_A,
+                                                                 dcsr_val,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 descr_G,
+                                                                 dG_row_ptr,
+                                                                 &buffer_size),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai<T>(handle,
+                                                     M,
+                                                     safe_size,
+                                                     descr_A,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     safe_size,
+                                                     descr_S,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     info,
+                                                     descr_G,
+                                                     dG_val,
+                                                     dG_row_ptr,
+                                                     dG_col_ind,
+                                                     dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base_A);
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // Sparsity pattern of G
+    host_vector<rocsparse_int> hS_row_ptr;
+    host_vector<rocsparse_int> hS_col_ind;
+    rocsparse_int              nnz_S;
+
+    if(level == 0)
+    {
+        hS_row_ptr = hcsr_row_ptr;
+        hS_col_ind = hcsr_col_ind;
+        nnz_S      = nnz;
+    }
+    else
+    {
+        T              h_one = static_cast<T>(1);
+        std::vector<T> hS_val;
+
+        host_csrgemm_nnz<rocsparse_int, rocsparse_int, T>(M,
+                                                          M,
+                                                          M,
+                                                          &h_one,
+                                                          hcsr_row_ptr,
+                                                          hcsr_col_ind,
+                                                          hcsr_row_ptr,
+                                                          hcsr_col_ind,
+                                                          nullptr,
+                                                          hcsr_row_ptr,
+                                                          hcsr_col_ind,
+                                                          hS_row_ptr,
+                                                          &nnz_S,
+                                                          base_A,
+                                                          base_A,
+                                                          base_A,
+                                                          base_A);
+        host_csrgemm<rocsparse_int, rocsparse_int, T>(M,
+                                                      M,
+                                                      M,
+                                                      &h_one,
+                                                      hcsr_row_ptr,
+                                                      hcsr_col_ind,
+                                                      hcsr_val,
+                                                      hcsr_row_ptr,
+                                                      hcsr_col_ind,
+                                                      hcsr_val,
+                                                      nullptr,
+                                                      hcsr_row_ptr,
+                                                      hcsr_col_ind,
+                                                      hcsr_val,
+                                                      hS_row_ptr,
+                                                      hS_col_ind,
+                                                      hS_val,
+                                                      base_A,
+                                                      base_A,
+                                                      base_A,
+                                                      base_A);
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dS_row_ptr(M + 1);
+    device_vector<rocsparse_int> dS_col_ind(nnz_S);
+    device_vector<rocsparse_int> dG_row_ptr(M + 1);
+    device_vector<rocsparse_int> dnnz_G(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dS_row_ptr || !dS_col_ind || !dG_row_ptr
+       || !dnnz_G)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dS_row_ptr, hS_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dS_col_ind, hS_col_ind, sizeof(rocsparse_int) * nnz_S, hipMemcpyHostToDevice));
+
+    // Sparsity pattern of G
+    rocsparse_int nnz_G;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrfsai_nnz(
+        handle, M, nnz_S, descr_S, dS_row_ptr, dS_col_ind, descr_G, dG_row_ptr, &nnz_G));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrfsai_nnz(
+            handle, M, nnz_S, descr_S, dS_row_ptr, dS_col_ind, descr_G, dG_row_ptr, dnnz_G));
+
+        rocsparse_int hnnz_G;
+        CHECK_HIP_ERROR(hipMemcpy(&hnnz_G, dnnz_G, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnz_G, &hnnz_G);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    }
+
+    device_vector<rocsparse_int> dG_col_ind(nnz_G);
+    device_vector<T>             dG_val(nnz_G);
+
+    if(!dG_col_ind || !dG_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrfsai_buffer_size<T>(handle,
+                                                           M,
+                                                           nnz,
+                                                           descr_A,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           descr_G,
+                                                           dG_row_ptr,
+                                                           &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        // Sparse approximate inverse
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrfsai<T>(handle,
+                                                   M,
+                                                   nnz,
+                                                   descr_A,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   nnz_S,
+                                                   descr_S,
+                                                   dS_row_ptr,
+                                                   dS_col_ind,
+                                                   info,
+                                                   descr_G,
+                                                   dG_val,
+                                                   dG_row_ptr,
+                                                   dG_col_ind,
+                                                   dbuffer));
+
+        // Zero pivot in host and device pointer mode
+        host_vector<rocsparse_int>   hpivot_1(1);
+        host_vector<rocsparse_int>   hpivot_2(1);
+        device_vector<rocsparse_int> dpivot(1);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_zero_pivot(handle, info, hpivot_1),
+                                (hpivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                    : rocsparse_status_success);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrfsai_zero_pivot(handle, info, dpivot),
+                                (hpivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                    : rocsparse_status_success);
+        CHECK_HIP_ERROR(hipMemcpy(hpivot_2, dpivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // CPU sparse approximate inverse
+        std::vector<rocsparse_int> hG_row_ptr_gold;
+        std::vector<rocsparse_int> hG_col_ind_gold;
+        std::vector<T>             hG_val_gold;
+        rocsparse_int              hpivot_gold;
+
+        host_csrfsai<T>(M,
+                        hcsr_row_ptr,
+                        hcsr_col_ind,
+                        hcsr_val,
+                        base_A,
+                        hS_row_ptr,
+                        hS_col_ind,
+                        base_A,
+                        base_G,
+                        hG_row_ptr_gold,
+                        hG_col_ind_gold,
+                        hG_val_gold,
+                        &hpivot_gold);
+
+        // Check pivot
+        unit_check_general<rocsparse_int>(1, 1, 1, &hpivot_gold, hpivot_1);
+        unit_check_general<rocsparse_int>(1, 1, 1, &hpivot_gold, hpivot_2);
+
+        // Copy output to host
+        host_vector<rocsparse_int> hG_row_ptr(M + 1);
+        host_vector<rocsparse_int> hG_col_ind(nnz_G);
+        host_vector<T>             hG_val(nnz_G);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hG_row_ptr, dG_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hG_col_ind, dG_col_ind, sizeof(rocsparse_int) * nnz_G, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hG_val, dG_val, sizeof(T) * nnz_G, hipMemcpyDeviceToHost));
+
+        // Check sparsity pattern of G
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hG_row_ptr_gold.data(), hG_row_ptr);
+        unit_check_general<rocsparse_int>(1, nnz_G, 1, hG_col_ind_gold.data(), hG_col_ind);
+
+        // Check values of G if all local problems are positive definite
+        if(hpivot_gold == -1)
+        {
+            near_check_general<T>(1, nnz_G, 1, hG_val_gold.data(), hG_val);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrfsai<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr_A,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       nnz_S,
+                                                       descr_S,
+                                                       dS_row_ptr,
+                                                       dS_col_ind,
+                                                       info,
+                                                       descr_G,
+                                                       dG_val,
+                                                       dG_row_ptr,
+                                                       dG_col_ind,
+                                                       dbuffer));
+        }
+
+        double gpu_time_used = 0;
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            double gpu_time_start = get_time_us();
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrfsai<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr_A,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       nnz_S,
+                                                       descr_S,
+                                                       dS_row_ptr,
+                                                       dS_col_ind,
+                                                       info,
+                                                       descr_G,
+                                                       dG_val,
+                                                       dG_row_ptr,
+                                                       dG_col_ind,
+                                                       dbuffer));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            gpu_time_used += get_time_us() - gpu_time_start;
+        }
+
+        gpu_time_used /= number_hot_calls;
+
+        double gpu_gbyte = csrfsai_gbyte_count<T>(M, nnz, nnz_G) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "nnz_G"
+                  << std::setw(12) << "level" << std::setw(12) << "GB/s" << std::setw(12)
+                  << "msec" << std::setw(12) << "iter" << std::setw(12) << "verified"
+                  << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nnz_G
+                  << std::setw(12) << level << std::setw(12) << gpu_gbyte << std::setw(12)
+                  << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_csrfsai_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrfsai<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
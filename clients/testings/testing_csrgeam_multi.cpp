@@ -0,0 +1,683 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_csrgeam_multi.hpp"
+
+template <typename T>
+void testing_csrgeam_multi_bad_arg(const Arguments& arg)
+{
+    static const size_t        safe_size = 100;
+    static const rocsparse_int safe_num  = 2;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr local_descr_A1;
+    rocsparse_local_mat_descr local_descr_A2;
+    rocsparse_local_mat_descr local_descr_C;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<T>             dcsr_val(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    T                    h_alpha[safe_num]   = {static_cast<T>(1), static_cast<T>(2)};
+    rocsparse_mat_descr  h_descr_A[safe_num] = {local_descr_A1, local_descr_A2};
+    rocsparse_int        h_nnz_A[safe_num]   = {safe_size, safe_size};
+    const T*             h_val_A[safe_num]   = {dcsr_val, dcsr_val};
+    const rocsparse_int* h_ptr_A[safe_num]   = {dcsr_row_ptr, dcsr_row_ptr};
+    const rocsparse_int* h_ind_A[safe_num]   = {dcsr_col_ind, dcsr_col_ind};
+    rocsparse_int        h_nnz_C;
+
+    rocsparse_handle            handle        = local_handle;
+    rocsparse_int               m             = safe_size;
+    rocsparse_int               n             = safe_size;
+    rocsparse_int               num_mat       = safe_num;
+    const T*                    alpha         = h_alpha;
+    const rocsparse_mat_descr*  descr_A       = h_descr_A;
+    const rocsparse_int*        nnz_A         = h_nnz_A;
+    const T* const*             csr_val_A     = h_val_A;
+    const rocsparse_int* const* csr_row_ptr_A = h_ptr_A;
+    const rocsparse_int* const* csr_col_ind_A = h_ind_A;
+    rocsparse_mat_descr         descr_C       = local_descr_C;
+    T*                          csr_val_C     = dcsr_val;
+    rocsparse_int*              csr_row_ptr_C = dcsr_row_ptr;
+    rocsparse_int*              csr_col_ind_C = dcsr_col_ind;
+    rocsparse_int*              nnz_C         = &h_nnz_C;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+#define PARAMS_NNZ                                                                               \
+    handle, m, n, num_mat, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_C, csr_row_ptr_C, \
+        nnz_C
+#define PARAMS                                                                             \
+    handle, m, n, num_mat, alpha, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, \
+        descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C
+
+    // Invalid handle
+    handle = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_handle);
+    handle = local_handle;
+
+    // Invalid sizes
+    m = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_size);
+    m = safe_size;
+
+    n = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_size);
+    n = safe_size;
+
+    num_mat = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_size);
+    num_mat = safe_num;
+
+    h_nnz_A[1] = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_size);
+    h_nnz_A[1] = safe_size;
+
+    // Invalid pointers
+    descr_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    descr_C = local_descr_C;
+
+    descr_A = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    descr_A = h_descr_A;
+
+    h_descr_A[1] = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    h_descr_A[1] = local_descr_A2;
+
+    nnz_A = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    nnz_A = h_nnz_A;
+
+    csr_row_ptr_A = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_row_ptr_A = h_ptr_A;
+
+    h_ptr_A[1] = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    h_ptr_A[1] = dcsr_row_ptr;
+
+    csr_col_ind_A = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_col_ind_A = h_ind_A;
+
+    h_ind_A[1] = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    h_ind_A[1] = dcsr_col_ind;
+
+    csr_row_ptr_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_row_ptr_C = dcsr_row_ptr;
+
+    nnz_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_invalid_pointer);
+    nnz_C = &h_nnz_C;
+
+    alpha = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    alpha = h_alpha;
+
+    csr_val_A = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_val_A = h_val_A;
+
+    h_val_A[1] = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    h_val_A[1] = dcsr_val;
+
+    csr_val_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_val_C = dcsr_val;
+
+    csr_col_ind_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_col_ind_C = dcsr_col_ind;
+
+    // Only general matrices are supported
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(local_descr_A2, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_not_implemented);
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(local_descr_A2, rocsparse_matrix_type_general));
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(local_descr_C, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi_nnz(PARAMS_NNZ),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgeam_multi<T>(PARAMS), rocsparse_status_not_implemented);
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(local_descr_C, rocsparse_matrix_type_general));
+
+#undef PARAMS
+#undef PARAMS_NNZ
+}
+
+template <typename T>
+void testing_csrgeam_multi(const Arguments& arg)
+{
+    rocsparse_int                      M         = arg.M;
+    rocsparse_int                      N         = arg.N;
+    rocsparse_int                      num_mat   = arg.K;
+    rocsparse_index_base               baseA     = arg.baseA;
+    rocsparse_index_base               baseB     = arg.baseB;
+    rocsparse_index_base               baseC     = arg.baseC;
+    static constexpr bool              full_rank = false;
+    rocsparse_matrix_factory<T>        matrix_factory(arg, arg.timing ? false : true, full_rank);
+    rocsparse_matrix_factory_random<T> matrix_factory_random(full_rank);
+    T                                  h_alpha = arg.get_alpha<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor of C
+    rocsparse_local_mat_descr descrC;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrC, baseC));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || num_mat <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr_C(std::max(M + 1, (rocsparse_int)safe_size));
+        device_vector<rocsparse_int> dcsr_col_ind_C(safe_size);
+        device_vector<T>             dcsr_val_C(safe_size);
+
+        if(!dcsr_row_ptr_C || !dcsr_col_ind_C || !dcsr_val_C)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int nnz_C;
+
+        // Without any operand, the arrays of the operands are never accessed
+        rocsparse_status status_1 = rocsparse_csrgeam_multi_nnz(handle,
+                                                                M,
+                                                                N,
+                                                                num_mat,
+                                                                nullptr,
+                                                                nullptr,
+                                                                nullptr,
+                                                                nullptr,
+                                                                descrC,
+                                                                dcsr_row_ptr_C,
+                                                                &nnz_C);
+        rocsparse_status status_2 = rocsparse_csrgeam_multi<T>(handle,
+                                                               M,
+                                                               N,
+                                                               num_mat,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               nullptr,
+                                                               descrC,
+                                                               dcsr_val_C,
+                                                               dcsr_row_ptr_C,
+                                                               dcsr_col_ind_C);
+
+        EXPECT_ROCSPARSE_STATUS(status_1,
+                                (M < 0 || N < 0 || num_mat < 0) ? rocsparse_status_invalid_size
+                                                                : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(status_2,
+                                (M < 0 || N < 0 || num_mat < 0) ? rocsparse_status_invalid_size
+                                                                : rocsparse_status_success);
+
+        // The sum of no operands is empty
+        if(status_1 == rocsparse_status_success)
+        {
+            rocsparse_int zero = 0;
+            unit_check_general(1, 1, 1, &zero, &nnz_C);
+        }
+
+        return;
+    }
+
+    // Sample the operands, the first one is obtained from the matrix factory, the
+    // remaining ones are random matrices of the same size. The operands alternate
+    // between the index bases of A and B.
+    std::vector<host_vector<rocsparse_int>> hcsr_row_ptr_A(num_mat);
+    std::vector<host_vector<rocsparse_int>> hcsr_col_ind_A(num_mat);
+    std::vector<host_vector<T>>             hcsr_val_A(num_mat);
+    std::vector<rocsparse_index_base>       base_A(num_mat);
+    std::vector<rocsparse_local_mat_descr>  local_descr_A(num_mat);
+    host_vector<rocsparse_mat_descr>        descr_A(num_mat);
+    host_vector<rocsparse_int>              nnz_A(num_mat);
+    host_vector<T>                          alpha(num_mat);
+
+    for(rocsparse_int i = 0; i < num_mat; ++i)
+    {
+        base_A[i] = (i % 2 == 0) ? baseA : baseB;
+        alpha[i]  = h_alpha * static_cast<T>((i % 2 == 0) ? (i + 1) : -i);
+
+        if(i == 0)
+        {
+            matrix_factory.init_csr(
+                hcsr_row_ptr_A[i], hcsr_col_ind_A[i], hcsr_val_A[i], M, N, nnz_A[i], base_A[i]);
+        }
+        else
+        {
+            matrix_factory_random.init_csr(
+                hcsr_row_ptr_A[i], hcsr_col_ind_A[i], hcsr_val_A[i], M, N, nnz_A[i], base_A[i]);
+        }
+
+        descr_A[i] = local_descr_A[i];
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr_A[i], base_A[i]));
+    }
+
+    // All operands are stored consecutively on the device
+    rocsparse_int nnz_total = 0;
+    for(rocsparse_int i = 0; i < num_mat; ++i)
+    {
+        nnz_total += nnz_A[i];
+    }
+
+    device_vector<rocsparse_int> dcsr_row_ptr_A((M + 1) * num_mat);
+    device_vector<rocsparse_int> dcsr_col_ind_A(nnz_total);
+    device_vector<T>             dcsr_val_A(nnz_total);
+    device_vector<T>             d_alpha(num_mat);
+    device_vector<rocsparse_int> dcsr_row_ptr_C_1(M + 1);
+    device_vector<rocsparse_int> dcsr_row_ptr_C_2(M + 1);
+    device_vector<rocsparse_int> dnnz_C_2(1);
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || !d_alpha || !dcsr_row_ptr_C_1
+       || !dcsr_row_ptr_C_2 || !dnnz_C_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    host_vector<const rocsparse_int*> csr_row_ptr_A(num_mat);
+    host_vector<const rocsparse_int*> csr_col_ind_A(num_mat);
+    host_vector<const T*>             csr_val_A(num_mat);
+
+    // Copy data from CPU to device
+    for(rocsparse_int i = 0, offset = 0; i < num_mat; offset += nnz_A[i++])
+    {
+        rocsparse_int* row_ptr = dcsr_row_ptr_A + (M + 1) * i;
+        rocsparse_int* col_ind = dcsr_col_ind_A + offset;
+        T*             val     = dcsr_val_A + offset;
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            row_ptr, hcsr_row_ptr_A[i], sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            col_ind, hcsr_col_ind_A[i], sizeof(rocsparse_int) * nnz_A[i], hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(val, hcsr_val_A[i], sizeof(T) * nnz_A[i], hipMemcpyHostToDevice));
+
+        csr_row_ptr_A[i] = row_ptr;
+        csr_col_ind_A[i] = col_ind;
+        csr_val_A[i]     = val;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, alpha, sizeof(T) * num_mat, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        rocsparse_int hnnz_C_1;
+        rocsparse_int hnnz_C_2;
+
+        // Obtain nnz of C
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam_multi_nnz(handle,
+                                                          M,
+                                                          N,
+                                                          num_mat,
+                                                          descr_A,
+                                                          nnz_A,
+                                                          csr_row_ptr_A,
+                                                          csr_col_ind_A,
+                                                          descrC,
+                                                          dcsr_row_ptr_C_1,
+                                                          &hnnz_C_1));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam_multi_nnz(handle,
+                                                          M,
+                                                          N,
+                                                          num_mat,
+                                                          descr_A,
+                                                          nnz_A,
+                                                          csr_row_ptr_A,
+                                                          csr_col_ind_A,
+                                                          descrC,
+                                                          dcsr_row_ptr_C_2,
+                                                          dnnz_C_2));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr_row_ptr_C_1(M + 1);
+        host_vector<rocsparse_int> hcsr_row_ptr_C_2(M + 1);
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hnnz_C_2, dnnz_C_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C_1,
+                                  dcsr_row_ptr_C_1,
+                                  sizeof(rocsparse_int) * (M + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C_2,
+                                  dcsr_row_ptr_C_2,
+                                  sizeof(rocsparse_int) * (M + 1),
+                                  hipMemcpyDeviceToHost));
+
+        // CPU reference, accumulating C by a chain of pairwise sums
+        host_vector<rocsparse_int> hcsr_row_ptr_C_gold(M + 1, baseC);
+        host_vector<rocsparse_int> hcsr_col_ind_C_gold;
+        host_vector<T>             hcsr_val_C_gold;
+        rocsparse_int              hnnz_C_gold = 0;
+
+        for(rocsparse_int i = 0; i < num_mat; ++i)
+        {
+            host_vector<rocsparse_int> hcsr_row_ptr_S(M + 1);
+
+            host_csrgeam_nnz<T>(M,
+                                N,
+                                static_cast<T>(1),
+                                hcsr_row_ptr_C_gold,
+                                hcsr_col_ind_C_gold,
+                                alpha[i],
+                                hcsr_row_ptr_A[i],
+                                hcsr_col_ind_A[i],
+                                hcsr_row_ptr_S,
+                                &hnnz_C_gold,
+                                baseC,
+                                base_A[i],
+                                baseC);
+
+            host_vector<rocsparse_int> hcsr_col_ind_S(hnnz_C_gold);
+            host_vector<T>             hcsr_val_S(hnnz_C_gold);
+
+            host_csrgeam<T>(M,
+                            N,
+                            static_cast<T>(1),
+                            hcsr_row_ptr_C_gold,
+                            hcsr_col_ind_C_gold,
+                            hcsr_val_C_gold,
+                            alpha[i],
+                            hcsr_row_ptr_A[i],
+                            hcsr_col_ind_A[i],
+                            hcsr_val_A[i],
+                            hcsr_row_ptr_S,
+                            hcsr_col_ind_S,
+                            hcsr_val_S,
+                            baseC,
+                            base_A[i],
+                            baseC);
+
+            hcsr_row_ptr_C_gold.swap(hcsr_row_ptr_S);
+            hcsr_col_ind_C_gold.swap(hcsr_col_ind_S);
+            hcsr_val_C_gold.swap(hcsr_val_S);
+        }
+
+        // Check nnz of C
+        unit_check_general(1, 1, 1, &hnnz_C_gold, &hnnz_C_1);
+        unit_check_general(1, 1, 1, &hnnz_C_gold, &hnnz_C_2);
+
+        // Check row pointers of C
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C_1);
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C_2);
+
+        // Allocate device memory for C
+        device_vector<rocsparse_int> dcsr_col_ind_C_1(hnnz_C_1);
+        device_vector<rocsparse_int> dcsr_col_ind_C_2(hnnz_C_2);
+        device_vector<T>             dcsr_val_C_1(hnnz_C_1);
+        device_vector<T>             dcsr_val_C_2(hnnz_C_2);
+
+        if(!dcsr_col_ind_C_1 || !dcsr_col_ind_C_2 || !dcsr_val_C_1 || !dcsr_val_C_2)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Perform matrix sum
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam_multi<T>(handle,
+                                                         M,
+                                                         N,
+                                                         num_mat,
+                                                         alpha,
+                                                         descr_A,
+                                                         nnz_A,
+                                                         csr_val_A,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         descrC,
+                                                         dcsr_val_C_1,
+                                                         dcsr_row_ptr_C_1,
+                                                         dcsr_col_ind_C_1));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam_multi<T>(handle,
+                                                         M,
+                                                         N,
+                                                         num_mat,
+                                                         d_alpha,
+                                                         descr_A,
+                                                         nnz_A,
+                                                         csr_val_A,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         descrC,
+                                                         dcsr_val_C_2,
+                                                         dcsr_row_ptr_C_2,
+                                                         dcsr_col_ind_C_2));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr_col_ind_C_1(hnnz_C_1);
+        host_vector<rocsparse_int> hcsr_col_ind_C_2(hnnz_C_2);
+        host_vector<T>             hcsr_val_C_1(hnnz_C_1);
+        host_vector<T>             hcsr_val_C_2(hnnz_C_2);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C_1,
+                                  dcsr_col_ind_C_1,
+                                  sizeof(rocsparse_int) * hnnz_C_1,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C_2,
+                                  dcsr_col_ind_C_2,
+                                  sizeof(rocsparse_int) * hnnz_C_2,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C_1, dcsr_val_C_1, sizeof(T) * hnnz_C_1, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C_2, dcsr_val_C_2, sizeof(T) * hnnz_C_2, hipMemcpyDeviceToHost));
+
+        // Check C
+        unit_check_general<rocsparse_int>(1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C_1);
+        unit_check_general<rocsparse_int>(1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C_2);
+        near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C_1);
+        near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C_2);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        rocsparse_int nnz_C;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam_multi_nnz(handle,
+                                                              M,
+                                                              N,
+                                                              num_mat,
+                                                              descr_A,
+                                                              nnz_A,
+                                                              csr_row_ptr_A,
+                                                              csr_col_ind_A,
+                                                              descrC,
+                                                              dcsr_row_ptr_C_1,
+                                                              &nnz_C));
+        }
+
+        double gpu_analysis_time_used = get_time_us();
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam_multi_nnz(handle,
+                                                          M,
+                                                          N,
+                                                          num_mat,
+                                                          descr_A,
+                                                          nnz_A,
+                                                          csr_row_ptr_A,
+                                                          csr_col_ind_A,
+                                                          descrC,
+                                                          dcsr_row_ptr_C_1,
+                                                          &nnz_C));
+
+        gpu_analysis_time_used = get_time_us() - gpu_analysis_time_used;
+
+        device_vector<rocsparse_int> dcsr_col_ind_C(nnz_C);
+        device_vector<T>             dcsr_val_C(nnz_C);
+
+        if(!dcsr_col_ind_C || !dcsr_val_C)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam_multi<T>(handle,
+                                                             M,
+                                                             N,
+                                                             num_mat,
+                                                             alpha,
+                                                             descr_A,
+                                                             nnz_A,
+                                                             csr_val_A,
+                                                             csr_row_ptr_A,
+                                                             csr_col_ind_A,
+                                                             descrC,
+                                                             dcsr_val_C,
+                                                             dcsr_row_ptr_C_1,
+                                                             dcsr_col_ind_C));
+        }
+
+        double gpu_solve_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgeam_multi<T>(handle,
+                                                             M,
+                                                             N,
+                                                             num_mat,
+                                                             alpha,
+                                                             descr_A,
+                                                             nnz_A,
+                                                             csr_val_A,
+                                                             csr_row_ptr_A,
+                                                             csr_col_ind_A,
+                                                             descrC,
+                                                             dcsr_val_C,
+                                                             dcsr_row_ptr_C_1,
+                                                             dcsr_col_ind_C));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+        double gpu_gflops
+            = csrgeam_multi_gflop_count(num_mat, nnz_A, nnz_C) / gpu_solve_time_used * 1e6;
+        double gpu_gbyte
+            = csrgeam_multi_gbyte_count<T>(M, num_mat, nnz_A, nnz_C) / gpu_solve_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "num_mat"
+                  << std::setw(12) << "nnz_A" << std::setw(12) << "nnz_C" << std::setw(12)
+                  << "alpha" << std::setw(12) << "GFlop/s" << std::setw(12) << "GB/s"
+                  << std::setw(16) << "nnz msec" << std::setw(16) << "geam msec" << std::setw(12)
+                  << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << num_mat
+                  << std::setw(12) << nnz_total << std::setw(12) << nnz_C << std::setw(12)
+                  << h_alpha << std::setw(12) << gpu_gflops << std::setw(12) << gpu_gbyte
+                  << std::setw(16) << gpu_analysis_time_used / 1e3 << std::setw(16)
+                  << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+}
+
+#define INSTANTIATE(TYPE)                                                    \
+    template void testing_csrgeam_multi_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrgeam_multi<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -2452,14 +2452,21 @@ void testing_csrgemm(const Arguments& arg)
     rocsparse_int hnnz_C_2;
     rocsparse_int nnz_D = 4;
 
+    // Dimensions of A and B, as they are stored
+    rocsparse_int A_m = (transA == rocsparse_operation_none) ? M : K;
+    rocsparse_int A_n = (transA == rocsparse_operation_none) ? K : M;
+    rocsparse_int B_m = (transB == rocsparse_operation_none) ? K : N;
+    rocsparse_int B_n = (transB == rocsparse_operation_none) ? N : K;
+
     rocsparse_matrix_factory<T> matrix_factory(arg, arg.timing ? false : true, full_rank);
     if(scenario == 2)
     {
         // alpha != nullptr && beta == nullptr
-        matrix_factory.init_csr(hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, M, K, nnz_A, baseA);
+        matrix_factory.init_csr(
+            hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, A_m, A_n, nnz_A, baseA);
         rocsparse_matrix_factory_random<T> matrix_factory_random(full_rank);
         matrix_factory_random.init_csr(
-            hcsr_row_ptr_B, hcsr_col_ind_B, hcsr_val_B, K, N, nnz_B, baseB);
+            hcsr_row_ptr_B, hcsr_col_ind_B, hcsr_val_B, B_m, B_n, nnz_B, baseB);
     }
     else if(scenario == 3)
     {
@@ -2468,10 +2475,10 @@ void testing_csrgemm(const Arguments& arg)
     }
 
     // Allocate device memory
-    device_vector<rocsparse_int> dcsr_row_ptr_A(M + 1);
+    device_vector<rocsparse_int> dcsr_row_ptr_A(A_m + 1);
     device_vector<rocsparse_int> dcsr_col_ind_A(nnz_A);
     device_vector<T>             dcsr_val_A(nnz_A);
-    device_vector<rocsparse_int> dcsr_row_ptr_B(K + 1);
+    device_vector<rocsparse_int> dcsr_row_ptr_B(B_m + 1);
     device_vector<rocsparse_int> dcsr_col_ind_B(nnz_B);
     device_vector<T>             dcsr_val_B(nnz_B);
     device_vector<rocsparse_int> dcsr_row_ptr_D(M + 1);
@@ -2495,7 +2502,7 @@ void testing_csrgemm(const Arguments& arg)
     {
         CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_A,
                                   hcsr_row_ptr_A,
-                                  sizeof(rocsparse_int) * (M + 1),
+                                  sizeof(rocsparse_int) * (A_m + 1),
                                   hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(
             dcsr_col_ind_A, hcsr_col_ind_A, sizeof(rocsparse_int) * nnz_A, hipMemcpyHostToDevice));
@@ -2503,7 +2510,7 @@ void testing_csrgemm(const Arguments& arg)
             hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_B,
                                   hcsr_row_ptr_B,
-                                  sizeof(rocsparse_int) * (K + 1),
+                                  sizeof(rocsparse_int) * (B_m + 1),
                                   hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(
             dcsr_col_ind_B, hcsr_col_ind_B, sizeof(rocsparse_int) * nnz_B, hipMemcpyHostToDevice));
@@ -2511,6 +2518,53 @@ void testing_csrgemm(const Arguments& arg)
             hipMemcpy(dcsr_val_B, hcsr_val_B, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
         dalpha_ptr = d_alpha;
+
+        // The host reference operates on op(A) and op(B)
+        if(transA == rocsparse_operation_transpose)
+        {
+            host_vector<rocsparse_int> hcsr_row_ptr_AT;
+            host_vector<rocsparse_int> hcsr_col_ind_AT;
+            host_vector<T>             hcsr_val_AT;
+
+            host_csr_to_csc<T>(A_m,
+                               A_n,
+                               nnz_A,
+                               hcsr_row_ptr_A,
+                               hcsr_col_ind_A,
+                               hcsr_val_A,
+                               hcsr_col_ind_AT,
+                               hcsr_row_ptr_AT,
+                               hcsr_val_AT,
+                               rocsparse_action_numeric,
+                               baseA);
+
+            hcsr_row_ptr_A.swap(hcsr_row_ptr_AT);
+            hcsr_col_ind_A.swap(hcsr_col_ind_AT);
+            hcsr_val_A.swap(hcsr_val_AT);
+        }
+
+        if(transB == rocsparse_operation_transpose)
+        {
+            host_vector<rocsparse_int> hcsr_row_ptr_BT;
+            host_vector<rocsparse_int> hcsr_col_ind_BT;
+            host_vector<T>             hcsr_val_BT;
+
+            host_csr_to_csc<T>(B_m,
+                               B_n,
+                               nnz_B,
+                               hcsr_row_ptr_B,
+                               hcsr_col_ind_B,
+                               hcsr_val_B,
+                               hcsr_col_ind_BT,
+                               hcsr_row_ptr_BT,
+                               hcsr_val_BT,
+                               rocsparse_action_numeric,
+                               baseB);
+
+            hcsr_row_ptr_B.swap(hcsr_row_ptr_BT);
+            hcsr_col_ind_B.swap(hcsr_col_ind_BT);
+            hcsr_val_B.swap(hcsr_val_BT);
+        }
     }
     else if(scenario == 3)
     {
@@ -2744,36 +2798,86 @@ void testing_csrgemm(const Arguments& arg)
         CHECK_HIP_ERROR(
             hipMemcpy(hcsr_val_C_2, dcsr_val_C_2, sizeof(T) * hnnz_C_2, hipMemcpyDeviceToHost));
 
-        // CPU csrgemm
+        // CPU csrgemm, R-MAT matrices are verified against the expand-sort-compress
+        // reference
+        auto host_csrgemm_gold = (arg.matrix == rocsparse_matrix_rmat)
+                                     ? host_csrgemm_esc<rocsparse_int, rocsparse_int, T>
+                                     : host_csrgemm<rocsparse_int, rocsparse_int, T>;
+
         host_vector<rocsparse_int> hcsr_col_ind_C_gold(hnnz_C_gold);
         host_vector<T>             hcsr_val_C_gold(hnnz_C_gold);
-        host_csrgemm(M,
-                     N,
-                     K,
-                     halpha_ptr,
-                     hcsr_row_ptr_A,
-                     hcsr_col_ind_A,
-                     hcsr_val_A,
-                     hcsr_row_ptr_B,
-                     hcsr_col_ind_B,
-                     hcsr_val_B,
-                     hbeta_ptr,
-                     hcsr_row_ptr_D,
-                     hcsr_col_ind_D,
-                     hcsr_val_D,
-                     hcsr_row_ptr_C_gold,
-                     hcsr_col_ind_C_gold,
-                     hcsr_val_C_gold,
-                     baseA,
-                     baseB,
-                     baseC,
-                     baseD);
+        host_csrgemm_gold(M,
+                          N,
+                          K,
+                          halpha_ptr,
+                          hcsr_row_ptr_A,
+                          hcsr_col_ind_A,
+                          hcsr_val_A,
+                          hcsr_row_ptr_B,
+                          hcsr_col_ind_B,
+                          hcsr_val_B,
+                          hbeta_ptr,
+                          hcsr_row_ptr_D,
+                          hcsr_col_ind_D,
+                          hcsr_val_D,
+                          hcsr_row_ptr_C_gold,
+                          hcsr_col_ind_C_gold,
+                          hcsr_val_C_gold,
+                          baseA,
+                          baseB,
+                          baseC,
+                          baseD);
 
         // Check C
         unit_check_general<rocsparse_int>(1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C_1);
         unit_check_general<rocsparse_int>(1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C_2);
         near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C_1);
         near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C_2);
+
+        // Repeat the multiplication, re-using the row grouping of C that has been kept
+        // by the previous call
+        CHECK_HIP_ERROR(hipMemset(dcsr_col_ind_C_2, 0, sizeof(rocsparse_int) * hnnz_C_2));
+        CHECK_HIP_ERROR(hipMemset(dcsr_val_C_2, 0, sizeof(T) * hnnz_C_2));
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm<T>(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   dalpha_ptr,
+                                                   descrA,
+                                                   nnz_A,
+                                                   dcsr_val_A,
+                                                   dcsr_row_ptr_A,
+                                                   dcsr_col_ind_A,
+                                                   descrB,
+                                                   nnz_B,
+                                                   dcsr_val_B,
+                                                   dcsr_row_ptr_B,
+                                                   dcsr_col_ind_B,
+                                                   dbeta_ptr,
+                                                   descrD,
+                                                   nnz_D,
+                                                   dcsr_val_D,
+                                                   dcsr_row_ptr_D,
+                                                   dcsr_col_ind_D,
+                                                   descrC,
+                                                   dcsr_val_C_2,
+                                                   dcsr_row_ptr_C_2,
+                                                   dcsr_col_ind_C_2,
+                                                   info,
+                                                   dbuffer));
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C_2,
+                                  dcsr_col_ind_C_2,
+                                  sizeof(rocsparse_int) * hnnz_C_2,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C_2, dcsr_val_C_2, sizeof(T) * hnnz_C_2, hipMemcpyDeviceToHost));
+
+        unit_check_general<rocsparse_int>(1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C_2);
+        near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C_2);
     }
 
     if(arg.timing)
@@ -2968,9 +3072,413 @@ void testing_csrgemm(const Arguments& arg)
     CHECK_HIP_ERROR(hipFree(dbuffer));
 }
 
+// C = alpha * A^T * A + beta * D or C = alpha * A * A^T + beta * D with C of symmetric type,
+// where only the triangle of C selected by its fill mode is computed
+template <typename T>
+void testing_csrgemm_symmetric(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         K         = arg.K;
+    rocsparse_operation   transA    = arg.transA;
+    rocsparse_fill_mode   uplo      = arg.uplo;
+    rocsparse_index_base  baseA     = arg.baseA;
+    rocsparse_index_base  baseC     = arg.baseC;
+    rocsparse_index_base  baseD     = arg.baseD;
+    static constexpr bool full_rank = false;
+
+    // Exactly one of both operands is transposed
+    rocsparse_operation transB = (transA == rocsparse_operation_none)
+                                     ? rocsparse_operation_transpose
+                                     : rocsparse_operation_none;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    // beta == -99 means test for beta == nullptr
+    T* hbeta_ptr = (h_beta == static_cast<T>(-99)) ? nullptr : &h_beta;
+
+    if(M <= 0 || K <= 0)
+    {
+        return;
+    }
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descrA;
+    rocsparse_local_mat_descr descrC;
+    rocsparse_local_mat_descr descrD;
+
+    // Create matrix info for C
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrC, baseC));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrD, baseD));
+
+    // C is symmetric
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descrC, rocsparse_matrix_type_symmetric));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_fill_mode(descrC, uplo));
+
+    // Dimensions of A, as it is stored
+    rocsparse_int A_m = (transA == rocsparse_operation_none) ? M : K;
+    rocsparse_int A_n = (transA == rocsparse_operation_none) ? K : M;
+
+    // Allocate host memory for matrices
+    host_vector<rocsparse_int> hcsr_row_ptr_A;
+    host_vector<rocsparse_int> hcsr_col_ind_A;
+    host_vector<T>             hcsr_val_A;
+    host_vector<rocsparse_int> hcsr_row_ptr_D;
+    host_vector<rocsparse_int> hcsr_col_ind_D;
+    host_vector<T>             hcsr_val_D;
+
+    rocsparse_int nnz_A;
+    rocsparse_int nnz_D;
+
+    rocsparse_matrix_factory<T> matrix_factory(arg, arg.timing ? false : true, full_rank);
+    matrix_factory.init_csr(hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, A_m, A_n, nnz_A, baseA);
+
+    rocsparse_matrix_factory_random<T> matrix_factory_random(full_rank);
+    matrix_factory_random.init_csr(hcsr_row_ptr_D, hcsr_col_ind_D, hcsr_val_D, M, M, nnz_D, baseD);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr_A(A_m + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_A(nnz_A);
+    device_vector<T>             dcsr_val_A(nnz_A);
+    device_vector<rocsparse_int> dcsr_row_ptr_D(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_D(nnz_D);
+    device_vector<T>             dcsr_val_D(nnz_D);
+    device_vector<T>             d_alpha(1);
+    device_vector<T>             d_beta(1);
+    device_vector<rocsparse_int> dcsr_row_ptr_C_1(M + 1);
+    device_vector<rocsparse_int> dcsr_row_ptr_C_2(M + 1);
+    device_vector<rocsparse_int> dnnz_C_2(1);
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || !dcsr_row_ptr_D || !dcsr_col_ind_D
+       || !dcsr_val_D || !d_alpha || !d_beta || !dcsr_row_ptr_C_1 || !dcsr_row_ptr_C_2
+       || !dnnz_C_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_row_ptr_A,
+                              hcsr_row_ptr_A,
+                              sizeof(rocsparse_int) * (A_m + 1),
+                              hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_A, hcsr_col_ind_A, sizeof(rocsparse_int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_D, hcsr_row_ptr_D, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_D, hcsr_col_ind_D, sizeof(rocsparse_int) * nnz_D, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_D, hcsr_val_D, sizeof(T) * nnz_D, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    T* dbeta_ptr = (hbeta_ptr == nullptr) ? nullptr : (T*)d_beta;
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size<T>(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           M,
+                                                           K,
+                                                           &h_alpha,
+                                                           descrA,
+                                                           nnz_A,
+                                                           dcsr_row_ptr_A,
+                                                           dcsr_col_ind_A,
+                                                           descrA,
+                                                           nnz_A,
+                                                           dcsr_row_ptr_A,
+                                                           dcsr_col_ind_A,
+                                                           hbeta_ptr,
+                                                           descrD,
+                                                           nnz_D,
+                                                           dcsr_row_ptr_D,
+                                                           dcsr_col_ind_D,
+                                                           info,
+                                                           &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        rocsparse_int hnnz_C_1;
+        rocsparse_int hnnz_C_2;
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    M,
+                                                    K,
+                                                    descrA,
+                                                    nnz_A,
+                                                    dcsr_row_ptr_A,
+                                                    dcsr_col_ind_A,
+                                                    descrA,
+                                                    nnz_A,
+                                                    dcsr_row_ptr_A,
+                                                    dcsr_col_ind_A,
+                                                    descrD,
+                                                    nnz_D,
+                                                    dcsr_row_ptr_D,
+                                                    dcsr_col_ind_D,
+                                                    descrC,
+                                                    dcsr_row_ptr_C_1,
+                                                    &hnnz_C_1,
+                                                    info,
+                                                    dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    M,
+                                                    K,
+                                                    descrA,
+                                                    nnz_A,
+                                                    dcsr_row_ptr_A,
+                                                    dcsr_col_ind_A,
+                                                    descrA,
+                                                    nnz_A,
+                                                    dcsr_row_ptr_A,
+                                                    dcsr_col_ind_A,
+                                                    descrD,
+                                                    nnz_D,
+                                                    dcsr_row_ptr_D,
+                                                    dcsr_col_ind_D,
+                                                    descrC,
+                                                    dcsr_row_ptr_C_2,
+                                                    dnnz_C_2,
+                                                    info,
+                                                    dbuffer));
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hnnz_C_2, dnnz_C_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Allocate device memory for C
+        device_vector<rocsparse_int> dcsr_col_ind_C_1(hnnz_C_1);
+        device_vector<rocsparse_int> dcsr_col_ind_C_2(hnnz_C_2);
+        device_vector<T>             dcsr_val_C_1(hnnz_C_1);
+        device_vector<T>             dcsr_val_C_2(hnnz_C_2);
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm<T>(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   M,
+                                                   K,
+                                                   &h_alpha,
+                                                   descrA,
+                                                   nnz_A,
+                                                   dcsr_val_A,
+                                                   dcsr_row_ptr_A,
+                                                   dcsr_col_ind_A,
+                                                   descrA,
+                                                   nnz_A,
+                                                   dcsr_val_A,
+                                                   dcsr_row_ptr_A,
+                                                   dcsr_col_ind_A,
+                                                   hbeta_ptr,
+                                                   descrD,
+                                                   nnz_D,
+                                                   dcsr_val_D,
+                                                   dcsr_row_ptr_D,
+                                                   dcsr_col_ind_D,
+                                                   descrC,
+                                                   dcsr_val_C_1,
+                                                   dcsr_row_ptr_C_1,
+                                                   dcsr_col_ind_C_1,
+                                                   info,
+                                                   dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm<T>(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   M,
+                                                   K,
+                                                   d_alpha,
+                                                   descrA,
+                                                   nnz_A,
+                                                   dcsr_val_A,
+                                                   dcsr_row_ptr_A,
+                                                   dcsr_col_ind_A,
+                                                   descrA,
+                                                   nnz_A,
+                                                   dcsr_val_A,
+                                                   dcsr_row_ptr_A,
+                                                   dcsr_col_ind_A,
+                                                   dbeta_ptr,
+                                                   descrD,
+                                                   nnz_D,
+                                                   dcsr_val_D,
+                                                   dcsr_row_ptr_D,
+                                                   dcsr_col_ind_D,
+                                                   descrC,
+                                                   dcsr_val_C_2,
+                                                   dcsr_row_ptr_C_2,
+                                                   dcsr_col_ind_C_2,
+                                                   info,
+                                                   dbuffer));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr_row_ptr_C_1(M + 1);
+        host_vector<rocsparse_int> hcsr_row_ptr_C_2(M + 1);
+        host_vector<rocsparse_int> hcsr_col_ind_C_1(hnnz_C_1);
+        host_vector<rocsparse_int> hcsr_col_ind_C_2(hnnz_C_2);
+        host_vector<T>             hcsr_val_C_1(hnnz_C_1);
+        host_vector<T>             hcsr_val_C_2(hnnz_C_2);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C_1,
+                                  dcsr_row_ptr_C_1,
+                                  sizeof(rocsparse_int) * (M + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C_2,
+                                  dcsr_row_ptr_C_2,
+                                  sizeof(rocsparse_int) * (M + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C_1,
+                                  dcsr_col_ind_C_1,
+                                  sizeof(rocsparse_int) * hnnz_C_1,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C_2,
+                                  dcsr_col_ind_C_2,
+                                  sizeof(rocsparse_int) * hnnz_C_2,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C_1, dcsr_val_C_1, sizeof(T) * hnnz_C_1, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_C_2, dcsr_val_C_2, sizeof(T) * hnnz_C_2, hipMemcpyDeviceToHost));
+
+        // The host reference computes the full product on op(A) and op(B)
+        host_vector<rocsparse_int> hcsr_row_ptr_AT;
+        host_vector<rocsparse_int> hcsr_col_ind_AT;
+        host_vector<T>             hcsr_val_AT;
+
+        host_csr_to_csc<T>(A_m,
+                           A_n,
+                           nnz_A,
+                           hcsr_row_ptr_A,
+                           hcsr_col_ind_A,
+                           hcsr_val_A,
+                           hcsr_col_ind_AT,
+                           hcsr_row_ptr_AT,
+                           hcsr_val_AT,
+                           rocsparse_action_numeric,
+                           baseA);
+
+        bool trans = (transA == rocsparse_operation_transpose);
+
+        host_vector<rocsparse_int> hcsr_row_ptr_F(M + 1);
+        rocsparse_int              hnnz_F;
+        host_csrgemm_nnz(M,
+                         M,
+                         K,
+                         &h_alpha,
+                         trans ? hcsr_row_ptr_AT : hcsr_row_ptr_A,
+                         trans ? hcsr_col_ind_AT : hcsr_col_ind_A,
+                         trans ? hcsr_row_ptr_A : hcsr_row_ptr_AT,
+                         trans ? hcsr_col_ind_A : hcsr_col_ind_AT,
+                         (const T*)hbeta_ptr,
+                         hcsr_row_ptr_D,
+                         hcsr_col_ind_D,
+                         hcsr_row_ptr_F,
+                         &hnnz_F,
+                         baseA,
+                         baseA,
+                         baseC,
+                         baseD);
+
+        host_vector<rocsparse_int> hcsr_col_ind_F(hnnz_F);
+        host_vector<T>             hcsr_val_F(hnnz_F);
+        host_csrgemm(M,
+                     M,
+                     K,
+                     &h_alpha,
+                     trans ? hcsr_row_ptr_AT : hcsr_row_ptr_A,
+                     trans ? hcsr_col_ind_AT : hcsr_col_ind_A,
+                     trans ? hcsr_val_AT : hcsr_val_A,
+                     trans ? hcsr_row_ptr_A : hcsr_row_ptr_AT,
+                     trans ? hcsr_col_ind_A : hcsr_col_ind_AT,
+                     trans ? hcsr_val_A : hcsr_val_AT,
+                     (const T*)hbeta_ptr,
+                     hcsr_row_ptr_D,
+                     hcsr_col_ind_D,
+                     hcsr_val_D,
+                     hcsr_row_ptr_F,
+                     hcsr_col_ind_F,
+                     hcsr_val_F,
+                     baseA,
+                     baseA,
+                     baseC,
+                     baseD);
+
+        // Extract the triangle selected by the fill mode of C
+        host_vector<rocsparse_int> hcsr_row_ptr_C_gold(M + 1);
+        host_vector<rocsparse_int> hcsr_col_ind_C_gold;
+        host_vector<T>             hcsr_val_C_gold;
+
+        hcsr_row_ptr_C_gold[0] = baseC;
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            for(rocsparse_int j = hcsr_row_ptr_F[i] - baseC; j < hcsr_row_ptr_F[i + 1] - baseC;
+                ++j)
+            {
+                rocsparse_int col = hcsr_col_ind_F[j] - baseC;
+
+                if((uplo == rocsparse_fill_mode_upper) ? (col >= i) : (col <= i))
+                {
+                    hcsr_col_ind_C_gold.push_back(hcsr_col_ind_F[j]);
+                    hcsr_val_C_gold.push_back(hcsr_val_F[j]);
+                }
+            }
+
+            hcsr_row_ptr_C_gold[i + 1]
+                = static_cast<rocsparse_int>(hcsr_col_ind_C_gold.size()) + baseC;
+        }
+
+        rocsparse_int hnnz_C_gold = static_cast<rocsparse_int>(hcsr_col_ind_C_gold.size());
+
+        // Check C
+        unit_check_general(1, 1, 1, &hnnz_C_gold, &hnnz_C_1);
+        unit_check_general(1, 1, 1, &hnnz_C_gold, &hnnz_C_2);
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C_1);
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C_2);
+        unit_check_general<rocsparse_int>(1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C_1);
+        unit_check_general<rocsparse_int>(1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C_2);
+        near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C_1);
+        near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C_2);
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
 #define INSTANTIATE(TYPE)                                              \
     template void testing_csrgemm_bad_arg<TYPE>(const Arguments& arg); \
-    template void testing_csrgemm<TYPE>(const Arguments& arg)
+    template void testing_csrgemm<TYPE>(const Arguments& arg);         \
+    template void testing_csrgemm_symmetric<TYPE>(const Arguments& arg)
 INSTANTIATE(float);
 INSTANTIATE(double);
 INSTANTIATE(rocsparse_float_complex);
@@ -0,0 +1,763 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2019-2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing.hpp"
+
+template <typename T>
+void testing_csrgemm_masked_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    T h_alpha = 0.6;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr local_descrA;
+    rocsparse_local_mat_descr local_descrB;
+    rocsparse_local_mat_descr local_descrM;
+    rocsparse_local_mat_descr local_descrC;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr_A(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_A(safe_size);
+    device_vector<T>             dcsr_val_A(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_B(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_B(safe_size);
+    device_vector<T>             dcsr_val_B(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_M(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_M(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_C(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_C(safe_size);
+    device_vector<T>             dcsr_val_C(safe_size);
+    device_vector<T>             dbuffer(safe_size);
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || !dcsr_row_ptr_B || !dcsr_col_ind_B
+       || !dcsr_val_B || !dcsr_row_ptr_M || !dcsr_col_ind_M || !dcsr_row_ptr_C || !dcsr_col_ind_C
+       || !dcsr_val_C || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    rocsparse_handle          handle        = local_handle;
+    rocsparse_operation       trans_A       = rocsparse_operation_none;
+    rocsparse_operation       trans_B       = rocsparse_operation_none;
+    rocsparse_int             m             = safe_size;
+    rocsparse_int             n             = safe_size;
+    rocsparse_int             k             = safe_size;
+    const T*                  alpha         = &h_alpha;
+    const rocsparse_mat_descr descr_A       = local_descrA;
+    rocsparse_int             nnz_A         = safe_size;
+    const T*                  csr_val_A     = dcsr_val_A;
+    const rocsparse_int*      csr_row_ptr_A = dcsr_row_ptr_A;
+    const rocsparse_int*      csr_col_ind_A = dcsr_col_ind_A;
+    const rocsparse_mat_descr descr_B       = local_descrB;
+    rocsparse_int             nnz_B         = safe_size;
+    const T*                  csr_val_B     = dcsr_val_B;
+    const rocsparse_int*      csr_row_ptr_B = dcsr_row_ptr_B;
+    const rocsparse_int*      csr_col_ind_B = dcsr_col_ind_B;
+    const rocsparse_mat_descr descr_M       = local_descrM;
+    rocsparse_int             nnz_M         = safe_size;
+    const rocsparse_int*      csr_row_ptr_M = dcsr_row_ptr_M;
+    const rocsparse_int*      csr_col_ind_M = dcsr_col_ind_M;
+    rocsparse_mask_type       mask_type     = rocsparse_mask_type_structural;
+    const rocsparse_mat_descr descr_C       = local_descrC;
+    T*                        csr_val_C     = dcsr_val_C;
+    const rocsparse_int*      csr_row_ptr_C = dcsr_row_ptr_C;
+    rocsparse_int*            csr_col_ind_C = dcsr_col_ind_C;
+    rocsparse_mat_info        info_C        = local_info;
+    void*                     temp_buffer   = dbuffer;
+
+#define PARAMS                                                                                 \
+    handle, trans_A, trans_B, m, n, k, alpha, descr_A, nnz_A, csr_val_A, csr_row_ptr_A,         \
+        csr_col_ind_A, descr_B, nnz_B, csr_val_B, csr_row_ptr_B, csr_col_ind_B, descr_M, nnz_M, \
+        csr_row_ptr_M, csr_col_ind_M, mask_type, descr_C, csr_val_C, csr_row_ptr_C,             \
+        csr_col_ind_C, info_C, temp_buffer
+
+    // Invalid handle
+    handle = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_invalid_handle);
+    handle = local_handle;
+
+    // Invalid info
+    info_C = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_invalid_pointer);
+    info_C = local_info;
+
+    // Info has not been initialized by rocsparse_csrgemm_buffer_size()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_invalid_pointer);
+
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size<T>(handle,
+                                                           trans_A,
+                                                           trans_B,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           descr_A,
+                                                           nnz_A,
+                                                           csr_row_ptr_A,
+                                                           csr_col_ind_A,
+                                                           descr_B,
+                                                           nnz_B,
+                                                           csr_row_ptr_B,
+                                                           csr_col_ind_B,
+                                                           (const T*)nullptr,
+                                                           nullptr,
+                                                           0,
+                                                           nullptr,
+                                                           nullptr,
+                                                           info_C,
+                                                           &buffer_size));
+
+    // Invalid mask type
+    mask_type = (rocsparse_mask_type)2;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_invalid_value);
+    mask_type = rocsparse_mask_type_structural;
+
+    // Invalid sizes
+    m = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_invalid_size);
+    m = safe_size;
+
+    n = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_invalid_size);
+    n = safe_size;
+
+    nnz_M = -1;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_invalid_size);
+    nnz_M = safe_size;
+
+    // Invalid pointers
+    descr_M = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_invalid_pointer);
+    descr_M = local_descrM;
+
+    csr_row_ptr_M = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_row_ptr_M = dcsr_row_ptr_M;
+
+    csr_col_ind_M = nullptr;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_invalid_pointer);
+    csr_col_ind_M = dcsr_col_ind_M;
+
+    // Invalid matrix type of the mask
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(local_descrM, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_not_implemented);
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(local_descrM, rocsparse_matrix_type_general));
+
+    // Masked csrgemm does not support C = alpha * op(A) * op(B) + beta * D
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size<T>(handle,
+                                                           trans_A,
+                                                           trans_B,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           alpha,
+                                                           descr_A,
+                                                           nnz_A,
+                                                           csr_row_ptr_A,
+                                                           csr_col_ind_A,
+                                                           descr_B,
+                                                           nnz_B,
+                                                           csr_row_ptr_B,
+                                                           csr_col_ind_B,
+                                                           alpha,
+                                                           descr_C,
+                                                           nnz_A,
+                                                           csr_row_ptr_A,
+                                                           csr_col_ind_A,
+                                                           info_C,
+                                                           &buffer_size));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_masked<T>(PARAMS), rocsparse_status_invalid_value);
+
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csrgemm_masked(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         N         = arg.N;
+    rocsparse_int         K         = arg.K;
+    rocsparse_operation   transA    = arg.transA;
+    rocsparse_operation   transB    = arg.transB;
+    rocsparse_index_base  baseA     = arg.baseA;
+    rocsparse_index_base  baseB     = arg.baseB;
+    rocsparse_index_base  baseC     = arg.baseC;
+    rocsparse_index_base  baseM     = arg.baseD;
+    static constexpr bool full_rank = false;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    // Masked csrgemm only computes C = alpha * op(A) * op(B), thus only alpha != nullptr
+    // && beta == nullptr is tested. The mask uses the index base of D.
+    if(h_alpha == static_cast<T>(-99))
+    {
+        return;
+    }
+
+    T* halpha_ptr = &h_alpha;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descrA;
+    rocsparse_local_mat_descr descrB;
+    rocsparse_local_mat_descr descrC;
+    rocsparse_local_mat_descr descrM;
+
+    // Create matrix info for C
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrB, baseB));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrC, baseC));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrM, baseM));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr_A(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_A(safe_size);
+        device_vector<T>             dcsr_val_A(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_B(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_B(safe_size);
+        device_vector<T>             dcsr_val_B(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_M(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_M(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_C(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_C(safe_size);
+        device_vector<T>             dcsr_val_C(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || !dcsr_row_ptr_B || !dcsr_col_ind_B
+           || !dcsr_val_B || !dcsr_row_ptr_M || !dcsr_col_ind_M || !dcsr_row_ptr_C
+           || !dcsr_col_ind_C || !dcsr_val_C || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        size_t              buffer_size;
+        rocsparse_int       nnz_C;
+        rocsparse_mask_type mask_type = rocsparse_mask_type_structural;
+
+        rocsparse_status status_1 = rocsparse_csrgemm_buffer_size<T>(handle,
+                                                                     transA,
+                                                                     transB,
+                                                                     M,
+                                                                     N,
+                                                                     K,
+                                                                     halpha_ptr,
+                                                                     descrA,
+                                                                     safe_size,
+                                                                     dcsr_row_ptr_A,
+                                                                     dcsr_col_ind_A,
+                                                                     descrB,
+                                                                     safe_size,
+                                                                     dcsr_row_ptr_B,
+                                                                     dcsr_col_ind_B,
+                                                                     (const T*)nullptr,
+                                                                     nullptr,
+                                                                     0,
+                                                                     nullptr,
+                                                                     nullptr,
+                                                                     info,
+                                                                     &buffer_size);
+        rocsparse_status status_2 = rocsparse_csrgemm_masked_nnz(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 descrA,
+                                                                 safe_size,
+                                                                 dcsr_row_ptr_A,
+                                                                 dcsr_col_ind_A,
+                                                                 descrB,
+                                                                 safe_size,
+                                                                 dcsr_row_ptr_B,
+                                                                 dcsr_col_ind_B,
+                                                                 descrM,
+                                                                 safe_size,
+                                                                 dcsr_row_ptr_M,
+                                                                 dcsr_col_ind_M,
+                                                                 mask_type,
+                                                                 descrC,
+                                                                 dcsr_row_ptr_C,
+                                                                 &nnz_C,
+                                                                 info,
+                                                                 dbuffer);
+        rocsparse_status status_3 = rocsparse_csrgemm_masked<T>(handle,
+                                                                transA,
+                                                                transB,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                halpha_ptr,
+                                                                descrA,
+                                                                safe_size,
+                                                                dcsr_val_A,
+                                                                dcsr_row_ptr_A,
+                                                                dcsr_col_ind_A,
+                                                                descrB,
+                                                                safe_size,
+                                                                dcsr_val_B,
+                                                                dcsr_row_ptr_B,
+                                                                dcsr_col_ind_B,
+                                                                descrM,
+                                                                safe_size,
+                                                                dcsr_row_ptr_M,
+                                                                dcsr_col_ind_M,
+                                                                mask_type,
+                                                                descrC,
+                                                                dcsr_val_C,
+                                                                dcsr_row_ptr_C,
+                                                                dcsr_col_ind_C,
+                                                                info,
+                                                                dbuffer);
+
+        EXPECT_ROCSPARSE_STATUS(status_1,
+                                (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size
+                                                          : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(status_2,
+                                (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size
+                                                          : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(status_3,
+                                (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size
+                                                          : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrices
+    host_vector<rocsparse_int> hcsr_row_ptr_A;
+    host_vector<rocsparse_int> hcsr_col_ind_A;
+    host_vector<T>             hcsr_val_A;
+    host_vector<rocsparse_int> hcsr_row_ptr_B;
+    host_vector<rocsparse_int> hcsr_col_ind_B;
+    host_vector<T>             hcsr_val_B;
+    host_vector<rocsparse_int> hcsr_row_ptr_M;
+    host_vector<rocsparse_int> hcsr_col_ind_M;
+    host_vector<T>             hcsr_val_M;
+
+    // Sample matrix
+    rocsparse_int nnz_A = 4;
+    rocsparse_int nnz_B = 4;
+    rocsparse_int nnz_M = 4;
+    rocsparse_int hnnz_C_gold;
+    rocsparse_int hnnz_C;
+
+    rocsparse_matrix_factory<T> matrix_factory(arg, arg.timing ? false : true, full_rank);
+    matrix_factory.init_csr(hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, M, K, nnz_A, baseA);
+
+    rocsparse_matrix_factory_random<T> matrix_factory_random(full_rank);
+    matrix_factory_random.init_csr(hcsr_row_ptr_B, hcsr_col_ind_B, hcsr_val_B, K, N, nnz_B, baseB);
+    matrix_factory_random.init_csr(hcsr_row_ptr_M, hcsr_col_ind_M, hcsr_val_M, M, N, nnz_M, baseM);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr_A(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_A(nnz_A);
+    device_vector<T>             dcsr_val_A(nnz_A);
+    device_vector<rocsparse_int> dcsr_row_ptr_B(K + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_B(nnz_B);
+    device_vector<T>             dcsr_val_B(nnz_B);
+    device_vector<rocsparse_int> dcsr_row_ptr_M(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_M(nnz_M);
+    device_vector<T>             d_alpha(1);
+    device_vector<rocsparse_int> dcsr_row_ptr_C(M + 1);
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || !dcsr_row_ptr_B || !dcsr_col_ind_B
+       || !dcsr_val_B || !dcsr_row_ptr_M || !dcsr_col_ind_M || !d_alpha || !dcsr_row_ptr_C)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_A, hcsr_row_ptr_A, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_A, hcsr_col_ind_A, sizeof(rocsparse_int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_B, hcsr_row_ptr_B, sizeof(rocsparse_int) * (K + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_B, hcsr_col_ind_B, sizeof(rocsparse_int) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_B, hcsr_val_B, sizeof(T) * nnz_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_M, hcsr_row_ptr_M, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_M, hcsr_col_ind_M, sizeof(rocsparse_int) * nnz_M, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size<T>(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           halpha_ptr,
+                                                           descrA,
+                                                           nnz_A,
+                                                           dcsr_row_ptr_A,
+                                                           dcsr_col_ind_A,
+                                                           descrB,
+                                                           nnz_B,
+                                                           dcsr_row_ptr_B,
+                                                           dcsr_col_ind_B,
+                                                           (const T*)nullptr,
+                                                           nullptr,
+                                                           0,
+                                                           nullptr,
+                                                           nullptr,
+                                                           info,
+                                                           &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    // Test the mask as well as its complement
+    for(rocsparse_mask_type mask_type :
+        {rocsparse_mask_type_structural, rocsparse_mask_type_complement})
+    {
+        // Obtain nnz and row pointers of C
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_masked_nnz(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           K,
+                                                           descrA,
+                                                           nnz_A,
+                                                           dcsr_row_ptr_A,
+                                                           dcsr_col_ind_A,
+                                                           descrB,
+                                                           nnz_B,
+                                                           dcsr_row_ptr_B,
+                                                           dcsr_col_ind_B,
+                                                           descrM,
+                                                           nnz_M,
+                                                           dcsr_row_ptr_M,
+                                                           dcsr_col_ind_M,
+                                                           mask_type,
+                                                           descrC,
+                                                           dcsr_row_ptr_C,
+                                                           &hnnz_C,
+                                                           info,
+                                                           dbuffer));
+
+        // Allocate device memory for C
+        device_vector<rocsparse_int> dcsr_col_ind_C(hnnz_C);
+        device_vector<T>             dcsr_val_C(hnnz_C);
+
+        if(!dcsr_col_ind_C || !dcsr_val_C)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        if(arg.unit_check)
+        {
+            // CPU masked csrgemm
+            std::vector<rocsparse_int> hcsr_row_ptr_C_gold;
+            std::vector<rocsparse_int> hcsr_col_ind_C_gold;
+            std::vector<T>             hcsr_val_C_gold;
+
+            host_csrgemm_masked(M,
+                                N,
+                                K,
+                                h_alpha,
+                                hcsr_row_ptr_A,
+                                hcsr_col_ind_A,
+                                hcsr_val_A,
+                                hcsr_row_ptr_B,
+                                hcsr_col_ind_B,
+                                hcsr_val_B,
+                                hcsr_row_ptr_M,
+                                hcsr_col_ind_M,
+                                mask_type,
+                                hcsr_row_ptr_C_gold,
+                                &hnnz_C_gold,
+                                hcsr_col_ind_C_gold,
+                                hcsr_val_C_gold,
+                                baseA,
+                                baseB,
+                                baseM,
+                                baseC);
+
+            // Check nnz and row pointers of C
+            host_vector<rocsparse_int> hcsr_row_ptr_C(M + 1);
+            CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C,
+                                      dcsr_row_ptr_C,
+                                      sizeof(rocsparse_int) * (M + 1),
+                                      hipMemcpyDeviceToHost));
+
+            unit_check_general(1, 1, 1, &hnnz_C_gold, &hnnz_C);
+            unit_check_general<rocsparse_int>(
+                1, M + 1, 1, hcsr_row_ptr_C_gold.data(), hcsr_row_ptr_C);
+
+            // Host and device results of C
+            host_vector<rocsparse_int> hcsr_col_ind_C_1(hnnz_C);
+            host_vector<rocsparse_int> hcsr_col_ind_C_2(hnnz_C);
+            host_vector<T>             hcsr_val_C_1(hnnz_C);
+            host_vector<T>             hcsr_val_C_2(hnnz_C);
+
+            // Pointer mode host
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_masked<T>(handle,
+                                                              transA,
+                                                              transB,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              halpha_ptr,
+                                                              descrA,
+                                                              nnz_A,
+                                                              dcsr_val_A,
+                                                              dcsr_row_ptr_A,
+                                                              dcsr_col_ind_A,
+                                                              descrB,
+                                                              nnz_B,
+                                                              dcsr_val_B,
+                                                              dcsr_row_ptr_B,
+                                                              dcsr_col_ind_B,
+                                                              descrM,
+                                                              nnz_M,
+                                                              dcsr_row_ptr_M,
+                                                              dcsr_col_ind_M,
+                                                              mask_type,
+                                                              descrC,
+                                                              dcsr_val_C,
+                                                              dcsr_row_ptr_C,
+                                                              dcsr_col_ind_C,
+                                                              info,
+                                                              dbuffer));
+
+            CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C_1,
+                                      dcsr_col_ind_C,
+                                      sizeof(rocsparse_int) * hnnz_C,
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hcsr_val_C_1, dcsr_val_C, sizeof(T) * hnnz_C, hipMemcpyDeviceToHost));
+
+            // Pointer mode device
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_masked<T>(handle,
+                                                              transA,
+                                                              transB,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              d_alpha,
+                                                              descrA,
+                                                              nnz_A,
+                                                              dcsr_val_A,
+                                                              dcsr_row_ptr_A,
+                                                              dcsr_col_ind_A,
+                                                              descrB,
+                                                              nnz_B,
+                                                              dcsr_val_B,
+                                                              dcsr_row_ptr_B,
+                                                              dcsr_col_ind_B,
+                                                              descrM,
+                                                              nnz_M,
+                                                              dcsr_row_ptr_M,
+                                                              dcsr_col_ind_M,
+                                                              mask_type,
+                                                              descrC,
+                                                              dcsr_val_C,
+                                                              dcsr_row_ptr_C,
+                                                              dcsr_col_ind_C,
+                                                              info,
+                                                              dbuffer));
+
+            CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C_2,
+                                      dcsr_col_ind_C,
+                                      sizeof(rocsparse_int) * hnnz_C,
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hcsr_val_C_2, dcsr_val_C, sizeof(T) * hnnz_C, hipMemcpyDeviceToHost));
+
+            // Check C
+            unit_check_general<rocsparse_int>(
+                1, hnnz_C_gold, 1, hcsr_col_ind_C_gold.data(), hcsr_col_ind_C_1);
+            unit_check_general<rocsparse_int>(
+                1, hnnz_C_gold, 1, hcsr_col_ind_C_gold.data(), hcsr_col_ind_C_2);
+            near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C_1);
+            near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold.data(), hcsr_val_C_2);
+        }
+
+        if(arg.timing)
+        {
+            int number_cold_calls = 2;
+            int number_hot_calls  = arg.iters;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            // Warm up
+            for(int iter = 0; iter < number_cold_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_masked<T>(handle,
+                                                                  transA,
+                                                                  transB,
+                                                                  M,
+                                                                  N,
+                                                                  K,
+                                                                  halpha_ptr,
+                                                                  descrA,
+                                                                  nnz_A,
+                                                                  dcsr_val_A,
+                                                                  dcsr_row_ptr_A,
+                                                                  dcsr_col_ind_A,
+                                                                  descrB,
+                                                                  nnz_B,
+                                                                  dcsr_val_B,
+                                                                  dcsr_row_ptr_B,
+                                                                  dcsr_col_ind_B,
+                                                                  descrM,
+                                                                  nnz_M,
+                                                                  dcsr_row_ptr_M,
+                                                                  dcsr_col_ind_M,
+                                                                  mask_type,
+                                                                  descrC,
+                                                                  dcsr_val_C,
+                                                                  dcsr_row_ptr_C,
+                                                                  dcsr_col_ind_C,
+                                                                  info,
+                                                                  dbuffer));
+            }
+
+            double gpu_time_used = get_time_us();
+
+            // Performance run
+            for(int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_masked<T>(handle,
+                                                                  transA,
+                                                                  transB,
+                                                                  M,
+                                                                  N,
+                                                                  K,
+                                                                  halpha_ptr,
+                                                                  descrA,
+                                                                  nnz_A,
+                                                                  dcsr_val_A,
+                                                                  dcsr_row_ptr_A,
+                                                                  dcsr_col_ind_A,
+                                                                  descrB,
+                                                                  nnz_B,
+                                                                  dcsr_val_B,
+                                                                  dcsr_row_ptr_B,
+                                                                  dcsr_col_ind_B,
+                                                                  descrM,
+                                                                  nnz_M,
+                                                                  dcsr_row_ptr_M,
+                                                                  dcsr_col_ind_M,
+                                                                  mask_type,
+                                                                  descrC,
+                                                                  dcsr_val_C,
+                                                                  dcsr_row_ptr_C,
+                                                                  dcsr_col_ind_C,
+                                                                  info,
+                                                                  dbuffer));
+            }
+
+            gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+            // The hash kernels still form every intermediate product of A * B
+            double gpu_gflops
+                = csrgemm_gflop_count<T, rocsparse_int, rocsparse_int>(M,
+                                                                       halpha_ptr,
+                                                                       hcsr_row_ptr_A,
+                                                                       hcsr_col_ind_A,
+                                                                       hcsr_row_ptr_B,
+                                                                       (const T*)nullptr,
+                                                                       hcsr_row_ptr_A,
+                                                                       baseA)
+                  / gpu_time_used * 1e6;
+            double gpu_gbyte = csrgemm_gbyte_count(M,
+                                                   N,
+                                                   K,
+                                                   nnz_A,
+                                                   nnz_B,
+                                                   hnnz_C,
+                                                   (rocsparse_int)0,
+                                                   halpha_ptr,
+                                                   (const T*)nullptr)
+                               / gpu_time_used * 1e6;
+
+            std::cout.precision(2);
+            std::cout.setf(std::ios::fixed);
+            std::cout.setf(std::ios::left);
+
+            std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "K"
+                      << std::setw(12) << "nnz_A" << std::setw(12) << "nnz_B" << std::setw(12)
+                      << "nnz_M" << std::setw(12) << "nnz_C" << std::setw(12) << "mask"
+                      << std::setw(12) << "alpha" << std::setw(12) << "GFlop/s" << std::setw(12)
+                      << "GB/s" << std::setw(16) << "msec" << std::setw(12) << "iter"
+                      << std::setw(12) << "verified" << std::endl;
+
+            std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << K
+                      << std::setw(12) << nnz_A << std::setw(12) << nnz_B << std::setw(12)
+                      << nnz_M << std::setw(12) << hnnz_C << std::setw(12)
+                      << rocsparse_masktype2string(mask_type) << std::setw(12) << h_alpha
+                      << std::setw(12) << gpu_gflops << std::setw(12) << gpu_gbyte
+                      << std::setw(16) << gpu_time_used / 1e3 << std::setw(12)
+                      << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                      << std::endl;
+        }
+    }
+
+    // Free buffers
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                     \
+    template void testing_csrgemm_masked_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrgemm_masked<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,397 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "auto_testing_bad_arg.hpp"
+#include "testing.hpp"
+
+template <typename T>
+void testing_csrgemm_nnz_estimate_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr local_descrA;
+    rocsparse_local_mat_descr local_descrB;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr_A(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_A(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_B(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_B(safe_size);
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_row_ptr_B || !dcsr_col_ind_B)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    int64_t h_nnz_products;
+    int64_t h_nnz_C;
+    int64_t h_nnz_C_lower;
+    int64_t h_nnz_C_upper;
+
+    rocsparse_handle          handle        = local_handle;
+    rocsparse_operation       trans_A       = rocsparse_operation_none;
+    rocsparse_operation       trans_B       = rocsparse_operation_none;
+    rocsparse_int             m             = safe_size;
+    rocsparse_int             n             = safe_size;
+    rocsparse_int             k             = safe_size;
+    const rocsparse_mat_descr descr_A       = local_descrA;
+    rocsparse_int             nnz_A         = safe_size;
+    const rocsparse_int*      csr_row_ptr_A = dcsr_row_ptr_A;
+    const rocsparse_int*      csr_col_ind_A = dcsr_col_ind_A;
+    const rocsparse_mat_descr descr_B       = local_descrB;
+    rocsparse_int             nnz_B         = safe_size;
+    const rocsparse_int*      csr_row_ptr_B = dcsr_row_ptr_B;
+    const rocsparse_int*      csr_col_ind_B = dcsr_col_ind_B;
+    rocsparse_int             sample_size   = safe_size;
+    int64_t*                  nnz_products  = &h_nnz_products;
+    int64_t*                  nnz_C         = &h_nnz_C;
+    int64_t*                  nnz_C_lower   = &h_nnz_C_lower;
+    int64_t*                  nnz_C_upper   = &h_nnz_C_upper;
+
+#define PARAMS                                                                                \
+    handle, trans_A, trans_B, m, n, k, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, \
+        nnz_B, csr_row_ptr_B, csr_col_ind_B, sample_size, nnz_products, nnz_C, nnz_C_lower,   \
+        nnz_C_upper
+
+    auto_testing_bad_arg(rocsparse_csrgemm_nnz_estimate, PARAMS);
+
+    // Sample size has to be positive
+    sample_size = 0;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_nnz_estimate(PARAMS),
+                            rocsparse_status_invalid_size);
+    sample_size = safe_size;
+
+    // Only non-transposed matrices are supported
+    trans_A = rocsparse_operation_transpose;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_nnz_estimate(PARAMS),
+                            rocsparse_status_not_implemented);
+    trans_A = rocsparse_operation_none;
+
+    // Only general matrices are supported
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(local_descrB, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrgemm_nnz_estimate(PARAMS),
+                            rocsparse_status_not_implemented);
+
+#undef PARAMS
+}
+
+template <typename T>
+void testing_csrgemm_nnz_estimate(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         N         = arg.N;
+    rocsparse_int         K         = arg.K;
+    rocsparse_operation   transA    = arg.transA;
+    rocsparse_operation   transB    = arg.transB;
+    rocsparse_index_base  baseA     = arg.baseA;
+    rocsparse_index_base  baseB     = arg.baseB;
+    static constexpr bool full_rank = false;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descrA;
+    rocsparse_local_mat_descr descrB;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrB, baseB));
+
+    int64_t hnnz_products;
+    int64_t hnnz_C;
+    int64_t hnnz_C_lower;
+    int64_t hnnz_C_upper;
+
+#define PARAMS(nnz_products_, nnz_C_, nnz_C_lower_, nnz_C_upper_)                                  \
+    handle, transA, transB, M, N, K, descrA, nnz_A, dcsr_row_ptr_A, dcsr_col_ind_A, descrB, nnz_B, \
+        dcsr_row_ptr_B, dcsr_col_ind_B, sample_size, nnz_products_, nnz_C_, nnz_C_lower_,          \
+        nnz_C_upper_
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr_A(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_A(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_B(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_B(safe_size);
+
+        if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_row_ptr_B || !dcsr_col_ind_B)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        rocsparse_int nnz_A       = safe_size;
+        rocsparse_int nnz_B       = safe_size;
+        rocsparse_int sample_size = safe_size;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrgemm_nnz_estimate(
+                PARAMS(&hnnz_products, &hnnz_C, &hnnz_C_lower, &hnnz_C_upper)),
+            (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrices
+    host_vector<rocsparse_int> hcsr_row_ptr_A;
+    host_vector<rocsparse_int> hcsr_col_ind_A;
+    host_vector<T>             hcsr_val_A;
+    host_vector<rocsparse_int> hcsr_row_ptr_B;
+    host_vector<rocsparse_int> hcsr_col_ind_B;
+    host_vector<T>             hcsr_val_B;
+
+    // Sample matrix
+    rocsparse_int nnz_A = 4;
+    rocsparse_int nnz_B = 4;
+
+    rocsparse_matrix_factory<T> matrix_factory(arg, arg.timing ? false : true, full_rank);
+    matrix_factory.init_csr(hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, M, K, nnz_A, baseA);
+
+    rocsparse_matrix_factory_random<T> matrix_factory_random(full_rank);
+    matrix_factory_random.init_csr(hcsr_row_ptr_B, hcsr_col_ind_B, hcsr_val_B, K, N, nnz_B, baseB);
+
+    // Number of sampled rows, given as percentage of all rows
+    double        percentage  = arg.get_percentage<double>();
+    rocsparse_int sample_size = static_cast<rocsparse_int>(percentage / 100.0 * M);
+
+    sample_size = std::max(sample_size, static_cast<rocsparse_int>(1));
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr_A(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_A(nnz_A);
+    device_vector<rocsparse_int> dcsr_row_ptr_B(K + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_B(nnz_B);
+    device_vector<int64_t>       dnnz_C(4);
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_row_ptr_B || !dcsr_col_ind_B || !dnnz_C)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_A, hcsr_row_ptr_A, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_A, hcsr_col_ind_A, sizeof(rocsparse_int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_B, hcsr_row_ptr_B, sizeof(rocsparse_int) * (K + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_B, hcsr_col_ind_B, sizeof(rocsparse_int) * nnz_B, hipMemcpyHostToDevice));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz_estimate(
+            PARAMS(&hnnz_products, &hnnz_C, &hnnz_C_lower, &hnnz_C_upper)));
+
+        // Pointer mode device
+        host_vector<int64_t> hnnz_C_2(4);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz_estimate(
+            PARAMS(dnnz_C + 0, dnnz_C + 1, dnnz_C + 2, dnnz_C + 3)));
+
+        CHECK_HIP_ERROR(hipMemcpy(hnnz_C_2, dnnz_C, sizeof(int64_t) * 4, hipMemcpyDeviceToHost));
+
+        // CPU estimate
+        int64_t hnnz_products_gold;
+        int64_t hnnz_C_gold;
+        int64_t hnnz_C_lower_gold;
+        int64_t hnnz_C_upper_gold;
+
+        host_csrgemm_nnz_estimate<rocsparse_int, rocsparse_int>(M,
+                                                                N,
+                                                                sample_size,
+                                                                hcsr_row_ptr_A,
+                                                                hcsr_col_ind_A,
+                                                                hcsr_row_ptr_B,
+                                                                hcsr_col_ind_B,
+                                                                baseA,
+                                                                baseB,
+                                                                &hnnz_products_gold,
+                                                                &hnnz_C_gold,
+                                                                &hnnz_C_lower_gold,
+                                                                &hnnz_C_upper_gold);
+
+        // The number of intermediate products is exact
+        unit_check_general<int64_t>(1, 1, 1, &hnnz_products_gold, &hnnz_products);
+        unit_check_general<int64_t>(1, 1, 1, &hnnz_products_gold, &hnnz_C_2[0]);
+
+        // Estimates may differ slightly for rows that are counted probabilistically
+        double hnnz_C_gold_fp[3] = {static_cast<double>(hnnz_C_gold),
+                                    static_cast<double>(hnnz_C_lower_gold),
+                                    static_cast<double>(hnnz_C_upper_gold)};
+
+        double hnnz_C_1_fp[3] = {static_cast<double>(hnnz_C),
+                                 static_cast<double>(hnnz_C_lower),
+                                 static_cast<double>(hnnz_C_upper)};
+
+        double hnnz_C_2_fp[3] = {static_cast<double>(hnnz_C_2[1]),
+                                 static_cast<double>(hnnz_C_2[2]),
+                                 static_cast<double>(hnnz_C_2[3])};
+
+        near_check_general<double>(
+            1, 3, 1, hnnz_C_gold_fp, hnnz_C_1_fp, default_tolerance<float>::value);
+        near_check_general<double>(
+            1, 3, 1, hnnz_C_gold_fp, hnnz_C_2_fp, default_tolerance<float>::value);
+
+        // Exact number of non-zero entries of C
+        T             h_alpha = static_cast<T>(1);
+        rocsparse_int hnnz_C_exact;
+
+        host_vector<rocsparse_int> hcsr_row_ptr_C(M + 1);
+        host_vector<rocsparse_int> hcsr_row_ptr_D;
+        host_vector<rocsparse_int> hcsr_col_ind_D;
+
+        host_csrgemm_nnz(M,
+                         N,
+                         K,
+                         &h_alpha,
+                         hcsr_row_ptr_A,
+                         hcsr_col_ind_A,
+                         hcsr_row_ptr_B,
+                         hcsr_col_ind_B,
+                         (const T*)nullptr,
+                         hcsr_row_ptr_D,
+                         hcsr_col_ind_D,
+                         hcsr_row_ptr_C,
+                         &hnnz_C_exact,
+                         baseA,
+                         baseB,
+                         rocsparse_index_base_zero,
+                         rocsparse_index_base_zero);
+
+        // Rows with more than 2048 intermediate products are counted probabilistically
+        bool exact_count = true;
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            int64_t nprod = 0;
+
+            for(rocsparse_int j = hcsr_row_ptr_A[i] - baseA; j < hcsr_row_ptr_A[i + 1] - baseA;
+                ++j)
+            {
+                rocsparse_int col_A = hcsr_col_ind_A[j] - baseA;
+
+                nprod += hcsr_row_ptr_B[col_A + 1] - hcsr_row_ptr_B[col_A];
+            }
+
+            exact_count = exact_count && (nprod <= 2048);
+        }
+
+        int64_t hnnz_C_exact_64 = hnnz_C_exact;
+        double  hnnz_C_exact_fp = static_cast<double>(hnnz_C_exact);
+
+        if(sample_size >= M && exact_count)
+        {
+            // All rows are sampled and counted exactly, thus the estimate is exact
+            unit_check_general<int64_t>(1, 1, 1, &hnnz_C_exact_64, &hnnz_C);
+            unit_check_general<int64_t>(1, 1, 1, &hnnz_C_exact_64, &hnnz_C_lower);
+            unit_check_general<int64_t>(1, 1, 1, &hnnz_C_exact_64, &hnnz_C_upper);
+        }
+        else if(sample_size >= M)
+        {
+            // All rows are sampled. The linear counting of rows with many intermediate
+            // products has a relative standard error well below 1% for at most 65536
+            // columns, a relative error of 1% is accepted.
+            EXPECT_LE(std::abs(hnnz_C - hnnz_C_exact_64), 1e-2 * hnnz_C_exact_fp);
+        }
+        else if(arg.matrix == rocsparse_matrix_random && sample_size >= 100)
+        {
+            // The rows of the random matrices are statistically alike, such that a
+            // sample of at least 100 rows estimates nnz(C) with a relative error below
+            // 25%. The 95% confidence interval is not guaranteed to contain the exact
+            // value, only the estimate itself.
+            EXPECT_LE(std::abs(hnnz_C - hnnz_C_exact_64), 0.25 * hnnz_C_exact_fp);
+
+            EXPECT_LE(hnnz_C_lower, hnnz_C);
+            EXPECT_LE(hnnz_C, hnnz_C_upper);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz_estimate(
+                PARAMS(&hnnz_products, &hnnz_C, &hnnz_C_lower, &hnnz_C_upper)));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz_estimate(
+                PARAMS(&hnnz_products, &hnnz_C, &hnnz_C_lower, &hnnz_C_upper)));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "N" << std::setw(12) << "K"
+                  << std::setw(12) << "nnz_A" << std::setw(12) << "nnz_B" << std::setw(12)
+                  << "samples" << std::setw(16) << "products" << std::setw(16) << "nnz_C"
+                  << std::setw(16) << "nnz_C_lower" << std::setw(16) << "nnz_C_upper"
+                  << std::setw(16) << "msec" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << N << std::setw(12) << K
+                  << std::setw(12) << nnz_A << std::setw(12) << nnz_B << std::setw(12)
+                  << sample_size << std::setw(16) << hnnz_products << std::setw(16) << hnnz_C
+                  << std::setw(16) << hnnz_C_lower << std::setw(16) << hnnz_C_upper
+                  << std::setw(16) << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+#undef PARAMS
+}
+
+#define INSTANTIATE(TYPE)                                                           \
+    template void testing_csrgemm_nnz_estimate_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrgemm_nnz_estimate<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
@@ -0,0 +1,543 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "testing_csriluk.hpp"
+
+template <typename T>
+void testing_csriluk_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle         = local_handle;
+    rocsparse_int             m              = safe_size;
+    rocsparse_int             nnz            = safe_size;
+    const rocsparse_mat_descr descr          = local_descr;
+    const T*                  csr_val        = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr    = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind    = (const rocsparse_int*)0x4;
+    rocsparse_int             level_of_fill  = 1;
+    rocsparse_int             nnz_lu         = safe_size;
+    rocsparse_int*            nnz_lu_ptr     = (rocsparse_int*)0x4;
+    T*                        csr_val_lu     = (T*)0x4;
+    rocsparse_int*            csr_row_ptr_lu = (rocsparse_int*)0x4;
+    rocsparse_int*            csr_col_ind_lu = (rocsparse_int*)0x4;
+    rocsparse_mat_info        info           = local_info;
+    rocsparse_solve_policy    policy         = rocsparse_solve_policy_auto;
+    void*                     temp_buffer    = (void*)0x4;
+
+#define PARAMS_NNZ                                                                        \
+    handle, m, nnz, descr, csr_row_ptr, csr_col_ind, level_of_fill, info, csr_row_ptr_lu, \
+        nnz_lu_ptr
+
+#define PARAMS_SYMBOLIC \
+    handle, m, nnz, descr, csr_row_ptr, csr_col_ind, level_of_fill, info, csr_col_ind_lu
+
+#define PARAMS                                                                    \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, nnz_lu, csr_val_lu, \
+        csr_row_ptr_lu, csr_col_ind_lu, info, policy, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csriluk_nnz, PARAMS_NNZ);
+    auto_testing_bad_arg(rocsparse_csriluk_symbolic, PARAMS_SYMBOLIC);
+    auto_testing_bad_arg(rocsparse_csriluk<T>, PARAMS);
+
+    // The pattern of the factorization cannot have less entries than A
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                 m,
+                                                 nnz,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 nnz - 1,
+                                                 csr_val_lu,
+                                                 csr_row_ptr_lu,
+                                                 csr_col_ind_lu,
+                                                 info,
+                                                 policy,
+                                                 temp_buffer),
+                            rocsparse_status_invalid_size);
+
+    // Numeric factorization requires the analysis of the pattern
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(PARAMS), rocsparse_status_invalid_pointer);
+
+    // Only general matrices are supported
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(PARAMS_NNZ), rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_symbolic(PARAMS_SYMBOLIC),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(PARAMS), rocsparse_status_not_implemented);
+
+#undef PARAMS
+#undef PARAMS_SYMBOLIC
+#undef PARAMS_NNZ
+}
+
+template <typename T>
+void testing_csriluk(const Arguments& arg)
+{
+    rocsparse_int M = arg.M;
+    rocsparse_int N = arg.N;
+
+    rocsparse_int             level_of_fill = arg.fill_level;
+    rocsparse_analysis_policy apol          = arg.apol;
+    rocsparse_solve_policy    spol          = arg.spol;
+    rocsparse_index_base      base          = arg.baseA;
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        rocsparse_int       nnz_lu;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_nnz(handle,
+                                                      M,
+                                                      safe_size,
+                                                      descr,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      level_of_fill,
+                                                      info,
+                                                      dcsr_row_ptr,
+                                                      &nnz_lu),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk_symbolic(handle,
+                                                           M,
+                                                           safe_size,
+                                                           descr,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           level_of_fill,
+                                                           info,
+                                                           dcsr_col_ind),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csriluk<T>(handle,
+                                                     M,
+                                                     safe_size,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     safe_size,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     info,
+                                                     spol,
+                                                     dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dlu_row_ptr(M + 1);
+    device_vector<rocsparse_int> dnnz_lu(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dlu_row_ptr || !dnnz_lu)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Symbolic factorization
+    rocsparse_int nnz_lu;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_nnz(handle,
+                                                M,
+                                                nnz,
+                                                descr,
+                                                dcsr_row_ptr,
+                                                dcsr_col_ind,
+                                                level_of_fill,
+                                                info,
+                                                dlu_row_ptr,
+                                                &nnz_lu));
+
+    device_vector<rocsparse_int> dlu_col_ind(nnz_lu);
+    device_vector<T>             dlu_val_1(nnz_lu);
+    device_vector<T>             dlu_val_2(nnz_lu);
+
+    if(!dlu_col_ind || !dlu_val_1 || !dlu_val_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic(
+        handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, level_of_fill, info, dlu_col_ind));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size<T>(
+        handle, M, nnz_lu, descr, dlu_val_1, dlu_row_ptr, dlu_col_ind, info, &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Analysis of the pattern of the factorization
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<T>(handle,
+                                                        M,
+                                                        nnz_lu,
+                                                        descr,
+                                                        dlu_val_1,
+                                                        dlu_row_ptr,
+                                                        dlu_col_ind,
+                                                        info,
+                                                        apol,
+                                                        spol,
+                                                        dbuffer));
+
+    // CPU symbolic factorization
+    host_vector<rocsparse_int> hlu_row_ptr_gold;
+    host_vector<rocsparse_int> hlu_col_ind_gold;
+
+    host_csriluk_symbolic(
+        M, hcsr_row_ptr, hcsr_col_ind, base, level_of_fill, hlu_row_ptr_gold, hlu_col_ind_gold);
+
+    rocsparse_int nnz_lu_gold = hlu_row_ptr_gold[M] - base;
+
+    host_vector<rocsparse_int> h_analysis_pivot_1(1);
+    host_vector<rocsparse_int> h_analysis_pivot_gold(1);
+    host_vector<rocsparse_int> h_solve_pivot_1(1);
+    host_vector<rocsparse_int> h_solve_pivot_2(1);
+    host_vector<rocsparse_int> h_solve_pivot_gold(1);
+
+    if(arg.unit_check)
+    {
+        // Symbolic factorization, pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_nnz(handle,
+                                                    M,
+                                                    nnz,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    level_of_fill,
+                                                    info,
+                                                    dlu_row_ptr,
+                                                    dnnz_lu));
+
+        // Copy pattern to host
+        rocsparse_int              hnnz_lu_2;
+        host_vector<rocsparse_int> hlu_row_ptr(M + 1);
+        host_vector<rocsparse_int> hlu_col_ind(nnz_lu);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hnnz_lu_2, dnnz_lu, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hlu_row_ptr, dlu_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyDeviceToHost));
+
+        // Check pattern
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnz_lu_gold, &nnz_lu);
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnz_lu_gold, &hnnz_lu_2);
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hlu_row_ptr_gold, hlu_row_ptr);
+
+        // Column indices that have been kept by rocsparse_csriluk_nnz
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic(
+            handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, level_of_fill, info, dlu_col_ind));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hlu_col_ind, dlu_col_ind, sizeof(rocsparse_int) * nnz_lu, hipMemcpyDeviceToHost));
+        unit_check_general<rocsparse_int>(1, nnz_lu, 1, hlu_col_ind_gold, hlu_col_ind);
+
+        // Column indices without preceding rocsparse_csriluk_nnz are computed again
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic(
+            handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, level_of_fill, info, dlu_col_ind));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hlu_col_ind, dlu_col_ind, sizeof(rocsparse_int) * nnz_lu, hipMemcpyDeviceToHost));
+        unit_check_general<rocsparse_int>(1, nnz_lu, 1, hlu_col_ind_gold, hlu_col_ind);
+
+        // Numeric factorization, pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_zero_pivot(handle, info, h_analysis_pivot_1),
+                                (h_analysis_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                              : rocsparse_status_success);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk<T>(handle,
+                                                   M,
+                                                   nnz,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   nnz_lu,
+                                                   dlu_val_1,
+                                                   dlu_row_ptr,
+                                                   dlu_col_ind,
+                                                   info,
+                                                   spol,
+                                                   dbuffer));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_zero_pivot(handle, info, h_solve_pivot_1),
+                                (h_solve_pivot_1[0] != -1) ? rocsparse_status_zero_pivot
+                                                           : rocsparse_status_success);
+
+        // Sync to force updated pivots
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Refactorization, reusing the symbolic factorization and the analysis
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk<T>(handle,
+                                                   M,
+                                                   nnz,
+                                                   descr,
+                                                   dcsr_val,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   nnz_lu,
+                                                   dlu_val_2,
+                                                   dlu_row_ptr,
+                                                   dlu_col_ind,
+                                                   info,
+                                                   spol,
+                                                   dbuffer));
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilu0_zero_pivot(handle, info, h_solve_pivot_2),
+                                (h_solve_pivot_2[0] != -1) ? rocsparse_status_zero_pivot
+                                                           : rocsparse_status_success);
+
+        // Sync to force updated pivots
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+        // Copy output to host
+        host_vector<T> hlu_val_1(nnz_lu);
+        host_vector<T> hlu_val_2(nnz_lu);
+
+        CHECK_HIP_ERROR(hipMemcpy(hlu_val_1, dlu_val_1, sizeof(T) * nnz_lu, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hlu_val_2, dlu_val_2, sizeof(T) * nnz_lu, hipMemcpyDeviceToHost));
+
+        // CPU csriluk, copy A into the pattern of the factorization
+        host_vector<T> hlu_val_gold(nnz_lu_gold, static_cast<T>(0));
+
+        for(rocsparse_int i = 0; i < M; ++i)
+        {
+            rocsparse_int k = hlu_row_ptr_gold[i] - base;
+
+            for(rocsparse_int j = hcsr_row_ptr[i] - base; j < hcsr_row_ptr[i + 1] - base; ++j)
+            {
+                while(hlu_col_ind_gold[k] != hcsr_col_ind[j])
+                {
+                    ++k;
+                }
+
+                hlu_val_gold[k] = hcsr_val[j];
+            }
+        }
+
+        T h_boost_tol = static_cast<T>(0);
+        T h_boost_val = static_cast<T>(0);
+
+        host_csrilu0<T>(M,
+                        hlu_row_ptr_gold,
+                        hlu_col_ind_gold,
+                        hlu_val_gold,
+                        base,
+                        h_analysis_pivot_gold,
+                        h_solve_pivot_gold,
+                        false,
+                        *get_boost_tol(&h_boost_tol),
+                        h_boost_val);
+
+        // Check pivots
+        unit_check_general<rocsparse_int>(1, 1, 1, h_analysis_pivot_gold, h_analysis_pivot_1);
+        unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_1);
+        unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot_2);
+
+        // Check factorization if no pivot has been found
+        if(h_analysis_pivot_gold[0] == -1 && h_solve_pivot_gold[0] == -1)
+        {
+            near_check_general<T>(1, nnz_lu, 1, hlu_val_gold, hlu_val_1);
+            near_check_general<T>(1, nnz_lu, 1, hlu_val_gold, hlu_val_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csriluk<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       nnz_lu,
+                                                       dlu_val_1,
+                                                       dlu_row_ptr,
+                                                       dlu_col_ind,
+                                                       info,
+                                                       spol,
+                                                       dbuffer));
+        }
+
+        double gpu_symbolic_time_used = get_time_us();
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_nnz(handle,
+                                                    M,
+                                                    nnz,
+                                                    descr,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    level_of_fill,
+                                                    info,
+                                                    dlu_row_ptr,
+                                                    &nnz_lu));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csriluk_symbolic(
+            handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, level_of_fill, info, dlu_col_ind));
+
+        gpu_symbolic_time_used = get_time_us() - gpu_symbolic_time_used;
+
+        double gpu_numeric_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csriluk<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       nnz_lu,
+                                                       dlu_val_1,
+                                                       dlu_row_ptr,
+                                                       dlu_col_ind,
+                                                       info,
+                                                       spol,
+                                                       dbuffer));
+        }
+
+        gpu_numeric_time_used = (get_time_us() - gpu_numeric_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csriluk_gbyte_count<T>(M, nnz, nnz_lu) / gpu_numeric_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "nnz_lu"
+                  << std::setw(12) << "fill_level" << std::setw(16) << "solve policy"
+                  << std::setw(12) << "GB/s" << std::setw(16) << "symbolic msec" << std::setw(16)
+                  << "numeric msec" << std::setw(12) << "iter" << std::setw(12) << "verified"
+                  << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nnz_lu
+                  << std::setw(12) << level_of_fill << std::setw(16)
+                  << rocsparse_solve2string(spol) << std::setw(12) << gpu_gbyte << std::setw(16)
+                  << gpu_symbolic_time_used / 1e3 << std::setw(16) << gpu_numeric_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Clear csrilu0 meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info));
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_csriluk_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csriluk<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,502 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "testing_csrilut.hpp"
+
+template <typename T>
+void testing_csrilut_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle         = local_handle;
+    rocsparse_int             m              = safe_size;
+    rocsparse_int             nnz            = safe_size;
+    const rocsparse_mat_descr descr          = local_descr;
+    const T*                  csr_val        = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr    = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind    = (const rocsparse_int*)0x4;
+    rocsparse_mat_info        info           = local_info;
+    floating_data_t<T>        tol            = static_cast<floating_data_t<T>>(0.01);
+    rocsparse_int             max_fill       = 1;
+    rocsparse_int*            csr_row_ptr_lu = (rocsparse_int*)0x4;
+    rocsparse_int*            csr_col_ind_lu = (rocsparse_int*)0x4;
+    T*                        csr_val_lu     = (T*)0x4;
+    rocsparse_int*            nnz_lu         = (rocsparse_int*)0x4;
+    size_t*                   buffer_size    = (size_t*)0x4;
+    void*                     temp_buffer    = (void*)0x4;
+
+#define PARAMS_NNZ handle, m, max_fill, nnz_lu
+
+#define PARAMS_BUFFER_SIZE \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, max_fill, buffer_size
+
+#define PARAMS                                                                     \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, tol, max_fill, \
+        csr_row_ptr_lu, csr_col_ind_lu, csr_val_lu, temp_buffer
+
+    // The drop tolerance is checked separately
+    static const int nex   = 1;
+    static const int ex[1] = {8};
+
+    auto_testing_bad_arg(rocsparse_csrilut_nnz, PARAMS_NNZ);
+    auto_testing_bad_arg(rocsparse_csrict_nnz, PARAMS_NNZ);
+    auto_testing_bad_arg(rocsparse_csrilut_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csrilut<T, floating_data_t<T>>, nex, ex, PARAMS);
+    auto_testing_bad_arg(rocsparse_csrict<T, floating_data_t<T>>, nex, ex, PARAMS);
+
+    // The threshold factorizations require the analysis of the matrix
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(PARAMS), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrict<T>(PARAMS), rocsparse_status_invalid_pointer);
+
+    // The drop tolerance must be non-negative
+    tol = static_cast<floating_data_t<T>>(-1);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(PARAMS), rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrict<T>(PARAMS), rocsparse_status_invalid_value);
+    tol = static_cast<floating_data_t<T>>(0.01);
+
+    // Only general matrices are supported
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(PARAMS), rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrict<T>(PARAMS), rocsparse_status_not_implemented);
+
+#undef PARAMS
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_NNZ
+}
+
+template <typename T>
+void testing_csrilut(const Arguments& arg)
+{
+    typedef floating_data_t<T> U;
+
+    rocsparse_int M = arg.M;
+    rocsparse_int N = arg.N;
+
+    rocsparse_int             max_fill = arg.fill_level;
+    U                         tol      = static_cast<U>(arg.get_threshold<T>());
+    rocsparse_analysis_policy apol     = arg.apol;
+    rocsparse_solve_policy    spol     = arg.spol;
+    rocsparse_index_base      base     = arg.baseA;
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info, the zero pivot is stored per info structure
+    rocsparse_local_mat_info info_ilu;
+    rocsparse_local_mat_info info_ic;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              buffer_size;
+        rocsparse_int       nnz_lu;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dlu_row_ptr(safe_size);
+        device_vector<rocsparse_int> dlu_col_ind(safe_size);
+        device_vector<T>             dlu_val(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dlu_row_ptr || !dlu_col_ind || !dlu_val
+           || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_nnz(handle, M, max_fill, &nnz_lu),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut_buffer_size<T>(handle,
+                                                                 M,
+                                                                 safe_size,
+                                                                 descr,
+                                                                 dcsr_val,
+                                                                 dcsr_row_ptr,
+                                                                 dcsr_col_ind,
+                                                                 max_fill,
+                                                                 &buffer_size),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrilut<T>(handle,
+                                                     M,
+                                                     safe_size,
+                                                     descr,
+                                                     dcsr_val,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     info_ilu,
+                                                     tol,
+                                                     max_fill,
+                                                     dlu_row_ptr,
+                                                     dlu_col_ind,
+                                                     dlu_val,
+                                                     dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrict<T>(handle,
+                                                    M,
+                                                    safe_size,
+                                                    descr,
+                                                    dcsr_val,
+                                                    dcsr_row_ptr,
+                                                    dcsr_col_ind,
+                                                    info_ic,
+                                                    tol,
+                                                    max_fill,
+                                                    dlu_row_ptr,
+                                                    dlu_col_ind,
+                                                    dlu_val,
+                                                    dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // Upper bound of the factors, available before the factorization
+    rocsparse_int nnz_lu;
+    rocsparse_int nnz_l;
+
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilut_nnz(handle, M, max_fill, &nnz_lu));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrict_nnz(handle, M, max_fill, &nnz_l));
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dlu_row_ptr(M + 1);
+    device_vector<rocsparse_int> dlu_col_ind(nnz_lu);
+    device_vector<T>             dlu_val(nnz_lu);
+    device_vector<rocsparse_int> dl_row_ptr(M + 1);
+    device_vector<rocsparse_int> dl_col_ind(nnz_l);
+    device_vector<T>             dl_val(nnz_l);
+    device_vector<rocsparse_int> dnnz_lu(2);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dlu_row_ptr || !dlu_col_ind || !dlu_val
+       || !dl_row_ptr || !dl_col_ind || !dl_val || !dnnz_lu)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size, the buffer is shared with the analysis
+    size_t buffer_size;
+    size_t buffer_size_ilu0;
+    size_t buffer_size_ic0;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilut_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, max_fill, &buffer_size));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info_ilu, &buffer_size_ilu0));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info_ic, &buffer_size_ic0));
+
+    buffer_size = std::max(buffer_size, std::max(buffer_size_ilu0, buffer_size_ic0));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<T>(handle,
+                                                        M,
+                                                        nnz,
+                                                        descr,
+                                                        dcsr_val,
+                                                        dcsr_row_ptr,
+                                                        dcsr_col_ind,
+                                                        info_ilu,
+                                                        apol,
+                                                        spol,
+                                                        dbuffer));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_analysis<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info_ic, apol, spol, dbuffer));
+
+    if(arg.unit_check)
+    {
+        // Pointer mode device for the upper bound of the factors
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrilut_nnz(handle, M, max_fill, dnnz_lu));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrict_nnz(handle, M, max_fill, dnnz_lu + 1));
+
+        host_vector<rocsparse_int> hnnz_lu(2);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hnnz_lu, dnnz_lu, sizeof(rocsparse_int) * 2, hipMemcpyDeviceToHost));
+
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnz_lu, &hnnz_lu[0]);
+        unit_check_general<rocsparse_int>(1, 1, 1, &nnz_l, &hnnz_lu[1]);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(int ichol = 0; ichol < 2; ++ichol)
+        {
+            rocsparse_mat_info info_it = ichol ? info_ic : info_ilu;
+
+            rocsparse_int* drow_ptr = ichol ? dl_row_ptr : dlu_row_ptr;
+            rocsparse_int* dcol_ind = ichol ? dl_col_ind : dlu_col_ind;
+            T*             dval     = ichol ? dl_val : dlu_val;
+
+            // CPU threshold factorization
+            std::vector<rocsparse_int> hlu_row_ptr_gold;
+            std::vector<rocsparse_int> hlu_col_ind_gold;
+            std::vector<T>             hlu_val_gold;
+            rocsparse_int              h_analysis_pivot_gold;
+            rocsparse_int              h_solve_pivot_gold;
+
+            host_csrilut<T, U>(M,
+                               hcsr_row_ptr,
+                               hcsr_col_ind,
+                               hcsr_val,
+                               base,
+                               ichol,
+                               tol,
+                               max_fill,
+                               false,
+                               static_cast<U>(0),
+                               static_cast<T>(0),
+                               hlu_row_ptr_gold,
+                               hlu_col_ind_gold,
+                               hlu_val_gold,
+                               &h_analysis_pivot_gold,
+                               &h_solve_pivot_gold);
+
+            // Threshold factorization
+            if(ichol)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrict<T>(handle,
+                                                          M,
+                                                          nnz,
+                                                          descr,
+                                                          dcsr_val,
+                                                          dcsr_row_ptr,
+                                                          dcsr_col_ind,
+                                                          info_it,
+                                                          tol,
+                                                          max_fill,
+                                                          drow_ptr,
+                                                          dcol_ind,
+                                                          dval,
+                                                          dbuffer));
+            }
+            else
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrilut<T>(handle,
+                                                           M,
+                                                           nnz,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           info_it,
+                                                           tol,
+                                                           max_fill,
+                                                           drow_ptr,
+                                                           dcol_ind,
+                                                           dval,
+                                                           dbuffer));
+            }
+
+            host_vector<rocsparse_int> h_solve_pivot(1);
+
+            auto zero_pivot = ichol ? rocsparse_csric0_zero_pivot : rocsparse_csrilu0_zero_pivot;
+
+            EXPECT_ROCSPARSE_STATUS(zero_pivot(handle, info_it, h_solve_pivot),
+                                    (h_solve_pivot[0] != -1) ? rocsparse_status_zero_pivot
+                                                             : rocsparse_status_success);
+
+            // Check pivot
+            unit_check_general<rocsparse_int>(1, 1, 1, &h_solve_pivot_gold, h_solve_pivot);
+
+            // Copy output to host
+            host_vector<rocsparse_int> hlu_row_ptr(M + 1);
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                hlu_row_ptr, drow_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyDeviceToHost));
+
+            // Check factorization if no pivot has been found
+            if(h_solve_pivot_gold == -1)
+            {
+                rocsparse_int nnz_fact = hlu_row_ptr[M] - base;
+
+                host_vector<rocsparse_int> hlu_col_ind(nnz_fact);
+                host_vector<T>             hlu_val(nnz_fact);
+
+                CHECK_HIP_ERROR(hipMemcpy(hlu_col_ind,
+                                          dcol_ind,
+                                          sizeof(rocsparse_int) * nnz_fact,
+                                          hipMemcpyDeviceToHost));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(hlu_val, dval, sizeof(T) * nnz_fact, hipMemcpyDeviceToHost));
+
+                unit_check_general<rocsparse_int>(
+                    1, M + 1, 1, hlu_row_ptr_gold.data(), hlu_row_ptr);
+                unit_check_general<rocsparse_int>(
+                    1, nnz_fact, 1, hlu_col_ind_gold.data(), hlu_col_ind);
+                near_check_general<T>(1, nnz_fact, 1, hlu_val_gold.data(), hlu_val);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrilut<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       info_ilu,
+                                                       tol,
+                                                       max_fill,
+                                                       dlu_row_ptr,
+                                                       dlu_col_ind,
+                                                       dlu_val,
+                                                       dbuffer));
+        }
+
+        double gpu_time_used = 0;
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            double gpu_time_start = get_time_us();
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrilut<T>(handle,
+                                                       M,
+                                                       nnz,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       info_ilu,
+                                                       tol,
+                                                       max_fill,
+                                                       dlu_row_ptr,
+                                                       dlu_col_ind,
+                                                       dlu_val,
+                                                       dbuffer));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            gpu_time_used += get_time_us() - gpu_time_start;
+        }
+
+        gpu_time_used /= number_hot_calls;
+
+        // Actual number of non-zero entries of the factorization
+        rocsparse_int nnz_fact;
+        CHECK_HIP_ERROR(
+            hipMemcpy(&nnz_fact, dlu_row_ptr + M, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        nnz_fact -= base;
+
+        double gpu_gbyte = csrilut_gbyte_count<T>(M, nnz, nnz_fact) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "nnz_lu"
+                  << std::setw(12) << "max_fill" << std::setw(12) << "tol" << std::setw(12)
+                  << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nnz_fact
+                  << std::setw(12) << max_fill << std::setw(12) << tol << std::setw(12)
+                  << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << std::endl;
+    }
+
+    // Clear csrilu0 and csric0 meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info_ilu));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_clear(handle, info_ic));
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                              \
+    template void testing_csrilut_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrilut<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,428 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "testing_csritilu0.hpp"
+
+template <typename T>
+void testing_csritilu0_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info local_info;
+
+    rocsparse_handle          handle      = local_handle;
+    rocsparse_int             m           = safe_size;
+    rocsparse_int             nnz         = safe_size;
+    const rocsparse_mat_descr descr       = local_descr;
+    T*                        csr_val     = (T*)0x4;
+    const rocsparse_int*      csr_row_ptr = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind = (const rocsparse_int*)0x4;
+    rocsparse_mat_info        info        = local_info;
+    rocsparse_int             nsweeps     = 1;
+    floating_data_t<T>*       history     = (floating_data_t<T>*)0x4;
+    size_t*                   buffer_size = (size_t*)0x4;
+    void*                     temp_buffer = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size
+
+#define PARAMS \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, info, nsweeps, history, temp_buffer
+
+    // The convergence history is optional
+    static const int nex   = 1;
+    static const int ex[1] = {9};
+
+    auto_testing_bad_arg(rocsparse_csritilu0_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csritilu0<T, floating_data_t<T>>, nex, ex, PARAMS);
+    auto_testing_bad_arg(rocsparse_csritic0<T, floating_data_t<T>>, nex, ex, PARAMS);
+
+    // The iterative factorizations require the analysis of the matrix
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csritilu0<T>(PARAMS), rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csritic0<T>(PARAMS), rocsparse_status_invalid_pointer);
+
+    // Only general matrices are supported
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csritilu0_buffer_size<T>(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csritilu0<T>(PARAMS), rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csritic0<T>(PARAMS), rocsparse_status_not_implemented);
+
+#undef PARAMS
+#undef PARAMS_BUFFER_SIZE
+}
+
+template <typename T>
+void testing_csritilu0(const Arguments& arg)
+{
+    typedef floating_data_t<T> U;
+
+    rocsparse_int M = arg.M;
+    rocsparse_int N = arg.N;
+
+    rocsparse_int             nsweeps = arg.nsweeps;
+    rocsparse_analysis_policy apol    = arg.apol;
+    rocsparse_solve_policy    spol    = arg.spol;
+    rocsparse_index_base      base    = arg.baseA;
+
+    const bool                  to_int    = arg.timing ? false : true;
+    static constexpr bool       full_rank = true;
+    rocsparse_matrix_factory<T> matrix_factory(arg, to_int, full_rank);
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+        size_t              buffer_size;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<U>             dhistory(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dhistory || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csritilu0_buffer_size<T>(handle,
+                                                                   M,
+                                                                   safe_size,
+                                                                   descr,
+                                                                   dcsr_val,
+                                                                   dcsr_row_ptr,
+                                                                   dcsr_col_ind,
+                                                                   &buffer_size),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csritilu0<T>(handle,
+                                                       M,
+                                                       safe_size,
+                                                       descr,
+                                                       dcsr_val,
+                                                       dcsr_row_ptr,
+                                                       dcsr_col_ind,
+                                                       info,
+                                                       nsweeps,
+                                                       (U*)dhistory,
+                                                       dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csritic0<T>(handle,
+                                                      M,
+                                                      safe_size,
+                                                      descr,
+                                                      dcsr_val,
+                                                      dcsr_row_ptr,
+                                                      dcsr_col_ind,
+                                                      info,
+                                                      nsweeps,
+                                                      (U*)dhistory,
+                                                      dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<T>             dlu_val(nnz);
+    device_vector<U>             dhistory(std::max(nsweeps, 1));
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dlu_val || !dhistory)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain required buffer size, the buffer is shared with the analysis
+    size_t buffer_size;
+    size_t buffer_size_ilu0;
+    size_t buffer_size_ic0;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info, &buffer_size_ilu0));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csric0_buffer_size<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info, &buffer_size_ic0));
+
+    buffer_size = std::max(buffer_size, std::max(buffer_size_ilu0, buffer_size_ic0));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Analysis
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<T>(
+        handle, M, nnz, descr, dcsr_val, dcsr_row_ptr, dcsr_col_ind, info, apol, spol, dbuffer));
+
+    if(arg.unit_check)
+    {
+        for(int ichol = 0; ichol < 2; ++ichol)
+        {
+            // Separate meta data, the zero pivot is stored per info structure
+            rocsparse_local_mat_info info_it;
+
+            if(ichol)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csric0_analysis<T>(handle,
+                                                                   M,
+                                                                   nnz,
+                                                                   descr,
+                                                                   dcsr_val,
+                                                                   dcsr_row_ptr,
+                                                                   dcsr_col_ind,
+                                                                   info_it,
+                                                                   apol,
+                                                                   spol,
+                                                                   dbuffer));
+            }
+            else
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_analysis<T>(handle,
+                                                                    M,
+                                                                    nnz,
+                                                                    descr,
+                                                                    dcsr_val,
+                                                                    dcsr_row_ptr,
+                                                                    dcsr_col_ind,
+                                                                    info_it,
+                                                                    apol,
+                                                                    spol,
+                                                                    dbuffer));
+            }
+
+            host_vector<rocsparse_int> h_analysis_pivot(1);
+            host_vector<rocsparse_int> h_solve_pivot(1);
+            host_vector<rocsparse_int> h_analysis_pivot_gold(1);
+            host_vector<rocsparse_int> h_solve_pivot_gold(1);
+
+            auto zero_pivot = ichol ? rocsparse_csric0_zero_pivot : rocsparse_csrilu0_zero_pivot;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            EXPECT_ROCSPARSE_STATUS(zero_pivot(handle, info_it, h_analysis_pivot),
+                                    (h_analysis_pivot[0] != -1) ? rocsparse_status_zero_pivot
+                                                                : rocsparse_status_success);
+
+            // Iterative factorization
+            CHECK_HIP_ERROR(hipMemcpy(dlu_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+            if(ichol)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csritic0<T>(handle,
+                                                            M,
+                                                            nnz,
+                                                            descr,
+                                                            dlu_val,
+                                                            dcsr_row_ptr,
+                                                            dcsr_col_ind,
+                                                            info_it,
+                                                            nsweeps,
+                                                            (U*)dhistory,
+                                                            dbuffer));
+            }
+            else
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0<T>(handle,
+                                                             M,
+                                                             nnz,
+                                                             descr,
+                                                             dlu_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             info_it,
+                                                             nsweeps,
+                                                             (U*)dhistory,
+                                                             dbuffer));
+            }
+
+            EXPECT_ROCSPARSE_STATUS(zero_pivot(handle, info_it, h_solve_pivot),
+                                    (h_solve_pivot[0] != -1) ? rocsparse_status_zero_pivot
+                                                             : rocsparse_status_success);
+
+            // Copy output to host
+            host_vector<T> hlu_val(nnz);
+            host_vector<U> hhistory(nsweeps);
+
+            CHECK_HIP_ERROR(hipMemcpy(hlu_val, dlu_val, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hhistory, dhistory, sizeof(U) * nsweeps, hipMemcpyDeviceToHost));
+
+            // CPU iterative factorization
+            host_vector<T> hlu_val_gold(hcsr_val);
+            host_vector<U> hhistory_gold;
+
+            host_csritilu0<T, U>(M,
+                                 hcsr_row_ptr,
+                                 hcsr_col_ind,
+                                 hlu_val_gold,
+                                 base,
+                                 ichol,
+                                 nsweeps,
+                                 hhistory_gold,
+                                 h_analysis_pivot_gold,
+                                 h_solve_pivot_gold);
+
+            // Check pivots
+            unit_check_general<rocsparse_int>(1, 1, 1, h_analysis_pivot_gold, h_analysis_pivot);
+            unit_check_general<rocsparse_int>(1, 1, 1, h_solve_pivot_gold, h_solve_pivot);
+
+            // Check factorization and convergence history if no pivot has been found
+            if(h_analysis_pivot_gold[0] == -1 && h_solve_pivot_gold[0] == -1)
+            {
+                near_check_general<T>(1, nnz, 1, hlu_val_gold, hlu_val);
+                near_check_general<U>(1, nsweeps, 1, hhistory_gold, hhistory);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dlu_val, dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0<T>(handle,
+                                                         M,
+                                                         nnz,
+                                                         descr,
+                                                         dlu_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         info,
+                                                         nsweeps,
+                                                         (U*)nullptr,
+                                                         dbuffer));
+        }
+
+        double gpu_time_used = 0;
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(dlu_val, dcsr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice));
+
+            double gpu_time_start = get_time_us();
+            CHECK_ROCSPARSE_ERROR(rocsparse_csritilu0<T>(handle,
+                                                         M,
+                                                         nnz,
+                                                         descr,
+                                                         dlu_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         info,
+                                                         nsweeps,
+                                                         (U*)nullptr,
+                                                         dbuffer));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            gpu_time_used += get_time_us() - gpu_time_start;
+        }
+
+        gpu_time_used /= number_hot_calls;
+
+        double gpu_gbyte = csritilu0_gbyte_count<T>(M, nnz, nsweeps) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "nsweeps"
+                  << std::setw(12) << "GB/s" << std::setw(12) << "msec" << std::setw(12) << "iter"
+                  << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << nsweeps
+                  << std::setw(12) << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3
+                  << std::setw(12) << number_hot_calls << std::setw(12)
+                  << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Clear csrilu0 meta data
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrilu0_clear(handle, info));
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                \
+    template void testing_csritilu0_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csritilu0<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
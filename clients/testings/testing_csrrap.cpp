@@ -0,0 +1,2448 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_csrrap.hpp"
+
+template <typename T>
+void testing_csrrap_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    T                   h_alpha = 0.6;
+    rocsparse_operation trans_R = rocsparse_operation_none;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descrR;
+    rocsparse_local_mat_descr descrA;
+    rocsparse_local_mat_descr descrP;
+    rocsparse_local_mat_descr descrC;
+
+    // Create matrix info
+    rocsparse_local_mat_info info;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr_R(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_R(safe_size);
+    device_vector<T>             dcsr_val_R(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_A(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_A(safe_size);
+    device_vector<T>             dcsr_val_A(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_P(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_P(safe_size);
+    device_vector<T>             dcsr_val_P(safe_size);
+    device_vector<rocsparse_int> dcsr_row_ptr_C(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind_C(safe_size);
+    device_vector<T>             dcsr_val_C(safe_size);
+    device_vector<T>             dbuffer(safe_size);
+
+    if(!dcsr_row_ptr_R || !dcsr_col_ind_R || !dcsr_val_R || !dcsr_row_ptr_A || !dcsr_col_ind_A
+       || !dcsr_val_A || !dcsr_row_ptr_P || !dcsr_col_ind_P || !dcsr_val_P || !dcsr_row_ptr_C
+       || !dcsr_col_ind_C || !dcsr_val_C || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    size_t        buffer_size;
+    rocsparse_int nnz_C;
+
+    // Test rocsparse_csrrap_buffer_size()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(nullptr,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            nullptr,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            nullptr,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            nullptr,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            nullptr,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            nullptr,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            nullptr,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            nullptr,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            nullptr,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            nullptr,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            nullptr,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            nullptr,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            -1,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            -1,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            -1,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            -1,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            -1,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            trans_R,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            -1,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_invalid_size);
+
+    // rocsparse_csrrap_nnz() and rocsparse_csrrap() require the plan that is set up by
+    // rocsparse_csrrap_buffer_size(), which reads the patterns of A and P
+    CHECK_HIP_ERROR(hipMemset(dcsr_col_ind_A, 0, sizeof(rocsparse_int) * safe_size));
+    CHECK_HIP_ERROR(hipMemset(dcsr_row_ptr_P, 0, sizeof(rocsparse_int) * safe_size));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_buffer_size<T>(handle,
+                                                          trans_R,
+                                                          safe_size,
+                                                          safe_size,
+                                                          safe_size,
+                                                          &h_alpha,
+                                                          descrR,
+                                                          safe_size,
+                                                          dcsr_row_ptr_R,
+                                                          dcsr_col_ind_R,
+                                                          descrA,
+                                                          safe_size,
+                                                          dcsr_row_ptr_A,
+                                                          dcsr_col_ind_A,
+                                                          descrP,
+                                                          safe_size,
+                                                          dcsr_row_ptr_P,
+                                                          dcsr_col_ind_P,
+                                                          info,
+                                                          &buffer_size));
+
+    // Test rocsparse_csrrap_nnz()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(nullptr,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 nullptr,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 nullptr,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 nullptr,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 nullptr,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 nullptr,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 nullptr,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 nullptr,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 nullptr,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 nullptr,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 nullptr,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 nullptr,
+                                                 dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 -1,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 -1,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 -1,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 -1,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 -1,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 trans_R,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 -1,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_csrrap()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(nullptr,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                nullptr,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                nullptr,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                nullptr,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                nullptr,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                nullptr,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                nullptr,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                nullptr,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                nullptr,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                nullptr,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                nullptr,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                nullptr,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                nullptr,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                nullptr,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                nullptr,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                nullptr,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                nullptr,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                nullptr,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                nullptr,
+                                                dbuffer),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                -1,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                -1,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                -1,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                -1,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                -1,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                trans_R,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                -1,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_size);
+
+    // Conjugate transpose is not supported
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                            rocsparse_operation_conjugate_transpose,
+                                                            safe_size,
+                                                            safe_size,
+                                                            safe_size,
+                                                            &h_alpha,
+                                                            descrR,
+                                                            safe_size,
+                                                            dcsr_row_ptr_R,
+                                                            dcsr_col_ind_R,
+                                                            descrA,
+                                                            safe_size,
+                                                            dcsr_row_ptr_A,
+                                                            dcsr_col_ind_A,
+                                                            descrP,
+                                                            safe_size,
+                                                            dcsr_row_ptr_P,
+                                                            dcsr_col_ind_P,
+                                                            info,
+                                                            &buffer_size),
+                            rocsparse_status_not_implemented);
+
+    // Operation on R has to match the one used in rocsparse_csrrap_buffer_size()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                 rocsparse_operation_transpose,
+                                                 safe_size,
+                                                 safe_size,
+                                                 safe_size,
+                                                 descrR,
+                                                 safe_size,
+                                                 dcsr_row_ptr_R,
+                                                 dcsr_col_ind_R,
+                                                 descrA,
+                                                 safe_size,
+                                                 dcsr_row_ptr_A,
+                                                 dcsr_col_ind_A,
+                                                 descrP,
+                                                 safe_size,
+                                                 dcsr_row_ptr_P,
+                                                 dcsr_col_ind_P,
+                                                 descrC,
+                                                 dcsr_row_ptr_C,
+                                                 &nnz_C,
+                                                 info,
+                                                 dbuffer),
+                            rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                rocsparse_operation_transpose,
+                                                safe_size,
+                                                safe_size,
+                                                safe_size,
+                                                &h_alpha,
+                                                descrR,
+                                                safe_size,
+                                                dcsr_val_R,
+                                                dcsr_row_ptr_R,
+                                                dcsr_col_ind_R,
+                                                descrA,
+                                                safe_size,
+                                                dcsr_val_A,
+                                                dcsr_row_ptr_A,
+                                                dcsr_col_ind_A,
+                                                descrP,
+                                                safe_size,
+                                                dcsr_val_P,
+                                                dcsr_row_ptr_P,
+                                                dcsr_col_ind_P,
+                                                descrC,
+                                                dcsr_val_C,
+                                                dcsr_row_ptr_C,
+                                                dcsr_col_ind_C,
+                                                info,
+                                                dbuffer),
+                            rocsparse_status_invalid_value);
+}
+
+template <typename T>
+void testing_csrrap(const Arguments& arg)
+{
+    rocsparse_int         M         = arg.M;
+    rocsparse_int         N         = arg.N;
+    rocsparse_int         K         = arg.K;
+    rocsparse_operation   trans_R   = arg.transA;
+    rocsparse_index_base  baseR     = arg.baseA;
+    rocsparse_index_base  baseA     = arg.baseB;
+    rocsparse_index_base  baseP     = arg.baseC;
+    rocsparse_index_base  baseC     = arg.baseD;
+    static constexpr bool full_rank = false;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptors
+    rocsparse_local_mat_descr descrR;
+    rocsparse_local_mat_descr descrA;
+    rocsparse_local_mat_descr descrP;
+    rocsparse_local_mat_descr descrC;
+
+    // Create matrix info for C
+    rocsparse_local_mat_info info;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrR, baseR));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrA, baseA));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrP, baseP));
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descrC, baseC));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr_R(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_R(safe_size);
+        device_vector<T>             dcsr_val_R(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_A(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_A(safe_size);
+        device_vector<T>             dcsr_val_A(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_P(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_P(safe_size);
+        device_vector<T>             dcsr_val_P(safe_size);
+        device_vector<rocsparse_int> dcsr_row_ptr_C(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind_C(safe_size);
+        device_vector<T>             dcsr_val_C(safe_size);
+        device_vector<T>             dbuffer(safe_size);
+
+        if(!dcsr_row_ptr_R || !dcsr_col_ind_R || !dcsr_val_R || !dcsr_row_ptr_A || !dcsr_col_ind_A
+           || !dcsr_val_A || !dcsr_row_ptr_P || !dcsr_col_ind_P || !dcsr_val_P || !dcsr_row_ptr_C
+           || !dcsr_col_ind_C || !dcsr_val_C || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        rocsparse_status expected = (M < 0 || N < 0 || K < 0) ? rocsparse_status_invalid_size
+                                                              : rocsparse_status_success;
+
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_buffer_size<T>(handle,
+                                                                trans_R,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                &h_alpha,
+                                                                descrR,
+                                                                safe_size,
+                                                                dcsr_row_ptr_R,
+                                                                dcsr_col_ind_R,
+                                                                descrA,
+                                                                safe_size,
+                                                                dcsr_row_ptr_A,
+                                                                dcsr_col_ind_A,
+                                                                descrP,
+                                                                safe_size,
+                                                                dcsr_row_ptr_P,
+                                                                dcsr_col_ind_P,
+                                                                info,
+                                                                &buffer_size),
+                                expected);
+
+        // The plan only exists if the buffer size query succeeded
+        if(expected != rocsparse_status_success)
+        {
+            return;
+        }
+
+        rocsparse_int nnz_C;
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap_nnz(handle,
+                                                     trans_R,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     descrR,
+                                                     safe_size,
+                                                     dcsr_row_ptr_R,
+                                                     dcsr_col_ind_R,
+                                                     descrA,
+                                                     safe_size,
+                                                     dcsr_row_ptr_A,
+                                                     dcsr_col_ind_A,
+                                                     descrP,
+                                                     safe_size,
+                                                     dcsr_row_ptr_P,
+                                                     dcsr_col_ind_P,
+                                                     descrC,
+                                                     dcsr_row_ptr_C,
+                                                     &nnz_C,
+                                                     info,
+                                                     dbuffer),
+                                expected);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrrap<T>(handle,
+                                                    trans_R,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &h_alpha,
+                                                    descrR,
+                                                    safe_size,
+                                                    dcsr_val_R,
+                                                    dcsr_row_ptr_R,
+                                                    dcsr_col_ind_R,
+                                                    descrA,
+                                                    safe_size,
+                                                    dcsr_val_A,
+                                                    dcsr_row_ptr_A,
+                                                    dcsr_col_ind_A,
+                                                    descrP,
+                                                    safe_size,
+                                                    dcsr_val_P,
+                                                    dcsr_row_ptr_P,
+                                                    dcsr_col_ind_P,
+                                                    descrC,
+                                                    dcsr_val_C,
+                                                    dcsr_row_ptr_C,
+                                                    dcsr_col_ind_C,
+                                                    info,
+                                                    dbuffer),
+                                expected);
+
+        return;
+    }
+
+    // Allocate host memory for matrices
+    host_vector<rocsparse_int> hcsr_row_ptr_R;
+    host_vector<rocsparse_int> hcsr_col_ind_R;
+    host_vector<T>             hcsr_val_R;
+    host_vector<rocsparse_int> hcsr_row_ptr_A;
+    host_vector<rocsparse_int> hcsr_col_ind_A;
+    host_vector<T>             hcsr_val_A;
+    host_vector<rocsparse_int> hcsr_row_ptr_P;
+    host_vector<rocsparse_int> hcsr_col_ind_P;
+    host_vector<T>             hcsr_val_P;
+
+    // Sample matrices, A is the K x K fine grid operator, P the K x N prolongation
+    // and R the M x K restriction (stored as K x M if transposed)
+    rocsparse_int nnz_R;
+    rocsparse_int nnz_A;
+    rocsparse_int nnz_P;
+    rocsparse_int hnnz_C_gold;
+    rocsparse_int hnnz_C_1;
+    rocsparse_int hnnz_C_2;
+
+    rocsparse_matrix_factory<T> matrix_factory(arg, arg.timing ? false : true, full_rank);
+    matrix_factory.init_csr(hcsr_row_ptr_A, hcsr_col_ind_A, hcsr_val_A, K, K, nnz_A, baseA);
+
+    // K might have been altered by the matrix factory
+    rocsparse_int M_R = (trans_R == rocsparse_operation_none) ? M : K;
+    rocsparse_int N_R = (trans_R == rocsparse_operation_none) ? K : M;
+
+    rocsparse_matrix_factory_random<T> matrix_factory_random(full_rank);
+    matrix_factory_random.init_csr(hcsr_row_ptr_P, hcsr_col_ind_P, hcsr_val_P, K, N, nnz_P, baseP);
+    matrix_factory_random.init_csr(
+        hcsr_row_ptr_R, hcsr_col_ind_R, hcsr_val_R, M_R, N_R, nnz_R, baseR);
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr_R(M_R + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_R(nnz_R);
+    device_vector<T>             dcsr_val_R(nnz_R);
+    device_vector<rocsparse_int> dcsr_row_ptr_A(K + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_A(nnz_A);
+    device_vector<T>             dcsr_val_A(nnz_A);
+    device_vector<rocsparse_int> dcsr_row_ptr_P(K + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_P(nnz_P);
+    device_vector<T>             dcsr_val_P(nnz_P);
+    device_vector<T>             d_alpha(1);
+    device_vector<rocsparse_int> dcsr_row_ptr_C_1(M + 1);
+    device_vector<rocsparse_int> dcsr_row_ptr_C_2(M + 1);
+    device_vector<rocsparse_int> dnnz_C_2(1);
+
+    if(!dcsr_row_ptr_R || !dcsr_col_ind_R || !dcsr_val_R || !dcsr_row_ptr_A || !dcsr_col_ind_A
+       || !dcsr_val_A || !dcsr_row_ptr_P || !dcsr_col_ind_P || !dcsr_val_P || !d_alpha
+       || !dcsr_row_ptr_C_1 || !dcsr_row_ptr_C_2 || !dnnz_C_2)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_R, hcsr_row_ptr_R, sizeof(rocsparse_int) * (M_R + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_R, hcsr_col_ind_R, sizeof(rocsparse_int) * nnz_R, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_R, hcsr_val_R, sizeof(T) * nnz_R, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_A, hcsr_row_ptr_A, sizeof(rocsparse_int) * (K + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_A, hcsr_col_ind_A, sizeof(rocsparse_int) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr_P, hcsr_row_ptr_P, sizeof(rocsparse_int) * (K + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_col_ind_P, hcsr_col_ind_P, sizeof(rocsparse_int) * nnz_P, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val_P, hcsr_val_P, sizeof(T) * nnz_P, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_buffer_size<T>(handle,
+                                                          trans_R,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          &h_alpha,
+                                                          descrR,
+                                                          nnz_R,
+                                                          dcsr_row_ptr_R,
+                                                          dcsr_col_ind_R,
+                                                          descrA,
+                                                          nnz_A,
+                                                          dcsr_row_ptr_A,
+                                                          dcsr_col_ind_A,
+                                                          descrP,
+                                                          nnz_P,
+                                                          dcsr_row_ptr_P,
+                                                          dcsr_col_ind_P,
+                                                          info,
+                                                          &buffer_size));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        // Obtain nnz of C
+
+        // Pointer mode host
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_nnz(handle,
+                                                   trans_R,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   descrR,
+                                                   nnz_R,
+                                                   dcsr_row_ptr_R,
+                                                   dcsr_col_ind_R,
+                                                   descrA,
+                                                   nnz_A,
+                                                   dcsr_row_ptr_A,
+                                                   dcsr_col_ind_A,
+                                                   descrP,
+                                                   nnz_P,
+                                                   dcsr_row_ptr_P,
+                                                   dcsr_col_ind_P,
+                                                   descrC,
+                                                   dcsr_row_ptr_C_1,
+                                                   &hnnz_C_1,
+                                                   info,
+                                                   dbuffer));
+
+        // Pointer mode device
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_nnz(handle,
+                                                   trans_R,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   descrR,
+                                                   nnz_R,
+                                                   dcsr_row_ptr_R,
+                                                   dcsr_col_ind_R,
+                                                   descrA,
+                                                   nnz_A,
+                                                   dcsr_row_ptr_A,
+                                                   dcsr_col_ind_A,
+                                                   descrP,
+                                                   nnz_P,
+                                                   dcsr_row_ptr_P,
+                                                   dcsr_col_ind_P,
+                                                   descrC,
+                                                   dcsr_row_ptr_C_2,
+                                                   dnnz_C_2,
+                                                   info,
+                                                   dbuffer));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr_row_ptr_C_1(M + 1);
+        host_vector<rocsparse_int> hcsr_row_ptr_C_2(M + 1);
+        CHECK_HIP_ERROR(
+            hipMemcpy(&hnnz_C_2, dnnz_C_2, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C_1,
+                                  dcsr_row_ptr_C_1,
+                                  sizeof(rocsparse_int) * (M + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_C_2,
+                                  dcsr_row_ptr_C_2,
+                                  sizeof(rocsparse_int) * (M + 1),
+                                  hipMemcpyDeviceToHost));
+
+        // CPU csrrap
+        host_vector<rocsparse_int> hcsr_row_ptr_C_gold;
+        host_vector<rocsparse_int> hcsr_col_ind_C_gold;
+        host_vector<T>             hcsr_val_C_gold;
+        host_csrrap(trans_R,
+                    M,
+                    N,
+                    K,
+                    h_alpha,
+                    hcsr_row_ptr_R,
+                    hcsr_col_ind_R,
+                    hcsr_val_R,
+                    hcsr_row_ptr_A,
+                    hcsr_col_ind_A,
+                    hcsr_val_A,
+                    hcsr_row_ptr_P,
+                    hcsr_col_ind_P,
+                    hcsr_val_P,
+                    hcsr_row_ptr_C_gold,
+                    &hnnz_C_gold,
+                    hcsr_col_ind_C_gold,
+                    hcsr_val_C_gold,
+                    baseR,
+                    baseA,
+                    baseP,
+                    baseC);
+
+        // Check nnz of C
+        unit_check_general<rocsparse_int>(1, 1, 1, &hnnz_C_gold, &hnnz_C_1);
+        unit_check_general<rocsparse_int>(1, 1, 1, &hnnz_C_gold, &hnnz_C_2);
+
+        // Check row pointers of C
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C_1);
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_C_gold, hcsr_row_ptr_C_2);
+
+        // Allocate device memory for C
+        device_vector<rocsparse_int> dcsr_col_ind_C_1(hnnz_C_1);
+        device_vector<rocsparse_int> dcsr_col_ind_C_2(hnnz_C_2);
+        device_vector<T>             dcsr_val_C_1(hnnz_C_1);
+        device_vector<T>             dcsr_val_C_2(hnnz_C_2);
+
+        if(!dcsr_col_ind_C_1 || !dcsr_col_ind_C_2 || !dcsr_val_C_1 || !dcsr_val_C_2)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        host_vector<rocsparse_int> hcsr_col_ind_C_1(hnnz_C_1);
+        host_vector<rocsparse_int> hcsr_col_ind_C_2(hnnz_C_2);
+        host_vector<T>             hcsr_val_C_1(hnnz_C_1);
+        host_vector<T>             hcsr_val_C_2(hnnz_C_2);
+
+        // The numerical phase is repeated with modified values of A, re-using the
+        // symbolic plan of rocsparse_csrrap_nnz()
+        for(int pass = 0; pass < 2; ++pass)
+        {
+            if(pass == 1)
+            {
+                for(rocsparse_int i = 0; i < nnz_A; ++i)
+                {
+                    hcsr_val_A[i] = static_cast<T>(2) * hcsr_val_A[i] + static_cast<T>(1);
+                }
+
+                CHECK_HIP_ERROR(
+                    hipMemcpy(dcsr_val_A, hcsr_val_A, sizeof(T) * nnz_A, hipMemcpyHostToDevice));
+                host_csrrap(trans_R,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            hcsr_row_ptr_R,
+                            hcsr_col_ind_R,
+                            hcsr_val_R,
+                            hcsr_row_ptr_A,
+                            hcsr_col_ind_A,
+                            hcsr_val_A,
+                            hcsr_row_ptr_P,
+                            hcsr_col_ind_P,
+                            hcsr_val_P,
+                            hcsr_row_ptr_C_gold,
+                            &hnnz_C_gold,
+                            hcsr_col_ind_C_gold,
+                            hcsr_val_C_gold,
+                            baseR,
+                            baseA,
+                            baseP,
+                            baseC);
+            }
+
+            // Pointer mode host
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap<T>(handle,
+                                                      trans_R,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      &h_alpha,
+                                                      descrR,
+                                                      nnz_R,
+                                                      dcsr_val_R,
+                                                      dcsr_row_ptr_R,
+                                                      dcsr_col_ind_R,
+                                                      descrA,
+                                                      nnz_A,
+                                                      dcsr_val_A,
+                                                      dcsr_row_ptr_A,
+                                                      dcsr_col_ind_A,
+                                                      descrP,
+                                                      nnz_P,
+                                                      dcsr_val_P,
+                                                      dcsr_row_ptr_P,
+                                                      dcsr_col_ind_P,
+                                                      descrC,
+                                                      dcsr_val_C_1,
+                                                      dcsr_row_ptr_C_1,
+                                                      dcsr_col_ind_C_1,
+                                                      info,
+                                                      dbuffer));
+
+            // Pointer mode device
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap<T>(handle,
+                                                      trans_R,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      d_alpha,
+                                                      descrR,
+                                                      nnz_R,
+                                                      dcsr_val_R,
+                                                      dcsr_row_ptr_R,
+                                                      dcsr_col_ind_R,
+                                                      descrA,
+                                                      nnz_A,
+                                                      dcsr_val_A,
+                                                      dcsr_row_ptr_A,
+                                                      dcsr_col_ind_A,
+                                                      descrP,
+                                                      nnz_P,
+                                                      dcsr_val_P,
+                                                      dcsr_row_ptr_P,
+                                                      dcsr_col_ind_P,
+                                                      descrC,
+                                                      dcsr_val_C_2,
+                                                      dcsr_row_ptr_C_2,
+                                                      dcsr_col_ind_C_2,
+                                                      info,
+                                                      dbuffer));
+
+            // Copy output to host
+            CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C_1,
+                                      dcsr_col_ind_C_1,
+                                      sizeof(rocsparse_int) * hnnz_C_1,
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_C_2,
+                                      dcsr_col_ind_C_2,
+                                      sizeof(rocsparse_int) * hnnz_C_2,
+                                      hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hcsr_val_C_1, dcsr_val_C_1, sizeof(T) * hnnz_C_1, hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hcsr_val_C_2, dcsr_val_C_2, sizeof(T) * hnnz_C_2, hipMemcpyDeviceToHost));
+
+            // Check C
+            unit_check_general<rocsparse_int>(
+                1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C_1);
+            unit_check_general<rocsparse_int>(
+                1, hnnz_C_gold, 1, hcsr_col_ind_C_gold, hcsr_col_ind_C_2);
+            near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C_1);
+            near_check_general<T>(1, hnnz_C_gold, 1, hcsr_val_C_gold, hcsr_val_C_2);
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_nnz(handle,
+                                                       trans_R,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       descrR,
+                                                       nnz_R,
+                                                       dcsr_row_ptr_R,
+                                                       dcsr_col_ind_R,
+                                                       descrA,
+                                                       nnz_A,
+                                                       dcsr_row_ptr_A,
+                                                       dcsr_col_ind_A,
+                                                       descrP,
+                                                       nnz_P,
+                                                       dcsr_row_ptr_P,
+                                                       dcsr_col_ind_P,
+                                                       descrC,
+                                                       dcsr_row_ptr_C_1,
+                                                       &hnnz_C_1,
+                                                       info,
+                                                       dbuffer));
+
+            device_vector<rocsparse_int> dcsr_col_ind_C(hnnz_C_1);
+            device_vector<T>             dcsr_val_C(hnnz_C_1);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap<T>(handle,
+                                                      trans_R,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      &h_alpha,
+                                                      descrR,
+                                                      nnz_R,
+                                                      dcsr_val_R,
+                                                      dcsr_row_ptr_R,
+                                                      dcsr_col_ind_R,
+                                                      descrA,
+                                                      nnz_A,
+                                                      dcsr_val_A,
+                                                      dcsr_row_ptr_A,
+                                                      dcsr_col_ind_A,
+                                                      descrP,
+                                                      nnz_P,
+                                                      dcsr_val_P,
+                                                      dcsr_row_ptr_P,
+                                                      dcsr_col_ind_P,
+                                                      descrC,
+                                                      dcsr_val_C,
+                                                      dcsr_row_ptr_C_1,
+                                                      dcsr_col_ind_C,
+                                                      info,
+                                                      dbuffer));
+        }
+
+        double gpu_analysis_time_used = get_time_us();
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrrap_nnz(handle,
+                                                   trans_R,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   descrR,
+                                                   nnz_R,
+                                                   dcsr_row_ptr_R,
+                                                   dcsr_col_ind_R,
+                                                   descrA,
+                                                   nnz_A,
+                                                   dcsr_row_ptr_A,
+                                                   dcsr_col_ind_A,
+                                                   descrP,
+                                                   nnz_P,
+                                                   dcsr_row_ptr_P,
+                                                   dcsr_col_ind_P,
+                                                   descrC,
+                                                   dcsr_row_ptr_C_1,
+                                                   &hnnz_C_1,
+                                                   info,
+                                                   dbuffer));
+
+        gpu_analysis_time_used = get_time_us() - gpu_analysis_time_used;
+
+        device_vector<rocsparse_int> dcsr_col_ind_C(hnnz_C_1);
+        device_vector<T>             dcsr_val_C(hnnz_C_1);
+
+        double gpu_solve_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrap<T>(handle,
+                                                      trans_R,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      &h_alpha,
+                                                      descrR,
+                                                      nnz_R,
+                                                      dcsr_val_R,
+                                                      dcsr_row_ptr_R,
+                                                      dcsr_col_ind_R,
+                                                      descrA,
+                                                      nnz_A,
+                                                      dcsr_val_A,
+                                                      dcsr_row_ptr_A,
+                                                      dcsr_col_ind_A,
+                                                      descrP,
+                                                      nnz_P,
+                                                      dcsr_val_P,
+                                                      dcsr_row_ptr_P,
+                                                      dcsr_col_ind_P,
+                                                      descrC,
+                                                      dcsr_val_C,
+                                                      dcsr_row_ptr_C_1,
+                                                      dcsr_col_ind_C,
+                                                      info,
+                                                      dbuffer));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csrrap_gbyte_count<T>(M, N, K, nnz_R, nnz_A, nnz_P, hnnz_C_1)
+                           / gpu_solve_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "opR" << std::setw(12) << "M" << std::setw(12) << "N"
+                  << std::setw(12) << "K" << std::setw(12) << "nnz_R" << std::setw(12) << "nnz_A"
+                  << std::setw(12) << "nnz_P" << std::setw(12) << "nnz_C" << std::setw(12)
+                  << "alpha" << std::setw(12) << "GB/s" << std::setw(16) << "nnz msec"
+                  << std::setw(16) << "rap msec" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << std::endl;
+
+        std::cout << std::setw(12) << rocsparse_operation2string(trans_R) << std::setw(12) << M
+                  << std::setw(12) << N << std::setw(12) << K << std::setw(12) << nnz_R
+                  << std::setw(12) << nnz_A << std::setw(12) << nnz_P << std::setw(12)
+                  << hnnz_C_1 << std::setw(12) << h_alpha << std::setw(12) << gpu_gbyte
+                  << std::setw(16) << gpu_analysis_time_used / 1e3 << std::setw(16)
+                  << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                             \
+    template void testing_csrrap_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrrap<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -0,0 +1,457 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_csrrcm.hpp"
+
+template <typename T>
+void testing_csrrcm_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Allocate memory on device
+    device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+    device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+    device_vector<rocsparse_int> dperm(safe_size);
+    device_vector<rocsparse_int> dbuffer(safe_size);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dperm || !dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Test rocsparse_csrrcm_buffer_size()
+    size_t buffer_size;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm_buffer_size(
+            nullptr, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm_buffer_size(
+            handle, safe_size, safe_size, nullptr, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm_buffer_size(
+            handle, safe_size, safe_size, descr, nullptr, dcsr_col_ind, &buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm_buffer_size(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, nullptr, &buffer_size),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm_buffer_size(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, nullptr),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm_buffer_size(
+            handle, -1, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm_buffer_size(
+            handle, safe_size, -1, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+        rocsparse_status_invalid_size);
+
+    // Test rocsparse_csrrcm()
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm(
+            nullptr, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, dperm, dbuffer),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm(
+            handle, safe_size, safe_size, nullptr, dcsr_row_ptr, dcsr_col_ind, dperm, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm(
+            handle, safe_size, safe_size, descr, nullptr, dcsr_col_ind, dperm, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, nullptr, dperm, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, nullptr, dbuffer),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, dperm, nullptr),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm(handle, -1, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, dperm, dbuffer),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm(handle, safe_size, -1, descr, dcsr_row_ptr, dcsr_col_ind, dperm, dbuffer),
+        rocsparse_status_invalid_size);
+
+    // Test rocsparse_csrbandwidth()
+    rocsparse_int bandwidth;
+    int64_t       profile;
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrbandwidth(
+            nullptr, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, &bandwidth, &profile),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrbandwidth(handle,
+                                                   safe_size,
+                                                   safe_size,
+                                                   nullptr,
+                                                   dcsr_row_ptr,
+                                                   dcsr_col_ind,
+                                                   &bandwidth,
+                                                   &profile),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrbandwidth(
+            handle, safe_size, safe_size, descr, nullptr, dcsr_col_ind, &bandwidth, &profile),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrbandwidth(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, nullptr, &bandwidth, &profile),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrbandwidth(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, nullptr, &profile),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrbandwidth(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, &bandwidth, nullptr),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrbandwidth(
+            handle, -1, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, &bandwidth, &profile),
+        rocsparse_status_invalid_size);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrbandwidth(
+            handle, safe_size, -1, descr, dcsr_row_ptr, dcsr_col_ind, &bandwidth, &profile),
+        rocsparse_status_invalid_size);
+
+    // Only general matrices are supported
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrrcm(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, dperm, dbuffer),
+        rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrbandwidth(
+            handle, safe_size, safe_size, descr, dcsr_row_ptr, dcsr_col_ind, &bandwidth, &profile),
+        rocsparse_status_not_implemented);
+}
+
+template <typename T>
+void testing_csrrcm(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M    = arg.M;
+    rocsparse_int               N    = arg.N;
+    rocsparse_index_base        base = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<rocsparse_int> dperm(safe_size);
+        device_vector<rocsparse_int> dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dperm || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrrcm_buffer_size(
+                handle, M, 0, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrrcm(handle, M, 0, descr, dcsr_row_ptr, dcsr_col_ind, dperm, dbuffer),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        rocsparse_int bandwidth;
+        int64_t       profile;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrbandwidth(
+                handle, M, 0, descr, dcsr_row_ptr, dcsr_col_ind, &bandwidth, &profile),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for CSR matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dperm(M);
+    device_vector<rocsparse_int> dperm_row_ptr(M + 1);
+    device_vector<rocsparse_int> dperm_col_ind(nnz);
+    device_vector<T>             dperm_val(nnz);
+    device_vector<rocsparse_int> dbandwidth(1);
+    device_vector<int64_t>       dprofile(1);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dperm || !dperm_row_ptr || !dperm_col_ind
+       || !dperm_val || !dbandwidth || !dprofile)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+
+    // Obtain buffer sizes
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrrcm_buffer_size(
+        handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, &buffer_size));
+
+    size_t perm_buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsympermute_buffer_size(
+        handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, dperm, &perm_buffer_size));
+
+    // Allocate buffers
+    void* dbuffer;
+    void* dperm_buffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+    CHECK_HIP_ERROR(hipMalloc(&dperm_buffer, perm_buffer_size));
+
+    if(!dbuffer || !dperm_buffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        host_vector<rocsparse_int> hperm(M);
+        host_vector<rocsparse_int> hperm_gold;
+
+        CHECK_ROCSPARSE_ERROR(
+            rocsparse_csrrcm(handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, dperm, dbuffer));
+
+        // Copy output to host
+        CHECK_HIP_ERROR(hipMemcpy(hperm, dperm, sizeof(rocsparse_int) * M, hipMemcpyDeviceToHost));
+
+        // CPU csrrcm
+        host_csrrcm(M, hcsr_row_ptr, hcsr_col_ind, base, hperm_gold);
+
+        unit_check_general<rocsparse_int>(1, M, 1, hperm_gold, hperm);
+
+        // Reordered matrix P * A * P^T
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsympermute<T>(handle,
+                                                         M,
+                                                         nnz,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         dperm,
+                                                         dperm_val,
+                                                         dperm_row_ptr,
+                                                         dperm_col_ind,
+                                                         dperm_buffer));
+
+        host_vector<rocsparse_int> hperm_row_ptr(M + 1);
+        host_vector<rocsparse_int> hperm_col_ind(nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hperm_row_ptr, dperm_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(
+            hperm_col_ind, dperm_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyDeviceToHost));
+
+        // Bandwidth and profile of the original and the reordered matrix
+        for(int r = 0; r < 2; ++r)
+        {
+            const rocsparse_int* drow_ptr = (r == 0) ? dcsr_row_ptr : dperm_row_ptr;
+            const rocsparse_int* dcol_ind = (r == 0) ? dcsr_col_ind : dperm_col_ind;
+
+            rocsparse_int hbandwidth_1;
+            rocsparse_int hbandwidth_2;
+            rocsparse_int hbandwidth_gold;
+            int64_t       hprofile_1;
+            int64_t       hprofile_2;
+            int64_t       hprofile_gold;
+
+            // Pointer mode host
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrbandwidth(
+                handle, M, nnz, descr, drow_ptr, dcol_ind, &hbandwidth_1, &hprofile_1));
+
+            // Pointer mode device
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrbandwidth(
+                handle, M, nnz, descr, drow_ptr, dcol_ind, dbandwidth, dprofile));
+
+            CHECK_HIP_ERROR(hipMemcpy(
+                &hbandwidth_2, dbandwidth, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(
+                hipMemcpy(&hprofile_2, dprofile, sizeof(int64_t), hipMemcpyDeviceToHost));
+
+            // CPU csrbandwidth
+            host_csrbandwidth(M,
+                              (r == 0) ? hcsr_row_ptr : hperm_row_ptr,
+                              (r == 0) ? hcsr_col_ind : hperm_col_ind,
+                              base,
+                              hbandwidth_gold,
+                              hprofile_gold);
+
+            unit_check_general<rocsparse_int>(1, 1, 1, &hbandwidth_gold, &hbandwidth_1);
+            unit_check_general<rocsparse_int>(1, 1, 1, &hbandwidth_gold, &hbandwidth_2);
+            unit_check_general<int64_t>(1, 1, 1, &hprofile_gold, &hprofile_1);
+            unit_check_general<int64_t>(1, 1, 1, &hprofile_gold, &hprofile_2);
+        }
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrcm(
+                handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, dperm, dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrrcm(
+                handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, dperm, dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csrrcm_gbyte_count<T>(M, nnz) / gpu_time_used * 1e6;
+
+        // Bandwidth and profile before and after reordering
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsympermute<T>(handle,
+                                                         M,
+                                                         nnz,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         dperm,
+                                                         dperm_val,
+                                                         dperm_row_ptr,
+                                                         dperm_col_ind,
+                                                         dperm_buffer));
+
+        rocsparse_int bandwidth_before;
+        rocsparse_int bandwidth_after;
+        int64_t       profile_before;
+        int64_t       profile_after;
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrbandwidth(handle,
+                                                     M,
+                                                     nnz,
+                                                     descr,
+                                                     dcsr_row_ptr,
+                                                     dcsr_col_ind,
+                                                     &bandwidth_before,
+                                                     &profile_before));
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrbandwidth(handle,
+                                                     M,
+                                                     nnz,
+                                                     descr,
+                                                     dperm_row_ptr,
+                                                     dperm_col_ind,
+                                                     &bandwidth_after,
+                                                     &profile_after));
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "bw"
+                  << std::setw(12) << "bw_rcm" << std::setw(16) << "profile" << std::setw(16)
+                  << "profile_rcm" << std::setw(12) << "GB/s" << std::setw(12) << "msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12)
+                  << bandwidth_before << std::setw(12) << bandwidth_after << std::setw(16)
+                  << profile_before << std::setw(16) << profile_after << std::setw(12)
+                  << gpu_gbyte << std::setw(12) << gpu_time_used / 1e3 << std::setw(12)
+                  << number_hot_calls << std::setw(12) << (arg.unit_check ? "yes" : "no")
+                  << std::endl;
+    }
+
+    // Clear buffers
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+    CHECK_HIP_ERROR(hipFree(dperm_buffer));
+}
+
+#define INSTANTIATE(TYPE)                                             \
+    template void testing_csrrcm_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrrcm<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -125,6 +125,41 @@ void testing_csrsv_bad_arg(const Arguments& arg)
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_zero_pivot(handle, descr, info, nullptr),
                             rocsparse_status_invalid_pointer);
 
+    // Test rocsparse_csrsv_level_info()
+    rocsparse_int nlevels;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_level_info(nullptr, trans, descr, info, &nlevels),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_level_info(handle, trans, nullptr, info, &nlevels),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_level_info(handle, trans, descr, nullptr, &nlevels),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_level_info(handle, trans, descr, info, nullptr),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(handle, (rocsparse_operation)-1, descr, info, &nlevels),
+        rocsparse_status_invalid_value);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_csrsv_level_info(
+            handle, rocsparse_operation_conjugate_transpose, descr, info, &nlevels),
+        rocsparse_status_not_implemented);
+
+    // Test rocsparse_csrsv_jacobi_sweeps()
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_jacobi_sweeps(nullptr, info, 1),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_jacobi_sweeps(handle, nullptr, 1),
+                            rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_jacobi_sweeps(handle, info, -1),
+                            rocsparse_status_invalid_size);
+
+    // Test rocsparse_set_memory_budget() and rocsparse_get_memory_budget()
+    size_t budget;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_set_memory_budget(nullptr, 0),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_memory_budget(nullptr, &budget),
+                            rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_get_memory_budget(handle, nullptr),
+                            rocsparse_status_invalid_pointer);
+
     // Test rocsparse_csrsv_clear()
     EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_clear(nullptr, descr, info),
                             rocsparse_status_invalid_handle);
@@ -282,6 +317,14 @@ void testing_csrsv(const Arguments& arg)
             EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_zero_pivot(handle, descr, info, analysis_pivot),
                                     (*analysis_pivot != -1) ? rocsparse_status_zero_pivot
                                                             : rocsparse_status_success);
+
+            // Level sets of the dependency graph
+            host_scalar<rocsparse_int> h_nlevels(
+                host_csrsv_levels(trans, hA.m, hA.ptr, hA.ind, uplo, base));
+            host_scalar<rocsparse_int> nlevels;
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_level_info(handle, trans, descr, info, nlevels));
+            h_nlevels.unit_check(nlevels);
+
             CHECK_HIP_ERROR(hipDeviceSynchronize());
             CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(PARAMS_SOLVE(h_alpha, dA, dx, dy)));
             EXPECT_ROCSPARSE_STATUS(rocsparse_csrsv_zero_pivot(handle, descr, info, solve_pivot),
@@ -346,6 +389,176 @@ void testing_csrsv(const Arguments& arg)
             hy.near_check(dy, tol);
         }
 
+        //
+        // JACOBI SWEEPS, THE APPROXIMATION IS EXACT AFTER NLEVELS SWEEPS.
+        //
+        {
+            host_scalar<rocsparse_int> nlevels;
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_level_info(handle, trans, descr, info, nlevels));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_jacobi_sweeps(handle, info, *nlevels));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(PARAMS_SOLVE(h_alpha, dA, dx, dy)));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_jacobi_sweeps(handle, info, 0));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+        }
+
+        if(*h_analysis_pivot == -1 && *h_solve_pivot == -1)
+        {
+            hy.near_check(dy, tol);
+        }
+
+        //
+        // NUMERIC-ONLY RE-ANALYSIS, THE META DATA OF THE UNCHANGED PATTERN IS RE-USED.
+        //
+        {
+            host_scalar<rocsparse_int> nlevels;
+            host_scalar<rocsparse_int> h_nlevels(
+                host_csrsv_levels(trans, hA.m, hA.ptr, hA.ind, uplo, base));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                              trans,
+                                                              dA.m,
+                                                              dA.nnz,
+                                                              descr,
+                                                              dA.val,
+                                                              dA.ptr,
+                                                              dA.ind,
+                                                              info,
+                                                              rocsparse_analysis_policy_numeric,
+                                                              spol,
+                                                              dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_level_info(handle, trans, descr, info, nlevels));
+            h_nlevels.unit_check(nlevels);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(PARAMS_SOLVE(h_alpha, dA, dx, dy)));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+        }
+
+        if(*h_analysis_pivot == -1 && *h_solve_pivot == -1)
+        {
+            hy.near_check(dy, tol);
+        }
+
+        //
+        // NUMERIC-ONLY RE-ANALYSIS OF A CHANGED PATTERN, THE META DATA IS RE-BUILT.
+        //
+        {
+            // The transposed matrix has the same size, but a different triangular part
+            host_csr_matrix<T> hB(hA.n, hA.m, hA.nnz, base);
+            host_csr_to_csc<T>(hA.m,
+                               hA.n,
+                               hA.nnz,
+                               hA.ptr,
+                               hA.ind,
+                               hA.val,
+                               hB.ind,
+                               hB.ptr,
+                               hB.val,
+                               rocsparse_action_numeric,
+                               base);
+
+            device_csr_matrix<T>       dB(hB);
+            host_dense_matrix<T>       hz(M, 1);
+            host_scalar<rocsparse_int> hB_analysis_pivot, hB_solve_pivot;
+
+            host_csrsv<T>(trans,
+                          hB.m,
+                          hB.nnz,
+                          *h_alpha,
+                          hB.ptr,
+                          hB.ind,
+                          hB.val,
+                          hx,
+                          hz,
+                          diag,
+                          uplo,
+                          base,
+                          hB_analysis_pivot,
+                          hB_solve_pivot);
+
+            host_scalar<rocsparse_int> nlevels;
+            host_scalar<rocsparse_int> h_nlevels(
+                host_csrsv_levels(trans, hB.m, hB.ptr, hB.ind, uplo, base));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                              trans,
+                                                              dB.m,
+                                                              dB.nnz,
+                                                              descr,
+                                                              dB.val,
+                                                              dB.ptr,
+                                                              dB.ind,
+                                                              info,
+                                                              rocsparse_analysis_policy_numeric,
+                                                              spol,
+                                                              dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_level_info(handle, trans, descr, info, nlevels));
+            h_nlevels.unit_check(nlevels);
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(PARAMS_SOLVE(h_alpha, dB, dx, dy)));
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            if(*hB_analysis_pivot == -1 && *hB_solve_pivot == -1)
+            {
+                hz.near_check(dy, tol);
+            }
+        }
+
+        //
+        // TRANSPOSED SOLVE ON THE ORIGINAL MATRIX, THE TRANSPOSE EXCEEDS THE MEMORY BUDGET.
+        //
+        if(trans == rocsparse_operation_transpose)
+        {
+            rocsparse_local_mat_info   info_lean;
+            host_scalar<rocsparse_int> solve_pivot;
+            size_t                     budget;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_get_memory_budget(handle, &budget));
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_memory_budget(handle, 0));
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_analysis<T>(handle,
+                                                              trans,
+                                                              dA.m,
+                                                              dA.nnz,
+                                                              descr,
+                                                              dA.val,
+                                                              dA.ptr,
+                                                              dA.ind,
+                                                              info_lean,
+                                                              apol,
+                                                              spol,
+                                                              dbuffer));
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsv_solve<T>(handle,
+                                                           trans,
+                                                           dA.m,
+                                                           dA.nnz,
+                                                           h_alpha,
+                                                           descr,
+                                                           dA.val,
+                                                           dA.ptr,
+                                                           dA.ind,
+                                                           info_lean,
+                                                           dx,
+                                                           dy,
+                                                           spol,
+                                                           dbuffer));
+            EXPECT_ROCSPARSE_STATUS(
+                rocsparse_csrsv_zero_pivot(handle, descr, info_lean, solve_pivot),
+                (*h_solve_pivot != -1) ? rocsparse_status_zero_pivot : rocsparse_status_success);
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_memory_budget(handle, budget));
+
+            h_solve_pivot.unit_check(solve_pivot);
+        }
+
+        if(*h_analysis_pivot == -1 && *h_solve_pivot == -1)
+        {
+            hy.near_check(dy, tol);
+        }
+
         //
         // A BIT MORE FOR CODE COVERAGE, WE ONLY DO ANALYSIS FOR INFO ASSIGNMENT.
         //
@@ -0,0 +1,318 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+#include "testing_csrsympermute.hpp"
+
+template <typename T>
+void testing_csrsympermute_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr local_descr;
+
+    rocsparse_handle          handle          = local_handle;
+    rocsparse_int             m               = safe_size;
+    rocsparse_int             nnz             = safe_size;
+    const rocsparse_mat_descr descr           = local_descr;
+    const T*                  csr_val         = (const T*)0x4;
+    const rocsparse_int*      csr_row_ptr     = (const rocsparse_int*)0x4;
+    const rocsparse_int*      csr_col_ind     = (const rocsparse_int*)0x4;
+    const rocsparse_int*      perm            = (const rocsparse_int*)0x4;
+    T*                        csr_val_out     = (T*)0x4;
+    rocsparse_int*            csr_row_ptr_out = (rocsparse_int*)0x4;
+    rocsparse_int*            csr_col_ind_out = (rocsparse_int*)0x4;
+    size_t*                   buffer_size     = (size_t*)0x4;
+    void*                     temp_buffer     = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, nnz, descr, csr_row_ptr, csr_col_ind, perm, buffer_size
+
+#define PARAMS                                                                                    \
+    handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, perm, csr_val_out, csr_row_ptr_out, \
+        csr_col_ind_out, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_csrsympermute_buffer_size, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_csrsympermute<T>, PARAMS);
+
+    // Only general matrices are supported
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_type(descr, rocsparse_matrix_type_symmetric));
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsympermute_buffer_size(PARAMS_BUFFER_SIZE),
+                            rocsparse_status_not_implemented);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_csrsympermute<T>(PARAMS), rocsparse_status_not_implemented);
+
+#undef PARAMS
+#undef PARAMS_BUFFER_SIZE
+}
+
+template <typename T>
+void testing_csrsympermute(const Arguments& arg)
+{
+    rocsparse_matrix_factory<T> matrix_factory(arg);
+    rocsparse_int               M    = arg.M;
+    rocsparse_int               N    = arg.N;
+    rocsparse_index_base        base = arg.baseA;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Create matrix descriptor
+    rocsparse_local_mat_descr descr;
+
+    // Set matrix index base
+    CHECK_ROCSPARSE_ERROR(rocsparse_set_mat_index_base(descr, base));
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0)
+    {
+        static const size_t safe_size = 100;
+
+        // Allocate memory on device
+        device_vector<rocsparse_int> dcsr_row_ptr(safe_size);
+        device_vector<rocsparse_int> dcsr_col_ind(safe_size);
+        device_vector<T>             dcsr_val(safe_size);
+        device_vector<rocsparse_int> dperm(safe_size);
+        device_vector<rocsparse_int> dbuffer(safe_size);
+
+        if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dperm || !dbuffer)
+        {
+            CHECK_HIP_ERROR(hipErrorOutOfMemory);
+            return;
+        }
+
+        size_t buffer_size;
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_csrsympermute_buffer_size(
+                handle, M, 0, descr, dcsr_row_ptr, dcsr_col_ind, dperm, &buffer_size),
+            (M < 0) ? rocsparse_status_invalid_size : rocsparse_status_success);
+        EXPECT_ROCSPARSE_STATUS(rocsparse_csrsympermute<T>(handle,
+                                                           M,
+                                                           0,
+                                                           descr,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           dperm,
+                                                           dcsr_val,
+                                                           dcsr_row_ptr,
+                                                           dcsr_col_ind,
+                                                           dbuffer),
+                                (M < 0) ? rocsparse_status_invalid_size
+                                        : rocsparse_status_success);
+
+        return;
+    }
+
+    // Allocate host memory for CSR matrix
+    host_vector<rocsparse_int> hcsr_row_ptr;
+    host_vector<rocsparse_int> hcsr_col_ind;
+    host_vector<T>             hcsr_val;
+
+    // Sample matrix
+    rocsparse_int nnz;
+    matrix_factory.init_csr(hcsr_row_ptr, hcsr_col_ind, hcsr_val, M, N, nnz, base);
+
+    // Non-squared matrices are not supported
+    if(M != N)
+    {
+        return;
+    }
+
+    // Random permutation
+    host_vector<rocsparse_int> hperm(M);
+
+    for(rocsparse_int i = 0; i < M; ++i)
+    {
+        hperm[i] = i;
+    }
+
+    for(rocsparse_int i = M - 1; i > 0; --i)
+    {
+        std::swap(hperm[i], hperm[rand() % (i + 1)]);
+    }
+
+    // Allocate device memory
+    device_vector<rocsparse_int> dcsr_row_ptr(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind(nnz);
+    device_vector<T>             dcsr_val(nnz);
+    device_vector<rocsparse_int> dperm(M);
+    device_vector<rocsparse_int> dcsr_row_ptr_out(M + 1);
+    device_vector<rocsparse_int> dcsr_col_ind_out(nnz);
+    device_vector<T>             dcsr_val_out(nnz);
+
+    if(!dcsr_row_ptr || !dcsr_col_ind || !dcsr_val || !dperm || !dcsr_row_ptr_out
+       || !dcsr_col_ind_out || !dcsr_val_out)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(
+        dcsr_row_ptr, hcsr_row_ptr, sizeof(rocsparse_int) * (M + 1), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dcsr_col_ind, hcsr_col_ind, sizeof(rocsparse_int) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dcsr_val, hcsr_val, sizeof(T) * nnz, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dperm, hperm, sizeof(rocsparse_int) * M, hipMemcpyHostToDevice));
+
+    // Obtain buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_csrsympermute_buffer_size(
+        handle, M, nnz, descr, dcsr_row_ptr, dcsr_col_ind, dperm, &buffer_size));
+
+    // Allocate buffer
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(!dbuffer)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_csrsympermute<T>(handle,
+                                                         M,
+                                                         nnz,
+                                                         descr,
+                                                         dcsr_val,
+                                                         dcsr_row_ptr,
+                                                         dcsr_col_ind,
+                                                         dperm,
+                                                         dcsr_val_out,
+                                                         dcsr_row_ptr_out,
+                                                         dcsr_col_ind_out,
+                                                         dbuffer));
+
+        // Copy output to host
+        host_vector<rocsparse_int> hcsr_row_ptr_out(M + 1);
+        host_vector<rocsparse_int> hcsr_col_ind_out(nnz);
+        host_vector<T>             hcsr_val_out(nnz);
+
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_row_ptr_out,
+                                  dcsr_row_ptr_out,
+                                  sizeof(rocsparse_int) * (M + 1),
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hcsr_col_ind_out,
+                                  dcsr_col_ind_out,
+                                  sizeof(rocsparse_int) * nnz,
+                                  hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hcsr_val_out, dcsr_val_out, sizeof(T) * nnz, hipMemcpyDeviceToHost));
+
+        // CPU csrsympermute
+        host_vector<rocsparse_int> hcsr_row_ptr_gold;
+        host_vector<rocsparse_int> hcsr_col_ind_gold;
+        host_vector<T>             hcsr_val_gold;
+
+        host_csrsympermute(M,
+                           hcsr_row_ptr,
+                           hcsr_col_ind,
+                           hcsr_val,
+                           hperm,
+                           hcsr_row_ptr_gold,
+                           hcsr_col_ind_gold,
+                           hcsr_val_gold,
+                           base);
+
+        unit_check_general<rocsparse_int>(1, M + 1, 1, hcsr_row_ptr_gold, hcsr_row_ptr_out);
+        unit_check_general<rocsparse_int>(1, nnz, 1, hcsr_col_ind_gold, hcsr_col_ind_out);
+        unit_check_general<T>(1, nnz, 1, hcsr_val_gold, hcsr_val_out);
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsympermute<T>(handle,
+                                                             M,
+                                                             nnz,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             dperm,
+                                                             dcsr_val_out,
+                                                             dcsr_row_ptr_out,
+                                                             dcsr_col_ind_out,
+                                                             dbuffer));
+        }
+
+        double gpu_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_csrsympermute<T>(handle,
+                                                             M,
+                                                             nnz,
+                                                             descr,
+                                                             dcsr_val,
+                                                             dcsr_row_ptr,
+                                                             dcsr_col_ind,
+                                                             dperm,
+                                                             dcsr_val_out,
+                                                             dcsr_row_ptr_out,
+                                                             dcsr_col_ind_out,
+                                                             dbuffer));
+        }
+
+        gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+        double gpu_gbyte = csrsympermute_gbyte_count<T>(M, nnz) / gpu_time_used * 1e6;
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(12) << "nnz" << std::setw(12) << "GB/s"
+                  << std::setw(12) << "msec" << std::setw(12) << "iter" << std::setw(12)
+                  << "verified" << std::endl;
+
+        std::cout << std::setw(12) << M << std::setw(12) << nnz << std::setw(12) << gpu_gbyte
+                  << std::setw(12) << gpu_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Clear buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                    \
+    template void testing_csrsympermute_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_csrsympermute<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
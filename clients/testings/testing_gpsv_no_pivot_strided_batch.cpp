@@ -0,0 +1,226 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_enum.hpp"
+#include "testing.hpp"
+
+#include "auto_testing_bad_arg.hpp"
+
+template <typename T>
+void testing_gpsv_no_pivot_strided_batch_bad_arg(const Arguments& arg)
+{
+    static const size_t safe_size = 100;
+
+    // Create rocsparse handle
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle handle       = local_handle;
+    rocsparse_int    m            = safe_size;
+    rocsparse_int    batch_count  = safe_size;
+    rocsparse_int    batch_stride = safe_size;
+    const T*         ds           = (const T*)0x4;
+    const T*         dl           = (const T*)0x4;
+    const T*         d            = (const T*)0x4;
+    const T*         du           = (const T*)0x4;
+    const T*         dw           = (const T*)0x4;
+    const T*         x1           = (const T*)0x4;
+    T*               x2           = (T*)0x4;
+    size_t*          buffer_size  = (size_t*)0x4;
+    void*            temp_buffer  = (void*)0x4;
+
+#define PARAMS_BUFFER_SIZE handle, m, ds, dl, d, du, dw, x1, batch_count, batch_stride, buffer_size
+#define PARAMS_SOLVE handle, m, ds, dl, d, du, dw, x2, batch_count, batch_stride, temp_buffer
+
+    auto_testing_bad_arg(rocsparse_gpsv_no_pivot_strided_batch_buffer_size<T>, PARAMS_BUFFER_SIZE);
+    auto_testing_bad_arg(rocsparse_gpsv_no_pivot_strided_batch<T>, PARAMS_SOLVE);
+
+#undef PARAMS_BUFFER_SIZE
+#undef PARAMS_SOLVE
+}
+
+template <typename T>
+void testing_gpsv_no_pivot_strided_batch(const Arguments& arg)
+{
+    rocsparse_int m            = arg.M;
+    rocsparse_int batch_count  = arg.N;
+    rocsparse_int batch_stride = arg.denseld;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+#define PARAMS_BUFFER_SIZE \
+    handle, m, dds, ddl, dd, ddu, ddw, dx, batch_count, batch_stride, &buffer_size
+#define PARAMS_SOLVE handle, m, dds, ddl, dd, ddu, ddw, dx, batch_count, batch_stride, dbuffer
+
+    // Argument sanity check before allocating invalid memory
+    if(m <= 1 || batch_count <= 0 || batch_stride < m)
+    {
+        static const size_t safe_size = 100;
+
+        size_t           buffer_size;
+        device_vector<T> dds(safe_size);
+        device_vector<T> ddl(safe_size);
+        device_vector<T> dd(safe_size);
+        device_vector<T> ddu(safe_size);
+        device_vector<T> ddw(safe_size);
+        device_vector<T> dx(safe_size);
+        device_vector<T> dbuffer(safe_size);
+
+        EXPECT_ROCSPARSE_STATUS(
+            rocsparse_gpsv_no_pivot_strided_batch_buffer_size<T>(PARAMS_BUFFER_SIZE),
+            (m <= 1 || batch_count < 0 || batch_stride < m) ? rocsparse_status_invalid_size
+                                                             : rocsparse_status_success);
+
+        EXPECT_ROCSPARSE_STATUS(rocsparse_gpsv_no_pivot_strided_batch<T>(PARAMS_SOLVE),
+                                (m <= 1 || batch_count < 0 || batch_stride < m)
+                                    ? rocsparse_status_invalid_size
+                                    : rocsparse_status_success);
+
+        return;
+    }
+
+    rocsparse_seedrand();
+
+    // Host penta-diagonal matrices
+    host_vector<T> hds(batch_stride * batch_count, static_cast<T>(0));
+    host_vector<T> hdl(batch_stride * batch_count, static_cast<T>(0));
+    host_vector<T> hd(batch_stride * batch_count, static_cast<T>(0));
+    host_vector<T> hdu(batch_stride * batch_count, static_cast<T>(0));
+    host_vector<T> hdw(batch_stride * batch_count, static_cast<T>(0));
+
+    // Host rhs, padded entries between the systems must remain untouched
+    host_vector<T> hx(batch_stride * batch_count, static_cast<T>(7));
+
+    // initialize penta-diagonal matrices
+    for(rocsparse_int j = 0; j < batch_count; ++j)
+    {
+        for(rocsparse_int i = 0; i < m; ++i)
+        {
+            hds[batch_stride * j + i] = random_generator<T>(1, 4);
+            hdl[batch_stride * j + i] = random_generator<T>(1, 4);
+            hd[batch_stride * j + i]  = random_generator<T>(17, 32);
+            hdu[batch_stride * j + i] = random_generator<T>(1, 4);
+            hdw[batch_stride * j + i] = random_generator<T>(1, 4);
+            hx[batch_stride * j + i]  = random_generator<T>(-10, 10);
+        }
+
+        hds[batch_stride * j]         = 0.0f;
+        hds[batch_stride * j + 1]     = 0.0f;
+        hdl[batch_stride * j]         = 0.0f;
+        hdu[batch_stride * j + m - 1] = 0.0f;
+        hdw[batch_stride * j + m - 2] = 0.0f;
+        hdw[batch_stride * j + m - 1] = 0.0f;
+    }
+
+    host_vector<T> hx_cpu = hx;
+
+    // Device penta-diagonal matrices
+    device_vector<T> dds(batch_stride * batch_count);
+    device_vector<T> ddl(batch_stride * batch_count);
+    device_vector<T> dd(batch_stride * batch_count);
+    device_vector<T> ddu(batch_stride * batch_count);
+    device_vector<T> ddw(batch_stride * batch_count);
+
+    // Device rhs
+    device_vector<T> dx(batch_stride * batch_count);
+
+    // Copy to device
+    dds.transfer_from(hds);
+    ddl.transfer_from(hdl);
+    dd.transfer_from(hd);
+    ddu.transfer_from(hdu);
+    ddw.transfer_from(hdw);
+    dx.transfer_from(hx);
+
+    // Obtain required buffer size
+    size_t buffer_size;
+    CHECK_ROCSPARSE_ERROR(rocsparse_gpsv_no_pivot_strided_batch_buffer_size<T>(PARAMS_BUFFER_SIZE));
+
+    void* dbuffer;
+    CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+    if(arg.unit_check)
+    {
+        CHECK_ROCSPARSE_ERROR(rocsparse_gpsv_no_pivot_strided_batch<T>(PARAMS_SOLVE));
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hx.data(), dx, sizeof(T) * batch_stride * batch_count, hipMemcpyDeviceToHost));
+
+        // CPU gpsv_no_pivot_strided_batch
+        host_gpsv_no_pivot_strided_batch<T>(
+            m, hds, hdl, hd, hdu, hdw, hx_cpu, batch_count, batch_stride);
+
+        near_check_general<T>(1, batch_stride * batch_count, 1, hx_cpu.data(), hx.data());
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = 2;
+        int number_hot_calls  = arg.iters;
+
+        // Warm up
+        for(int iter = 0; iter < number_cold_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_gpsv_no_pivot_strided_batch<T>(PARAMS_SOLVE));
+        }
+
+        double gpu_solve_time_used = get_time_us();
+
+        // Performance run
+        for(int iter = 0; iter < number_hot_calls; ++iter)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_gpsv_no_pivot_strided_batch<T>(PARAMS_SOLVE));
+        }
+
+        gpu_solve_time_used = (get_time_us() - gpu_solve_time_used) / number_hot_calls;
+
+        double gbyte_count = gpsv_strided_batch_gbyte_count<T>(m, batch_count);
+
+        double gpu_gbyte = get_gpu_gbyte(gpu_solve_time_used, gbyte_count);
+
+        std::cout.precision(2);
+        std::cout.setf(std::ios::fixed);
+        std::cout.setf(std::ios::left);
+
+        std::cout << std::setw(12) << "M" << std::setw(16) << "batch_count" << std::setw(16)
+                  << "batch_stride" << std::setw(12) << "GB/s" << std::setw(12) << "solve_msec"
+                  << std::setw(12) << "iter" << std::setw(12) << "verified" << std::endl;
+
+        std::cout << std::setw(12) << m << std::setw(16) << batch_count << std::setw(16)
+                  << batch_stride << std::setw(12) << gpu_gbyte << std::setw(12)
+                  << gpu_solve_time_used / 1e3 << std::setw(12) << number_hot_calls
+                  << std::setw(12) << (arg.unit_check ? "yes" : "no") << std::endl;
+    }
+
+    // Free buffer
+    CHECK_HIP_ERROR(hipFree(dbuffer));
+}
+
+#define INSTANTIATE(TYPE)                                                                  \
+    template void testing_gpsv_no_pivot_strided_batch_bad_arg<TYPE>(const Arguments& arg); \
+    template void testing_gpsv_no_pivot_strided_batch<TYPE>(const Arguments& arg)
+INSTANTIATE(float);
+INSTANTIATE(double);
+INSTANTIATE(rocsparse_float_complex);
+INSTANTIATE(rocsparse_double_complex);
@@ -323,6 +323,47 @@ void testing_spgemm_csr_bad_arg(const Arguments& arg)
     CHECK_HIP_ERROR(hipFree(dbuffer));
 }
 
+// Transpose of a host CSR matrix, the host reference operates on op(A) and op(B)
+template <typename T, typename I, typename J>
+static void host_csr_transpose(const host_csr_matrix<T, I, J>& A, host_csr_matrix<T, I, J>& AT)
+{
+    AT.define(A.n, A.m, A.nnz, A.base);
+
+    for(J i = 0; i < A.n + 1; ++i)
+    {
+        AT.ptr[i] = 0;
+    }
+
+    for(I j = 0; j < A.nnz; ++j)
+    {
+        ++AT.ptr[A.ind[j] - A.base + 1];
+    }
+
+    for(J i = 0; i < A.n; ++i)
+    {
+        AT.ptr[i + 1] += AT.ptr[i];
+    }
+
+    for(J i = 0; i < A.m; ++i)
+    {
+        for(I j = A.ptr[i] - A.base; j < A.ptr[i + 1] - A.base; ++j)
+        {
+            I idx = AT.ptr[A.ind[j] - A.base]++;
+
+            AT.ind[idx] = i + A.base;
+            AT.val[idx] = A.val[j];
+        }
+    }
+
+    // Shift back the row pointers and add the index base
+    for(J i = A.n; i > 0; --i)
+    {
+        AT.ptr[i] = AT.ptr[i - 1] + A.base;
+    }
+
+    AT.ptr[0] = A.base;
+}
+
 template <typename I, typename J, typename T>
 void testing_spgemm_csr(const Arguments& arg)
 {
@@ -330,7 +371,7 @@ void testing_spgemm_csr(const Arguments& arg)
     J                    N       = arg.N;
     J                    K       = arg.K;
     rocsparse_operation  trans_A = arg.transA;
-    rocsparse_operation  trans_B = arg.transA;
+    rocsparse_operation  trans_B = arg.transB;
     rocsparse_index_base base_A  = arg.baseA;
     rocsparse_index_base base_B  = arg.baseB;
     rocsparse_index_base base_C  = arg.baseC;
@@ -437,9 +478,15 @@ void testing_spgemm_csr(const Arguments& arg)
     const bool            to_int    = arg.timing ? false : true;
     static constexpr bool full_rank = false;
 
+    // Dimensions of A and B, as they are stored
+    J A_m = (trans_A == rocsparse_operation_none) ? M : K;
+    J A_n = (trans_A == rocsparse_operation_none) ? K : M;
+    J B_m = (trans_B == rocsparse_operation_none) ? K : N;
+    J B_n = (trans_B == rocsparse_operation_none) ? N : K;
+
     {
         rocsparse_matrix_factory<T, I, J> matrix_factory(arg, to_int, full_rank);
-        matrix_factory.init_csr(hA, M, K, arg.baseA);
+        matrix_factory.init_csr(hA, A_m, A_n, arg.baseA);
     }
 
     //
@@ -449,7 +496,7 @@ void testing_spgemm_csr(const Arguments& arg)
         static constexpr bool             noseed = true;
         rocsparse_matrix_factory<T, I, J> matrix_factory(
             arg, rocsparse_matrix_random, to_int, full_rank, noseed);
-        matrix_factory.init_csr(hB, K, N, arg.baseB);
+        matrix_factory.init_csr(hB, B_m, B_n, arg.baseB);
         matrix_factory.init_csr(hD, M, N, arg.baseD);
     }
 
@@ -469,6 +516,20 @@ void testing_spgemm_csr(const Arguments& arg)
         // Compute C on host.
         //
         host_csr hC;
+        host_csr hAT, hBT;
+
+        if(trans_A == rocsparse_operation_transpose)
+        {
+            host_csr_transpose(hA, hAT);
+        }
+
+        if(trans_B == rocsparse_operation_transpose)
+        {
+            host_csr_transpose(hB, hBT);
+        }
+
+        const host_csr& hopA = (trans_A == rocsparse_operation_none) ? hA : hAT;
+        const host_csr& hopB = (trans_B == rocsparse_operation_none) ? hB : hBT;
 
         {
             I hC_nnz = 0;
@@ -477,10 +538,10 @@ void testing_spgemm_csr(const Arguments& arg)
                              N,
                              K,
                              h_alpha_ptr,
-                             hA.ptr,
-                             hA.ind,
-                             hB.ptr,
-                             hB.ind,
+                             hopA.ptr,
+                             hopA.ind,
+                             hopB.ptr,
+                             hopB.ind,
                              h_beta_ptr,
                              hD.ptr,
                              hD.ind,
@@ -497,12 +558,12 @@ void testing_spgemm_csr(const Arguments& arg)
                      N,
                      K,
                      h_alpha_ptr,
-                     hA.ptr,
-                     hA.ind,
-                     hA.val,
-                     hB.ptr,
-                     hB.ind,
-                     hB.val,
+                     hopA.ptr,
+                     hopA.ind,
+                     hopA.val,
+                     hopB.ptr,
+                     hopB.ind,
+                     hopB.val,
                      h_beta_ptr,
                      hD.ptr,
                      hD.ind,
@@ -0,0 +1,462 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing.hpp"
+
+#include "testing_spgemm_semiring.hpp"
+
+static const rocsparse_semiring semirings[] = {rocsparse_semiring_plus_times,
+                                               rocsparse_semiring_min_plus,
+                                               rocsparse_semiring_max_times,
+                                               rocsparse_semiring_or_and,
+                                               rocsparse_semiring_plus_pair};
+
+template <typename I, typename J, typename T>
+void testing_spgemm_semiring_bad_arg(const Arguments& arg)
+{
+    J m     = 100;
+    J n     = 100;
+    J k     = 100;
+    I nnz_A = 100;
+    I nnz_B = 100;
+    I nnz_C = 100;
+
+    T alpha = 0.6;
+
+    rocsparse_operation    trans    = rocsparse_operation_none;
+    rocsparse_semiring     semiring = rocsparse_semiring_min_plus;
+    rocsparse_index_base   base     = rocsparse_index_base_zero;
+    rocsparse_spgemm_alg   alg      = rocsparse_spgemm_alg_default;
+    rocsparse_spgemm_stage stage    = rocsparse_spgemm_stage_auto;
+
+    // Index and data type
+    rocsparse_indextype itype = get_indextype<I>();
+    rocsparse_indextype jtype = get_indextype<J>();
+    rocsparse_datatype  ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    // Allocate memory on device
+    device_vector<I> dcsr_row_ptr_A(m + 1);
+    device_vector<J> dcsr_col_ind_A(nnz_A);
+    device_vector<T> dcsr_val_A(nnz_A);
+    device_vector<I> dcsr_row_ptr_B(k + 1);
+    device_vector<J> dcsr_col_ind_B(nnz_B);
+    device_vector<T> dcsr_val_B(nnz_B);
+    device_vector<I> dcsr_row_ptr_C(m + 1);
+    device_vector<J> dcsr_col_ind_C(nnz_C);
+    device_vector<T> dcsr_val_C(nnz_C);
+
+    if(!dcsr_row_ptr_A || !dcsr_col_ind_A || !dcsr_val_A || !dcsr_row_ptr_B || !dcsr_col_ind_B
+       || !dcsr_val_B || !dcsr_row_ptr_C || !dcsr_col_ind_C || !dcsr_val_C)
+    {
+        CHECK_HIP_ERROR(hipErrorOutOfMemory);
+        return;
+    }
+
+    // SpGEMM structures
+    rocsparse_local_spmat A(m,
+                            k,
+                            nnz_A,
+                            dcsr_row_ptr_A,
+                            dcsr_col_ind_A,
+                            dcsr_val_A,
+                            itype,
+                            jtype,
+                            base,
+                            ttype,
+                            rocsparse_format_csr);
+    rocsparse_local_spmat B(k,
+                            n,
+                            nnz_B,
+                            dcsr_row_ptr_B,
+                            dcsr_col_ind_B,
+                            dcsr_val_B,
+                            itype,
+                            jtype,
+                            base,
+                            ttype,
+                            rocsparse_format_csr);
+    rocsparse_local_spmat C(m,
+                            n,
+                            nnz_C,
+                            dcsr_row_ptr_C,
+                            dcsr_col_ind_C,
+                            dcsr_val_C,
+                            itype,
+                            jtype,
+                            base,
+                            ttype,
+                            rocsparse_format_csr);
+
+    size_t buffer_size;
+
+#define PARAMS(handle_, semiring_, alpha_, A_, B_, C_, buffer_size_) \
+    handle_, trans, trans, semiring_, alpha_, A_, B_, C_, ttype, alg, stage, buffer_size_, nullptr
+
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spgemm_semiring(PARAMS(nullptr, semiring, &alpha, A, B, C, &buffer_size)),
+        rocsparse_status_invalid_handle);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spgemm_semiring(PARAMS(handle, semiring, &alpha, nullptr, B, C, &buffer_size)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spgemm_semiring(PARAMS(handle, semiring, &alpha, A, nullptr, C, &buffer_size)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spgemm_semiring(PARAMS(handle, semiring, &alpha, A, B, nullptr, &buffer_size)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spgemm_semiring(PARAMS(handle, semiring, nullptr, A, B, C, &buffer_size)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(
+        rocsparse_spgemm_semiring(PARAMS(handle, semiring, &alpha, A, B, C, nullptr)),
+        rocsparse_status_invalid_pointer);
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spgemm_semiring(PARAMS(
+                                handle, (rocsparse_semiring)-1, &alpha, A, B, C, &buffer_size)),
+                            rocsparse_status_invalid_value);
+
+#undef PARAMS
+}
+
+template <typename I, typename J, typename T>
+void testing_spgemm_semiring(const Arguments& arg)
+{
+    J                    M       = arg.M;
+    J                    N       = arg.N;
+    J                    K       = arg.K;
+    rocsparse_operation  trans_A = arg.transA;
+    rocsparse_operation  trans_B = arg.transB;
+    rocsparse_index_base base_A  = arg.baseA;
+    rocsparse_index_base base_B  = arg.baseB;
+    rocsparse_index_base base_C  = arg.baseC;
+    rocsparse_spgemm_alg alg     = arg.spgemm_alg;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    // Index and data type
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    // SpGEMM stage
+    rocsparse_spgemm_stage stage = rocsparse_spgemm_stage_auto;
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+    using host_csr   = host_csr_matrix<T, I, J>;
+    using device_csr = device_csr_matrix<T, I, J>;
+
+#define PARAMS(alpha_, A_, B_, C_, buffer_)                                                    \
+    handle, trans_A, trans_B, semiring, alpha_, A_, B_, C_, ttype, alg, stage, &buffer_size, \
+        buffer_
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        if(M < 0 || N < 0 || K < 0)
+        {
+            return;
+        }
+
+        device_csr dA(M, K, static_cast<I>(0), base_A);
+        device_csr dB(K, N, static_cast<I>(0), base_B);
+        device_csr dC(M, N, static_cast<I>(0), base_C);
+
+        rocsparse_local_spmat A(dA), B(dB), C(dC);
+
+        CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+        for(rocsparse_semiring semiring : semirings)
+        {
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spgemm_semiring(PARAMS(&h_alpha, A, B, C, dbuffer)),
+                                    rocsparse_status_success);
+
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, 1));
+
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spgemm_semiring(PARAMS(&h_alpha, A, B, C, dbuffer)),
+                                    rocsparse_status_success);
+
+            // Verify that nnz_C is equal to zero
+            {
+                int64_t                  rows_C;
+                int64_t                  cols_C;
+                int64_t                  nnz_C;
+                static constexpr int64_t zero = 0;
+                CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C, &rows_C, &cols_C, &nnz_C));
+                unit_check_general(1, 1, 1, &zero, &nnz_C);
+            }
+
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+        }
+
+        return;
+    }
+
+    // Init matrix A from the input rocsparse_matrix_init
+    host_csr hA, hB;
+
+    const bool            to_int    = arg.timing ? false : true;
+    static constexpr bool full_rank = false;
+
+    {
+        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, to_int, full_rank);
+        matrix_factory.init_csr(hA, M, K, base_A);
+    }
+
+    // Init matrix B from rocsparse_matrix_init random
+    {
+        static constexpr bool             noseed = true;
+        rocsparse_matrix_factory<T, I, J> matrix_factory(
+            arg, rocsparse_matrix_random, to_int, full_rank, noseed);
+        matrix_factory.init_csr(hB, K, N, base_B);
+    }
+
+    device_csr dA(hA), dB(hB);
+
+    rocsparse_local_spmat A(dA), B(dB);
+
+    // The sparsity pattern of C does not depend on the semiring
+    host_csr hC;
+
+    {
+        I hC_nnz = 0;
+        hC.define(M, N, hC_nnz, base_C);
+        host_csrgemm_nnz<I, J, T>(M,
+                                  N,
+                                  K,
+                                  &h_alpha,
+                                  hA.ptr,
+                                  hA.ind,
+                                  hB.ptr,
+                                  hB.ind,
+                                  nullptr,
+                                  hA.ptr,
+                                  hA.ind,
+                                  hC.ptr,
+                                  &hC_nnz,
+                                  hA.base,
+                                  hB.base,
+                                  hC.base,
+                                  hA.base);
+        hC.define(hC.m, hC.n, hC_nnz, hC.base);
+    }
+
+    for(rocsparse_semiring semiring : semirings)
+    {
+        if(arg.unit_check)
+        {
+            // Compute C on host
+            host_csrgemm_semiring(semiring,
+                                  M,
+                                  N,
+                                  h_alpha,
+                                  hA.ptr,
+                                  hA.ind,
+                                  hA.val,
+                                  hB.ptr,
+                                  hB.ind,
+                                  hB.val,
+                                  hC.ptr,
+                                  hC.ind,
+                                  hC.val,
+                                  hA.base,
+                                  hB.base,
+                                  hC.base);
+
+            // Compute C on device with mode host
+            {
+                device_csr dC;
+                dC.define(M, N, 0, base_C);
+                rocsparse_local_spmat C(dC);
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+                size_t buffer_size;
+                void*  dbuffer = nullptr;
+
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm_semiring(PARAMS(&h_alpha, A, B, C, dbuffer)));
+                CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+                // Compute symbolic C
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm_semiring(PARAMS(&h_alpha, A, B, C, dbuffer)));
+
+                // Update memory
+                {
+                    int64_t C_m, C_n, C_nnz;
+                    CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C, &C_m, &C_n, &C_nnz));
+                    dC.define(dC.m, dC.n, C_nnz, dC.base);
+                    CHECK_ROCSPARSE_ERROR(
+                        rocsparse_csr_set_pointers(C, dC.ptr, dC.ind, dC.val));
+                }
+
+                // Compute numeric C
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm_semiring(PARAMS(&h_alpha, A, B, C, dbuffer)));
+                CHECK_HIP_ERROR(hipFree(dbuffer));
+
+                hC.near_check(dC);
+            }
+
+            // Compute C on device with mode device
+            {
+                device_scalar<T> d_alpha(h_alpha);
+
+                device_csr dC;
+                dC.define(M, N, 0, base_C);
+                rocsparse_local_spmat C(dC);
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+
+                size_t buffer_size;
+                void*  dbuffer = nullptr;
+
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm_semiring(PARAMS(d_alpha, A, B, C, dbuffer)));
+                CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+
+                // Compute symbolic C
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm_semiring(PARAMS(d_alpha, A, B, C, dbuffer)));
+
+                // Update memory
+                {
+                    int64_t C_m, C_n, C_nnz;
+                    CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C, &C_m, &C_n, &C_nnz));
+                    dC.define(dC.m, dC.n, C_nnz, dC.base);
+                    CHECK_ROCSPARSE_ERROR(
+                        rocsparse_csr_set_pointers(C, dC.ptr, dC.ind, dC.val));
+                }
+
+                // Compute numeric C
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm_semiring(PARAMS(d_alpha, A, B, C, dbuffer)));
+                CHECK_HIP_ERROR(hipFree(dbuffer));
+
+                hC.near_check(dC);
+            }
+        }
+
+        if(arg.timing)
+        {
+            int number_cold_calls = 2;
+            int number_hot_calls  = arg.iters;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            device_csr dC;
+            dC.define(M, N, 0, base_C);
+            rocsparse_local_spmat C(dC);
+
+            size_t buffer_size;
+            void*  dbuffer = nullptr;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_spgemm_semiring(PARAMS(&h_alpha, A, B, C, dbuffer)));
+            CHECK_HIP_ERROR(hipMalloc(&dbuffer, buffer_size));
+            CHECK_ROCSPARSE_ERROR(rocsparse_spgemm_semiring(PARAMS(&h_alpha, A, B, C, dbuffer)));
+
+            int64_t C_m, C_n, C_nnz;
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmat_get_size(C, &C_m, &C_n, &C_nnz));
+            dC.define(dC.m, dC.n, C_nnz, dC.base);
+            CHECK_ROCSPARSE_ERROR(rocsparse_csr_set_pointers(C, dC.ptr, dC.ind, dC.val));
+
+            // Warm up
+            for(int iter = 0; iter < number_cold_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm_semiring(PARAMS(&h_alpha, A, B, C, dbuffer)));
+            }
+
+            double gpu_time_used = get_time_us();
+
+            // Performance run
+            for(int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_spgemm_semiring(PARAMS(&h_alpha, A, B, C, dbuffer)));
+            }
+
+            gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+            CHECK_HIP_ERROR(hipFree(dbuffer));
+
+            double gpu_gflops = csrgemm_gflop_count<T, I, J>(M,
+                                                             &h_alpha,
+                                                             hA.ptr.data(),
+                                                             hA.ind.data(),
+                                                             hB.ptr.data(),
+                                                             (const T*)nullptr,
+                                                             (const I*)nullptr,
+                                                             dA.base)
+                                / gpu_time_used * 1e6;
+
+            double gpu_gbyte = csrgemm_gbyte_count<I, J, T>(
+                                   M, N, K, dA.nnz, dB.nnz, C_nnz, 0, &h_alpha, (const T*)nullptr)
+                               / gpu_time_used * 1e6;
+
+            display_timing_info("M",
+                                M,
+                                "N",
+                                N,
+                                "K",
+                                K,
+                                "nnz_A",
+                                dA.nnz,
+                                "nnz_B",
+                                dB.nnz,
+                                "nnz_C",
+                                C_nnz,
+                                "semiring",
+                                rocsparse_semiring2string(semiring),
+                                "alpha",
+                                h_alpha,
+                                "GFlop/s",
+                                gpu_gflops,
+                                "GB/s",
+                                gpu_gbyte,
+                                "msec",
+                                get_gpu_time_msec(gpu_time_used),
+                                "iter",
+                                number_hot_calls,
+                                "verified",
+                                (arg.unit_check ? "yes" : "no"));
+        }
+    }
+
+#undef PARAMS
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                      \
+    template void testing_spgemm_semiring_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spgemm_semiring<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
@@ -0,0 +1,247 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "auto_testing_bad_arg.hpp"
+#include "testing.hpp"
+
+#include "testing_spmv_semiring.hpp"
+
+static const rocsparse_semiring semirings[] = {rocsparse_semiring_plus_times,
+                                               rocsparse_semiring_min_plus,
+                                               rocsparse_semiring_max_times,
+                                               rocsparse_semiring_or_and,
+                                               rocsparse_semiring_plus_pair};
+
+template <typename I, typename J, typename T>
+void testing_spmv_semiring_bad_arg(const Arguments& arg)
+{
+    T alpha = 0.6;
+    T beta  = 0.1;
+
+    rocsparse_local_handle local_handle;
+
+    rocsparse_handle    handle   = local_handle;
+    rocsparse_operation trans    = rocsparse_operation_none;
+    rocsparse_semiring  semiring = rocsparse_semiring_min_plus;
+    const void*         p_alpha  = (const void*)&alpha;
+    const void*         p_beta   = (const void*)&beta;
+    rocsparse_datatype  ttype    = get_datatype<T>();
+
+#define PARAMS                                                                         \
+    handle, trans, semiring, p_alpha, (const rocsparse_spmat_descr&)A,                 \
+        (const rocsparse_dnvec_descr&)x, p_beta, (const rocsparse_dnvec_descr&)y, ttype
+
+    device_dense_matrix<T>     dx, dy;
+    device_csr_matrix<T, I, J> dA;
+    rocsparse_local_spmat      A(dA);
+    rocsparse_local_dnvec      x(dx);
+    rocsparse_local_dnvec      y(dy);
+
+    auto_testing_bad_arg(rocsparse_spmv_semiring, PARAMS);
+
+    // Only non-transposed general matrices are supported
+    trans = rocsparse_operation_transpose;
+    EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_semiring(PARAMS), rocsparse_status_not_implemented);
+
+#undef PARAMS
+}
+
+template <typename I, typename J, typename T>
+void testing_spmv_semiring(const Arguments& arg)
+{
+    J                    M     = arg.M;
+    J                    N     = arg.N;
+    rocsparse_operation  trans = arg.transA;
+    rocsparse_index_base base  = arg.baseA;
+
+    rocsparse_datatype ttype = get_datatype<T>();
+
+    // Create rocsparse handle
+    rocsparse_local_handle handle;
+
+    host_scalar<T> h_alpha(arg.get_alpha<T>());
+    host_scalar<T> h_beta(arg.get_beta<T>());
+
+#define PARAMS(alpha_, A_, x_, beta_, y_) handle, trans, semiring, alpha_, A_, x_, beta_, y_, ttype
+
+    // Argument sanity check before allocating invalid memory
+    if(M <= 0 || N <= 0)
+    {
+        if(M == 0 || N == 0)
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            device_csr_matrix<T, I, J> dA;
+            device_dense_matrix<T>     dx, dy;
+
+            rocsparse_local_spmat A(dA);
+            rocsparse_local_dnvec x(dx);
+            rocsparse_local_dnvec y(dy);
+
+            for(rocsparse_semiring semiring : semirings)
+            {
+                EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_semiring(PARAMS(h_alpha, A, x, h_beta, y)),
+                                        rocsparse_status_success);
+            }
+        }
+
+        return;
+    }
+
+    // Initialize the sparse matrix
+    host_csr_matrix<T, I, J> hA;
+
+    {
+        static constexpr bool             full_rank = false;
+        rocsparse_matrix_factory<T, I, J> matrix_factory(arg, arg.timing ? false : true, full_rank);
+        matrix_factory.init_csr(hA, M, N, base);
+    }
+
+    device_csr_matrix<T, I, J> dA(hA);
+
+    host_dense_matrix<T> hx(N, 1);
+    rocsparse_matrix_utils::init_exact(hx);
+    device_dense_matrix<T> dx(hx);
+
+    host_dense_matrix<T> hy(M, 1);
+    rocsparse_matrix_utils::init_exact(hy);
+    device_dense_matrix<T> dy(hy);
+
+    rocsparse_local_spmat A(dA);
+    rocsparse_local_dnvec x(dx);
+    rocsparse_local_dnvec y(dy);
+
+    for(rocsparse_semiring semiring : semirings)
+    {
+        // (+, pair) does not support the accumulation into y
+        if(semiring == rocsparse_semiring_plus_pair && *h_beta != static_cast<T>(0))
+        {
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_semiring(PARAMS(h_alpha, A, x, h_beta, y)),
+                                    rocsparse_status_invalid_value);
+
+            device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+            CHECK_ROCSPARSE_ERROR(
+                rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+            EXPECT_ROCSPARSE_STATUS(rocsparse_spmv_semiring(PARAMS(d_alpha, A, x, d_beta, y)),
+                                    rocsparse_status_invalid_value);
+
+            continue;
+        }
+
+        if(arg.unit_check)
+        {
+            host_dense_matrix<T> hy_copy(hy);
+
+            // Pointer mode host
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+            CHECK_ROCSPARSE_ERROR(rocsparse_spmv_semiring(PARAMS(h_alpha, A, x, h_beta, y)));
+
+            // CPU csrmv
+            host_dense_matrix<T> hy_gold(hy);
+            host_csrmv_semiring<I, J, T>(
+                semiring, M, *h_alpha, hA.ptr, hA.ind, hA.val, hx, *h_beta, hy_gold, hA.base);
+            hy_gold.near_check(dy);
+
+            // Pointer mode device
+            dy.transfer_from(hy_copy);
+            {
+                device_scalar<T> d_alpha(h_alpha), d_beta(h_beta);
+                CHECK_ROCSPARSE_ERROR(
+                    rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_device));
+                CHECK_ROCSPARSE_ERROR(rocsparse_spmv_semiring(PARAMS(d_alpha, A, x, d_beta, y)));
+            }
+
+            hy_gold.near_check(dy);
+            dy.transfer_from(hy_copy);
+        }
+
+        if(arg.timing)
+        {
+            int number_cold_calls = 2;
+            int number_hot_calls  = arg.iters;
+
+            CHECK_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+            // Warm up
+            for(int iter = 0; iter < number_cold_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_spmv_semiring(PARAMS(h_alpha, A, x, h_beta, y)));
+            }
+
+            double gpu_time_used = get_time_us();
+
+            // Performance run
+            for(int iter = 0; iter < number_hot_calls; ++iter)
+            {
+                CHECK_ROCSPARSE_ERROR(rocsparse_spmv_semiring(PARAMS(h_alpha, A, x, h_beta, y)));
+            }
+
+            gpu_time_used = (get_time_us() - gpu_time_used) / number_hot_calls;
+
+            double gflop_count = spmv_gflop_count(dA.m, dA.nnz, *h_beta != static_cast<T>(0));
+            double gbyte_count
+                = csrmv_gbyte_count<T>(dA.m, dA.n, dA.nnz, *h_beta != static_cast<T>(0));
+
+            double gpu_gflops = get_gpu_gflops(gpu_time_used, gflop_count);
+            double gpu_gbyte  = get_gpu_gbyte(gpu_time_used, gbyte_count);
+
+            display_timing_info("M",
+                                M,
+                                "N",
+                                N,
+                                "nnz",
+                                dA.nnz,
+                                "semiring",
+                                rocsparse_semiring2string(semiring),
+                                "alpha",
+                                *h_alpha,
+                                "beta",
+                                *h_beta,
+                                "GFlop/s",
+                                gpu_gflops,
+                                "GB/s",
+                                gpu_gbyte,
+                                "msec",
+                                get_gpu_time_msec(gpu_time_used),
+                                "iter",
+                                number_hot_calls,
+                                "verified",
+                                (arg.unit_check ? "yes" : "no"));
+        }
+    }
+
+#undef PARAMS
+}
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                    \
+    template void testing_spmv_semiring_bad_arg<ITYPE, JTYPE, TTYPE>(const Arguments& arg); \
+    template void testing_spmv_semiring<ITYPE, JTYPE, TTYPE>(const Arguments& arg)
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
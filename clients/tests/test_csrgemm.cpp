@@ -57,6 +57,8 @@ namespace
                 testing_csrgemm<T>(arg);
             else if(!strcmp(arg.function, "csrgemm_bad_arg"))
                 testing_csrgemm_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "csrgemm_symmetric"))
+                testing_csrgemm_symmetric<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -73,7 +75,8 @@ namespace
         // Filter for which functions apply to this suite
         static bool function_filter(const Arguments& arg)
         {
-            return !strcmp(arg.function, "csrgemm") || !strcmp(arg.function, "csrgemm_bad_arg");
+            return !strcmp(arg.function, "csrgemm") || !strcmp(arg.function, "csrgemm_bad_arg")
+                   || !strcmp(arg.function, "csrgemm_symmetric");
         }
 
         // Google Test name suffix based on parameters
@@ -173,6 +173,54 @@ ROCSPARSE_EXPORT
 rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle        handle,
                                             rocsparse_pointer_mode* pointer_mode);
 
+/*! \ingroup aux_module
+ *  \brief Specify device memory budget
+ *
+ *  \details
+ *  \p rocsparse_set_memory_budget limits the amount of device memory, in bytes, that
+ *  analysis functions of the rocSPARSE library context may allocate to store optional
+ *  meta data. If storing meta data would exceed the budget, an algorithm that requires
+ *  less memory is selected instead. Currently, rocsparse_scsrsv_analysis(),
+ *  rocsparse_dcsrsv_analysis(), rocsparse_ccsrsv_analysis() and
+ *  rocsparse_zcsrsv_analysis() only store the transposed sparsity pattern for
+ *  \ref rocsparse_operation_transpose if it fits into the budget. Otherwise, the
+ *  transposed triangular solve operates on the original matrix. Similarly, the csrgemm
+ *  functions use the expand-sort-compress algorithm for rows of the product with a large
+ *  number of non-zero entries only if its workspace fits into the budget. The workspace
+ *  is sized together with the row grouping of the product and kept for subsequent calls.
+ *  By default, the budget is unlimited and the expand-sort-compress workspace is limited
+ *  to an eighth of the device memory.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[in]
+ *  budget  the device memory budget in bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_set_memory_budget(rocsparse_handle handle, size_t budget);
+
+/*! \ingroup aux_module
+ *  \brief Get current device memory budget from library context
+ *
+ *  \details
+ *  \p rocsparse_get_memory_budget gets the device memory budget, in bytes, of the
+ *  rocSPARSE library context.
+ *
+ *  @param[in]
+ *  handle  the handle to the rocSPARSE library context.
+ *  @param[out]
+ *  budget  the device memory budget in bytes.
+ *
+ *  \retval rocsparse_status_success the operation completed successfully.
+ *  \retval rocsparse_status_invalid_handle \p handle is invalid.
+ *  \retval rocsparse_status_invalid_pointer \p budget pointer is invalid.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_get_memory_budget(rocsparse_handle handle, size_t* budget);
+
 /*! \ingroup aux_module
  *  \brief Get rocSPARSE version
  *
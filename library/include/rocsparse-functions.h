@@ -892,6 +892,9 @@ rocsparse_status rocsparse_zbsrsv_buffer_size(rocsparse_handle                ha
 *  performance of meta data. However, the user need to make sure that the sparsity
 *  pattern remains unchanged. If this cannot be assured,
 *  \ref rocsparse_analysis_policy_force has to be used.
+*  If only the values of the matrix have changed since the previous analysis,
+*  \ref rocsparse_analysis_policy_numeric re-uses the meta data after verifying a
+*  fingerprint of the sparsity pattern on the device, and re-builds it otherwise.
 *
 *  \note
 *  If the matrix sparsity pattern changes, the gathered information will become invalid.
@@ -926,8 +929,9 @@ rocsparse_status rocsparse_zbsrsv_buffer_size(rocsparse_handle                ha
 *  info        structure that holds the information collected during
 *              the analysis step.
 *  @param[in]
-*  analysis    \ref rocsparse_analysis_policy_reuse or
-*              \ref rocsparse_analysis_policy_force.
+*  analysis    \ref rocsparse_analysis_policy_reuse,
+*              \ref rocsparse_analysis_policy_force or
+*              \ref rocsparse_analysis_policy_numeric.
 *  @param[in]
 *  solve       \ref rocsparse_solve_policy_auto.
 *  @param[in]
@@ -1800,6 +1804,89 @@ rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle          handle,
                                             rocsparse_mat_info        info,
                                             rocsparse_int*            position);
 
+/*! \ingroup level2_module
+*  \brief Sparse triangular solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrsv_level_info returns the number of levels of the dependency graph
+*  that has been computed during rocsparse_scsrsv_analysis(),
+*  rocsparse_dcsrsv_analysis(), rocsparse_ccsrsv_analysis() or
+*  rocsparse_zcsrsv_analysis(). Rows within the same level do not depend on each other
+*  and are processed as a single batch, if the solve is run with
+*  \ref rocsparse_solve_policy_level_set. The number of levels can be used to estimate
+*  whether the level-set or the sync-free scheme is more appropriate for a given matrix.
+*  If no analysis data is available, \p nlevels is set to 0. This is also the case for
+*  \ref rocsparse_operation_transpose, if the transposed matrix has not been stored
+*  due to the memory budget, see rocsparse_set_memory_budget().
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  trans       matrix operation type.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[out]
+*  nlevels     number of levels, in host memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_value \p trans is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p info or \p nlevels pointer
+*              is invalid.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans == \ref rocsparse_operation_conjugate_transpose.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_level_info(rocsparse_handle          handle,
+                                            rocsparse_operation       trans,
+                                            const rocsparse_mat_descr descr,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int*            nlevels);
+
+/*! \ingroup level2_module
+*  \brief Sparse triangular solve using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrsv_jacobi_sweeps sets the number of Jacobi sweeps that are performed
+*  by rocsparse_scsrsv_solve(), rocsparse_dcsrsv_solve(), rocsparse_ccsrsv_solve() and
+*  rocsparse_zcsrsv_solve(), if the \p info structure is passed. For \p nsweeps > 0, the
+*  triangular system is not solved exactly. Instead, starting with \f$y_0 = 0\f$, the
+*  iteration
+*  \f[
+*    y_{k+1} = D^{-1} \left(\alpha \cdot x - (op(A) - D) \cdot y_k\right)
+*  \f]
+*  is performed \p nsweeps times, where \f$D\f$ is the diagonal of \f$op(A)\f$. Each
+*  sweep is fully parallel and does not depend on the level structure of the matrix,
+*  which makes this mode suitable for preconditioning. The result is exact, if \p nsweeps
+*  is at least the number of levels returned by rocsparse_csrsv_level_info().
+*  Setting \p nsweeps to 0 restores the exact solve, which is the default.
+*  Transposed solves that operate on the original matrix, see
+*  rocsparse_set_memory_budget(), are always exact.
+*
+*  \note
+*  The diagonal entries are taken from the analysis data, thus
+*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(), rocsparse_ccsrsv_analysis()
+*  or rocsparse_zcsrsv_analysis() is still required.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  nsweeps     number of Jacobi sweeps, or 0 for the exact solve.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p nsweeps is invalid.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsv_jacobi_sweeps(rocsparse_handle   handle,
+                                               rocsparse_mat_info info,
+                                               rocsparse_int      nsweeps);
+
 /*! \ingroup level2_module
 *  \brief Sparse triangular solve using CSR storage format
 *
@@ -1922,6 +2009,9 @@ rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle                ha
 *  performance of meta data. However, the user need to make sure that the sparsity
 *  pattern remains unchanged. If this cannot be assured,
 *  \ref rocsparse_analysis_policy_force has to be used.
+*  If only the values of the matrix have changed since the previous analysis,
+*  \ref rocsparse_analysis_policy_numeric re-uses the meta data after verifying a
+*  fingerprint of the sparsity pattern on the device, and re-builds it otherwise.
 *
 *  \note
 *  If the matrix sparsity pattern changes, the gathered information will become invalid.
@@ -1952,8 +2042,9 @@ rocsparse_status rocsparse_zcsrsv_buffer_size(rocsparse_handle                ha
 *  info        structure that holds the information collected during
 *              the analysis step.
 *  @param[in]
-*  analysis    \ref rocsparse_analysis_policy_reuse or
-*              \ref rocsparse_analysis_policy_force.
+*  analysis    \ref rocsparse_analysis_policy_reuse,
+*              \ref rocsparse_analysis_policy_force or
+*              \ref rocsparse_analysis_policy_numeric.
 *  @param[in]
 *  solve       \ref rocsparse_solve_policy_auto.
 *  @param[in]
@@ -3824,6 +3915,9 @@ rocsparse_status rocsparse_zcsrsm_buffer_size(rocsparse_handle                ha
 *  performance of meta data. However, the user need to make sure that the sparsity
 *  pattern remains unchanged. If this cannot be assured,
 *  \ref rocsparse_analysis_policy_force has to be used.
+*  If only the values of the matrix have changed since the previous analysis,
+*  \ref rocsparse_analysis_policy_numeric re-uses the meta data after verifying a
+*  fingerprint of the sparsity pattern on the device, and re-builds it otherwise.
 *
 *  \note
 *  If the matrix sparsity pattern changes, the gathered information will become invalid.
@@ -3863,8 +3957,9 @@ rocsparse_status rocsparse_zcsrsm_buffer_size(rocsparse_handle                ha
 *  @param[out]
 *  info        structure that holds the information collected during the analysis step.
 *  @param[in]
-*  analysis    \ref rocsparse_analysis_policy_reuse or
-*              \ref rocsparse_analysis_policy_force.
+*  analysis    \ref rocsparse_analysis_policy_reuse,
+*              \ref rocsparse_analysis_policy_force or
+*              \ref rocsparse_analysis_policy_numeric.
 *  @param[in]
 *  solve       \ref rocsparse_solve_policy_auto.
 *  @param[in]
@@ -4482,13 +4577,13 @@ rocsparse_status rocsparse_zgemmi(rocsparse_handle                handle,
 */
 
 /*! \ingroup extra_module
-*  \brief Sparse matrix sparse matrix addition using CSR storage format
+*  \brief Sparse matrix sparse matrix addition using BSR storage format
 *
 *  \details
-*  \p rocsparse_csrgeam_nnz computes the total CSR non-zero elements and the CSR row
-*  offsets, that point to the start of every row of the sparse CSR matrix, of the
-*  resulting matrix C. It is assumed that \p csr_row_ptr_C has been allocated with
-*  size \p m + 1.
+*  \p rocsparse_bsrgeam_nnzb computes the total BSR non-zero blocks and the BSR row
+*  offsets, that point to the start of every block row of the sparse BSR matrix, of the
+*  resulting matrix C. The block pattern of C is the union of the block patterns of A
+*  and B. It is assumed that \p bsr_row_ptr_C has been allocated with size \p mb + 1.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -4499,83 +4594,95 @@ rocsparse_status rocsparse_zgemmi(rocsparse_handle                handle,
 *  @param[in]
 *  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  m               number of rows of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  dir             storage format of the blocks, \ref rocsparse_direction_row or
+*                  \ref rocsparse_direction_column.
 *  @param[in]
-*  n               number of columns of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  mb              number of block rows of the sparse BSR matrix \f$A\f$, \f$B\f$ and
+*                  \f$C\f$.
 *  @param[in]
-*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*  nb              number of block columns of the sparse BSR matrix \f$A\f$, \f$B\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  block_dim       block dimension of the sparse BSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse BSR matrix \f$A\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  nnzb_A          number of non-zero blocks of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$A\f$.
+*  bsr_row_ptr_A   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
-*                  sparse CSR matrix \f$A\f$.
+*  bsr_col_ind_A   array of \p nnzb_A elements containing the block column indices of
+*                  the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*  descr_B         descriptor of the sparse BSR matrix \f$B\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  nnzb_B          number of non-zero blocks of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$B\f$.
+*  bsr_row_ptr_B   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
-*                  sparse CSR matrix \f$B\f$.
+*  bsr_col_ind_B   array of \p nnzb_B elements containing the block column indices of
+*                  the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*  descr_C         descriptor of the sparse BSR matrix \f$C\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[out]
-*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$C\f$.
+*  bsr_row_ptr_C   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$C\f$.
 *  @param[out]
-*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
-*                  matrix \f$C\f$. \p nnz_C can be a host or device pointer.
+*  nnzb_C          pointer to the number of non-zero blocks of the sparse BSR matrix
+*                  \f$C\f$. \p nnzb_C can be a host or device pointer.
 *
 *  \retval rocsparse_status_success the operation completed successfully.
 *  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is invalid.
-*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
-*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
-*          \p descr_C, \p csr_row_ptr_C or \p nnz_C is invalid.
+*  \retval rocsparse_status_invalid_size \p mb, \p nb, \p block_dim, \p nnzb_A or
+*          \p nnzb_B is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p bsr_row_ptr_A,
+*          \p bsr_col_ind_A, \p descr_B, \p bsr_row_ptr_B, \p bsr_col_ind_B,
+*          \p descr_C, \p bsr_row_ptr_C or \p nnzb_C is invalid.
+*  \retval rocsparse_status_invalid_value \p dir is invalid.
 *  \retval rocsparse_status_not_implemented
 *          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrgeam_nnz(rocsparse_handle          handle,
-                                       rocsparse_int             m,
-                                       rocsparse_int             n,
-                                       const rocsparse_mat_descr descr_A,
-                                       rocsparse_int             nnz_A,
-                                       const rocsparse_int*      csr_row_ptr_A,
-                                       const rocsparse_int*      csr_col_ind_A,
-                                       const rocsparse_mat_descr descr_B,
-                                       rocsparse_int             nnz_B,
-                                       const rocsparse_int*      csr_row_ptr_B,
-                                       const rocsparse_int*      csr_col_ind_B,
-                                       const rocsparse_mat_descr descr_C,
-                                       rocsparse_int*            csr_row_ptr_C,
-                                       rocsparse_int*            nnz_C);
+rocsparse_status rocsparse_bsrgeam_nnzb(rocsparse_handle          handle,
+                                        rocsparse_direction       dir,
+                                        rocsparse_int             mb,
+                                        rocsparse_int             nb,
+                                        rocsparse_int             block_dim,
+                                        const rocsparse_mat_descr descr_A,
+                                        rocsparse_int             nnzb_A,
+                                        const rocsparse_int*      bsr_row_ptr_A,
+                                        const rocsparse_int*      bsr_col_ind_A,
+                                        const rocsparse_mat_descr descr_B,
+                                        rocsparse_int             nnzb_B,
+                                        const rocsparse_int*      bsr_row_ptr_B,
+                                        const rocsparse_int*      bsr_col_ind_B,
+                                        const rocsparse_mat_descr descr_C,
+                                        rocsparse_int*            bsr_row_ptr_C,
+                                        rocsparse_int*            nnzb_C);
 
 /*! \ingroup extra_module
-*  \brief Sparse matrix sparse matrix addition using CSR storage format
+*  \brief Sparse matrix sparse matrix addition using BSR storage format
 *
 *  \details
-*  \p rocsparse_csrgeam multiplies the scalar \f$\alpha\f$ with the sparse
-*  \f$m \times n\f$ matrix \f$A\f$, defined in CSR storage format, multiplies the
-*  scalar \f$\beta\f$ with the sparse \f$m \times n\f$ matrix \f$B\f$, defined in CSR
-*  storage format, and adds both resulting matrices to obtain the sparse
-*  \f$m \times n\f$ matrix \f$C\f$, defined in CSR storage format, such that
+*  \p rocsparse_bsrgeam multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$mb \times nb\f$ block matrix \f$A\f$, defined in BSR storage format, multiplies
+*  the scalar \f$\beta\f$ with the sparse \f$mb \times nb\f$ block matrix \f$B\f$,
+*  defined in BSR storage format, and adds both resulting matrices to obtain the sparse
+*  \f$mb \times nb\f$ block matrix \f$C\f$, defined in BSR storage format, such that
 *  \f[
 *    C := \alpha \cdot A + \beta \cdot B.
 *  \f]
 *
-*  It is assumed that \p csr_row_ptr_C has already been filled and that \p csr_val_C and
-*  \p csr_col_ind_C are allocated by the user. \p csr_row_ptr_C and allocation size of
-*  \p csr_col_ind_C and \p csr_val_C is defined by the number of non-zero elements of
-*  the sparse CSR matrix C. Both can be obtained by rocsparse_csrgeam_nnz().
+*  It is assumed that \p bsr_row_ptr_C has already been filled and that \p bsr_val_C
+*  and \p bsr_col_ind_C are allocated by the user. \p bsr_row_ptr_C and allocation size
+*  of \p bsr_col_ind_C and \p bsr_val_C is defined by the number of non-zero blocks of
+*  the sparse BSR matrix C. Both can be obtained by rocsparse_bsrgeam_nnzb(). The
+*  allocation size of \p bsr_val_C is \p nnzb_C * \p block_dim * \p block_dim.
 *
 *  \note Both scalars \f$\alpha\f$ and \f$beta\f$ have to be valid.
 *  \note Currently, only \ref rocsparse_matrix_type_general is supported.
@@ -4585,300 +4692,257 @@ rocsparse_status rocsparse_csrgeam_nnz(rocsparse_handle          handle,
 *  @param[in]
 *  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  m               number of rows of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  dir             storage format of the blocks, \ref rocsparse_direction_row or
+*                  \ref rocsparse_direction_column.
 *  @param[in]
-*  n               number of columns of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  mb              number of block rows of the sparse BSR matrix \f$A\f$, \f$B\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  nb              number of block columns of the sparse BSR matrix \f$A\f$, \f$B\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  block_dim       block dimension of the sparse BSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
 *  @param[in]
 *  alpha           scalar \f$\alpha\f$.
 *  @param[in]
-*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*  descr_A         descriptor of the sparse BSR matrix \f$A\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  nnzb_A          number of non-zero blocks of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  bsr_val_A       array of \p nnzb_A blocks of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$A\f$.
+*  bsr_row_ptr_A   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
-*                  sparse CSR matrix \f$A\f$.
+*  bsr_col_ind_A   array of \p nnzb_A elements containing the block column indices of
+*                  the sparse BSR matrix \f$A\f$.
 *  @param[in]
 *  beta            scalar \f$\beta\f$.
 *  @param[in]
-*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*  descr_B         descriptor of the sparse BSR matrix \f$B\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  nnzb_B          number of non-zero blocks of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  bsr_val_B       array of \p nnzb_B blocks of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$B\f$.
+*  bsr_row_ptr_B   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
-*                  sparse CSR matrix \f$B\f$.
+*  bsr_col_ind_B   array of \p nnzb_B elements containing the block column indices of
+*                  the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*  descr_C         descriptor of the sparse BSR matrix \f$C\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[out]
-*  csr_val_C       array of elements of the sparse CSR matrix \f$C\f$.
+*  bsr_val_C       array of blocks of the sparse BSR matrix \f$C\f$.
 *  @param[in]
-*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$C\f$.
+*  bsr_row_ptr_C   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$C\f$.
 *  @param[out]
-*  csr_col_ind_C   array of elements containing the column indices of the
-*                  sparse CSR matrix \f$C\f$.
+*  bsr_col_ind_C   array of elements containing the block column indices of the sparse
+*                  BSR matrix \f$C\f$.
 *
 *  \retval rocsparse_status_success the operation completed successfully.
 *  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is invalid.
-*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_A, \p csr_val_A,
-*          \p csr_row_ptr_A, \p csr_col_ind_A, \p beta, \p descr_B, \p csr_val_B,
-*          \p csr_row_ptr_B, \p csr_col_ind_B, \p descr_C, \p csr_val_C,
-*          \p csr_row_ptr_C or \p csr_col_ind_C is invalid.
+*  \retval rocsparse_status_invalid_size \p mb, \p nb, \p block_dim, \p nnzb_A or
+*          \p nnzb_B is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_A, \p bsr_val_A,
+*          \p bsr_row_ptr_A, \p bsr_col_ind_A, \p beta, \p descr_B, \p bsr_val_B,
+*          \p bsr_row_ptr_B, \p bsr_col_ind_B, \p descr_C, \p bsr_val_C,
+*          \p bsr_row_ptr_C or \p bsr_col_ind_C is invalid.
+*  \retval rocsparse_status_invalid_value \p dir is invalid.
 *  \retval rocsparse_status_not_implemented
 *          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
-*
-*  \par Example
-*  This example adds two CSR matrices.
-*  \code{.c}
-*  // Initialize scalar multipliers
-*  float alpha = 1.0f;
-*  float beta  = 1.0f;
-*
-*  // Create matrix descriptors
-*  rocsparse_mat_descr descr_A;
-*  rocsparse_mat_descr descr_B;
-*  rocsparse_mat_descr descr_C;
-*
-*  rocsparse_create_mat_descr(&descr_A);
-*  rocsparse_create_mat_descr(&descr_B);
-*  rocsparse_create_mat_descr(&descr_C);
-*
-*  // Set pointer mode
-*  rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host);
-*
-*  // Obtain number of total non-zero entries in C and row pointers of C
-*  rocsparse_int nnz_C;
-*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
-*
-*  rocsparse_csrgeam_nnz(handle,
-*                        m,
-*                        n,
-*                        descr_A,
-*                        nnz_A,
-*                        csr_row_ptr_A,
-*                        csr_col_ind_A,
-*                        descr_B,
-*                        nnz_B,
-*                        csr_row_ptr_B,
-*                        csr_col_ind_B,
-*                        descr_C,
-*                        csr_row_ptr_C,
-*                        &nnz_C);
-*
-*  // Compute column indices and values of C
-*  hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
-*  hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
-*
-*  rocsparse_scsrgeam(handle,
-*                     m,
-*                     n,
-*                     &alpha,
-*                     descr_A,
-*                     nnz_A,
-*                     csr_val_A,
-*                     csr_row_ptr_A,
-*                     csr_col_ind_A,
-*                     &beta,
-*                     descr_B,
-*                     nnz_B,
-*                     csr_val_B,
-*                     csr_row_ptr_B,
-*                     csr_col_ind_B,
-*                     descr_C,
-*                     csr_val_C,
-*                     csr_row_ptr_C,
-*                     csr_col_ind_C);
-*  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrgeam(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
+rocsparse_status rocsparse_sbsrgeam(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nb,
+                                    rocsparse_int             block_dim,
                                     const float*              alpha,
                                     const rocsparse_mat_descr descr_A,
-                                    rocsparse_int             nnz_A,
-                                    const float*              csr_val_A,
-                                    const rocsparse_int*      csr_row_ptr_A,
-                                    const rocsparse_int*      csr_col_ind_A,
+                                    rocsparse_int             nnzb_A,
+                                    const float*              bsr_val_A,
+                                    const rocsparse_int*      bsr_row_ptr_A,
+                                    const rocsparse_int*      bsr_col_ind_A,
                                     const float*              beta,
                                     const rocsparse_mat_descr descr_B,
-                                    rocsparse_int             nnz_B,
-                                    const float*              csr_val_B,
-                                    const rocsparse_int*      csr_row_ptr_B,
-                                    const rocsparse_int*      csr_col_ind_B,
+                                    rocsparse_int             nnzb_B,
+                                    const float*              bsr_val_B,
+                                    const rocsparse_int*      bsr_row_ptr_B,
+                                    const rocsparse_int*      bsr_col_ind_B,
                                     const rocsparse_mat_descr descr_C,
-                                    float*                    csr_val_C,
-                                    const rocsparse_int*      csr_row_ptr_C,
-                                    rocsparse_int*            csr_col_ind_C);
+                                    float*                    bsr_val_C,
+                                    const rocsparse_int*      bsr_row_ptr_C,
+                                    rocsparse_int*            bsr_col_ind_C);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrgeam(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
+rocsparse_status rocsparse_dbsrgeam(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nb,
+                                    rocsparse_int             block_dim,
                                     const double*             alpha,
                                     const rocsparse_mat_descr descr_A,
-                                    rocsparse_int             nnz_A,
-                                    const double*             csr_val_A,
-                                    const rocsparse_int*      csr_row_ptr_A,
-                                    const rocsparse_int*      csr_col_ind_A,
+                                    rocsparse_int             nnzb_A,
+                                    const double*             bsr_val_A,
+                                    const rocsparse_int*      bsr_row_ptr_A,
+                                    const rocsparse_int*      bsr_col_ind_A,
                                     const double*             beta,
                                     const rocsparse_mat_descr descr_B,
-                                    rocsparse_int             nnz_B,
-                                    const double*             csr_val_B,
-                                    const rocsparse_int*      csr_row_ptr_B,
-                                    const rocsparse_int*      csr_col_ind_B,
+                                    rocsparse_int             nnzb_B,
+                                    const double*             bsr_val_B,
+                                    const rocsparse_int*      bsr_row_ptr_B,
+                                    const rocsparse_int*      bsr_col_ind_B,
                                     const rocsparse_mat_descr descr_C,
-                                    double*                   csr_val_C,
-                                    const rocsparse_int*      csr_row_ptr_C,
-                                    rocsparse_int*            csr_col_ind_C);
+                                    double*                   bsr_val_C,
+                                    const rocsparse_int*      bsr_row_ptr_C,
+                                    rocsparse_int*            bsr_col_ind_C);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrgeam(rocsparse_handle               handle,
-                                    rocsparse_int                  m,
-                                    rocsparse_int                  n,
+rocsparse_status rocsparse_cbsrgeam(rocsparse_handle               handle,
+                                    rocsparse_direction            dir,
+                                    rocsparse_int                  mb,
+                                    rocsparse_int                  nb,
+                                    rocsparse_int                  block_dim,
                                     const rocsparse_float_complex* alpha,
                                     const rocsparse_mat_descr      descr_A,
-                                    rocsparse_int                  nnz_A,
-                                    const rocsparse_float_complex* csr_val_A,
-                                    const rocsparse_int*           csr_row_ptr_A,
-                                    const rocsparse_int*           csr_col_ind_A,
+                                    rocsparse_int                  nnzb_A,
+                                    const rocsparse_float_complex* bsr_val_A,
+                                    const rocsparse_int*           bsr_row_ptr_A,
+                                    const rocsparse_int*           bsr_col_ind_A,
                                     const rocsparse_float_complex* beta,
                                     const rocsparse_mat_descr      descr_B,
-                                    rocsparse_int                  nnz_B,
-                                    const rocsparse_float_complex* csr_val_B,
-                                    const rocsparse_int*           csr_row_ptr_B,
-                                    const rocsparse_int*           csr_col_ind_B,
+                                    rocsparse_int                  nnzb_B,
+                                    const rocsparse_float_complex* bsr_val_B,
+                                    const rocsparse_int*           bsr_row_ptr_B,
+                                    const rocsparse_int*           bsr_col_ind_B,
                                     const rocsparse_mat_descr      descr_C,
-                                    rocsparse_float_complex*       csr_val_C,
-                                    const rocsparse_int*           csr_row_ptr_C,
-                                    rocsparse_int*                 csr_col_ind_C);
+                                    rocsparse_float_complex*       bsr_val_C,
+                                    const rocsparse_int*           bsr_row_ptr_C,
+                                    rocsparse_int*                 bsr_col_ind_C);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrgeam(rocsparse_handle                handle,
-                                    rocsparse_int                   m,
-                                    rocsparse_int                   n,
+rocsparse_status rocsparse_zbsrgeam(rocsparse_handle                handle,
+                                    rocsparse_direction             dir,
+                                    rocsparse_int                   mb,
+                                    rocsparse_int                   nb,
+                                    rocsparse_int                   block_dim,
                                     const rocsparse_double_complex* alpha,
                                     const rocsparse_mat_descr       descr_A,
-                                    rocsparse_int                   nnz_A,
-                                    const rocsparse_double_complex* csr_val_A,
-                                    const rocsparse_int*            csr_row_ptr_A,
-                                    const rocsparse_int*            csr_col_ind_A,
+                                    rocsparse_int                   nnzb_A,
+                                    const rocsparse_double_complex* bsr_val_A,
+                                    const rocsparse_int*            bsr_row_ptr_A,
+                                    const rocsparse_int*            bsr_col_ind_A,
                                     const rocsparse_double_complex* beta,
                                     const rocsparse_mat_descr       descr_B,
-                                    rocsparse_int                   nnz_B,
-                                    const rocsparse_double_complex* csr_val_B,
-                                    const rocsparse_int*            csr_row_ptr_B,
-                                    const rocsparse_int*            csr_col_ind_B,
+                                    rocsparse_int                   nnzb_B,
+                                    const rocsparse_double_complex* bsr_val_B,
+                                    const rocsparse_int*            bsr_row_ptr_B,
+                                    const rocsparse_int*            bsr_col_ind_B,
                                     const rocsparse_mat_descr       descr_C,
-                                    rocsparse_double_complex*       csr_val_C,
-                                    const rocsparse_int*            csr_row_ptr_C,
-                                    rocsparse_int*                  csr_col_ind_C);
+                                    rocsparse_double_complex*       bsr_val_C,
+                                    const rocsparse_int*            bsr_row_ptr_C,
+                                    rocsparse_int*                  bsr_col_ind_C);
 /**@}*/
 
 /*! \ingroup extra_module
-*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*  \brief Sparse matrix sparse matrix multiplication using BSR storage format
 *
 *  \details
-*  \p rocsparse_csrgemm_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_csrgemm_nnz(), rocsparse_scsrgemm(),
-*  rocsparse_dcsrgemm(), rocsparse_ccsrgemm() and rocsparse_zcsrgemm(). The temporary
+*  \p rocsparse_bsrgemm_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_bsrgemm_nnzb(), rocsparse_sbsrgemm(),
+*  rocsparse_dbsrgemm(), rocsparse_cbsrgemm() and rocsparse_zbsrgemm(). The temporary
 *  storage buffer must be allocated by the user.
 *
 *  \note
-*  Please note, that for matrix products with more than 4096 non-zero entries per row,
-*  additional temporary storage buffer is allocated by the algorithm.
-*  \note
-*  Please note, that for matrix products with more than 8192 intermediate products per
-*  row, additional temporary storage buffer is allocated by the algorithm.
+*  The block pattern of \f$C\f$ only depends on the block patterns of \f$A\f$,
+*  \f$B\f$ and \f$D\f$. Thus, the required buffer size is the one of the
+*  corresponding csrgemm on the \f$mb \times nb\f$ block patterns.
 *  \note
-*  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
-*  supported.
+*  Currently, only \ref rocsparse_operation_none is supported.
 *  \note
 *  Currently, only \ref rocsparse_matrix_type_general is supported.
 *
 *  @param[in]
 *  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  trans_A         matrix \f$A\f$ operation type.
+*  dir             storage format of the blocks, \ref rocsparse_direction_row or
+*                  \ref rocsparse_direction_column.
 *  @param[in]
-*  trans_B         matrix \f$B\f$ operation type.
+*  trans_A         matrix \f$A\f$ operation type. Currently, only
+*                  \ref rocsparse_operation_none is supported.
 *  @param[in]
-*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  trans_B         matrix \f$B\f$ operation type. Currently, only
+*                  \ref rocsparse_operation_none is supported.
 *  @param[in]
-*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
-*                  \f$C\f$.
+*  mb              number of block rows of the sparse BSR matrix \f$A\f$ and \f$C\f$.
 *  @param[in]
-*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
-*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  nb              number of block columns of the sparse BSR matrix \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  kb              number of block columns of the sparse BSR matrix \f$A\f$ and number
+*                  of block rows of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  block_dim       block dimension of the sparse BSR matrices \f$A\f$, \f$B\f$, \f$C\f$
+*                  and \f$D\f$.
 *  @param[in]
 *  alpha           scalar \f$\alpha\f$.
 *  @param[in]
-*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*  descr_A         descriptor of the sparse BSR matrix \f$A\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  nnzb_A          number of non-zero blocks of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(A)\f$.
+*  bsr_row_ptr_A   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
-*                  sparse CSR matrix \f$A\f$.
+*  bsr_col_ind_A   array of \p nnzb_A elements containing the block column indices of
+*                  the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*  descr_B         descriptor of the sparse BSR matrix \f$B\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  nnzb_B          number of non-zero blocks of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(B)\f$.
+*  bsr_row_ptr_B   array of \p kb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
-*                  sparse CSR matrix \f$B\f$.
+*  bsr_col_ind_B   array of \p nnzb_B elements containing the block column indices of
+*                  the sparse BSR matrix \f$B\f$.
 *  @param[in]
 *  beta            scalar \f$\beta\f$.
 *  @param[in]
-*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*  descr_D         descriptor of the sparse BSR matrix \f$D\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  nnzb_D          number of non-zero blocks of the sparse BSR matrix \f$D\f$.
 *  @param[in]
-*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$D\f$.
+*  bsr_row_ptr_D   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$D\f$.
 *  @param[in]
-*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the sparse
-*                  CSR matrix \f$D\f$.
+*  bsr_col_ind_D   array of \p nnzb_D elements containing the block column indices of
+*                  the sparse BSR matrix \f$D\f$.
 *  @param[inout]
-*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  info_C          structure that holds meta data for the sparse BSR matrix \f$C\f$.
 *  @param[out]
 *  buffer_size     number of bytes of the temporary storage buffer required by
-*                  rocsparse_csrgemm_nnz(), rocsparse_scsrgemm(), rocsparse_dcsrgemm(),
-*                  rocsparse_ccsrgemm() and rocsparse_zcsrgemm().
+*                  rocsparse_bsrgemm_nnzb(), rocsparse_sbsrgemm(), rocsparse_dbsrgemm(),
+*                  rocsparse_cbsrgemm() and rocsparse_zbsrgemm().
 *
 *  \retval rocsparse_status_success the operation completed successfully.
 *  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
-*          \p nnz_D is invalid.
+*  \retval rocsparse_status_invalid_size \p mb, \p nb, \p kb, \p block_dim,
+*          \p nnzb_A, \p nnzb_B or \p nnzb_D is invalid.
 *  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
-*          \p descr_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B,
-*          \p csr_row_ptr_B or \p csr_col_ind_B are invalid if \p alpha is valid,
-*          \p descr_D, \p csr_row_ptr_D or \p csr_col_ind_D is invalid if \p beta is
+*          \p descr_A, \p bsr_row_ptr_A, \p bsr_col_ind_A, \p descr_B,
+*          \p bsr_row_ptr_B or \p bsr_col_ind_B are invalid if \p alpha is valid,
+*          \p descr_D, \p bsr_row_ptr_D or \p bsr_col_ind_D is invalid if \p beta is
 *          valid, \p info_C or \p buffer_size is invalid.
+*  \retval rocsparse_status_invalid_value \p dir, \p trans_A or \p trans_B is invalid.
 *  \retval rocsparse_status_not_implemented
 *          \p trans_A != \ref rocsparse_operation_none,
 *          \p trans_B != \ref rocsparse_operation_none, or
@@ -4886,200 +4950,211 @@ rocsparse_status rocsparse_zcsrgeam(rocsparse_handle                handle,
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrgemm_buffer_size(rocsparse_handle          handle,
+rocsparse_status rocsparse_sbsrgemm_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
                                                 rocsparse_operation       trans_A,
                                                 rocsparse_operation       trans_B,
-                                                rocsparse_int             m,
-                                                rocsparse_int             n,
-                                                rocsparse_int             k,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nb,
+                                                rocsparse_int             kb,
+                                                rocsparse_int             block_dim,
                                                 const float*              alpha,
                                                 const rocsparse_mat_descr descr_A,
-                                                rocsparse_int             nnz_A,
-                                                const rocsparse_int*      csr_row_ptr_A,
-                                                const rocsparse_int*      csr_col_ind_A,
+                                                rocsparse_int             nnzb_A,
+                                                const rocsparse_int*      bsr_row_ptr_A,
+                                                const rocsparse_int*      bsr_col_ind_A,
                                                 const rocsparse_mat_descr descr_B,
-                                                rocsparse_int             nnz_B,
-                                                const rocsparse_int*      csr_row_ptr_B,
-                                                const rocsparse_int*      csr_col_ind_B,
+                                                rocsparse_int             nnzb_B,
+                                                const rocsparse_int*      bsr_row_ptr_B,
+                                                const rocsparse_int*      bsr_col_ind_B,
                                                 const float*              beta,
                                                 const rocsparse_mat_descr descr_D,
-                                                rocsparse_int             nnz_D,
-                                                const rocsparse_int*      csr_row_ptr_D,
-                                                const rocsparse_int*      csr_col_ind_D,
+                                                rocsparse_int             nnzb_D,
+                                                const rocsparse_int*      bsr_row_ptr_D,
+                                                const rocsparse_int*      bsr_col_ind_D,
                                                 rocsparse_mat_info        info_C,
                                                 size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrgemm_buffer_size(rocsparse_handle          handle,
+rocsparse_status rocsparse_dbsrgemm_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
                                                 rocsparse_operation       trans_A,
                                                 rocsparse_operation       trans_B,
-                                                rocsparse_int             m,
-                                                rocsparse_int             n,
-                                                rocsparse_int             k,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nb,
+                                                rocsparse_int             kb,
+                                                rocsparse_int             block_dim,
                                                 const double*             alpha,
                                                 const rocsparse_mat_descr descr_A,
-                                                rocsparse_int             nnz_A,
-                                                const rocsparse_int*      csr_row_ptr_A,
-                                                const rocsparse_int*      csr_col_ind_A,
+                                                rocsparse_int             nnzb_A,
+                                                const rocsparse_int*      bsr_row_ptr_A,
+                                                const rocsparse_int*      bsr_col_ind_A,
                                                 const rocsparse_mat_descr descr_B,
-                                                rocsparse_int             nnz_B,
-                                                const rocsparse_int*      csr_row_ptr_B,
-                                                const rocsparse_int*      csr_col_ind_B,
+                                                rocsparse_int             nnzb_B,
+                                                const rocsparse_int*      bsr_row_ptr_B,
+                                                const rocsparse_int*      bsr_col_ind_B,
                                                 const double*             beta,
                                                 const rocsparse_mat_descr descr_D,
-                                                rocsparse_int             nnz_D,
-                                                const rocsparse_int*      csr_row_ptr_D,
-                                                const rocsparse_int*      csr_col_ind_D,
+                                                rocsparse_int             nnzb_D,
+                                                const rocsparse_int*      bsr_row_ptr_D,
+                                                const rocsparse_int*      bsr_col_ind_D,
                                                 rocsparse_mat_info        info_C,
                                                 size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrgemm_buffer_size(rocsparse_handle               handle,
+rocsparse_status rocsparse_cbsrgemm_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_direction            dir,
                                                 rocsparse_operation            trans_A,
                                                 rocsparse_operation            trans_B,
-                                                rocsparse_int                  m,
-                                                rocsparse_int                  n,
-                                                rocsparse_int                  k,
+                                                rocsparse_int                  mb,
+                                                rocsparse_int                  nb,
+                                                rocsparse_int                  kb,
+                                                rocsparse_int                  block_dim,
                                                 const rocsparse_float_complex* alpha,
                                                 const rocsparse_mat_descr      descr_A,
-                                                rocsparse_int                  nnz_A,
-                                                const rocsparse_int*           csr_row_ptr_A,
-                                                const rocsparse_int*           csr_col_ind_A,
+                                                rocsparse_int                  nnzb_A,
+                                                const rocsparse_int*           bsr_row_ptr_A,
+                                                const rocsparse_int*           bsr_col_ind_A,
                                                 const rocsparse_mat_descr      descr_B,
-                                                rocsparse_int                  nnz_B,
-                                                const rocsparse_int*           csr_row_ptr_B,
-                                                const rocsparse_int*           csr_col_ind_B,
+                                                rocsparse_int                  nnzb_B,
+                                                const rocsparse_int*           bsr_row_ptr_B,
+                                                const rocsparse_int*           bsr_col_ind_B,
                                                 const rocsparse_float_complex* beta,
                                                 const rocsparse_mat_descr      descr_D,
-                                                rocsparse_int                  nnz_D,
-                                                const rocsparse_int*           csr_row_ptr_D,
-                                                const rocsparse_int*           csr_col_ind_D,
+                                                rocsparse_int                  nnzb_D,
+                                                const rocsparse_int*           bsr_row_ptr_D,
+                                                const rocsparse_int*           bsr_col_ind_D,
                                                 rocsparse_mat_info             info_C,
                                                 size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrgemm_buffer_size(rocsparse_handle                handle,
+rocsparse_status rocsparse_zbsrgemm_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_direction             dir,
                                                 rocsparse_operation             trans_A,
                                                 rocsparse_operation             trans_B,
-                                                rocsparse_int                   m,
-                                                rocsparse_int                   n,
-                                                rocsparse_int                   k,
+                                                rocsparse_int                   mb,
+                                                rocsparse_int                   nb,
+                                                rocsparse_int                   kb,
+                                                rocsparse_int                   block_dim,
                                                 const rocsparse_double_complex* alpha,
                                                 const rocsparse_mat_descr       descr_A,
-                                                rocsparse_int                   nnz_A,
-                                                const rocsparse_int*            csr_row_ptr_A,
-                                                const rocsparse_int*            csr_col_ind_A,
+                                                rocsparse_int                   nnzb_A,
+                                                const rocsparse_int*            bsr_row_ptr_A,
+                                                const rocsparse_int*            bsr_col_ind_A,
                                                 const rocsparse_mat_descr       descr_B,
-                                                rocsparse_int                   nnz_B,
-                                                const rocsparse_int*            csr_row_ptr_B,
-                                                const rocsparse_int*            csr_col_ind_B,
+                                                rocsparse_int                   nnzb_B,
+                                                const rocsparse_int*            bsr_row_ptr_B,
+                                                const rocsparse_int*            bsr_col_ind_B,
                                                 const rocsparse_double_complex* beta,
                                                 const rocsparse_mat_descr       descr_D,
-                                                rocsparse_int                   nnz_D,
-                                                const rocsparse_int*            csr_row_ptr_D,
-                                                const rocsparse_int*            csr_col_ind_D,
+                                                rocsparse_int                   nnzb_D,
+                                                const rocsparse_int*            bsr_row_ptr_D,
+                                                const rocsparse_int*            bsr_col_ind_D,
                                                 rocsparse_mat_info              info_C,
                                                 size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup extra_module
-*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*  \brief Sparse matrix sparse matrix multiplication using BSR storage format
 *
 *  \details
-*  \p rocsparse_csrgemm_nnz computes the total CSR non-zero elements and the CSR row
-*  offsets, that point to the start of every row of the sparse CSR matrix, of the
-*  resulting multiplied matrix C. It is assumed that \p csr_row_ptr_C has been allocated
-*  with size \p m + 1.
-*  The required buffer size can be obtained by rocsparse_scsrgemm_buffer_size(),
-*  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() and
-*  rocsparse_zcsrgemm_buffer_size(), respectively.
+*  \p rocsparse_bsrgemm_nnzb computes the total BSR non-zero blocks and the BSR row
+*  offsets, that point to the start of every block row of the sparse BSR matrix, of the
+*  resulting multiplied matrix C. The block pattern of C is computed from the block
+*  patterns of A, B and D only. It is assumed that \p bsr_row_ptr_C has been allocated
+*  with size \p mb + 1.
+*  The required buffer size can be obtained by rocsparse_sbsrgemm_buffer_size(),
+*  rocsparse_dbsrgemm_buffer_size(), rocsparse_cbsrgemm_buffer_size() and
+*  rocsparse_zbsrgemm_buffer_size(), respectively.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *  \note
-*  Please note, that for matrix products with more than 8192 intermediate products per
-*  row, additional temporary storage buffer is allocated by the algorithm.
-*  \note
-*  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
-*  supported.
+*  Currently, only \ref rocsparse_operation_none is supported.
 *  \note
 *  Currently, only \ref rocsparse_matrix_type_general is supported.
 *
 *  @param[in]
 *  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  trans_A         matrix \f$A\f$ operation type.
+*  dir             storage format of the blocks, \ref rocsparse_direction_row or
+*                  \ref rocsparse_direction_column.
 *  @param[in]
-*  trans_B         matrix \f$B\f$ operation type.
+*  trans_A         matrix \f$A\f$ operation type. Currently, only
+*                  \ref rocsparse_operation_none is supported.
 *  @param[in]
-*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  trans_B         matrix \f$B\f$ operation type. Currently, only
+*                  \ref rocsparse_operation_none is supported.
 *  @param[in]
-*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
-*                  \f$C\f$.
+*  mb              number of block rows of the sparse BSR matrix \f$A\f$ and \f$C\f$.
 *  @param[in]
-*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
-*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  nb              number of block columns of the sparse BSR matrix \f$B\f$ and \f$C\f$.
 *  @param[in]
-*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*  kb              number of block columns of the sparse BSR matrix \f$A\f$ and number
+*                  of block rows of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  block_dim       block dimension of the sparse BSR matrices \f$A\f$, \f$B\f$, \f$C\f$
+*                  and \f$D\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse BSR matrix \f$A\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  nnzb_A          number of non-zero blocks of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(A)\f$.
+*  bsr_row_ptr_A   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
-*                  sparse CSR matrix \f$A\f$.
+*  bsr_col_ind_A   array of \p nnzb_A elements containing the block column indices of
+*                  the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*  descr_B         descriptor of the sparse BSR matrix \f$B\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  nnzb_B          number of non-zero blocks of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(B)\f$.
+*  bsr_row_ptr_B   array of \p kb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
-*                  sparse CSR matrix \f$B\f$.
+*  bsr_col_ind_B   array of \p nnzb_B elements containing the block column indices of
+*                  the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*  descr_D         descriptor of the sparse BSR matrix \f$D\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  nnzb_D          number of non-zero blocks of the sparse BSR matrix \f$D\f$.
 *  @param[in]
-*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$D\f$.
+*  bsr_row_ptr_D   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$D\f$.
 *  @param[in]
-*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the sparse
-*                  CSR matrix \f$D\f$.
+*  bsr_col_ind_D   array of \p nnzb_D elements containing the block column indices of
+*                  the sparse BSR matrix \f$D\f$.
 *  @param[in]
-*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*  descr_C         descriptor of the sparse BSR matrix \f$C\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[out]
-*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$C\f$.
+*  bsr_row_ptr_C   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$C\f$.
 *  @param[out]
-*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
-*                  matrix \f$C\f$.
+*  nnzb_C          pointer to the number of non-zero blocks of the sparse BSR matrix
+*                  \f$C\f$.
 *  @param[in]
-*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  info_C          structure that holds meta data for the sparse BSR matrix \f$C\f$.
 *  @param[in]
 *  temp_buffer     temporary storage buffer allocated by the user, size is returned
-*                  by rocsparse_scsrgemm_buffer_size(),
-*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
-*                  rocsparse_zcsrgemm_buffer_size().
+*                  by rocsparse_sbsrgemm_buffer_size(),
+*                  rocsparse_dbsrgemm_buffer_size(), rocsparse_cbsrgemm_buffer_size() or
+*                  rocsparse_zbsrgemm_buffer_size().
 *
 *  \retval rocsparse_status_success the operation completed successfully.
 *  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
-*          \p nnz_D is invalid.
-*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
-*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
-*          \p descr_D, \p csr_row_ptr_D, \p csr_col_ind_D, \p descr_C,
-*          \p csr_row_ptr_C, \p nnz_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_invalid_size \p mb, \p nb, \p kb, \p block_dim,
+*          \p nnzb_A, \p nnzb_B or \p nnzb_D is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p bsr_row_ptr_A,
+*          \p bsr_col_ind_A, \p descr_B, \p bsr_row_ptr_B, \p bsr_col_ind_B,
+*          \p descr_D, \p bsr_row_ptr_D, \p bsr_col_ind_D, \p descr_C,
+*          \p bsr_row_ptr_C, \p nnzb_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_invalid_value \p dir, \p trans_A or \p trans_B is invalid.
 *  \retval rocsparse_status_memory_error additional buffer for long rows could not be
 *          allocated.
 *  \retval rocsparse_status_not_implemented
@@ -5088,197 +5163,184 @@ rocsparse_status rocsparse_zcsrgemm_buffer_size(rocsparse_handle
 *          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
-                                       rocsparse_operation       trans_A,
-                                       rocsparse_operation       trans_B,
-                                       rocsparse_int             m,
-                                       rocsparse_int             n,
-                                       rocsparse_int             k,
-                                       const rocsparse_mat_descr descr_A,
-                                       rocsparse_int             nnz_A,
-                                       const rocsparse_int*      csr_row_ptr_A,
-                                       const rocsparse_int*      csr_col_ind_A,
-                                       const rocsparse_mat_descr descr_B,
-                                       rocsparse_int             nnz_B,
-                                       const rocsparse_int*      csr_row_ptr_B,
-                                       const rocsparse_int*      csr_col_ind_B,
-                                       const rocsparse_mat_descr descr_D,
-                                       rocsparse_int             nnz_D,
-                                       const rocsparse_int*      csr_row_ptr_D,
-                                       const rocsparse_int*      csr_col_ind_D,
-                                       const rocsparse_mat_descr descr_C,
-                                       rocsparse_int*            csr_row_ptr_C,
-                                       rocsparse_int*            nnz_C,
-                                       const rocsparse_mat_info  info_C,
-                                       void*                     temp_buffer);
+rocsparse_status rocsparse_bsrgemm_nnzb(rocsparse_handle          handle,
+                                        rocsparse_direction       dir,
+                                        rocsparse_operation       trans_A,
+                                        rocsparse_operation       trans_B,
+                                        rocsparse_int             mb,
+                                        rocsparse_int             nb,
+                                        rocsparse_int             kb,
+                                        rocsparse_int             block_dim,
+                                        const rocsparse_mat_descr descr_A,
+                                        rocsparse_int             nnzb_A,
+                                        const rocsparse_int*      bsr_row_ptr_A,
+                                        const rocsparse_int*      bsr_col_ind_A,
+                                        const rocsparse_mat_descr descr_B,
+                                        rocsparse_int             nnzb_B,
+                                        const rocsparse_int*      bsr_row_ptr_B,
+                                        const rocsparse_int*      bsr_col_ind_B,
+                                        const rocsparse_mat_descr descr_D,
+                                        rocsparse_int             nnzb_D,
+                                        const rocsparse_int*      bsr_row_ptr_D,
+                                        const rocsparse_int*      bsr_col_ind_D,
+                                        const rocsparse_mat_descr descr_C,
+                                        rocsparse_int*            bsr_row_ptr_C,
+                                        rocsparse_int*            nnzb_C,
+                                        const rocsparse_mat_info  info_C,
+                                        void*                     temp_buffer);
 
 /*! \ingroup extra_module
-*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*  \brief Sparse matrix sparse matrix multiplication using BSR storage format
 *
 *  \details
-*  \p rocsparse_csrgemm multiplies the scalar \f$\alpha\f$ with the sparse
-*  \f$m \times k\f$ matrix \f$A\f$, defined in CSR storage format, and the sparse
-*  \f$k \times n\f$ matrix \f$B\f$, defined in CSR storage format, and adds the result
-*  to the sparse \f$m \times n\f$ matrix \f$D\f$ that is multiplied by \f$\beta\f$. The
-*  final result is stored in the sparse \f$m \times n\f$ matrix \f$C\f$, defined in CSR
-*  storage format, such
-*  that
-*  \f[
-*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot D,
-*  \f]
-*  with
-*  \f[
-*    op(A) = \left\{
-*    \begin{array}{ll}
-*        A,   & \text{if trans_A == rocsparse_operation_none} \\
-*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
-*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
-*  \f]
-*  and
+*  \p rocsparse_bsrgemm multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$mb \times kb\f$ block matrix \f$A\f$ and the sparse \f$kb \times nb\f$ block
+*  matrix \f$B\f$, and adds the result to the sparse \f$mb \times nb\f$ block matrix
+*  \f$D\f$ that is multiplied by \f$\beta\f$. All matrices are defined in BSR
+*  storage format with the same block dimension. The final result is stored in the
+*  sparse \f$mb \times nb\f$ block matrix \f$C\f$, defined in BSR storage format,
+*  such that
 *  \f[
-*    op(B) = \left\{
-*    \begin{array}{ll}
-*        B,   & \text{if trans_B == rocsparse_operation_none} \\
-*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
-*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
-*    \end{array}
-*    \right.
+*    C := \alpha \cdot A \cdot B + \beta \cdot D
 *  \f]
 *
-*  It is assumed that \p csr_row_ptr_C has already been filled and that \p csr_val_C and
-*  \p csr_col_ind_C are allocated by the user. \p csr_row_ptr_C and allocation size of
-*  \p csr_col_ind_C and \p csr_val_C is defined by the number of non-zero elements of
-*  the sparse CSR matrix C. Both can be obtained by rocsparse_csrgemm_nnz(). The
+*  It is assumed that \p bsr_row_ptr_C has already been filled and that \p bsr_val_C
+*  and \p bsr_col_ind_C are allocated by the user. \p bsr_row_ptr_C and allocation size
+*  of \p bsr_col_ind_C and \p bsr_val_C is defined by the number of non-zero blocks of
+*  the sparse BSR matrix C. Both can be obtained by rocsparse_bsrgemm_nnzb(). The
+*  allocation size of \p bsr_val_C is \p nnzb_C * \p block_dim * \p block_dim. The
 *  required buffer size for the computation can be obtained by
-*  rocsparse_scsrgemm_buffer_size(), rocsparse_dcsrgemm_buffer_size(),
-*  rocsparse_ccsrgemm_buffer_size() and rocsparse_zcsrgemm_buffer_size(), respectively.
+*  rocsparse_sbsrgemm_buffer_size(), rocsparse_dbsrgemm_buffer_size(),
+*  rocsparse_cbsrgemm_buffer_size() and rocsparse_zbsrgemm_buffer_size(), respectively.
 *
 *  \note If \f$\alpha == 0\f$, then \f$C = \beta \cdot D\f$ will be computed.
-*  \note If \f$\beta == 0\f$, then \f$C = \alpha \cdot op(A) \cdot op(B)\f$ will be computed.
+*  \note If \f$\beta == 0\f$, then \f$C = \alpha \cdot A \cdot B\f$ will be computed.
 *  \note \f$\alpha == beta == 0\f$ is invalid.
-*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
-*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
-*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
-*  \note This function is non blocking and executed asynchronously with respect to the
-*        host. It may return before the actual computation has finished.
-*  \note Please note, that for matrix products with more than 4096 non-zero entries per
-*  row, additional temporary storage buffer is allocated by the algorithm.
+*  \note
+*  The products of the blocks are accumulated in shared memory for block dimensions up
+*  to 32. For \p block_dim == 1, the operation is identical to rocsparse_scsrgemm(),
+*  rocsparse_dcsrgemm(), rocsparse_ccsrgemm() and rocsparse_zcsrgemm(), respectively.
+*  \note
+*  Currently, only \ref rocsparse_operation_none is supported.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
 *  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  trans_A         matrix \f$A\f$ operation type.
+*  dir             storage format of the blocks, \ref rocsparse_direction_row or
+*                  \ref rocsparse_direction_column.
 *  @param[in]
-*  trans_B         matrix \f$B\f$ operation type.
+*  trans_A         matrix \f$A\f$ operation type. Currently, only
+*                  \ref rocsparse_operation_none is supported.
 *  @param[in]
-*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  trans_B         matrix \f$B\f$ operation type. Currently, only
+*                  \ref rocsparse_operation_none is supported.
 *  @param[in]
-*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
-*                  \f$C\f$.
+*  mb              number of block rows of the sparse BSR matrix \f$A\f$ and \f$C\f$.
 *  @param[in]
-*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
-*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  nb              number of block columns of the sparse BSR matrix \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  kb              number of block columns of the sparse BSR matrix \f$A\f$ and number
+*                  of block rows of the sparse BSR matrix \f$B\f$.
+*  @param[in]
+*  block_dim       block dimension of the sparse BSR matrices \f$A\f$, \f$B\f$, \f$C\f$
+*                  and \f$D\f$.
 *  @param[in]
 *  alpha           scalar \f$\alpha\f$.
 *  @param[in]
-*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*  descr_A         descriptor of the sparse BSR matrix \f$A\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  nnzb_A          number of non-zero blocks of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  bsr_val_A       array of \p nnzb_A blocks of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(A)\f$.
+*  bsr_row_ptr_A   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
-*                  sparse CSR matrix \f$A\f$.
+*  bsr_col_ind_A   array of \p nnzb_A elements containing the block column indices of
+*                  the sparse BSR matrix \f$A\f$.
 *  @param[in]
-*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*  descr_B         descriptor of the sparse BSR matrix \f$B\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  nnzb_B          number of non-zero blocks of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  bsr_val_B       array of \p nnzb_B blocks of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
-*                  that point to the start of every row of the sparse CSR matrix
-*                  \f$op(B)\f$.
+*  bsr_row_ptr_B   array of \p kb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$B\f$.
 *  @param[in]
-*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
-*                  sparse CSR matrix \f$B\f$.
+*  bsr_col_ind_B   array of \p nnzb_B elements containing the block column indices of
+*                  the sparse BSR matrix \f$B\f$.
 *  @param[in]
 *  beta            scalar \f$\beta\f$.
 *  @param[in]
-*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*  descr_D         descriptor of the sparse BSR matrix \f$D\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  nnzb_D          number of non-zero blocks of the sparse BSR matrix \f$D\f$.
 *  @param[in]
-*  csr_val_D       array of \p nnz_D elements of the sparse CSR matrix \f$D\f$.
+*  bsr_val_D       array of \p nnzb_D blocks of the sparse BSR matrix \f$D\f$.
 *  @param[in]
-*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$D\f$.
+*  bsr_row_ptr_D   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$D\f$.
 *  @param[in]
-*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the
-*                  sparse CSR matrix \f$D\f$.
+*  bsr_col_ind_D   array of \p nnzb_D elements containing the block column indices of
+*                  the sparse BSR matrix \f$D\f$.
 *  @param[in]
-*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*  descr_C         descriptor of the sparse BSR matrix \f$C\f$. Currenty, only
 *                  \ref rocsparse_matrix_type_general is supported.
 *  @param[out]
-*  csr_val_C       array of \p nnz_C elements of the sparse CSR matrix \f$C\f$.
+*  bsr_val_C       array of \p nnzb_C blocks of the sparse BSR matrix \f$C\f$.
 *  @param[in]
-*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
-*                  sparse CSR matrix \f$C\f$.
+*  bsr_row_ptr_C   array of \p mb+1 elements that point to the start of every block row
+*                  of the sparse BSR matrix \f$C\f$.
 *  @param[out]
-*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
-*                  sparse CSR matrix \f$C\f$.
+*  bsr_col_ind_C   array of \p nnzb_C elements containing the block column indices of
+*                  the sparse BSR matrix \f$C\f$.
 *  @param[in]
-*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  info_C          structure that holds meta data for the sparse BSR matrix \f$C\f$.
 *  @param[in]
 *  temp_buffer     temporary storage buffer allocated by the user, size is returned
-*                  by rocsparse_scsrgemm_buffer_size(),
-*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
-*                  rocsparse_zcsrgemm_buffer_size().
+*                  by rocsparse_sbsrgemm_buffer_size(),
+*                  rocsparse_dbsrgemm_buffer_size(), rocsparse_cbsrgemm_buffer_size() or
+*                  rocsparse_zbsrgemm_buffer_size().
 *
 *  \retval rocsparse_status_success the operation completed successfully.
 *  \retval rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
-*          \p nnz_D is invalid.
+*  \retval rocsparse_status_invalid_size \p mb, \p nb, \p kb, \p block_dim,
+*          \p nnzb_A, \p nnzb_B or \p nnzb_D is invalid.
 *  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
-*          \p descr_A, \p csr_val_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B,
-*          \p csr_val_B, \p csr_row_ptr_B or \p csr_col_ind_B are invalid if \p alpha
-*          is valid, \p descr_D, \p csr_val_D, \p csr_row_ptr_D or \p csr_col_ind_D is
-*          invalid if \p beta is valid, \p csr_val_C, \p csr_row_ptr_C,
-*          \p csr_col_ind_C, \p info_C or \p temp_buffer is invalid.
-*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
-*          allocated.
+*          \p descr_A, \p bsr_val_A, \p bsr_row_ptr_A, \p bsr_col_ind_A, \p descr_B,
+*          \p bsr_val_B, \p bsr_row_ptr_B or \p bsr_col_ind_B are invalid if \p alpha
+*          is valid, \p descr_D, \p bsr_val_D, \p bsr_row_ptr_D or \p bsr_col_ind_D is
+*          invalid if \p beta is valid, \p bsr_val_C, \p bsr_row_ptr_C,
+*          \p bsr_col_ind_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_invalid_value \p dir, \p trans_A or \p trans_B is invalid.
 *  \retval rocsparse_status_not_implemented
 *          \p trans_A != \ref rocsparse_operation_none,
 *          \p trans_B != \ref rocsparse_operation_none, or
 *          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 *
 *  \par Example
-*  This example multiplies two CSR matrices with a scalar alpha and adds the result to
-*  another CSR matrix.
+*  This example multiplies two BSR matrices with a scalar alpha.
 *  \code{.c}
-*  // Initialize scalar multipliers
+*  // Initialize scalar multiplier
 *  float alpha = 2.0f;
-*  float beta  = 1.0f;
 *
 *  // Create matrix descriptors
 *  rocsparse_mat_descr descr_A;
 *  rocsparse_mat_descr descr_B;
 *  rocsparse_mat_descr descr_C;
-*  rocsparse_mat_descr descr_D;
 *
 *  rocsparse_create_mat_descr(&descr_A);
 *  rocsparse_create_mat_descr(&descr_B);
 *  rocsparse_create_mat_descr(&descr_C);
-*  rocsparse_create_mat_descr(&descr_D);
 *
 *  // Create matrix info structure
 *  rocsparse_mat_info info_C;
@@ -5290,26 +5352,28 @@ rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
 *  // Query rocsparse for the required buffer size
 *  size_t buffer_size;
 *
-*  rocsparse_scsrgemm_buffer_size(handle,
+*  rocsparse_sbsrgemm_buffer_size(handle,
+*                                 rocsparse_direction_row,
 *                                 rocsparse_operation_none,
 *                                 rocsparse_operation_none,
-*                                 m,
-*                                 n,
-*                                 k,
+*                                 mb,
+*                                 nb,
+*                                 kb,
+*                                 block_dim,
 *                                 &alpha,
 *                                 descr_A,
-*                                 nnz_A,
-*                                 csr_row_ptr_A,
-*                                 csr_col_ind_A,
+*                                 nnzb_A,
+*                                 bsr_row_ptr_A,
+*                                 bsr_col_ind_A,
 *                                 descr_B,
-*                                 nnz_B,
-*                                 csr_row_ptr_B,
-*                                 csr_col_ind_B,
-*                                 &beta,
-*                                 descr_D,
-*                                 nnz_D,
-*                                 csr_row_ptr_D,
-*                                 csr_col_ind_D,
+*                                 nnzb_B,
+*                                 bsr_row_ptr_B,
+*                                 bsr_col_ind_B,
+*                                 NULL,
+*                                 NULL,
+*                                 0,
+*                                 NULL,
+*                                 NULL,
 *                                 info_C,
 *                                 &buffer_size);
 *
@@ -5317,1358 +5381,4527 @@ rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
 *  void* buffer;
 *  hipMalloc(&buffer, buffer_size);
 *
-*  // Obtain number of total non-zero entries in C and row pointers of C
-*  rocsparse_int nnz_C;
-*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+*  // Obtain number of total non-zero blocks in C and block row pointers of C
+*  rocsparse_int nnzb_C;
+*  hipMalloc((void**)&bsr_row_ptr_C, sizeof(rocsparse_int) * (mb + 1));
 *
-*  rocsparse_csrgemm_nnz(handle,
-*                        rocsparse_operation_none,
-*                        rocsparse_operation_none,
-*                        m,
-*                        n,
-*                        k,
-*                        descr_A,
-*                        nnz_A,
-*                        csr_row_ptr_A,
-*                        csr_col_ind_A,
-*                        descr_B,
-*                        nnz_B,
-*                        csr_row_ptr_B,
-*                        csr_col_ind_B,
-*                        descr_D,
-*                        nnz_D,
-*                        csr_row_ptr_D,
-*                        csr_col_ind_D,
-*                        descr_C,
-*                        csr_row_ptr_C,
-*                        &nnz_C,
-*                        info_C,
-*                        buffer);
+*  rocsparse_bsrgemm_nnzb(handle,
+*                         rocsparse_direction_row,
+*                         rocsparse_operation_none,
+*                         rocsparse_operation_none,
+*                         mb,
+*                         nb,
+*                         kb,
+*                         block_dim,
+*                         descr_A,
+*                         nnzb_A,
+*                         bsr_row_ptr_A,
+*                         bsr_col_ind_A,
+*                         descr_B,
+*                         nnzb_B,
+*                         bsr_row_ptr_B,
+*                         bsr_col_ind_B,
+*                         NULL,
+*                         0,
+*                         NULL,
+*                         NULL,
+*                         descr_C,
+*                         bsr_row_ptr_C,
+*                         &nnzb_C,
+*                         info_C,
+*                         buffer);
 *
-*  // Compute column indices and values of C
-*  hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
-*  hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*  // Compute block column indices and values of C
+*  hipMalloc((void**)&bsr_col_ind_C, sizeof(rocsparse_int) * nnzb_C);
+*  hipMalloc((void**)&bsr_val_C, sizeof(float) * nnzb_C * block_dim * block_dim);
 *
-*  rocsparse_scsrgemm(handle,
+*  rocsparse_sbsrgemm(handle,
+*                     rocsparse_direction_row,
 *                     rocsparse_operation_none,
 *                     rocsparse_operation_none,
-*                     m,
-*                     n,
-*                     k,
+*                     mb,
+*                     nb,
+*                     kb,
+*                     block_dim,
 *                     &alpha,
 *                     descr_A,
-*                     nnz_A,
-*                     csr_val_A,
-*                     csr_row_ptr_A,
-*                     csr_col_ind_A,
+*                     nnzb_A,
+*                     bsr_val_A,
+*                     bsr_row_ptr_A,
+*                     bsr_col_ind_A,
 *                     descr_B,
-*                     nnz_B,
-*                     csr_val_B,
-*                     csr_row_ptr_B,
-*                     csr_col_ind_B,
-*                     &beta,
-*                     descr_D,
-*                     nnz_D,
-*                     csr_val_D,
-*                     csr_row_ptr_D,
-*                     csr_col_ind_D,
+*                     nnzb_B,
+*                     bsr_val_B,
+*                     bsr_row_ptr_B,
+*                     bsr_col_ind_B,
+*                     NULL,
+*                     NULL,
+*                     0,
+*                     NULL,
+*                     NULL,
+*                     NULL,
 *                     descr_C,
-*                     csr_val_C,
-*                     csr_row_ptr_C,
-*                     csr_col_ind_C,
+*                     bsr_val_C,
+*                     bsr_row_ptr_C,
+*                     bsr_col_ind_C,
 *                     info_C,
 *                     buffer);
 *  \endcode
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrgemm(rocsparse_handle          handle,
+rocsparse_status rocsparse_sbsrgemm(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
                                     rocsparse_operation       trans_A,
                                     rocsparse_operation       trans_B,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    rocsparse_int             k,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nb,
+                                    rocsparse_int             kb,
+                                    rocsparse_int             block_dim,
                                     const float*              alpha,
                                     const rocsparse_mat_descr descr_A,
-                                    rocsparse_int             nnz_A,
-                                    const float*              csr_val_A,
-                                    const rocsparse_int*      csr_row_ptr_A,
-                                    const rocsparse_int*      csr_col_ind_A,
+                                    rocsparse_int             nnzb_A,
+                                    const float*              bsr_val_A,
+                                    const rocsparse_int*      bsr_row_ptr_A,
+                                    const rocsparse_int*      bsr_col_ind_A,
                                     const rocsparse_mat_descr descr_B,
-                                    rocsparse_int             nnz_B,
-                                    const float*              csr_val_B,
-                                    const rocsparse_int*      csr_row_ptr_B,
-                                    const rocsparse_int*      csr_col_ind_B,
+                                    rocsparse_int             nnzb_B,
+                                    const float*              bsr_val_B,
+                                    const rocsparse_int*      bsr_row_ptr_B,
+                                    const rocsparse_int*      bsr_col_ind_B,
                                     const float*              beta,
                                     const rocsparse_mat_descr descr_D,
-                                    rocsparse_int             nnz_D,
-                                    const float*              csr_val_D,
-                                    const rocsparse_int*      csr_row_ptr_D,
-                                    const rocsparse_int*      csr_col_ind_D,
+                                    rocsparse_int             nnzb_D,
+                                    const float*              bsr_val_D,
+                                    const rocsparse_int*      bsr_row_ptr_D,
+                                    const rocsparse_int*      bsr_col_ind_D,
                                     const rocsparse_mat_descr descr_C,
-                                    float*                    csr_val_C,
-                                    const rocsparse_int*      csr_row_ptr_C,
-                                    rocsparse_int*            csr_col_ind_C,
+                                    float*                    bsr_val_C,
+                                    const rocsparse_int*      bsr_row_ptr_C,
+                                    rocsparse_int*            bsr_col_ind_C,
                                     const rocsparse_mat_info  info_C,
                                     void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrgemm(rocsparse_handle          handle,
+rocsparse_status rocsparse_dbsrgemm(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
                                     rocsparse_operation       trans_A,
                                     rocsparse_operation       trans_B,
-                                    rocsparse_int             m,
-                                    rocsparse_int             n,
-                                    rocsparse_int             k,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nb,
+                                    rocsparse_int             kb,
+                                    rocsparse_int             block_dim,
                                     const double*             alpha,
                                     const rocsparse_mat_descr descr_A,
-                                    rocsparse_int             nnz_A,
-                                    const double*             csr_val_A,
-                                    const rocsparse_int*      csr_row_ptr_A,
-                                    const rocsparse_int*      csr_col_ind_A,
+                                    rocsparse_int             nnzb_A,
+                                    const double*             bsr_val_A,
+                                    const rocsparse_int*      bsr_row_ptr_A,
+                                    const rocsparse_int*      bsr_col_ind_A,
                                     const rocsparse_mat_descr descr_B,
-                                    rocsparse_int             nnz_B,
-                                    const double*             csr_val_B,
-                                    const rocsparse_int*      csr_row_ptr_B,
-                                    const rocsparse_int*      csr_col_ind_B,
+                                    rocsparse_int             nnzb_B,
+                                    const double*             bsr_val_B,
+                                    const rocsparse_int*      bsr_row_ptr_B,
+                                    const rocsparse_int*      bsr_col_ind_B,
                                     const double*             beta,
                                     const rocsparse_mat_descr descr_D,
-                                    rocsparse_int             nnz_D,
-                                    const double*             csr_val_D,
-                                    const rocsparse_int*      csr_row_ptr_D,
-                                    const rocsparse_int*      csr_col_ind_D,
+                                    rocsparse_int             nnzb_D,
+                                    const double*             bsr_val_D,
+                                    const rocsparse_int*      bsr_row_ptr_D,
+                                    const rocsparse_int*      bsr_col_ind_D,
                                     const rocsparse_mat_descr descr_C,
-                                    double*                   csr_val_C,
-                                    const rocsparse_int*      csr_row_ptr_C,
-                                    rocsparse_int*            csr_col_ind_C,
+                                    double*                   bsr_val_C,
+                                    const rocsparse_int*      bsr_row_ptr_C,
+                                    rocsparse_int*            bsr_col_ind_C,
                                     const rocsparse_mat_info  info_C,
                                     void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrgemm(rocsparse_handle               handle,
+rocsparse_status rocsparse_cbsrgemm(rocsparse_handle               handle,
+                                    rocsparse_direction            dir,
                                     rocsparse_operation            trans_A,
                                     rocsparse_operation            trans_B,
-                                    rocsparse_int                  m,
-                                    rocsparse_int                  n,
-                                    rocsparse_int                  k,
+                                    rocsparse_int                  mb,
+                                    rocsparse_int                  nb,
+                                    rocsparse_int                  kb,
+                                    rocsparse_int                  block_dim,
                                     const rocsparse_float_complex* alpha,
                                     const rocsparse_mat_descr      descr_A,
-                                    rocsparse_int                  nnz_A,
-                                    const rocsparse_float_complex* csr_val_A,
-                                    const rocsparse_int*           csr_row_ptr_A,
-                                    const rocsparse_int*           csr_col_ind_A,
+                                    rocsparse_int                  nnzb_A,
+                                    const rocsparse_float_complex* bsr_val_A,
+                                    const rocsparse_int*           bsr_row_ptr_A,
+                                    const rocsparse_int*           bsr_col_ind_A,
                                     const rocsparse_mat_descr      descr_B,
-                                    rocsparse_int                  nnz_B,
-                                    const rocsparse_float_complex* csr_val_B,
-                                    const rocsparse_int*           csr_row_ptr_B,
-                                    const rocsparse_int*           csr_col_ind_B,
+                                    rocsparse_int                  nnzb_B,
+                                    const rocsparse_float_complex* bsr_val_B,
+                                    const rocsparse_int*           bsr_row_ptr_B,
+                                    const rocsparse_int*           bsr_col_ind_B,
                                     const rocsparse_float_complex* beta,
                                     const rocsparse_mat_descr      descr_D,
-                                    rocsparse_int                  nnz_D,
-                                    const rocsparse_float_complex* csr_val_D,
-                                    const rocsparse_int*           csr_row_ptr_D,
-                                    const rocsparse_int*           csr_col_ind_D,
+                                    rocsparse_int                  nnzb_D,
+                                    const rocsparse_float_complex* bsr_val_D,
+                                    const rocsparse_int*           bsr_row_ptr_D,
+                                    const rocsparse_int*           bsr_col_ind_D,
                                     const rocsparse_mat_descr      descr_C,
-                                    rocsparse_float_complex*       csr_val_C,
-                                    const rocsparse_int*           csr_row_ptr_C,
-                                    rocsparse_int*                 csr_col_ind_C,
+                                    rocsparse_float_complex*       bsr_val_C,
+                                    const rocsparse_int*           bsr_row_ptr_C,
+                                    rocsparse_int*                 bsr_col_ind_C,
                                     const rocsparse_mat_info       info_C,
                                     void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrgemm(rocsparse_handle                handle,
+rocsparse_status rocsparse_zbsrgemm(rocsparse_handle                handle,
+                                    rocsparse_direction             dir,
                                     rocsparse_operation             trans_A,
                                     rocsparse_operation             trans_B,
-                                    rocsparse_int                   m,
-                                    rocsparse_int                   n,
-                                    rocsparse_int                   k,
+                                    rocsparse_int                   mb,
+                                    rocsparse_int                   nb,
+                                    rocsparse_int                   kb,
+                                    rocsparse_int                   block_dim,
                                     const rocsparse_double_complex* alpha,
                                     const rocsparse_mat_descr       descr_A,
-                                    rocsparse_int                   nnz_A,
-                                    const rocsparse_double_complex* csr_val_A,
-                                    const rocsparse_int*            csr_row_ptr_A,
-                                    const rocsparse_int*            csr_col_ind_A,
+                                    rocsparse_int                   nnzb_A,
+                                    const rocsparse_double_complex* bsr_val_A,
+                                    const rocsparse_int*            bsr_row_ptr_A,
+                                    const rocsparse_int*            bsr_col_ind_A,
                                     const rocsparse_mat_descr       descr_B,
-                                    rocsparse_int                   nnz_B,
-                                    const rocsparse_double_complex* csr_val_B,
-                                    const rocsparse_int*            csr_row_ptr_B,
-                                    const rocsparse_int*            csr_col_ind_B,
+                                    rocsparse_int                   nnzb_B,
+                                    const rocsparse_double_complex* bsr_val_B,
+                                    const rocsparse_int*            bsr_row_ptr_B,
+                                    const rocsparse_int*            bsr_col_ind_B,
                                     const rocsparse_double_complex* beta,
                                     const rocsparse_mat_descr       descr_D,
-                                    rocsparse_int                   nnz_D,
-                                    const rocsparse_double_complex* csr_val_D,
-                                    const rocsparse_int*            csr_row_ptr_D,
-                                    const rocsparse_int*            csr_col_ind_D,
+                                    rocsparse_int                   nnzb_D,
+                                    const rocsparse_double_complex* bsr_val_D,
+                                    const rocsparse_int*            bsr_row_ptr_D,
+                                    const rocsparse_int*            bsr_col_ind_D,
                                     const rocsparse_mat_descr       descr_C,
-                                    rocsparse_double_complex*       csr_val_C,
-                                    const rocsparse_int*            csr_row_ptr_C,
-                                    rocsparse_int*                  csr_col_ind_C,
+                                    rocsparse_double_complex*       bsr_val_C,
+                                    const rocsparse_int*            bsr_row_ptr_C,
+                                    rocsparse_int*                  bsr_col_ind_C,
                                     const rocsparse_mat_info        info_C,
                                     void*                           temp_buffer);
 /**@}*/
 
-/*
-* ===========================================================================
-*    preconditioner SPARSE
-* ===========================================================================
-*/
-
-/*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_bsric0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_sbsric0(),
- *  rocsparse_dbsric0(), rocsparse_cbsric0() or rocsparse_zbsric0() computation.
- *  The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same
- *  index base as the BSR matrix.
- *
- *  \p position can be in host or device memory. If no zero pivot has been found,
- *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
- *
- *  \note
- *  If a zero pivot is found, \p position=j means that either the diagonal block \p A(j,j)
- *  is missing (structural zero) or the diagonal block \p A(j,j) is not positive definite
- *  (numerical zero).
- *
- *  \note \p rocsparse_bsric0_zero_pivot is a blocking function. It might influence
- *  performance negatively.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[inout]
- *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
- *              invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
- */
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsric0_zero_pivot(rocsparse_handle   handle,
-                                             rocsparse_mat_info info,
-                                             rocsparse_int*     position);
-
-/*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_bsric0_buffer_size returns the size of the temporary storage buffer
- *  that is required by rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
- *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(), rocsparse_sbsric0(),
- *  rocsparse_dbsric0(), rocsparse_sbsric0() and rocsparse_dbsric0(). The temporary
- *  storage buffer must be allocated by the user. The size of the temporary storage
- *  buffer is identical to the size returned by rocsparse_sbsrsv_buffer_size(),
- *  rocsparse_dbsrsv_buffer_size(), rocsparse_cbsrsv_buffer_size(), rocsparse_zbsrsv_buffer_size(),
- *  rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(), rocsparse_cbsrilu0_buffer_size()
- *  and rocsparse_zbsrilu0_buffer_size() if the matrix sparsity pattern is identical. The user
- *  allocated buffer can thus be shared between subsequent calls to those functions.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir 	    direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
- *              \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[in]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[in]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
- *              rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
- *              rocsparse_sbsric0(), rocsparse_dbsric0(), rocsparse_cbsric0()
- *              and rocsparse_zbsric0().
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
- *              \p bsr_col_ind, \p info or \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_direction       dir,
-                                               rocsparse_int             mb,
-                                               rocsparse_int             nnzb,
-                                               const rocsparse_mat_descr descr,
-                                               const float*              bsr_val,
-                                               const rocsparse_int*      bsr_row_ptr,
-                                               const rocsparse_int*      bsr_col_ind,
-                                               rocsparse_int             block_dim,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_direction       dir,
-                                               rocsparse_int             mb,
-                                               rocsparse_int             nnzb,
-                                               const rocsparse_mat_descr descr,
-                                               const double*             bsr_val,
-                                               const rocsparse_int*      bsr_row_ptr,
-                                               const rocsparse_int*      bsr_col_ind,
-                                               rocsparse_int             block_dim,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsric0_buffer_size(rocsparse_handle               handle,
-                                               rocsparse_direction            dir,
-                                               rocsparse_int                  mb,
-                                               rocsparse_int                  nnzb,
-                                               const rocsparse_mat_descr      descr,
-                                               const rocsparse_float_complex* bsr_val,
-                                               const rocsparse_int*           bsr_row_ptr,
-                                               const rocsparse_int*           bsr_col_ind,
-                                               rocsparse_int                  block_dim,
-                                               rocsparse_mat_info             info,
-                                               size_t*                        buffer_size);
-
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix addition using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgeam_nnz computes the total CSR non-zero elements and the CSR row
+*  offsets, that point to the start of every row of the sparse CSR matrix, of the
+*  resulting matrix C. It is assumed that \p csr_row_ptr_C has been allocated with
+*  size \p m + 1.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+*                  matrix \f$C\f$. \p nnz_C can be a host or device pointer.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+*          \p descr_C, \p csr_row_ptr_C or \p nnz_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsric0_buffer_size(rocsparse_handle                handle,
-                                               rocsparse_direction             dir,
-                                               rocsparse_int                   mb,
-                                               rocsparse_int                   nnzb,
-                                               const rocsparse_mat_descr       descr,
-                                               const rocsparse_double_complex* bsr_val,
-                                               const rocsparse_int*            bsr_row_ptr,
-                                               const rocsparse_int*            bsr_col_ind,
-                                               rocsparse_int                   block_dim,
-                                               rocsparse_mat_info              info,
-                                               size_t*                         buffer_size);
-/**@}*/
+rocsparse_status rocsparse_csrgeam_nnz(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_C,
+                                       rocsparse_int*            csr_row_ptr_C,
+                                       rocsparse_int*            nnz_C);
 
-/*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_bsric0_analysis performs the analysis step for rocsparse_sbsric0()
- *  rocsparse_dbsric0(), rocsparse_cbsric0(), and rocsparse_zbsric0(). It is expected
- *  that this function will be executed only once for a given matrix and particular
- *  operation type. The analysis meta data can be cleared by rocsparse_bsric0_clear().
- *
- *  \p rocsparse_bsric0_analysis can share its meta data with
- *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
- *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
- *  rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
- *  rocsparse_cbsrsv_analysis(), rocsparse_zbsrsv_analysis(),
- *  rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
- *  rocsparse_cbsrsm_analysis() and rocsparse_zbsrsm_analysis(). Selecting
- *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
- *  performance of meta data. However, the user need to make sure that the sparsity
- *  pattern remains unchanged. If this cannot be assured,
- *  \ref rocsparse_analysis_policy_force has to be used.
- *
- *  \note
- *  If the matrix sparsity pattern changes, the gathered information will become invalid.
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir 	    direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
- *              \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[in]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[out]
- *  info        structure that holds the information collected during
- *              the analysis step.
- *  @param[in]
- *  analysis    \ref rocsparse_analysis_policy_reuse or
- *              \ref rocsparse_analysis_policy_force.
- *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
- *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
- *              \p bsr_col_ind, \p info or \p temp_buffer pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- */
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix addition using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgeam multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times n\f$ matrix \f$A\f$, defined in CSR storage format, multiplies the
+*  scalar \f$\beta\f$ with the sparse \f$m \times n\f$ matrix \f$B\f$, defined in CSR
+*  storage format, and adds both resulting matrices to obtain the sparse
+*  \f$m \times n\f$ matrix \f$C\f$, defined in CSR storage format, such that
+*  \f[
+*    C := \alpha \cdot A + \beta \cdot B.
+*  \f]
+*
+*  It is assumed that \p csr_row_ptr_C has already been filled and that \p csr_val_C and
+*  \p csr_col_ind_C are allocated by the user. \p csr_row_ptr_C and allocation size of
+*  \p csr_col_ind_C and \p csr_val_C is defined by the number of non-zero elements of
+*  the sparse CSR matrix C. Both can be obtained by rocsparse_csrgeam_nnz().
+*
+*  \note Both scalars \f$\alpha\f$ and \f$beta\f$ have to be valid.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       array of elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_A, \p csr_val_A,
+*          \p csr_row_ptr_A, \p csr_col_ind_A, \p beta, \p descr_B, \p csr_val_B,
+*          \p csr_row_ptr_B, \p csr_col_ind_B, \p descr_C, \p csr_val_C,
+*          \p csr_row_ptr_C or \p csr_col_ind_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example adds two CSR matrices.
+*  \code{.c}
+*  // Initialize scalar multipliers
+*  float alpha = 1.0f;
+*  float beta  = 1.0f;
+*
+*  // Create matrix descriptors
+*  rocsparse_mat_descr descr_A;
+*  rocsparse_mat_descr descr_B;
+*  rocsparse_mat_descr descr_C;
+*
+*  rocsparse_create_mat_descr(&descr_A);
+*  rocsparse_create_mat_descr(&descr_B);
+*  rocsparse_create_mat_descr(&descr_C);
+*
+*  // Set pointer mode
+*  rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host);
+*
+*  // Obtain number of total non-zero entries in C and row pointers of C
+*  rocsparse_int nnz_C;
+*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+*
+*  rocsparse_csrgeam_nnz(handle,
+*                        m,
+*                        n,
+*                        descr_A,
+*                        nnz_A,
+*                        csr_row_ptr_A,
+*                        csr_col_ind_A,
+*                        descr_B,
+*                        nnz_B,
+*                        csr_row_ptr_B,
+*                        csr_col_ind_B,
+*                        descr_C,
+*                        csr_row_ptr_C,
+*                        &nnz_C);
+*
+*  // Compute column indices and values of C
+*  hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
+*  hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*
+*  rocsparse_scsrgeam(handle,
+*                     m,
+*                     n,
+*                     &alpha,
+*                     descr_A,
+*                     nnz_A,
+*                     csr_val_A,
+*                     csr_row_ptr_A,
+*                     csr_col_ind_A,
+*                     &beta,
+*                     descr_B,
+*                     nnz_B,
+*                     csr_val_B,
+*                     csr_row_ptr_B,
+*                     csr_col_ind_B,
+*                     descr_C,
+*                     csr_val_C,
+*                     csr_row_ptr_C,
+*                     csr_col_ind_C);
+*  \endcode
+*/
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsric0_analysis(rocsparse_handle          handle,
-                                            rocsparse_direction       dir,
-                                            rocsparse_int             mb,
-                                            rocsparse_int             nnzb,
-                                            const rocsparse_mat_descr descr,
-                                            const float*              bsr_val,
-                                            const rocsparse_int*      bsr_row_ptr,
-                                            const rocsparse_int*      bsr_col_ind,
-                                            rocsparse_int             block_dim,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsric0_analysis(rocsparse_handle          handle,
-                                            rocsparse_direction       dir,
-                                            rocsparse_int             mb,
-                                            rocsparse_int             nnzb,
-                                            const rocsparse_mat_descr descr,
-                                            const double*             bsr_val,
-                                            const rocsparse_int*      bsr_row_ptr,
-                                            const rocsparse_int*      bsr_col_ind,
-                                            rocsparse_int             block_dim,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
+rocsparse_status rocsparse_scsrgeam(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const float*              csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const float*              beta,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const float*              csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    float*                    csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsric0_analysis(rocsparse_handle               handle,
-                                            rocsparse_direction            dir,
-                                            rocsparse_int                  mb,
-                                            rocsparse_int                  nnzb,
-                                            const rocsparse_mat_descr      descr,
-                                            const rocsparse_float_complex* bsr_val,
-                                            const rocsparse_int*           bsr_row_ptr,
-                                            const rocsparse_int*           bsr_col_ind,
-                                            rocsparse_int                  block_dim,
-                                            rocsparse_mat_info             info,
-                                            rocsparse_analysis_policy      analysis,
-                                            rocsparse_solve_policy         solve,
-                                            void*                          temp_buffer);
+rocsparse_status rocsparse_dcsrgeam(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const double*             csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const double*             beta,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const double*             csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    double*                   csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsric0_analysis(rocsparse_handle                handle,
-                                            rocsparse_direction             dir,
-                                            rocsparse_int                   mb,
-                                            rocsparse_int                   nnzb,
-                                            const rocsparse_mat_descr       descr,
-                                            const rocsparse_double_complex* bsr_val,
-                                            const rocsparse_int*            bsr_row_ptr,
-                                            const rocsparse_int*            bsr_col_ind,
-                                            rocsparse_int                   block_dim,
-                                            rocsparse_mat_info              info,
-                                            rocsparse_analysis_policy       analysis,
-                                            rocsparse_solve_policy          solve,
-                                            void*                           temp_buffer);
+rocsparse_status rocsparse_ccsrgeam(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr_A,
+                                    rocsparse_int                  nnz_A,
+                                    const rocsparse_float_complex* csr_val_A,
+                                    const rocsparse_int*           csr_row_ptr_A,
+                                    const rocsparse_int*           csr_col_ind_A,
+                                    const rocsparse_float_complex* beta,
+                                    const rocsparse_mat_descr      descr_B,
+                                    rocsparse_int                  nnz_B,
+                                    const rocsparse_float_complex* csr_val_B,
+                                    const rocsparse_int*           csr_row_ptr_B,
+                                    const rocsparse_int*           csr_col_ind_B,
+                                    const rocsparse_mat_descr      descr_C,
+                                    rocsparse_float_complex*       csr_val_C,
+                                    const rocsparse_int*           csr_row_ptr_C,
+                                    rocsparse_int*                 csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgeam(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr_A,
+                                    rocsparse_int                   nnz_A,
+                                    const rocsparse_double_complex* csr_val_A,
+                                    const rocsparse_int*            csr_row_ptr_A,
+                                    const rocsparse_int*            csr_col_ind_A,
+                                    const rocsparse_double_complex* beta,
+                                    const rocsparse_mat_descr       descr_B,
+                                    rocsparse_int                   nnz_B,
+                                    const rocsparse_double_complex* csr_val_B,
+                                    const rocsparse_int*            csr_row_ptr_B,
+                                    const rocsparse_int*            csr_col_ind_B,
+                                    const rocsparse_mat_descr       descr_C,
+                                    rocsparse_double_complex*       csr_val_C,
+                                    const rocsparse_int*            csr_row_ptr_C,
+                                    rocsparse_int*                  csr_col_ind_C);
 /**@}*/
 
-/*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_bsric0_clear deallocates all memory that was allocated by
- *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis()
- *  or rocsparse_zbsric0_analysis(). This is especially useful, if memory is an issue and
- *  the analysis data is not required for further computation.
- *
- *  \note
- *  Calling \p rocsparse_bsric0_clear is optional. All allocated resources will be
- *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
- *  rocsparse_destroy_mat_info().
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[inout]
- *  info        structure that holds the information collected during the analysis step.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
- *              be deallocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- */
+/*! \ingroup extra_module
+*  \brief Sparse matrix sum of multiple matrices using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgeam_multi_nnz computes the total CSR non-zero elements and the CSR
+*  row offsets, that point to the start of every row of the sparse CSR matrix, of the
+*  resulting matrix \f$C = \sum_{i=0}^{num\_mat-1} \alpha_i \cdot A_i\f$. The rows of all
+*  \p num_mat matrices \f$A_i\f$ are merged at once, such that no intermediate matrices
+*  are required. It is assumed that \p csr_row_ptr_C has been allocated with size
+*  \p m + 1.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrices \f$A_i\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrices \f$A_i\f$ and \f$C\f$.
+*  @param[in]
+*  num_mat         number of sparse CSR matrices \f$A_i\f$.
+*  @param[in]
+*  descr_A         host array of \p num_mat descriptors of the sparse CSR matrices
+*                  \f$A_i\f$. Currently, only \ref rocsparse_matrix_type_general is
+*                  supported.
+*  @param[in]
+*  nnz_A           host array of \p num_mat elements containing the number of non-zero
+*                  entries of the sparse CSR matrices \f$A_i\f$.
+*  @param[in]
+*  csr_row_ptr_A   host array of \p num_mat device arrays of \p m+1 elements that point
+*                  to the start of every row of the sparse CSR matrices \f$A_i\f$.
+*  @param[in]
+*  csr_col_ind_A   host array of \p num_mat device arrays of \p nnz_A[i] elements
+*                  containing the column indices of the sparse CSR matrices \f$A_i\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+*                  matrix \f$C\f$. \p nnz_C can be a host or device pointer.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p num_mat or \p nnz_A is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p nnz_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_C, \p csr_row_ptr_C or \p nnz_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_csrgeam_multi_nnz(rocsparse_handle            handle,
+                                             rocsparse_int               m,
+                                             rocsparse_int               n,
+                                             rocsparse_int               num_mat,
+                                             const rocsparse_mat_descr*  descr_A,
+                                             const rocsparse_int*        nnz_A,
+                                             const rocsparse_int* const* csr_row_ptr_A,
+                                             const rocsparse_int* const* csr_col_ind_A,
+                                             const rocsparse_mat_descr   descr_C,
+                                             rocsparse_int*              csr_row_ptr_C,
+                                             rocsparse_int*              nnz_C);
 
-/*! \ingroup precond_module
- *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
- *  storage format
- *
- *  \details
- *  \p rocsparse_bsric0 computes the incomplete Cholesky factorization with 0 fill-ins
- *  and no pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
- *  \f[
- *    A \approx LL^T
- *  \f]
- *
- *  \p rocsparse_bsric0 requires a user allocated temporary buffer. Its size is returned
- *  by rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(),
- *  rocsparse_cbsric0_buffer_size() or rocsparse_zbsric0_buffer_size(). Furthermore,
- *  analysis meta data is required. It can be obtained by rocsparse_sbsric0_analysis(),
- *  rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis() or rocsparse_zbsric0_analysis().
- *  \p rocsparse_bsric0 reports the first zero pivot (either numerical or structural zero).
- *  The zero pivot status can be obtained by calling rocsparse_bsric0_zero_pivot().
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir 	    direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
- *              \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[inout]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
- *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr
- *              or \p bsr_col_ind pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in BSR
- *  storage format. The following example computes the incomplete Cholesky factorization
- *  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
- *  \code{.c}
- *      // Create rocSPARSE handle
- *      rocsparse_handle handle;
- *      rocsparse_create_handle(&handle);
- *
- *      // Create matrix descriptor for M
- *      rocsparse_mat_descr descr_M;
- *      rocsparse_create_mat_descr(&descr_M);
- *
- *      // Create matrix descriptor for L
- *      rocsparse_mat_descr descr_L;
- *      rocsparse_create_mat_descr(&descr_L);
- *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
- *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
- *
- *      // Create matrix descriptor for L'
- *      rocsparse_mat_descr descr_Lt;
- *      rocsparse_create_mat_descr(&descr_Lt);
- *      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
- *      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
- *
- *      // Create matrix info structure
- *      rocsparse_mat_info info;
- *      rocsparse_create_mat_info(&info);
- *
- *      // Obtain required buffer size
- *      size_t buffer_size_M;
- *      size_t buffer_size_L;
- *      size_t buffer_size_Lt;
- *      rocsparse_dbsric0_buffer_size(handle,
- *                                     rocsparse_direction_row,
- *                                     mb,
- *                                     nnzb,
- *                                     descr_M,
- *                                     bsr_val,
- *                                     bsr_row_ptr,
- *                                     bsr_col_ind,
- *                                     block_dim,
- *                                     info,
- *                                     &buffer_size_M);
- *      rocsparse_dbsrsv_buffer_size(handle,
- *                                   rocsparse_direction_row,
- *                                   rocsparse_operation_none,
- *                                   mb,
- *                                   nnzb,
- *                                   descr_L,
- *                                   bsr_val,
- *                                   bsr_row_ptr,
- *                                   bsr_col_ind,
- *                                   block_dim,
- *                                   info,
- *                                   &buffer_size_L);
- *      rocsparse_dbsrsv_buffer_size(handle,
- *                                   rocsparse_direction_row,
- *                                   rocsparse_operation_transpose,
- *                                   mb,
- *                                   nnzb,
- *                                   descr_Lt,
- *                                   bsr_val,
- *                                   bsr_row_ptr,
- *                                   bsr_col_ind,
- *                                   block_dim,
- *                                   info,
- *                                   &buffer_size_Lt);
- *
- *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
- *
- *      // Allocate temporary buffer
- *      void* temp_buffer;
- *      hipMalloc(&temp_buffer, buffer_size);
- *
- *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
- *      // computation performance
- *      rocsparse_dbsric0_analysis(handle,
- *                                  rocsparse_direction_row,
- *                                  mb,
- *                                  nnzb,
- *                                  descr_M,
- *                                  bsr_val,
- *                                  bsr_row_ptr,
- *                                  bsr_col_ind,
- *                                  block_dim,
- *                                  info,
- *                                  rocsparse_analysis_policy_reuse,
- *                                  rocsparse_solve_policy_auto,
- *                                  temp_buffer);
- *      rocsparse_dbsrsv_analysis(handle,
- *                                rocsparse_direction_row,
- *                                rocsparse_operation_none,
- *                                mb,
- *                                nnzb,
- *                                descr_L,
- *                                bsr_val,
- *                                bsr_row_ptr,
- *                                bsr_col_ind,
- *                                block_dim,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
- *      rocsparse_dbsrsv_analysis(handle,
- *                                rocsparse_direction_row,
- *                                rocsparse_operation_transpose,
- *                                mb,
- *                                nnzb,
- *                                descr_Lt,
- *                                bsr_val,
- *                                bsr_row_ptr,
- *                                bsr_col_ind,
- *                                block_dim,
- *                                info,
- *                                rocsparse_analysis_policy_reuse,
- *                                rocsparse_solve_policy_auto,
- *                                temp_buffer);
- *
- *      // Check for zero pivot
- *      rocsparse_int position;
- *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
- *                                                                    info,
- *                                                                    &position))
- *      {
- *          printf("A has structural zero at A(%d,%d)\n", position, position);
- *      }
- *
- *      // Compute incomplete Cholesky factorization M = LL'
- *      rocsparse_dbsric0(handle,
- *                         rocsparse_direction_row,
- *                         mb,
- *                         nnzb,
- *                         descr_M,
- *                         bsr_val,
- *                         bsr_row_ptr,
- *                         bsr_col_ind,
- *                         block_dim,
- *                         info,
- *                         rocsparse_solve_policy_auto,
- *                         temp_buffer);
- *
- *      // Check for zero pivot
- *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
- *                                                                     info,
- *                                                                     &position))
- *      {
- *          printf("L has structural and/or numerical zero at L(%d,%d)\n",
- *                 position,
- *                 position);
- *      }
- *
- *      // Solve Lz = x
- *      rocsparse_dbsrsv_solve(handle,
- *                             rocsparse_direction_row,
- *                             rocsparse_operation_none,
- *                             mb,
- *                             nnzb,
- *                             &alpha,
- *                             descr_L,
- *                             bsr_val,
- *                             bsr_row_ptr,
- *                             bsr_col_ind,
- *                             block_dim,
- *                             info,
- *                             x,
- *                             z,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
- *
- *      // Solve L'y = z
- *      rocsparse_dbsrsv_solve(handle,
- *                             rocsparse_direction_row,
- *                             rocsparse_operation_transpose,
- *                             mb,
- *                             nnzb,
- *                             &alpha,
- *                             descr_Lt,
- *                             bsr_val,
- *                             bsr_row_ptr,
- *                             bsr_col_ind,
- *                             block_dim,
- *                             info,
- *                             z,
- *                             y,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
- *
- *      // Clean up
- *      hipFree(temp_buffer);
- *      rocsparse_destroy_mat_info(info);
- *      rocsparse_destroy_mat_descr(descr_M);
- *      rocsparse_destroy_mat_descr(descr_L);
- *      rocsparse_destroy_mat_descr(descr_Lt);
- *      rocsparse_destroy_handle(handle);
- *  \endcode
- */
+/*! \ingroup extra_module
+*  \brief Sparse matrix sum of multiple matrices using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgeam_multi multiplies each sparse \f$m \times n\f$ matrix \f$A_i\f$,
+*  defined in CSR storage format, with the scalar \f$\alpha_i\f$ and adds all resulting
+*  matrices to obtain the sparse \f$m \times n\f$ matrix \f$C\f$, defined in CSR storage
+*  format, such that
+*  \f[
+*    C := \sum_{i=0}^{num\_mat-1} \alpha_i \cdot A_i.
+*  \f]
+*
+*  The rows of all matrices \f$A_i\f$ are merged in a single pass. Compared to a chain of
+*  rocsparse_Xcsrgeam() calls, no intermediate matrices have to be allocated and each
+*  \f$A_i\f$ is only read once.
+*
+*  It is assumed that \p csr_row_ptr_C has already been filled and that \p csr_val_C and
+*  \p csr_col_ind_C are allocated by the user. \p csr_row_ptr_C and allocation size of
+*  \p csr_col_ind_C and \p csr_val_C is defined by the number of non-zero elements of
+*  the sparse CSR matrix C. Both can be obtained by rocsparse_csrgeam_multi_nnz().
+*
+*  \note The array \p alpha of \p num_mat scalars resides on the host or on the device,
+*        depending on the pointer mode. All other arrays of \p num_mat elements reside
+*        on the host.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrices \f$A_i\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrices \f$A_i\f$ and \f$C\f$.
+*  @param[in]
+*  num_mat         number of sparse CSR matrices \f$A_i\f$.
+*  @param[in]
+*  alpha           array of \p num_mat scalars \f$\alpha_i\f$.
+*  @param[in]
+*  descr_A         host array of \p num_mat descriptors of the sparse CSR matrices
+*                  \f$A_i\f$. Currently, only \ref rocsparse_matrix_type_general is
+*                  supported.
+*  @param[in]
+*  nnz_A           host array of \p num_mat elements containing the number of non-zero
+*                  entries of the sparse CSR matrices \f$A_i\f$.
+*  @param[in]
+*  csr_val_A       host array of \p num_mat device arrays of \p nnz_A[i] elements of the
+*                  sparse CSR matrices \f$A_i\f$.
+*  @param[in]
+*  csr_row_ptr_A   host array of \p num_mat device arrays of \p m+1 elements that point
+*                  to the start of every row of the sparse CSR matrices \f$A_i\f$.
+*  @param[in]
+*  csr_col_ind_A   host array of \p num_mat device arrays of \p nnz_A[i] elements
+*                  containing the column indices of the sparse CSR matrices \f$A_i\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       array of elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p num_mat or \p nnz_A is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_A, \p nnz_A,
+*          \p csr_val_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_C, \p csr_val_C,
+*          \p csr_row_ptr_C or \p csr_col_ind_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example adds three CSR matrices.
+*  \code{.c}
+*  // Initialize scalar multipliers
+*  float alpha[3] = {1.0f, -1.0f, 0.5f};
+*
+*  // Arrays of the three operands
+*  rocsparse_mat_descr  descr_A[3];
+*  rocsparse_int        nnz_A[3];
+*  const float*         csr_val_A[3];
+*  const rocsparse_int* csr_row_ptr_A[3];
+*  const rocsparse_int* csr_col_ind_A[3];
+*
+*  // Create matrix descriptor of C
+*  rocsparse_mat_descr descr_C;
+*  rocsparse_create_mat_descr(&descr_C);
+*
+*  // Set pointer mode
+*  rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host);
+*
+*  // Obtain number of total non-zero entries in C and row pointers of C
+*  rocsparse_int nnz_C;
+*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+*
+*  rocsparse_csrgeam_multi_nnz(handle,
+*                              m,
+*                              n,
+*                              3,
+*                              descr_A,
+*                              nnz_A,
+*                              csr_row_ptr_A,
+*                              csr_col_ind_A,
+*                              descr_C,
+*                              csr_row_ptr_C,
+*                              &nnz_C);
+*
+*  // Compute column indices and values of C
+*  hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
+*  hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*
+*  rocsparse_scsrgeam_multi(handle,
+*                           m,
+*                           n,
+*                           3,
+*                           alpha,
+*                           descr_A,
+*                           nnz_A,
+*                           csr_val_A,
+*                           csr_row_ptr_A,
+*                           csr_col_ind_A,
+*                           descr_C,
+*                           csr_val_C,
+*                           csr_row_ptr_C,
+*                           csr_col_ind_C);
+*  \endcode
+*/
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   float*                    bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   double*                   bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_float_complex*  bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsric0(rocsparse_handle          handle,
-                                   rocsparse_direction       dir,
-                                   rocsparse_int             mb,
-                                   rocsparse_int             nnzb,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_double_complex* bsr_val,
-                                   const rocsparse_int*      bsr_row_ptr,
-                                   const rocsparse_int*      bsr_col_ind,
-                                   rocsparse_int             block_dim,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_scsrgeam_multi(rocsparse_handle            handle,
+                                          rocsparse_int               m,
+                                          rocsparse_int               n,
+                                          rocsparse_int               num_mat,
+                                          const float*                alpha,
+                                          const rocsparse_mat_descr*  descr_A,
+                                          const rocsparse_int*        nnz_A,
+                                          const float* const*         csr_val_A,
+                                          const rocsparse_int* const* csr_row_ptr_A,
+                                          const rocsparse_int* const* csr_col_ind_A,
+                                          const rocsparse_mat_descr   descr_C,
+                                          float*                      csr_val_C,
+                                          const rocsparse_int*        csr_row_ptr_C,
+                                          rocsparse_int*              csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgeam_multi(rocsparse_handle            handle,
+                                          rocsparse_int               m,
+                                          rocsparse_int               n,
+                                          rocsparse_int               num_mat,
+                                          const double*               alpha,
+                                          const rocsparse_mat_descr*  descr_A,
+                                          const rocsparse_int*        nnz_A,
+                                          const double* const*        csr_val_A,
+                                          const rocsparse_int* const* csr_row_ptr_A,
+                                          const rocsparse_int* const* csr_col_ind_A,
+                                          const rocsparse_mat_descr   descr_C,
+                                          double*                     csr_val_C,
+                                          const rocsparse_int*        csr_row_ptr_C,
+                                          rocsparse_int*              csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgeam_multi(rocsparse_handle                      handle,
+                                          rocsparse_int                         m,
+                                          rocsparse_int                         n,
+                                          rocsparse_int                         num_mat,
+                                          const rocsparse_float_complex*        alpha,
+                                          const rocsparse_mat_descr*            descr_A,
+                                          const rocsparse_int*                  nnz_A,
+                                          const rocsparse_float_complex* const* csr_val_A,
+                                          const rocsparse_int* const*           csr_row_ptr_A,
+                                          const rocsparse_int* const*           csr_col_ind_A,
+                                          const rocsparse_mat_descr             descr_C,
+                                          rocsparse_float_complex*              csr_val_C,
+                                          const rocsparse_int*                  csr_row_ptr_C,
+                                          rocsparse_int*                        csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgeam_multi(rocsparse_handle                       handle,
+                                          rocsparse_int                          m,
+                                          rocsparse_int                          n,
+                                          rocsparse_int                          num_mat,
+                                          const rocsparse_double_complex*        alpha,
+                                          const rocsparse_mat_descr*             descr_A,
+                                          const rocsparse_int*                   nnz_A,
+                                          const rocsparse_double_complex* const* csr_val_A,
+                                          const rocsparse_int* const*            csr_row_ptr_A,
+                                          const rocsparse_int* const*            csr_col_ind_A,
+                                          const rocsparse_mat_descr              descr_C,
+                                          rocsparse_double_complex*              csr_val_C,
+                                          const rocsparse_int*                   csr_row_ptr_C,
+                                          rocsparse_int*                         csr_col_ind_C);
 /**@}*/
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
- *  structural or numerical zero has been found during rocsparse_sbsrilu0(),
- *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0() or rocsparse_zbsrilu0() computation.
- *  The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same
- *  index base as the BSR matrix.
- *
- *  \p position can be in host or device memory. If no zero pivot has been found,
- *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
- *
- *  \note
- *  If a zero pivot is found, \p position \f$=j\f$ means that either the diagonal block
- *  \f$A_{j,j}\f$ is missing (structural zero) or the diagonal block \f$A_{j,j}\f$ is not
- *  invertible (numerical zero).
- *
- *  \note \p rocsparse_bsrilu0_zero_pivot is a blocking function. It might influence
- *  performance negatively.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[inout]
- *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
- *              invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
- */
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix element-wise operation using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrewise_nnz computes the total CSR non-zero elements and the CSR row
+*  offsets, that point to the start of every row of the sparse CSR matrix, of the
+*  resulting matrix C of an element-wise operation with sparsity pattern \p pattern.
+*  For \ref rocsparse_ewise_pattern_intersection, C contains all entries that are
+*  present in both, A and B. For \ref rocsparse_ewise_pattern_union, C contains all
+*  entries that are present in A or B. It is assumed that \p csr_row_ptr_C has been
+*  allocated with size \p m + 1.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  pattern         sparsity pattern of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+*                  matrix \f$C\f$. \p nnz_C can be a host or device pointer.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is invalid.
+*  \retval rocsparse_status_invalid_value \p pattern is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+*          \p descr_C, \p csr_row_ptr_C or \p nnz_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsrilu0_zero_pivot(rocsparse_handle   handle,
-                                              rocsparse_mat_info info,
-                                              rocsparse_int*     position);
+rocsparse_status rocsparse_csrewise_nnz(rocsparse_handle          handle,
+                                        rocsparse_ewise_pattern   pattern,
+                                        rocsparse_int             m,
+                                        rocsparse_int             n,
+                                        const rocsparse_mat_descr descr_A,
+                                        rocsparse_int             nnz_A,
+                                        const rocsparse_int*      csr_row_ptr_A,
+                                        const rocsparse_int*      csr_col_ind_A,
+                                        const rocsparse_mat_descr descr_B,
+                                        rocsparse_int             nnz_B,
+                                        const rocsparse_int*      csr_row_ptr_B,
+                                        const rocsparse_int*      csr_col_ind_B,
+                                        const rocsparse_mat_descr descr_C,
+                                        rocsparse_int*            csr_row_ptr_C,
+                                        rocsparse_int*            nnz_C);
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_numeric_boost enables the user to replace a numerical value in
- *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
- *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
- *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
- *
- *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
- *  setting \p enable_boost to 0.
- *
- *  \note \p tol and \p boost_val can be in host or device memory.
- *
- *  @param[in]
- *  handle          handle to the rocsparse library context queue.
- *  @param[in]
- *  info            structure that holds the information collected during the analysis step.
- *  @param[in]
- *  enable_boost    enable/disable numeric boost.
- *  @param[in]
- *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
- *  @param[in]
- *  boost_val       boost value to replace a numerical value.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
- *              is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- */
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix element-wise operation using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrewise applies the binary operator \p op element-wise to the sparse
+*  \f$m \times n\f$ matrices \f$A\f$ and \f$B\f$, defined in CSR storage format, to
+*  obtain the sparse \f$m \times n\f$ matrix \f$C\f$, defined in CSR storage format,
+*  such that
+*  \f[
+*    C_{ij} := \left\{
+*    \begin{array}{ll}
+*        A_{ij} \odot B_{ij}, & \text{if $A_{ij}$ and $B_{ij}$ are present} \\
+*        A_{ij}, & \text{if only $A_{ij}$ is present and pattern == union} \\
+*        B_{ij}, & \text{if only $B_{ij}$ is present and pattern == union}
+*    \end{array}
+*    \right.
+*  \f]
+*
+*  For \ref rocsparse_ewise_pattern_intersection, e.g. the Hadamard product of \f$A\f$
+*  and \f$B\f$, only entries that are present in both matrices are computed. For
+*  \ref rocsparse_ewise_pattern_union, entries that are present in only one of the
+*  matrices are copied to \f$C\f$. Entries that are not present are not treated as
+*  explicit zeros.
+*
+*  It is assumed that \p csr_row_ptr_C has already been filled and that \p csr_val_C and
+*  \p csr_col_ind_C are allocated by the user. \p csr_row_ptr_C and allocation size of
+*  \p csr_col_ind_C and \p csr_val_C is defined by the number of non-zero elements of
+*  the sparse CSR matrix C. Both can be obtained by rocsparse_csrewise_nnz(), using the
+*  same \p pattern.
+*
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note \ref rocsparse_ewise_op_min and \ref rocsparse_ewise_op_max are only supported
+*        for real data types.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  pattern         sparsity pattern of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  op              binary operator \f$\odot\f$.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$A\f$, \f$B\f$ and \f$C\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       array of elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p nnz_A or \p nnz_B is invalid.
+*  \retval rocsparse_status_invalid_value \p pattern or \p op is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_val_A,
+*          \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B, \p csr_val_B,
+*          \p csr_row_ptr_B, \p csr_col_ind_B, \p descr_C, \p csr_val_C,
+*          \p csr_row_ptr_C or \p csr_col_ind_C is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general, or
+*          \p op is \ref rocsparse_ewise_op_min or \ref rocsparse_ewise_op_max for
+*          complex data types.
+*
+*  \par Example
+*  This example computes the Hadamard product of two CSR matrices.
+*  \code{.c}
+*  // Create matrix descriptors
+*  rocsparse_mat_descr descr_A;
+*  rocsparse_mat_descr descr_B;
+*  rocsparse_mat_descr descr_C;
+*
+*  rocsparse_create_mat_descr(&descr_A);
+*  rocsparse_create_mat_descr(&descr_B);
+*  rocsparse_create_mat_descr(&descr_C);
+*
+*  // Set pointer mode
+*  rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host);
+*
+*  // Obtain number of total non-zero entries in C and row pointers of C
+*  rocsparse_int nnz_C;
+*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+*
+*  rocsparse_csrewise_nnz(handle,
+*                         rocsparse_ewise_pattern_intersection,
+*                         m,
+*                         n,
+*                         descr_A,
+*                         nnz_A,
+*                         csr_row_ptr_A,
+*                         csr_col_ind_A,
+*                         descr_B,
+*                         nnz_B,
+*                         csr_row_ptr_B,
+*                         csr_col_ind_B,
+*                         descr_C,
+*                         csr_row_ptr_C,
+*                         &nnz_C);
+*
+*  // Compute column indices and values of C
+*  hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
+*  hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*
+*  rocsparse_scsrewise(handle,
+*                      rocsparse_ewise_pattern_intersection,
+*                      rocsparse_ewise_op_mul,
+*                      m,
+*                      n,
+*                      descr_A,
+*                      nnz_A,
+*                      csr_val_A,
+*                      csr_row_ptr_A,
+*                      csr_col_ind_A,
+*                      descr_B,
+*                      nnz_B,
+*                      csr_val_B,
+*                      csr_row_ptr_B,
+*                      csr_col_ind_B,
+*                      descr_C,
+*                      csr_val_C,
+*                      csr_row_ptr_C,
+*                      csr_col_ind_C);
+*  \endcode
+*/
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const float*       boost_tol,
-                                                  const float*       boost_val);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const double*      boost_tol,
-                                                  const double*      boost_val);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0_numeric_boost(rocsparse_handle               handle,
-                                                  rocsparse_mat_info             info,
-                                                  int                            enable_boost,
-                                                  const float*                   boost_tol,
-                                                  const rocsparse_float_complex* boost_val);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0_numeric_boost(rocsparse_handle                handle,
-                                                  rocsparse_mat_info              info,
-                                                  int                             enable_boost,
-                                                  const double*                   boost_tol,
-                                                  const rocsparse_double_complex* boost_val);
+rocsparse_status rocsparse_scsrewise(rocsparse_handle          handle,
+                                     rocsparse_ewise_pattern   pattern,
+                                     rocsparse_ewise_op        op,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr descr_A,
+                                     rocsparse_int             nnz_A,
+                                     const float*              csr_val_A,
+                                     const rocsparse_int*      csr_row_ptr_A,
+                                     const rocsparse_int*      csr_col_ind_A,
+                                     const rocsparse_mat_descr descr_B,
+                                     rocsparse_int             nnz_B,
+                                     const float*              csr_val_B,
+                                     const rocsparse_int*      csr_row_ptr_B,
+                                     const rocsparse_int*      csr_col_ind_B,
+                                     const rocsparse_mat_descr descr_C,
+                                     float*                    csr_val_C,
+                                     const rocsparse_int*      csr_row_ptr_C,
+                                     rocsparse_int*            csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrewise(rocsparse_handle          handle,
+                                     rocsparse_ewise_pattern   pattern,
+                                     rocsparse_ewise_op        op,
+                                     rocsparse_int             m,
+                                     rocsparse_int             n,
+                                     const rocsparse_mat_descr descr_A,
+                                     rocsparse_int             nnz_A,
+                                     const double*             csr_val_A,
+                                     const rocsparse_int*      csr_row_ptr_A,
+                                     const rocsparse_int*      csr_col_ind_A,
+                                     const rocsparse_mat_descr descr_B,
+                                     rocsparse_int             nnz_B,
+                                     const double*             csr_val_B,
+                                     const rocsparse_int*      csr_row_ptr_B,
+                                     const rocsparse_int*      csr_col_ind_B,
+                                     const rocsparse_mat_descr descr_C,
+                                     double*                   csr_val_C,
+                                     const rocsparse_int*      csr_row_ptr_C,
+                                     rocsparse_int*            csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrewise(rocsparse_handle               handle,
+                                     rocsparse_ewise_pattern        pattern,
+                                     rocsparse_ewise_op             op,
+                                     rocsparse_int                  m,
+                                     rocsparse_int                  n,
+                                     const rocsparse_mat_descr      descr_A,
+                                     rocsparse_int                  nnz_A,
+                                     const rocsparse_float_complex* csr_val_A,
+                                     const rocsparse_int*           csr_row_ptr_A,
+                                     const rocsparse_int*           csr_col_ind_A,
+                                     const rocsparse_mat_descr      descr_B,
+                                     rocsparse_int                  nnz_B,
+                                     const rocsparse_float_complex* csr_val_B,
+                                     const rocsparse_int*           csr_row_ptr_B,
+                                     const rocsparse_int*           csr_col_ind_B,
+                                     const rocsparse_mat_descr      descr_C,
+                                     rocsparse_float_complex*       csr_val_C,
+                                     const rocsparse_int*           csr_row_ptr_C,
+                                     rocsparse_int*                 csr_col_ind_C);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrewise(rocsparse_handle                handle,
+                                     rocsparse_ewise_pattern         pattern,
+                                     rocsparse_ewise_op              op,
+                                     rocsparse_int                   m,
+                                     rocsparse_int                   n,
+                                     const rocsparse_mat_descr       descr_A,
+                                     rocsparse_int                   nnz_A,
+                                     const rocsparse_double_complex* csr_val_A,
+                                     const rocsparse_int*            csr_row_ptr_A,
+                                     const rocsparse_int*            csr_col_ind_A,
+                                     const rocsparse_mat_descr       descr_B,
+                                     rocsparse_int                   nnz_B,
+                                     const rocsparse_double_complex* csr_val_B,
+                                     const rocsparse_int*            csr_row_ptr_B,
+                                     const rocsparse_int*            csr_col_ind_B,
+                                     const rocsparse_mat_descr       descr_C,
+                                     rocsparse_double_complex*       csr_val_C,
+                                     const rocsparse_int*            csr_row_ptr_C,
+                                     rocsparse_int*                  csr_col_ind_C);
 /**@}*/
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_buffer_size returns the size of the temporary storage buffer
- *  that is required by rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
- *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(), rocsparse_sbsrilu0(),
- *  rocsparse_dbsrilu0(), rocsparse_sbsrilu0() and rocsparse_dbsrilu0(). The temporary
- *  storage buffer must be allocated by the user. The size of the temporary storage
- *  buffer is identical to the size returned by rocsparse_sbsrsv_buffer_size(),
- *  rocsparse_dbsrsv_buffer_size(), rocsparse_cbsrsv_buffer_size(), rocsparse_zbsrsv_buffer_size(),
- *  rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(), rocsparse_cbsric0_buffer_size()
- *  and rocsparse_zbsric0_buffer_size() if the matrix sparsity pattern is identical. The user
- *  allocated buffer can thus be shared between subsequent calls to those functions.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir         direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
- *              \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[in]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[out]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[in]
- *  buffer_size number of bytes of the temporary storage buffer required by
- *              rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
- *              rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
- *              rocsparse_sbsrilu0(), rocsparse_dbsrilu0(), rocsparse_cbsrilu0()
- *              and rocsparse_zbsrilu0().
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
- *              \p bsr_col_ind, \p info or \p buffer_size pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- */
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_csrgemm_nnz(), rocsparse_scsrgemm(),
+*  rocsparse_dcsrgemm(), rocsparse_ccsrgemm() and rocsparse_zcsrgemm(). The temporary
+*  storage buffer must be allocated by the user.
+*
+*  \note
+*  Please note, that for matrix products with more than 4096 non-zero entries per row,
+*  additional temporary storage buffer is allocated by the algorithm.
+*  \note
+*  Please note, that for matrix products with more than 8192 intermediate products per
+*  row, additional temporary storage buffer is allocated by the algorithm.
+*  \note
+*  For \p trans_A == \ref rocsparse_operation_transpose or \p trans_B ==
+*  \ref rocsparse_operation_transpose, the temporary storage buffer additionally holds
+*  the transposed sparsity patterns of \f$A\f$ and \f$B\f$ and their values.
+*  \note
+*  Currently, \ref rocsparse_operation_conjugate_transpose is not supported.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(A)\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(B)\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[in]
+*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the sparse
+*                  CSR matrix \f$D\f$.
+*  @param[inout]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csrgemm_nnz(), rocsparse_scsrgemm(), rocsparse_dcsrgemm(),
+*                  rocsparse_ccsrgemm() and rocsparse_zcsrgemm().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_D is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p descr_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B,
+*          \p csr_row_ptr_B or \p csr_col_ind_B are invalid if \p alpha is valid,
+*          \p descr_D, \p csr_row_ptr_D or \p csr_col_ind_D is invalid if \p beta is
+*          valid, \p info_C or \p buffer_size is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A == \ref rocsparse_operation_conjugate_transpose,
+*          \p trans_B == \ref rocsparse_operation_conjugate_transpose, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_direction       dir,
-                                                rocsparse_int             mb,
-                                                rocsparse_int             nnzb,
-                                                const rocsparse_mat_descr descr,
-                                                const float*              bsr_val,
-                                                const rocsparse_int*      bsr_row_ptr,
-                                                const rocsparse_int*      bsr_col_ind,
-                                                rocsparse_int             block_dim,
-                                                rocsparse_mat_info        info,
+rocsparse_status rocsparse_scsrgemm_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             k,
+                                                const float*              alpha,
+                                                const rocsparse_mat_descr descr_A,
+                                                rocsparse_int             nnz_A,
+                                                const rocsparse_int*      csr_row_ptr_A,
+                                                const rocsparse_int*      csr_col_ind_A,
+                                                const rocsparse_mat_descr descr_B,
+                                                rocsparse_int             nnz_B,
+                                                const rocsparse_int*      csr_row_ptr_B,
+                                                const rocsparse_int*      csr_col_ind_B,
+                                                const float*              beta,
+                                                const rocsparse_mat_descr descr_D,
+                                                rocsparse_int             nnz_D,
+                                                const rocsparse_int*      csr_row_ptr_D,
+                                                const rocsparse_int*      csr_col_ind_D,
+                                                rocsparse_mat_info        info_C,
                                                 size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_direction       dir,
-                                                rocsparse_int             mb,
-                                                rocsparse_int             nnzb,
-                                                const rocsparse_mat_descr descr,
-                                                const double*             bsr_val,
-                                                const rocsparse_int*      bsr_row_ptr,
-                                                const rocsparse_int*      bsr_col_ind,
-                                                rocsparse_int             block_dim,
-                                                rocsparse_mat_info        info,
+rocsparse_status rocsparse_dcsrgemm_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             k,
+                                                const double*             alpha,
+                                                const rocsparse_mat_descr descr_A,
+                                                rocsparse_int             nnz_A,
+                                                const rocsparse_int*      csr_row_ptr_A,
+                                                const rocsparse_int*      csr_col_ind_A,
+                                                const rocsparse_mat_descr descr_B,
+                                                rocsparse_int             nnz_B,
+                                                const rocsparse_int*      csr_row_ptr_B,
+                                                const rocsparse_int*      csr_col_ind_B,
+                                                const double*             beta,
+                                                const rocsparse_mat_descr descr_D,
+                                                rocsparse_int             nnz_D,
+                                                const rocsparse_int*      csr_row_ptr_D,
+                                                const rocsparse_int*      csr_col_ind_D,
+                                                rocsparse_mat_info        info_C,
                                                 size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0_buffer_size(rocsparse_handle               handle,
-                                                rocsparse_direction            dir,
-                                                rocsparse_int                  mb,
-                                                rocsparse_int                  nnzb,
-                                                const rocsparse_mat_descr      descr,
-                                                const rocsparse_float_complex* bsr_val,
-                                                const rocsparse_int*           bsr_row_ptr,
-                                                const rocsparse_int*           bsr_col_ind,
-                                                rocsparse_int                  block_dim,
-                                                rocsparse_mat_info             info,
+rocsparse_status rocsparse_ccsrgemm_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_operation            trans_A,
+                                                rocsparse_operation            trans_B,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  n,
+                                                rocsparse_int                  k,
+                                                const rocsparse_float_complex* alpha,
+                                                const rocsparse_mat_descr      descr_A,
+                                                rocsparse_int                  nnz_A,
+                                                const rocsparse_int*           csr_row_ptr_A,
+                                                const rocsparse_int*           csr_col_ind_A,
+                                                const rocsparse_mat_descr      descr_B,
+                                                rocsparse_int                  nnz_B,
+                                                const rocsparse_int*           csr_row_ptr_B,
+                                                const rocsparse_int*           csr_col_ind_B,
+                                                const rocsparse_float_complex* beta,
+                                                const rocsparse_mat_descr      descr_D,
+                                                rocsparse_int                  nnz_D,
+                                                const rocsparse_int*           csr_row_ptr_D,
+                                                const rocsparse_int*           csr_col_ind_D,
+                                                rocsparse_mat_info             info_C,
                                                 size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0_buffer_size(rocsparse_handle                handle,
-                                                rocsparse_direction             dir,
-                                                rocsparse_int                   mb,
-                                                rocsparse_int                   nnzb,
-                                                const rocsparse_mat_descr       descr,
-                                                const rocsparse_double_complex* bsr_val,
-                                                const rocsparse_int*            bsr_row_ptr,
-                                                const rocsparse_int*            bsr_col_ind,
-                                                rocsparse_int                   block_dim,
-                                                rocsparse_mat_info              info,
+rocsparse_status rocsparse_zcsrgemm_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_operation             trans_A,
+                                                rocsparse_operation             trans_B,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   n,
+                                                rocsparse_int                   k,
+                                                const rocsparse_double_complex* alpha,
+                                                const rocsparse_mat_descr       descr_A,
+                                                rocsparse_int                   nnz_A,
+                                                const rocsparse_int*            csr_row_ptr_A,
+                                                const rocsparse_int*            csr_col_ind_A,
+                                                const rocsparse_mat_descr       descr_B,
+                                                rocsparse_int                   nnz_B,
+                                                const rocsparse_int*            csr_row_ptr_B,
+                                                const rocsparse_int*            csr_col_ind_B,
+                                                const rocsparse_double_complex* beta,
+                                                const rocsparse_mat_descr       descr_D,
+                                                rocsparse_int                   nnz_D,
+                                                const rocsparse_int*            csr_row_ptr_D,
+                                                const rocsparse_int*            csr_col_ind_D,
+                                                rocsparse_mat_info              info_C,
                                                 size_t*                         buffer_size);
 /**@}*/
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_analysis performs the analysis step for rocsparse_sbsrilu0()
- *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0(), and rocsparse_zbsrilu0(). It is expected
- *  that this function will be executed only once for a given matrix. The analysis meta
- *  data can be cleared by rocsparse_bsrilu0_clear().
- *
- *  \p rocsparse_bsrilu0_analysis can share its meta data with
- *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
- *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
- *  rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
- *  rocsparse_cbsrsv_analysis(), rocsparse_zbsrsv_analysis(),
- *  rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
- *  rocsparse_cbsrsm_analysis() and rocsparse_zbsrsm_analysis(). Selecting
- *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
- *  performance of meta data. However, the user need to make sure that the sparsity
- *  pattern remains unchanged. If this cannot be assured,
- *  \ref rocsparse_analysis_policy_force has to be used.
- *
- *  \note
- *  If the matrix sparsity pattern changes, the gathered information will become invalid.
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir         direction that specified whether to count nonzero elements by
- *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[in]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[out]
- *  info        structure that holds the information collected during
- *              the analysis step.
- *  @param[in]
- *  analysis    \ref rocsparse_analysis_policy_reuse or
- *              \ref rocsparse_analysis_policy_force.
- *  @param[in]
- *  solve       \ref rocsparse_solve_policy_auto.
- *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
- *              \p bsr_col_ind, \p info or \p temp_buffer pointer is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_direction       dir,
-                                             rocsparse_int             mb,
-                                             rocsparse_int             nnzb,
-                                             const rocsparse_mat_descr descr,
-                                             const float*              bsr_val,
-                                             const rocsparse_int*      bsr_row_ptr,
-                                             const rocsparse_int*      bsr_col_ind,
-                                             rocsparse_int             block_dim,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_direction       dir,
-                                             rocsparse_int             mb,
-                                             rocsparse_int             nnzb,
-                                             const rocsparse_mat_descr descr,
-                                             const double*             bsr_val,
-                                             const rocsparse_int*      bsr_row_ptr,
-                                             const rocsparse_int*      bsr_col_ind,
-                                             rocsparse_int             block_dim,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0_analysis(rocsparse_handle               handle,
-                                             rocsparse_direction            dir,
-                                             rocsparse_int                  mb,
-                                             rocsparse_int                  nnzb,
-                                             const rocsparse_mat_descr      descr,
-                                             const rocsparse_float_complex* bsr_val,
-                                             const rocsparse_int*           bsr_row_ptr,
-                                             const rocsparse_int*           bsr_col_ind,
-                                             rocsparse_int                  block_dim,
-                                             rocsparse_mat_info             info,
-                                             rocsparse_analysis_policy      analysis,
-                                             rocsparse_solve_policy         solve,
-                                             void*                          temp_buffer);
-
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm_nnz computes the total CSR non-zero elements and the CSR row
+*  offsets, that point to the start of every row of the sparse CSR matrix, of the
+*  resulting multiplied matrix C. It is assumed that \p csr_row_ptr_C has been allocated
+*  with size \p m + 1.
+*  The required buffer size can be obtained by rocsparse_scsrgemm_buffer_size(),
+*  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() and
+*  rocsparse_zcsrgemm_buffer_size(), respectively.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*  \note
+*  Please note, that for matrix products with more than 8192 intermediate products per
+*  row, additional temporary storage buffer is allocated by the algorithm.
+*  \note
+*  For \p trans_A == \ref rocsparse_operation_transpose or \p trans_B ==
+*  \ref rocsparse_operation_transpose, the transposed sparsity patterns of \f$A\f$ and
+*  \f$B\f$ are stored in \p temp_buffer. Its content has to be preserved until the
+*  values are computed by rocsparse_scsrgemm(), rocsparse_dcsrgemm(),
+*  rocsparse_ccsrgemm() or rocsparse_zcsrgemm().
+*  \note
+*  Currently, \ref rocsparse_operation_conjugate_transpose is not supported.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note
+*  If the matrix type of \p descr_C is \ref rocsparse_matrix_type_symmetric, only the
+*  triangle of \f$C\f$ selected by the fill mode of \p descr_C is computed and stored.
+*  This is supported for the products \f$A^T \cdot A\f$ and \f$A \cdot A^T\f$, i.e.
+*  \f$B\f$ has to be \f$A\f$ and exactly one of both operands has to be transposed.
+*  Entries of \f$D\f$ outside of this triangle are ignored.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(A)\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(B)\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the sparse
+*                  CSR matrix \f$D\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+*                  matrix \f$C\f$.
+*  @param[in]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_scsrgemm_buffer_size(),
+*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
+*                  rocsparse_zcsrgemm_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_D is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+*          \p descr_D, \p csr_row_ptr_D, \p csr_col_ind_D, \p descr_C,
+*          \p csr_row_ptr_C, \p nnz_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
+*          allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A == \ref rocsparse_operation_conjugate_transpose,
+*          \p trans_B == \ref rocsparse_operation_conjugate_transpose, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general, except for a
+*          symmetric \f$C\f$ of the product \f$A^T \cdot A\f$ or \f$A \cdot A^T\f$.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0_analysis(rocsparse_handle                handle,
-                                             rocsparse_direction             dir,
-                                             rocsparse_int                   mb,
-                                             rocsparse_int                   nnzb,
-                                             const rocsparse_mat_descr       descr,
-                                             const rocsparse_double_complex* bsr_val,
-                                             const rocsparse_int*            bsr_row_ptr,
-                                             const rocsparse_int*            bsr_col_ind,
-                                             rocsparse_int                   block_dim,
-                                             rocsparse_mat_info              info,
-                                             rocsparse_analysis_policy       analysis,
-                                             rocsparse_solve_policy          solve,
-                                             void*                           temp_buffer);
-/**@}*/
+rocsparse_status rocsparse_csrgemm_nnz(rocsparse_handle          handle,
+                                       rocsparse_operation       trans_A,
+                                       rocsparse_operation       trans_B,
+                                       rocsparse_int             m,
+                                       rocsparse_int             n,
+                                       rocsparse_int             k,
+                                       const rocsparse_mat_descr descr_A,
+                                       rocsparse_int             nnz_A,
+                                       const rocsparse_int*      csr_row_ptr_A,
+                                       const rocsparse_int*      csr_col_ind_A,
+                                       const rocsparse_mat_descr descr_B,
+                                       rocsparse_int             nnz_B,
+                                       const rocsparse_int*      csr_row_ptr_B,
+                                       const rocsparse_int*      csr_col_ind_B,
+                                       const rocsparse_mat_descr descr_D,
+                                       rocsparse_int             nnz_D,
+                                       const rocsparse_int*      csr_row_ptr_D,
+                                       const rocsparse_int*      csr_col_ind_D,
+                                       const rocsparse_mat_descr descr_C,
+                                       rocsparse_int*            csr_row_ptr_C,
+                                       rocsparse_int*            nnz_C,
+                                       const rocsparse_mat_info  info_C,
+                                       void*                     temp_buffer);
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0_clear deallocates all memory that was allocated by
- *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis()
- *  or rocsparse_zbsrilu0_analysis(). This is especially useful, if memory is an issue and
- *  the analysis data is not required for further computation.
- *
- *  \note
- *  Calling \p rocsparse_bsrilu0_clear is optional. All allocated resources will be
- *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
- *  rocsparse_destroy_mat_info().
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[inout]
- *  info        structure that holds the information collected during the analysis step.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
- *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
- *              be deallocated.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- */
+/*! \ingroup extra_module
+*  \brief Estimate the number of non-zero entries of a sparse matrix sparse matrix
+*  multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm_nnz_estimate computes the exact number of intermediate products
+*  of \f$op(A) \cdot op(B)\f$ and an estimate of the number of non-zero entries of
+*  \f$C := op(A) \cdot op(B)\f$ without computing the sparsity pattern of \f$C\f$.
+*  The estimate is obtained by computing the number of non-zero entries of
+*  \p sample_size rows of \f$C\f$, that are evenly distributed over all \p m rows.
+*  The ratio of non-zero entries and intermediate products of the sampled rows is then
+*  extrapolated to the full matrix. Additionally, a 95% confidence interval
+*  \f$[nnz\_C\_lower, nnz\_C\_upper]\f$ of the estimate is returned.
+*
+*  The estimate can be used to plan memory allocations and to decide between different
+*  SpGEMM algorithms before calling rocsparse_csrgemm_nnz(). A ratio of non-zero
+*  entries and intermediate products close to one indicates that only few products
+*  are accumulated into the same entry of \f$C\f$.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*  \note
+*  If \p sample_size is larger or equal to \p m, all rows are sampled. Sampled rows
+*  with more than 2048 intermediate products are counted probabilistically, otherwise
+*  the count is exact.
+*  \note
+*  Currently, only \p trans_A == \p trans_B == \ref rocsparse_operation_none is
+*  supported.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  sample_size     number of rows of \f$C\f$ that are sampled.
+*  @param[out]
+*  nnz_products    pointer to the number of intermediate products of
+*                  \f$op(A) \cdot op(B)\f$.
+*  @param[out]
+*  nnz_C           pointer to the estimated number of non-zero entries of the sparse
+*                  CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C_lower     pointer to the lower bound of the confidence interval of \p nnz_C.
+*  @param[out]
+*  nnz_C_upper     pointer to the upper bound of the confidence interval of \p nnz_C.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p sample_size is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+*          \p nnz_products, \p nnz_C, \p nnz_C_lower or \p nnz_C_upper is invalid.
+*  \retval rocsparse_status_invalid_value \p trans_A, \p trans_B or the index base of
+*          \p descr_A or \p descr_B is invalid.
+*  \retval rocsparse_status_memory_error additional buffer for the sampled rows could
+*          not be allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_csrgemm_nnz_estimate(rocsparse_handle          handle,
+                                                rocsparse_operation       trans_A,
+                                                rocsparse_operation       trans_B,
+                                                rocsparse_int             m,
+                                                rocsparse_int             n,
+                                                rocsparse_int             k,
+                                                const rocsparse_mat_descr descr_A,
+                                                rocsparse_int             nnz_A,
+                                                const rocsparse_int*      csr_row_ptr_A,
+                                                const rocsparse_int*      csr_col_ind_A,
+                                                const rocsparse_mat_descr descr_B,
+                                                rocsparse_int             nnz_B,
+                                                const rocsparse_int*      csr_row_ptr_B,
+                                                const rocsparse_int*      csr_col_ind_B,
+                                                rocsparse_int             sample_size,
+                                                int64_t*                  nnz_products,
+                                                int64_t*                  nnz_C,
+                                                int64_t*                  nnz_C_lower,
+                                                int64_t*                  nnz_C_upper);
 
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_bsrilu0 computes the incomplete LU factorization with 0 fill-ins and no
- *  pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
- *  \f[
- *    A \approx LU
- *  \f]
- *
- *  \p rocsparse_bsrilu0 requires a user allocated temporary buffer. Its size is returned
- *  by rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(),
- *  rocsparse_cbsrilu0_buffer_size() or rocsparse_zbsrilu0_buffer_size(). Furthermore,
- *  analysis meta data is required. It can be obtained by rocsparse_sbsrilu0_analysis(),
- *  rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis() or
- *  rocsparse_zbsrilu0_analysis(). \p rocsparse_bsrilu0 reports the first zero pivot
- *  (either numerical or structural zero). The zero pivot status can be obtained by
- *  calling rocsparse_bsrilu0_zero_pivot().
- *
- *  \note
- *  This function is non blocking and executed asynchronously with respect to the host.
- *  It may return before the actual computation has finished.
- *
- *  @param[in]
- *  handle      handle to the rocsparse library context queue.
- *  @param[in]
- *  dir         direction that specified whether to count nonzero elements by
- *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
- *  @param[in]
- *  mb          number of block rows in the sparse BSR matrix.
- *  @param[in]
- *  nnzb        number of non-zero block entries of the sparse BSR matrix.
- *  @param[in]
- *  descr       descriptor of the sparse BSR matrix.
- *  @param[inout]
- *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
- *  @param[in]
- *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
- *              sparse BSR matrix.
- *  @param[in]
- *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
- *  @param[in]
- *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
- *  @param[in]
- *  info        structure that holds the information collected during the analysis step.
- *  @param[in]
- *  policy      \ref rocsparse_solve_policy_auto.
- *  @param[in]
- *  temp_buffer temporary storage buffer allocated by the user.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
- *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr
- *              or \p bsr_col_ind pointer is invalid.
- *  \retval     rocsparse_status_arch_mismatch the device is not supported.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- *  \retval     rocsparse_status_not_implemented
- *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
- *
- *  \par Example
- *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in BSR
- *  storage format. The following example computes the incomplete LU factorization
- *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
- *  \code{.c}
- *      // Create rocSPARSE handle
- *      rocsparse_handle handle;
- *      rocsparse_create_handle(&handle);
- *
- *      // Create matrix descriptor for M
- *      rocsparse_mat_descr descr_M;
- *      rocsparse_create_mat_descr(&descr_M);
- *
- *      // Create matrix descriptor for L
- *      rocsparse_mat_descr descr_L;
- *      rocsparse_create_mat_descr(&descr_L);
- *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
- *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
- *
- *      // Create matrix descriptor for U
- *      rocsparse_mat_descr descr_U;
- *      rocsparse_create_mat_descr(&descr_U);
- *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
- *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
- *
- *      // Create matrix info structure
- *      rocsparse_mat_info info;
- *      rocsparse_create_mat_info(&info);
- *
- *      // Obtain required buffer size
- *      size_t buffer_size_M;
- *      size_t buffer_size_L;
- *      size_t buffer_size_U;
- *      rocsparse_dbsrilu0_buffer_size(handle,
- *                                     rocsparse_direction_row,
- *                                     mb,
- *                                     nnzb,
- *                                     descr_M,
- *                                     bsr_val,
- *                                     bsr_row_ptr,
- *                                     bsr_col_ind,
- *                                     block_dim,
- *                                     info,
- *                                     &buffer_size_M);
- *      rocsparse_dbsrsv_buffer_size(handle,
- *                                   rocsparse_direction_row,
- *                                   rocsparse_operation_none,
- *                                   mb,
- *                                   nnzb,
- *                                   descr_L,
- *                                   bsr_val,
- *                                   bsr_row_ptr,
- *                                   bsr_col_ind,
- *                                   block_dim,
- *                                   info,
- *                                   &buffer_size_L);
- *      rocsparse_dbsrsv_buffer_size(handle,
- *                                   rocsparse_direction_row,
- *                                   rocsparse_operation_transpose,
- *                                   mb,
- *                                   nnzb,
- *                                   descr_U,
- *                                   bsr_val,
- *                                   bsr_row_ptr,
- *                                   bsr_col_ind,
- *                                   block_dim,
- *                                   info,
- *                                   &buffer_size_U);
- *
- *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
- *
- *      // Allocate temporary buffer
- *      void* temp_buffer;
- *      hipMalloc(&temp_buffer, buffer_size);
- *
- *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
- *      // computation performance
- *      rocsparse_dbsrilu0_analysis(handle,
- *                                  rocsparse_direction_row,
- *                                  mb,
- *                                  nnzb,
- *                                  descr_M,
- *                                  bsr_val,
- *                                  bsr_row_ptr,
- *                                  bsr_col_ind,
- *                                  block_dim,
- *                                  info,
- *                                  rocsparse_analysis_policy_reuse,
- *                                  rocsparse_solve_policy_auto,
- *                                  temp_buffer);
- *      rocsparse_dbsrsv_analysis(handle,
- *                                rocsparse_direction_row,
- *                                rocsparse_operation_none,
- *                                mb,
- *                                nnzb,
- *                                descr_L,
- *                                bsr_val,
- *                                bsr_row_ptr,
- *                                bsr_col_ind,
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times k\f$ matrix \f$A\f$, defined in CSR storage format, and the sparse
+*  \f$k \times n\f$ matrix \f$B\f$, defined in CSR storage format, and adds the result
+*  to the sparse \f$m \times n\f$ matrix \f$D\f$ that is multiplied by \f$\beta\f$. The
+*  final result is stored in the sparse \f$m \times n\f$ matrix \f$C\f$, defined in CSR
+*  storage format, such
+*  that
+*  \f[
+*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot D,
+*  \f]
+*  with
+*  \f[
+*    op(A) = \left\{
+*    \begin{array}{ll}
+*        A,   & \text{if trans_A == rocsparse_operation_none} \\
+*        A^T, & \text{if trans_A == rocsparse_operation_transpose} \\
+*        A^H, & \text{if trans_A == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  and
+*  \f[
+*    op(B) = \left\{
+*    \begin{array}{ll}
+*        B,   & \text{if trans_B == rocsparse_operation_none} \\
+*        B^T, & \text{if trans_B == rocsparse_operation_transpose} \\
+*        B^H, & \text{if trans_B == rocsparse_operation_conjugate_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*
+*  It is assumed that \p csr_row_ptr_C has already been filled and that \p csr_val_C and
+*  \p csr_col_ind_C are allocated by the user. \p csr_row_ptr_C and allocation size of
+*  \p csr_col_ind_C and \p csr_val_C is defined by the number of non-zero elements of
+*  the sparse CSR matrix C. Both can be obtained by rocsparse_csrgemm_nnz(). The
+*  required buffer size for the computation can be obtained by
+*  rocsparse_scsrgemm_buffer_size(), rocsparse_dcsrgemm_buffer_size(),
+*  rocsparse_ccsrgemm_buffer_size() and rocsparse_zcsrgemm_buffer_size(), respectively.
+*
+*  \note If \f$\alpha == 0\f$, then \f$C = \beta \cdot D\f$ will be computed.
+*  \note If \f$\beta == 0\f$, then \f$C = \alpha \cdot op(A) \cdot op(B)\f$ will be computed.
+*  \note \f$\alpha == beta == 0\f$ is invalid.
+*  \note For \p trans_A == \ref rocsparse_operation_transpose or \p trans_B ==
+*  \ref rocsparse_operation_transpose, the values of \f$A\f$ and \f$B\f$ are gathered
+*  into their transposed sparsity patterns stored in \p temp_buffer by
+*  rocsparse_csrgemm_nnz().
+*  \note Currently, \ref rocsparse_operation_conjugate_transpose is not supported.
+*  \note If the matrix type of \p descr_C is \ref rocsparse_matrix_type_symmetric, only
+*  the triangle of \f$C\f$ selected by the fill mode of \p descr_C is stored, see
+*  rocsparse_csrgemm_nnz().
+*  \note Otherwise, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*  \note Please note, that for matrix products with more than 4096 non-zero entries per
+*  row, additional temporary storage buffer is allocated by the algorithm.
+*  \note The first call groups the rows of \f$C\f$ by their number of non-zero entries
+*  and keeps this grouping in \p info_C. Subsequent calls with the same sparsity pattern
+*  of \f$C\f$, e.g. with updated values of \f$A\f$ and \f$B\f$, only run the numerical
+*  kernels and do not synchronize with the host. The grouping is discarded by
+*  rocsparse_csrgemm_nnz() and the buffer size functions. If \p csr_row_ptr_C is modified
+*  otherwise, rocsparse_csrgemm_nnz() has to be called again.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements (\f$op(A) == A\f$, \p k+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(A)\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements (\f$op(B) == B\f$, \p m+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$op(B)\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[in]
+*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_val_D       array of \p nnz_D elements of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       array of \p nnz_C elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_scsrgemm_buffer_size(),
+*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
+*                  rocsparse_zcsrgemm_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_D is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p descr_A, \p csr_val_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B,
+*          \p csr_val_B, \p csr_row_ptr_B or \p csr_col_ind_B are invalid if \p alpha
+*          is valid, \p descr_D, \p csr_val_D, \p csr_row_ptr_D or \p csr_col_ind_D is
+*          invalid if \p beta is valid, \p csr_val_C, \p csr_row_ptr_C,
+*          \p csr_col_ind_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
+*          allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A == \ref rocsparse_operation_conjugate_transpose,
+*          \p trans_B == \ref rocsparse_operation_conjugate_transpose, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general, except for a
+*          symmetric \f$C\f$ of the product \f$A^T \cdot A\f$ or \f$A \cdot A^T\f$.
+*
+*  \par Example
+*  This example multiplies two CSR matrices with a scalar alpha and adds the result to
+*  another CSR matrix.
+*  \code{.c}
+*  // Initialize scalar multipliers
+*  float alpha = 2.0f;
+*  float beta  = 1.0f;
+*
+*  // Create matrix descriptors
+*  rocsparse_mat_descr descr_A;
+*  rocsparse_mat_descr descr_B;
+*  rocsparse_mat_descr descr_C;
+*  rocsparse_mat_descr descr_D;
+*
+*  rocsparse_create_mat_descr(&descr_A);
+*  rocsparse_create_mat_descr(&descr_B);
+*  rocsparse_create_mat_descr(&descr_C);
+*  rocsparse_create_mat_descr(&descr_D);
+*
+*  // Create matrix info structure
+*  rocsparse_mat_info info_C;
+*  rocsparse_create_mat_info(&info_C);
+*
+*  // Set pointer mode
+*  rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host);
+*
+*  // Query rocsparse for the required buffer size
+*  size_t buffer_size;
+*
+*  rocsparse_scsrgemm_buffer_size(handle,
+*                                 rocsparse_operation_none,
+*                                 rocsparse_operation_none,
+*                                 m,
+*                                 n,
+*                                 k,
+*                                 &alpha,
+*                                 descr_A,
+*                                 nnz_A,
+*                                 csr_row_ptr_A,
+*                                 csr_col_ind_A,
+*                                 descr_B,
+*                                 nnz_B,
+*                                 csr_row_ptr_B,
+*                                 csr_col_ind_B,
+*                                 &beta,
+*                                 descr_D,
+*                                 nnz_D,
+*                                 csr_row_ptr_D,
+*                                 csr_col_ind_D,
+*                                 info_C,
+*                                 &buffer_size);
+*
+*  // Allocate buffer
+*  void* buffer;
+*  hipMalloc(&buffer, buffer_size);
+*
+*  // Obtain number of total non-zero entries in C and row pointers of C
+*  rocsparse_int nnz_C;
+*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+*
+*  rocsparse_csrgemm_nnz(handle,
+*                        rocsparse_operation_none,
+*                        rocsparse_operation_none,
+*                        m,
+*                        n,
+*                        k,
+*                        descr_A,
+*                        nnz_A,
+*                        csr_row_ptr_A,
+*                        csr_col_ind_A,
+*                        descr_B,
+*                        nnz_B,
+*                        csr_row_ptr_B,
+*                        csr_col_ind_B,
+*                        descr_D,
+*                        nnz_D,
+*                        csr_row_ptr_D,
+*                        csr_col_ind_D,
+*                        descr_C,
+*                        csr_row_ptr_C,
+*                        &nnz_C,
+*                        info_C,
+*                        buffer);
+*
+*  // Compute column indices and values of C
+*  hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
+*  hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*
+*  rocsparse_scsrgemm(handle,
+*                     rocsparse_operation_none,
+*                     rocsparse_operation_none,
+*                     m,
+*                     n,
+*                     k,
+*                     &alpha,
+*                     descr_A,
+*                     nnz_A,
+*                     csr_val_A,
+*                     csr_row_ptr_A,
+*                     csr_col_ind_A,
+*                     descr_B,
+*                     nnz_B,
+*                     csr_val_B,
+*                     csr_row_ptr_B,
+*                     csr_col_ind_B,
+*                     &beta,
+*                     descr_D,
+*                     nnz_D,
+*                     csr_val_D,
+*                     csr_row_ptr_D,
+*                     csr_col_ind_D,
+*                     descr_C,
+*                     csr_val_C,
+*                     csr_row_ptr_C,
+*                     csr_col_ind_C,
+*                     info_C,
+*                     buffer);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrgemm(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const float*              alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const float*              csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const float*              csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const float*              beta,
+                                    const rocsparse_mat_descr descr_D,
+                                    rocsparse_int             nnz_D,
+                                    const float*              csr_val_D,
+                                    const rocsparse_int*      csr_row_ptr_D,
+                                    const rocsparse_int*      csr_col_ind_D,
+                                    const rocsparse_mat_descr descr_C,
+                                    float*                    csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C,
+                                    const rocsparse_mat_info  info_C,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgemm(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    rocsparse_int             m,
+                                    rocsparse_int             n,
+                                    rocsparse_int             k,
+                                    const double*             alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    rocsparse_int             nnz_A,
+                                    const double*             csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    rocsparse_int             nnz_B,
+                                    const double*             csr_val_B,
+                                    const rocsparse_int*      csr_row_ptr_B,
+                                    const rocsparse_int*      csr_col_ind_B,
+                                    const double*             beta,
+                                    const rocsparse_mat_descr descr_D,
+                                    rocsparse_int             nnz_D,
+                                    const double*             csr_val_D,
+                                    const rocsparse_int*      csr_row_ptr_D,
+                                    const rocsparse_int*      csr_col_ind_D,
+                                    const rocsparse_mat_descr descr_C,
+                                    double*                   csr_val_C,
+                                    const rocsparse_int*      csr_row_ptr_C,
+                                    rocsparse_int*            csr_col_ind_C,
+                                    const rocsparse_mat_info  info_C,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgemm(rocsparse_handle               handle,
+                                    rocsparse_operation            trans_A,
+                                    rocsparse_operation            trans_B,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  n,
+                                    rocsparse_int                  k,
+                                    const rocsparse_float_complex* alpha,
+                                    const rocsparse_mat_descr      descr_A,
+                                    rocsparse_int                  nnz_A,
+                                    const rocsparse_float_complex* csr_val_A,
+                                    const rocsparse_int*           csr_row_ptr_A,
+                                    const rocsparse_int*           csr_col_ind_A,
+                                    const rocsparse_mat_descr      descr_B,
+                                    rocsparse_int                  nnz_B,
+                                    const rocsparse_float_complex* csr_val_B,
+                                    const rocsparse_int*           csr_row_ptr_B,
+                                    const rocsparse_int*           csr_col_ind_B,
+                                    const rocsparse_float_complex* beta,
+                                    const rocsparse_mat_descr      descr_D,
+                                    rocsparse_int                  nnz_D,
+                                    const rocsparse_float_complex* csr_val_D,
+                                    const rocsparse_int*           csr_row_ptr_D,
+                                    const rocsparse_int*           csr_col_ind_D,
+                                    const rocsparse_mat_descr      descr_C,
+                                    rocsparse_float_complex*       csr_val_C,
+                                    const rocsparse_int*           csr_row_ptr_C,
+                                    rocsparse_int*                 csr_col_ind_C,
+                                    const rocsparse_mat_info       info_C,
+                                    void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgemm(rocsparse_handle                handle,
+                                    rocsparse_operation             trans_A,
+                                    rocsparse_operation             trans_B,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   n,
+                                    rocsparse_int                   k,
+                                    const rocsparse_double_complex* alpha,
+                                    const rocsparse_mat_descr       descr_A,
+                                    rocsparse_int                   nnz_A,
+                                    const rocsparse_double_complex* csr_val_A,
+                                    const rocsparse_int*            csr_row_ptr_A,
+                                    const rocsparse_int*            csr_col_ind_A,
+                                    const rocsparse_mat_descr       descr_B,
+                                    rocsparse_int                   nnz_B,
+                                    const rocsparse_double_complex* csr_val_B,
+                                    const rocsparse_int*            csr_row_ptr_B,
+                                    const rocsparse_int*            csr_col_ind_B,
+                                    const rocsparse_double_complex* beta,
+                                    const rocsparse_mat_descr       descr_D,
+                                    rocsparse_int                   nnz_D,
+                                    const rocsparse_double_complex* csr_val_D,
+                                    const rocsparse_int*            csr_row_ptr_D,
+                                    const rocsparse_int*            csr_col_ind_D,
+                                    const rocsparse_mat_descr       descr_C,
+                                    rocsparse_double_complex*       csr_val_C,
+                                    const rocsparse_int*            csr_row_ptr_C,
+                                    rocsparse_int*                  csr_col_ind_C,
+                                    const rocsparse_mat_info        info_C,
+                                    void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup extra_module
+*  \brief Sparse matrix sparse matrix multiplication using CSR storage format and a
+*  bounded amount of device memory for \f$C\f$
+*
+*  \details
+*  \p rocsparse_csrgemm_chunked computes
+*  \f[
+*    C := \alpha \cdot op(A) \cdot op(B) + \beta \cdot D,
+*  \f]
+*  similar to rocsparse_scsrgemm(), rocsparse_dcsrgemm(), rocsparse_ccsrgemm() and
+*  rocsparse_zcsrgemm(). In contrast to those, the column indices and values of the
+*  sparse CSR matrix \f$C\f$ are not required to reside in device memory. The rows of
+*  \f$C\f$ are split into consecutive row panels, such that each panel fits into the
+*  user allocated device buffer \p panel_buffer of \p panel_buffer_size bytes. The
+*  panels are computed one after another and each finished panel is copied to the
+*  arrays \p csr_col_ind_C and \p csr_val_C, which are expected to be allocated in host
+*  memory. Thus, products where \f$C\f$ exceeds the available device memory can be
+*  computed.
+*
+*  It is assumed that \p csr_row_ptr_C has already been filled in device memory by
+*  rocsparse_csrgemm_nnz(), which only requires \f$\mathcal{O}(m)\f$ device memory for
+*  \f$C\f$. The panels are obtained from the exact number of non-zero entries per row of
+*  \f$C\f$. A panel of \f$r\f$ rows with \f$p\f$ non-zero entries requires
+*  \f$\lceil 4(r+1)/256 \rceil \cdot 256 + \lceil 4p/256 \rceil \cdot 256 + p \cdot
+*  \text{sizeof}(T)\f$ bytes of \p panel_buffer. The temporary storage buffer
+*  \p temp_buffer and \p info_C are the same as for rocsparse_csrgemm_nnz().
+*
+*  \note If \f$\alpha == 0\f$, then \f$C = \beta \cdot D\f$ will be computed.
+*  \note If \f$\beta == 0\f$, then \f$C = \alpha \cdot op(A) \cdot op(B)\f$ will be computed.
+*  \note \f$\alpha == beta == 0\f$ is invalid.
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note This function blocks the host to obtain the row pointers of \f$C\f$. The
+*        copies of the last panels to \p csr_col_ind_C and \p csr_val_C may still be in
+*        flight when the function returns. The stream has to be synchronized before the
+*        host arrays are accessed. Pinned host memory is recommended for
+*        \p csr_col_ind_C and \p csr_val_C.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  beta            scalar \f$\beta\f$.
+*  @param[in]
+*  descr_D         descriptor of the sparse CSR matrix \f$D\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_D           number of non-zero entries of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_val_D       array of \p nnz_D elements of the sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_row_ptr_D   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  csr_col_ind_D   array of \p nnz_D elements containing the column indices of the
+*                  sparse CSR matrix \f$D\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       host array of \p nnz_C elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   device array of \p m+1 elements that point to the start of every row
+*                  of the sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   host array of \p nnz_C elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  panel_buffer_size size of \p panel_buffer in bytes.
+*  @param[in]
+*  panel_buffer    device buffer allocated by the user that holds one panel of \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_scsrgemm_buffer_size(),
+*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
+*                  rocsparse_zcsrgemm_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_D is invalid, or a single row of \f$C\f$ does not fit into
+*          \p panel_buffer_size bytes.
+*  \retval rocsparse_status_invalid_pointer \p alpha and \p beta are invalid,
+*          \p descr_A, \p csr_val_A, \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B,
+*          \p csr_val_B, \p csr_row_ptr_B or \p csr_col_ind_B are invalid if \p alpha
+*          is valid, \p descr_D, \p csr_val_D, \p csr_row_ptr_D or \p csr_col_ind_D is
+*          invalid if \p beta is valid, \p csr_val_C, \p csr_row_ptr_C,
+*          \p csr_col_ind_C, \p info_C, \p panel_buffer or \p temp_buffer is invalid.
+*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
+*          allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example squares a CSR matrix, where the result is streamed to pinned host memory
+*  using a panel buffer of 64 MB.
+*  \code{.c}
+*  // Query rocsparse for the required buffer size and obtain the row pointers of C
+*  rocsparse_scsrgemm_buffer_size(handle,
+*                                 rocsparse_operation_none,
+*                                 rocsparse_operation_none,
+*                                 m,
+*                                 m,
+*                                 m,
+*                                 &alpha,
+*                                 descr_A,
+*                                 nnz_A,
+*                                 csr_row_ptr_A,
+*                                 csr_col_ind_A,
+*                                 descr_A,
+*                                 nnz_A,
+*                                 csr_row_ptr_A,
+*                                 csr_col_ind_A,
+*                                 NULL,
+*                                 NULL,
+*                                 0,
+*                                 NULL,
+*                                 NULL,
+*                                 info_C,
+*                                 &buffer_size);
+*
+*  hipMalloc(&buffer, buffer_size);
+*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+*
+*  rocsparse_csrgemm_nnz(handle,
+*                        rocsparse_operation_none,
+*                        rocsparse_operation_none,
+*                        m,
+*                        m,
+*                        m,
+*                        descr_A,
+*                        nnz_A,
+*                        csr_row_ptr_A,
+*                        csr_col_ind_A,
+*                        descr_A,
+*                        nnz_A,
+*                        csr_row_ptr_A,
+*                        csr_col_ind_A,
+*                        NULL,
+*                        0,
+*                        NULL,
+*                        NULL,
+*                        descr_C,
+*                        csr_row_ptr_C,
+*                        &nnz_C,
+*                        info_C,
+*                        buffer);
+*
+*  // Allocate C in pinned host memory and the panel buffer in device memory
+*  hipHostMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
+*  hipHostMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*
+*  size_t panel_buffer_size = 64 << 20;
+*  hipMalloc(&panel_buffer, panel_buffer_size);
+*
+*  rocsparse_scsrgemm_chunked(handle,
+*                             rocsparse_operation_none,
+*                             rocsparse_operation_none,
+*                             m,
+*                             m,
+*                             m,
+*                             &alpha,
+*                             descr_A,
+*                             nnz_A,
+*                             csr_val_A,
+*                             csr_row_ptr_A,
+*                             csr_col_ind_A,
+*                             descr_A,
+*                             nnz_A,
+*                             csr_val_A,
+*                             csr_row_ptr_A,
+*                             csr_col_ind_A,
+*                             NULL,
+*                             NULL,
+*                             0,
+*                             NULL,
+*                             NULL,
+*                             NULL,
+*                             descr_C,
+*                             csr_val_C,
+*                             csr_row_ptr_C,
+*                             csr_col_ind_C,
+*                             info_C,
+*                             panel_buffer_size,
+*                             panel_buffer,
+*                             buffer);
+*
+*  // Wait for the last panel to arrive on the host
+*  hipStreamSynchronize(stream);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrgemm_chunked(rocsparse_handle          handle,
+                                            rocsparse_operation       trans_A,
+                                            rocsparse_operation       trans_B,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             k,
+                                            const float*              alpha,
+                                            const rocsparse_mat_descr descr_A,
+                                            rocsparse_int             nnz_A,
+                                            const float*              csr_val_A,
+                                            const rocsparse_int*      csr_row_ptr_A,
+                                            const rocsparse_int*      csr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            rocsparse_int             nnz_B,
+                                            const float*              csr_val_B,
+                                            const rocsparse_int*      csr_row_ptr_B,
+                                            const rocsparse_int*      csr_col_ind_B,
+                                            const float*              beta,
+                                            const rocsparse_mat_descr descr_D,
+                                            rocsparse_int             nnz_D,
+                                            const float*              csr_val_D,
+                                            const rocsparse_int*      csr_row_ptr_D,
+                                            const rocsparse_int*      csr_col_ind_D,
+                                            const rocsparse_mat_descr descr_C,
+                                            float*                    csr_val_C,
+                                            const rocsparse_int*      csr_row_ptr_C,
+                                            rocsparse_int*            csr_col_ind_C,
+                                            const rocsparse_mat_info  info_C,
+                                            size_t                    panel_buffer_size,
+                                            void*                     panel_buffer,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgemm_chunked(rocsparse_handle          handle,
+                                            rocsparse_operation       trans_A,
+                                            rocsparse_operation       trans_B,
+                                            rocsparse_int             m,
+                                            rocsparse_int             n,
+                                            rocsparse_int             k,
+                                            const double*             alpha,
+                                            const rocsparse_mat_descr descr_A,
+                                            rocsparse_int             nnz_A,
+                                            const double*             csr_val_A,
+                                            const rocsparse_int*      csr_row_ptr_A,
+                                            const rocsparse_int*      csr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            rocsparse_int             nnz_B,
+                                            const double*             csr_val_B,
+                                            const rocsparse_int*      csr_row_ptr_B,
+                                            const rocsparse_int*      csr_col_ind_B,
+                                            const double*             beta,
+                                            const rocsparse_mat_descr descr_D,
+                                            rocsparse_int             nnz_D,
+                                            const double*             csr_val_D,
+                                            const rocsparse_int*      csr_row_ptr_D,
+                                            const rocsparse_int*      csr_col_ind_D,
+                                            const rocsparse_mat_descr descr_C,
+                                            double*                   csr_val_C,
+                                            const rocsparse_int*      csr_row_ptr_C,
+                                            rocsparse_int*            csr_col_ind_C,
+                                            const rocsparse_mat_info  info_C,
+                                            size_t                    panel_buffer_size,
+                                            void*                     panel_buffer,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgemm_chunked(rocsparse_handle               handle,
+                                            rocsparse_operation            trans_A,
+                                            rocsparse_operation            trans_B,
+                                            rocsparse_int                  m,
+                                            rocsparse_int                  n,
+                                            rocsparse_int                  k,
+                                            const rocsparse_float_complex* alpha,
+                                            const rocsparse_mat_descr      descr_A,
+                                            rocsparse_int                  nnz_A,
+                                            const rocsparse_float_complex* csr_val_A,
+                                            const rocsparse_int*           csr_row_ptr_A,
+                                            const rocsparse_int*           csr_col_ind_A,
+                                            const rocsparse_mat_descr      descr_B,
+                                            rocsparse_int                  nnz_B,
+                                            const rocsparse_float_complex* csr_val_B,
+                                            const rocsparse_int*           csr_row_ptr_B,
+                                            const rocsparse_int*           csr_col_ind_B,
+                                            const rocsparse_float_complex* beta,
+                                            const rocsparse_mat_descr      descr_D,
+                                            rocsparse_int                  nnz_D,
+                                            const rocsparse_float_complex* csr_val_D,
+                                            const rocsparse_int*           csr_row_ptr_D,
+                                            const rocsparse_int*           csr_col_ind_D,
+                                            const rocsparse_mat_descr      descr_C,
+                                            rocsparse_float_complex*       csr_val_C,
+                                            const rocsparse_int*           csr_row_ptr_C,
+                                            rocsparse_int*                 csr_col_ind_C,
+                                            const rocsparse_mat_info       info_C,
+                                            size_t                         panel_buffer_size,
+                                            void*                          panel_buffer,
+                                            void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgemm_chunked(rocsparse_handle                handle,
+                                            rocsparse_operation             trans_A,
+                                            rocsparse_operation             trans_B,
+                                            rocsparse_int                   m,
+                                            rocsparse_int                   n,
+                                            rocsparse_int                   k,
+                                            const rocsparse_double_complex* alpha,
+                                            const rocsparse_mat_descr       descr_A,
+                                            rocsparse_int                   nnz_A,
+                                            const rocsparse_double_complex* csr_val_A,
+                                            const rocsparse_int*            csr_row_ptr_A,
+                                            const rocsparse_int*            csr_col_ind_A,
+                                            const rocsparse_mat_descr       descr_B,
+                                            rocsparse_int                   nnz_B,
+                                            const rocsparse_double_complex* csr_val_B,
+                                            const rocsparse_int*            csr_row_ptr_B,
+                                            const rocsparse_int*            csr_col_ind_B,
+                                            const rocsparse_double_complex* beta,
+                                            const rocsparse_mat_descr       descr_D,
+                                            rocsparse_int                   nnz_D,
+                                            const rocsparse_double_complex* csr_val_D,
+                                            const rocsparse_int*            csr_row_ptr_D,
+                                            const rocsparse_int*            csr_col_ind_D,
+                                            const rocsparse_mat_descr       descr_C,
+                                            rocsparse_double_complex*       csr_val_C,
+                                            const rocsparse_int*            csr_row_ptr_C,
+                                            rocsparse_int*                  csr_col_ind_C,
+                                            const rocsparse_mat_info        info_C,
+                                            size_t                          panel_buffer_size,
+                                            void*                           panel_buffer,
+                                            void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup extra_module
+*  \brief Masked sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm_masked_nnz computes the total CSR non-zero elements and the CSR
+*  row offsets, that point to the start of every row of the sparse CSR matrix, of the
+*  resulting masked matrix
+*  \f[
+*    C\langle M \rangle := \alpha \cdot op(A) \cdot op(B).
+*  \f]
+*  Only the entries of \f$op(A) \cdot op(B)\f$ that are present in the sparsity
+*  pattern of the \f$m \times n\f$ mask matrix \f$M\f$ are computed
+*  (\ref rocsparse_mask_type_structural), or, if the mask is complemented, only those
+*  that are absent from it (\ref rocsparse_mask_type_complement). The values of
+*  \f$M\f$ are not accessed. Masked entries are skipped before they are accumulated,
+*  such that neither the work nor the memory for entries outside of the mask is spent.
+*  This is the common access pattern of graph algorithms, e.g. triangle counting
+*  \f$C\langle A \rangle := A \cdot A\f$ or breadth-first search with a complemented
+*  mask of the visited vertices.
+*  It is assumed that \p csr_row_ptr_C has already been allocated with size \p m+1.
+*  The required buffer size and \p info_C are obtained by
+*  rocsparse_scsrgemm_buffer_size(), rocsparse_dcsrgemm_buffer_size(),
+*  rocsparse_ccsrgemm_buffer_size() and rocsparse_zcsrgemm_buffer_size() with
+*  \f$\beta == 0\f$ (\p beta == \p NULL).
+*
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note Each row of \f$M\f$ must be sorted by column index.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$, \f$M\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$, \f$M\f$
+*                  and \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_M         descriptor of the sparse CSR mask matrix \f$M\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_M           number of non-zero entries of the sparse CSR mask matrix \f$M\f$.
+*  @param[in]
+*  csr_row_ptr_M   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR mask matrix \f$M\f$.
+*  @param[in]
+*  csr_col_ind_M   array of \p nnz_M elements containing the sorted column indices of
+*                  the sparse CSR mask matrix \f$M\f$.
+*  @param[in]
+*  mask_type       \ref rocsparse_mask_type_structural or
+*                  \ref rocsparse_mask_type_complement.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+*                  matrix \f$C\f$.
+*  @param[in]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_scsrgemm_buffer_size(),
+*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
+*                  rocsparse_zcsrgemm_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_M is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_A, \p csr_row_ptr_A,
+*          \p csr_col_ind_A, \p descr_B, \p csr_row_ptr_B, \p csr_col_ind_B,
+*          \p descr_M, \p csr_row_ptr_M, \p csr_col_ind_M, \p descr_C,
+*          \p csr_row_ptr_C, \p nnz_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_invalid_value \p mask_type is invalid, or \p info_C has
+*          not been set up for \f$C := \alpha \cdot op(A) \cdot op(B)\f$.
+*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
+*          allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrgemm_masked_nnz(rocsparse_handle          handle,
+                                              rocsparse_operation       trans_A,
+                                              rocsparse_operation       trans_B,
+                                              rocsparse_int             m,
+                                              rocsparse_int             n,
+                                              rocsparse_int             k,
+                                              const rocsparse_mat_descr descr_A,
+                                              rocsparse_int             nnz_A,
+                                              const rocsparse_int*      csr_row_ptr_A,
+                                              const rocsparse_int*      csr_col_ind_A,
+                                              const rocsparse_mat_descr descr_B,
+                                              rocsparse_int             nnz_B,
+                                              const rocsparse_int*      csr_row_ptr_B,
+                                              const rocsparse_int*      csr_col_ind_B,
+                                              const rocsparse_mat_descr descr_M,
+                                              rocsparse_int             nnz_M,
+                                              const rocsparse_int*      csr_row_ptr_M,
+                                              const rocsparse_int*      csr_col_ind_M,
+                                              rocsparse_mask_type       mask_type,
+                                              const rocsparse_mat_descr descr_C,
+                                              rocsparse_int*            csr_row_ptr_C,
+                                              rocsparse_int*            nnz_C,
+                                              const rocsparse_mat_info  info_C,
+                                              void*                     temp_buffer);
+
+/*! \ingroup extra_module
+*  \brief Masked sparse matrix sparse matrix multiplication using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrgemm_masked computes
+*  \f[
+*    C\langle M \rangle := \alpha \cdot op(A) \cdot op(B),
+*  \f]
+*  where only the entries of \f$op(A) \cdot op(B)\f$ that are present in (or, for
+*  \ref rocsparse_mask_type_complement, absent from) the sparsity pattern of the mask
+*  matrix \f$M\f$ are computed. It is assumed that \p csr_row_ptr_C has already been
+*  filled by rocsparse_csrgemm_masked_nnz() with the same mask, and that
+*  \p csr_col_ind_C and \p csr_val_C are allocated by the user.
+*
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \ref rocsparse_matrix_type_general is supported.
+*  \note Each row of \f$M\f$ must be sorted by column index.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A         matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B         matrix \f$B\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(A)\f$, \f$M\f$ and
+*                  \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$op(B)\f$, \f$M\f$
+*                  and \f$C\f$.
+*  @param[in]
+*  k               number of columns of the sparse CSR matrix \f$op(A)\f$ and number of
+*                  rows of the sparse CSR matrix \f$op(B)\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_B         descriptor of the sparse CSR matrix \f$B\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_B           number of non-zero entries of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_val_B       array of \p nnz_B elements of the sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_row_ptr_B   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  csr_col_ind_B   array of \p nnz_B elements containing the column indices of the
+*                  sparse CSR matrix \f$B\f$.
+*  @param[in]
+*  descr_M         descriptor of the sparse CSR mask matrix \f$M\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_M           number of non-zero entries of the sparse CSR mask matrix \f$M\f$.
+*  @param[in]
+*  csr_row_ptr_M   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR mask matrix \f$M\f$.
+*  @param[in]
+*  csr_col_ind_M   array of \p nnz_M elements containing the sorted column indices of
+*                  the sparse CSR mask matrix \f$M\f$.
+*  @param[in]
+*  mask_type       \ref rocsparse_mask_type_structural or
+*                  \ref rocsparse_mask_type_complement.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currenty, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       array of \p nnz_C elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_scsrgemm_buffer_size(),
+*                  rocsparse_dcsrgemm_buffer_size(), rocsparse_ccsrgemm_buffer_size() or
+*                  rocsparse_zcsrgemm_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_A, \p nnz_B or
+*          \p nnz_M is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_A, \p csr_val_A,
+*          \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_B, \p csr_val_B,
+*          \p csr_row_ptr_B, \p csr_col_ind_B, \p descr_M, \p csr_row_ptr_M,
+*          \p csr_col_ind_M, \p descr_C, \p csr_val_C, \p csr_row_ptr_C,
+*          \p csr_col_ind_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_invalid_value \p mask_type is invalid, or \p info_C has
+*          not been set up for \f$C := \alpha \cdot op(A) \cdot op(B)\f$.
+*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
+*          allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, or
+*          \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  This example computes the number of paths of length two between adjacent vertices of
+*  a graph, which is the basis of triangle counting.
+*  \code{.c}
+*  // Set up info_C for C = alpha * A * A
+*  rocsparse_scsrgemm_buffer_size(handle,
+*                                 rocsparse_operation_none,
+*                                 rocsparse_operation_none,
+*                                 m,
+*                                 m,
+*                                 m,
+*                                 &alpha,
+*                                 descr_A,
+*                                 nnz_A,
+*                                 csr_row_ptr_A,
+*                                 csr_col_ind_A,
+*                                 descr_A,
+*                                 nnz_A,
+*                                 csr_row_ptr_A,
+*                                 csr_col_ind_A,
+*                                 NULL,
+*                                 NULL,
+*                                 0,
+*                                 NULL,
+*                                 NULL,
+*                                 info_C,
+*                                 &buffer_size);
+*
+*  hipMalloc(&buffer, buffer_size);
+*  hipMalloc((void**)&csr_row_ptr_C, sizeof(rocsparse_int) * (m + 1));
+*
+*  // Use the pattern of A as mask
+*  rocsparse_csrgemm_masked_nnz(handle,
+*                               rocsparse_operation_none,
+*                               rocsparse_operation_none,
+*                               m,
+*                               m,
+*                               m,
+*                               descr_A,
+*                               nnz_A,
+*                               csr_row_ptr_A,
+*                               csr_col_ind_A,
+*                               descr_A,
+*                               nnz_A,
+*                               csr_row_ptr_A,
+*                               csr_col_ind_A,
+*                               descr_A,
+*                               nnz_A,
+*                               csr_row_ptr_A,
+*                               csr_col_ind_A,
+*                               rocsparse_mask_type_structural,
+*                               descr_C,
+*                               csr_row_ptr_C,
+*                               &nnz_C,
+*                               info_C,
+*                               buffer);
+*
+*  hipMalloc((void**)&csr_col_ind_C, sizeof(rocsparse_int) * nnz_C);
+*  hipMalloc((void**)&csr_val_C, sizeof(float) * nnz_C);
+*
+*  rocsparse_scsrgemm_masked(handle,
+*                            rocsparse_operation_none,
+*                            rocsparse_operation_none,
+*                            m,
+*                            m,
+*                            m,
+*                            &alpha,
+*                            descr_A,
+*                            nnz_A,
+*                            csr_val_A,
+*                            csr_row_ptr_A,
+*                            csr_col_ind_A,
+*                            descr_A,
+*                            nnz_A,
+*                            csr_val_A,
+*                            csr_row_ptr_A,
+*                            csr_col_ind_A,
+*                            descr_A,
+*                            nnz_A,
+*                            csr_row_ptr_A,
+*                            csr_col_ind_A,
+*                            rocsparse_mask_type_structural,
+*                            descr_C,
+*                            csr_val_C,
+*                            csr_row_ptr_C,
+*                            csr_col_ind_C,
+*                            info_C,
+*                            buffer);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrgemm_masked(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const float*              alpha,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const float*              csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_B,
+                                           rocsparse_int             nnz_B,
+                                           const float*              csr_val_B,
+                                           const rocsparse_int*      csr_row_ptr_B,
+                                           const rocsparse_int*      csr_col_ind_B,
+                                           const rocsparse_mat_descr descr_M,
+                                           rocsparse_int             nnz_M,
+                                           const rocsparse_int*      csr_row_ptr_M,
+                                           const rocsparse_int*      csr_col_ind_M,
+                                           rocsparse_mask_type       mask_type,
+                                           const rocsparse_mat_descr descr_C,
+                                           float*                    csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           rocsparse_int*            csr_col_ind_C,
+                                           const rocsparse_mat_info  info_C,
+                                           void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrgemm_masked(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_A,
+                                           rocsparse_operation       trans_B,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const double*             alpha,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const double*             csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_B,
+                                           rocsparse_int             nnz_B,
+                                           const double*             csr_val_B,
+                                           const rocsparse_int*      csr_row_ptr_B,
+                                           const rocsparse_int*      csr_col_ind_B,
+                                           const rocsparse_mat_descr descr_M,
+                                           rocsparse_int             nnz_M,
+                                           const rocsparse_int*      csr_row_ptr_M,
+                                           const rocsparse_int*      csr_col_ind_M,
+                                           rocsparse_mask_type       mask_type,
+                                           const rocsparse_mat_descr descr_C,
+                                           double*                   csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           rocsparse_int*            csr_col_ind_C,
+                                           const rocsparse_mat_info  info_C,
+                                           void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrgemm_masked(rocsparse_handle               handle,
+                                           rocsparse_operation            trans_A,
+                                           rocsparse_operation            trans_B,
+                                           rocsparse_int                  m,
+                                           rocsparse_int                  n,
+                                           rocsparse_int                  k,
+                                           const rocsparse_float_complex* alpha,
+                                           const rocsparse_mat_descr      descr_A,
+                                           rocsparse_int                  nnz_A,
+                                           const rocsparse_float_complex* csr_val_A,
+                                           const rocsparse_int*           csr_row_ptr_A,
+                                           const rocsparse_int*           csr_col_ind_A,
+                                           const rocsparse_mat_descr      descr_B,
+                                           rocsparse_int                  nnz_B,
+                                           const rocsparse_float_complex* csr_val_B,
+                                           const rocsparse_int*           csr_row_ptr_B,
+                                           const rocsparse_int*           csr_col_ind_B,
+                                           const rocsparse_mat_descr      descr_M,
+                                           rocsparse_int                  nnz_M,
+                                           const rocsparse_int*           csr_row_ptr_M,
+                                           const rocsparse_int*           csr_col_ind_M,
+                                           rocsparse_mask_type            mask_type,
+                                           const rocsparse_mat_descr      descr_C,
+                                           rocsparse_float_complex*       csr_val_C,
+                                           const rocsparse_int*           csr_row_ptr_C,
+                                           rocsparse_int*                 csr_col_ind_C,
+                                           const rocsparse_mat_info       info_C,
+                                           void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrgemm_masked(rocsparse_handle                handle,
+                                           rocsparse_operation             trans_A,
+                                           rocsparse_operation             trans_B,
+                                           rocsparse_int                   m,
+                                           rocsparse_int                   n,
+                                           rocsparse_int                   k,
+                                           const rocsparse_double_complex* alpha,
+                                           const rocsparse_mat_descr       descr_A,
+                                           rocsparse_int                   nnz_A,
+                                           const rocsparse_double_complex* csr_val_A,
+                                           const rocsparse_int*            csr_row_ptr_A,
+                                           const rocsparse_int*            csr_col_ind_A,
+                                           const rocsparse_mat_descr       descr_B,
+                                           rocsparse_int                   nnz_B,
+                                           const rocsparse_double_complex* csr_val_B,
+                                           const rocsparse_int*            csr_row_ptr_B,
+                                           const rocsparse_int*            csr_col_ind_B,
+                                           const rocsparse_mat_descr       descr_M,
+                                           rocsparse_int                   nnz_M,
+                                           const rocsparse_int*            csr_row_ptr_M,
+                                           const rocsparse_int*            csr_col_ind_M,
+                                           rocsparse_mask_type             mask_type,
+                                           const rocsparse_mat_descr       descr_C,
+                                           rocsparse_double_complex*       csr_val_C,
+                                           const rocsparse_int*            csr_row_ptr_C,
+                                           rocsparse_int*                  csr_col_ind_C,
+                                           const rocsparse_mat_info        info_C,
+                                           void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup extra_module
+*  \brief Sparse Galerkin triple product using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrrap_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_csrrap_nnz(), rocsparse_scsrrap(),
+*  rocsparse_dcsrrap(), rocsparse_ccsrrap() and rocsparse_zcsrrap(). The temporary
+*  storage buffer must be allocated by the user. Besides the work space of both sparse
+*  matrix products, it holds the intermediate product \f$A \cdot P\f$ and, if
+*  required, the transposed matrix \f$R^T\f$. Their size is bounded by the number of
+*  intermediate products of \f$A \cdot P\f$.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*  \note
+*  Currently, only \p trans_R == \ref rocsparse_operation_none and
+*  \p trans_R == \ref rocsparse_operation_transpose are supported.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_R         matrix \f$R\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(R)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$P\f$ and \f$C\f$.
+*  @param[in]
+*  k               number of rows and columns of the sparse CSR matrix \f$A\f$, number
+*                  of columns of \f$op(R)\f$ and number of rows of \f$P\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_R         descriptor of the sparse CSR matrix \f$R\f$. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_R           number of non-zero entries of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_row_ptr_R   array of \p m+1 elements (\f$op(R) == R\f$, \p k+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$R\f$.
+*  @param[in]
+*  csr_col_ind_R   array of \p nnz_R elements containing the column indices of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_P         descriptor of the sparse CSR matrix \f$P\f$. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_P           number of non-zero entries of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_row_ptr_P   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_col_ind_P   array of \p nnz_P elements containing the column indices of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[inout]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csrrap_nnz(), rocsparse_scsrrap(), rocsparse_dcsrrap(),
+*                  rocsparse_ccsrrap() and rocsparse_zcsrrap().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_R, \p nnz_A or
+*          \p nnz_P is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_R, \p csr_row_ptr_R,
+*          \p csr_col_ind_R, \p descr_A, \p csr_row_ptr_A, \p csr_col_ind_A,
+*          \p descr_P, \p csr_row_ptr_P, \p csr_col_ind_P, \p info_C or
+*          \p buffer_size pointer is invalid.
+*  \retval rocsparse_status_invalid_value \p trans_R or an index base is invalid.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_R == \ref rocsparse_operation_conjugate_transpose or
+*          \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrrap_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_operation       trans_R,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             k,
+                                               const float*              alpha,
+                                               const rocsparse_mat_descr descr_R,
+                                               rocsparse_int             nnz_R,
+                                               const rocsparse_int*      csr_row_ptr_R,
+                                               const rocsparse_int*      csr_col_ind_R,
+                                               const rocsparse_mat_descr descr_A,
+                                               rocsparse_int             nnz_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const rocsparse_mat_descr descr_P,
+                                               rocsparse_int             nnz_P,
+                                               const rocsparse_int*      csr_row_ptr_P,
+                                               const rocsparse_int*      csr_col_ind_P,
+                                               rocsparse_mat_info        info_C,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrrap_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_operation       trans_R,
+                                               rocsparse_int             m,
+                                               rocsparse_int             n,
+                                               rocsparse_int             k,
+                                               const double*             alpha,
+                                               const rocsparse_mat_descr descr_R,
+                                               rocsparse_int             nnz_R,
+                                               const rocsparse_int*      csr_row_ptr_R,
+                                               const rocsparse_int*      csr_col_ind_R,
+                                               const rocsparse_mat_descr descr_A,
+                                               rocsparse_int             nnz_A,
+                                               const rocsparse_int*      csr_row_ptr_A,
+                                               const rocsparse_int*      csr_col_ind_A,
+                                               const rocsparse_mat_descr descr_P,
+                                               rocsparse_int             nnz_P,
+                                               const rocsparse_int*      csr_row_ptr_P,
+                                               const rocsparse_int*      csr_col_ind_P,
+                                               rocsparse_mat_info        info_C,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrrap_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_operation            trans_R,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  n,
+                                               rocsparse_int                  k,
+                                               const rocsparse_float_complex* alpha,
+                                               const rocsparse_mat_descr      descr_R,
+                                               rocsparse_int                  nnz_R,
+                                               const rocsparse_int*           csr_row_ptr_R,
+                                               const rocsparse_int*           csr_col_ind_R,
+                                               const rocsparse_mat_descr      descr_A,
+                                               rocsparse_int                  nnz_A,
+                                               const rocsparse_int*           csr_row_ptr_A,
+                                               const rocsparse_int*           csr_col_ind_A,
+                                               const rocsparse_mat_descr      descr_P,
+                                               rocsparse_int                  nnz_P,
+                                               const rocsparse_int*           csr_row_ptr_P,
+                                               const rocsparse_int*           csr_col_ind_P,
+                                               rocsparse_mat_info             info_C,
+                                               size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrrap_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_operation             trans_R,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   n,
+                                               rocsparse_int                   k,
+                                               const rocsparse_double_complex* alpha,
+                                               const rocsparse_mat_descr       descr_R,
+                                               rocsparse_int                   nnz_R,
+                                               const rocsparse_int*            csr_row_ptr_R,
+                                               const rocsparse_int*            csr_col_ind_R,
+                                               const rocsparse_mat_descr       descr_A,
+                                               rocsparse_int                   nnz_A,
+                                               const rocsparse_int*            csr_row_ptr_A,
+                                               const rocsparse_int*            csr_col_ind_A,
+                                               const rocsparse_mat_descr       descr_P,
+                                               rocsparse_int                   nnz_P,
+                                               const rocsparse_int*            csr_row_ptr_P,
+                                               const rocsparse_int*            csr_col_ind_P,
+                                               rocsparse_mat_info              info_C,
+                                               size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup extra_module
+*  \brief Sparse Galerkin triple product using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrrap_nnz computes the total CSR non-zero elements and the CSR row
+*  offsets, that point to the start of every row of the sparse CSR matrix, of the
+*  resulting matrix \f$C = op(R) \cdot A \cdot P\f$. It is assumed that
+*  \p csr_row_ptr_C has been allocated with size \p m + 1.
+*  The required buffer size can be obtained by rocsparse_scsrrap_buffer_size(),
+*  rocsparse_dcsrrap_buffer_size(), rocsparse_ccsrrap_buffer_size() and
+*  rocsparse_zcsrrap_buffer_size(), respectively.
+*
+*  The sparsity pattern of the intermediate product \f$A \cdot P\f$ and, if
+*  \p trans_R == \ref rocsparse_operation_transpose, the transposed sparsity pattern of
+*  \f$R\f$ are stored in \p temp_buffer. \f$R^T\f$ is never formed explicitly. Its
+*  values are gathered from \f$R\f$ by rocsparse_scsrrap(), rocsparse_dcsrrap(),
+*  rocsparse_ccsrrap() and rocsparse_zcsrrap() through a stored permutation. Thus,
+*  the symbolic phase needs to be performed only once, as long as the sparsity
+*  patterns of \f$R\f$, \f$A\f$ and \f$P\f$ do not change, and the content of
+*  \p temp_buffer is preserved in between.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_R         matrix \f$R\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(R)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$P\f$ and \f$C\f$.
+*  @param[in]
+*  k               number of rows and columns of the sparse CSR matrix \f$A\f$, number
+*                  of columns of \f$op(R)\f$ and number of rows of \f$P\f$.
+*  @param[in]
+*  descr_R         descriptor of the sparse CSR matrix \f$R\f$. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_R           number of non-zero entries of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_row_ptr_R   array of \p m+1 elements (\f$op(R) == R\f$, \p k+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$R\f$.
+*  @param[in]
+*  csr_col_ind_R   array of \p nnz_R elements containing the column indices of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_P         descriptor of the sparse CSR matrix \f$P\f$. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_P           number of non-zero entries of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_row_ptr_P   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_col_ind_P   array of \p nnz_P elements containing the column indices of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  nnz_C           pointer to the number of non-zero entries of the sparse CSR
+*                  matrix \f$C\f$.
+*  @param[inout]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_scsrrap_buffer_size(),
+*                  rocsparse_dcsrrap_buffer_size(), rocsparse_ccsrrap_buffer_size() or
+*                  rocsparse_zcsrrap_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_R, \p nnz_A or
+*          \p nnz_P is invalid.
+*  \retval rocsparse_status_invalid_pointer \p descr_R, \p csr_row_ptr_R,
+*          \p csr_col_ind_R, \p descr_A, \p csr_row_ptr_A, \p csr_col_ind_A,
+*          \p descr_P, \p csr_row_ptr_P, \p csr_col_ind_P, \p descr_C,
+*          \p csr_row_ptr_C, \p nnz_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_invalid_value \p trans_R or an index base is invalid, or
+*          \p trans_R does not match the operation passed to the buffer size query.
+*  \retval rocsparse_status_memory_error additional buffer for the meta data could not
+*          be allocated.
+*  \retval rocsparse_status_not_implemented
+*          \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrrap_nnz(rocsparse_handle          handle,
+                                      rocsparse_operation       trans_R,
+                                      rocsparse_int             m,
+                                      rocsparse_int             n,
+                                      rocsparse_int             k,
+                                      const rocsparse_mat_descr descr_R,
+                                      rocsparse_int             nnz_R,
+                                      const rocsparse_int*      csr_row_ptr_R,
+                                      const rocsparse_int*      csr_col_ind_R,
+                                      const rocsparse_mat_descr descr_A,
+                                      rocsparse_int             nnz_A,
+                                      const rocsparse_int*      csr_row_ptr_A,
+                                      const rocsparse_int*      csr_col_ind_A,
+                                      const rocsparse_mat_descr descr_P,
+                                      rocsparse_int             nnz_P,
+                                      const rocsparse_int*      csr_row_ptr_P,
+                                      const rocsparse_int*      csr_col_ind_P,
+                                      const rocsparse_mat_descr descr_C,
+                                      rocsparse_int*            csr_row_ptr_C,
+                                      rocsparse_int*            nnz_C,
+                                      const rocsparse_mat_info  info_C,
+                                      void*                     temp_buffer);
+
+/*! \ingroup extra_module
+*  \brief Sparse Galerkin triple product using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrrap computes the Galerkin triple product of the sparse
+*  \f$k \times k\f$ matrix \f$A\f$ with the sparse restriction and prolongation
+*  matrices \f$R\f$ and \f$P\f$, all defined in CSR storage format, such that
+*  \f[
+*    C := \alpha \cdot op(R) \cdot A \cdot P,
+*  \f]
+*  with
+*  \f[
+*    op(R) = \left\{
+*    \begin{array}{ll}
+*        R,   & \text{if trans_R == rocsparse_operation_none} \\
+*        R^T, & \text{if trans_R == rocsparse_operation_transpose}
+*    \end{array}
+*    \right.
+*  \f]
+*  where \f$op(R)\f$ is a \f$m \times k\f$ matrix and \f$P\f$ is a \f$k \times n\f$
+*  matrix. This is the coarse grid operator of an algebraic multigrid hierarchy, e.g.
+*  \f$P^T \cdot A \cdot P\f$ with \f$R = P\f$ and \p trans_R ==
+*  \ref rocsparse_operation_transpose.
+*
+*  It is assumed that \p csr_row_ptr_C has already been filled by
+*  rocsparse_csrrap_nnz() and that \p csr_val_C and \p csr_col_ind_C are allocated by
+*  the user. Only the numerical phase is performed, using the meta data that has been
+*  stored in \p info_C and \p temp_buffer by rocsparse_csrrap_nnz(). Thus, it can be
+*  called repeatedly with the same \p temp_buffer, if only the values of \f$R\f$,
+*  \f$A\f$ or \f$P\f$ change.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*  \note
+*  The first call for a given data type allocates device memory for the values of the
+*  intermediate product \f$A \cdot P\f$ and \f$R^T\f$, which is kept in \p info_C.
+*  \note
+*  Currently, only \ref rocsparse_matrix_type_general is supported.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_R         matrix \f$R\f$ operation type.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix \f$op(R)\f$ and \f$C\f$.
+*  @param[in]
+*  n               number of columns of the sparse CSR matrix \f$P\f$ and \f$C\f$.
+*  @param[in]
+*  k               number of rows and columns of the sparse CSR matrix \f$A\f$, number
+*                  of columns of \f$op(R)\f$ and number of rows of \f$P\f$.
+*  @param[in]
+*  alpha           scalar \f$\alpha\f$.
+*  @param[in]
+*  descr_R         descriptor of the sparse CSR matrix \f$R\f$. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_R           number of non-zero entries of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_val_R       array of \p nnz_R elements of the sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  csr_row_ptr_R   array of \p m+1 elements (\f$op(R) == R\f$, \p k+1 otherwise)
+*                  that point to the start of every row of the sparse CSR matrix
+*                  \f$R\f$.
+*  @param[in]
+*  csr_col_ind_R   array of \p nnz_R elements containing the column indices of the
+*                  sparse CSR matrix \f$R\f$.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix \f$A\f$. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_row_ptr_A   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix \f$A\f$.
+*  @param[in]
+*  descr_P         descriptor of the sparse CSR matrix \f$P\f$. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  nnz_P           number of non-zero entries of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_val_P       array of \p nnz_P elements of the sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_row_ptr_P   array of \p k+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  csr_col_ind_P   array of \p nnz_P elements containing the column indices of the
+*                  sparse CSR matrix \f$P\f$.
+*  @param[in]
+*  descr_C         descriptor of the sparse CSR matrix \f$C\f$. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[out]
+*  csr_val_C       array of \p nnz_C elements of the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  csr_row_ptr_C   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[out]
+*  csr_col_ind_C   array of \p nnz_C elements containing the column indices of the
+*                  sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  info_C          structure that holds meta data for the sparse CSR matrix \f$C\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned
+*                  by rocsparse_scsrrap_buffer_size(),
+*                  rocsparse_dcsrrap_buffer_size(), rocsparse_ccsrrap_buffer_size() or
+*                  rocsparse_zcsrrap_buffer_size().
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_size \p m, \p n, \p k, \p nnz_R, \p nnz_A or
+*          \p nnz_P is invalid.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p descr_R, \p csr_val_R,
+*          \p csr_row_ptr_R, \p csr_col_ind_R, \p descr_A, \p csr_val_A,
+*          \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_P, \p csr_val_P,
+*          \p csr_row_ptr_P, \p csr_col_ind_P, \p descr_C, \p csr_val_C,
+*          \p csr_row_ptr_C, \p csr_col_ind_C, \p info_C or \p temp_buffer is invalid.
+*  \retval rocsparse_status_invalid_value \p trans_R or an index base is invalid, or
+*          \p trans_R does not match the operation passed to the buffer size query.
+*  \retval rocsparse_status_memory_error additional buffer for the intermediate values
+*          could not be allocated.
+*  \retval rocsparse_status_not_implemented
+*          \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrrap(rocsparse_handle          handle,
+                                   rocsparse_operation       trans_R,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             k,
+                                   const float*              alpha,
+                                   const rocsparse_mat_descr descr_R,
+                                   rocsparse_int             nnz_R,
+                                   const float*              csr_val_R,
+                                   const rocsparse_int*      csr_row_ptr_R,
+                                   const rocsparse_int*      csr_col_ind_R,
+                                   const rocsparse_mat_descr descr_A,
+                                   rocsparse_int             nnz_A,
+                                   const float*              csr_val_A,
+                                   const rocsparse_int*      csr_row_ptr_A,
+                                   const rocsparse_int*      csr_col_ind_A,
+                                   const rocsparse_mat_descr descr_P,
+                                   rocsparse_int             nnz_P,
+                                   const float*              csr_val_P,
+                                   const rocsparse_int*      csr_row_ptr_P,
+                                   const rocsparse_int*      csr_col_ind_P,
+                                   const rocsparse_mat_descr descr_C,
+                                   float*                    csr_val_C,
+                                   const rocsparse_int*      csr_row_ptr_C,
+                                   rocsparse_int*            csr_col_ind_C,
+                                   const rocsparse_mat_info  info_C,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrrap(rocsparse_handle          handle,
+                                   rocsparse_operation       trans_R,
+                                   rocsparse_int             m,
+                                   rocsparse_int             n,
+                                   rocsparse_int             k,
+                                   const double*             alpha,
+                                   const rocsparse_mat_descr descr_R,
+                                   rocsparse_int             nnz_R,
+                                   const double*             csr_val_R,
+                                   const rocsparse_int*      csr_row_ptr_R,
+                                   const rocsparse_int*      csr_col_ind_R,
+                                   const rocsparse_mat_descr descr_A,
+                                   rocsparse_int             nnz_A,
+                                   const double*             csr_val_A,
+                                   const rocsparse_int*      csr_row_ptr_A,
+                                   const rocsparse_int*      csr_col_ind_A,
+                                   const rocsparse_mat_descr descr_P,
+                                   rocsparse_int             nnz_P,
+                                   const double*             csr_val_P,
+                                   const rocsparse_int*      csr_row_ptr_P,
+                                   const rocsparse_int*      csr_col_ind_P,
+                                   const rocsparse_mat_descr descr_C,
+                                   double*                   csr_val_C,
+                                   const rocsparse_int*      csr_row_ptr_C,
+                                   rocsparse_int*            csr_col_ind_C,
+                                   const rocsparse_mat_info  info_C,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrrap(rocsparse_handle               handle,
+                                   rocsparse_operation            trans_R,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  n,
+                                   rocsparse_int                  k,
+                                   const rocsparse_float_complex* alpha,
+                                   const rocsparse_mat_descr      descr_R,
+                                   rocsparse_int                  nnz_R,
+                                   const rocsparse_float_complex* csr_val_R,
+                                   const rocsparse_int*           csr_row_ptr_R,
+                                   const rocsparse_int*           csr_col_ind_R,
+                                   const rocsparse_mat_descr      descr_A,
+                                   rocsparse_int                  nnz_A,
+                                   const rocsparse_float_complex* csr_val_A,
+                                   const rocsparse_int*           csr_row_ptr_A,
+                                   const rocsparse_int*           csr_col_ind_A,
+                                   const rocsparse_mat_descr      descr_P,
+                                   rocsparse_int                  nnz_P,
+                                   const rocsparse_float_complex* csr_val_P,
+                                   const rocsparse_int*           csr_row_ptr_P,
+                                   const rocsparse_int*           csr_col_ind_P,
+                                   const rocsparse_mat_descr      descr_C,
+                                   rocsparse_float_complex*       csr_val_C,
+                                   const rocsparse_int*           csr_row_ptr_C,
+                                   rocsparse_int*                 csr_col_ind_C,
+                                   const rocsparse_mat_info       info_C,
+                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrrap(rocsparse_handle                handle,
+                                   rocsparse_operation             trans_R,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   n,
+                                   rocsparse_int                   k,
+                                   const rocsparse_double_complex* alpha,
+                                   const rocsparse_mat_descr       descr_R,
+                                   rocsparse_int                   nnz_R,
+                                   const rocsparse_double_complex* csr_val_R,
+                                   const rocsparse_int*            csr_row_ptr_R,
+                                   const rocsparse_int*            csr_col_ind_R,
+                                   const rocsparse_mat_descr       descr_A,
+                                   rocsparse_int                   nnz_A,
+                                   const rocsparse_double_complex* csr_val_A,
+                                   const rocsparse_int*            csr_row_ptr_A,
+                                   const rocsparse_int*            csr_col_ind_A,
+                                   const rocsparse_mat_descr       descr_P,
+                                   rocsparse_int                   nnz_P,
+                                   const rocsparse_double_complex* csr_val_P,
+                                   const rocsparse_int*            csr_row_ptr_P,
+                                   const rocsparse_int*            csr_col_ind_P,
+                                   const rocsparse_mat_descr       descr_C,
+                                   rocsparse_double_complex*       csr_val_C,
+                                   const rocsparse_int*            csr_row_ptr_C,
+                                   rocsparse_int*                  csr_col_ind_C,
+                                   const rocsparse_mat_info        info_C,
+                                   void*                           temp_buffer);
+/**@}*/
+
+/*
+* ===========================================================================
+*    preconditioner SPARSE
+* ===========================================================================
+*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_sbsric0(),
+ *  rocsparse_dbsric0(), rocsparse_cbsric0() or rocsparse_zbsric0() computation.
+ *  The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same
+ *  index base as the BSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note
+ *  If a zero pivot is found, \p position=j means that either the diagonal block \p A(j,j)
+ *  is missing (structural zero) or the diagonal block \p A(j,j) is not positive definite
+ *  (numerical zero).
+ *
+ *  \note \p rocsparse_bsric0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsric0_zero_pivot(rocsparse_handle   handle,
+                                             rocsparse_mat_info info,
+                                             rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
+ *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(), rocsparse_sbsric0(),
+ *  rocsparse_dbsric0(), rocsparse_sbsric0() and rocsparse_dbsric0(). The temporary
+ *  storage buffer must be allocated by the user. The size of the temporary storage
+ *  buffer is identical to the size returned by rocsparse_sbsrsv_buffer_size(),
+ *  rocsparse_dbsrsv_buffer_size(), rocsparse_cbsrsv_buffer_size(), rocsparse_zbsrsv_buffer_size(),
+ *  rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(), rocsparse_cbsrilu0_buffer_size()
+ *  and rocsparse_zbsrilu0_buffer_size() if the matrix sparsity pattern is identical. The user
+ *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir 	    direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *              \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
+ *              rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
+ *              rocsparse_sbsric0(), rocsparse_dbsric0(), rocsparse_cbsric0()
+ *              and rocsparse_zbsric0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+ *              \p bsr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nnzb,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              bsr_val,
+                                               const rocsparse_int*      bsr_row_ptr,
+                                               const rocsparse_int*      bsr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_direction       dir,
+                                               rocsparse_int             mb,
+                                               rocsparse_int             nnzb,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             bsr_val,
+                                               const rocsparse_int*      bsr_row_ptr,
+                                               const rocsparse_int*      bsr_col_ind,
+                                               rocsparse_int             block_dim,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsric0_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_direction            dir,
+                                               rocsparse_int                  mb,
+                                               rocsparse_int                  nnzb,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* bsr_val,
+                                               const rocsparse_int*           bsr_row_ptr,
+                                               const rocsparse_int*           bsr_col_ind,
+                                               rocsparse_int                  block_dim,
+                                               rocsparse_mat_info             info,
+                                               size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsric0_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_direction             dir,
+                                               rocsparse_int                   mb,
+                                               rocsparse_int                   nnzb,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* bsr_val,
+                                               const rocsparse_int*            bsr_row_ptr,
+                                               const rocsparse_int*            bsr_col_ind,
+                                               rocsparse_int                   block_dim,
+                                               rocsparse_mat_info              info,
+                                               size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0_analysis performs the analysis step for rocsparse_sbsric0()
+ *  rocsparse_dbsric0(), rocsparse_cbsric0(), and rocsparse_zbsric0(). It is expected
+ *  that this function will be executed only once for a given matrix and particular
+ *  operation type. The analysis meta data can be cleared by rocsparse_bsric0_clear().
+ *
+ *  \p rocsparse_bsric0_analysis can share its meta data with
+ *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
+ *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
+ *  rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
+ *  rocsparse_cbsrsv_analysis(), rocsparse_zbsrsv_analysis(),
+ *  rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
+ *  rocsparse_cbsrsm_analysis() and rocsparse_zbsrsm_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. However, the user need to make sure that the sparsity
+ *  pattern remains unchanged. If this cannot be assured,
+ *  \ref rocsparse_analysis_policy_force has to be used.
+ *  If only the values of the matrix have changed since the previous analysis,
+ *  \ref rocsparse_analysis_policy_numeric re-uses the meta data after verifying a
+ *  fingerprint of the sparsity pattern on the device, and re-builds it otherwise.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir 	    direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *              \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse,
+ *              \ref rocsparse_analysis_policy_force or
+ *              \ref rocsparse_analysis_policy_numeric.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+ *              \p bsr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsric0_analysis(rocsparse_handle               handle,
+                                            rocsparse_direction            dir,
+                                            rocsparse_int                  mb,
+                                            rocsparse_int                  nnzb,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* bsr_val,
+                                            const rocsparse_int*           bsr_row_ptr,
+                                            const rocsparse_int*           bsr_col_ind,
+                                            rocsparse_int                  block_dim,
+                                            rocsparse_mat_info             info,
+                                            rocsparse_analysis_policy      analysis,
+                                            rocsparse_solve_policy         solve,
+                                            void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsric0_analysis(rocsparse_handle                handle,
+                                            rocsparse_direction             dir,
+                                            rocsparse_int                   mb,
+                                            rocsparse_int                   nnzb,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* bsr_val,
+                                            const rocsparse_int*            bsr_row_ptr,
+                                            const rocsparse_int*            bsr_col_ind,
+                                            rocsparse_int                   block_dim,
+                                            rocsparse_mat_info              info,
+                                            rocsparse_analysis_policy       analysis,
+                                            rocsparse_solve_policy          solve,
+                                            void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0_clear deallocates all memory that was allocated by
+ *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis()
+ *  or rocsparse_zbsric0_analysis(). This is especially useful, if memory is an issue and
+ *  the analysis data is not required for further computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_bsric0_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using BSR
+ *  storage format
+ *
+ *  \details
+ *  \p rocsparse_bsric0 computes the incomplete Cholesky factorization with 0 fill-ins
+ *  and no pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
+ *  \f[
+ *    A \approx LL^T
+ *  \f]
+ *
+ *  \p rocsparse_bsric0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(),
+ *  rocsparse_cbsric0_buffer_size() or rocsparse_zbsric0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_sbsric0_analysis(),
+ *  rocsparse_dbsric0_analysis(), rocsparse_cbsric0_analysis() or rocsparse_zbsric0_analysis().
+ *  \p rocsparse_bsric0 reports the first zero pivot (either numerical or structural zero).
+ *  The zero pivot status can be obtained by calling rocsparse_bsric0_zero_pivot().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir 	    direction that specified whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *              \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[inout]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr
+ *              or \p bsr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in BSR
+ *  storage format. The following example computes the incomplete Cholesky factorization
+ *  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
+ *  \code{.c}
+ *      // Create rocSPARSE handle
+ *      rocsparse_handle handle;
+ *      rocsparse_create_handle(&handle);
+ *
+ *      // Create matrix descriptor for M
+ *      rocsparse_mat_descr descr_M;
+ *      rocsparse_create_mat_descr(&descr_M);
+ *
+ *      // Create matrix descriptor for L
+ *      rocsparse_mat_descr descr_L;
+ *      rocsparse_create_mat_descr(&descr_L);
+ *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+ *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+ *
+ *      // Create matrix descriptor for L'
+ *      rocsparse_mat_descr descr_Lt;
+ *      rocsparse_create_mat_descr(&descr_Lt);
+ *      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
+ *      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
+ *
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Obtain required buffer size
+ *      size_t buffer_size_M;
+ *      size_t buffer_size_L;
+ *      size_t buffer_size_Lt;
+ *      rocsparse_dbsric0_buffer_size(handle,
+ *                                     rocsparse_direction_row,
+ *                                     mb,
+ *                                     nnzb,
+ *                                     descr_M,
+ *                                     bsr_val,
+ *                                     bsr_row_ptr,
+ *                                     bsr_col_ind,
+ *                                     block_dim,
+ *                                     info,
+ *                                     &buffer_size_M);
+ *      rocsparse_dbsrsv_buffer_size(handle,
+ *                                   rocsparse_direction_row,
+ *                                   rocsparse_operation_none,
+ *                                   mb,
+ *                                   nnzb,
+ *                                   descr_L,
+ *                                   bsr_val,
+ *                                   bsr_row_ptr,
+ *                                   bsr_col_ind,
+ *                                   block_dim,
+ *                                   info,
+ *                                   &buffer_size_L);
+ *      rocsparse_dbsrsv_buffer_size(handle,
+ *                                   rocsparse_direction_row,
+ *                                   rocsparse_operation_transpose,
+ *                                   mb,
+ *                                   nnzb,
+ *                                   descr_Lt,
+ *                                   bsr_val,
+ *                                   bsr_row_ptr,
+ *                                   bsr_col_ind,
+ *                                   block_dim,
+ *                                   info,
+ *                                   &buffer_size_Lt);
+ *
+ *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+ *      // computation performance
+ *      rocsparse_dbsric0_analysis(handle,
+ *                                  rocsparse_direction_row,
+ *                                  mb,
+ *                                  nnzb,
+ *                                  descr_M,
+ *                                  bsr_val,
+ *                                  bsr_row_ptr,
+ *                                  bsr_col_ind,
+ *                                  block_dim,
+ *                                  info,
+ *                                  rocsparse_analysis_policy_reuse,
+ *                                  rocsparse_solve_policy_auto,
+ *                                  temp_buffer);
+ *      rocsparse_dbsrsv_analysis(handle,
+ *                                rocsparse_direction_row,
+ *                                rocsparse_operation_none,
+ *                                mb,
+ *                                nnzb,
+ *                                descr_L,
+ *                                bsr_val,
+ *                                bsr_row_ptr,
+ *                                bsr_col_ind,
+ *                                block_dim,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *      rocsparse_dbsrsv_analysis(handle,
+ *                                rocsparse_direction_row,
+ *                                rocsparse_operation_transpose,
+ *                                mb,
+ *                                nnzb,
+ *                                descr_Lt,
+ *                                bsr_val,
+ *                                bsr_row_ptr,
+ *                                bsr_col_ind,
+ *                                block_dim,
+ *                                info,
+ *                                rocsparse_analysis_policy_reuse,
+ *                                rocsparse_solve_policy_auto,
+ *                                temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      rocsparse_int position;
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
+ *                                                                    info,
+ *                                                                    &position))
+ *      {
+ *          printf("A has structural zero at A(%d,%d)\n", position, position);
+ *      }
+ *
+ *      // Compute incomplete Cholesky factorization M = LL'
+ *      rocsparse_dbsric0(handle,
+ *                         rocsparse_direction_row,
+ *                         mb,
+ *                         nnzb,
+ *                         descr_M,
+ *                         bsr_val,
+ *                         bsr_row_ptr,
+ *                         bsr_col_ind,
+ *                         block_dim,
+ *                         info,
+ *                         rocsparse_solve_policy_auto,
+ *                         temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsric0_zero_pivot(handle,
+ *                                                                     info,
+ *                                                                     &position))
+ *      {
+ *          printf("L has structural and/or numerical zero at L(%d,%d)\n",
+ *                 position,
+ *                 position);
+ *      }
+ *
+ *      // Solve Lz = x
+ *      rocsparse_dbsrsv_solve(handle,
+ *                             rocsparse_direction_row,
+ *                             rocsparse_operation_none,
+ *                             mb,
+ *                             nnzb,
+ *                             &alpha,
+ *                             descr_L,
+ *                             bsr_val,
+ *                             bsr_row_ptr,
+ *                             bsr_col_ind,
+ *                             block_dim,
+ *                             info,
+ *                             x,
+ *                             z,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Solve L'y = z
+ *      rocsparse_dbsrsv_solve(handle,
+ *                             rocsparse_direction_row,
+ *                             rocsparse_operation_transpose,
+ *                             mb,
+ *                             nnzb,
+ *                             &alpha,
+ *                             descr_Lt,
+ *                             bsr_val,
+ *                             bsr_row_ptr,
+ *                             bsr_col_ind,
+ *                             block_dim,
+ *                             info,
+ *                             z,
+ *                             y,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      rocsparse_destroy_mat_info(info);
+ *      rocsparse_destroy_mat_descr(descr_M);
+ *      rocsparse_destroy_mat_descr(descr_L);
+ *      rocsparse_destroy_mat_descr(descr_Lt);
+ *      rocsparse_destroy_handle(handle);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex*  bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsric0(rocsparse_handle          handle,
+                                   rocsparse_direction       dir,
+                                   rocsparse_int             mb,
+                                   rocsparse_int             nnzb,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* bsr_val,
+                                   const rocsparse_int*      bsr_row_ptr,
+                                   const rocsparse_int*      bsr_col_ind,
+                                   rocsparse_int             block_dim,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_sbsrilu0(),
+ *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0() or rocsparse_zbsrilu0() computation.
+ *  The first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same
+ *  index base as the BSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note
+ *  If a zero pivot is found, \p position \f$=j\f$ means that either the diagonal block
+ *  \f$A_{j,j}\f$ is missing (structural zero) or the diagonal block \f$A_{j,j}\f$ is not
+ *  invertible (numerical zero).
+ *
+ *  \note \p rocsparse_bsrilu0_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsrilu0_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0_numeric_boost enables the user to replace a numerical value in
+ *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
+ *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
+ *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
+ *
+ *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
+ *  setting \p enable_boost to 0.
+ *
+ *  \note \p tol and \p boost_val can be in host or device memory.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info            structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  enable_boost    enable/disable numeric boost.
+ *  @param[in]
+ *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
+ *  @param[in]
+ *  boost_val       boost value to replace a numerical value.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
+ *              is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const float*       boost_tol,
+                                                  const float*       boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const double*      boost_tol,
+                                                  const double*      boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrilu0_numeric_boost(rocsparse_handle               handle,
+                                                  rocsparse_mat_info             info,
+                                                  int                            enable_boost,
+                                                  const float*                   boost_tol,
+                                                  const rocsparse_float_complex* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrilu0_numeric_boost(rocsparse_handle                handle,
+                                                  rocsparse_mat_info              info,
+                                                  int                             enable_boost,
+                                                  const double*                   boost_tol,
+                                                  const rocsparse_double_complex* boost_val);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
+ *  rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(), rocsparse_sbsrilu0(),
+ *  rocsparse_dbsrilu0(), rocsparse_sbsrilu0() and rocsparse_dbsrilu0(). The temporary
+ *  storage buffer must be allocated by the user. The size of the temporary storage
+ *  buffer is identical to the size returned by rocsparse_sbsrsv_buffer_size(),
+ *  rocsparse_dbsrsv_buffer_size(), rocsparse_cbsrsv_buffer_size(), rocsparse_zbsrsv_buffer_size(),
+ *  rocsparse_sbsric0_buffer_size(), rocsparse_dbsric0_buffer_size(), rocsparse_cbsric0_buffer_size()
+ *  and rocsparse_zbsric0_buffer_size() if the matrix sparsity pattern is identical. The user
+ *  allocated buffer can thus be shared between subsequent calls to those functions.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         direction that specifies whether to count nonzero elements by \ref rocsparse_direction_row or by
+ *              \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[out]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(),
+ *              rocsparse_cbsrilu0_analysis(), rocsparse_zbsrilu0_analysis(),
+ *              rocsparse_sbsrilu0(), rocsparse_dbsrilu0(), rocsparse_cbsrilu0()
+ *              and rocsparse_zbsrilu0().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+ *              \p bsr_col_ind, \p info or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nnzb,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             block_dim,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_direction       dir,
+                                                rocsparse_int             mb,
+                                                rocsparse_int             nnzb,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             bsr_val,
+                                                const rocsparse_int*      bsr_row_ptr,
+                                                const rocsparse_int*      bsr_col_ind,
+                                                rocsparse_int             block_dim,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrilu0_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_direction            dir,
+                                                rocsparse_int                  mb,
+                                                rocsparse_int                  nnzb,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* bsr_val,
+                                                const rocsparse_int*           bsr_row_ptr,
+                                                const rocsparse_int*           bsr_col_ind,
+                                                rocsparse_int                  block_dim,
+                                                rocsparse_mat_info             info,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrilu0_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_direction             dir,
+                                                rocsparse_int                   mb,
+                                                rocsparse_int                   nnzb,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* bsr_val,
+                                                const rocsparse_int*            bsr_row_ptr,
+                                                const rocsparse_int*            bsr_col_ind,
+                                                rocsparse_int                   block_dim,
+                                                rocsparse_mat_info              info,
+                                                size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0_analysis performs the analysis step for rocsparse_sbsrilu0()
+ *  rocsparse_dbsrilu0(), rocsparse_cbsrilu0(), and rocsparse_zbsrilu0(). It is expected
+ *  that this function will be executed only once for a given matrix. The analysis meta
+ *  data can be cleared by rocsparse_bsrilu0_clear().
+ *
+ *  \p rocsparse_bsrilu0_analysis can share its meta data with
+ *  rocsparse_sbsric0_analysis(), rocsparse_dbsric0_analysis(),
+ *  rocsparse_cbsric0_analysis(), rocsparse_zbsric0_analysis(),
+ *  rocsparse_sbsrsv_analysis(), rocsparse_dbsrsv_analysis(),
+ *  rocsparse_cbsrsv_analysis(), rocsparse_zbsrsv_analysis(),
+ *  rocsparse_sbsrsm_analysis(), rocsparse_dbsrsm_analysis(),
+ *  rocsparse_cbsrsm_analysis() and rocsparse_zbsrsm_analysis(). Selecting
+ *  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+ *  performance of meta data. However, the user need to make sure that the sparsity
+ *  pattern remains unchanged. If this cannot be assured,
+ *  \ref rocsparse_analysis_policy_force has to be used.
+ *  If only the values of the matrix have changed since the previous analysis,
+ *  \ref rocsparse_analysis_policy_numeric re-uses the meta data after verifying a
+ *  fingerprint of the sparsity pattern on the device, and re-builds it otherwise.
+ *
+ *  \note
+ *  If the matrix sparsity pattern changes, the gathered information will become invalid.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         direction that specified whether to count nonzero elements by
+ *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[out]
+ *  info        structure that holds the information collected during
+ *              the analysis step.
+ *  @param[in]
+ *  analysis    \ref rocsparse_analysis_policy_reuse,
+ *              \ref rocsparse_analysis_policy_force or
+ *              \ref rocsparse_analysis_policy_numeric.
+ *  @param[in]
+ *  solve       \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+ *              \p bsr_col_ind, \p info or \p temp_buffer pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_direction       dir,
+                                             rocsparse_int             mb,
+                                             rocsparse_int             nnzb,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             bsr_val,
+                                             const rocsparse_int*      bsr_row_ptr,
+                                             const rocsparse_int*      bsr_col_ind,
+                                             rocsparse_int             block_dim,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrilu0_analysis(rocsparse_handle               handle,
+                                             rocsparse_direction            dir,
+                                             rocsparse_int                  mb,
+                                             rocsparse_int                  nnzb,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* bsr_val,
+                                             const rocsparse_int*           bsr_row_ptr,
+                                             const rocsparse_int*           bsr_col_ind,
+                                             rocsparse_int                  block_dim,
+                                             rocsparse_mat_info             info,
+                                             rocsparse_analysis_policy      analysis,
+                                             rocsparse_solve_policy         solve,
+                                             void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrilu0_analysis(rocsparse_handle                handle,
+                                             rocsparse_direction             dir,
+                                             rocsparse_int                   mb,
+                                             rocsparse_int                   nnzb,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* bsr_val,
+                                             const rocsparse_int*            bsr_row_ptr,
+                                             const rocsparse_int*            bsr_col_ind,
+                                             rocsparse_int                   block_dim,
+                                             rocsparse_mat_info              info,
+                                             rocsparse_analysis_policy       analysis,
+                                             rocsparse_solve_policy          solve,
+                                             void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0_clear deallocates all memory that was allocated by
+ *  rocsparse_sbsrilu0_analysis(), rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis()
+ *  or rocsparse_zbsrilu0_analysis(). This is especially useful, if memory is an issue and
+ *  the analysis data is not required for further computation.
+ *
+ *  \note
+ *  Calling \p rocsparse_bsrilu0_clear is optional. All allocated resources will be
+ *  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+ *  rocsparse_destroy_mat_info().
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[inout]
+ *  info        structure that holds the information collected during the analysis step.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+ *  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+ *              be deallocated.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using BSR storage
+ *  format
+ *
+ *  \details
+ *  \p rocsparse_bsrilu0 computes the incomplete LU factorization with 0 fill-ins and no
+ *  pivoting of a sparse \f$mb \times mb\f$ BSR matrix \f$A\f$, such that
+ *  \f[
+ *    A \approx LU
+ *  \f]
+ *
+ *  \p rocsparse_bsrilu0 requires a user allocated temporary buffer. Its size is returned
+ *  by rocsparse_sbsrilu0_buffer_size(), rocsparse_dbsrilu0_buffer_size(),
+ *  rocsparse_cbsrilu0_buffer_size() or rocsparse_zbsrilu0_buffer_size(). Furthermore,
+ *  analysis meta data is required. It can be obtained by rocsparse_sbsrilu0_analysis(),
+ *  rocsparse_dbsrilu0_analysis(), rocsparse_cbsrilu0_analysis() or
+ *  rocsparse_zbsrilu0_analysis(). \p rocsparse_bsrilu0 reports the first zero pivot
+ *  (either numerical or structural zero). The zero pivot status can be obtained by
+ *  calling rocsparse_bsrilu0_zero_pivot().
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         direction that specified whether to count nonzero elements by
+ *              \ref rocsparse_direction_row or by \ref rocsparse_direction_row.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[inout]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix. Between 1 and m where \p m=mb*block_dim.
+ *  @param[in]
+ *  info        structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  policy      \ref rocsparse_solve_policy_auto.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr
+ *              or \p bsr_col_ind pointer is invalid.
+ *  \retval     rocsparse_status_arch_mismatch the device is not supported.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ *
+ *  \par Example
+ *  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in BSR
+ *  storage format. The following example computes the incomplete LU factorization
+ *  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
+ *  \code{.c}
+ *      // Create rocSPARSE handle
+ *      rocsparse_handle handle;
+ *      rocsparse_create_handle(&handle);
+ *
+ *      // Create matrix descriptor for M
+ *      rocsparse_mat_descr descr_M;
+ *      rocsparse_create_mat_descr(&descr_M);
+ *
+ *      // Create matrix descriptor for L
+ *      rocsparse_mat_descr descr_L;
+ *      rocsparse_create_mat_descr(&descr_L);
+ *      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+ *      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+ *
+ *      // Create matrix descriptor for U
+ *      rocsparse_mat_descr descr_U;
+ *      rocsparse_create_mat_descr(&descr_U);
+ *      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
+ *      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+ *
+ *      // Create matrix info structure
+ *      rocsparse_mat_info info;
+ *      rocsparse_create_mat_info(&info);
+ *
+ *      // Obtain required buffer size
+ *      size_t buffer_size_M;
+ *      size_t buffer_size_L;
+ *      size_t buffer_size_U;
+ *      rocsparse_dbsrilu0_buffer_size(handle,
+ *                                     rocsparse_direction_row,
+ *                                     mb,
+ *                                     nnzb,
+ *                                     descr_M,
+ *                                     bsr_val,
+ *                                     bsr_row_ptr,
+ *                                     bsr_col_ind,
+ *                                     block_dim,
+ *                                     info,
+ *                                     &buffer_size_M);
+ *      rocsparse_dbsrsv_buffer_size(handle,
+ *                                   rocsparse_direction_row,
+ *                                   rocsparse_operation_none,
+ *                                   mb,
+ *                                   nnzb,
+ *                                   descr_L,
+ *                                   bsr_val,
+ *                                   bsr_row_ptr,
+ *                                   bsr_col_ind,
+ *                                   block_dim,
+ *                                   info,
+ *                                   &buffer_size_L);
+ *      rocsparse_dbsrsv_buffer_size(handle,
+ *                                   rocsparse_direction_row,
+ *                                   rocsparse_operation_transpose,
+ *                                   mb,
+ *                                   nnzb,
+ *                                   descr_U,
+ *                                   bsr_val,
+ *                                   bsr_row_ptr,
+ *                                   bsr_col_ind,
+ *                                   block_dim,
+ *                                   info,
+ *                                   &buffer_size_U);
+ *
+ *      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+ *      // computation performance
+ *      rocsparse_dbsrilu0_analysis(handle,
+ *                                  rocsparse_direction_row,
+ *                                  mb,
+ *                                  nnzb,
+ *                                  descr_M,
+ *                                  bsr_val,
+ *                                  bsr_row_ptr,
+ *                                  bsr_col_ind,
+ *                                  block_dim,
+ *                                  info,
+ *                                  rocsparse_analysis_policy_reuse,
+ *                                  rocsparse_solve_policy_auto,
+ *                                  temp_buffer);
+ *      rocsparse_dbsrsv_analysis(handle,
+ *                                rocsparse_direction_row,
+ *                                rocsparse_operation_none,
+ *                                mb,
+ *                                nnzb,
+ *                                descr_L,
+ *                                bsr_val,
+ *                                bsr_row_ptr,
+ *                                bsr_col_ind,
  *                                block_dim,
  *                                info,
  *                                rocsparse_analysis_policy_reuse,
@@ -6691,925 +9924,4211 @@ rocsparse_status rocsparse_bsrilu0_clear(rocsparse_handle handle, rocsparse_mat_
  *
  *      // Check for zero pivot
  *      rocsparse_int position;
- *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
- *                                                                    info,
- *                                                                    &position))
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
+ *                                                                    info,
+ *                                                                    &position))
+ *      {
+ *          printf("A has structural zero at A(%d,%d)\n", position, position);
+ *      }
+ *
+ *      // Compute incomplete LU factorization M = LU
+ *      rocsparse_dbsrilu0(handle,
+ *                         rocsparse_direction_row,
+ *                         mb,
+ *                         nnzb,
+ *                         descr_M,
+ *                         bsr_val,
+ *                         bsr_row_ptr,
+ *                         bsr_col_ind,
+ *                         block_dim,
+ *                         info,
+ *                         rocsparse_solve_policy_auto,
+ *                         temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
+ *                                                                     info,
+ *                                                                     &position))
+ *      {
+ *          printf("L has structural and/or numerical zero at L(%d,%d)\n",
+ *                 position,
+ *                 position);
+ *      }
+ *
+ *      // Solve Lz = x
+ *      rocsparse_dbsrsv_solve(handle,
+ *                             rocsparse_direction_row,
+ *                             rocsparse_operation_none,
+ *                             mb,
+ *                             nnzb,
+ *                             &alpha,
+ *                             descr_L,
+ *                             bsr_val,
+ *                             bsr_row_ptr,
+ *                             bsr_col_ind,
+ *                             block_dim,
+ *                             info,
+ *                             x,
+ *                             z,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Solve Uy = z
+ *      rocsparse_dbsrsv_solve(handle,
+ *                             rocsparse_direction_row,
+ *                             rocsparse_operation_transpose,
+ *                             mb,
+ *                             nnzb,
+ *                             &alpha,
+ *                             descr_U,
+ *                             bsr_val,
+ *                             bsr_row_ptr,
+ *                             bsr_col_ind,
+ *                             block_dim,
+ *                             info,
+ *                             z,
+ *                             y,
+ *                             rocsparse_solve_policy_auto,
+ *                             temp_buffer);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *      rocsparse_destroy_mat_info(info);
+ *      rocsparse_destroy_mat_descr(descr_M);
+ *      rocsparse_destroy_mat_descr(descr_L);
+ *      rocsparse_destroy_mat_descr(descr_U);
+ *      rocsparse_destroy_handle(handle);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    float*                    bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    double*                   bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_float_complex*  bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrilu0(rocsparse_handle          handle,
+                                    rocsparse_direction       dir,
+                                    rocsparse_int             mb,
+                                    rocsparse_int             nnzb,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_double_complex* bsr_val,
+                                    const rocsparse_int*      bsr_row_ptr,
+                                    const rocsparse_int*      bsr_col_ind,
+                                    rocsparse_int             block_dim,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Block-Jacobi preconditioner using BSR storage format
+ *
+ *  \details
+ *  \p rocsparse_bsrjacobi_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+ *  structural or numerical zero has been found during rocsparse_sbsrjacobi_setup(),
+ *  rocsparse_dbsrjacobi_setup(), rocsparse_cbsrjacobi_setup() or
+ *  rocsparse_zbsrjacobi_setup() computation. The first zero pivot \f$j\f$ at
+ *  \f$A_{j,j}\f$ is stored in \p position, using same index base as the BSR matrix.
+ *
+ *  \p position can be in host or device memory. If no zero pivot has been found,
+ *  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+ *
+ *  \note
+ *  If a zero pivot is found, \p position \f$=j\f$ means that either the diagonal block
+ *  \f$A_{j,j}\f$ is missing (structural zero) or the diagonal block \f$A_{j,j}\f$ is not
+ *  invertible (numerical zero).
+ *
+ *  \note \p rocsparse_bsrjacobi_zero_pivot is a blocking function. It might influence
+ *  performance negatively.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info        structure that holds the information collected during the setup step.
+ *  @param[inout]
+ *  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+ *              invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+ */
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_bsrjacobi_zero_pivot(rocsparse_handle   handle,
+                                                rocsparse_mat_info info,
+                                                rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Block-Jacobi preconditioner using BSR storage format
+ *
+ *  \details
+ *  \p rocsparse_bsrjacobi_buffer_size returns the size of the temporary storage buffer
+ *  that is required by rocsparse_sbsrjacobi_setup(), rocsparse_dbsrjacobi_setup(),
+ *  rocsparse_cbsrjacobi_setup() and rocsparse_zbsrjacobi_setup(). The temporary storage
+ *  buffer must be allocated by the user.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         direction that specifies whether to count nonzero elements by
+ *              \ref rocsparse_direction_row or by \ref rocsparse_direction_column.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix.
+ *  @param[out]
+ *  buffer_size number of bytes of the temporary storage buffer required by
+ *              rocsparse_sbsrjacobi_setup(), rocsparse_dbsrjacobi_setup(),
+ *              rocsparse_cbsrjacobi_setup() and rocsparse_zbsrjacobi_setup().
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p dir or the index base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p bsr_val, \p bsr_row_ptr,
+ *              \p bsr_col_ind or \p buffer_size pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrjacobi_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_direction       dir,
+                                                  rocsparse_int             mb,
+                                                  rocsparse_int             nnzb,
+                                                  const rocsparse_mat_descr descr,
+                                                  const float*              bsr_val,
+                                                  const rocsparse_int*      bsr_row_ptr,
+                                                  const rocsparse_int*      bsr_col_ind,
+                                                  rocsparse_int             block_dim,
+                                                  size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrjacobi_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_direction       dir,
+                                                  rocsparse_int             mb,
+                                                  rocsparse_int             nnzb,
+                                                  const rocsparse_mat_descr descr,
+                                                  const double*             bsr_val,
+                                                  const rocsparse_int*      bsr_row_ptr,
+                                                  const rocsparse_int*      bsr_col_ind,
+                                                  rocsparse_int             block_dim,
+                                                  size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrjacobi_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_direction            dir,
+                                                  rocsparse_int                  mb,
+                                                  rocsparse_int                  nnzb,
+                                                  const rocsparse_mat_descr      descr,
+                                                  const rocsparse_float_complex* bsr_val,
+                                                  const rocsparse_int*           bsr_row_ptr,
+                                                  const rocsparse_int*           bsr_col_ind,
+                                                  rocsparse_int                  block_dim,
+                                                  size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrjacobi_buffer_size(rocsparse_handle                handle,
+                                                  rocsparse_direction             dir,
+                                                  rocsparse_int                   mb,
+                                                  rocsparse_int                   nnzb,
+                                                  const rocsparse_mat_descr       descr,
+                                                  const rocsparse_double_complex* bsr_val,
+                                                  const rocsparse_int*            bsr_row_ptr,
+                                                  const rocsparse_int*            bsr_col_ind,
+                                                  rocsparse_int                   block_dim,
+                                                  size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Block-Jacobi preconditioner using BSR storage format
+ *
+ *  \details
+ *  \p rocsparse_bsrjacobi_setup extracts the diagonal blocks \f$A_{j,j}\f$ of a sparse
+ *  \f$mb \times mb\f$ BSR matrix \f$A\f$ and inverts each of them by Gauss-Jordan
+ *  elimination with partial pivoting, such that
+ *  \f[
+ *    D^{-1} = \text{diag}(A_{0,0}^{-1}, \ldots, A_{mb-1,mb-1}^{-1}).
+ *  \f]
+ *  The inverted blocks are stored consecutively in \p bsr_diag_inv, using the same
+ *  block storage direction \p dir as \p bsr_val. Block dimensions of up to 32 are
+ *  inverted in on-chip memory, with specialized kernels for the block dimensions that
+ *  are supported by the BSR matrix vector multiplication.
+ *
+ *  \p rocsparse_bsrjacobi_setup requires a user allocated temporary buffer. Its size is
+ *  returned by rocsparse_sbsrjacobi_buffer_size(), rocsparse_dbsrjacobi_buffer_size(),
+ *  rocsparse_cbsrjacobi_buffer_size() or rocsparse_zbsrjacobi_buffer_size().
+ *  \p rocsparse_bsrjacobi_setup reports the first zero pivot (either a missing or a
+ *  singular diagonal block). The zero pivot status can be obtained by calling
+ *  rocsparse_bsrjacobi_zero_pivot(). The content of an inverted block that belongs to a
+ *  zero pivot is undefined.
+ *
+ *  \note
+ *  The column indices of each block row are expected to be sorted.
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         direction that specifies whether to count nonzero elements by
+ *              \ref rocsparse_direction_row or by \ref rocsparse_direction_column.
+ *  @param[in]
+ *  mb          number of block rows in the sparse BSR matrix.
+ *  @param[in]
+ *  nnzb        number of non-zero block entries of the sparse BSR matrix.
+ *  @param[in]
+ *  descr       descriptor of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_val     array of length \p nnzb*block_dim*block_dim containing the values of the sparse BSR matrix.
+ *  @param[in]
+ *  bsr_row_ptr array of \p mb+1 elements that point to the start of every block row of the
+ *              sparse BSR matrix.
+ *  @param[in]
+ *  bsr_col_ind array of \p nnzb elements containing the block column indices of the sparse BSR matrix.
+ *  @param[in]
+ *  block_dim   the block dimension of the BSR matrix.
+ *  @param[out]
+ *  info        structure that holds the zero pivot.
+ *  @param[out]
+ *  bsr_diag_inv array of length \p mb*block_dim*block_dim containing the inverted diagonal
+ *              blocks.
+ *  @param[in]
+ *  temp_buffer temporary storage buffer allocated by the user.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p dir or the index base is invalid.
+ *  \retval     rocsparse_status_invalid_size \p mb, \p nnzb, or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p descr, \p info, \p bsr_val,
+ *              \p bsr_row_ptr, \p bsr_col_ind, \p bsr_diag_inv or \p temp_buffer pointer
+ *              is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *  \retval     rocsparse_status_not_implemented
+ *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrjacobi_setup(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            float*                    bsr_diag_inv,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrjacobi_setup(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nnzb,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             bsr_val,
+                                            const rocsparse_int*      bsr_row_ptr,
+                                            const rocsparse_int*      bsr_col_ind,
+                                            rocsparse_int             block_dim,
+                                            rocsparse_mat_info        info,
+                                            double*                   bsr_diag_inv,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrjacobi_setup(rocsparse_handle               handle,
+                                            rocsparse_direction            dir,
+                                            rocsparse_int                  mb,
+                                            rocsparse_int                  nnzb,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* bsr_val,
+                                            const rocsparse_int*           bsr_row_ptr,
+                                            const rocsparse_int*           bsr_col_ind,
+                                            rocsparse_int                  block_dim,
+                                            rocsparse_mat_info             info,
+                                            rocsparse_float_complex*       bsr_diag_inv,
+                                            void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrjacobi_setup(rocsparse_handle                handle,
+                                            rocsparse_direction             dir,
+                                            rocsparse_int                   mb,
+                                            rocsparse_int                   nnzb,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* bsr_val,
+                                            const rocsparse_int*            bsr_row_ptr,
+                                            const rocsparse_int*            bsr_col_ind,
+                                            rocsparse_int                   block_dim,
+                                            rocsparse_mat_info              info,
+                                            rocsparse_double_complex*       bsr_diag_inv,
+                                            void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+ *  \brief Block-Jacobi preconditioner using BSR storage format
+ *
+ *  \details
+ *  \p rocsparse_bsrjacobi_apply applies the inverted diagonal blocks, that have been
+ *  computed by rocsparse_sbsrjacobi_setup(), rocsparse_dbsrjacobi_setup(),
+ *  rocsparse_cbsrjacobi_setup() or rocsparse_zbsrjacobi_setup(), to a dense vector
+ *  \f$x\f$, fused with the scaling of the result, such that
+ *  \f[
+ *    y := \alpha \cdot D^{-1} \cdot x + \beta \cdot y.
+ *  \f]
+ *
+ *  \note
+ *  This function is non blocking and executed asynchronously with respect to the host.
+ *  It may return before the actual computation has finished.
+ *
+ *  @param[in]
+ *  handle      handle to the rocsparse library context queue.
+ *  @param[in]
+ *  dir         block storage direction of \p bsr_diag_inv, \ref rocsparse_direction_row
+ *              or \ref rocsparse_direction_column.
+ *  @param[in]
+ *  mb          number of block rows.
+ *  @param[in]
+ *  block_dim   the block dimension.
+ *  @param[in]
+ *  alpha       scalar \f$\alpha\f$.
+ *  @param[in]
+ *  bsr_diag_inv array of length \p mb*block_dim*block_dim containing the inverted diagonal
+ *              blocks.
+ *  @param[in]
+ *  x           array of \p mb*block_dim elements (\f$x\f$).
+ *  @param[in]
+ *  beta        scalar \f$\beta\f$.
+ *  @param[inout]
+ *  y           array of \p mb*block_dim elements (\f$y\f$).
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_value \p dir is invalid.
+ *  \retval     rocsparse_status_invalid_size \p mb or \p block_dim is invalid.
+ *  \retval     rocsparse_status_invalid_pointer \p alpha, \p bsr_diag_inv, \p x, \p beta
+ *              or \p y pointer is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
+ *
+ *  \par Example
+ *  The following example applies two Jacobi sweeps \f$x_{k+1} = x_k + D^{-1}(b - Ax_k)\f$,
+ *  starting from \f$x_0 = 0\f$.
+ *  \code{.c}
+ *      // Obtain required buffer size
+ *      size_t buffer_size;
+ *      rocsparse_dbsrjacobi_buffer_size(handle,
+ *                                       rocsparse_direction_row,
+ *                                       mb,
+ *                                       nnzb,
+ *                                       descr,
+ *                                       bsr_val,
+ *                                       bsr_row_ptr,
+ *                                       bsr_col_ind,
+ *                                       block_dim,
+ *                                       &buffer_size);
+ *
+ *      // Allocate temporary buffer
+ *      void* temp_buffer;
+ *      hipMalloc(&temp_buffer, buffer_size);
+ *
+ *      // Invert the diagonal blocks
+ *      rocsparse_dbsrjacobi_setup(handle,
+ *                                 rocsparse_direction_row,
+ *                                 mb,
+ *                                 nnzb,
+ *                                 descr,
+ *                                 bsr_val,
+ *                                 bsr_row_ptr,
+ *                                 bsr_col_ind,
+ *                                 block_dim,
+ *                                 info,
+ *                                 bsr_diag_inv,
+ *                                 temp_buffer);
+ *
+ *      // Check for zero pivot
+ *      rocsparse_int position;
+ *      if(rocsparse_status_zero_pivot == rocsparse_bsrjacobi_zero_pivot(handle,
+ *                                                                       info,
+ *                                                                       &position))
  *      {
- *          printf("A has structural zero at A(%d,%d)\n", position, position);
+ *          printf("A(%d,%d) is not invertible\n", position, position);
  *      }
  *
- *      // Compute incomplete LU factorization M = LU
- *      rocsparse_dbsrilu0(handle,
- *                         rocsparse_direction_row,
- *                         mb,
- *                         nnzb,
- *                         descr_M,
- *                         bsr_val,
- *                         bsr_row_ptr,
- *                         bsr_col_ind,
- *                         block_dim,
- *                         info,
- *                         rocsparse_solve_policy_auto,
- *                         temp_buffer);
+ *      double one     = 1.0;
+ *      double zero    = 0.0;
+ *      double neg_one = -1.0;
  *
- *      // Check for zero pivot
- *      if(rocsparse_status_zero_pivot == rocsparse_bsrilu0_zero_pivot(handle,
- *                                                                     info,
- *                                                                     &position))
- *      {
- *          printf("L has structural and/or numerical zero at L(%d,%d)\n",
- *                 position,
- *                 position);
- *      }
+ *      // x = D^{-1} b
+ *      rocsparse_dbsrjacobi_apply(
+ *          handle, rocsparse_direction_row, mb, block_dim, &one, bsr_diag_inv, b, &zero, x);
  *
- *      // Solve Lz = x
- *      rocsparse_dbsrsv_solve(handle,
- *                             rocsparse_direction_row,
- *                             rocsparse_operation_none,
- *                             mb,
- *                             nnzb,
- *                             &alpha,
- *                             descr_L,
- *                             bsr_val,
- *                             bsr_row_ptr,
- *                             bsr_col_ind,
- *                             block_dim,
- *                             info,
- *                             x,
- *                             z,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
+ *      // r = b - A x
+ *      hipMemcpy(r, b, sizeof(double) * mb * block_dim, hipMemcpyDeviceToDevice);
+ *      rocsparse_dbsrmv(handle,
+ *                       rocsparse_direction_row,
+ *                       rocsparse_operation_none,
+ *                       mb,
+ *                       mb,
+ *                       nnzb,
+ *                       &neg_one,
+ *                       descr,
+ *                       bsr_val,
+ *                       bsr_row_ptr,
+ *                       bsr_col_ind,
+ *                       block_dim,
+ *                       x,
+ *                       &one,
+ *                       r);
  *
- *      // Solve Uy = z
- *      rocsparse_dbsrsv_solve(handle,
- *                             rocsparse_direction_row,
- *                             rocsparse_operation_transpose,
- *                             mb,
- *                             nnzb,
- *                             &alpha,
- *                             descr_U,
- *                             bsr_val,
- *                             bsr_row_ptr,
- *                             bsr_col_ind,
- *                             block_dim,
- *                             info,
- *                             z,
- *                             y,
- *                             rocsparse_solve_policy_auto,
- *                             temp_buffer);
+ *      // x = x + D^{-1} r
+ *      rocsparse_dbsrjacobi_apply(
+ *          handle, rocsparse_direction_row, mb, block_dim, &one, bsr_diag_inv, r, &one, x);
+ *
+ *      // Clean up
+ *      hipFree(temp_buffer);
+ *  \endcode
+ */
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sbsrjacobi_apply(rocsparse_handle    handle,
+                                            rocsparse_direction dir,
+                                            rocsparse_int       mb,
+                                            rocsparse_int       block_dim,
+                                            const float*        alpha,
+                                            const float*        bsr_diag_inv,
+                                            const float*        x,
+                                            const float*        beta,
+                                            float*              y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dbsrjacobi_apply(rocsparse_handle    handle,
+                                            rocsparse_direction dir,
+                                            rocsparse_int       mb,
+                                            rocsparse_int       block_dim,
+                                            const double*       alpha,
+                                            const double*       bsr_diag_inv,
+                                            const double*       x,
+                                            const double*       beta,
+                                            double*             y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cbsrjacobi_apply(rocsparse_handle               handle,
+                                            rocsparse_direction            dir,
+                                            rocsparse_int                  mb,
+                                            rocsparse_int                  block_dim,
+                                            const rocsparse_float_complex* alpha,
+                                            const rocsparse_float_complex* bsr_diag_inv,
+                                            const rocsparse_float_complex* x,
+                                            const rocsparse_float_complex* beta,
+                                            rocsparse_float_complex*       y);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zbsrjacobi_apply(rocsparse_handle                handle,
+                                            rocsparse_direction             dir,
+                                            rocsparse_int                   mb,
+                                            rocsparse_int                   block_dim,
+                                            const rocsparse_double_complex* alpha,
+                                            const rocsparse_double_complex* bsr_diag_inv,
+                                            const rocsparse_double_complex* x,
+                                            const rocsparse_double_complex* beta,
+                                            rocsparse_double_complex*       y);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsric0() or
+*  rocsparse_dcsric0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
+*  is stored in \p position, using same index base as the CSR matrix.
+*
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_csric0_zero_pivot is a blocking function. It might influence
+*  performance negatively.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handle,
+                                             rocsparse_mat_info info,
+                                             rocsparse_int*     position);
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*  rocsparse_scsric0() and rocsparse_dcsric0(). The temporary storage buffer must
+*  be allocated by the user. The size of the temporary storage buffer is identical to
+*  the size returned by rocsparse_scsrsv_buffer_size(), rocsparse_dcsrsv_buffer_size(),
+*  rocsparse_scsrilu0_buffer_size() and rocsparse_dcsrilu0_buffer_size() if the matrix
+*  sparsity pattern is identical. The user allocated buffer can thus be shared between
+*  subsequent calls to those functions.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*              rocsparse_scsric0() and rocsparse_dcsric0().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const float*              csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_buffer_size(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const double*             csr_val,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_mat_info        info,
+                                               size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsric0_buffer_size(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               rocsparse_int                  nnz,
+                                               const rocsparse_mat_descr      descr,
+                                               const rocsparse_float_complex* csr_val,
+                                               const rocsparse_int*           csr_row_ptr,
+                                               const rocsparse_int*           csr_col_ind,
+                                               rocsparse_mat_info             info,
+                                               size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsric0_buffer_size(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               rocsparse_int                   nnz,
+                                               const rocsparse_mat_descr       descr,
+                                               const rocsparse_double_complex* csr_val,
+                                               const rocsparse_int*            csr_row_ptr,
+                                               const rocsparse_int*            csr_col_ind,
+                                               rocsparse_mat_info              info,
+                                               size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0_analysis performs the analysis step for rocsparse_scsric0()
+*  and rocsparse_dcsric0(). It is expected that this function will be executed only
+*  once for a given matrix and particular operation type. The analysis meta data can be
+*  cleared by rocsparse_csric0_clear().
+*
+*  \p rocsparse_csric0_analysis can share its meta data with
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
+*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
+*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
+*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+*  performance of meta data. However, the user need to make sure that the sparsity
+*  pattern remains unchanged. If this cannot be assured,
+*  \ref rocsparse_analysis_policy_force has to be used.
+*  If only the values of the matrix have changed since the previous analysis,
+*  \ref rocsparse_analysis_policy_numeric re-uses the meta data after verifying a
+*  fingerprint of the sparsity pattern on the device, and re-builds it otherwise.
+*
+*  \note
+*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during
+*              the analysis step.
+*  @param[in]
+*  analysis    \ref rocsparse_analysis_policy_reuse,
+*              \ref rocsparse_analysis_policy_force or
+*              \ref rocsparse_analysis_policy_numeric.
+*  @param[in]
+*  solve       \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const float*              csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0_analysis(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const double*             csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_analysis_policy analysis,
+                                            rocsparse_solve_policy    solve,
+                                            void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsric0_analysis(rocsparse_handle               handle,
+                                            rocsparse_int                  m,
+                                            rocsparse_int                  nnz,
+                                            const rocsparse_mat_descr      descr,
+                                            const rocsparse_float_complex* csr_val,
+                                            const rocsparse_int*           csr_row_ptr,
+                                            const rocsparse_int*           csr_col_ind,
+                                            rocsparse_mat_info             info,
+                                            rocsparse_analysis_policy      analysis,
+                                            rocsparse_solve_policy         solve,
+                                            void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsric0_analysis(rocsparse_handle                handle,
+                                            rocsparse_int                   m,
+                                            rocsparse_int                   nnz,
+                                            const rocsparse_mat_descr       descr,
+                                            const rocsparse_double_complex* csr_val,
+                                            const rocsparse_int*            csr_row_ptr,
+                                            const rocsparse_int*            csr_col_ind,
+                                            rocsparse_mat_info              info,
+                                            rocsparse_analysis_policy       analysis,
+                                            rocsparse_solve_policy          solve,
+                                            void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0_clear deallocates all memory that was allocated by
+*  rocsparse_scsric0_analysis() or rocsparse_dcsric0_analysis(). This is especially
+*  useful, if memory is an issue and the analysis data is not required for further
+*  computation.
+*
+*  \note
+*  Calling \p rocsparse_csric0_clear is optional. All allocated resources will be
+*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+*  rocsparse_destroy_mat_info().
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csric0 computes the incomplete Cholesky factorization with 0 fill-ins
+*  and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    A \approx LL^T
+*  \f]
+*
+*  \p rocsparse_csric0 requires a user allocated temporary buffer. Its size is returned
+*  by rocsparse_scsric0_buffer_size() or rocsparse_dcsric0_buffer_size(). Furthermore,
+*  analysis meta data is required. It can be obtained by rocsparse_scsric0_analysis()
+*  or rocsparse_dcsric0_analysis(). \p rocsparse_csric0 reports the first zero pivot
+*  (either numerical or structural zero). The zero pivot status can be obtained by
+*  calling rocsparse_csric0_zero_pivot().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start
+*              of every row of the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  policy      \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+*              or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
+*  storage format. The following example computes the incomplete Cholesky factorization
+*  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
+*  \code{.c}
+*      // Create rocSPARSE handle
+*      rocsparse_handle handle;
+*      rocsparse_create_handle(&handle);
+*
+*      // Create matrix descriptor for M
+*      rocsparse_mat_descr descr_M;
+*      rocsparse_create_mat_descr(&descr_M);
+*
+*      // Create matrix descriptor for L
+*      rocsparse_mat_descr descr_L;
+*      rocsparse_create_mat_descr(&descr_L);
+*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+*
+*      // Create matrix descriptor for L'
+*      rocsparse_mat_descr descr_Lt;
+*      rocsparse_create_mat_descr(&descr_Lt);
+*      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
+*      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
+*
+*      // Create matrix info structure
+*      rocsparse_mat_info info;
+*      rocsparse_create_mat_info(&info);
+*
+*      // Obtain required buffer size
+*      size_t buffer_size_M;
+*      size_t buffer_size_L;
+*      size_t buffer_size_Lt;
+*      rocsparse_dcsric0_buffer_size(handle,
+*                                    m,
+*                                    nnz,
+*                                    descr_M,
+*                                    csr_val,
+*                                    csr_row_ptr,
+*                                    csr_col_ind,
+*                                    info,
+*                                    &buffer_size_M);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_none,
+*                                   m,
+*                                   nnz,
+*                                   descr_L,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_L);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_transpose,
+*                                   m,
+*                                   nnz,
+*                                   descr_Lt,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_Lt);
+*
+*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+*      // computation performance
+*      rocsparse_dcsric0_analysis(handle,
+*                                 m,
+*                                 nnz,
+*                                 descr_M,
+*                                 csr_val,
+*                                 csr_row_ptr,
+*                                 csr_col_ind,
+*                                 info,
+*                                 rocsparse_analysis_policy_reuse,
+*                                 rocsparse_solve_policy_auto,
+*                                 temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_none,
+*                                m,
+*                                nnz,
+*                                descr_L,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_transpose,
+*                                m,
+*                                nnz,
+*                                descr_Lt,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*
+*      // Check for zero pivot
+*      rocsparse_int position;
+*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
+*                                                                    info,
+*                                                                    &position))
+*      {
+*          printf("A has structural zero at A(%d,%d)\n", position, position);
+*      }
+*
+*      // Compute incomplete Cholesky factorization M = LL'
+*      rocsparse_dcsric0(handle,
+*                        m,
+*                        nnz,
+*                        descr_M,
+*                        csr_val,
+*                        csr_row_ptr,
+*                        csr_col_ind,
+*                        info,
+*                        rocsparse_solve_policy_auto,
+*                        temp_buffer);
+*
+*      // Check for zero pivot
+*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
+*                                                                    info,
+*                                                                    &position))
+*      {
+*          printf("L has structural and/or numerical zero at L(%d,%d)\n",
+*                 position,
+*                 position);
+*      }
+*
+*      // Solve Lz = x
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_none,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_L,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             x,
+*                             z,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Solve L'y = z
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_transpose,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_Lt,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             z,
+*                             y,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Clean up
+*      hipFree(temp_buffer);
+*      rocsparse_destroy_mat_info(info);
+*      rocsparse_destroy_mat_descr(descr_M);
+*      rocsparse_destroy_mat_descr(descr_L);
+*      rocsparse_destroy_mat_descr(descr_Lt);
+*      rocsparse_destroy_handle(handle);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   float*                    csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   double*                   csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_float_complex*  csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsric0(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   rocsparse_solve_policy    policy,
+                                   void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsrilu0(),
+*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() or rocsparse_zcsrilu0() computation. The
+*  first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same index
+*  base as the CSR matrix.
+*
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
+*  performance negatively.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+ *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR storage
+ *  format
  *
- *      // Clean up
- *      hipFree(temp_buffer);
- *      rocsparse_destroy_mat_info(info);
- *      rocsparse_destroy_mat_descr(descr_M);
- *      rocsparse_destroy_mat_descr(descr_L);
- *      rocsparse_destroy_mat_descr(descr_U);
- *      rocsparse_destroy_handle(handle);
- *  \endcode
+ *  \details
+ *  \p rocsparse_csrilu0_numeric_boost enables the user to replace a numerical value in
+ *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
+ *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
+ *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
+ *
+ *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
+ *  setting \p enable_boost to 0.
+ *
+ *  \note \p tol and \p boost_val can be in host or device memory.
+ *
+ *  @param[in]
+ *  handle          handle to the rocsparse library context queue.
+ *  @param[in]
+ *  info            structure that holds the information collected during the analysis step.
+ *  @param[in]
+ *  enable_boost    enable/disable numeric boost.
+ *  @param[in]
+ *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
+ *  @param[in]
+ *  boost_val       boost value to replace a numerical value.
+ *
+ *  \retval     rocsparse_status_success the operation completed successfully.
+ *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+ *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
+ *              is invalid.
+ *  \retval     rocsparse_status_internal_error an internal error occurred.
  */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    float*                    bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_scsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const float*       boost_tol,
+                                                  const float*       boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_numeric_boost(rocsparse_handle   handle,
+                                                  rocsparse_mat_info info,
+                                                  int                enable_boost,
+                                                  const double*      boost_tol,
+                                                  const double*      boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_numeric_boost(rocsparse_handle               handle,
+                                                  rocsparse_mat_info             info,
+                                                  int                            enable_boost,
+                                                  const float*                   boost_tol,
+                                                  const rocsparse_float_complex* boost_val);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_numeric_boost(rocsparse_handle                handle,
+                                                  rocsparse_mat_info              info,
+                                                  int                             enable_boost,
+                                                  const double*                   boost_tol,
+                                                  const rocsparse_double_complex* boost_val);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(), rocsparse_scsrilu0(),
+*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). The temporary
+*  storage buffer must be allocated by the user. The size of the temporary storage
+*  buffer is identical to the size returned by rocsparse_scsrsv_buffer_size(),
+*  rocsparse_dcsrsv_buffer_size(), rocsparse_ccsrsv_buffer_size() and
+*  rocsparse_zcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
+*  allocated buffer can thus be shared between subsequent calls to those functions.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*              rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
+*              rocsparse_scsrilu0(), rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and
+*              rocsparse_zcsrilu0().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                rocsparse_mat_info             info,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                rocsparse_mat_info              info,
+                                                size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0(),
+*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). It is expected
+*  that this function will be executed only once for a given matrix and particular
+*  operation type. The analysis meta data can be cleared by rocsparse_csrilu0_clear().
+*
+*  \p rocsparse_csrilu0_analysis can share its meta data with
+*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*  rocsparse_ccsric0_analysis(), rocsparse_zcsric0_analysis(),
+*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
+*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
+*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
+*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
+*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
+*  performance of meta data. However, the user need to make sure that the sparsity
+*  pattern remains unchanged. If this cannot be assured,
+*  \ref rocsparse_analysis_policy_force has to be used.
+*  If only the values of the matrix have changed since the previous analysis,
+*  \ref rocsparse_analysis_policy_numeric re-uses the meta data after verifying a
+*  fingerprint of the sparsity pattern on the device, and re-builds it otherwise.
+*
+*  \note
+*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  info        structure that holds the information collected during
+*              the analysis step.
+*  @param[in]
+*  analysis    \ref rocsparse_analysis_policy_reuse,
+*              \ref rocsparse_analysis_policy_force or
+*              \ref rocsparse_analysis_policy_numeric.
+*  @param[in]
+*  solve       \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_mat_info        info,
+                                             rocsparse_analysis_policy analysis,
+                                             rocsparse_solve_policy    solve,
+                                             void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0_analysis(rocsparse_handle               handle,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int*           csr_row_ptr,
+                                             const rocsparse_int*           csr_col_ind,
+                                             rocsparse_mat_info             info,
+                                             rocsparse_analysis_policy      analysis,
+                                             rocsparse_solve_policy         solve,
+                                             void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0_analysis(rocsparse_handle                handle,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             rocsparse_mat_info              info,
+                                             rocsparse_analysis_policy       analysis,
+                                             rocsparse_solve_policy          solve,
+                                             void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(). This is especially
+*  useful, if memory is an issue and the analysis data is not required for further
+*  computation.
+*
+*  \note
+*  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
+*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
+*  rocsparse_destroy_mat_info().
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[inout]
+*  info        structure that holds the information collected during the analysis step.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
+*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
+*              be deallocated.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
+*  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    A \approx LU
+*  \f]
+*
+*  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
+*  by rocsparse_scsrilu0_buffer_size(), rocsparse_dcsrilu0_buffer_size(),
+*  rocsparse_ccsrilu0_buffer_size() or rocsparse_zcsrilu0_buffer_size(). Furthermore,
+*  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis(),
+*  rocsparse_dcsrilu0_analysis(), rocsparse_ccsrilu0_analysis() or
+*  rocsparse_zcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
+*  (either numerical or structural zero). The zero pivot status can be obtained by
+*  calling rocsparse_csrilu0_zero_pivot().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start
+*              of every row of the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  policy      \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
+*              or \p csr_col_ind pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p trans != \ref rocsparse_operation_none or
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
+*  storage format. The following example computes the incomplete LU factorization
+*  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
+*  \code{.c}
+*      // Create rocSPARSE handle
+*      rocsparse_handle handle;
+*      rocsparse_create_handle(&handle);
+*
+*      // Create matrix descriptor for M
+*      rocsparse_mat_descr descr_M;
+*      rocsparse_create_mat_descr(&descr_M);
+*
+*      // Create matrix descriptor for L
+*      rocsparse_mat_descr descr_L;
+*      rocsparse_create_mat_descr(&descr_L);
+*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
+*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
+*
+*      // Create matrix descriptor for U
+*      rocsparse_mat_descr descr_U;
+*      rocsparse_create_mat_descr(&descr_U);
+*      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
+*      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
+*
+*      // Create matrix info structure
+*      rocsparse_mat_info info;
+*      rocsparse_create_mat_info(&info);
+*
+*      // Obtain required buffer size
+*      size_t buffer_size_M;
+*      size_t buffer_size_L;
+*      size_t buffer_size_U;
+*      rocsparse_dcsrilu0_buffer_size(handle,
+*                                    m,
+*                                    nnz,
+*                                    descr_M,
+*                                    csr_val,
+*                                    csr_row_ptr,
+*                                    csr_col_ind,
+*                                    info,
+*                                    &buffer_size_M);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_none,
+*                                   m,
+*                                   nnz,
+*                                   descr_L,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_L);
+*      rocsparse_dcsrsv_buffer_size(handle,
+*                                   rocsparse_operation_none,
+*                                   m,
+*                                   nnz,
+*                                   descr_U,
+*                                   csr_val,
+*                                   csr_row_ptr,
+*                                   csr_col_ind,
+*                                   info,
+*                                   &buffer_size_U);
+*
+*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
+*      // computation performance
+*      rocsparse_dcsrilu0_analysis(handle,
+*                                  m,
+*                                  nnz,
+*                                  descr_M,
+*                                  csr_val,
+*                                  csr_row_ptr,
+*                                  csr_col_ind,
+*                                  info,
+*                                  rocsparse_analysis_policy_reuse,
+*                                  rocsparse_solve_policy_auto,
+*                                  temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_none,
+*                                m,
+*                                nnz,
+*                                descr_L,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*      rocsparse_dcsrsv_analysis(handle,
+*                                rocsparse_operation_none,
+*                                m,
+*                                nnz,
+*                                descr_U,
+*                                csr_val,
+*                                csr_row_ptr,
+*                                csr_col_ind,
+*                                info,
+*                                rocsparse_analysis_policy_reuse,
+*                                rocsparse_solve_policy_auto,
+*                                temp_buffer);
+*
+*      // Check for zero pivot
+*      rocsparse_int position;
+*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+*                                                                     info,
+*                                                                     &position))
+*      {
+*          printf("A has structural zero at A(%d,%d)\n", position, position);
+*      }
+*
+*      // Compute incomplete LU factorization
+*      rocsparse_dcsrilu0(handle,
+*                         m,
+*                         nnz,
+*                         descr_M,
+*                         csr_val,
+*                         csr_row_ptr,
+*                         csr_col_ind,
+*                         info,
+*                         rocsparse_solve_policy_auto,
+*                         temp_buffer);
+*
+*      // Check for zero pivot
+*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
+*                                                                     info,
+*                                                                     &position))
+*      {
+*          printf("U has structural and/or numerical zero at U(%d,%d)\n",
+*                 position,
+*                 position);
+*      }
+*
+*      // Solve Lz = x
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_none,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_L,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             x,
+*                             z,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Solve Uy = z
+*      rocsparse_dcsrsv_solve(handle,
+*                             rocsparse_operation_none,
+*                             m,
+*                             nnz,
+*                             &alpha,
+*                             descr_U,
+*                             csr_val,
+*                             csr_row_ptr,
+*                             csr_col_ind,
+*                             info,
+*                             z,
+*                             y,
+*                             rocsparse_solve_policy_auto,
+*                             temp_buffer);
+*
+*      // Clean up
+*      hipFree(temp_buffer);
+*      rocsparse_destroy_mat_info(info);
+*      rocsparse_destroy_mat_descr(descr_M);
+*      rocsparse_destroy_mat_descr(descr_L);
+*      rocsparse_destroy_mat_descr(descr_U);
+*      rocsparse_destroy_handle(handle);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    float*                    csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    double*                   csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_float_complex*  csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilu0(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill \p k and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk_nnz computes the symbolic incomplete LU factorization with level
+*  of fill \p k of a sparse \f$m \times m\f$ CSR matrix \f$A\f$. An entry \f$(i,j)\f$
+*  of \f$A\f$ has level \f$0\f$. Eliminating an entry \f$(i,h)\f$ with \f$h < i\f$
+*  produces fill-in at \f$(i,j)\f$, \f$j > h\f$, with level
+*  \f$lev(i,h) + lev(h,j) + 1\f$. Only entries with a level not larger than \p k are kept.
+*  \p rocsparse_csriluk_nnz returns the row pointers and the number of non-zero entries
+*  of the resulting pattern. The column indices are kept in \p info, until they are
+*  obtained by rocsparse_csriluk_symbolic().
+*
+*  The symbolic phase only depends on the sparsity pattern of \f$A\f$. It has to be
+*  performed once and can be reused for all numerical factorizations of matrices with
+*  the same pattern, see rocsparse_scsriluk(), rocsparse_dcsriluk(),
+*  rocsparse_ccsriluk() and rocsparse_zcsriluk().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  The symbolic factorization is computed on the device in at most \p k sweeps. Each
+*  sweep reads the number of non-zero entries of its intermediate patterns, thus this
+*  function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+*                  the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[in]
+*  level_of_fill   level of fill \p k of the factorization. \p k = 0 yields the
+*                  pattern of \f$A\f$.
+*  @param[inout]
+*  info            structure that holds the column indices of the pattern until they
+*                  are obtained by rocsparse_csriluk_symbolic().
+*  @param[out]
+*  csr_row_ptr_lu  array of \p m+1 elements that point to the start of every row of
+*                  the incomplete LU factorization.
+*  @param[out]
+*  nnz_lu          pointer to the number of non-zero entries of the incomplete LU
+*                  factorization. \p nnz_lu can be a host or device pointer.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p level_of_fill is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+*              \p info, \p csr_row_ptr_lu or \p nnz_lu pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_nnz(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz,
+                                       const rocsparse_mat_descr descr,
+                                       const rocsparse_int*      csr_row_ptr,
+                                       const rocsparse_int*      csr_col_ind,
+                                       rocsparse_int             level_of_fill,
+                                       rocsparse_mat_info        info,
+                                       rocsparse_int*            csr_row_ptr_lu,
+                                       rocsparse_int*            nnz_lu);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill \p k and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk_symbolic computes the column indices of the symbolic incomplete
+*  LU factorization with level of fill \p k of a sparse \f$m \times m\f$ CSR matrix
+*  \f$A\f$. The row pointers and the number of non-zero entries of the factorization
+*  have to be obtained by rocsparse_csriluk_nnz(). The column indices of each row are
+*  sorted.
+*
+*  rocsparse_csriluk_nnz() keeps the pattern in \p info. If \p info holds a pattern that
+*  has not been consumed yet and that has been computed for the same dimensions, index
+*  base and level of fill, the column indices are copied from \p info and the symbolic
+*  factorization is not repeated. Otherwise, the symbolic factorization is computed
+*  again. In both cases, the pattern is released from \p info afterwards. Thus,
+*  rocsparse_csriluk_symbolic() has to be called for the same matrix as the preceding
+*  call to rocsparse_csriluk_nnz() with \p info.
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host,
+*  if the pattern is copied from \p info. Otherwise, the symbolic factorization is
+*  computed on the device and this function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+*                  the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[in]
+*  level_of_fill   level of fill \p k of the factorization.
+*  @param[inout]
+*  info            structure that has been passed to rocsparse_csriluk_nnz().
+*  @param[out]
+*  csr_col_ind_lu  array of \p nnz_lu elements containing the column indices of the
+*                  incomplete LU factorization.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p level_of_fill is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+*              \p info or \p csr_col_ind_lu pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csriluk_symbolic(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             level_of_fill,
+                                            rocsparse_mat_info        info,
+                                            rocsparse_int*            csr_col_ind_lu);
+
+/*! \ingroup precond_module
+*  \brief Incomplete LU factorization with level of fill \p k and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csriluk computes the numerical incomplete LU factorization with level
+*  of fill \p k and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such
+*  that
+*  \f[
+*    A \approx LU
+*  \f]
+*  The entries of \f$A\f$ are copied into the pattern that has been computed by
+*  rocsparse_csriluk_nnz() and rocsparse_csriluk_symbolic(), where fill-in entries are
+*  initialized with zero. The factorization is then computed in place, using the
+*  algorithm of rocsparse_scsrilu0(), rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and
+*  rocsparse_zcsrilu0() on the pattern of \f$LU\f$.
+*
+*  \p rocsparse_csriluk requires a user allocated temporary buffer. Its size is returned
+*  by rocsparse_scsrilu0_buffer_size(), rocsparse_dcsrilu0_buffer_size(),
+*  rocsparse_ccsrilu0_buffer_size() or rocsparse_zcsrilu0_buffer_size(), called with
+*  the pattern of \f$LU\f$. Furthermore, analysis meta data of the pattern of \f$LU\f$ is
+*  required. It can be obtained by rocsparse_scsrilu0_analysis(),
+*  rocsparse_dcsrilu0_analysis(), rocsparse_ccsrilu0_analysis() or
+*  rocsparse_zcsrilu0_analysis(). The analysis meta data can be reused for all
+*  numerical factorizations with the same pattern. Numeric boosting, see
+*  rocsparse_scsrilu0_numeric_boost(), applies as well. \p rocsparse_csriluk reports
+*  the first zero pivot (either numerical or structural zero). The zero pivot status can
+*  be obtained by calling rocsparse_csrilu0_zero_pivot().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix and its factorization.
+*  @param[in]
+*  csr_val         array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+*                  the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[in]
+*  nnz_lu          number of non-zero entries of the incomplete LU factorization.
+*  @param[out]
+*  csr_val_lu      array of \p nnz_lu elements of the incomplete LU factorization.
+*  @param[in]
+*  csr_row_ptr_lu  array of \p m+1 elements that point to the start of every row of
+*                  the incomplete LU factorization.
+*  @param[in]
+*  csr_col_ind_lu  array of \p nnz_lu elements containing the column indices of the
+*                  incomplete LU factorization.
+*  @param[in]
+*  info            structure that holds the information collected during the analysis
+*                  step of the pattern of \f$LU\f$.
+*  @param[in]
+*  policy          \ref rocsparse_solve_policy_auto.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p nnz_lu is invalid.
+*  \retval     rocsparse_status_invalid_value \p policy is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p csr_val_lu, \p csr_row_ptr_lu, \p csr_col_ind_lu,
+*              \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int             nnz_lu,
+                                    float*                    csr_val_lu,
+                                    const rocsparse_int*      csr_row_ptr_lu,
+                                    const rocsparse_int*      csr_col_ind_lu,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsriluk(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int             nnz_lu,
+                                    double*                   csr_val_lu,
+                                    const rocsparse_int*      csr_row_ptr_lu,
+                                    const rocsparse_int*      csr_col_ind_lu,
+                                    rocsparse_mat_info        info,
+                                    rocsparse_solve_policy    policy,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsriluk(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_int                  nnz_lu,
+                                    rocsparse_float_complex*       csr_val_lu,
+                                    const rocsparse_int*           csr_row_ptr_lu,
+                                    const rocsparse_int*           csr_col_ind_lu,
+                                    rocsparse_mat_info             info,
+                                    rocsparse_solve_policy         policy,
+                                    void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsriluk(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_int                   nnz_lu,
+                                    rocsparse_double_complex*       csr_val_lu,
+                                    const rocsparse_int*            csr_row_ptr_lu,
+                                    const rocsparse_int*            csr_col_ind_lu,
+                                    rocsparse_mat_info              info,
+                                    rocsparse_solve_policy          policy,
+                                    void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Iterative incomplete LU and Cholesky factorization with 0 fill-ins using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csritilu0_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsritilu0(), rocsparse_dcsritilu0(),
+*  rocsparse_ccsritilu0(), rocsparse_zcsritilu0(), rocsparse_scsritic0(),
+*  rocsparse_dcsritic0(), rocsparse_ccsritic0() and rocsparse_zcsritic0().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsritilu0(), rocsparse_dcsritilu0(), rocsparse_ccsritilu0(),
+*              rocsparse_zcsritilu0(), rocsparse_scsritic0(), rocsparse_dcsritic0(),
+*              rocsparse_ccsritic0() and rocsparse_zcsritic0().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsritilu0_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const float*              csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsritilu0_buffer_size(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const double*             csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsritilu0_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_int                  m,
+                                                  rocsparse_int                  nnz,
+                                                  const rocsparse_mat_descr      descr,
+                                                  const rocsparse_float_complex* csr_val,
+                                                  const rocsparse_int*           csr_row_ptr,
+                                                  const rocsparse_int*           csr_col_ind,
+                                                  size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsritilu0_buffer_size(rocsparse_handle                handle,
+                                                  rocsparse_int                   m,
+                                                  rocsparse_int                   nnz,
+                                                  const rocsparse_mat_descr       descr,
+                                                  const rocsparse_double_complex* csr_val,
+                                                  const rocsparse_int*            csr_row_ptr,
+                                                  const rocsparse_int*            csr_col_ind,
+                                                  size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Iterative incomplete LU factorization with 0 fill-ins and no pivoting using CSR
+*  storage format
+*
+*  \details
+*  \p rocsparse_csritilu0 computes an approximate incomplete LU factorization with 0
+*  fill-ins and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    A \approx LU
+*  \f]
+*  Instead of following the row dependencies of the factorization, as
+*  rocsparse_scsrilu0() does, the factors are computed by \p nsweeps fixed-point sweeps.
+*  In each sweep, all entries of \f$L\f$ and \f$U\f$ are updated in parallel from the
+*  previous iterate,
+*  \f[
+*    l_{ij} = \frac{1}{u_{jj}} \left(a_{ij} - \sum_{k < j} l_{ik} u_{kj}\right), \quad
+*    u_{ij} = a_{ij} - \sum_{k < i} l_{ik} u_{kj},
+*  \f]
+*  such that the cost of a sweep scales with the number of non-zero entries rather than
+*  with the depth of the dependency graph. The iteration starts from
+*  \f$L_0 = \text{tril}(A) \text{diag}(A)^{-1}\f$ and \f$U_0 = \text{triu}(A)\f$. The
+*  factors are stored in place, in the same format as computed by rocsparse_scsrilu0(),
+*  and can be used with rocsparse_scsrsv_solve() and its variants.
+*
+*  \p rocsparse_csritilu0 requires a user allocated temporary buffer. Its size is
+*  returned by rocsparse_scsritilu0_buffer_size(), rocsparse_dcsritilu0_buffer_size(),
+*  rocsparse_ccsritilu0_buffer_size() or rocsparse_zcsritilu0_buffer_size().
+*  Furthermore, analysis meta data is required. It can be obtained by
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(), and is shared with
+*  the triangular solves. \p rocsparse_csritilu0 reports the first zero pivot (either
+*  numerical or structural zero). The zero pivot status can be obtained by calling
+*  rocsparse_csrilu0_zero_pivot().
+*
+*  If \p history is not \p nullptr, the Frobenius norm of the nonlinear residual
+*  \f$(A - LU)\f$ on the sparsity pattern of \f$A\f$ is written to \p history[s] for
+*  the iterate that enters sweep \p s. It can be used to monitor convergence.
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  nsweeps     number of fixed-point sweeps.
+*  @param[out]
+*  history     optional array of \p nsweeps elements on the device, holding the residual
+*              norm of each sweep. Can be \p nullptr.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p nsweeps is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid, or \p info
+*              does not hold the analysis meta data.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsritilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      float*                    csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info,
+                                      rocsparse_int             nsweeps,
+                                      float*                    history,
+                                      void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsritilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      double*                   csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info,
+                                      rocsparse_int             nsweeps,
+                                      double*                   history,
+                                      void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsritilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      rocsparse_float_complex*  csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info,
+                                      rocsparse_int             nsweeps,
+                                      float*                    history,
+                                      void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsritilu0(rocsparse_handle          handle,
+                                      rocsparse_int             m,
+                                      rocsparse_int             nnz,
+                                      const rocsparse_mat_descr descr,
+                                      rocsparse_double_complex* csr_val,
+                                      const rocsparse_int*      csr_row_ptr,
+                                      const rocsparse_int*      csr_col_ind,
+                                      rocsparse_mat_info        info,
+                                      rocsparse_int             nsweeps,
+                                      double*                   history,
+                                      void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Iterative incomplete Cholesky factorization with 0 fill-ins and no pivoting using
+*  CSR storage format
+*
+*  \details
+*  \p rocsparse_csritic0 computes an approximate incomplete Cholesky factorization with 0
+*  fill-ins and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    A \approx LL^H
+*  \f]
+*  Instead of following the row dependencies of the factorization, as
+*  rocsparse_scsric0() does, the factor is computed by \p nsweeps fixed-point sweeps.
+*  In each sweep, all entries of \f$L\f$ are updated in parallel from the previous
+*  iterate,
+*  \f[
+*    l_{ij} = \frac{1}{l_{jj}} \left(a_{ij} - \sum_{k < j} l_{jk} \bar{l}_{ik}\right),
+*    \quad l_{ii} = \sqrt{a_{ii} - \sum_{k < i} l_{ik} \bar{l}_{ik}},
+*  \f]
+*  starting from \f$L_0 = \text{tril}(A) \text{diag}(A)^{-1/2}\f$. Only the lower part
+*  of \p csr_val is overwritten, in the same format as computed by rocsparse_scsric0().
+*
+*  \p rocsparse_csritic0 requires a user allocated temporary buffer. Its size is
+*  returned by rocsparse_scsritilu0_buffer_size(), rocsparse_dcsritilu0_buffer_size(),
+*  rocsparse_ccsritilu0_buffer_size() or rocsparse_zcsritilu0_buffer_size().
+*  Furthermore, analysis meta data is required. It can be obtained by
+*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*  rocsparse_ccsric0_analysis() or rocsparse_zcsric0_analysis(). \p rocsparse_csritic0
+*  reports the first zero pivot (either numerical or structural zero). The zero pivot
+*  status can be obtained by calling rocsparse_csric0_zero_pivot().
+*
+*  If \p history is not \p nullptr, the Frobenius norm of the nonlinear residual
+*  \f$(A - LU)\f$ on the sparsity pattern of \f$A\f$ is written to \p history[s] for
+*  the iterate that enters sweep \p s. It can be used to monitor convergence.
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[inout]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  info        structure that holds the information collected during the analysis step.
+*  @param[in]
+*  nsweeps     number of fixed-point sweeps.
+*  @param[out]
+*  history     optional array of \p nsweeps elements on the device, holding the residual
+*              norm of each sweep. Can be \p nullptr.
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p nsweeps is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid, or \p info
+*              does not hold the analysis meta data.
+*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsritic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     float*                    csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     float*                    history,
+                                     void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsritic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     double*                   csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     double*                   history,
+                                     void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsritic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     rocsparse_float_complex*  csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     float*                    history,
+                                     void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsritic0(rocsparse_handle          handle,
+                                     rocsparse_int             m,
+                                     rocsparse_int             nnz,
+                                     const rocsparse_mat_descr descr,
+                                     rocsparse_double_complex* csr_val,
+                                     const rocsparse_int*      csr_row_ptr,
+                                     const rocsparse_int*      csr_col_ind,
+                                     rocsparse_mat_info        info,
+                                     rocsparse_int             nsweeps,
+                                     double*                   history,
+                                     void*                     temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Fill budget of the threshold-based incomplete LU and Cholesky factorizations
+*
+*  \details
+*  \p rocsparse_csrilut_nnz returns the maximum number of non-zero entries of the
+*  factorization computed by rocsparse_scsrilut(), rocsparse_dcsrilut(),
+*  rocsparse_ccsrilut() and rocsparse_zcsrilut(). Row \f$i\f$ of the factorization
+*  holds at most \f$\min(p, i)\f$ entries in the strictly lower part,
+*  \f$\min(p, m - 1 - i)\f$ entries in the strictly upper part and the diagonal, where
+*  \f$p\f$ is \p max_fill. The bound only depends on \p m and \p max_fill, such that
+*  the factorization can be allocated before its computation.
+*
+*  \p rocsparse_csrict_nnz returns the maximum number of non-zero entries of the lower
+*  triangular factor computed by rocsparse_scsrict(), rocsparse_dcsrict(),
+*  rocsparse_ccsrict() and rocsparse_zcsrict().
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  max_fill    maximum number of entries that are kept in the strictly lower and in the
+*              strictly upper part of each row.
+*  @param[out]
+*  nnz_lu      maximum number of non-zero entries of the factorization. Can be a host or
+*              device pointer.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p max_fill is invalid, or the
+*              number of entries exceeds the range of \ref rocsparse_int.
+*  \retval     rocsparse_status_invalid_pointer \p nnz_lu pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrilut_nnz(rocsparse_handle handle,
+                                       rocsparse_int    m,
+                                       rocsparse_int    max_fill,
+                                       rocsparse_int*   nnz_lu);
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrict_nnz(rocsparse_handle handle,
+                                      rocsparse_int    m,
+                                      rocsparse_int    max_fill,
+                                      rocsparse_int*   nnz_l);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Threshold-based incomplete LU and Cholesky factorization using CSR storage
+*  format
+*
+*  \details
+*  \p rocsparse_csrilut_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsrilut(), rocsparse_dcsrilut(),
+*  rocsparse_ccsrilut(), rocsparse_zcsrilut(), rocsparse_scsrict(),
+*  rocsparse_dcsrict(), rocsparse_ccsrict() and rocsparse_zcsrict().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr       descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
+*              sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
+*              CSR matrix.
+*  @param[in]
+*  max_fill    maximum number of entries that are kept in the strictly lower and in the
+*              strictly upper part of each row.
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_scsrilut(), rocsparse_dcsrilut(), rocsparse_ccsrilut(),
+*              rocsparse_zcsrilut(), rocsparse_scsrict(), rocsparse_dcsrict(),
+*              rocsparse_ccsrict() and rocsparse_zcsrict().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p max_fill is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilut_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_int             max_fill,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilut_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_int             max_fill,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilut_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                rocsparse_int                  max_fill,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilut_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                rocsparse_int                   max_fill,
+                                                size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Threshold-based incomplete LU factorization with a bounded fill per row and no
+*  pivoting using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrilut computes the incomplete LU factorization ILUT(\f$\tau\f$, \f$p\f$)
+*  with no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    A \approx LU
+*  \f]
+*  Row \f$i\f$ is eliminated in increasing column order. Multipliers \f$l_{ik}\f$ with
+*  \f$|l_{ik}| \leq \tau_i\f$ are dropped, where \f$\tau_i = tol \cdot \|a_i\|_2\f$.
+*  Afterwards, the \f$p\f$ = \p max_fill largest entries of the strictly lower and of
+*  the strictly upper part that exceed \f$\tau_i\f$ are kept, together with the
+*  diagonal. The factorization is stored in \p csr_row_ptr_lu, \p csr_col_ind_lu and
+*  \p csr_val_lu in the same format as computed by rocsparse_scsrilu0(), i.e. the unit
+*  diagonal of \f$L\f$ is not stored. The arrays \p csr_col_ind_lu and \p csr_val_lu
+*  must hold the fill budget that is returned by rocsparse_csrilut_nnz(), the actual
+*  number of entries is given by \p csr_row_ptr_lu.
+*
+*  The rows are processed by one wavefront each, in a working row in shared memory of
+*  at most eight times the wavefront size entries. Rows of \f$A\f$ whose fill-in does
+*  not fit into the working row are computed again in a working row in global memory.
+*  These rows wait for all previous rows and are thus processed one at a time.
+*
+*  \p rocsparse_csrilut requires a user allocated temporary buffer. Its size is
+*  returned by rocsparse_scsrilut_buffer_size(), rocsparse_dcsrilut_buffer_size(),
+*  rocsparse_ccsrilut_buffer_size() or rocsparse_zcsrilut_buffer_size().
+*  Furthermore, analysis meta data is required. It can be obtained by
+*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
+*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(). Numeric boosting
+*  of the pivots can be enabled by rocsparse_scsrilu0_numeric_boost(),
+*  rocsparse_dcsrilu0_numeric_boost(), rocsparse_ccsrilu0_numeric_boost() or
+*  rocsparse_zcsrilu0_numeric_boost(). \p rocsparse_csrilut reports the first zero
+*  pivot (either numerical or structural zero). The zero pivot status can be obtained
+*  by calling rocsparse_csrilu0_zero_pivot().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val         array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[in]
+*  info            structure that holds the information collected during the analysis
+*                  step.
+*  @param[in]
+*  tol             relative drop tolerance, \f$tol \geq 0\f$.
+*  @param[in]
+*  max_fill        maximum number of entries that are kept in the strictly lower and in
+*                  the strictly upper part of each row.
+*  @param[out]
+*  csr_row_ptr_lu  array of \p m+1 elements that point to the start of every row of the
+*                  factorization.
+*  @param[out]
+*  csr_col_ind_lu  array of at least \p nnz_lu elements containing the column indices of
+*                  the factorization, where \p nnz_lu is returned by
+*                  rocsparse_csrilut_nnz().
+*  @param[out]
+*  csr_val_lu      array of at least \p nnz_lu elements of the factorization.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p max_fill is invalid.
+*  \retval     rocsparse_status_invalid_value \p tol is negative.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info, \p csr_row_ptr_lu, \p csr_col_ind_lu,
+*              \p csr_val_lu or \p temp_buffer pointer is invalid, or \p info does not
+*              hold the analysis meta data.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrilut(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    float                     tol,
+                                    rocsparse_int             max_fill,
+                                    rocsparse_int*            csr_row_ptr_lu,
+                                    rocsparse_int*            csr_col_ind_lu,
+                                    float*                    csr_val_lu,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrilut(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_mat_info        info,
+                                    double                    tol,
+                                    rocsparse_int             max_fill,
+                                    rocsparse_int*            csr_row_ptr_lu,
+                                    rocsparse_int*            csr_col_ind_lu,
+                                    double*                   csr_val_lu,
+                                    void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrilut(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_mat_info             info,
+                                    float                          tol,
+                                    rocsparse_int                  max_fill,
+                                    rocsparse_int*                 csr_row_ptr_lu,
+                                    rocsparse_int*                 csr_col_ind_lu,
+                                    rocsparse_float_complex*       csr_val_lu,
+                                    void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrilut(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_mat_info              info,
+                                    double                          tol,
+                                    rocsparse_int                   max_fill,
+                                    rocsparse_int*                  csr_row_ptr_lu,
+                                    rocsparse_int*                  csr_col_ind_lu,
+                                    rocsparse_double_complex*       csr_val_lu,
+                                    void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Threshold-based incomplete Cholesky factorization with a bounded fill per row
+*  and no pivoting using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrict computes the incomplete Cholesky factorization ICT(\f$\tau\f$,
+*  \f$p\f$) with no pivoting of a sparse Hermitian \f$m \times m\f$ CSR matrix \f$A\f$,
+*  such that
+*  \f[
+*    A \approx LL^H
+*  \f]
+*  Both triangular parts of \f$A\f$ have to be stored. The rows are eliminated and
+*  dropped as in rocsparse_scsrilut(), the lower triangular factor is obtained from the
+*  unit lower triangular factor and the pivots \f$u_{kk}\f$ by
+*  \f$l_{ik} \sqrt{|u_{kk}|}\f$ and \f$l_{ii} = \sqrt{|u_{ii}|}\f$. Without dropping,
+*  this is the Cholesky factor of \f$A\f$. \f$L\f$ is stored in \p csr_row_ptr_l,
+*  \p csr_col_ind_l and \p csr_val_l, including its diagonal. The arrays
+*  \p csr_col_ind_l and \p csr_val_l must hold the fill budget that is returned by
+*  rocsparse_csrict_nnz().
+*
+*  \p rocsparse_csrict requires a user allocated temporary buffer. Its size is
+*  returned by rocsparse_scsrilut_buffer_size(), rocsparse_dcsrilut_buffer_size(),
+*  rocsparse_ccsrilut_buffer_size() or rocsparse_zcsrilut_buffer_size().
+*  Furthermore, analysis meta data is required. It can be obtained by
+*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
+*  rocsparse_ccsric0_analysis() or rocsparse_zcsric0_analysis(). Numeric boosting
+*  of the pivots is shared with rocsparse_scsrilu0_numeric_boost(),
+*  rocsparse_dcsrilu0_numeric_boost(), rocsparse_ccsrilu0_numeric_boost() and
+*  rocsparse_zcsrilu0_numeric_boost(). \p rocsparse_csrict reports the first zero
+*  pivot (either numerical or structural zero). The zero pivot status can be obtained
+*  by calling rocsparse_csric0_zero_pivot().
+*
+*  \note
+*  The sparse CSR matrix has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val         array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[in]
+*  info            structure that holds the information collected during the analysis
+*                  step.
+*  @param[in]
+*  tol             relative drop tolerance, \f$tol \geq 0\f$.
+*  @param[in]
+*  max_fill        maximum number of entries that are kept in the strictly lower and in
+*                  the strictly upper part of each row.
+*  @param[out]
+*  csr_row_ptr_l   array of \p m+1 elements that point to the start of every row of the
+*                  lower triangular factor.
+*  @param[out]
+*  csr_col_ind_l   array of at least \p nnz_l elements containing the column indices of
+*                  the lower triangular factor, where \p nnz_l is returned by
+*                  rocsparse_csrict_nnz().
+*  @param[out]
+*  csr_val_l       array of at least \p nnz_l elements of the lower triangular factor.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p max_fill is invalid.
+*  \retval     rocsparse_status_invalid_value \p tol is negative.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p info, \p csr_row_ptr_l, \p csr_col_ind_l,
+*              \p csr_val_l or \p temp_buffer pointer is invalid, or \p info does not
+*              hold the analysis meta data.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrict(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   const float*              csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   float                     tol,
+                                   rocsparse_int             max_fill,
+                                   rocsparse_int*            csr_row_ptr_l,
+                                   rocsparse_int*            csr_col_ind_l,
+                                   float*                    csr_val_l,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrict(rocsparse_handle          handle,
+                                   rocsparse_int             m,
+                                   rocsparse_int             nnz,
+                                   const rocsparse_mat_descr descr,
+                                   const double*             csr_val,
+                                   const rocsparse_int*      csr_row_ptr,
+                                   const rocsparse_int*      csr_col_ind,
+                                   rocsparse_mat_info        info,
+                                   double                    tol,
+                                   rocsparse_int             max_fill,
+                                   rocsparse_int*            csr_row_ptr_l,
+                                   rocsparse_int*            csr_col_ind_l,
+                                   double*                   csr_val_l,
+                                   void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrict(rocsparse_handle               handle,
+                                   rocsparse_int                  m,
+                                   rocsparse_int                  nnz,
+                                   const rocsparse_mat_descr      descr,
+                                   const rocsparse_float_complex* csr_val,
+                                   const rocsparse_int*           csr_row_ptr,
+                                   const rocsparse_int*           csr_col_ind,
+                                   rocsparse_mat_info             info,
+                                   float                          tol,
+                                   rocsparse_int                  max_fill,
+                                   rocsparse_int*                 csr_row_ptr_l,
+                                   rocsparse_int*                 csr_col_ind_l,
+                                   rocsparse_float_complex*       csr_val_l,
+                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrict(rocsparse_handle                handle,
+                                   rocsparse_int                   m,
+                                   rocsparse_int                   nnz,
+                                   const rocsparse_mat_descr       descr,
+                                   const rocsparse_double_complex* csr_val,
+                                   const rocsparse_int*            csr_row_ptr,
+                                   const rocsparse_int*            csr_col_ind,
+                                   rocsparse_mat_info              info,
+                                   double                          tol,
+                                   rocsparse_int                   max_fill,
+                                   rocsparse_int*                  csr_row_ptr_l,
+                                   rocsparse_int*                  csr_col_ind_l,
+                                   rocsparse_double_complex*       csr_val_l,
+                                   void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Factorized sparse approximate inverse zero pivot
+*
+*  \details
+*  \p rocsparse_csrfsai_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
+*  structural or numerical zero has been found during rocsparse_scsrfsai(),
+*  rocsparse_dcsrfsai(), rocsparse_ccsrfsai() or rocsparse_zcsrfsai() computation.
+*  The first row \f$j\f$, whose local problem \f$A(J_j, J_j)\f$ is not positive
+*  definite, is stored in \p position, using same index base as the CSR matrix.
+*
+*  \p position can be in host or device memory. If no zero pivot has been found,
+*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*
+*  \note \p rocsparse_csrfsai_zero_pivot is a blocking function. It might influence
+*  performance negatively.
+*
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  info        structure that holds the information collected during the computation of
+*              the approximate inverse.
+*  @param[inout]
+*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrfsai_zero_pivot(rocsparse_handle   handle,
+                                              rocsparse_mat_info info,
+                                              rocsparse_int*     position);
+
+/*! \ingroup precond_module
+*  \brief Sparsity pattern of the factorized sparse approximate inverse
+*
+*  \details
+*  \p rocsparse_csrfsai_nnz computes the row pointers and the number of non-zero entries
+*  of the lower triangular factor \f$G\f$ computed by rocsparse_scsrfsai(),
+*  rocsparse_dcsrfsai(), rocsparse_ccsrfsai() and rocsparse_zcsrfsai(). Row \f$i\f$
+*  of \f$G\f$ holds the entries of row \f$i\f$ of the sparsity pattern \f$S\f$ that
+*  are in the strictly lower part, and the diagonal. Common choices for \f$S\f$ are the
+*  pattern of \f$A\f$ itself, or the pattern of \f$A^2\f$, that can be obtained by
+*  rocsparse_csrgemm_nnz().
+*
+*  \note
+*  The sparsity pattern has to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz_S           number of non-zero entries of the sparsity pattern \f$S\f$.
+*  @param[in]
+*  descr_S         descriptor of the sparsity pattern \f$S\f$.
+*  @param[in]
+*  csr_row_ptr_S   array of \p m+1 elements that point to the start of every row of the
+*                  sparsity pattern \f$S\f$.
+*  @param[in]
+*  csr_col_ind_S   array of \p nnz_S elements containing the column indices of the
+*                  sparsity pattern \f$S\f$.
+*  @param[in]
+*  descr_G         descriptor of the lower triangular factor \f$G\f$.
+*  @param[out]
+*  csr_row_ptr_G   array of \p m+1 elements that point to the start of every row of
+*                  \f$G\f$.
+*  @param[out]
+*  nnz_G           number of non-zero entries of \f$G\f$. Can be a host or device
+*                  pointer.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz_S is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr_S, \p csr_row_ptr_S,
+*              \p csr_col_ind_S, \p descr_G, \p csr_row_ptr_G or \p nnz_G pointer is
+*              invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrfsai_nnz(rocsparse_handle          handle,
+                                       rocsparse_int             m,
+                                       rocsparse_int             nnz_S,
+                                       const rocsparse_mat_descr descr_S,
+                                       const rocsparse_int*      csr_row_ptr_S,
+                                       const rocsparse_int*      csr_col_ind_S,
+                                       const rocsparse_mat_descr descr_G,
+                                       rocsparse_int*            csr_row_ptr_G,
+                                       rocsparse_int*            nnz_G);
+
+/*! \ingroup precond_module
+*  \brief Factorized sparse approximate inverse using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrfsai_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsrfsai(), rocsparse_dcsrfsai(),
+*  rocsparse_ccsrfsai() and rocsparse_zcsrfsai(). The size of the buffer depends on
+*  the largest row of \f$G\f$, as computed by rocsparse_csrfsai_nnz().
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  descr_G         descriptor of the lower triangular factor \f$G\f$.
+*  @param[in]
+*  csr_row_ptr_G   array of \p m+1 elements that point to the start of every row of
+*                  \f$G\f$, as computed by rocsparse_csrfsai_nnz().
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_scsrfsai(), rocsparse_dcsrfsai(), rocsparse_ccsrfsai()
+*                  and rocsparse_zcsrfsai().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz_A is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr_A, \p csr_val_A,
+*              \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_G, \p csr_row_ptr_G or
+*              \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrfsai_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz_A,
+                                                const rocsparse_mat_descr descr_A,
+                                                const float*              csr_val_A,
+                                                const rocsparse_int*      csr_row_ptr_A,
+                                                const rocsparse_int*      csr_col_ind_A,
+                                                const rocsparse_mat_descr descr_G,
+                                                const rocsparse_int*      csr_row_ptr_G,
+                                                size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    double*                   bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrfsai_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz_A,
+                                                const rocsparse_mat_descr descr_A,
+                                                const double*             csr_val_A,
+                                                const rocsparse_int*      csr_row_ptr_A,
+                                                const rocsparse_int*      csr_col_ind_A,
+                                                const rocsparse_mat_descr descr_G,
+                                                const rocsparse_int*      csr_row_ptr_G,
+                                                size_t*                   buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_float_complex*  bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
+rocsparse_status rocsparse_ccsrfsai_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  nnz_A,
+                                                const rocsparse_mat_descr      descr_A,
+                                                const rocsparse_float_complex* csr_val_A,
+                                                const rocsparse_int*           csr_row_ptr_A,
+                                                const rocsparse_int*           csr_col_ind_A,
+                                                const rocsparse_mat_descr      descr_G,
+                                                const rocsparse_int*           csr_row_ptr_G,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrfsai_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz_A,
+                                                const rocsparse_mat_descr       descr_A,
+                                                const rocsparse_double_complex* csr_val_A,
+                                                const rocsparse_int*            csr_row_ptr_A,
+                                                const rocsparse_int*            csr_col_ind_A,
+                                                const rocsparse_mat_descr       descr_G,
+                                                const rocsparse_int*            csr_row_ptr_G,
+                                                size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Factorized sparse approximate inverse using CSR storage format
+*
+*  \details
+*  \p rocsparse_csrfsai computes the factorized sparse approximate inverse (FSAI) of a
+*  sparse Hermitian positive definite \f$m \times m\f$ CSR matrix \f$A\f$, such that
+*  \f[
+*    G^H G \approx A^{-1},
+*  \f]
+*  where \f$G\f$ is lower triangular with the sparsity pattern computed by
+*  rocsparse_csrfsai_nnz(). For each row \f$i\f$ with the column indices \f$J_i\f$ of
+*  \f$G\f$, the small dense local problem
+*  \f[
+*    A(J_i, J_i) \, \bar{g}_i = e_i
+*  \f]
+*  is solved by Cholesky decomposition, and the row is scaled such that
+*  \f$G A G^H\f$ has unit diagonal. The local problems are solved in a batch, one
+*  wavefront per row. \p rocsparse_csrfsai reports the first row, whose local problem is
+*  not positive definite. The zero pivot status can be obtained by calling
+*  rocsparse_csrfsai_zero_pivot().
+*
+*  The preconditioner \f$z = G^H G r\f$ is applied with two sparse matrix vector
+*  multiplications, e.g. by rocsparse_spmv() with \ref rocsparse_operation_none and
+*  \ref rocsparse_operation_conjugate_transpose.
+*
+*  \p rocsparse_csrfsai requires a user allocated temporary buffer. Its size is
+*  returned by rocsparse_scsrfsai_buffer_size(), rocsparse_dcsrfsai_buffer_size(),
+*  rocsparse_ccsrfsai_buffer_size() or rocsparse_zcsrfsai_buffer_size().
+*
+*  \note
+*  Both triangular parts of \f$A\f$ have to be stored. The sparse CSR matrix and the
+*  sparsity pattern have to be sorted. This can be achieved by calling
+*  rocsparse_csrsort().
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz_A           number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr_A         descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val_A       array of \p nnz_A elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr_A   array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind_A   array of \p nnz_A elements containing the column indices of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  nnz_S           number of non-zero entries of the sparsity pattern \f$S\f$.
+*  @param[in]
+*  descr_S         descriptor of the sparsity pattern \f$S\f$.
+*  @param[in]
+*  csr_row_ptr_S   array of \p m+1 elements that point to the start of every row of the
+*                  sparsity pattern \f$S\f$.
+*  @param[in]
+*  csr_col_ind_S   array of \p nnz_S elements containing the column indices of the
+*                  sparsity pattern \f$S\f$.
+*  @param[out]
+*  info            structure that holds the zero pivot information.
+*  @param[in]
+*  descr_G         descriptor of the lower triangular factor \f$G\f$.
+*  @param[out]
+*  csr_val_G       array of \p nnz_G elements of \f$G\f$.
+*  @param[in]
+*  csr_row_ptr_G   array of \p m+1 elements that point to the start of every row of
+*                  \f$G\f$, as computed by rocsparse_csrfsai_nnz().
+*  @param[out]
+*  csr_col_ind_G   array of \p nnz_G elements containing the column indices of \f$G\f$.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user.
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz_A or \p nnz_S is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr_A, \p csr_val_A,
+*              \p csr_row_ptr_A, \p csr_col_ind_A, \p descr_S, \p csr_row_ptr_S,
+*              \p csr_col_ind_S, \p info, \p descr_G, \p csr_val_G, \p csr_row_ptr_G,
+*              \p csr_col_ind_G or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrfsai(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz_A,
+                                    const rocsparse_mat_descr descr_A,
+                                    const float*              csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    rocsparse_int             nnz_S,
+                                    const rocsparse_mat_descr descr_S,
+                                    const rocsparse_int*      csr_row_ptr_S,
+                                    const rocsparse_int*      csr_col_ind_S,
                                     rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
+                                    const rocsparse_mat_descr descr_G,
+                                    float*                    csr_val_G,
+                                    const rocsparse_int*      csr_row_ptr_G,
+                                    rocsparse_int*            csr_col_ind_G,
                                     void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zbsrilu0(rocsparse_handle          handle,
-                                    rocsparse_direction       dir,
-                                    rocsparse_int             mb,
-                                    rocsparse_int             nnzb,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_double_complex* bsr_val,
-                                    const rocsparse_int*      bsr_row_ptr,
-                                    const rocsparse_int*      bsr_col_ind,
-                                    rocsparse_int             block_dim,
+rocsparse_status rocsparse_dcsrfsai(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz_A,
+                                    const rocsparse_mat_descr descr_A,
+                                    const double*             csr_val_A,
+                                    const rocsparse_int*      csr_row_ptr_A,
+                                    const rocsparse_int*      csr_col_ind_A,
+                                    rocsparse_int             nnz_S,
+                                    const rocsparse_mat_descr descr_S,
+                                    const rocsparse_int*      csr_row_ptr_S,
+                                    const rocsparse_int*      csr_col_ind_S,
                                     rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
+                                    const rocsparse_mat_descr descr_G,
+                                    double*                   csr_val_G,
+                                    const rocsparse_int*      csr_row_ptr_G,
+                                    rocsparse_int*            csr_col_ind_G,
                                     void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrfsai(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  nnz_A,
+                                    const rocsparse_mat_descr      descr_A,
+                                    const rocsparse_float_complex* csr_val_A,
+                                    const rocsparse_int*           csr_row_ptr_A,
+                                    const rocsparse_int*           csr_col_ind_A,
+                                    rocsparse_int                  nnz_S,
+                                    const rocsparse_mat_descr      descr_S,
+                                    const rocsparse_int*           csr_row_ptr_S,
+                                    const rocsparse_int*           csr_col_ind_S,
+                                    rocsparse_mat_info             info,
+                                    const rocsparse_mat_descr      descr_G,
+                                    rocsparse_float_complex*       csr_val_G,
+                                    const rocsparse_int*           csr_row_ptr_G,
+                                    rocsparse_int*                 csr_col_ind_G,
+                                    void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrfsai(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   nnz_A,
+                                    const rocsparse_mat_descr       descr_A,
+                                    const rocsparse_double_complex* csr_val_A,
+                                    const rocsparse_int*            csr_row_ptr_A,
+                                    const rocsparse_int*            csr_col_ind_A,
+                                    rocsparse_int                   nnz_S,
+                                    const rocsparse_mat_descr       descr_S,
+                                    const rocsparse_int*            csr_row_ptr_S,
+                                    const rocsparse_int*            csr_col_ind_S,
+                                    rocsparse_mat_info              info,
+                                    const rocsparse_mat_descr       descr_G,
+                                    rocsparse_double_complex*       csr_val_G,
+                                    const rocsparse_int*            csr_row_ptr_G,
+                                    rocsparse_int*                  csr_col_ind_G,
+                                    void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Chebyshev polynomial smoother using CSR storage format
 *
 *  \details
-*  \p rocsparse_csric_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
-*  structural or numerical zero has been found during rocsparse_scsric0() or
-*  rocsparse_dcsric0() computation. The first zero pivot \f$j\f$ at \f$A_{j,j}\f$
-*  is stored in \p position, using same index base as the CSR matrix.
-*
-*  \p position can be in host or device memory. If no zero pivot has been found,
-*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
-*
-*  \note \p rocsparse_csric0_zero_pivot is a blocking function. It might influence
-*  performance negatively.
+*  \p rocsparse_csrcheb_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_scsrcheb_estimate(), rocsparse_dcsrcheb_estimate(),
+*  rocsparse_ccsrcheb_estimate(), rocsparse_zcsrcheb_estimate(), rocsparse_scsrcheb(),
+*  rocsparse_dcsrcheb(), rocsparse_ccsrcheb() and rocsparse_zcsrcheb(). The temporary
+*  storage buffer must be allocated by the user.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
-*  @param[inout]
-*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix.
+*  @param[in]
+*  csr_val         array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the
+*                  sparse CSR matrix.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_scsrcheb_estimate(), rocsparse_dcsrcheb_estimate(),
+*                  rocsparse_ccsrcheb_estimate(), rocsparse_zcsrcheb_estimate(),
+*                  rocsparse_scsrcheb(), rocsparse_dcsrcheb(), rocsparse_ccsrcheb()
+*                  and rocsparse_zcsrcheb().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
-*              invalid.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind or \p buffer_size pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
+*  \retval     rocsparse_status_not_implemented
+*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csric0_zero_pivot(rocsparse_handle   handle,
-                                             rocsparse_mat_info info,
-                                             rocsparse_int*     position);
+rocsparse_status rocsparse_scsrcheb_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const float*              csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrcheb_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const double*             csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                size_t*                   buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrcheb_buffer_size(rocsparse_handle               handle,
+                                                rocsparse_int                  m,
+                                                rocsparse_int                  nnz,
+                                                const rocsparse_mat_descr      descr,
+                                                const rocsparse_float_complex* csr_val,
+                                                const rocsparse_int*           csr_row_ptr,
+                                                const rocsparse_int*           csr_col_ind,
+                                                size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrcheb_buffer_size(rocsparse_handle                handle,
+                                                rocsparse_int                   m,
+                                                rocsparse_int                   nnz,
+                                                const rocsparse_mat_descr       descr,
+                                                const rocsparse_double_complex* csr_val,
+                                                const rocsparse_int*            csr_row_ptr,
+                                                const rocsparse_int*            csr_col_ind,
+                                                size_t*                         buffer_size);
+/**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Largest eigenvalue estimate for the Chebyshev polynomial smoother
 *
 *  \details
-*  \p rocsparse_csric0_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
-*  rocsparse_scsric0() and rocsparse_dcsric0(). The temporary storage buffer must
-*  be allocated by the user. The size of the temporary storage buffer is identical to
-*  the size returned by rocsparse_scsrsv_buffer_size(), rocsparse_dcsrsv_buffer_size(),
-*  rocsparse_scsrilu0_buffer_size() and rocsparse_dcsrilu0_buffer_size() if the matrix
-*  sparsity pattern is identical. The user allocated buffer can thus be shared between
-*  subsequent calls to those functions.
+*  \p rocsparse_csrcheb_estimate estimates the largest eigenvalue of a sparse Hermitian
+*  positive definite \f$m \times m\f$ CSR matrix \f$A\f$ by \p iters steps of the
+*  power iteration
+*  \f[
+*    v_{k+1} = \frac{A v_k}{\|A v_k\|_2}, \quad
+*    \lambda_{max} \approx v_k^H A v_k.
+*  \f]
+*  The start vector is fixed, such that the estimate is deterministic. Each step is a
+*  single sparse matrix vector multiplication fused with the reduction of the Rayleigh
+*  quotient and of the norm, no synchronization with the host takes place between the
+*  steps.
+*
+*  The Rayleigh quotient approaches \f$\lambda_{max}\f$ from below. It is therefore
+*  common practice to enlarge the estimate by a small safety factor, e.g. 1.1, before
+*  it is passed to rocsparse_scsrcheb(), rocsparse_dcsrcheb(), rocsparse_ccsrcheb() or
+*  rocsparse_zcsrcheb(). A typical choice of the lower bound for smoothing is a fraction
+*  of the largest eigenvalue, e.g. \f$\lambda_{min} = \lambda_{max} / 30\f$.
+*
+*  \p rocsparse_csrcheb_estimate requires a user allocated temporary buffer. Its size
+*  is returned by rocsparse_scsrcheb_buffer_size(), rocsparse_dcsrcheb_buffer_size(),
+*  rocsparse_ccsrcheb_buffer_size() or rocsparse_zcsrcheb_buffer_size().
 *
+*  \note
+*  This function is blocking with respect to the host if the pointer mode is set to
+*  \ref rocsparse_pointer_mode_host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  m               number of rows and columns of the sparse CSR matrix.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  nnz             number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  descr           descriptor of the sparse CSR matrix.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
+*  csr_val         array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  csr_col_ind     array of \p nnz elements containing the column indices of the
+*                  sparse CSR matrix.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
+*  iters           number of power iteration steps.
 *  @param[out]
-*  info        structure that holds the information collected during the analysis step.
+*  lambda_max      estimate of the largest eigenvalue of \f$A\f$, the pointer can be on
+*                  host or device, depending on the pointer mode.
 *  @param[in]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
-*              rocsparse_scsric0() and rocsparse_dcsric0().
+*  temp_buffer     temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p iters is invalid.
 *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*              \p csr_col_ind, \p lambda_max or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_int             m,
-                                               rocsparse_int             nnz,
-                                               const rocsparse_mat_descr descr,
-                                               const float*              csr_val,
-                                               const rocsparse_int*      csr_row_ptr,
-                                               const rocsparse_int*      csr_col_ind,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
+rocsparse_status rocsparse_scsrcheb_estimate(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const float*              csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int             iters,
+                                             float*                    lambda_max,
+                                             void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsric0_buffer_size(rocsparse_handle          handle,
-                                               rocsparse_int             m,
-                                               rocsparse_int             nnz,
-                                               const rocsparse_mat_descr descr,
-                                               const double*             csr_val,
-                                               const rocsparse_int*      csr_row_ptr,
-                                               const rocsparse_int*      csr_col_ind,
-                                               rocsparse_mat_info        info,
-                                               size_t*                   buffer_size);
+rocsparse_status rocsparse_dcsrcheb_estimate(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const double*             csr_val,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int             iters,
+                                             double*                   lambda_max,
+                                             void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsric0_buffer_size(rocsparse_handle               handle,
-                                               rocsparse_int                  m,
-                                               rocsparse_int                  nnz,
-                                               const rocsparse_mat_descr      descr,
-                                               const rocsparse_float_complex* csr_val,
-                                               const rocsparse_int*           csr_row_ptr,
-                                               const rocsparse_int*           csr_col_ind,
-                                               rocsparse_mat_info             info,
-                                               size_t*                        buffer_size);
+rocsparse_status rocsparse_ccsrcheb_estimate(rocsparse_handle               handle,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  nnz,
+                                             const rocsparse_mat_descr      descr,
+                                             const rocsparse_float_complex* csr_val,
+                                             const rocsparse_int*           csr_row_ptr,
+                                             const rocsparse_int*           csr_col_ind,
+                                             rocsparse_int                  iters,
+                                             float*                         lambda_max,
+                                             void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsric0_buffer_size(rocsparse_handle                handle,
-                                               rocsparse_int                   m,
-                                               rocsparse_int                   nnz,
-                                               const rocsparse_mat_descr       descr,
-                                               const rocsparse_double_complex* csr_val,
-                                               const rocsparse_int*            csr_row_ptr,
-                                               const rocsparse_int*            csr_col_ind,
-                                               rocsparse_mat_info              info,
-                                               size_t*                         buffer_size);
+rocsparse_status rocsparse_zcsrcheb_estimate(rocsparse_handle                handle,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   nnz,
+                                             const rocsparse_mat_descr       descr,
+                                             const rocsparse_double_complex* csr_val,
+                                             const rocsparse_int*            csr_row_ptr,
+                                             const rocsparse_int*            csr_col_ind,
+                                             rocsparse_int                   iters,
+                                             double*                         lambda_max,
+                                             void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Chebyshev polynomial smoother using CSR storage format
 *
 *  \details
-*  \p rocsparse_csric0_analysis performs the analysis step for rocsparse_scsric0()
-*  and rocsparse_dcsric0(). It is expected that this function will be executed only
-*  once for a given matrix and particular operation type. The analysis meta data can be
-*  cleared by rocsparse_csric0_clear().
+*  \p rocsparse_csrcheb applies \p degree steps of the Chebyshev iteration to the
+*  linear system \f$A x = b\f$, where \f$A\f$ is a sparse Hermitian positive
+*  definite \f$m \times m\f$ CSR matrix with eigenvalues in
+*  \f$[\lambda_{min}, \lambda_{max}]\f$. The vector \f$x\f$ holds the initial guess
+*  on input and is overwritten by
+*  \f[
+*    x := x + p(A) (b - A x),
+*  \f]
+*  where \f$p\f$ is the polynomial of degree \p degree - 1 that minimizes the error
+*  on the given interval. With \f$\theta = (\lambda_{max} + \lambda_{min}) / 2\f$,
+*  \f$\delta = (\lambda_{max} - \lambda_{min}) / 2\f$ and
+*  \f$\sigma = \theta / \delta\f$, the iteration reads
+*  \f[
+*    \begin{array}{ll}
+*      r_0 = b - A x_0, & d_0 = r_0 / \theta, \quad \rho_0 = 1 / \sigma, \\
+*      x_{k+1} = x_k + d_k, & r_{k+1} = r_k - A d_k, \\
+*      \rho_{k+1} = 1 / (2 \sigma - \rho_k), &
+*      d_{k+1} = \rho_{k+1} \rho_k d_k + 2 \rho_{k+1} / \delta \, r_{k+1}.
+*    \end{array}
+*  \f]
+*  Each sparse matrix vector multiplication is fused with the updates of \f$x\f$,
+*  \f$r\f$ and \f$d\f$, such that the vectors are streamed once per step. Thus,
+*  \p degree steps require \p degree sparse matrix vector multiplications.
 *
-*  \p rocsparse_csric0_analysis can share its meta data with
-*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
-*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
-*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
-*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
-*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
-*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
-*  performance of meta data. However, the user need to make sure that the sparsity
-*  pattern remains unchanged. If this cannot be assured,
-*  \ref rocsparse_analysis_policy_force has to be used.
+*  Bounds of the spectrum can be obtained by rocsparse_scsrcheb_estimate(),
+*  rocsparse_dcsrcheb_estimate(), rocsparse_ccsrcheb_estimate() or
+*  rocsparse_zcsrcheb_estimate().
+*
+*  \p rocsparse_csrcheb requires a user allocated temporary buffer. Its size is
+*  returned by rocsparse_scsrcheb_buffer_size(), rocsparse_dcsrcheb_buffer_size(),
+*  rocsparse_ccsrcheb_buffer_size() or rocsparse_zcsrcheb_buffer_size().
 *
 *  \note
-*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*  The vectors \p b and \p x must not overlap.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m               number of rows and columns of the sparse CSR matrix.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  nnz             number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
+*  descr           descriptor of the sparse CSR matrix.
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  csr_val         array of \p nnz elements of the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of the
+*                  sparse CSR matrix.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
-*  @param[out]
-*  info        structure that holds the information collected during
-*              the analysis step.
+*  csr_col_ind     array of \p nnz elements containing the column indices of the
+*                  sparse CSR matrix.
 *  @param[in]
-*  analysis    \ref rocsparse_analysis_policy_reuse or
-*              \ref rocsparse_analysis_policy_force.
+*  degree          number of Chebyshev steps.
 *  @param[in]
-*  solve       \ref rocsparse_solve_policy_auto.
+*  lambda_min      lower bound of the spectrum of \f$A\f$.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  lambda_max      upper bound of the spectrum of \f$A\f$.
+*  @param[in]
+*  b               array of \p m elements containing the right-hand side.
+*  @param[inout]
+*  x               array of \p m elements containing the initial guess on input and the
+*                  smoothed solution on output.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p nnz or \p degree is invalid.
+*  \retval     rocsparse_status_invalid_value \p lambda_min is not positive or
+*              \p lambda_max is not larger than \p lambda_min.
 *  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*              \p csr_col_ind, \p b, \p x or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
 *              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsric0_analysis(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             nnz,
-                                            const rocsparse_mat_descr descr,
-                                            const float*              csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            const rocsparse_int*      csr_col_ind,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
+rocsparse_status rocsparse_scsrcheb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const float*              csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int             degree,
+                                    float                     lambda_min,
+                                    float                     lambda_max,
+                                    const float*              b,
+                                    float*                    x,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsric0_analysis(rocsparse_handle          handle,
-                                            rocsparse_int             m,
-                                            rocsparse_int             nnz,
-                                            const rocsparse_mat_descr descr,
-                                            const double*             csr_val,
-                                            const rocsparse_int*      csr_row_ptr,
-                                            const rocsparse_int*      csr_col_ind,
-                                            rocsparse_mat_info        info,
-                                            rocsparse_analysis_policy analysis,
-                                            rocsparse_solve_policy    solve,
-                                            void*                     temp_buffer);
+rocsparse_status rocsparse_dcsrcheb(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const double*             csr_val,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int             degree,
+                                    double                    lambda_min,
+                                    double                    lambda_max,
+                                    const double*             b,
+                                    double*                   x,
+                                    void*                     temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsric0_analysis(rocsparse_handle               handle,
-                                            rocsparse_int                  m,
-                                            rocsparse_int                  nnz,
-                                            const rocsparse_mat_descr      descr,
-                                            const rocsparse_float_complex* csr_val,
-                                            const rocsparse_int*           csr_row_ptr,
-                                            const rocsparse_int*           csr_col_ind,
-                                            rocsparse_mat_info             info,
-                                            rocsparse_analysis_policy      analysis,
-                                            rocsparse_solve_policy         solve,
-                                            void*                          temp_buffer);
+rocsparse_status rocsparse_ccsrcheb(rocsparse_handle               handle,
+                                    rocsparse_int                  m,
+                                    rocsparse_int                  nnz,
+                                    const rocsparse_mat_descr      descr,
+                                    const rocsparse_float_complex* csr_val,
+                                    const rocsparse_int*           csr_row_ptr,
+                                    const rocsparse_int*           csr_col_ind,
+                                    rocsparse_int                  degree,
+                                    float                          lambda_min,
+                                    float                          lambda_max,
+                                    const rocsparse_float_complex* b,
+                                    rocsparse_float_complex*       x,
+                                    void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrcheb(rocsparse_handle                handle,
+                                    rocsparse_int                   m,
+                                    rocsparse_int                   nnz,
+                                    const rocsparse_mat_descr       descr,
+                                    const rocsparse_double_complex* csr_val,
+                                    const rocsparse_int*            csr_row_ptr,
+                                    const rocsparse_int*            csr_col_ind,
+                                    rocsparse_int                   degree,
+                                    double                          lambda_min,
+                                    double                          lambda_max,
+                                    const rocsparse_double_complex* b,
+                                    rocsparse_double_complex*       x,
+                                    void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Multicolor reordering of a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_csrcolor_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_csrcolor(). The temporary storage buffer must be
+*  allocated by the user.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+*                  the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csrcolor().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind
+*              or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrcolor_buffer_size(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                rocsparse_int             nnz,
+                                                const rocsparse_mat_descr descr,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                size_t*                   buffer_size);
 
+/*! \ingroup precond_module
+*  \brief Multicolor reordering of a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_csrcolor computes a coloring of the adjacency graph of the sparse
+*  \f$m \times m\f$ matrix, such that no two rows \f$i \neq j\f$ with \f$a_{ij} \neq 0\f$
+*  or \f$a_{ji} \neq 0\f$ share the same color. Rows of the same color are mutually
+*  independent and can be processed concurrently, e.g. during the triangular solves of
+*  an incomplete factorization. If the matrix is symmetrically reordered by color, see
+*  rocsparse_scsrsympermute(), the lower and upper triangular parts have at most
+*  \p ncolors levels, which can be queried by rocsparse_csrsv_level_info().
+*
+*  The coloring is obtained with a Jones-Plassmann type algorithm, where each row is
+*  assigned a pseudo-random priority derived from its index. Subsequently, a fixed
+*  number of balancing rounds moves rows from colors holding more than
+*  \f$\lceil m / ncolors \rceil\f$ rows into colors holding less, as long as the
+*  coloring remains valid. The number of colors is not changed by the balancing, and
+*  the color classes are not guaranteed to be perfectly balanced. The result is
+*  deterministic.
+*
+*  Optionally, \p rocsparse_csrcolor returns the \p reordering permutation, that lists
+*  the rows of the matrix ordered by color, where rows of the same color keep their
+*  original order.
+*
+*  \p rocsparse_csrcolor requires extra temporary storage buffer that has to be allocated
+*  by the user. Storage buffer size can be determined by rocsparse_csrcolor_buffer_size().
+*
+*  \note
+*  The diagonal entries of the matrix are ignored. If the sparsity pattern of the matrix
+*  is not symmetric, its symmetrization \f$A + A^T\f$ is colored.
+*
+*  \note
+*  This function is blocking with respect to the host.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+*                  the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[out]
+*  ncolors         number of colors, i.e. the largest color plus one. Pointer can be
+*                  either in host or device memory.
+*  @param[out]
+*  coloring        array of \p m elements containing the color of each row, ranging from
+*                  0 to \p ncolors - 1.
+*  @param[out]
+*  reordering      array of \p m elements containing the rows ordered by color, can be
+*                  \p NULL if not required.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+*                  rocsparse_csrcolor_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+*              \p ncolors, \p coloring or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  \code{.c}
+*      // Obtain required buffer size
+*      size_t buffer_size;
+*      rocsparse_csrcolor_buffer_size(handle,
+*                                     m,
+*                                     nnz,
+*                                     descr,
+*                                     csr_row_ptr,
+*                                     csr_col_ind,
+*                                     &buffer_size);
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Compute coloring and reordering
+*      rocsparse_int ncolors;
+*      rocsparse_csrcolor(handle,
+*                         m,
+*                         nnz,
+*                         descr,
+*                         csr_row_ptr,
+*                         csr_col_ind,
+*                         &ncolors,
+*                         coloring,
+*                         reordering,
+*                         temp_buffer);
+*  \endcode
+*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsric0_analysis(rocsparse_handle                handle,
-                                            rocsparse_int                   m,
-                                            rocsparse_int                   nnz,
-                                            const rocsparse_mat_descr       descr,
-                                            const rocsparse_double_complex* csr_val,
-                                            const rocsparse_int*            csr_row_ptr,
-                                            const rocsparse_int*            csr_col_ind,
-                                            rocsparse_mat_info              info,
-                                            rocsparse_analysis_policy       analysis,
-                                            rocsparse_solve_policy          solve,
-                                            void*                           temp_buffer);
-/**@}*/
+rocsparse_status rocsparse_csrcolor(rocsparse_handle          handle,
+                                    rocsparse_int             m,
+                                    rocsparse_int             nnz,
+                                    const rocsparse_mat_descr descr,
+                                    const rocsparse_int*      csr_row_ptr,
+                                    const rocsparse_int*      csr_col_ind,
+                                    rocsparse_int*            ncolors,
+                                    rocsparse_int*            coloring,
+                                    rocsparse_int*            reordering,
+                                    void*                     temp_buffer);
 
 /*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Reverse Cuthill-McKee reordering of a sparse CSR matrix
 *
 *  \details
-*  \p rocsparse_csric0_clear deallocates all memory that was allocated by
-*  rocsparse_scsric0_analysis() or rocsparse_dcsric0_analysis(). This is especially
-*  useful, if memory is an issue and the analysis data is not required for further
-*  computation.
-*
-*  \note
-*  Calling \p rocsparse_csric0_clear is optional. All allocated resources will be
-*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
-*  rocsparse_destroy_mat_info().
+*  \p rocsparse_csrrcm_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_csrrcm(). The temporary storage buffer must be
+*  allocated by the user.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[inout]
-*  info        structure that holds the information collected during the analysis step.
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+*                  the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_csrrcm().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
-*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
-*              be deallocated.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind
+*              or \p buffer_size pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csric0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_csrrcm_buffer_size(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              size_t*                   buffer_size);
 
 /*! \ingroup precond_module
-*  \brief Incomplete Cholesky factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Reverse Cuthill-McKee reordering of a sparse CSR matrix
 *
 *  \details
-*  \p rocsparse_csric0 computes the incomplete Cholesky factorization with 0 fill-ins
-*  and no pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
-*  \f[
-*    A \approx LL^T
-*  \f]
+*  \p rocsparse_csrrcm computes a bandwidth reducing permutation \p perm of the
+*  sparse \f$m \times m\f$ matrix, using the reverse Cuthill-McKee algorithm. Each
+*  connected component of the adjacency graph of the matrix is ordered by a breadth
+*  first search, that starts at a pseudo-peripheral row obtained by the George-Liu
+*  algorithm. The neighbours of each row are visited in increasing degree, where ties
+*  are broken by the smaller row index. The resulting order is reversed.
 *
-*  \p rocsparse_csric0 requires a user allocated temporary buffer. Its size is returned
-*  by rocsparse_scsric0_buffer_size() or rocsparse_dcsric0_buffer_size(). Furthermore,
-*  analysis meta data is required. It can be obtained by rocsparse_scsric0_analysis()
-*  or rocsparse_dcsric0_analysis(). \p rocsparse_csric0 reports the first zero pivot
-*  (either numerical or structural zero). The zero pivot status can be obtained by
-*  calling rocsparse_csric0_zero_pivot().
+*  Entry \p perm[i] holds the row of the original matrix that becomes row \f$i\f$ of
+*  the reordered matrix. The reordered matrix \f$P \cdot A \cdot P^T\f$ can be obtained
+*  by rocsparse_scsrsympermute(), and its bandwidth and profile can be compared to the
+*  original matrix by rocsparse_csrbandwidth().
+*
+*  \p rocsparse_csrrcm requires extra temporary storage buffer that has to be allocated
+*  by the user. Storage buffer size can be determined by rocsparse_csrrcm_buffer_size().
 *
 *  \note
-*  The sparse CSR matrix has to be sorted. This can be achieved by calling
-*  rocsparse_csrsort().
+*  The diagonal entries of the matrix are ignored. The sparsity pattern of the matrix
+*  is expected to be symmetric, with sorted column indices within each row. For
+*  unsymmetric patterns, the reordering of \f$A + A^T\f$ should be computed instead.
 *
 *  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  This function is blocking with respect to the host.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
-*  @param[in]
-*  m           number of rows of the sparse CSR matrix.
-*  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  handle          handle to the rocsparse library context queue.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
-*  @param[inout]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  m               number of rows and columns of the sparse CSR matrix.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start
-*              of every row of the sparse CSR matrix.
+*  nnz             number of non-zero entries of the sparse CSR matrix.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+*                  the sparse CSR matrix.
 *  @param[in]
-*  policy      \ref rocsparse_solve_policy_auto.
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[out]
+*  perm            array of \p m elements containing the reverse Cuthill-McKee
+*                  permutation.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+*                  rocsparse_csrrcm_buffer_size().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
 *  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
-*              or \p csr_col_ind pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+*              \p perm or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 *  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*              \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 *
 *  \par Example
-*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
-*  storage format. The following example computes the incomplete Cholesky factorization
-*  \f$M \approx LL^T\f$ and solves the preconditioned system \f$My = x\f$.
 *  \code{.c}
-*      // Create rocSPARSE handle
-*      rocsparse_handle handle;
-*      rocsparse_create_handle(&handle);
-*
-*      // Create matrix descriptor for M
-*      rocsparse_mat_descr descr_M;
-*      rocsparse_create_mat_descr(&descr_M);
-*
-*      // Create matrix descriptor for L
-*      rocsparse_mat_descr descr_L;
-*      rocsparse_create_mat_descr(&descr_L);
-*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
-*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
-*
-*      // Create matrix descriptor for L'
-*      rocsparse_mat_descr descr_Lt;
-*      rocsparse_create_mat_descr(&descr_Lt);
-*      rocsparse_set_mat_fill_mode(descr_Lt, rocsparse_fill_mode_upper);
-*      rocsparse_set_mat_diag_type(descr_Lt, rocsparse_diag_type_non_unit);
-*
-*      // Create matrix info structure
-*      rocsparse_mat_info info;
-*      rocsparse_create_mat_info(&info);
-*
 *      // Obtain required buffer size
-*      size_t buffer_size_M;
-*      size_t buffer_size_L;
-*      size_t buffer_size_Lt;
-*      rocsparse_dcsric0_buffer_size(handle,
-*                                    m,
-*                                    nnz,
-*                                    descr_M,
-*                                    csr_val,
-*                                    csr_row_ptr,
-*                                    csr_col_ind,
-*                                    info,
-*                                    &buffer_size_M);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_none,
-*                                   m,
-*                                   nnz,
-*                                   descr_L,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_L);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_transpose,
+*      size_t buffer_size;
+*      rocsparse_csrrcm_buffer_size(handle,
 *                                   m,
 *                                   nnz,
-*                                   descr_Lt,
-*                                   csr_val,
+*                                   descr,
 *                                   csr_row_ptr,
 *                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_Lt);
-*
-*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_Lt));
+*                                   &buffer_size);
 *
 *      // Allocate temporary buffer
 *      void* temp_buffer;
 *      hipMalloc(&temp_buffer, buffer_size);
 *
-*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
-*      // computation performance
-*      rocsparse_dcsric0_analysis(handle,
-*                                 m,
-*                                 nnz,
-*                                 descr_M,
-*                                 csr_val,
-*                                 csr_row_ptr,
-*                                 csr_col_ind,
-*                                 info,
-*                                 rocsparse_analysis_policy_reuse,
-*                                 rocsparse_solve_policy_auto,
-*                                 temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_none,
-*                                m,
-*                                nnz,
-*                                descr_L,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_transpose,
-*                                m,
-*                                nnz,
-*                                descr_Lt,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
+*      // Compute reverse Cuthill-McKee permutation
+*      rocsparse_csrrcm(handle,
+*                       m,
+*                       nnz,
+*                       descr,
+*                       csr_row_ptr,
+*                       csr_col_ind,
+*                       perm,
+*                       temp_buffer);
+*  \endcode
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrrcm(rocsparse_handle          handle,
+                                  rocsparse_int             m,
+                                  rocsparse_int             nnz,
+                                  const rocsparse_mat_descr descr,
+                                  const rocsparse_int*      csr_row_ptr,
+                                  const rocsparse_int*      csr_col_ind,
+                                  rocsparse_int*            perm,
+                                  void*                     temp_buffer);
+
+/*! \ingroup precond_module
+*  \brief Bandwidth and profile of a sparse CSR matrix
 *
-*      // Check for zero pivot
-*      rocsparse_int position;
-*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
-*                                                                    info,
-*                                                                    &position))
-*      {
-*          printf("A has structural zero at A(%d,%d)\n", position, position);
-*      }
+*  \details
+*  \p rocsparse_csrbandwidth computes the bandwidth
+*  \f[
+*    \beta = \max_{a_{ij} \neq 0} |i - j|
+*  \f]
+*  and the profile
+*  \f[
+*    \pi = \sum_{i=0}^{m-1} \left(i - \min\left(i, \min_{a_{ij} \neq 0} j\right)\right)
+*  \f]
+*  of the sparse \f$m \times m\f$ matrix. Both quantities can be used to assess the
+*  quality of a bandwidth reducing reordering, such as rocsparse_csrrcm().
+*
+*  \note
+*  This function is blocking with respect to the host, if \p bandwidth and \p profile
+*  are host pointers.
 *
-*      // Compute incomplete Cholesky factorization M = LL'
-*      rocsparse_dcsric0(handle,
-*                        m,
-*                        nnz,
-*                        descr_M,
-*                        csr_val,
-*                        csr_row_ptr,
-*                        csr_col_ind,
-*                        info,
-*                        rocsparse_solve_policy_auto,
-*                        temp_buffer);
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+*                  the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[out]
+*  bandwidth       bandwidth of the matrix. Pointer can be either in host or device
+*                  memory.
+*  @param[out]
+*  profile         profile of the matrix. Pointer can be either in host or device
+*                  memory.
 *
-*      // Check for zero pivot
-*      if(rocsparse_status_zero_pivot == rocsparse_csric0_zero_pivot(handle,
-*                                                                    info,
-*                                                                    &position))
-*      {
-*          printf("L has structural and/or numerical zero at L(%d,%d)\n",
-*                 position,
-*                 position);
-*      }
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+*              \p bandwidth or \p profile pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrbandwidth(rocsparse_handle          handle,
+                                        rocsparse_int             m,
+                                        rocsparse_int             nnz,
+                                        const rocsparse_mat_descr descr,
+                                        const rocsparse_int*      csr_row_ptr,
+                                        const rocsparse_int*      csr_col_ind,
+                                        rocsparse_int*            bandwidth,
+                                        int64_t*                  profile);
+
+/*! \ingroup precond_module
+*  \brief Tridiagonal solver with pivoting
 *
-*      // Solve Lz = x
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_none,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_L,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             x,
-*                             z,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
+*  \details
+*  \p rocsparse_gtsv_buffer_size returns the size of the temporary storage buffer that is
+*  required by rocsparse_sgtsv(), rocsparse_dgtsv(), rocsparse_cgtsv() and
+*  rocsparse_zgtsv(). The temporary storage buffer must be allocated by the user.
 *
-*      // Solve L'y = z
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_transpose,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_Lt,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             z,
-*                             y,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
+*  @param[in]
+*  handle      handle to the rocsparse library context queue.
+*  @param[in]
+*  m           size of the tri-diagonal linear system.
+*  @param[in]
+*  n           number of columns in the dense matrix B.
+*  @param[in]
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
+*  @param[in]
+*  d           main diagonal of tri-diagonal system.
+*  @param[in]
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  @param[in]
+*  B           Dense matrix of size ( \p ldb, \p n ).
+*  @param[in]
+*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
+*  @param[out]
+*  buffer_size number of bytes of the temporary storage buffer required by
+*              rocsparse_sgtsv(), rocsparse_dgtsv(), rocsparse_cgtsv() and rocsparse_zgtsv().
 *
-*      // Clean up
-*      hipFree(temp_buffer);
-*      rocsparse_destroy_mat_info(info);
-*      rocsparse_destroy_mat_descr(descr_M);
-*      rocsparse_destroy_mat_descr(descr_L);
-*      rocsparse_destroy_mat_descr(descr_Lt);
-*      rocsparse_destroy_handle(handle);
-*  \endcode
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p B or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   float*                    csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_sgtsv_buffer_size(rocsparse_handle handle,
+                                             rocsparse_int    m,
+                                             rocsparse_int    n,
+                                             const float*     dl,
+                                             const float*     d,
+                                             const float*     du,
+                                             const float*     B,
+                                             rocsparse_int    ldb,
+                                             size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   double*                   csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_dgtsv_buffer_size(rocsparse_handle handle,
+                                             rocsparse_int    m,
+                                             rocsparse_int    n,
+                                             const double*    dl,
+                                             const double*    d,
+                                             const double*    du,
+                                             const double*    B,
+                                             rocsparse_int    ldb,
+                                             size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_float_complex*  csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_cgtsv_buffer_size(rocsparse_handle               handle,
+                                             rocsparse_int                  m,
+                                             rocsparse_int                  n,
+                                             const rocsparse_float_complex* dl,
+                                             const rocsparse_float_complex* d,
+                                             const rocsparse_float_complex* du,
+                                             const rocsparse_float_complex* B,
+                                             rocsparse_int                  ldb,
+                                             size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsric0(rocsparse_handle          handle,
-                                   rocsparse_int             m,
-                                   rocsparse_int             nnz,
-                                   const rocsparse_mat_descr descr,
-                                   rocsparse_double_complex* csr_val,
-                                   const rocsparse_int*      csr_row_ptr,
-                                   const rocsparse_int*      csr_col_ind,
-                                   rocsparse_mat_info        info,
-                                   rocsparse_solve_policy    policy,
-                                   void*                     temp_buffer);
+rocsparse_status rocsparse_zgtsv_buffer_size(rocsparse_handle                handle,
+                                             rocsparse_int                   m,
+                                             rocsparse_int                   n,
+                                             const rocsparse_double_complex* dl,
+                                             const rocsparse_double_complex* d,
+                                             const rocsparse_double_complex* du,
+                                             const rocsparse_double_complex* B,
+                                             rocsparse_int                   ldb,
+                                             size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Tridiagonal solver with pivoting
 *
 *  \details
-*  \p rocsparse_csrilu0_zero_pivot returns \ref rocsparse_status_zero_pivot, if either a
-*  structural or numerical zero has been found during rocsparse_scsrilu0(),
-*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() or rocsparse_zcsrilu0() computation. The
-*  first zero pivot \f$j\f$ at \f$A_{j,j}\f$ is stored in \p position, using same index
-*  base as the CSR matrix.
+*  \p rocsparse_gtsv solves a tridiagonal linear system for multiple right-hand sides using
+*  the SPIKE algorithm. The system is split into partitions of consecutive rows, which are
+*  factorized independently using Gaussian elimination with partial pivoting. The coupling
+*  between the partitions is resolved by a small reduced system, that is also solved with
+*  partial pivoting. In contrast to rocsparse_gtsv_no_pivot(), the matrix does not need to
+*  be diagonally dominant.
 *
-*  \p position can be in host or device memory. If no zero pivot has been found,
-*  \p position is set to -1 and \ref rocsparse_status_success is returned instead.
+*  \note
+*  Pivoting is restricted to the partitions and the reduced system. Each partition, i.e.
+*  each diagonal block of \p m / p consecutive rows, must be non-singular. This holds e.g.
+*  for matrices with positive definite hermitian part.
 *
-*  \note \p rocsparse_csrilu0_zero_pivot is a blocking function. It might influence
-*  performance negatively.
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
+*  m           size of the tri-diagonal linear system.
+*  @param[in]
+*  n           number of columns in the dense matrix B.
+*  @param[in]
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
+*  @param[in]
+*  d           main diagonal of tri-diagonal system.
+*  @param[in]
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
 *  @param[inout]
-*  position    pointer to zero pivot \f$j\f$, can be in host or device memory.
+*  B           Dense matrix of size ( \p ldb, \p n ).
+*  @param[in]
+*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
+*  @param[in]
+*  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info or \p position pointer is
-*              invalid.
-*  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_zero_pivot zero pivot has been found.
-*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_zero_pivot(rocsparse_handle   handle,
-                                              rocsparse_mat_info info,
-                                              rocsparse_int*     position);
-
-/*! \ingroup precond_module
- *  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR storage
- *  format
- *
- *  \details
- *  \p rocsparse_csrilu0_numeric_boost enables the user to replace a numerical value in
- *  an incomplete LU factorization. \p tol is used to determine whether a numerical value
- *  is replaced by \p boost_val, such that \f$A_{j,j} = \text{boost_val}\f$ if
- *  \f$\text{tol} \ge \left|A_{j,j}\right|\f$.
- *
- *  \note The boost value is enabled by setting \p enable_boost to 1 or disabled by
- *  setting \p enable_boost to 0.
- *
- *  \note \p tol and \p boost_val can be in host or device memory.
- *
- *  @param[in]
- *  handle          handle to the rocsparse library context queue.
- *  @param[in]
- *  info            structure that holds the information collected during the analysis step.
- *  @param[in]
- *  enable_boost    enable/disable numeric boost.
- *  @param[in]
- *  boost_tol       tolerance to determine whether a numerical value is replaced or not.
- *  @param[in]
- *  boost_val       boost value to replace a numerical value.
- *
- *  \retval     rocsparse_status_success the operation completed successfully.
- *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
- *  \retval     rocsparse_status_invalid_pointer \p info, \p tol or \p boost_val pointer
- *              is invalid.
- *  \retval     rocsparse_status_internal_error an internal error occurred.
- */
-/**@{*/
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const float*       boost_tol,
-                                                  const float*       boost_val);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_numeric_boost(rocsparse_handle   handle,
-                                                  rocsparse_mat_info info,
-                                                  int                enable_boost,
-                                                  const double*      boost_tol,
-                                                  const double*      boost_val);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0_numeric_boost(rocsparse_handle               handle,
-                                                  rocsparse_mat_info             info,
-                                                  int                            enable_boost,
-                                                  const float*                   boost_tol,
-                                                  const rocsparse_float_complex* boost_val);
-
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p B or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0_numeric_boost(rocsparse_handle                handle,
-                                                  rocsparse_mat_info              info,
-                                                  int                             enable_boost,
-                                                  const double*                   boost_tol,
-                                                  const rocsparse_double_complex* boost_val);
+rocsparse_status rocsparse_sgtsv(rocsparse_handle handle,
+                                 rocsparse_int    m,
+                                 rocsparse_int    n,
+                                 const float*     dl,
+                                 const float*     d,
+                                 const float*     du,
+                                 float*           B,
+                                 rocsparse_int    ldb,
+                                 void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgtsv(rocsparse_handle handle,
+                                 rocsparse_int    m,
+                                 rocsparse_int    n,
+                                 const double*    dl,
+                                 const double*    d,
+                                 const double*    du,
+                                 double*          B,
+                                 rocsparse_int    ldb,
+                                 void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv(rocsparse_handle               handle,
+                                 rocsparse_int                  m,
+                                 rocsparse_int                  n,
+                                 const rocsparse_float_complex* dl,
+                                 const rocsparse_float_complex* d,
+                                 const rocsparse_float_complex* du,
+                                 rocsparse_float_complex*       B,
+                                 rocsparse_int                  ldb,
+                                 void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgtsv(rocsparse_handle                handle,
+                                 rocsparse_int                   m,
+                                 rocsparse_int                   n,
+                                 const rocsparse_double_complex* dl,
+                                 const rocsparse_double_complex* d,
+                                 const rocsparse_double_complex* du,
+                                 rocsparse_double_complex*       B,
+                                 rocsparse_int                   ldb,
+                                 void*                           temp_buffer);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Tridiagonal solver (no pivoting)
 *
 *  \details
-*  \p rocsparse_csrilu0_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*  rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(), rocsparse_scsrilu0(),
-*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). The temporary
-*  storage buffer must be allocated by the user. The size of the temporary storage
-*  buffer is identical to the size returned by rocsparse_scsrsv_buffer_size(),
-*  rocsparse_dcsrsv_buffer_size(), rocsparse_ccsrsv_buffer_size() and
-*  rocsparse_zcsrsv_buffer_size() if the matrix sparsity pattern is identical. The user
-*  allocated buffer can thus be shared between subsequent calls to those functions.
+*  \p rocsparse_gtsv_no_pivot_buffer_size returns the size of the temporary storage buffer
+*  that is required by rocsparse_sgtsv_no_pivot(), rocsparse_dgtsv_no_pivot(),
+*  rocsparse_cgtsv_no_pivot() and rocsparse_zgtsv_no_pivot(). The temporary storage buffer
+*  must be allocated by the user.
 *
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  m           size of the tri-diagonal linear system.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  n           number of columns in the dense matrix B.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  d           main diagonal of tri-diagonal system.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
-*  @param[out]
-*  info        structure that holds the information collected during the analysis step.
+*  B           Dense matrix of size ( \p ldb, \p n ).
 *  @param[in]
+*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
+*  @param[out]
 *  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*              rocsparse_ccsrilu0_analysis(), rocsparse_zcsrilu0_analysis(),
-*              rocsparse_scsrilu0(), rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and
-*              rocsparse_zcsrilu0().
+*              rocsparse_sgtsv_no_pivot(), rocsparse_dgtsv_no_pivot(), rocsparse_cgtsv_no_pivot()
+*              and rocsparse_zgtsv_no_pivot().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p info or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p B or \p buffer_size pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const float*              csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
+rocsparse_status rocsparse_sgtsv_no_pivot_buffer_size(rocsparse_handle handle,
+                                                      rocsparse_int    m,
+                                                      rocsparse_int    n,
+                                                      const float*     dl,
+                                                      const float*     d,
+                                                      const float*     du,
+                                                      const float*     B,
+                                                      rocsparse_int    ldb,
+                                                      size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_buffer_size(rocsparse_handle          handle,
-                                                rocsparse_int             m,
-                                                rocsparse_int             nnz,
-                                                const rocsparse_mat_descr descr,
-                                                const double*             csr_val,
-                                                const rocsparse_int*      csr_row_ptr,
-                                                const rocsparse_int*      csr_col_ind,
-                                                rocsparse_mat_info        info,
-                                                size_t*                   buffer_size);
+rocsparse_status rocsparse_dgtsv_no_pivot_buffer_size(rocsparse_handle handle,
+                                                      rocsparse_int    m,
+                                                      rocsparse_int    n,
+                                                      const double*    dl,
+                                                      const double*    d,
+                                                      const double*    du,
+                                                      const double*    B,
+                                                      rocsparse_int    ldb,
+                                                      size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0_buffer_size(rocsparse_handle               handle,
-                                                rocsparse_int                  m,
-                                                rocsparse_int                  nnz,
-                                                const rocsparse_mat_descr      descr,
-                                                const rocsparse_float_complex* csr_val,
-                                                const rocsparse_int*           csr_row_ptr,
-                                                const rocsparse_int*           csr_col_ind,
-                                                rocsparse_mat_info             info,
-                                                size_t*                        buffer_size);
+rocsparse_status rocsparse_cgtsv_no_pivot_buffer_size(rocsparse_handle               handle,
+                                                      rocsparse_int                  m,
+                                                      rocsparse_int                  n,
+                                                      const rocsparse_float_complex* dl,
+                                                      const rocsparse_float_complex* d,
+                                                      const rocsparse_float_complex* du,
+                                                      const rocsparse_float_complex* B,
+                                                      rocsparse_int                  ldb,
+                                                      size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle                handle,
-                                                rocsparse_int                   m,
-                                                rocsparse_int                   nnz,
-                                                const rocsparse_mat_descr       descr,
-                                                const rocsparse_double_complex* csr_val,
-                                                const rocsparse_int*            csr_row_ptr,
-                                                const rocsparse_int*            csr_col_ind,
-                                                rocsparse_mat_info              info,
-                                                size_t*                         buffer_size);
+rocsparse_status rocsparse_zgtsv_no_pivot_buffer_size(rocsparse_handle                handle,
+                                                      rocsparse_int                   m,
+                                                      rocsparse_int                   n,
+                                                      const rocsparse_double_complex* dl,
+                                                      const rocsparse_double_complex* d,
+                                                      const rocsparse_double_complex* du,
+                                                      const rocsparse_double_complex* B,
+                                                      rocsparse_int                   ldb,
+                                                      size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Tridiagonal solver (no pivoting)
 *
 *  \details
-*  \p rocsparse_csrilu0_analysis performs the analysis step for rocsparse_scsrilu0(),
-*  rocsparse_dcsrilu0(), rocsparse_ccsrilu0() and rocsparse_zcsrilu0(). It is expected
-*  that this function will be executed only once for a given matrix and particular
-*  operation type. The analysis meta data can be cleared by rocsparse_csrilu0_clear().
-*
-*  \p rocsparse_csrilu0_analysis can share its meta data with
-*  rocsparse_scsric0_analysis(), rocsparse_dcsric0_analysis(),
-*  rocsparse_ccsric0_analysis(), rocsparse_zcsric0_analysis(),
-*  rocsparse_scsrsv_analysis(), rocsparse_dcsrsv_analysis(),
-*  rocsparse_ccsrsv_analysis(), rocsparse_zcsrsv_analysis(),
-*  rocsparse_scsrsm_analysis(), rocsparse_dcsrsm_analysis(),
-*  rocsparse_scsrsm_analysis() and rocsparse_dcsrsm_analysis(). Selecting
-*  \ref rocsparse_analysis_policy_reuse policy can greatly improve computation
-*  performance of meta data. However, the user need to make sure that the sparsity
-*  pattern remains unchanged. If this cannot be assured,
-*  \ref rocsparse_analysis_policy_force has to be used.
-*
-*  \note
-*  If the matrix sparsity pattern changes, the gathered information will become invalid.
+*  \p rocsparse_gtsv_no_pivot  solves a tridiagonal linear system for multiple right-hand sides
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
@@ -7618,579 +14137,889 @@ rocsparse_status rocsparse_zcsrilu0_buffer_size(rocsparse_handle
 *  @param[in]
 *  handle      handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
-*  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
-*  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
+*  m           size of the tri-diagonal linear system.
 *  @param[in]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  n           number of columns in the dense matrix B.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start of every row of the
-*              sparse CSR matrix.
+*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
-*  @param[out]
-*  info        structure that holds the information collected during
-*              the analysis step.
+*  d           main diagonal of tri-diagonal system.
 *  @param[in]
-*  analysis    \ref rocsparse_analysis_policy_reuse or
-*              \ref rocsparse_analysis_policy_force.
+*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  @param[inout]
+*  B           Dense matrix of size ( \p ldb, \p n ).
 *  @param[in]
-*  solve       \ref rocsparse_solve_policy_auto.
+*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
 *  @param[in]
 *  temp_buffer temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
-*              \p csr_col_ind, \p info or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p B or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_int             m,
-                                             rocsparse_int             nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const float*              csr_val,
-                                             const rocsparse_int*      csr_row_ptr,
-                                             const rocsparse_int*      csr_col_ind,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
+rocsparse_status rocsparse_sgtsv_no_pivot(rocsparse_handle handle,
+                                          rocsparse_int    m,
+                                          rocsparse_int    n,
+                                          const float*     dl,
+                                          const float*     d,
+                                          const float*     du,
+                                          float*           B,
+                                          rocsparse_int    ldb,
+                                          void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgtsv_no_pivot(rocsparse_handle handle,
+                                          rocsparse_int    m,
+                                          rocsparse_int    n,
+                                          const double*    dl,
+                                          const double*    d,
+                                          const double*    du,
+                                          double*          B,
+                                          rocsparse_int    ldb,
+                                          void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv_no_pivot(rocsparse_handle               handle,
+                                          rocsparse_int                  m,
+                                          rocsparse_int                  n,
+                                          const rocsparse_float_complex* dl,
+                                          const rocsparse_float_complex* d,
+                                          const rocsparse_float_complex* du,
+                                          rocsparse_float_complex*       B,
+                                          rocsparse_int                  ldb,
+                                          void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgtsv_no_pivot(rocsparse_handle                handle,
+                                          rocsparse_int                   m,
+                                          rocsparse_int                   n,
+                                          const rocsparse_double_complex* dl,
+                                          const rocsparse_double_complex* d,
+                                          const rocsparse_double_complex* du,
+                                          rocsparse_double_complex*       B,
+                                          rocsparse_int                   ldb,
+                                          void*                           temp_buffer);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Strided batch tridiagonal solver (no pivoting)
+*
+*  \details
+*  \p rocsparse_gtsv_no_pivot_strided_batch_buffer_size returns the size of the temporary
+*  storage buffer that is required by rocsparse_sgtsv_no_pivot_strided_batch(),
+*  rocsparse_dgtsv_no_pivot_strided_batch(), rocsparse_cgtsv_no_pivot_strided_batch() and
+*  rocsparse_zgtsv_no_pivot_strided_batch(). The temporary storage buffer must be allocated
+*  by the user.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  m            size of each tri-diagonal linear system.
+*  @param[in]
+*  dl           lower diagonals of the tri-diagonal systems. First entry of each system must
+*               be zero.
+*  @param[in]
+*  d            main diagonals of the tri-diagonal systems.
+*  @param[in]
+*  du           upper diagonals of the tri-diagonal systems. Last entry of each system must
+*               be zero.
+*  @param[in]
+*  x            Dense array of right-hand sides.
+*  @param[in]
+*  batch_count  number of systems to solve.
+*  @param[in]
+*  batch_stride number of elements that separate consecutive systems. Must satisfy
+*               \p batch_stride >= m.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer required by
+*               rocsparse_sgtsv_no_pivot_strided_batch(), rocsparse_dgtsv_no_pivot_strided_batch(),
+*               rocsparse_cgtsv_no_pivot_strided_batch() and
+*               rocsparse_zgtsv_no_pivot_strided_batch().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p x or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_sgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    const float*     dl,
+                                                                    const float*     d,
+                                                                    const float*     du,
+                                                                    const float*     x,
+                                                                    rocsparse_int    batch_count,
+                                                                    rocsparse_int    batch_stride,
+                                                                    size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0_analysis(rocsparse_handle          handle,
-                                             rocsparse_int             m,
-                                             rocsparse_int             nnz,
-                                             const rocsparse_mat_descr descr,
-                                             const double*             csr_val,
-                                             const rocsparse_int*      csr_row_ptr,
-                                             const rocsparse_int*      csr_col_ind,
-                                             rocsparse_mat_info        info,
-                                             rocsparse_analysis_policy analysis,
-                                             rocsparse_solve_policy    solve,
-                                             void*                     temp_buffer);
+rocsparse_status rocsparse_dgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    const double*    dl,
+                                                                    const double*    d,
+                                                                    const double*    du,
+                                                                    const double*    x,
+                                                                    rocsparse_int    batch_count,
+                                                                    rocsparse_int    batch_stride,
+                                                                    size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0_analysis(rocsparse_handle               handle,
-                                             rocsparse_int                  m,
-                                             rocsparse_int                  nnz,
-                                             const rocsparse_mat_descr      descr,
-                                             const rocsparse_float_complex* csr_val,
-                                             const rocsparse_int*           csr_row_ptr,
-                                             const rocsparse_int*           csr_col_ind,
-                                             rocsparse_mat_info             info,
-                                             rocsparse_analysis_policy      analysis,
-                                             rocsparse_solve_policy         solve,
-                                             void*                          temp_buffer);
+rocsparse_status
+    rocsparse_cgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle               handle,
+                                                       rocsparse_int                  m,
+                                                       const rocsparse_float_complex* dl,
+                                                       const rocsparse_float_complex* d,
+                                                       const rocsparse_float_complex* du,
+                                                       const rocsparse_float_complex* x,
+                                                       rocsparse_int                  batch_count,
+                                                       rocsparse_int                  batch_stride,
+                                                       size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0_analysis(rocsparse_handle                handle,
-                                             rocsparse_int                   m,
-                                             rocsparse_int                   nnz,
-                                             const rocsparse_mat_descr       descr,
-                                             const rocsparse_double_complex* csr_val,
-                                             const rocsparse_int*            csr_row_ptr,
-                                             const rocsparse_int*            csr_col_ind,
-                                             rocsparse_mat_info              info,
-                                             rocsparse_analysis_policy       analysis,
-                                             rocsparse_solve_policy          solve,
-                                             void*                           temp_buffer);
+rocsparse_status
+    rocsparse_zgtsv_no_pivot_strided_batch_buffer_size(rocsparse_handle                handle,
+                                                       rocsparse_int                   m,
+                                                       const rocsparse_double_complex* dl,
+                                                       const rocsparse_double_complex* d,
+                                                       const rocsparse_double_complex* du,
+                                                       const rocsparse_double_complex* x,
+                                                       rocsparse_int                   batch_count,
+                                                       rocsparse_int                   batch_stride,
+                                                       size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Strided batch tridiagonal solver (no pivoting)
 *
 *  \details
-*  \p rocsparse_csrilu0_clear deallocates all memory that was allocated by
-*  rocsparse_scsrilu0_analysis(), rocsparse_dcsrilu0_analysis(),
-*  rocsparse_ccsrilu0_analysis() or rocsparse_zcsrilu0_analysis(). This is especially
-*  useful, if memory is an issue and the analysis data is not required for further
-*  computation.
+*  \p rocsparse_gtsv_no_pivot_strided_batch solves a batch of independent tridiagonal linear
+*  systems. The entries of system \f$j\f$ start at position \f$j \cdot batch\_stride\f$ of
+*  \p dl, \p d, \p du and \p x. Systems with up to 512 rows are solved by one thread
+*  block each using parallel cyclic reduction in shared memory. Larger systems are solved
+*  by one thread each using the Thomas algorithm.
 *
 *  \note
-*  Calling \p rocsparse_csrilu0_clear is optional. All allocated resources will be
-*  cleared, when the opaque \ref rocsparse_mat_info struct is destroyed using
-*  rocsparse_destroy_mat_info().
+*  For many small systems, the interleaved layout of rocsparse_sgtsv_interleaved_batch()
+*  gives coalesced memory access and is usually faster.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  m            size of each tri-diagonal linear system.
+*  @param[in]
+*  dl           lower diagonals of the tri-diagonal systems. First entry of each system must
+*               be zero.
+*  @param[in]
+*  d            main diagonals of the tri-diagonal systems.
+*  @param[in]
+*  du           upper diagonals of the tri-diagonal systems. Last entry of each system must
+*               be zero.
 *  @param[inout]
-*  info        structure that holds the information collected during the analysis step.
+*  x            Dense array of right-hand sides, that is overwritten by the solutions.
+*  @param[in]
+*  batch_count  number of systems to solve.
+*  @param[in]
+*  batch_stride number of elements that separate consecutive systems. Must satisfy
+*               \p batch_stride >= m.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_pointer \p info pointer is invalid.
-*  \retval     rocsparse_status_memory_error the buffer holding the meta data could not
-*              be deallocated.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p x or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 */
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_csrilu0_clear(rocsparse_handle handle, rocsparse_mat_info info);
+rocsparse_status rocsparse_sgtsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                        rocsparse_int    m,
+                                                        const float*     dl,
+                                                        const float*     d,
+                                                        const float*     du,
+                                                        float*           x,
+                                                        rocsparse_int    batch_count,
+                                                        rocsparse_int    batch_stride,
+                                                        void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgtsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                        rocsparse_int    m,
+                                                        const double*    dl,
+                                                        const double*    d,
+                                                        const double*    du,
+                                                        double*          x,
+                                                        rocsparse_int    batch_count,
+                                                        rocsparse_int    batch_stride,
+                                                        void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv_no_pivot_strided_batch(rocsparse_handle               handle,
+                                                        rocsparse_int                  m,
+                                                        const rocsparse_float_complex* dl,
+                                                        const rocsparse_float_complex* d,
+                                                        const rocsparse_float_complex* du,
+                                                        rocsparse_float_complex*       x,
+                                                        rocsparse_int                  batch_count,
+                                                        rocsparse_int                  batch_stride,
+                                                        void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_zgtsv_no_pivot_strided_batch(rocsparse_handle                handle,
+                                           rocsparse_int                   m,
+                                           const rocsparse_double_complex* dl,
+                                           const rocsparse_double_complex* d,
+                                           const rocsparse_double_complex* du,
+                                           rocsparse_double_complex*       x,
+                                           rocsparse_int                   batch_count,
+                                           rocsparse_int                   batch_stride,
+                                           void*                           temp_buffer);
+/**@}*/
 
 /*! \ingroup precond_module
-*  \brief Incomplete LU factorization with 0 fill-ins and no pivoting using CSR
-*  storage format
+*  \brief Interleaved batch tridiagonal solver
 *
 *  \details
-*  \p rocsparse_csrilu0 computes the incomplete LU factorization with 0 fill-ins and no
-*  pivoting of a sparse \f$m \times m\f$ CSR matrix \f$A\f$, such that
-*  \f[
-*    A \approx LU
-*  \f]
-*
-*  \p rocsparse_csrilu0 requires a user allocated temporary buffer. Its size is returned
-*  by rocsparse_scsrilu0_buffer_size(), rocsparse_dcsrilu0_buffer_size(),
-*  rocsparse_ccsrilu0_buffer_size() or rocsparse_zcsrilu0_buffer_size(). Furthermore,
-*  analysis meta data is required. It can be obtained by rocsparse_scsrilu0_analysis(),
-*  rocsparse_dcsrilu0_analysis(), rocsparse_ccsrilu0_analysis() or
-*  rocsparse_zcsrilu0_analysis(). \p rocsparse_csrilu0 reports the first zero pivot
-*  (either numerical or structural zero). The zero pivot status can be obtained by
-*  calling rocsparse_csrilu0_zero_pivot().
-*
-*  \note
-*  The sparse CSR matrix has to be sorted. This can be achieved by calling
-*  rocsparse_csrsort().
-*
-*  \note
-*  This function is non blocking and executed asynchronously with respect to the host.
-*  It may return before the actual computation has finished.
+*  \p rocsparse_gtsv_interleaved_batch_buffer_size returns the size of the temporary storage
+*  buffer that is required by rocsparse_sgtsv_interleaved_batch(),
+*  rocsparse_dgtsv_interleaved_batch(), rocsparse_cgtsv_interleaved_batch() and
+*  rocsparse_zgtsv_interleaved_batch(). The temporary storage buffer must be allocated by
+*  the user.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  m           number of rows of the sparse CSR matrix.
+*  alg          algorithm to solve the systems, see \ref rocsparse_gtsv_interleaved_alg.
 *  @param[in]
-*  nnz         number of non-zero entries of the sparse CSR matrix.
+*  m            size of each tri-diagonal linear system.
 *  @param[in]
-*  descr       descriptor of the sparse CSR matrix.
-*  @param[inout]
-*  csr_val     array of \p nnz elements of the sparse CSR matrix.
+*  dl           lower diagonals of the tri-diagonal systems. First entry of each system must
+*               be zero.
 *  @param[in]
-*  csr_row_ptr array of \p m+1 elements that point to the start
-*              of every row of the sparse CSR matrix.
+*  d            main diagonals of the tri-diagonal systems.
 *  @param[in]
-*  csr_col_ind array of \p nnz elements containing the column indices of the sparse
-*              CSR matrix.
+*  du           upper diagonals of the tri-diagonal systems. Last entry of each system must
+*               be zero.
 *  @param[in]
-*  info        structure that holds the information collected during the analysis step.
+*  x            Dense array of right-hand sides.
 *  @param[in]
-*  policy      \ref rocsparse_solve_policy_auto.
+*  batch_count  number of systems to solve.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  batch_stride number of elements that separate consecutive entries of a system. Must
+*               satisfy \p batch_stride >= batch_count.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer required by
+*               rocsparse_sgtsv_interleaved_batch(), rocsparse_dgtsv_interleaved_batch(),
+*               rocsparse_cgtsv_interleaved_batch() and rocsparse_zgtsv_interleaved_batch().
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr
-*              or \p csr_col_ind pointer is invalid.
-*  \retval     rocsparse_status_arch_mismatch the device is not supported.
+*  \retval     rocsparse_status_invalid_value \p alg is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
+*              \p x or \p buffer_size pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
-*  \retval     rocsparse_status_not_implemented
-*              \p trans != \ref rocsparse_operation_none or
-*              \ref rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
-*
-*  \par Example
-*  Consider the sparse \f$m \times m\f$ matrix \f$A\f$, stored in CSR
-*  storage format. The following example computes the incomplete LU factorization
-*  \f$M \approx LU\f$ and solves the preconditioned system \f$My = x\f$.
-*  \code{.c}
-*      // Create rocSPARSE handle
-*      rocsparse_handle handle;
-*      rocsparse_create_handle(&handle);
-*
-*      // Create matrix descriptor for M
-*      rocsparse_mat_descr descr_M;
-*      rocsparse_create_mat_descr(&descr_M);
-*
-*      // Create matrix descriptor for L
-*      rocsparse_mat_descr descr_L;
-*      rocsparse_create_mat_descr(&descr_L);
-*      rocsparse_set_mat_fill_mode(descr_L, rocsparse_fill_mode_lower);
-*      rocsparse_set_mat_diag_type(descr_L, rocsparse_diag_type_unit);
-*
-*      // Create matrix descriptor for U
-*      rocsparse_mat_descr descr_U;
-*      rocsparse_create_mat_descr(&descr_U);
-*      rocsparse_set_mat_fill_mode(descr_U, rocsparse_fill_mode_upper);
-*      rocsparse_set_mat_diag_type(descr_U, rocsparse_diag_type_non_unit);
-*
-*      // Create matrix info structure
-*      rocsparse_mat_info info;
-*      rocsparse_create_mat_info(&info);
-*
-*      // Obtain required buffer size
-*      size_t buffer_size_M;
-*      size_t buffer_size_L;
-*      size_t buffer_size_U;
-*      rocsparse_dcsrilu0_buffer_size(handle,
-*                                    m,
-*                                    nnz,
-*                                    descr_M,
-*                                    csr_val,
-*                                    csr_row_ptr,
-*                                    csr_col_ind,
-*                                    info,
-*                                    &buffer_size_M);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_none,
-*                                   m,
-*                                   nnz,
-*                                   descr_L,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_L);
-*      rocsparse_dcsrsv_buffer_size(handle,
-*                                   rocsparse_operation_none,
-*                                   m,
-*                                   nnz,
-*                                   descr_U,
-*                                   csr_val,
-*                                   csr_row_ptr,
-*                                   csr_col_ind,
-*                                   info,
-*                                   &buffer_size_U);
-*
-*      size_t buffer_size = max(buffer_size_M, max(buffer_size_L, buffer_size_U));
-*
-*      // Allocate temporary buffer
-*      void* temp_buffer;
-*      hipMalloc(&temp_buffer, buffer_size);
-*
-*      // Perform analysis steps, using rocsparse_analysis_policy_reuse to improve
-*      // computation performance
-*      rocsparse_dcsrilu0_analysis(handle,
-*                                  m,
-*                                  nnz,
-*                                  descr_M,
-*                                  csr_val,
-*                                  csr_row_ptr,
-*                                  csr_col_ind,
-*                                  info,
-*                                  rocsparse_analysis_policy_reuse,
-*                                  rocsparse_solve_policy_auto,
-*                                  temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_none,
-*                                m,
-*                                nnz,
-*                                descr_L,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
-*      rocsparse_dcsrsv_analysis(handle,
-*                                rocsparse_operation_none,
-*                                m,
-*                                nnz,
-*                                descr_U,
-*                                csr_val,
-*                                csr_row_ptr,
-*                                csr_col_ind,
-*                                info,
-*                                rocsparse_analysis_policy_reuse,
-*                                rocsparse_solve_policy_auto,
-*                                temp_buffer);
-*
-*      // Check for zero pivot
-*      rocsparse_int position;
-*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
-*                                                                     info,
-*                                                                     &position))
-*      {
-*          printf("A has structural zero at A(%d,%d)\n", position, position);
-*      }
-*
-*      // Compute incomplete LU factorization
-*      rocsparse_dcsrilu0(handle,
-*                         m,
-*                         nnz,
-*                         descr_M,
-*                         csr_val,
-*                         csr_row_ptr,
-*                         csr_col_ind,
-*                         info,
-*                         rocsparse_solve_policy_auto,
-*                         temp_buffer);
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_sgtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const float*                   dl,
+                                                  const float*                   d,
+                                                  const float*                   du,
+                                                  const float*                   x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_dgtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const double*                  dl,
+                                                  const double*                  d,
+                                                  const double*                  du,
+                                                  const double*                  x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_cgtsv_interleaved_batch_buffer_size(rocsparse_handle               handle,
+                                                  rocsparse_gtsv_interleaved_alg alg,
+                                                  rocsparse_int                  m,
+                                                  const rocsparse_float_complex* dl,
+                                                  const rocsparse_float_complex* d,
+                                                  const rocsparse_float_complex* du,
+                                                  const rocsparse_float_complex* x,
+                                                  rocsparse_int                  batch_count,
+                                                  rocsparse_int                  batch_stride,
+                                                  size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status
+    rocsparse_zgtsv_interleaved_batch_buffer_size(rocsparse_handle                handle,
+                                                  rocsparse_gtsv_interleaved_alg  alg,
+                                                  rocsparse_int                   m,
+                                                  const rocsparse_double_complex* dl,
+                                                  const rocsparse_double_complex* d,
+                                                  const rocsparse_double_complex* du,
+                                                  const rocsparse_double_complex* x,
+                                                  rocsparse_int                   batch_count,
+                                                  rocsparse_int                   batch_stride,
+                                                  size_t*                         buffer_size);
+/**@}*/
+
+/*! \ingroup precond_module
+*  \brief Interleaved batch tridiagonal solver
 *
-*      // Check for zero pivot
-*      if(rocsparse_status_zero_pivot == rocsparse_csrilu0_zero_pivot(handle,
-*                                                                     info,
-*                                                                     &position))
-*      {
-*          printf("U has structural and/or numerical zero at U(%d,%d)\n",
-*                 position,
-*                 position);
-*      }
+*  \details
+*  \p rocsparse_gtsv_interleaved_batch solves a batch of independent tridiagonal linear
+*  systems, that are stored in interleaved layout, i.e. entry \f$i\f$ of system \f$j\f$ is
+*  stored at position \f$i \cdot batch\_stride + j\f$ of \p dl, \p d, \p du and \p x.
+*  Each system is solved by a single thread, such that consecutive threads access
+*  consecutive memory locations. The systems are solved either by the Thomas algorithm
+*  without pivoting, or by LU factorization with partial pivoting.
 *
-*      // Solve Lz = x
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_none,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_L,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             x,
-*                             z,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
-*      // Solve Uy = z
-*      rocsparse_dcsrsv_solve(handle,
-*                             rocsparse_operation_none,
-*                             m,
-*                             nnz,
-*                             &alpha,
-*                             descr_U,
-*                             csr_val,
-*                             csr_row_ptr,
-*                             csr_col_ind,
-*                             info,
-*                             z,
-*                             y,
-*                             rocsparse_solve_policy_auto,
-*                             temp_buffer);
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  alg          algorithm to solve the systems, see \ref rocsparse_gtsv_interleaved_alg.
+*  @param[in]
+*  m            size of each tri-diagonal linear system.
+*  @param[in]
+*  dl           lower diagonals of the tri-diagonal systems. First entry of each system must
+*               be zero.
+*  @param[in]
+*  d            main diagonals of the tri-diagonal systems.
+*  @param[in]
+*  du           upper diagonals of the tri-diagonal systems. Last entry of each system must
+*               be zero.
+*  @param[inout]
+*  x            Dense array of right-hand sides, that is overwritten by the solutions.
+*  @param[in]
+*  batch_count  number of systems to solve.
+*  @param[in]
+*  batch_stride number of elements that separate consecutive entries of a system. Must
+*               satisfy \p batch_stride >= batch_count.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user.
 *
-*      // Clean up
-*      hipFree(temp_buffer);
-*      rocsparse_destroy_mat_info(info);
-*      rocsparse_destroy_mat_descr(descr_M);
-*      rocsparse_destroy_mat_descr(descr_L);
-*      rocsparse_destroy_mat_descr(descr_U);
-*      rocsparse_destroy_handle(handle);
-*  \endcode
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_value \p alg is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
+*              \p du, \p x or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_scsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    float*                    csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_sgtsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gtsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   const float*                   dl,
+                                                   const float*                   d,
+                                                   const float*                   du,
+                                                   float*                         x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgtsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gtsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   const double*                  dl,
+                                                   const double*                  d,
+                                                   const double*                  du,
+                                                   double*                        x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgtsv_interleaved_batch(rocsparse_handle               handle,
+                                                   rocsparse_gtsv_interleaved_alg alg,
+                                                   rocsparse_int                  m,
+                                                   const rocsparse_float_complex* dl,
+                                                   const rocsparse_float_complex* d,
+                                                   const rocsparse_float_complex* du,
+                                                   rocsparse_float_complex*       x,
+                                                   rocsparse_int                  batch_count,
+                                                   rocsparse_int                  batch_stride,
+                                                   void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgtsv_interleaved_batch(rocsparse_handle                handle,
+                                                   rocsparse_gtsv_interleaved_alg  alg,
+                                                   rocsparse_int                   m,
+                                                   const rocsparse_double_complex* dl,
+                                                   const rocsparse_double_complex* d,
+                                                   const rocsparse_double_complex* du,
+                                                   rocsparse_double_complex*       x,
+                                                   rocsparse_int                   batch_count,
+                                                   rocsparse_int                   batch_stride,
+                                                   void*                           temp_buffer);
+/**@}*/
 
+/*! \ingroup precond_module
+*  \brief Strided batch pentadiagonal solver (no pivoting)
+*
+*  \details
+*  \p rocsparse_gpsv_no_pivot_strided_batch_buffer_size returns the size of the temporary
+*  storage buffer that is required by rocsparse_sgpsv_no_pivot_strided_batch(),
+*  rocsparse_dgpsv_no_pivot_strided_batch(), rocsparse_cgpsv_no_pivot_strided_batch() and
+*  rocsparse_zgpsv_no_pivot_strided_batch(). The temporary storage buffer must be allocated
+*  by the user.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  m            size of each penta-diagonal linear system.
+*  @param[in]
+*  ds           second lower diagonals of the penta-diagonal systems. First two entries of
+*               each system must be zero.
+*  @param[in]
+*  dl           lower diagonals of the penta-diagonal systems. First entry of each system
+*               must be zero.
+*  @param[in]
+*  d            main diagonals of the penta-diagonal systems.
+*  @param[in]
+*  du           upper diagonals of the penta-diagonal systems. Last entry of each system
+*               must be zero.
+*  @param[in]
+*  dw           second upper diagonals of the penta-diagonal systems. Last two entries of
+*               each system must be zero.
+*  @param[in]
+*  x            Dense array of right-hand sides.
+*  @param[in]
+*  batch_count  number of systems to solve.
+*  @param[in]
+*  batch_stride number of elements that separate consecutive systems. Must satisfy
+*               \p batch_stride >= m.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer required by
+*               rocsparse_sgpsv_no_pivot_strided_batch(),
+*               rocsparse_dgpsv_no_pivot_strided_batch(),
+*               rocsparse_cgpsv_no_pivot_strided_batch() and
+*               rocsparse_zgpsv_no_pivot_strided_batch().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p ds, \p dl, \p d, \p du, \p dw,
+*              \p x or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dcsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    double*                   csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status rocsparse_sgpsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    const float*     ds,
+                                                                    const float*     dl,
+                                                                    const float*     d,
+                                                                    const float*     du,
+                                                                    const float*     dw,
+                                                                    const float*     x,
+                                                                    rocsparse_int    batch_count,
+                                                                    rocsparse_int    batch_stride,
+                                                                    size_t*          buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgpsv_no_pivot_strided_batch_buffer_size(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    const double*    ds,
+                                                                    const double*    dl,
+                                                                    const double*    d,
+                                                                    const double*    du,
+                                                                    const double*    dw,
+                                                                    const double*    x,
+                                                                    rocsparse_int    batch_count,
+                                                                    rocsparse_int    batch_stride,
+                                                                    size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_ccsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_float_complex*  csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status
+    rocsparse_cgpsv_no_pivot_strided_batch_buffer_size(rocsparse_handle               handle,
+                                                       rocsparse_int                  m,
+                                                       const rocsparse_float_complex* ds,
+                                                       const rocsparse_float_complex* dl,
+                                                       const rocsparse_float_complex* d,
+                                                       const rocsparse_float_complex* du,
+                                                       const rocsparse_float_complex* dw,
+                                                       const rocsparse_float_complex* x,
+                                                       rocsparse_int                  batch_count,
+                                                       rocsparse_int                  batch_stride,
+                                                       size_t*                        buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zcsrilu0(rocsparse_handle          handle,
-                                    rocsparse_int             m,
-                                    rocsparse_int             nnz,
-                                    const rocsparse_mat_descr descr,
-                                    rocsparse_double_complex* csr_val,
-                                    const rocsparse_int*      csr_row_ptr,
-                                    const rocsparse_int*      csr_col_ind,
-                                    rocsparse_mat_info        info,
-                                    rocsparse_solve_policy    policy,
-                                    void*                     temp_buffer);
+rocsparse_status
+    rocsparse_zgpsv_no_pivot_strided_batch_buffer_size(rocsparse_handle                handle,
+                                                       rocsparse_int                   m,
+                                                       const rocsparse_double_complex* ds,
+                                                       const rocsparse_double_complex* dl,
+                                                       const rocsparse_double_complex* d,
+                                                       const rocsparse_double_complex* du,
+                                                       const rocsparse_double_complex* dw,
+                                                       const rocsparse_double_complex* x,
+                                                       rocsparse_int                   batch_count,
+                                                       rocsparse_int                   batch_stride,
+                                                       size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Tridiagonal solver (no pivoting)
+*  \brief Strided batch pentadiagonal solver (no pivoting)
 *
 *  \details
-*  \p rocsparse_gtsv_no_pivot_buffer_size returns the size of the temporary storage buffer
-*  that is required by rocsparse_sgtsv_no_pivot(), rocsparse_dgtsv_no_pivot(),
-*  rocsparse_cgtsv_no_pivot() and rocsparse_zgtsv_no_pivot(). The temporary storage buffer
-*  must be allocated by the user.
+*  \p rocsparse_gpsv_no_pivot_strided_batch solves a batch of independent penta-diagonal
+*  linear systems using Gaussian elimination without pivoting. The entries of system \f$j\f$
+*  start at position \f$j \cdot batch\_stride\f$ of \p ds, \p dl, \p d, \p du, \p dw and
+*  \p x. Each system is solved by one thread, such that millions of small systems can be
+*  solved in a single launch.
+*
+*  \note
+*  No pivoting is performed, the systems should be diagonally dominant.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle       handle to the rocsparse library context queue.
 *  @param[in]
-*  m           size of the tri-diagonal linear system.
+*  m            size of each penta-diagonal linear system.
 *  @param[in]
-*  n           number of columns in the dense matrix B.
+*  ds           second lower diagonals of the penta-diagonal systems. First two entries of
+*               each system must be zero.
 *  @param[in]
-*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
+*  dl           lower diagonals of the penta-diagonal systems. First entry of each system
+*               must be zero.
 *  @param[in]
-*  d           main diagonal of tri-diagonal system.
+*  d            main diagonals of the penta-diagonal systems.
 *  @param[in]
-*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  du           upper diagonals of the penta-diagonal systems. Last entry of each system
+*               must be zero.
 *  @param[in]
-*  B           Dense matrix of size ( \p ldb, \p n ).
+*  dw           second upper diagonals of the penta-diagonal systems. Last two entries of
+*               each system must be zero.
+*  @param[inout]
+*  x            Dense array of right-hand sides, that is overwritten by the solutions.
 *  @param[in]
-*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
-*  @param[out]
-*  buffer_size number of bytes of the temporary storage buffer required by
-*              rocsparse_sgtsv_no_pivot(), rocsparse_dgtsv_no_pivot(), rocsparse_cgtsv_no_pivot()
-*              and rocsparse_zgtsv_no_pivot().
+*  batch_count  number of systems to solve.
+*  @param[in]
+*  batch_stride number of elements that separate consecutive systems. Must satisfy
+*               \p batch_stride >= m.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p dl, \p d, \p du,
-*              \p B or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p ds, \p dl, \p d, \p du, \p dw,
+*              \p x or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgtsv_no_pivot_buffer_size(rocsparse_handle handle,
-                                                      rocsparse_int    m,
-                                                      rocsparse_int    n,
-                                                      const float*     dl,
-                                                      const float*     d,
-                                                      const float*     du,
-                                                      const float*     B,
-                                                      rocsparse_int    ldb,
-                                                      size_t*          buffer_size);
+rocsparse_status rocsparse_sgpsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                        rocsparse_int    m,
+                                                        const float*     ds,
+                                                        const float*     dl,
+                                                        const float*     d,
+                                                        const float*     du,
+                                                        const float*     dw,
+                                                        float*           x,
+                                                        rocsparse_int    batch_count,
+                                                        rocsparse_int    batch_stride,
+                                                        void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgpsv_no_pivot_strided_batch(rocsparse_handle handle,
+                                                        rocsparse_int    m,
+                                                        const double*    ds,
+                                                        const double*    dl,
+                                                        const double*    d,
+                                                        const double*    du,
+                                                        const double*    dw,
+                                                        double*          x,
+                                                        rocsparse_int    batch_count,
+                                                        rocsparse_int    batch_stride,
+                                                        void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgpsv_no_pivot_strided_batch(rocsparse_handle               handle,
+                                                        rocsparse_int                  m,
+                                                        const rocsparse_float_complex* ds,
+                                                        const rocsparse_float_complex* dl,
+                                                        const rocsparse_float_complex* d,
+                                                        const rocsparse_float_complex* du,
+                                                        const rocsparse_float_complex* dw,
+                                                        rocsparse_float_complex*       x,
+                                                        rocsparse_int                  batch_count,
+                                                        rocsparse_int                  batch_stride,
+                                                        void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgtsv_no_pivot_buffer_size(rocsparse_handle handle,
-                                                      rocsparse_int    m,
-                                                      rocsparse_int    n,
-                                                      const double*    dl,
-                                                      const double*    d,
-                                                      const double*    du,
-                                                      const double*    B,
-                                                      rocsparse_int    ldb,
-                                                      size_t*          buffer_size);
+rocsparse_status
+    rocsparse_zgpsv_no_pivot_strided_batch(rocsparse_handle                handle,
+                                           rocsparse_int                   m,
+                                           const rocsparse_double_complex* ds,
+                                           const rocsparse_double_complex* dl,
+                                           const rocsparse_double_complex* d,
+                                           const rocsparse_double_complex* du,
+                                           const rocsparse_double_complex* dw,
+                                           rocsparse_double_complex*       x,
+                                           rocsparse_int                   batch_count,
+                                           rocsparse_int                   batch_stride,
+                                           void*                           temp_buffer);
+/**@}*/
 
+/*! \ingroup precond_module
+*  \brief Interleaved batch pentadiagonal solver (no pivoting)
+*
+*  \details
+*  \p rocsparse_gpsv_no_pivot_interleaved_batch_buffer_size returns the size of the
+*  temporary storage buffer that is required by
+*  rocsparse_sgpsv_no_pivot_interleaved_batch(),
+*  rocsparse_dgpsv_no_pivot_interleaved_batch(),
+*  rocsparse_cgpsv_no_pivot_interleaved_batch() and
+*  rocsparse_zgpsv_no_pivot_interleaved_batch(). The temporary storage buffer must be
+*  allocated by the user.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  m            size of each penta-diagonal linear system.
+*  @param[in]
+*  ds           second lower diagonals of the penta-diagonal systems. First two entries of
+*               each system must be zero.
+*  @param[in]
+*  dl           lower diagonals of the penta-diagonal systems. First entry of each system
+*               must be zero.
+*  @param[in]
+*  d            main diagonals of the penta-diagonal systems.
+*  @param[in]
+*  du           upper diagonals of the penta-diagonal systems. Last entry of each system
+*               must be zero.
+*  @param[in]
+*  dw           second upper diagonals of the penta-diagonal systems. Last two entries of
+*               each system must be zero.
+*  @param[in]
+*  x            Dense array of right-hand sides.
+*  @param[in]
+*  batch_count  number of systems to solve.
+*  @param[in]
+*  batch_stride number of elements that separate consecutive entries of a system. Must
+*               satisfy \p batch_stride >= batch_count.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer required by
+*               rocsparse_sgpsv_no_pivot_interleaved_batch(),
+*               rocsparse_dgpsv_no_pivot_interleaved_batch(),
+*               rocsparse_cgpsv_no_pivot_interleaved_batch() and
+*               rocsparse_zgpsv_no_pivot_interleaved_batch().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p ds, \p dl, \p d, \p du, \p dw,
+*              \p x or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*/
+/**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgtsv_no_pivot_buffer_size(rocsparse_handle               handle,
-                                                      rocsparse_int                  m,
-                                                      rocsparse_int                  n,
-                                                      const rocsparse_float_complex* dl,
-                                                      const rocsparse_float_complex* d,
-                                                      const rocsparse_float_complex* du,
-                                                      const rocsparse_float_complex* B,
-                                                      rocsparse_int                  ldb,
-                                                      size_t*                        buffer_size);
+rocsparse_status
+    rocsparse_sgpsv_no_pivot_interleaved_batch_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           const float*     ds,
+                                                           const float*     dl,
+                                                           const float*     d,
+                                                           const float*     du,
+                                                           const float*     dw,
+                                                           const float*     x,
+                                                           rocsparse_int    batch_count,
+                                                           rocsparse_int    batch_stride,
+                                                           size_t*          buffer_size);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgtsv_no_pivot_buffer_size(rocsparse_handle                handle,
-                                                      rocsparse_int                   m,
-                                                      rocsparse_int                   n,
-                                                      const rocsparse_double_complex* dl,
-                                                      const rocsparse_double_complex* d,
-                                                      const rocsparse_double_complex* du,
-                                                      const rocsparse_double_complex* B,
-                                                      rocsparse_int                   ldb,
-                                                      size_t*                         buffer_size);
+rocsparse_status
+    rocsparse_dgpsv_no_pivot_interleaved_batch_buffer_size(rocsparse_handle handle,
+                                                           rocsparse_int    m,
+                                                           const double*    ds,
+                                                           const double*    dl,
+                                                           const double*    d,
+                                                           const double*    du,
+                                                           const double*    dw,
+                                                           const double*    x,
+                                                           rocsparse_int    batch_count,
+                                                           rocsparse_int    batch_stride,
+                                                           size_t*          buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_cgpsv_no_pivot_interleaved_batch_buffer_size(
+    rocsparse_handle               handle,
+    rocsparse_int                  m,
+    const rocsparse_float_complex* ds,
+    const rocsparse_float_complex* dl,
+    const rocsparse_float_complex* d,
+    const rocsparse_float_complex* du,
+    const rocsparse_float_complex* dw,
+    const rocsparse_float_complex* x,
+    rocsparse_int                  batch_count,
+    rocsparse_int                  batch_stride,
+    size_t*                        buffer_size);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zgpsv_no_pivot_interleaved_batch_buffer_size(
+    rocsparse_handle                handle,
+    rocsparse_int                   m,
+    const rocsparse_double_complex* ds,
+    const rocsparse_double_complex* dl,
+    const rocsparse_double_complex* d,
+    const rocsparse_double_complex* du,
+    const rocsparse_double_complex* dw,
+    const rocsparse_double_complex* x,
+    rocsparse_int                   batch_count,
+    rocsparse_int                   batch_stride,
+    size_t*                         buffer_size);
 /**@}*/
 
 /*! \ingroup precond_module
-*  \brief Tridiagonal solver (no pivoting)
+*  \brief Interleaved batch pentadiagonal solver (no pivoting)
 *
 *  \details
-*  \p rocsparse_gtsv_no_pivot  solves a tridiagonal linear system for multiple right-hand sides
+*  \p rocsparse_gpsv_no_pivot_interleaved_batch solves a batch of independent penta-diagonal
+*  linear systems using Gaussian elimination without pivoting. Entry \f$i\f$ of system
+*  \f$j\f$ is stored at position \f$i \cdot batch\_stride + j\f$ of \p ds, \p dl, \p d,
+*  \p du, \p dw and \p x. This layout gives coalesced memory access. Each system is solved
+*  by one thread, such that millions of small systems can be solved in a single launch.
+*
+*  \note
+*  No pivoting is performed, the systems should be diagonally dominant.
 *
 *  \note
 *  This function is non blocking and executed asynchronously with respect to the host.
 *  It may return before the actual computation has finished.
 *
 *  @param[in]
-*  handle      handle to the rocsparse library context queue.
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  m            size of each penta-diagonal linear system.
 *  @param[in]
-*  m           size of the tri-diagonal linear system.
+*  ds           second lower diagonals of the penta-diagonal systems. First two entries of
+*               each system must be zero.
 *  @param[in]
-*  n           number of columns in the dense matrix B.
+*  dl           lower diagonals of the penta-diagonal systems. First entry of each system
+*               must be zero.
 *  @param[in]
-*  dl          lower diagonal of tri-diagonal system. First entry must be zero.
+*  d            main diagonals of the penta-diagonal systems.
 *  @param[in]
-*  d           main diagonal of tri-diagonal system.
+*  du           upper diagonals of the penta-diagonal systems. Last entry of each system
+*               must be zero.
 *  @param[in]
-*  du          upper diagonal of tri-diagonal system. Last entry must be zero.
+*  dw           second upper diagonals of the penta-diagonal systems. Last two entries of
+*               each system must be zero.
 *  @param[inout]
-*  B           Dense matrix of size ( \p ldb, \p n ).
+*  x            Dense array of right-hand sides, that is overwritten by the solutions.
 *  @param[in]
-*  ldb         Leading dimension of B. Must satisfy \p ldb >= max(1, m).
+*  batch_count  number of systems to solve.
 *  @param[in]
-*  temp_buffer temporary storage buffer allocated by the user.
+*  batch_stride number of elements that separate consecutive entries of a system. Must
+*               satisfy \p batch_stride >= batch_count.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user.
 *
 *  \retval     rocsparse_status_success the operation completed successfully.
 *  \retval     rocsparse_status_invalid_handle the library context was not initialized.
-*  \retval     rocsparse_status_invalid_size \p m, \p n or \p ldb is invalid.
-*  \retval     rocsparse_status_invalid_pointer \p dl, \p d,
-*              \p du, \p B or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_invalid_size \p m, \p batch_count or \p batch_stride is
+*              invalid.
+*  \retval     rocsparse_status_invalid_pointer \p ds, \p dl, \p d, \p du, \p dw,
+*              \p x or \p temp_buffer pointer is invalid.
 *  \retval     rocsparse_status_internal_error an internal error occurred.
 */
 /**@{*/
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_sgtsv_no_pivot(rocsparse_handle handle,
-                                          rocsparse_int    m,
-                                          rocsparse_int    n,
-                                          const float*     dl,
-                                          const float*     d,
-                                          const float*     du,
-                                          float*           B,
-                                          rocsparse_int    ldb,
-                                          void*            temp_buffer);
-
-ROCSPARSE_EXPORT
-rocsparse_status rocsparse_dgtsv_no_pivot(rocsparse_handle handle,
-                                          rocsparse_int    m,
-                                          rocsparse_int    n,
-                                          const double*    dl,
-                                          const double*    d,
-                                          const double*    du,
-                                          double*          B,
-                                          rocsparse_int    ldb,
-                                          void*            temp_buffer);
+rocsparse_status rocsparse_sgpsv_no_pivot_interleaved_batch(rocsparse_handle handle,
+                                                            rocsparse_int    m,
+                                                            const float*     ds,
+                                                            const float*     dl,
+                                                            const float*     d,
+                                                            const float*     du,
+                                                            const float*     dw,
+                                                            float*           x,
+                                                            rocsparse_int    batch_count,
+                                                            rocsparse_int    batch_stride,
+                                                            void*            temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dgpsv_no_pivot_interleaved_batch(rocsparse_handle handle,
+                                                            rocsparse_int    m,
+                                                            const double*    ds,
+                                                            const double*    dl,
+                                                            const double*    d,
+                                                            const double*    du,
+                                                            const double*    dw,
+                                                            double*          x,
+                                                            rocsparse_int    batch_count,
+                                                            rocsparse_int    batch_stride,
+                                                            void*            temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_cgtsv_no_pivot(rocsparse_handle               handle,
-                                          rocsparse_int                  m,
-                                          rocsparse_int                  n,
-                                          const rocsparse_float_complex* dl,
-                                          const rocsparse_float_complex* d,
-                                          const rocsparse_float_complex* du,
-                                          rocsparse_float_complex*       B,
-                                          rocsparse_int                  ldb,
-                                          void*                          temp_buffer);
+rocsparse_status
+    rocsparse_cgpsv_no_pivot_interleaved_batch(rocsparse_handle               handle,
+                                               rocsparse_int                  m,
+                                               const rocsparse_float_complex* ds,
+                                               const rocsparse_float_complex* dl,
+                                               const rocsparse_float_complex* d,
+                                               const rocsparse_float_complex* du,
+                                               const rocsparse_float_complex* dw,
+                                               rocsparse_float_complex*       x,
+                                               rocsparse_int                  batch_count,
+                                               rocsparse_int                  batch_stride,
+                                               void*                          temp_buffer);
 
 ROCSPARSE_EXPORT
-rocsparse_status rocsparse_zgtsv_no_pivot(rocsparse_handle                handle,
-                                          rocsparse_int                   m,
-                                          rocsparse_int                   n,
-                                          const rocsparse_double_complex* dl,
-                                          const rocsparse_double_complex* d,
-                                          const rocsparse_double_complex* du,
-                                          rocsparse_double_complex*       B,
-                                          rocsparse_int                   ldb,
-                                          void*                           temp_buffer);
+rocsparse_status
+    rocsparse_zgpsv_no_pivot_interleaved_batch(rocsparse_handle                handle,
+                                               rocsparse_int                   m,
+                                               const rocsparse_double_complex* ds,
+                                               const rocsparse_double_complex* dl,
+                                               const rocsparse_double_complex* d,
+                                               const rocsparse_double_complex* du,
+                                               const rocsparse_double_complex* dw,
+                                               rocsparse_double_complex*       x,
+                                               rocsparse_int                   batch_count,
+                                               rocsparse_int                   batch_stride,
+                                               void*                           temp_buffer);
 /**@}*/
 
 /*
@@ -12665,6 +19494,220 @@ rocsparse_status rocsparse_coosort_by_column(rocsparse_handle handle,
                                              rocsparse_int*   perm,
                                              void*            temp_buffer);
 
+/*! \ingroup conv_module
+*  \brief Symmetric permutation of a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_csrsympermute_buffer_size returns the size of the temporary storage
+*  buffer that is required by rocsparse_scsrsympermute(), rocsparse_dcsrsympermute(),
+*  rocsparse_ccsrsympermute() and rocsparse_zcsrsympermute(). The temporary storage
+*  buffer must be allocated by the user.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrix. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+*                  the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[in]
+*  perm            array of \p m elements containing the zero based permutation.
+*  @param[out]
+*  buffer_size     number of bytes of the temporary storage buffer required by
+*                  rocsparse_scsrsympermute(), rocsparse_dcsrsympermute(),
+*                  rocsparse_ccsrsympermute() and rocsparse_zcsrsympermute().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_row_ptr, \p csr_col_ind,
+*              \p perm or \p buffer_size pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_csrsympermute_buffer_size(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     const rocsparse_int*      perm,
+                                                     size_t*                   buffer_size);
+
+/*! \ingroup conv_module
+*  \brief Symmetric permutation of a sparse CSR matrix
+*
+*  \details
+*  \p rocsparse_csrsympermute computes the symmetrically permuted matrix
+*  \f[
+*    B = P \cdot A \cdot P^T,
+*  \f]
+*  with \f$b_{ij} = a_{perm[i], perm[j]}\f$, e.g. to reorder a matrix by the permutation
+*  obtained from rocsparse_csrcolor(). The column indices of the output matrix are sorted
+*  within each row. It is assumed that \p csr_val_out, \p csr_row_ptr_out and
+*  \p csr_col_ind_out are allocated with \p nnz, \p m+1 and \p nnz elements, respectively.
+*
+*  \p rocsparse_csrsympermute requires extra temporary storage buffer that has to be
+*  allocated by the user. Storage buffer size can be determined by
+*  rocsparse_csrsympermute_buffer_size().
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle          handle to the rocsparse library context queue.
+*  @param[in]
+*  m               number of rows and columns of the sparse CSR matrix.
+*  @param[in]
+*  nnz             number of non-zero entries of the sparse CSR matrix.
+*  @param[in]
+*  descr           descriptor of the sparse CSR matrices. Currently, only
+*                  \ref rocsparse_matrix_type_general is supported.
+*  @param[in]
+*  csr_val         array of \p nnz elements of the sparse CSR matrix.
+*  @param[in]
+*  csr_row_ptr     array of \p m+1 elements that point to the start of every row of
+*                  the sparse CSR matrix.
+*  @param[in]
+*  csr_col_ind     array of \p nnz elements containing the column indices of the sparse
+*                  CSR matrix.
+*  @param[in]
+*  perm            array of \p m elements containing the zero based permutation.
+*  @param[out]
+*  csr_val_out     array of \p nnz elements of the permuted CSR matrix.
+*  @param[out]
+*  csr_row_ptr_out array of \p m+1 elements that point to the start of every row of
+*                  the permuted CSR matrix.
+*  @param[out]
+*  csr_col_ind_out array of \p nnz elements containing the column indices of the
+*                  permuted CSR matrix.
+*  @param[in]
+*  temp_buffer     temporary storage buffer allocated by the user, size is returned by
+*                  rocsparse_csrsympermute_buffer_size().
+*
+*  \retval     rocsparse_status_success the operation completed successfully.
+*  \retval     rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval     rocsparse_status_invalid_size \p m or \p nnz is invalid.
+*  \retval     rocsparse_status_invalid_pointer \p descr, \p csr_val, \p csr_row_ptr,
+*              \p csr_col_ind, \p perm, \p csr_val_out, \p csr_row_ptr_out,
+*              \p csr_col_ind_out or \p temp_buffer pointer is invalid.
+*  \retval     rocsparse_status_internal_error an internal error occurred.
+*  \retval     rocsparse_status_not_implemented
+*              \p rocsparse_matrix_type != \ref rocsparse_matrix_type_general.
+*
+*  \par Example
+*  \code{.c}
+*      // Compute multicolor reordering
+*      rocsparse_csrcolor(handle,
+*                         m,
+*                         nnz,
+*                         descr,
+*                         csr_row_ptr,
+*                         csr_col_ind,
+*                         &ncolors,
+*                         coloring,
+*                         reordering,
+*                         color_buffer);
+*
+*      // Obtain required buffer size
+*      size_t buffer_size;
+*      rocsparse_csrsympermute_buffer_size(handle,
+*                                          m,
+*                                          nnz,
+*                                          descr,
+*                                          csr_row_ptr,
+*                                          csr_col_ind,
+*                                          reordering,
+*                                          &buffer_size);
+*
+*      // Allocate temporary buffer
+*      void* temp_buffer;
+*      hipMalloc(&temp_buffer, buffer_size);
+*
+*      // Permute the matrix
+*      rocsparse_dcsrsympermute(handle,
+*                               m,
+*                               nnz,
+*                               descr,
+*                               csr_val,
+*                               csr_row_ptr,
+*                               csr_col_ind,
+*                               reordering,
+*                               csr_val_out,
+*                               csr_row_ptr_out,
+*                               csr_col_ind_out,
+*                               temp_buffer);
+*  \endcode
+*/
+/**@{*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_scsrsympermute(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const float*              csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          const rocsparse_int*      perm,
+                                          float*                    csr_val_out,
+                                          rocsparse_int*            csr_row_ptr_out,
+                                          rocsparse_int*            csr_col_ind_out,
+                                          void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_dcsrsympermute(rocsparse_handle          handle,
+                                          rocsparse_int             m,
+                                          rocsparse_int             nnz,
+                                          const rocsparse_mat_descr descr,
+                                          const double*             csr_val,
+                                          const rocsparse_int*      csr_row_ptr,
+                                          const rocsparse_int*      csr_col_ind,
+                                          const rocsparse_int*      perm,
+                                          double*                   csr_val_out,
+                                          rocsparse_int*            csr_row_ptr_out,
+                                          rocsparse_int*            csr_col_ind_out,
+                                          void*                     temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_ccsrsympermute(rocsparse_handle               handle,
+                                          rocsparse_int                  m,
+                                          rocsparse_int                  nnz,
+                                          const rocsparse_mat_descr      descr,
+                                          const rocsparse_float_complex* csr_val,
+                                          const rocsparse_int*           csr_row_ptr,
+                                          const rocsparse_int*           csr_col_ind,
+                                          const rocsparse_int*           perm,
+                                          rocsparse_float_complex*       csr_val_out,
+                                          rocsparse_int*                 csr_row_ptr_out,
+                                          rocsparse_int*                 csr_col_ind_out,
+                                          void*                          temp_buffer);
+
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_zcsrsympermute(rocsparse_handle                handle,
+                                          rocsparse_int                   m,
+                                          rocsparse_int                   nnz,
+                                          const rocsparse_mat_descr       descr,
+                                          const rocsparse_double_complex* csr_val,
+                                          const rocsparse_int*            csr_row_ptr,
+                                          const rocsparse_int*            csr_col_ind,
+                                          const rocsparse_int*            perm,
+                                          rocsparse_double_complex*       csr_val_out,
+                                          rocsparse_int*                  csr_row_ptr_out,
+                                          rocsparse_int*                  csr_col_ind_out,
+                                          void*                           temp_buffer);
+/**@}*/
+
 /*! \ingroup conv_module
 *  \brief Convert a sparse BSR matrix into a sparse CSR matrix
 *
@@ -13791,6 +20834,81 @@ rocsparse_status rocsparse_spmv(rocsparse_handle            handle,
                                 size_t*                     buffer_size,
                                 void*                       temp_buffer);
 
+/*! \ingroup generic_module
+*  \brief Sparse matrix vector multiplication over a semiring
+*
+*  \details
+*  \ref rocsparse_spmv_semiring multiplies the scalar \f$\alpha\f$ with a sparse
+*  \f$m \times n\f$ matrix and the dense vector \f$x\f$ and adds the result to the dense
+*  vector \f$y\f$ that is multiplied by the scalar \f$\beta\f$, where addition and
+*  multiplication are the operations \f$(\oplus, \otimes)\f$ of the given semiring, such that
+*  \f[
+*    y_i := \left(\alpha \otimes \bigoplus_{j} a_{ij} \otimes x_j\right) \oplus
+*           \left(\beta \otimes y_i\right).
+*  \f]
+*  The sum runs over the stored entries of row \f$i\f$ only, i.e. entries that are not
+*  stored act as the zero of the semiring. Rows without entries are set to the zero of
+*  the semiring.
+*
+*  \note
+*  If \f$\beta\f$ is equal to the zero of the semiring, \f$y\f$ is not read.
+*
+*  \note
+*  \ref rocsparse_semiring_plus_pair requires \f$\beta = 0\f$, since
+*  \f$\beta \otimes y_i = 1\f$ would not depend on \f$y_i\f$.
+*
+*  \note
+*  This function is non blocking and executed asynchronously with respect to the host.
+*  It may return before the actual computation has finished. For
+*  \ref rocsparse_semiring_plus_pair in \ref rocsparse_pointer_mode_device, the function
+*  blocks to check \f$\beta\f$.
+*
+*  \note
+*  Currently, only \p trans == \ref rocsparse_operation_none and CSR format is supported.
+*
+*  \note
+*  Complex data types only support \ref rocsparse_semiring_plus_times.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  trans        matrix operation type.
+*  @param[in]
+*  semiring     semiring \f$(\oplus, \otimes)\f$ the operation is performed in.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  mat          matrix descriptor.
+*  @param[in]
+*  x            vector descriptor.
+*  @param[in]
+*  beta         scalar \f$\beta\f$.
+*  @param[inout]
+*  y            vector descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SpMV computation.
+*
+*  \retval      rocsparse_status_success the operation completed successfully.
+*  \retval      rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval      rocsparse_status_invalid_pointer \p alpha, \p mat, \p x, \p beta or \p y
+*               pointer is invalid.
+*  \retval      rocsparse_status_invalid_value \p trans, \p semiring or \p compute_type is
+*               invalid, or \p beta is not zero for \ref rocsparse_semiring_plus_pair.
+*  \retval      rocsparse_status_not_implemented \p trans, \p compute_type or the format
+*               of \p mat is currently not supported, or \p semiring is not supported for
+*               the complex \p compute_type.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spmv_semiring(rocsparse_handle            handle,
+                                         rocsparse_operation         trans,
+                                         rocsparse_semiring          semiring,
+                                         const void*                 alpha,
+                                         const rocsparse_spmat_descr mat,
+                                         const rocsparse_dnvec_descr x,
+                                         const void*                 beta,
+                                         const rocsparse_dnvec_descr y,
+                                         rocsparse_datatype          compute_type);
+
 /*! \ingroup generic_module
 *  \brief Sparse matrix dense matrix multiplication
 *
@@ -13939,6 +21057,12 @@ rocsparse_status rocsparse_spmm(rocsparse_handle            handle,
 *  resulting \f$C\f$ matrix. If the sparsity pattern of \f$C\f$ is already known, this
 *  stage can be skipped. In the final stage \ref rocsparse_spgemm_stage_compute, the actual
 *  computation is performed.
+*  \note The row grouping of \f$C\f$ that is computed by the first
+*  \ref rocsparse_spgemm_stage_compute call is kept in the descriptor of \f$C\f$. Repeated
+*  calls with unchanged sparsity patterns, e.g. with updated values of \f$A\f$ and
+*  \f$B\f$, only run the numerical kernels and do not synchronize with the host. The
+*  grouping is discarded by the \ref rocsparse_spgemm_stage_buffer_size and
+*  \ref rocsparse_spgemm_stage_nnz stages.
 *  \note If \ref rocsparse_spgemm_stage_auto is selected, rocSPARSE will automatically detect
 *  which stage is required based on the following indicators:
 *  If \p temp_buffer is equal to \p nullptr, the required buffer size will be returned.
@@ -13951,8 +21075,11 @@ rocsparse_status rocsparse_spmm(rocsparse_handle            handle,
 *  \note \f$\alpha == beta == 0\f$ is invalid.
 *  \note It is allowed to pass the same sparse matrix for \f$C\f$ and \f$D\f$, if both
 *  matrices have the same sparsity pattern.
-*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
-*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note For \p trans_A == \ref rocsparse_operation_transpose or \p trans_B ==
+*  \ref rocsparse_operation_transpose, the values of \f$A\f$ and \f$B\f$ are gathered
+*  into their transposed sparsity patterns stored in \p temp_buffer by the
+*  \ref rocsparse_spgemm_stage_nnz stage, which cannot be skipped in this case.
+*  \note Currently, \ref rocsparse_operation_conjugate_transpose is not supported.
 *  \note This function is non blocking and executed asynchronously with respect to the
 *        host. It may return before the actual computation has finished.
 *  \note Please note, that for rare matrix products with more than 4096 non-zero entries
@@ -13997,8 +21124,8 @@ rocsparse_status rocsparse_spmm(rocsparse_handle            handle,
 *  \retval rocsparse_status_memory_error additional buffer for long rows could not be
 *          allocated.
 *  \retval rocsparse_status_not_implemented
-*          \p trans_A != \ref rocsparse_operation_none or
-*          \p trans_B != \ref rocsparse_operation_none.
+*          \p trans_A == \ref rocsparse_operation_conjugate_transpose or
+*          \p trans_B == \ref rocsparse_operation_conjugate_transpose.
 */
 ROCSPARSE_EXPORT
 rocsparse_status rocsparse_spgemm(rocsparse_handle            handle,
@@ -14016,6 +21143,89 @@ rocsparse_status rocsparse_spgemm(rocsparse_handle            handle,
                                   size_t*                     buffer_size,
                                   void*                       temp_buffer);
 
+/*! \ingroup generic_module
+*  \brief Sparse matrix sparse matrix multiplication over a semiring
+*
+*  \details
+*  \ref rocsparse_spgemm_semiring multiplies the scalar \f$\alpha\f$ with the sparse
+*  \f$m \times k\f$ matrix \f$A\f$ and the sparse \f$k \times n\f$ matrix \f$B\f$, where
+*  addition and multiplication are the operations \f$(\oplus, \otimes)\f$ of the given
+*  semiring. The final result is stored in the sparse \f$m \times n\f$ matrix \f$C\f$,
+*  such that
+*  \f[
+*    c_{ij} := \alpha \otimes \bigoplus_{l} a_{il} \otimes b_{lj}.
+*  \f]
+*  The sum runs over the stored entries only, i.e. the sparsity pattern of \f$C\f$ is
+*  the same as for \ref rocsparse_spgemm and does not depend on the semiring.
+*
+*  \note SpGEMM requires three stages to complete, see \ref rocsparse_spgemm. The
+*  \ref rocsparse_spgemm_stage_buffer_size and \ref rocsparse_spgemm_stage_nnz stages are
+*  independent of the semiring, such that the sparsity pattern of \f$C\f$ can be re-used
+*  for products over different semirings.
+*  \note Currently, only \p trans_A == \ref rocsparse_operation_none is supported.
+*  \note Currently, only \p trans_B == \ref rocsparse_operation_none is supported.
+*  \note Currently, only CSR format is supported.
+*  \note Complex data types only support \ref rocsparse_semiring_plus_times.
+*  \note This function is non blocking and executed asynchronously with respect to the
+*        host. It may return before the actual computation has finished.
+*
+*  @param[in]
+*  handle       handle to the rocsparse library context queue.
+*  @param[in]
+*  trans_A      sparse matrix \f$A\f$ operation type.
+*  @param[in]
+*  trans_B      sparse matrix \f$B\f$ operation type.
+*  @param[in]
+*  semiring     semiring \f$(\oplus, \otimes)\f$ the operation is performed in.
+*  @param[in]
+*  alpha        scalar \f$\alpha\f$.
+*  @param[in]
+*  A            sparse matrix \f$A\f$ descriptor.
+*  @param[in]
+*  B            sparse matrix \f$B\f$ descriptor.
+*  @param[out]
+*  C            sparse matrix \f$C\f$ descriptor.
+*  @param[in]
+*  compute_type floating point precision for the SpGEMM computation.
+*  @param[in]
+*  alg          SpGEMM algorithm for the SpGEMM computation.
+*  @param[in]
+*  stage        SpGEMM stage for the SpGEMM computation.
+*  @param[out]
+*  buffer_size  number of bytes of the temporary storage buffer. buffer_size is set when
+*               \p temp_buffer is nullptr.
+*  @param[in]
+*  temp_buffer  temporary storage buffer allocated by the user. When a nullptr is passed,
+*               the required allocation size (in bytes) is written to \p buffer_size and
+*               function returns without performing the SpGEMM operation.
+*
+*  \retval rocsparse_status_success the operation completed successfully.
+*  \retval rocsparse_status_invalid_handle the library context was not initialized.
+*  \retval rocsparse_status_invalid_pointer \p alpha, \p A, \p B, \p C or \p buffer_size
+*          pointer is invalid.
+*  \retval rocsparse_status_invalid_value \p semiring is invalid.
+*  \retval rocsparse_status_memory_error additional buffer for long rows could not be
+*          allocated.
+*  \retval rocsparse_status_not_implemented
+*          \p trans_A != \ref rocsparse_operation_none,
+*          \p trans_B != \ref rocsparse_operation_none, or \p semiring is not supported
+*          for the complex \p compute_type.
+*/
+ROCSPARSE_EXPORT
+rocsparse_status rocsparse_spgemm_semiring(rocsparse_handle            handle,
+                                           rocsparse_operation         trans_A,
+                                           rocsparse_operation         trans_B,
+                                           rocsparse_semiring          semiring,
+                                           const void*                 alpha,
+                                           const rocsparse_spmat_descr A,
+                                           const rocsparse_spmat_descr B,
+                                           rocsparse_spmat_descr       C,
+                                           rocsparse_datatype          compute_type,
+                                           rocsparse_spgemm_alg        alg,
+                                           rocsparse_spgemm_stage      stage,
+                                           size_t*                     buffer_size,
+                                           void*                       temp_buffer);
+
 /*! \ingroup generic_module
 *  \brief  Sampled Dense-Dense Matrix Multiplication.
 *
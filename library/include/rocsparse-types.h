@@ -227,22 +227,35 @@ typedef enum rocsparse_hyb_partition_
  *  re-used or not. If meta data from a previous e.g. rocsparse_csrilu0_analysis() call
  *  is available, it can be re-used for subsequent calls to e.g.
  *  rocsparse_csrsv_analysis() and greatly improve performance of the analysis function.
+ *  If only the values of a matrix have changed, e.g. when refactorizing the same
+ *  sparsity pattern repeatedly, \ref rocsparse_analysis_policy_numeric re-uses the
+ *  existing meta data after verifying a fingerprint of the sparsity pattern on the
+ *  device. If the pattern does not match, the meta data is re-built.
  */
 typedef enum rocsparse_analysis_policy_
 {
-    rocsparse_analysis_policy_reuse = 0, /**< try to re-use meta data. */
-    rocsparse_analysis_policy_force = 1 /**< force to re-build meta data. */
+    rocsparse_analysis_policy_reuse   = 0, /**< try to re-use meta data. */
+    rocsparse_analysis_policy_force   = 1, /**< force to re-build meta data. */
+    rocsparse_analysis_policy_numeric = 2 /**< re-use meta data of an unchanged pattern. */
 } rocsparse_analysis_policy;
 
 /*! \ingroup types_module
  *  \brief Specify policy in triangular solvers and factorizations.
  *
  *  \details
- *  This is a placeholder.
+ *  The \ref rocsparse_solve_policy specifies how the dependencies of a triangular
+ *  solve are resolved. The sync-free scheme processes all rows in a single kernel
+ *  launch, where each row busy-waits until its dependencies have been resolved. The
+ *  level-set scheme groups rows into independent levels during the analysis phase
+ *  and processes each level as a bulk-synchronous batch. With
+ *  \ref rocsparse_solve_policy_auto, the scheme is chosen from the level statistics
+ *  gathered by the analysis.
  */
 typedef enum rocsparse_solve_policy_
 {
-    rocsparse_solve_policy_auto = 0 /**< automatically decide on level information. */
+    rocsparse_solve_policy_auto      = 0, /**< automatically decide on level information. */
+    rocsparse_solve_policy_sync_free = 1, /**< busy-wait on dependencies, single launch. */
+    rocsparse_solve_policy_level_set = 2 /**< one bulk-synchronous launch per level. */
 } rocsparse_solve_policy;
 
 /*! \ingroup types_module
@@ -449,6 +462,84 @@ typedef enum rocsparse_spgemm_alg_
     rocsparse_spgemm_alg_default = 0 /**< Default SpGEMM algorithm for the given format. */
 } rocsparse_spgemm_alg;
 
+/*! \ingroup types_module
+ *  \brief List of interleaved gtsv algorithms.
+ *
+ *  \details
+ *  This is a list of supported \ref rocsparse_gtsv_interleaved_alg types that are used to
+ *  solve batches of tri-diagonal linear systems stored in interleaved layout.
+ */
+typedef enum rocsparse_gtsv_interleaved_alg_
+{
+    rocsparse_gtsv_interleaved_alg_default = 0, /**< Default algorithm, partial pivoting LU. */
+    rocsparse_gtsv_interleaved_alg_thomas  = 1, /**< Thomas algorithm without pivoting. */
+    rocsparse_gtsv_interleaved_alg_lu      = 2 /**< LU factorization with partial pivoting. */
+} rocsparse_gtsv_interleaved_alg;
+
+/*! \ingroup types_module
+ *  \brief List of csrgemm mask types.
+ *
+ *  \details
+ *  The \ref rocsparse_mask_type indicates how the sparsity pattern of the mask
+ *  matrix restricts the entries that are computed by a masked sparse matrix
+ *  multiplication.
+ */
+typedef enum rocsparse_mask_type_
+{
+    rocsparse_mask_type_structural = 0, /**< compute only entries present in the mask. */
+    rocsparse_mask_type_complement = 1 /**< compute only entries absent from the mask. */
+} rocsparse_mask_type;
+
+/*! \ingroup types_module
+ *  \brief List of semirings.
+ *
+ *  \details
+ *  The \ref rocsparse_semiring indicates the pair of operations \f$(\oplus, \otimes)\f$
+ *  that replaces addition and multiplication in semiring sparse matrix vector and
+ *  sparse matrix matrix multiplication. Semirings other than
+ *  \ref rocsparse_semiring_plus_times are only supported for real data types.
+ */
+typedef enum rocsparse_semiring_
+{
+    rocsparse_semiring_plus_times = 0, /**< \f$(+, \times)\f$, zero is 0. */
+    rocsparse_semiring_min_plus   = 1, /**< \f$(\min, +)\f$, zero is \f$+\infty\f$. */
+    rocsparse_semiring_max_times  = 2, /**< \f$(\max, \times)\f$, zero is \f$-\infty\f$. */
+    rocsparse_semiring_or_and     = 3, /**< \f$(\lor, \land)\f$ on non-zero values, zero is 0. */
+    rocsparse_semiring_plus_pair  = 4 /**< \f$(+, \text{pair})\f$, \f$a \otimes b = 1\f$. */
+} rocsparse_semiring;
+
+/*! \ingroup types_module
+ *  \brief List of element-wise sparsity patterns.
+ *
+ *  \details
+ *  The \ref rocsparse_ewise_pattern indicates the sparsity pattern of the result of an
+ *  element-wise operation on two sparse matrices.
+ */
+typedef enum rocsparse_ewise_pattern_
+{
+    rocsparse_ewise_pattern_intersection = 0, /**< entries present in both operands. */
+    rocsparse_ewise_pattern_union        = 1 /**< entries present in any operand. */
+} rocsparse_ewise_pattern;
+
+/*! \ingroup types_module
+ *  \brief List of element-wise binary operators.
+ *
+ *  \details
+ *  The \ref rocsparse_ewise_op indicates the binary operator \f$a \odot b\f$ that is
+ *  applied to entries present in both operands of an element-wise operation.
+ *  \ref rocsparse_ewise_op_min and \ref rocsparse_ewise_op_max are only supported for
+ *  real data types.
+ */
+typedef enum rocsparse_ewise_op_
+{
+    rocsparse_ewise_op_add = 0, /**< \f$a + b\f$. */
+    rocsparse_ewise_op_sub = 1, /**< \f$a - b\f$. */
+    rocsparse_ewise_op_mul = 2, /**< \f$a \cdot b\f$. */
+    rocsparse_ewise_op_div = 3, /**< \f$a / b\f$. */
+    rocsparse_ewise_op_min = 4, /**< \f$\min(a, b)\f$. */
+    rocsparse_ewise_op_max = 5 /**< \f$\max(a, b)\f$. */
+} rocsparse_ewise_op;
+
 #ifdef __cplusplus
 }
 #endif
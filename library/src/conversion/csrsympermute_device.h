@@ -0,0 +1,111 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRSYMPERMUTE_DEVICE_H
+#define CSRSYMPERMUTE_DEVICE_H
+
+#include "common.h"
+
+// Compute the inverse permutation
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsympermute_inverse_kernel(rocsparse_int m,
+                                      const rocsparse_int* __restrict__ perm,
+                                      rocsparse_int* __restrict__ iperm)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    iperm[perm[gid]] = gid;
+}
+
+// Compute the number of non-zero entries of each permuted row
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsympermute_row_nnz_kernel(rocsparse_int m,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ perm,
+                                      rocsparse_int* __restrict__ csr_row_ptr_out,
+                                      rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid == 0)
+    {
+        csr_row_ptr_out[0] = idx_base;
+    }
+
+    if(gid >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row = perm[gid];
+
+    csr_row_ptr_out[gid + 1] = csr_row_ptr[row + 1] - csr_row_ptr[row];
+}
+
+// Copy each permuted row and relabel its column indices. The position of each entry in
+// the original matrix is stored for gathering the values, once columns are sorted.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsympermute_fill_kernel(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                   const rocsparse_int* __restrict__ perm,
+                                   const rocsparse_int* __restrict__ iperm,
+                                   const rocsparse_int* __restrict__ csr_row_ptr_out,
+                                   rocsparse_int* __restrict__ csr_col_ind_out,
+                                   rocsparse_int* __restrict__ src,
+                                   rocsparse_index_base idx_base)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    rocsparse_int wid = hipThreadIdx_x / WF_SIZE;
+
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int old_row = perm[row];
+
+    rocsparse_int row_begin = csr_row_ptr[old_row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[old_row + 1] - idx_base;
+    rocsparse_int shift     = csr_row_ptr_out[row] - idx_base - row_begin;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        csr_col_ind_out[j + shift] = iperm[csr_col_ind[j] - idx_base] + idx_base;
+        src[j + shift]             = j;
+    }
+}
+
+#endif // CSRSYMPERMUTE_DEVICE_H
@@ -0,0 +1,379 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrsympermute.hpp"
+#include "definitions.h"
+#include "utility.h"
+
+#include "../level1/rocsparse_gthr.hpp"
+#include "csrsympermute_device.h"
+
+#include <rocprim/rocprim.hpp>
+
+extern "C" rocsparse_status rocsparse_csrsympermute_buffer_size(rocsparse_handle          handle,
+                                                                rocsparse_int             m,
+                                                                rocsparse_int             nnz,
+                                                                const rocsparse_mat_descr descr,
+                                                                const rocsparse_int* csr_row_ptr,
+                                                                const rocsparse_int* csr_col_ind,
+                                                                const rocsparse_int* perm,
+                                                                size_t*              buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrsympermute_buffer_size",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)perm,
+              (const void*&)buffer_size);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Inverse permutation
+    *buffer_size = sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Origin of each entry
+    *buffer_size += sizeof(rocsparse_int) * (nnz / 256 + 1) * 256;
+
+    // Temporary storage for scan and sort
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr,
+                                                (rocsparse_int*)csr_row_ptr,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    size_t sort_size = 0;
+    if(nnz > 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsort_buffer_size(
+            handle, m, m, nnz, csr_row_ptr, csr_col_ind, &sort_size));
+    }
+
+    *buffer_size += ((std::max(rocprim_size, sort_size) - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrsympermute_template(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const T*                  csr_val,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  const rocsparse_int*      perm,
+                                                  T*                        csr_val_out,
+                                                  rocsparse_int*            csr_row_ptr_out,
+                                                  rocsparse_int*            csr_col_ind_out,
+                                                  void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrsympermute"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)perm,
+              (const void*&)csr_val_out,
+              (const void*&)csr_row_ptr_out,
+              (const void*&)csr_col_ind_out,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrsympermute -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx>");
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_out == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(nnz != 0
+            && (csr_val == nullptr || csr_col_ind == nullptr || csr_val_out == nullptr
+                || csr_col_ind_out == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Inverse permutation
+    rocsparse_int* iperm = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Origin of each entry
+    rocsparse_int* src = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (nnz / 256 + 1) * 256;
+
+    // Temporary storage for scan and sort
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+#define CSRSYMPERMUTE_DIM 256
+    hipLaunchKernelGGL((csrsympermute_inverse_kernel<CSRSYMPERMUTE_DIM>),
+                       dim3((m - 1) / CSRSYMPERMUTE_DIM + 1),
+                       dim3(CSRSYMPERMUTE_DIM),
+                       0,
+                       stream,
+                       m,
+                       perm,
+                       iperm);
+
+    hipLaunchKernelGGL((csrsympermute_row_nnz_kernel<CSRSYMPERMUTE_DIM>),
+                       dim3((m - 1) / CSRSYMPERMUTE_DIM + 1),
+                       dim3(CSRSYMPERMUTE_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       perm,
+                       csr_row_ptr_out,
+                       descr->base);
+
+    // Sum up the row lengths to obtain the row pointers of the permuted matrix
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_out,
+                                                csr_row_ptr_out,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_out,
+                                                csr_row_ptr_out,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    if(nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Copy permuted rows
+    if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        hipLaunchKernelGGL((csrsympermute_fill_kernel<CSRSYMPERMUTE_DIM, 32>),
+                           dim3((32 * m - 1) / CSRSYMPERMUTE_DIM + 1),
+                           dim3(CSRSYMPERMUTE_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           perm,
+                           iperm,
+                           csr_row_ptr_out,
+                           csr_col_ind_out,
+                           src,
+                           descr->base);
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        hipLaunchKernelGGL((csrsympermute_fill_kernel<CSRSYMPERMUTE_DIM, 64>),
+                           dim3((64 * m - 1) / CSRSYMPERMUTE_DIM + 1),
+                           dim3(CSRSYMPERMUTE_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           perm,
+                           iperm,
+                           csr_row_ptr_out,
+                           csr_col_ind_out,
+                           src,
+                           descr->base);
+    }
+#undef CSRSYMPERMUTE_DIM
+
+    // Sort columns within each row
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsort(
+        handle, m, m, nnz, descr, csr_row_ptr_out, csr_col_ind_out, src, rocprim_buffer));
+
+    // Gather values
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(
+        handle, nnz, csr_val, csr_val_out, src, rocsparse_index_base_zero));
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                      \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,          \
+                                     rocsparse_int             m,               \
+                                     rocsparse_int             nnz,             \
+                                     const rocsparse_mat_descr descr,           \
+                                     const TYPE*               csr_val,         \
+                                     const rocsparse_int*      csr_row_ptr,     \
+                                     const rocsparse_int*      csr_col_ind,     \
+                                     const rocsparse_int*      perm,            \
+                                     TYPE*                     csr_val_out,     \
+                                     rocsparse_int*            csr_row_ptr_out, \
+                                     rocsparse_int*            csr_col_ind_out, \
+                                     void*                     temp_buffer)     \
+    {                                                                           \
+        return rocsparse_csrsympermute_template(handle,                         \
+                                                m,                              \
+                                                nnz,                            \
+                                                descr,                          \
+                                                csr_val,                        \
+                                                csr_row_ptr,                    \
+                                                csr_col_ind,                    \
+                                                perm,                           \
+                                                csr_val_out,                    \
+                                                csr_row_ptr_out,                \
+                                                csr_col_ind_out,                \
+                                                temp_buffer);                   \
+    }
+
+C_IMPL(rocsparse_scsrsympermute, float);
+C_IMPL(rocsparse_dcsrsympermute, double);
+C_IMPL(rocsparse_ccsrsympermute, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrsympermute, rocsparse_double_complex);
+
+#undef C_IMPL
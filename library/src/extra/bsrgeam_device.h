@@ -0,0 +1,115 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRGEAM_DEVICE_H
+#define BSRGEAM_DEVICE_H
+
+#include "common.h"
+
+// Compute matrix addition, where each block row is processed by BLOCKDIM * BLOCKDIM threads.
+// The block columns of A and B are merged, and each thread computes the entries of the
+// block that are congruent to its position in the BLOCKDIM x BLOCKDIM tile.
+template <unsigned int BLOCKSIZE, unsigned int BLOCKDIM, typename T>
+__device__ void bsrgeam_fill_device(rocsparse_direction dir,
+                                    rocsparse_int       mb,
+                                    rocsparse_int       nb,
+                                    rocsparse_int       bsr_dim,
+                                    T                   alpha,
+                                    const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                                    const rocsparse_int* __restrict__ bsr_col_ind_A,
+                                    const T* __restrict__ bsr_val_A,
+                                    T beta,
+                                    const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                                    const rocsparse_int* __restrict__ bsr_col_ind_B,
+                                    const T* __restrict__ bsr_val_B,
+                                    const rocsparse_int* __restrict__ bsr_row_ptr_C,
+                                    rocsparse_int* __restrict__ bsr_col_ind_C,
+                                    T* __restrict__ bsr_val_C,
+                                    rocsparse_index_base idx_base_A,
+                                    rocsparse_index_base idx_base_B,
+                                    rocsparse_index_base idx_base_C)
+{
+    // Thread id within the block row
+    int tid = hipThreadIdx_x % (BLOCKDIM * BLOCKDIM);
+
+    // Position of the thread in the block tile
+    int bi = tid / BLOCKDIM;
+    int bj = tid % BLOCKDIM;
+
+    // Each BLOCKDIM * BLOCKDIM threads process a block row
+    rocsparse_int row = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / (BLOCKDIM * BLOCKDIM);
+
+    // Do not run out of bounds
+    if(row >= mb)
+    {
+        return;
+    }
+
+    // Get block row entry and exit point of A, B and C
+    rocsparse_int j_A   = bsr_row_ptr_A[row] - idx_base_A;
+    rocsparse_int end_A = bsr_row_ptr_A[row + 1] - idx_base_A;
+    rocsparse_int j_B   = bsr_row_ptr_B[row] - idx_base_B;
+    rocsparse_int end_B = bsr_row_ptr_B[row + 1] - idx_base_B;
+    rocsparse_int j_C   = bsr_row_ptr_C[row] - idx_base_C;
+
+    // Merge the block columns of A and B
+    while(j_A < end_A || j_B < end_B)
+    {
+        rocsparse_int col_A = (j_A < end_A) ? bsr_col_ind_A[j_A] - idx_base_A : nb;
+        rocsparse_int col_B = (j_B < end_B) ? bsr_col_ind_B[j_B] - idx_base_B : nb;
+        rocsparse_int col_C = min(col_A, col_B);
+
+        if(tid == 0)
+        {
+            bsr_col_ind_C[j_C] = col_C + idx_base_C;
+        }
+
+        for(rocsparse_int i = bi; i < bsr_dim; i += BLOCKDIM)
+        {
+            for(rocsparse_int k = bj; k < bsr_dim; k += BLOCKDIM)
+            {
+                T sum = static_cast<T>(0);
+
+                if(col_A == col_C)
+                {
+                    sum = alpha * bsr_val_A[BSR_IND(j_A, i, k, dir)];
+                }
+
+                if(col_B == col_C)
+                {
+                    sum = rocsparse_fma(beta, bsr_val_B[BSR_IND(j_B, i, k, dir)], sum);
+                }
+
+                bsr_val_C[BSR_IND(j_C, i, k, dir)] = sum;
+            }
+        }
+
+        j_A += (col_A == col_C);
+        j_B += (col_B == col_C);
+        ++j_C;
+    }
+}
+
+#endif // BSRGEAM_DEVICE_H
@@ -0,0 +1,431 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRGEMM_DEVICE_H
+#define BSRGEMM_DEVICE_H
+
+#include "common.h"
+
+// Binary search for a block column within a sorted block row of C
+__device__ __forceinline__ rocsparse_int
+    bsrgemm_find_block(rocsparse_int col,
+                       const rocsparse_int* __restrict__ bsr_col_ind,
+                       rocsparse_int begin,
+                       rocsparse_int end)
+{
+    while(begin < end)
+    {
+        rocsparse_int mid = begin + ((end - begin) >> 1);
+
+        if(bsr_col_ind[mid] < col)
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+
+    return begin;
+}
+
+// Compute block column entries and accumulate blocks, where each block row is processed
+// by a single block. Splitting the block row into several chunks such that we can use
+// shared memory to store whether a block column is populated or not, as well as the
+// accumulated blocks. Each group of BLOCKDIM * BLOCKDIM threads computes the dense
+// product of a pair of blocks, where each thread owns a single entry of the product.
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int BLOCKDIM,
+          unsigned int CHUNKSIZE,
+          typename T>
+__device__ void
+    bsrgemm_fill_block_per_row_multipass_device(rocsparse_direction dir,
+                                                rocsparse_int       nb,
+                                                rocsparse_int       bsr_dim,
+                                                T                   alpha,
+                                                const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                                                const rocsparse_int* __restrict__ bsr_col_ind_A,
+                                                const T* __restrict__ bsr_val_A,
+                                                const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                                                const rocsparse_int* __restrict__ bsr_col_ind_B,
+                                                const T* __restrict__ bsr_val_B,
+                                                T beta,
+                                                const rocsparse_int* __restrict__ bsr_row_ptr_D,
+                                                const rocsparse_int* __restrict__ bsr_col_ind_D,
+                                                const T* __restrict__ bsr_val_D,
+                                                const rocsparse_int* __restrict__ bsr_row_ptr_C,
+                                                rocsparse_int* __restrict__ bsr_col_ind_C,
+                                                T* __restrict__ bsr_val_C,
+                                                rocsparse_index_base idx_base_A,
+                                                rocsparse_index_base idx_base_B,
+                                                rocsparse_index_base idx_base_C,
+                                                rocsparse_index_base idx_base_D,
+                                                bool                 mul,
+                                                bool                 add)
+{
+    // Number of block pairs that are processed simultaneously
+    static constexpr unsigned int NPAIRS = BLOCKSIZE / (BLOCKDIM * BLOCKDIM);
+
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Block pair id and entry of the block product that is computed by this thread
+    int pid = hipThreadIdx_x / (BLOCKDIM * BLOCKDIM);
+    int bi  = (hipThreadIdx_x / BLOCKDIM) % BLOCKDIM;
+    int bj  = hipThreadIdx_x % BLOCKDIM;
+
+    // Entries outside of the block dimension are padding
+    bool active = (bi < bsr_dim && bj < bsr_dim);
+
+    // Each block processes a block row
+    rocsparse_int row = hipBlockIdx_x;
+
+    // Block column marker and block accumulator
+    __shared__ bool table[CHUNKSIZE];
+    __shared__ T    data[CHUNKSIZE * BLOCKDIM * BLOCKDIM];
+
+    // Position of each populated block column of the current chunk in C
+    __shared__ rocsparse_int position[CHUNKSIZE];
+
+    // Number of populated block columns of the current chunk per wavefront
+    __shared__ rocsparse_int scan_offsets[BLOCKSIZE / WFSIZE];
+
+    // Shared memory to determine the minimum of all block column indices that exceed
+    // the current chunk
+    __shared__ rocsparse_int next_chunk;
+
+    // Begin of the current block row chunk
+    rocsparse_int chunk_begin = 0;
+    rocsparse_int chunk_end   = CHUNKSIZE;
+
+    // Get block row boundaries of the current block row in A and D
+    rocsparse_int row_begin_A = (mul == true) ? bsr_row_ptr_A[row] - idx_base_A : 0;
+    rocsparse_int row_end_A   = (mul == true) ? bsr_row_ptr_A[row + 1] - idx_base_A : 0;
+    rocsparse_int row_begin_D = (add == true) ? bsr_row_ptr_D[row] - idx_base_D : 0;
+    rocsparse_int row_end_D   = (add == true) ? bsr_row_ptr_D[row + 1] - idx_base_D : 0;
+
+    // Entry point into block columns of C
+    rocsparse_int row_begin_C = bsr_row_ptr_C[row] - idx_base_C;
+
+    // Loop over the block row chunks until the end of the block row has been reached
+    while(chunk_begin < nb)
+    {
+        // Initialize block column marker and block accumulator
+        for(unsigned int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+        {
+            table[i] = false;
+        }
+
+        for(unsigned int i = hipThreadIdx_x; i < CHUNKSIZE * BLOCKDIM * BLOCKDIM; i += BLOCKSIZE)
+        {
+            data[i] = static_cast<T>(0);
+        }
+
+        // Initialize next chunk block column index
+        if(hipThreadIdx_x == 0)
+        {
+            next_chunk = nb;
+        }
+
+        // Wait for all threads to finish initialization
+        __syncthreads();
+
+        // Initialize the beginning of the next chunk
+        rocsparse_int min_col = nb;
+
+        // alpha * A * B part
+        for(rocsparse_int j = row_begin_A; j < row_end_A; ++j)
+        {
+            // Block column of A in current block row
+            rocsparse_int col_A = bsr_col_ind_A[j] - idx_base_A;
+
+            rocsparse_int row_begin_B = bsr_row_ptr_B[col_A] - idx_base_B;
+            rocsparse_int row_end_B   = bsr_row_ptr_B[col_A + 1] - idx_base_B;
+
+            // Loop over block columns of B in block row col_A
+            for(rocsparse_int k = row_begin_B + pid; k < row_end_B; k += NPAIRS)
+            {
+                // Block column of B in block row col_A
+                rocsparse_int col_B = bsr_col_ind_B[k] - idx_base_B;
+
+                if(col_B >= chunk_end)
+                {
+                    // Store the first block column index of B that exceeds the current
+                    // chunk
+                    min_col = min(min_col, col_B);
+                    break;
+                }
+
+                if(col_B >= chunk_begin)
+                {
+                    // Mark block column
+                    table[col_B - chunk_begin] = true;
+
+                    // Dense product of the block pair
+                    if(active)
+                    {
+                        T sum = static_cast<T>(0);
+
+                        for(rocsparse_int l = 0; l < bsr_dim; ++l)
+                        {
+                            sum = rocsparse_fma(bsr_val_A[BSR_IND(j, bi, l, dir)],
+                                                bsr_val_B[BSR_IND(k, l, bj, dir)],
+                                                sum);
+                        }
+
+                        data[(col_B - chunk_begin) * BLOCKDIM * BLOCKDIM + bi * BLOCKDIM + bj]
+                            += alpha * sum;
+                    }
+                }
+            }
+
+            // Block columns are unique within a block row of B, but different block rows
+            // of B can contribute to the same block of C
+            __syncthreads();
+        }
+
+        // beta * D part
+        for(rocsparse_int j = row_begin_D + pid; j < row_end_D; j += NPAIRS)
+        {
+            // Block column of D in current block row
+            rocsparse_int col_D = bsr_col_ind_D[j] - idx_base_D;
+
+            if(col_D >= chunk_end)
+            {
+                // Store the first block column index of D that exceeds the current chunk
+                min_col = min(min_col, col_D);
+                break;
+            }
+
+            if(col_D >= chunk_begin)
+            {
+                // Mark block column
+                table[col_D - chunk_begin] = true;
+
+                if(active)
+                {
+                    data[(col_D - chunk_begin) * BLOCKDIM * BLOCKDIM + bi * BLOCKDIM + bj]
+                        += beta * bsr_val_D[BSR_IND(j, bi, bj, dir)];
+                }
+            }
+        }
+
+        // Atomically determine the new chunks beginning
+        if(min_col < nb)
+        {
+            atomicMin(&next_chunk, min_col);
+        }
+
+        // Wait for all threads to finish
+        __syncthreads();
+
+        // Compute the position of each populated block column of the chunk in C, the
+        // number of threads is at least the chunk size
+        bool has_nnzb = (hipThreadIdx_x < CHUNKSIZE) ? table[hipThreadIdx_x] : false;
+
+        // Each thread obtains a bit mask of all wavefront-wide populated block columns
+        unsigned long long mask = __ballot(has_nnzb);
+
+        // Obtain the lane mask, where all bits lesser equal the lane id are set to 1
+        unsigned long long lanemask_le
+            = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (lid + 1));
+
+        // Intra wavefront offset of the lane
+        int offset = __popcll(lanemask_le & mask);
+
+        // Each wavefront writes its number of populated block columns into shared memory
+        if(lid == WFSIZE - 1)
+        {
+            scan_offsets[wid] = __popcll(mask);
+        }
+
+        // Wait for all wavefronts to finish writing
+        __syncthreads();
+
+        // Accumulate the offsets of all previous wavefronts
+        for(int i = 0; i < wid; ++i)
+        {
+            offset += scan_offsets[i];
+        }
+
+        if(has_nnzb)
+        {
+            position[hipThreadIdx_x] = row_begin_C + offset - 1;
+        }
+
+        // Wait for all positions to be computed
+        __syncthreads();
+
+        // Copy the populated blocks of the chunk into C
+        for(unsigned int i = pid; i < CHUNKSIZE; i += NPAIRS)
+        {
+            if(table[i])
+            {
+                rocsparse_int idx = position[i];
+
+                if(bi == 0 && bj == 0)
+                {
+                    bsr_col_ind_C[idx] = chunk_begin + i + idx_base_C;
+                }
+
+                if(active)
+                {
+                    bsr_val_C[BSR_IND(idx, bi, bj, dir)]
+                        = data[i * BLOCKDIM * BLOCKDIM + bi * BLOCKDIM + bj];
+                }
+            }
+        }
+
+        // Shift the entry point into C by the number of blocks of the chunk
+        for(unsigned int i = 0; i < BLOCKSIZE / WFSIZE; ++i)
+        {
+            row_begin_C += scan_offsets[i];
+        }
+
+        // Each thread loads the new chunk beginning and end point
+        chunk_begin = next_chunk;
+        chunk_end   = chunk_begin + CHUNKSIZE;
+
+        // Wait for all threads to finish load from shared memory
+        __syncthreads();
+    }
+}
+
+// Compute the blocks of C for block dimensions that exceed the shared memory, where each
+// block row is processed by a single block. The block column entries of C have to be
+// computed before. Each thread owns the same entries of all blocks in the block row, such
+// that no synchronization is required.
+template <unsigned int BLOCKSIZE, typename T>
+__device__ void
+    bsrgemm_fill_block_per_row_general_device(rocsparse_direction dir,
+                                              rocsparse_int       bsr_dim,
+                                              T                   alpha,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                                              const rocsparse_int* __restrict__ bsr_col_ind_A,
+                                              const T* __restrict__ bsr_val_A,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                                              const rocsparse_int* __restrict__ bsr_col_ind_B,
+                                              const T* __restrict__ bsr_val_B,
+                                              T beta,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr_D,
+                                              const rocsparse_int* __restrict__ bsr_col_ind_D,
+                                              const T* __restrict__ bsr_val_D,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr_C,
+                                              const rocsparse_int* __restrict__ bsr_col_ind_C,
+                                              T* __restrict__ bsr_val_C,
+                                              rocsparse_index_base idx_base_A,
+                                              rocsparse_index_base idx_base_B,
+                                              rocsparse_index_base idx_base_C,
+                                              rocsparse_index_base idx_base_D,
+                                              bool                 mul,
+                                              bool                 add)
+{
+    // Each block processes a block row
+    rocsparse_int row = hipBlockIdx_x;
+
+    rocsparse_int row_begin_C = bsr_row_ptr_C[row] - idx_base_C;
+    rocsparse_int row_end_C   = bsr_row_ptr_C[row + 1] - idx_base_C;
+
+    // Initialize the blocks of C
+    for(rocsparse_int j = row_begin_C; j < row_end_C; ++j)
+    {
+        for(rocsparse_int e = hipThreadIdx_x; e < bsr_dim * bsr_dim; e += BLOCKSIZE)
+        {
+            bsr_val_C[BSR_IND(j, e / bsr_dim, e % bsr_dim, dir)] = static_cast<T>(0);
+        }
+    }
+
+    // alpha * A * B part
+    if(mul == true)
+    {
+        rocsparse_int row_begin_A = bsr_row_ptr_A[row] - idx_base_A;
+        rocsparse_int row_end_A   = bsr_row_ptr_A[row + 1] - idx_base_A;
+
+        for(rocsparse_int j = row_begin_A; j < row_end_A; ++j)
+        {
+            // Block column of A in current block row
+            rocsparse_int col_A = bsr_col_ind_A[j] - idx_base_A;
+
+            rocsparse_int row_begin_B = bsr_row_ptr_B[col_A] - idx_base_B;
+            rocsparse_int row_end_B   = bsr_row_ptr_B[col_A + 1] - idx_base_B;
+
+            for(rocsparse_int k = row_begin_B; k < row_end_B; ++k)
+            {
+                // Position of the block in C
+                rocsparse_int idx = bsrgemm_find_block(bsr_col_ind_B[k] - idx_base_B + idx_base_C,
+                                                       bsr_col_ind_C,
+                                                       row_begin_C,
+                                                       row_end_C);
+
+                // Dense product of the block pair
+                for(rocsparse_int e = hipThreadIdx_x; e < bsr_dim * bsr_dim; e += BLOCKSIZE)
+                {
+                    rocsparse_int bi = e / bsr_dim;
+                    rocsparse_int bj = e % bsr_dim;
+
+                    T sum = static_cast<T>(0);
+
+                    for(rocsparse_int l = 0; l < bsr_dim; ++l)
+                    {
+                        sum = rocsparse_fma(bsr_val_A[BSR_IND(j, bi, l, dir)],
+                                            bsr_val_B[BSR_IND(k, l, bj, dir)],
+                                            sum);
+                    }
+
+                    bsr_val_C[BSR_IND(idx, bi, bj, dir)] += alpha * sum;
+                }
+            }
+        }
+    }
+
+    // beta * D part
+    if(add == true)
+    {
+        rocsparse_int row_begin_D = bsr_row_ptr_D[row] - idx_base_D;
+        rocsparse_int row_end_D   = bsr_row_ptr_D[row + 1] - idx_base_D;
+
+        for(rocsparse_int j = row_begin_D; j < row_end_D; ++j)
+        {
+            // Position of the block in C
+            rocsparse_int idx = bsrgemm_find_block(
+                bsr_col_ind_D[j] - idx_base_D + idx_base_C, bsr_col_ind_C, row_begin_C, row_end_C);
+
+            for(rocsparse_int e = hipThreadIdx_x; e < bsr_dim * bsr_dim; e += BLOCKSIZE)
+            {
+                rocsparse_int bi = e / bsr_dim;
+                rocsparse_int bj = e % bsr_dim;
+
+                bsr_val_C[BSR_IND(idx, bi, bj, dir)]
+                    += beta * bsr_val_D[BSR_IND(j, bi, bj, dir)];
+            }
+        }
+    }
+}
+
+#endif // BSRGEMM_DEVICE_H
@@ -368,4 +368,324 @@ __device__ void csrgeam_fill_multipass_device(rocsparse_int m,
     }
 }
 
+// Operand A_i of the n-ary matrix sum C = sum_i alpha_i * A_i
+struct csrgeam_multi_operand
+{
+    const rocsparse_int* csr_row_ptr;
+    const rocsparse_int* csr_col_ind;
+    const void*          csr_val;
+    rocsparse_index_base idx_base;
+};
+
+// Returns the position of the first entry in [begin, end) with a column index that is
+// not smaller than col
+__device__ __forceinline__ rocsparse_int
+    csrgeam_multi_lower_bound(const rocsparse_int* __restrict__ csr_col_ind,
+                              rocsparse_int begin,
+                              rocsparse_int end,
+                              rocsparse_int col)
+{
+    while(begin < end)
+    {
+        rocsparse_int mid = begin + ((end - begin) >> 1);
+
+        if(csr_col_ind[mid] < col)
+        {
+            begin = mid + 1;
+        }
+        else
+        {
+            end = mid;
+        }
+    }
+
+    return begin;
+}
+
+// Determine the first column of the current row over all operands, such that each
+// lane of the wavefront holds the result
+template <unsigned int WFSIZE>
+__device__ __forceinline__ rocsparse_int
+    csrgeam_multi_first_col(rocsparse_int row,
+                            rocsparse_int n,
+                            rocsparse_int k,
+                            const csrgeam_multi_operand* __restrict__ operands)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Each lane processes a subset of the operands
+    rocsparse_int min_col = n;
+
+    for(rocsparse_int i = lid; i < k; i += WFSIZE)
+    {
+        const csrgeam_multi_operand& A = operands[i];
+
+        rocsparse_int row_begin = A.csr_row_ptr[row] - A.idx_base;
+        rocsparse_int row_end   = A.csr_row_ptr[row + 1] - A.idx_base;
+
+        if(row_begin < row_end)
+        {
+            min_col = min(min_col, A.csr_col_ind[row_begin] - A.idx_base);
+        }
+    }
+
+    for(unsigned int i = WFSIZE >> 1; i > 0; i >>= 1)
+    {
+        min_col = min(min_col, __shfl_xor(min_col, i));
+    }
+
+    return min_col;
+}
+
+// Each lane of the wavefront loads at most one entry of the current row of A, that lies
+// within the chunk [chunk_begin, chunk_begin + WFSIZE). Since the column indices of a
+// row are sorted and unique, a single entry per lane covers the whole chunk. The entry
+// point into the row is obtained by binary search, such that no per operand state has
+// to be kept in between the chunks. Returns the position of the lanes entry in A, or -1
+// if there is none. The smallest column of A beyond the chunk is gathered in min_col.
+template <unsigned int WFSIZE>
+__device__ __forceinline__ rocsparse_int
+    csrgeam_multi_chunk_entry(rocsparse_int                row,
+                              rocsparse_int                chunk_begin,
+                              const csrgeam_multi_operand& A,
+                              rocsparse_int&               shf,
+                              rocsparse_int&               min_col)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Get row entry and exit point of A
+    rocsparse_int row_begin = A.csr_row_ptr[row] - A.idx_base;
+    rocsparse_int row_end   = A.csr_row_ptr[row + 1] - A.idx_base;
+
+    // First entry of the row that has not been processed by the previous chunks
+    rocsparse_int idx
+        = csrgeam_multi_lower_bound(A.csr_col_ind, row_begin, row_end, chunk_begin + A.idx_base)
+          + lid;
+
+    if(idx >= row_end)
+    {
+        return -1;
+    }
+
+    // Get the column of A shifted by the chunk_begin
+    rocsparse_int col = A.csr_col_ind[idx] - A.idx_base;
+    shf               = col - chunk_begin;
+
+    // Check if this column of A is within the chunk
+    if(shf >= WFSIZE)
+    {
+        // Store the first column index of A that exceeds the current chunk
+        min_col = min(min_col, col);
+        return -1;
+    }
+
+    // If the row of A fills the complete chunk, the last lane also provides the
+    // column that follows
+    if(lid == WFSIZE - 1 && idx + 1 < row_end)
+    {
+        min_col = min(min_col, A.csr_col_ind[idx + 1] - A.idx_base);
+    }
+
+    return idx;
+}
+
+// Compute non-zero entries per row of the n-ary sum, where each row is processed by a
+// wavefront. All operands are merged chunk by chunk in a single pass, similar to
+// csrgeam_nnz_multipass_device.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgeam_multi_nnz_multipass_device(rocsparse_int m,
+                                            rocsparse_int n,
+                                            rocsparse_int k,
+                                            const csrgeam_multi_operand* __restrict__ operands,
+                                            rocsparse_int* __restrict__ row_nnz)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each wavefront processes a row
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Row nnz marker
+    __shared__ bool stable[BLOCKSIZE];
+    bool*           table = &stable[wid * WFSIZE];
+
+    // Begin of the first row chunk
+    rocsparse_int chunk_begin = csrgeam_multi_first_col<WFSIZE>(row, n, k, operands);
+
+    // Initialize the row nnz for the full (wavefront-wide) row
+    rocsparse_int nnz = 0;
+
+    // Loop over the chunks until the end of all rows has been reached
+    while(chunk_begin < n)
+    {
+        // Initialize row nnz table
+        table[lid] = false;
+
+        __threadfence_block();
+
+        // Initialize the beginning of the next chunk
+        rocsparse_int min_col = n;
+
+        // Mark the columns of all operands within the chunk
+        for(rocsparse_int i = 0; i < k; ++i)
+        {
+            rocsparse_int shf;
+
+            if(csrgeam_multi_chunk_entry<WFSIZE>(row, chunk_begin, operands[i], shf, min_col)
+               >= 0)
+            {
+                table[shf] = true;
+            }
+        }
+
+        __threadfence_block();
+
+        // Compute the chunk's number of non-zeros of the row and add it to the global
+        // row nnz counter
+        nnz += __popcll(__ballot(table[lid]));
+
+        // Gather wavefront-wide minimum for the next chunks starting column index
+        for(unsigned int i = WFSIZE >> 1; i > 0; i >>= 1)
+        {
+            min_col = min(min_col, __shfl_xor(min_col, i));
+        }
+
+        // Each thread sets the new chunk beginning
+        chunk_begin = min_col;
+    }
+
+    // Last thread in each wavefront writes the accumulated total row nnz to global
+    // memory
+    if(lid == WFSIZE - 1)
+    {
+        row_nnz[row] = nnz;
+    }
+}
+
+// Compute the n-ary matrix sum, where each row is processed by a wavefront. The scalars
+// alpha_i are expected to reside in device memory.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgeam_multi_fill_multipass_device(rocsparse_int m,
+                                             rocsparse_int n,
+                                             rocsparse_int k,
+                                             const T* __restrict__ alpha,
+                                             const csrgeam_multi_operand* __restrict__ operands,
+                                             const rocsparse_int* __restrict__ csr_row_ptr_C,
+                                             rocsparse_int* __restrict__ csr_col_ind_C,
+                                             T* __restrict__ csr_val_C,
+                                             rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Wavefront id
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each wavefront processes a row
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Row entry marker and value accumulator
+    __shared__ bool stable[BLOCKSIZE];
+    __shared__ T    sdata[BLOCKSIZE];
+
+    bool* table = &stable[wid * WFSIZE];
+    T*    data  = &sdata[wid * WFSIZE];
+
+    // Get row entry point of C
+    rocsparse_int row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+
+    // Begin of the first row chunk
+    rocsparse_int chunk_begin = csrgeam_multi_first_col<WFSIZE>(row, n, k, operands);
+
+    // Loop over the chunks until the end of all rows has been reached
+    while(chunk_begin < n)
+    {
+        // Initialize row nnz table and value accumulator
+        table[lid] = false;
+        data[lid]  = static_cast<T>(0);
+
+        __threadfence_block();
+
+        // Initialize the beginning of the next chunk
+        rocsparse_int min_col = n;
+
+        // Accumulate the scaled values of all operands within the chunk
+        for(rocsparse_int i = 0; i < k; ++i)
+        {
+            const csrgeam_multi_operand& A = operands[i];
+
+            rocsparse_int shf;
+            rocsparse_int idx
+                = csrgeam_multi_chunk_entry<WFSIZE>(row, chunk_begin, A, shf, min_col);
+
+            if(idx >= 0)
+            {
+                // Mark nnz
+                table[shf] = true;
+
+                // Add scaled value of A
+                data[shf] = rocsparse_fma(
+                    alpha[i], reinterpret_cast<const T*>(A.csr_val)[idx], data[shf]);
+            }
+        }
+
+        __threadfence_block();
+
+        // Each lane checks whether there is an non-zero entry to fill or not
+        bool has_nnz = table[lid];
+
+        // Obtain the bitmask that marks the position of each non-zero entry
+        unsigned long long mask = __ballot(has_nnz);
+
+        // If the lane has an nnz assign, it must be filled into C
+        if(has_nnz)
+        {
+            rocsparse_int offset;
+
+            // Compute the lane's fill position in C
+            if(WFSIZE == 32)
+            {
+                offset = __popc(mask & (0xffffffff >> (WFSIZE - 1 - lid)));
+            }
+            else
+            {
+                offset = __popcll(mask & (0xffffffffffffffff >> (WFSIZE - 1 - lid)));
+            }
+
+            // Fill C
+            csr_col_ind_C[row_begin_C + offset - 1] = lid + chunk_begin + idx_base_C;
+            csr_val_C[row_begin_C + offset - 1]     = data[lid];
+        }
+
+        // Shift the row entry to C by the number of total nnz of the current row
+        row_begin_C += __popcll(mask);
+
+        // Gather wavefront-wide minimum for the next chunks starting column index
+        for(unsigned int i = WFSIZE >> 1; i > 0; i >>= 1)
+        {
+            min_col = min(min_col, __shfl_xor(min_col, i));
+        }
+
+        // Each thread sets the new chunk beginning
+        chunk_begin = min_col;
+    }
+}
+
 #endif // CSRGEAM_DEVICE_H
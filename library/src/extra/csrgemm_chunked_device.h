@@ -0,0 +1,51 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRGEMM_CHUNKED_DEVICE_H
+#define CSRGEMM_CHUNKED_DEVICE_H
+
+#include "common.h"
+
+// Extract the row pointer array of rows [row_begin, row_begin + m) of C,
+// shifted such that the panel starts at the index base
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_chunked_row_ptr_kernel(rocsparse_int m,
+                                        rocsparse_int row_begin,
+                                        const rocsparse_int* __restrict__ csr_row_ptr,
+                                        rocsparse_int* __restrict__ panel_row_ptr,
+                                        rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid > m)
+    {
+        return;
+    }
+
+    panel_row_ptr[gid] = csr_row_ptr[row_begin + gid] - csr_row_ptr[row_begin] + idx_base;
+}
+
+#endif // CSRGEMM_CHUNKED_DEVICE_H
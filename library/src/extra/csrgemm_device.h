@@ -27,6 +27,7 @@
 #define CSRGEMM_DEVICE_H
 
 #include "common.h"
+#include "semiring.h"
 
 // Decrement
 template <unsigned int BLOCKSIZE, typename I>
@@ -78,7 +79,9 @@ __launch_bounds__(BLOCKSIZE) __global__
                                        I* __restrict__ int_prod,
                                        rocsparse_index_base idx_base_A,
                                        bool                 mul,
-                                       bool                 add)
+                                       bool                 add,
+                                       const I* __restrict__ csr_row_ptr_M,
+                                       bool                 complement_M)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
@@ -125,6 +128,12 @@ __launch_bounds__(BLOCKSIZE) __global__
             nprod += (csr_row_ptr_D[row + 1] - csr_row_ptr_D[row]);
         }
 
+        // A structural mask bounds the number of distinct entries of the current row
+        if(csr_row_ptr_M != nullptr && complement_M == false)
+        {
+            nprod = min(nprod, csr_row_ptr_M[row + 1] - csr_row_ptr_M[row]);
+        }
+
         // Write number of intermediate products of the current row
         int_prod[row] = nprod;
     }
@@ -362,11 +371,18 @@ static __device__ __forceinline__ bool insert_key(I key, I* __restrict__ table)
     return false;
 }
 
-// Hash operation to insert pair into hash table
-template <unsigned int HASHVAL, unsigned int HASHSIZE, typename I, typename T>
+// Hash operation to insert pair into hash table, values are accumulated using the
+// addition of the given semiring
+template <unsigned int       HASHVAL,
+          unsigned int       HASHSIZE,
+          rocsparse_semiring SEMIRING = rocsparse_semiring_plus_times,
+          typename I,
+          typename T>
 static __device__ __forceinline__ void
     insert_pair(I key, T val, I* __restrict__ table, T* __restrict__ data, I empty)
 {
+    typedef rocsparse_semiring_ops<SEMIRING, T> ops;
+
     // Compute hash
     I hash = (key * HASHVAL) & (HASHSIZE - 1);
 
@@ -376,7 +392,7 @@ static __device__ __forceinline__ void
         if(table[hash] == key)
         {
             // Element already present, add value to exsiting entry
-            atomicAdd(&data[hash], val);
+            ops::atomic_add(&data[hash], val);
             break;
         }
         else if(table[hash] == empty)
@@ -385,7 +401,7 @@ static __device__ __forceinline__ void
             if(atomicCAS(&table[hash], empty, key) == empty)
             {
                 // Add value
-                atomicAdd(&data[hash], val);
+                ops::atomic_add(&data[hash], val);
                 break;
             }
         }
@@ -397,6 +413,53 @@ static __device__ __forceinline__ void
     }
 }
 
+// Check whether column col of the given row passes the structural mask, i.e. whether it
+// is present in the mask (or absent, if the mask is complemented). If no mask is given,
+// all columns pass. A non-zero triangle_M additionally restricts the columns to the upper
+// (triangle_M > 0, col >= row) or lower (triangle_M < 0, col <= row) triangle.
+template <typename I, typename J>
+static __device__ __forceinline__ bool csrgemm_mask_pass(J row,
+                                                         J col,
+                                                         const I* __restrict__ csr_row_ptr_M,
+                                                         const J* __restrict__ csr_col_ind_M,
+                                                         rocsparse_index_base idx_base_M,
+                                                         bool                 complement_M,
+                                                         int                  triangle_M)
+{
+    if((triangle_M > 0 && col < row) || (triangle_M < 0 && col > row))
+    {
+        return false;
+    }
+
+    if(csr_row_ptr_M == nullptr)
+    {
+        return true;
+    }
+
+    // Binary search for col in the (sorted) row of the mask
+    I left  = csr_row_ptr_M[row] - idx_base_M;
+    I right = csr_row_ptr_M[row + 1] - idx_base_M;
+    I end   = right;
+
+    while(left < right)
+    {
+        I mid = left + ((right - left) >> 1);
+
+        if(csr_col_ind_M[mid] - idx_base_M < col)
+        {
+            left = mid + 1;
+        }
+        else
+        {
+            right = mid;
+        }
+    }
+
+    bool found = (left < end) && (csr_col_ind_M[left] - idx_base_M == col);
+
+    return found != complement_M;
+}
+
 // Compute non-zero entries per row, where each row is processed by a single wavefront
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
@@ -419,7 +482,12 @@ __launch_bounds__(BLOCKSIZE) __global__
                                 rocsparse_index_base idx_base_B,
                                 rocsparse_index_base idx_base_D,
                                 bool                 mul,
-                                bool                 add)
+                                bool                 add,
+                                const I* __restrict__ csr_row_ptr_M,
+                                const J* __restrict__ csr_col_ind_M,
+                                rocsparse_index_base idx_base_M,
+                                bool                 complement_M,
+                                int                  triangle_M)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
@@ -475,8 +543,17 @@ __launch_bounds__(BLOCKSIZE) __global__
             // Insert all columns of B into hash table
             for(I k = row_begin_B; k < row_end_B; ++k)
             {
-                // Count the actual insertions to obtain row nnz of C
-                nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table);
+                // Column of B in row col_A
+                J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                // Count the actual insertions to obtain row nnz of C, skipping masked columns
+                bool pass = csrgemm_mask_pass(
+                    row, col_B, csr_row_ptr_M, csr_col_ind_M, idx_base_M, complement_M, triangle_M);
+
+                if(pass)
+                {
+                    nnz += insert_key<HASHVAL, HASHSIZE>(col_B, table);
+                }
             }
         }
     }
@@ -491,8 +568,17 @@ __launch_bounds__(BLOCKSIZE) __global__
         // Loop over columns of D in current row and insert all columns of D into hash table
         for(I j = row_begin_D + lid; j < row_end_D; j += WFSIZE)
         {
-            // Count the actual insertions to obtain row nnz of C
-            nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_D[j] - idx_base_D, table);
+            // Column of D in current row
+            J col_D = csr_col_ind_D[j] - idx_base_D;
+
+            // Count the actual insertions to obtain row nnz of C, skipping masked columns
+            bool pass = csrgemm_mask_pass(
+                row, col_D, csr_row_ptr_M, csr_col_ind_M, idx_base_M, complement_M, triangle_M);
+
+            if(pass)
+            {
+                nnz += insert_key<HASHVAL, HASHSIZE>(col_D, table);
+            }
         }
     }
 
@@ -528,7 +614,12 @@ __launch_bounds__(BLOCKSIZE) __global__
                                    rocsparse_index_base idx_base_B,
                                    rocsparse_index_base idx_base_D,
                                    bool                 mul,
-                                   bool                 add)
+                                   bool                 add,
+                                   const I* __restrict__ csr_row_ptr_M,
+                                   const J* __restrict__ csr_col_ind_M,
+                                   rocsparse_index_base idx_base_M,
+                                   bool                 complement_M,
+                                   int                  triangle_M)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
@@ -572,8 +663,17 @@ __launch_bounds__(BLOCKSIZE) __global__
 
             for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
             {
-                // Count the actual insertions to obtain row nnz of C
-                nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_B[k] - idx_base_B, table);
+                // Column of B in row col_A
+                J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                // Count the actual insertions to obtain row nnz of C, skipping masked columns
+                bool pass = csrgemm_mask_pass(
+                    row, col_B, csr_row_ptr_M, csr_col_ind_M, idx_base_M, complement_M, triangle_M);
+
+                if(pass)
+                {
+                    nnz += insert_key<HASHVAL, HASHSIZE>(col_B, table);
+                }
             }
         }
     }
@@ -588,8 +688,17 @@ __launch_bounds__(BLOCKSIZE) __global__
         // Loop over columns of D in current row and insert all columns of D into hash table
         for(I j = row_begin_D + wid; j < row_end_D; j += BLOCKSIZE / WFSIZE)
         {
-            // Count the actual insertions to obtain row nnz of C
-            nnz += insert_key<HASHVAL, HASHSIZE>(csr_col_ind_D[j] - idx_base_D, table);
+            // Column of D in current row
+            J col_D = csr_col_ind_D[j] - idx_base_D;
+
+            // Count the actual insertions to obtain row nnz of C, skipping masked columns
+            bool pass = csrgemm_mask_pass(
+                row, col_D, csr_row_ptr_M, csr_col_ind_M, idx_base_M, complement_M, triangle_M);
+
+            if(pass)
+            {
+                nnz += insert_key<HASHVAL, HASHSIZE>(col_D, table);
+            }
         }
     }
 
@@ -647,7 +756,12 @@ __launch_bounds__(BLOCKSIZE) __global__
                                              rocsparse_index_base idx_base_B,
                                              rocsparse_index_base idx_base_D,
                                              bool                 mul,
-                                             bool                 add)
+                                             bool                 add,
+                                             const I* __restrict__ csr_row_ptr_M,
+                                             const J* __restrict__ csr_col_ind_M,
+                                             rocsparse_index_base idx_base_M,
+                                             bool                 complement_M,
+                                             int                  triangle_M)
 {
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
@@ -728,8 +842,19 @@ __launch_bounds__(BLOCKSIZE) __global__
 
                     if(col_B >= chunk_begin && col_B < chunk_end)
                     {
-                        // Mark nnz table if entry at col_B
-                        table[col_B - chunk_begin] = true;
+                        // Mark nnz table if entry at col_B, unless it is masked
+                        bool pass = csrgemm_mask_pass(row,
+                                                      col_B,
+                                                      csr_row_ptr_M,
+                                                      csr_col_ind_M,
+                                                      idx_base_M,
+                                                      complement_M,
+                                                      triangle_M);
+
+                        if(pass)
+                        {
+                            table[col_B - chunk_begin] = true;
+                        }
                     }
                     else if(col_B >= chunk_end)
                     {
@@ -769,8 +894,19 @@ __launch_bounds__(BLOCKSIZE) __global__
 
                 if(col_D >= chunk_begin && col_D < chunk_end)
                 {
-                    // Mark nnz table if entry at col_D
-                    table[col_D - chunk_begin] = true;
+                    // Mark nnz table if entry at col_D, unless it is masked
+                    bool pass = csrgemm_mask_pass(row,
+                                                  col_D,
+                                                  csr_row_ptr_M,
+                                                  csr_col_ind_M,
+                                                  idx_base_M,
+                                                  complement_M,
+                                                  triangle_M);
+
+                    if(pass)
+                    {
+                        table[col_D - chunk_begin] = true;
+                    }
                 }
                 else if(col_D >= chunk_end)
                 {
@@ -833,12 +969,489 @@ __launch_bounds__(BLOCKSIZE) __global__
     }
 }
 
-// Compute column entries and accumulate values, where each row is processed by a single wavefront
+// Compute column entries only, where each row is processed by a single wavefront. No
+// values are read or accumulated.
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int HASHSIZE,
+          unsigned int HASHVAL,
+          typename I,
+          typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_symbolic_wf_per_row(J m,
+                                     const J* __restrict__ offset,
+                                     const J* __restrict__ perm,
+                                     const I* __restrict__ csr_row_ptr_A,
+                                     const J* __restrict__ csr_col_ind_A,
+                                     const I* __restrict__ csr_row_ptr_B,
+                                     const J* __restrict__ csr_col_ind_B,
+                                     const I* __restrict__ csr_row_ptr_C,
+                                     J* __restrict__ csr_col_ind_C,
+                                     rocsparse_index_base idx_base_A,
+                                     rocsparse_index_base idx_base_B,
+                                     rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each (sub)wavefront processes a row
+    J row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Hash table in shared memory
+    __shared__ J stable[BLOCKSIZE / WFSIZE * HASHSIZE];
+
+    // Local hash table
+    J* table = &stable[wid * HASHSIZE];
+
+    // Initialize hash table
+    for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+    {
+        table[i] = -1;
+    }
+
+    __threadfence_block();
+
+    // Bounds check
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Apply permutation, if available
+    row = perm ? perm[row + *offset] : row;
+
+    // Get row boundaries of the current row in A
+    I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Loop over columns of A in current row
+    for(I j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
+    {
+        // Column of A in current row
+        J col_A = csr_col_ind_A[j] - idx_base_A;
+
+        // Loop over columns of B in row col_A
+        I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+        I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+        // Insert all columns of B into hash table
+        for(I k = row_begin_B; k < row_end_B; ++k)
+        {
+            // Column of B in row col_A
+            J col_B = csr_col_ind_B[k] - idx_base_B;
+
+            insert_key<HASHVAL, HASHSIZE>(col_B, table);
+        }
+    }
+
+    __threadfence_block();
+
+    // Entry point of current row into C
+    I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+
+    // Loop over hash table
+    for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
+    {
+        // Get column from hash table to fill it into C
+        J col_C = table[i];
+
+        // Skip hash table entry if not present
+        if(col_C == -1)
+        {
+            continue;
+        }
+
+        // Obtain the (sorted) index into C by counting the smaller column indices
+        I idx_C = row_begin_C;
+
+        for(unsigned int hash_idx = 0; hash_idx < HASHSIZE; ++hash_idx)
+        {
+            J col = table[hash_idx];
+
+            if(col != -1 && col < col_C)
+            {
+                ++idx_C;
+            }
+        }
+
+        // Write column to the obtained position in C
+        csr_col_ind_C[idx_C] = col_C + idx_base_C;
+    }
+}
+
+// Compute column entries only, where each row is processed by a single block. No values
+// are read or accumulated.
 template <unsigned int BLOCKSIZE,
           unsigned int WFSIZE,
           unsigned int HASHSIZE,
           unsigned int HASHVAL,
           typename I,
+          typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_symbolic_block_per_row(const J* __restrict__ offset,
+                                        const J* __restrict__ perm,
+                                        const I* __restrict__ csr_row_ptr_A,
+                                        const J* __restrict__ csr_col_ind_A,
+                                        const I* __restrict__ csr_row_ptr_B,
+                                        const J* __restrict__ csr_col_ind_B,
+                                        const I* __restrict__ csr_row_ptr_C,
+                                        J* __restrict__ csr_col_ind_C,
+                                        rocsparse_index_base idx_base_A,
+                                        rocsparse_index_base idx_base_B,
+                                        rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Hash table in shared memory
+    __shared__ J table[HASHSIZE];
+
+    // Initialize hash table
+    for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
+    {
+        table[i] = -1;
+    }
+
+    // Wait for all threads to finish initialization
+    __syncthreads();
+
+    // Each block processes a row (apply permutation)
+    J row = perm[hipBlockIdx_x + *offset];
+
+    // Get row boundaries of the current row in A
+    I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Loop over columns of A in current row
+    for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+    {
+        // Column of A in current row
+        J col_A = csr_col_ind_A[j] - idx_base_A;
+
+        // Loop over columns of B in row col_A
+        I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+        I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+        for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+        {
+            // Column of B in row col_A
+            J col_B = csr_col_ind_B[k] - idx_base_B;
+
+            insert_key<HASHVAL, HASHSIZE>(col_B, table);
+        }
+    }
+
+    // Wait for hash operations to finish
+    __syncthreads();
+
+    // Compress hash table, such that valid entries come first
+    __shared__ J scan_offsets[BLOCKSIZE / warpSize + 1];
+
+    // Offset into hash table
+    J hash_offset = 0;
+
+    // Loop over the hash table and do the compression
+    for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
+    {
+        // Get column from hash table
+        J col_C = table[i];
+
+        // Boolean to store if thread owns a non-zero element
+        bool has_nnz = col_C != -1;
+
+        // Each thread obtains a bit mask of all wavefront-wide non-zero entries
+        // to compute its wavefront-wide non-zero offset
+        unsigned long long mask = __ballot(has_nnz);
+
+        // The number of bits set to 1 is the amount of wavefront-wide non-zeros
+        int nnz = __popcll(mask);
+
+        // Obtain the lane mask, where all bits lesser equal the lane id are set to 1
+        unsigned long long lanemask_le
+            = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+
+        // Compute the intra wavefront offset of the lane id by bitwise AND with the lane mask
+        int offset = __popcll(lanemask_le & mask);
+
+        // Need to sync here to make sure reading from the table has finished
+        __syncthreads();
+
+        // Each wavefront writes its nnz into shared memory so we can compute the scan offset
+        scan_offsets[hipThreadIdx_x / warpSize] = nnz;
+
+        // Wait for all wavefronts to finish writing
+        __syncthreads();
+
+        // Each thread accumulates the offset of all previous wavefronts to obtain its offset
+        for(unsigned int j = 1; j < BLOCKSIZE / warpSize; ++j)
+        {
+            if(hipThreadIdx_x >= j * warpSize)
+            {
+                offset += scan_offsets[j - 1];
+            }
+        }
+
+        // Only threads with a non-zero entry write their column
+        if(has_nnz)
+        {
+            table[hash_offset + offset - 1] = col_C;
+        }
+
+        // Last thread in block writes the block-wide offset such that all subsequent
+        // entries are shifted by this offset
+        if(hipThreadIdx_x == BLOCKSIZE - 1)
+        {
+            scan_offsets[BLOCKSIZE / warpSize - 1] = offset;
+        }
+
+        // Wait for last thread in block to finish writing
+        __syncthreads();
+
+        // Each thread reads the block-wide offset and adds it to its local offset
+        hash_offset += scan_offsets[BLOCKSIZE / warpSize - 1];
+    }
+
+    // Entry point into row of C
+    I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+    I row_end_C   = csr_row_ptr_C[row + 1] - idx_base_C;
+    J row_nnz     = row_end_C - row_begin_C;
+
+    // Loop over all valid entries in hash table
+    for(J i = hipThreadIdx_x; i < row_nnz; i += BLOCKSIZE)
+    {
+        J col_C = table[i];
+
+        // Obtain the (sorted) index into C by counting the smaller column indices
+        I idx_C = row_begin_C;
+
+        for(J j = 0; j < row_nnz; ++j)
+        {
+            if(col_C > table[j])
+            {
+                ++idx_C;
+            }
+        }
+
+        // Write column to the obtained position in C
+        csr_col_ind_C[idx_C] = col_C + idx_base_C;
+    }
+}
+
+// Compute column entries only, where each row is processed by a single block. The row
+// is split into chunks, such that shared memory can store whether a column index is
+// populated or not. No values are read or accumulated.
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int CHUNKSIZE,
+          typename I,
+          typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_symbolic_block_per_row_multipass(J n,
+                                                  const J* __restrict__ offset,
+                                                  const J* __restrict__ perm,
+                                                  const I* __restrict__ csr_row_ptr_A,
+                                                  const J* __restrict__ csr_col_ind_A,
+                                                  const I* __restrict__ csr_row_ptr_B,
+                                                  const J* __restrict__ csr_col_ind_B,
+                                                  const I* __restrict__ csr_row_ptr_C,
+                                                  J* __restrict__ csr_col_ind_C,
+                                                  I* __restrict__ workspace_B,
+                                                  rocsparse_index_base idx_base_A,
+                                                  rocsparse_index_base idx_base_B,
+                                                  rocsparse_index_base idx_base_C)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a row (apply permutation)
+    J row = perm[hipBlockIdx_x + *offset];
+
+    // Row entry marker
+    __shared__ bool table[CHUNKSIZE];
+
+    // Shared memory to communicate the scan offsets of each wavefront
+    __shared__ int scan_offsets[BLOCKSIZE / warpSize + 1];
+
+    // Shared memory to determine the minimum of all column indices of B that exceed the
+    // current chunk
+    __shared__ J next_chunk;
+
+    // Begin of the current row chunk (this is the column index of the current row)
+    J chunk_begin = 0;
+    J chunk_end   = CHUNKSIZE;
+
+    // Get row boundaries of the current row in A
+    I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Entry point into columns of C
+    I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+
+    // Loop over the row chunks until the end of the row has been reached (which is
+    // the number of total columns)
+    while(chunk_begin < n)
+    {
+        // Initialize row nnz table
+        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+        {
+            table[i] = false;
+        }
+
+        // Initialize next chunk column index
+        if(hipThreadIdx_x == 0)
+        {
+            next_chunk = n;
+        }
+
+        // Wait for all threads to finish initialization
+        __syncthreads();
+
+        // Initialize the beginning of the next chunk
+        J min_col = n;
+
+        // Loop over columns of A in current row
+        for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+        {
+            // Column of A in current row
+            J col_A = csr_col_ind_A[j] - idx_base_A;
+
+            // Loop over columns of B in row col_A
+            I row_begin_B
+                = (chunk_begin == 0) ? csr_row_ptr_B[col_A] - idx_base_B : workspace_B[j];
+            I row_end_B = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+            // Keep track of the first k where the column index of B is exceeding
+            // the current chunks end point
+            I next_k = row_begin_B + lid;
+
+            for(I k = next_k; k < row_end_B; k += WFSIZE)
+            {
+                // Column of B in row col_A
+                J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                if(col_B >= chunk_begin && col_B < chunk_end)
+                {
+                    // Mark nnz table if entry at col_B
+                    table[col_B - chunk_begin] = true;
+                }
+                else if(col_B >= chunk_end)
+                {
+                    // If column index exceeds chunks end point, store k as starting
+                    // point of the columns of B for the next pass
+                    next_k = k;
+
+                    // Store the first column index of B that exceeds the current chunk
+                    min_col = min(min_col, col_B);
+                    break;
+                }
+            }
+
+            // Obtain the minimum of all k that exceed the current chunks end point
+            rocsparse_wfreduce_min<WFSIZE>(&next_k);
+
+            // Store the minimum globally for the next chunk
+            if(lid == WFSIZE - 1)
+            {
+                workspace_B[j] = next_k;
+            }
+        }
+
+        // Gather wavefront-wide minimum for the next chunks starting column index
+        rocsparse_wfreduce_min<WFSIZE>(&min_col);
+
+        // Last thread in each wavefront finds block-wide minimum atomically
+        if(lid == WFSIZE - 1)
+        {
+            atomicMin(&next_chunk, min_col);
+        }
+
+        // Wait for all threads to finish
+        __syncthreads();
+
+        // Exclusive scan over the markers to obtain the index of each column in C
+        for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
+        {
+            bool has_nnz = table[i];
+
+            // Each thread obtains a bit mask of all wavefront-wide non-zero entries
+            // to compute its wavefront-wide non-zero offset in C
+            unsigned long long mask = __ballot(has_nnz == true);
+
+            // The number of bits set to 1 is the amount of wavefront-wide non-zeros
+            int nnz = __popcll(mask);
+
+            // Obtain the lane mask, where all bits lesser equal the lane id are set to 1
+            unsigned long long lanemask_le
+                = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+
+            // Compute the intra wavefront offset of the lane id by bitwise AND with the lane mask
+            int offset = __popcll(lanemask_le & mask);
+
+            // Each wavefront writes its nnz into shared memory so we can compute the scan
+            // offset
+            scan_offsets[hipThreadIdx_x / warpSize] = nnz;
+
+            // Wait for all wavefronts to finish writing
+            __syncthreads();
+
+            // Each thread accumulates the offset of all previous wavefronts to obtain its
+            // offset into C
+            for(unsigned int j = 1; j < BLOCKSIZE / warpSize; ++j)
+            {
+                if(hipThreadIdx_x >= j * warpSize)
+                {
+                    offset += scan_offsets[j - 1];
+                }
+            }
+
+            // Only threads with a non-zero entry write to C
+            if(has_nnz)
+            {
+                csr_col_ind_C[row_begin_C + offset - 1] = i + chunk_begin + idx_base_C;
+            }
+
+            // Wait for all threads to read the wavefront offsets
+            __syncthreads();
+
+            // Last thread in block writes the block-wide offset into C such that all
+            // subsequent entries are shifted by this offset
+            if(hipThreadIdx_x == BLOCKSIZE - 1)
+            {
+                scan_offsets[BLOCKSIZE / warpSize - 1] = offset;
+            }
+
+            // Wait for last thread in block to finish writing
+            __syncthreads();
+
+            // Each thread reads the block-wide offset and adds it to its local offset into C
+            row_begin_C += scan_offsets[BLOCKSIZE / warpSize - 1];
+
+            // Wait for all threads to read the block-wide offset
+            __syncthreads();
+        }
+
+        // Each thread loads the new chunk beginning and end point
+        chunk_begin = next_chunk;
+        chunk_end   = chunk_begin + CHUNKSIZE;
+
+        // Wait for all threads to finish load from shared memory
+        __syncthreads();
+    }
+}
+
+// Compute column entries and accumulate values, where each row is processed by a single wavefront
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          unsigned int       HASHSIZE,
+          unsigned int       HASHVAL,
+          rocsparse_semiring SEMIRING,
+          typename I,
           typename J,
           typename T>
 __device__ void csrgemm_fill_wf_per_row_device(J m,
@@ -864,8 +1477,15 @@ __device__ void csrgemm_fill_wf_per_row_device(J m,
                                                rocsparse_index_base idx_base_C,
                                                rocsparse_index_base idx_base_D,
                                                bool                 mul,
-                                               bool                 add)
+                                               bool                 add,
+                                               const I* __restrict__ csr_row_ptr_M,
+                                               const J* __restrict__ csr_col_ind_M,
+                                               rocsparse_index_base idx_base_M,
+                                               bool                 complement_M,
+                                               int                  triangle_M)
 {
+    typedef rocsparse_semiring_ops<SEMIRING, T> ops;
+
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
     // Wavefront id
@@ -886,7 +1506,7 @@ __device__ void csrgemm_fill_wf_per_row_device(J m,
     for(unsigned int i = lid; i < HASHSIZE; i += WFSIZE)
     {
         table[i] = nk;
-        data[i]  = static_cast<T>(0);
+        data[i]  = ops::zero();
     }
 
     __threadfence_block();
@@ -913,7 +1533,7 @@ __device__ void csrgemm_fill_wf_per_row_device(J m,
             // Column of A in current row
             J col_A = csr_col_ind_A[j] - idx_base_A;
             // Value of A in current row
-            T val_A = alpha * csr_val_A[j];
+            T val_A = ops::mul(alpha, csr_val_A[j]);
 
             // Loop over columns of B in row col_A
             I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
@@ -922,9 +1542,18 @@ __device__ void csrgemm_fill_wf_per_row_device(J m,
             // Insert all columns of B into hash table
             for(I k = row_begin_B; k < row_end_B; ++k)
             {
-                // Insert key value pair into hash table
-                insert_pair<HASHVAL, HASHSIZE>(
-                    csr_col_ind_B[k] - idx_base_B, val_A * csr_val_B[k], table, data, nk);
+                // Column of B in row col_A
+                J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                // Insert key value pair into hash table, unless it is masked
+                bool pass = csrgemm_mask_pass(
+                    row, col_B, csr_row_ptr_M, csr_col_ind_M, idx_base_M, complement_M, triangle_M);
+
+                if(pass)
+                {
+                    insert_pair<HASHVAL, HASHSIZE, SEMIRING>(
+                        col_B, ops::mul(val_A, csr_val_B[k]), table, data, nk);
+                }
             }
         }
     }
@@ -939,9 +1568,18 @@ __device__ void csrgemm_fill_wf_per_row_device(J m,
         // Loop over columns of D in current row and insert all columns of D into hash table
         for(I j = row_begin_D + lid; j < row_end_D; j += WFSIZE)
         {
-            // Insert key value pair into hash table
-            insert_pair<HASHVAL, HASHSIZE>(
-                csr_col_ind_D[j] - idx_base_D, beta * csr_val_D[j], table, data, nk);
+            // Column of D in current row
+            J col_D = csr_col_ind_D[j] - idx_base_D;
+
+            // Insert key value pair into hash table, unless it is masked
+            bool pass = csrgemm_mask_pass(
+                row, col_D, csr_row_ptr_M, csr_col_ind_M, idx_base_M, complement_M, triangle_M);
+
+            if(pass)
+            {
+                insert_pair<HASHVAL, HASHSIZE, SEMIRING>(
+                    col_D, ops::mul(beta, csr_val_D[j]), table, data, nk);
+            }
         }
     }
 
@@ -991,10 +1629,11 @@ __device__ void csrgemm_fill_wf_per_row_device(J m,
 }
 
 // Compute column entries and accumulate values, where each row is processed by a single block
-template <unsigned int BLOCKSIZE,
-          unsigned int WFSIZE,
-          unsigned int HASHSIZE,
-          unsigned int HASHVAL,
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          unsigned int       HASHSIZE,
+          unsigned int       HASHVAL,
+          rocsparse_semiring SEMIRING,
           typename I,
           typename J,
           typename T>
@@ -1020,8 +1659,15 @@ __device__ void csrgemm_fill_block_per_row_device(J nk,
                                                   rocsparse_index_base idx_base_C,
                                                   rocsparse_index_base idx_base_D,
                                                   bool                 mul,
-                                                  bool                 add)
+                                                  bool                 add,
+                                                  const I* __restrict__ csr_row_ptr_M,
+                                                  const J* __restrict__ csr_col_ind_M,
+                                                  rocsparse_index_base idx_base_M,
+                                                  bool                 complement_M,
+                                                  int                  triangle_M)
 {
+    typedef rocsparse_semiring_ops<SEMIRING, T> ops;
+
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
     // Wavefront id
@@ -1035,7 +1681,7 @@ __device__ void csrgemm_fill_block_per_row_device(J nk,
     for(unsigned int i = hipThreadIdx_x; i < HASHSIZE; i += BLOCKSIZE)
     {
         table[i] = nk;
-        data[i]  = static_cast<T>(0);
+        data[i]  = ops::zero();
     }
 
     // Wait for all threads to finish initialization
@@ -1057,7 +1703,7 @@ __device__ void csrgemm_fill_block_per_row_device(J nk,
             // Column of A in current row
             J col_A = csr_col_ind_A[j] - idx_base_A;
             // Value of A in current row
-            T val_A = alpha * csr_val_A[j];
+            T val_A = ops::mul(alpha, csr_val_A[j]);
 
             // Loop over columns of B in row col_A
             I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
@@ -1065,9 +1711,18 @@ __device__ void csrgemm_fill_block_per_row_device(J nk,
 
             for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
             {
-                // Insert key value pair into hash table
-                insert_pair<HASHVAL, HASHSIZE>(
-                    csr_col_ind_B[k] - idx_base_B, val_A * csr_val_B[k], table, data, nk);
+                // Column of B in row col_A
+                J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                // Insert key value pair into hash table, unless it is masked
+                bool pass = csrgemm_mask_pass(
+                    row, col_B, csr_row_ptr_M, csr_col_ind_M, idx_base_M, complement_M, triangle_M);
+
+                if(pass)
+                {
+                    insert_pair<HASHVAL, HASHSIZE, SEMIRING>(
+                        col_B, ops::mul(val_A, csr_val_B[k]), table, data, nk);
+                }
             }
         }
     }
@@ -1082,9 +1737,18 @@ __device__ void csrgemm_fill_block_per_row_device(J nk,
         // Loop over columns of D in current row and insert all columns of D into hash table
         for(I j = row_begin_D + hipThreadIdx_x; j < row_end_D; j += BLOCKSIZE)
         {
-            // Insert key value pair into hash table
-            insert_pair<HASHVAL, HASHSIZE>(
-                csr_col_ind_D[j] - idx_base_D, beta * csr_val_D[j], table, data, nk);
+            // Column of D in current row
+            J col_D = csr_col_ind_D[j] - idx_base_D;
+
+            // Insert key value pair into hash table, unless it is masked
+            bool pass = csrgemm_mask_pass(
+                row, col_D, csr_row_ptr_M, csr_col_ind_M, idx_base_M, complement_M, triangle_M);
+
+            if(pass)
+            {
+                insert_pair<HASHVAL, HASHSIZE, SEMIRING>(
+                    col_D, ops::mul(beta, csr_val_D[j]), table, data, nk);
+            }
         }
     }
 
@@ -1202,9 +1866,10 @@ __device__ void csrgemm_fill_block_per_row_device(J nk,
 // block. Splitting row into several chunks such that we can use shared memory to store
 // whether a column index is populated or not. Each row has at least 4097 non-zero
 // entries to compute.
-template <unsigned int BLOCKSIZE,
-          unsigned int WFSIZE,
-          unsigned int CHUNKSIZE,
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          unsigned int       CHUNKSIZE,
+          rocsparse_semiring SEMIRING,
           typename I,
           typename J,
           typename T>
@@ -1231,8 +1896,15 @@ __device__ void csrgemm_fill_block_per_row_multipass_device(J n,
                                                             rocsparse_index_base idx_base_C,
                                                             rocsparse_index_base idx_base_D,
                                                             bool                 mul,
-                                                            bool                 add)
+                                                            bool                 add,
+                                                            const I* __restrict__ csr_row_ptr_M,
+                                                            const J* __restrict__ csr_col_ind_M,
+                                                            rocsparse_index_base idx_base_M,
+                                                            bool                 complement_M,
+                                                            int                  triangle_M)
 {
+    typedef rocsparse_semiring_ops<SEMIRING, T> ops;
+
     // Lane id
     int lid = hipThreadIdx_x & (WFSIZE - 1);
     // Wavefront id
@@ -1268,7 +1940,7 @@ __device__ void csrgemm_fill_block_per_row_multipass_device(J n,
         for(int i = hipThreadIdx_x; i < CHUNKSIZE; i += BLOCKSIZE)
         {
             table[i] = 0;
-            data[i]  = static_cast<T>(0);
+            data[i]  = ops::zero();
         }
 
         // Initialize next chunk column index
@@ -1293,7 +1965,7 @@ __device__ void csrgemm_fill_block_per_row_multipass_device(J n,
                 J col_A = csr_col_ind_A[j] - idx_base_A;
 
                 // Value of A in current row
-                T val_A = alpha * csr_val_A[j];
+                T val_A = ops::mul(alpha, csr_val_A[j]);
 
                 // Loop over columns of B in row col_A
                 I row_begin_B
@@ -1312,11 +1984,24 @@ __device__ void csrgemm_fill_block_per_row_multipass_device(J n,
 
                     if(col_B >= chunk_begin && col_B < chunk_end)
                     {
-                        // Mark nnz table if entry at col_B
-                        table[col_B - chunk_begin] = 1;
-
-                        // Atomically accumulate the intermediate products
-                        atomicAdd(&data[col_B - chunk_begin], val_A * csr_val_B[k]);
+                        // Skip entries that are masked
+                        bool pass = csrgemm_mask_pass(row,
+                                                      col_B,
+                                                      csr_row_ptr_M,
+                                                      csr_col_ind_M,
+                                                      idx_base_M,
+                                                      complement_M,
+                                                      triangle_M);
+
+                        if(pass)
+                        {
+                            // Mark nnz table if entry at col_B
+                            table[col_B - chunk_begin] = 1;
+
+                            // Atomically accumulate the intermediate products
+                            ops::atomic_add(&data[col_B - chunk_begin],
+                                            ops::mul(val_A, csr_val_B[k]));
+                        }
                     }
                     else if(col_B >= chunk_end)
                     {
@@ -1356,11 +2041,24 @@ __device__ void csrgemm_fill_block_per_row_multipass_device(J n,
 
                 if(col_D >= chunk_begin && col_D < chunk_end)
                 {
-                    // Mark nnz table if entry at col_D
-                    table[col_D - chunk_begin] = 1;
+                    // Skip entries that are masked
+                    bool pass = csrgemm_mask_pass(row,
+                                                  col_D,
+                                                  csr_row_ptr_M,
+                                                  csr_col_ind_M,
+                                                  idx_base_M,
+                                                  complement_M,
+                                                  triangle_M);
+
+                    if(pass)
+                    {
+                        // Mark nnz table if entry at col_D
+                        table[col_D - chunk_begin] = 1;
 
-                    // Atomically accumulate the entry of D
-                    atomicAdd(&data[col_D - chunk_begin], beta * csr_val_D[j]);
+                        // Atomically accumulate the entry of D
+                        ops::atomic_add(&data[col_D - chunk_begin],
+                                        ops::mul(beta, csr_val_D[j]));
+                    }
                 }
                 else if(col_D >= chunk_end)
                 {
@@ -0,0 +1,338 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRGEMM_ESC_DEVICE_H
+#define CSRGEMM_ESC_DEVICE_H
+
+#include "common.h"
+#include "csrgemm_device.h"
+#include "semiring.h"
+
+// Expand-sort-compress (ESC) for rows of C with a large number of non-zero entries.
+// All intermediate products of a row are expanded into a global buffer, sorted by
+// column index and duplicates are compressed into a single entry of C afterwards.
+
+// Compute the number of expanded entries of each row of the group, where each
+// (sub)wavefront processes a row
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_esc_row_products(J size,
+                                  const J* __restrict__ offset,
+                                  const J* __restrict__ perm,
+                                  const I* __restrict__ csr_row_ptr_A,
+                                  const J* __restrict__ csr_col_ind_A,
+                                  const I* __restrict__ csr_row_ptr_B,
+                                  const I* __restrict__ csr_row_ptr_D,
+                                  I* __restrict__ esc_row_ptr,
+                                  rocsparse_index_base idx_base_A,
+                                  bool                 mul,
+                                  bool                 add)
+{
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Each (sub)wavefront processes a row of the group
+    J idx = (hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x) / WFSIZE;
+
+    // Bounds check
+    if(idx >= size)
+    {
+        return;
+    }
+
+    // Apply permutation
+    J row = perm[idx + *offset];
+
+    // Initialize expanded entry counter of current row
+    I nprod = 0;
+
+    // alpha * A * B part
+    if(mul == true)
+    {
+        I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+        I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+        for(I j = row_begin_A + lid; j < row_end_A; j += WFSIZE)
+        {
+            J col_A = csr_col_ind_A[j] - idx_base_A;
+
+            nprod += (csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A]);
+        }
+
+        // Gather nprod
+        rocsparse_wfreduce_sum<WFSIZE>(&nprod);
+    }
+
+    // Last lane writes result
+    if(lid == WFSIZE - 1)
+    {
+        // beta * D part
+        if(add == true)
+        {
+            nprod += (csr_row_ptr_D[row + 1] - csr_row_ptr_D[row]);
+        }
+
+        esc_row_ptr[idx] = nprod;
+    }
+
+    // Last entry is used for the exclusive scan
+    if(idx == 0 && lid == 0)
+    {
+        esc_row_ptr[size] = 0;
+    }
+}
+
+// Expand all intermediate products of a row into the ESC buffer, where each block
+// processes a row. Products that are excluded by the mask get column index n, such
+// that they are sorted to the end of the row and skipped during compression.
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          rocsparse_semiring SEMIRING,
+          typename I,
+          typename J,
+          typename T>
+__device__ void csrgemm_esc_expand_device(J n,
+                                          const J* __restrict__ offset,
+                                          const J* __restrict__ perm,
+                                          T alpha,
+                                          const I* __restrict__ csr_row_ptr_A,
+                                          const J* __restrict__ csr_col_ind_A,
+                                          const T* __restrict__ csr_val_A,
+                                          const I* __restrict__ csr_row_ptr_B,
+                                          const J* __restrict__ csr_col_ind_B,
+                                          const T* __restrict__ csr_val_B,
+                                          T beta,
+                                          const I* __restrict__ csr_row_ptr_D,
+                                          const J* __restrict__ csr_col_ind_D,
+                                          const T* __restrict__ csr_val_D,
+                                          const I* __restrict__ esc_row_ptr,
+                                          J* __restrict__ esc_col_ind,
+                                          T* __restrict__ esc_val,
+                                          rocsparse_index_base idx_base_A,
+                                          rocsparse_index_base idx_base_B,
+                                          rocsparse_index_base idx_base_D,
+                                          bool                 mul,
+                                          bool                 add,
+                                          const I* __restrict__ csr_row_ptr_M,
+                                          const J* __restrict__ csr_col_ind_M,
+                                          rocsparse_index_base idx_base_M,
+                                          bool                 complement_M,
+                                          int                  triangle_M)
+{
+    typedef rocsparse_semiring_ops<SEMIRING, T> ops;
+
+    // Lane id
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    // Wavefront id
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Each block processes a row (apply permutation)
+    J row = perm[hipBlockIdx_x + *offset];
+
+    // Entry point into the ESC buffer
+    I esc_begin = esc_row_ptr[hipBlockIdx_x];
+    I esc_end   = esc_row_ptr[hipBlockIdx_x + 1];
+
+    // Number of expanded products of the current row
+    __shared__ unsigned long long fill;
+
+    if(hipThreadIdx_x == 0)
+    {
+        fill = 0;
+    }
+
+    __syncthreads();
+
+    // alpha * A * B part
+    if(mul == true)
+    {
+        I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+        I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+        // Loop over columns of A in current row
+        for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+        {
+            // Column of A in current row
+            J col_A = csr_col_ind_A[j] - idx_base_A;
+
+            // Value of A in current row
+            T val_A = ops::mul(alpha, csr_val_A[j]);
+
+            I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+            I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+            // Reserve space for all products with the current row of B
+            I pos = 0;
+
+            if(lid == 0)
+            {
+                pos = esc_begin
+                      + static_cast<I>(atomicAdd(
+                          &fill, static_cast<unsigned long long>(row_end_B - row_begin_B)));
+            }
+
+            pos = __shfl(pos, 0, WFSIZE);
+
+            // Loop over columns of B in row col_A
+            for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+            {
+                // Column of B in row col_A
+                J col_B = csr_col_ind_B[k] - idx_base_B;
+
+                // Masked entries are moved to the end of the row
+                bool pass = csrgemm_mask_pass(
+                    row, col_B, csr_row_ptr_M, csr_col_ind_M, idx_base_M, complement_M, triangle_M);
+
+                esc_col_ind[pos + k - row_begin_B] = pass ? col_B : n;
+                esc_val[pos + k - row_begin_B]     = ops::mul(val_A, csr_val_B[k]);
+            }
+        }
+    }
+
+    // beta * D part
+    if(add == true)
+    {
+        I row_begin_D = csr_row_ptr_D[row] - idx_base_D;
+        I row_end_D   = csr_row_ptr_D[row + 1] - idx_base_D;
+
+        // Entries of D are placed behind the products of the current row
+        I pos = esc_end - (row_end_D - row_begin_D);
+
+        // Loop over columns of D in current row
+        for(I j = row_begin_D + hipThreadIdx_x; j < row_end_D; j += BLOCKSIZE)
+        {
+            // Column of D in current row
+            J col_D = csr_col_ind_D[j] - idx_base_D;
+
+            // Masked entries are moved to the end of the row
+            bool pass = csrgemm_mask_pass(
+                row, col_D, csr_row_ptr_M, csr_col_ind_M, idx_base_M, complement_M, triangle_M);
+
+            esc_col_ind[pos + j - row_begin_D] = pass ? col_D : n;
+            esc_val[pos + j - row_begin_D]     = ops::mul(beta, csr_val_D[j]);
+        }
+    }
+}
+
+// Compress the sorted ESC buffer into C, where each block processes a row. Each thread
+// that holds the first occurrence of a column index accumulates all its duplicates.
+template <unsigned int BLOCKSIZE, rocsparse_semiring SEMIRING, typename I, typename J, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_esc_compress(J n,
+                              const J* __restrict__ offset,
+                              const J* __restrict__ perm,
+                              const I* __restrict__ esc_row_ptr,
+                              const J* __restrict__ esc_col_ind,
+                              const T* __restrict__ esc_val,
+                              const I* __restrict__ csr_row_ptr_C,
+                              J* __restrict__ csr_col_ind_C,
+                              T* __restrict__ csr_val_C,
+                              rocsparse_index_base idx_base_C)
+{
+    typedef rocsparse_semiring_ops<SEMIRING, T> ops;
+
+    // Each block processes a row (apply permutation)
+    J row = perm[hipBlockIdx_x + *offset];
+
+    // Sorted entries of the current row
+    I esc_begin = esc_row_ptr[hipBlockIdx_x];
+    I esc_end   = esc_row_ptr[hipBlockIdx_x + 1];
+
+    // Entry point into columns of C
+    I row_begin_C = csr_row_ptr_C[row] - idx_base_C;
+
+    // Shared memory to communicate the scan offsets of each wavefront
+    __shared__ int scan_offsets[BLOCKSIZE / 32];
+
+    for(I chunk = esc_begin; chunk < esc_end; chunk += BLOCKSIZE)
+    {
+        I i = chunk + hipThreadIdx_x;
+
+        // Column index of the current entry, entries beyond the row end are treated
+        // as masked
+        J col = (i < esc_end) ? esc_col_ind[i] : n;
+
+        // First occurrence of a column index
+        bool head = (col < n) && (i == esc_begin || esc_col_ind[i - 1] != col);
+
+        // Wavefront-wide number of first occurrences and intra wavefront offset
+        unsigned long long mask = __ballot(head == true);
+
+        int nnz = __popcll(mask);
+
+        unsigned long long lanemask_le
+            = UINT64_MAX >> (sizeof(unsigned long long) * CHAR_BIT - (__lane_id() + 1));
+
+        int offset_C = __popcll(lanemask_le & mask);
+
+        // Each wavefront writes its nnz into shared memory to compute the scan offset
+        scan_offsets[hipThreadIdx_x / warpSize] = nnz;
+
+        // Wait for all wavefronts to finish writing
+        __syncthreads();
+
+        // Each thread accumulates the offset of all previous wavefronts
+        for(unsigned int j = 1; j < BLOCKSIZE / warpSize; ++j)
+        {
+            if(hipThreadIdx_x >= j * warpSize)
+            {
+                offset_C += scan_offsets[j - 1];
+            }
+        }
+
+        // First occurrences accumulate all duplicates of their column and write to C
+        if(head)
+        {
+            T sum = esc_val[i];
+
+            for(I k = i + 1; k < esc_end && esc_col_ind[k] == col; ++k)
+            {
+                sum = ops::add(sum, esc_val[k]);
+            }
+
+            I idx = row_begin_C + offset_C - 1;
+
+            csr_col_ind_C[idx] = col + idx_base_C;
+            csr_val_C[idx]     = sum;
+        }
+
+        // Last thread in block writes the block-wide offset into C
+        if(hipThreadIdx_x == BLOCKSIZE - 1)
+        {
+            scan_offsets[BLOCKSIZE / warpSize - 1] = offset_C;
+        }
+
+        // Wait for last thread in block to finish writing
+        __syncthreads();
+
+        // Each thread adds the block-wide offset to its offset into C
+        row_begin_C += scan_offsets[BLOCKSIZE / warpSize - 1];
+
+        // Wait for all threads to finish reading from shared memory
+        __syncthreads();
+    }
+}
+
+#endif // CSRGEMM_ESC_DEVICE_H
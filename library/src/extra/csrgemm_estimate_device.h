@@ -0,0 +1,235 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRGEMM_ESTIMATE_DEVICE_H
+#define CSRGEMM_ESTIMATE_DEVICE_H
+
+#include "common.h"
+#include "csrgemm_device.h"
+
+// Compute the number of intermediate products of A * B, partial sums per block
+template <unsigned int BLOCKSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_estimate_products_part1(I nnz_A,
+                                         const J* __restrict__ csr_col_ind_A,
+                                         const I* __restrict__ csr_row_ptr_B,
+                                         int64_t* __restrict__ workspace,
+                                         rocsparse_index_base idx_base_A)
+{
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Each non-zero entry of A generates as many products as the corresponding row of B
+    // has non-zero entries
+    int64_t sum = 0;
+
+    for(I j = gid; j < nnz_A; j += hipGridDim_x * BLOCKSIZE)
+    {
+        J col_A = csr_col_ind_A[j] - idx_base_A;
+
+        sum += csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A];
+    }
+
+    // Shared memory for block reduction
+    __shared__ int64_t sdata[BLOCKSIZE];
+
+    sdata[hipThreadIdx_x] = sum;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(hipThreadIdx_x, sdata);
+
+    if(hipThreadIdx_x == 0)
+    {
+        workspace[hipBlockIdx_x] = sdata[0];
+    }
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_estimate_products_part2(int64_t* __restrict__ workspace)
+{
+    // Shared memory for block reduction
+    __shared__ int64_t sdata[BLOCKSIZE];
+
+    sdata[hipThreadIdx_x] = workspace[hipThreadIdx_x];
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(hipThreadIdx_x, sdata);
+
+    if(hipThreadIdx_x == 0)
+    {
+        workspace[0] = sdata[0];
+    }
+}
+
+// Count the intermediate products and the non-zero entries of sampled rows of C.
+// Each block processes a single sampled row. Rows with at most HASHSIZE intermediate
+// products are counted exactly using a hash table, longer rows are counted
+// probabilistically using linear counting on a bitmap of BITMAPSIZE bits.
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int HASHSIZE,
+          unsigned int BITMAPSIZE,
+          unsigned int HASHVAL,
+          typename I,
+          typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_estimate_sample(J m,
+                                 J n,
+                                 J nsamples,
+                                 const I* __restrict__ csr_row_ptr_A,
+                                 const J* __restrict__ csr_col_ind_A,
+                                 const I* __restrict__ csr_row_ptr_B,
+                                 const J* __restrict__ csr_col_ind_B,
+                                 int64_t* __restrict__ sample_products,
+                                 double* __restrict__ sample_nnz,
+                                 rocsparse_index_base idx_base_A,
+                                 rocsparse_index_base idx_base_B)
+{
+    int tid = hipThreadIdx_x;
+
+    // Lane id and wavefront id
+    int lid = tid & (WFSIZE - 1);
+    int wid = tid / WFSIZE;
+
+    // Sampled rows are evenly distributed over all rows
+    J row = (static_cast<int64_t>(hipBlockIdx_x) * m) / nsamples;
+
+    // Shared memory
+    __shared__ int64_t      sdata[BLOCKSIZE];
+    __shared__ J            stable[HASHSIZE];
+    __shared__ unsigned int sbitmap[BITMAPSIZE / 32];
+
+    // Row boundaries of A
+    I row_begin_A = csr_row_ptr_A[row] - idx_base_A;
+    I row_end_A   = csr_row_ptr_A[row + 1] - idx_base_A;
+
+    // Count intermediate products of the sampled row
+    int64_t nprod = 0;
+
+    for(I j = row_begin_A + tid; j < row_end_A; j += BLOCKSIZE)
+    {
+        J col_A = csr_col_ind_A[j] - idx_base_A;
+
+        nprod += csr_row_ptr_B[col_A + 1] - csr_row_ptr_B[col_A];
+    }
+
+    sdata[tid] = nprod;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdata);
+
+    nprod = sdata[0];
+
+    // Exact count if the row fits into the hash table
+    bool exact = (nprod <= HASHSIZE);
+
+    // Initialize hash table or bitmap
+    if(exact)
+    {
+        for(unsigned int i = tid; i < HASHSIZE; i += BLOCKSIZE)
+        {
+            stable[i] = -1;
+        }
+    }
+    else
+    {
+        for(unsigned int i = tid; i < BITMAPSIZE / 32; i += BLOCKSIZE)
+        {
+            sbitmap[i] = 0;
+        }
+    }
+
+    __syncthreads();
+
+    // Number of exact insertions
+    int64_t nnz = 0;
+
+    // Each wavefront processes a column of A, lanes process the columns of B
+    for(I j = row_begin_A + wid; j < row_end_A; j += BLOCKSIZE / WFSIZE)
+    {
+        J col_A = csr_col_ind_A[j] - idx_base_A;
+
+        I row_begin_B = csr_row_ptr_B[col_A] - idx_base_B;
+        I row_end_B   = csr_row_ptr_B[col_A + 1] - idx_base_B;
+
+        for(I k = row_begin_B + lid; k < row_end_B; k += WFSIZE)
+        {
+            J col_B = csr_col_ind_B[k] - idx_base_B;
+
+            if(exact)
+            {
+                nnz += insert_key<HASHVAL, HASHSIZE>(col_B, stable);
+            }
+            else
+            {
+                unsigned int hash
+                    = ((static_cast<uint64_t>(col_B) * 0x9E3779B97F4A7C15ULL) >> 32)
+                      & (BITMAPSIZE - 1);
+
+                atomicOr(&sbitmap[hash >> 5], 1U << (hash & 31));
+            }
+        }
+    }
+
+    __syncthreads();
+
+    // Count unset bits for linear counting
+    if(!exact)
+    {
+        for(unsigned int i = tid; i < BITMAPSIZE / 32; i += BLOCKSIZE)
+        {
+            nnz += 32 - __popc(sbitmap[i]);
+        }
+    }
+
+    sdata[tid] = nnz;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        double nnz_row = static_cast<double>(sdata[0]);
+
+        if(!exact)
+        {
+            // Linear counting estimate, bounded by the number of products and columns
+            nnz_row = (sdata[0] == 0) ? static_cast<double>(nprod)
+                                      : -static_cast<double>(BITMAPSIZE)
+                                            * log(nnz_row / static_cast<double>(BITMAPSIZE));
+
+            nnz_row = min(nnz_row, static_cast<double>(min(nprod, static_cast<int64_t>(n))));
+        }
+
+        sample_products[hipBlockIdx_x] = nprod;
+        sample_nnz[hipBlockIdx_x]      = nnz_row;
+    }
+}
+
+#endif // CSRGEMM_ESTIMATE_DEVICE_H
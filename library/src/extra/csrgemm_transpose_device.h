@@ -0,0 +1,194 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+#ifndef CSRGEMM_TRANSPOSE_DEVICE_H
+#define CSRGEMM_TRANSPOSE_DEVICE_H
+
+#include "common.h"
+
+// Row pointers of the transposed sparsity pattern, obtained by binary search of each
+// column index in the column sorted entries of the original matrix
+template <unsigned int BLOCKSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_transpose_row_ptr(J q,
+                                   I nnz,
+                                   const J* __restrict__ sorted_col_ind,
+                                   I* __restrict__ csr_row_ptr_T,
+                                   rocsparse_index_base idx_base)
+{
+    J col = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(col > q)
+    {
+        return;
+    }
+
+    // Lower bound of col in the sorted column indices
+    I low  = 0;
+    I high = nnz;
+
+    while(low < high)
+    {
+        I mid = low + ((high - low) >> 1);
+
+        if(sorted_col_ind[mid] < col + idx_base)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    csr_row_ptr_T[col] = low + idx_base;
+}
+
+// Store the permutation into the values of the original matrix and gather its row
+// indices into the column indices of the transposed pattern
+template <unsigned int BLOCKSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_transpose_col_ind(I nnz,
+                                   const I* __restrict__ perm,
+                                   const J* __restrict__ coo_row_ind,
+                                   I* __restrict__ perm_T,
+                                   J* __restrict__ csr_col_ind_T)
+{
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    I idx = perm[gid];
+
+    perm_T[gid]        = idx;
+    csr_col_ind_T[gid] = coo_row_ind[idx];
+}
+
+// Gather the values of the original matrix into the transposed pattern
+template <unsigned int BLOCKSIZE, typename I, typename T>
+__launch_bounds__(BLOCKSIZE) __global__ void csrgemm_transpose_gather(I nnz,
+                                                                     const I* __restrict__ perm_T,
+                                                                     const T* __restrict__ csr_val,
+                                                                     T* __restrict__ csr_val_T)
+{
+    I gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    csr_val_T[gid] = csr_val[perm_T[gid]];
+}
+
+// If C is symmetric, only the triangle selected by its fill mode is computed. The triangle
+// is filtered by the kernels of the non-transposed product, unless the product op(A) * op(B)
+// is empty, in which case the entries of beta * D within the triangle are copied into C.
+
+// Check whether column col of the given row is part of the triangle selected by fill_mode
+template <typename J>
+__device__ __forceinline__ bool
+    csrgemm_symmetric_in_triangle(J row, J col, rocsparse_fill_mode fill_mode)
+{
+    return (fill_mode == rocsparse_fill_mode_upper) ? (col >= row) : (col <= row);
+}
+
+// Number of non-zero entries of each row of the triangle of D. Each thread processes a row.
+template <unsigned int BLOCKSIZE, typename I, typename J>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_symmetric_row_nnz(J m,
+                                   const I* __restrict__ csr_row_ptr_D,
+                                   const J* __restrict__ csr_col_ind_D,
+                                   I* __restrict__ row_nnz,
+                                   rocsparse_index_base idx_base_D,
+                                   rocsparse_fill_mode  fill_mode)
+{
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    I row_begin = csr_row_ptr_D[row] - idx_base_D;
+    I row_end   = csr_row_ptr_D[row + 1] - idx_base_D;
+
+    I nnz = 0;
+
+    for(I j = row_begin; j < row_end; ++j)
+    {
+        if(csrgemm_symmetric_in_triangle(row, csr_col_ind_D[j] - idx_base_D, fill_mode))
+        {
+            ++nnz;
+        }
+    }
+
+    row_nnz[row] = nnz;
+}
+
+// Copy the entries of beta * D within the triangle into C. Each thread processes a row.
+template <unsigned int BLOCKSIZE, typename I, typename J, typename T>
+__device__ void csrgemm_symmetric_fill_device(J m,
+                                              T beta,
+                                              const I* __restrict__ csr_row_ptr_D,
+                                              const J* __restrict__ csr_col_ind_D,
+                                              const T* __restrict__ csr_val_D,
+                                              const I* __restrict__ csr_row_ptr_C,
+                                              J* __restrict__ csr_col_ind_C,
+                                              T* __restrict__ csr_val_C,
+                                              rocsparse_index_base idx_base_D,
+                                              rocsparse_index_base idx_base_C,
+                                              rocsparse_fill_mode  fill_mode)
+{
+    J row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    I row_begin = csr_row_ptr_D[row] - idx_base_D;
+    I row_end   = csr_row_ptr_D[row + 1] - idx_base_D;
+
+    I idx = csr_row_ptr_C[row] - idx_base_C;
+
+    for(I j = row_begin; j < row_end; ++j)
+    {
+        J col = csr_col_ind_D[j] - idx_base_D;
+
+        if(csrgemm_symmetric_in_triangle(row, col, fill_mode))
+        {
+            csr_col_ind_C[idx] = col + idx_base_C;
+            csr_val_C[idx]     = beta * csr_val_D[j];
+            ++idx;
+        }
+    }
+}
+
+#endif // CSRGEMM_TRANSPOSE_DEVICE_H
@@ -0,0 +1,89 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRRAP_DEVICE_H
+#define CSRRAP_DEVICE_H
+
+#include "common.h"
+
+// Set all row pointers to the index base, representing an empty matrix
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrap_set_base_kernel(rocsparse_int        m,
+                                rocsparse_int*       csr_row_ptr,
+                                rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid > m)
+    {
+        return;
+    }
+
+    csr_row_ptr[gid] = idx_base;
+}
+
+// Store the permutation into the values of R and gather the row indices of R
+// into the column indices of R^T
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrap_transpose_kernel(rocsparse_int nnz,
+                                 const rocsparse_int* __restrict__ perm,
+                                 const rocsparse_int* __restrict__ coo_row_ind,
+                                 rocsparse_int* __restrict__ rt_perm,
+                                 rocsparse_int* __restrict__ rt_col_ind)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    rocsparse_int idx = perm[gid];
+
+    rt_perm[gid]    = idx;
+    rt_col_ind[gid] = coo_row_ind[idx];
+}
+
+// Gather the values of R into R^T
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrap_gather_kernel(rocsparse_int nnz,
+                              const rocsparse_int* __restrict__ rt_perm,
+                              const T* __restrict__ csr_val,
+                              T* __restrict__ rt_val)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nnz)
+    {
+        return;
+    }
+
+    rt_val[gid] = csr_val[rt_perm[gid]];
+}
+
+#endif // CSRRAP_DEVICE_H
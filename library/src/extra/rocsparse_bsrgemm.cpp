@@ -0,0 +1,967 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "bsrgemm_device.h"
+#include "definitions.h"
+#include "rocsparse_csrgemm.hpp"
+#include "utility.h"
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int BLOCKDIM,
+          unsigned int CHUNKSIZE,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrgemm_fill_block_per_row_multipass(rocsparse_direction dir,
+                                              rocsparse_int       nb,
+                                              rocsparse_int       bsr_dim,
+                                              U                   alpha_device_host,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                                              const rocsparse_int* __restrict__ bsr_col_ind_A,
+                                              const T* __restrict__ bsr_val_A,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                                              const rocsparse_int* __restrict__ bsr_col_ind_B,
+                                              const T* __restrict__ bsr_val_B,
+                                              U beta_device_host,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr_D,
+                                              const rocsparse_int* __restrict__ bsr_col_ind_D,
+                                              const T* __restrict__ bsr_val_D,
+                                              const rocsparse_int* __restrict__ bsr_row_ptr_C,
+                                              rocsparse_int* __restrict__ bsr_col_ind_C,
+                                              T* __restrict__ bsr_val_C,
+                                              rocsparse_index_base idx_base_A,
+                                              rocsparse_index_base idx_base_B,
+                                              rocsparse_index_base idx_base_C,
+                                              rocsparse_index_base idx_base_D,
+                                              bool                 mul,
+                                              bool                 add)
+{
+    T alpha = (mul == true) ? load_scalar_device_host(alpha_device_host) : static_cast<T>(0);
+    T beta  = (add == true) ? load_scalar_device_host(beta_device_host) : static_cast<T>(0);
+
+    bsrgemm_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, BLOCKDIM, CHUNKSIZE>(
+        dir,
+        nb,
+        bsr_dim,
+        alpha,
+        bsr_row_ptr_A,
+        bsr_col_ind_A,
+        bsr_val_A,
+        bsr_row_ptr_B,
+        bsr_col_ind_B,
+        bsr_val_B,
+        beta,
+        bsr_row_ptr_D,
+        bsr_col_ind_D,
+        bsr_val_D,
+        bsr_row_ptr_C,
+        bsr_col_ind_C,
+        bsr_val_C,
+        idx_base_A,
+        idx_base_B,
+        idx_base_C,
+        idx_base_D,
+        mul,
+        add);
+}
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrgemm_fill_block_per_row_general(rocsparse_direction dir,
+                                            rocsparse_int       bsr_dim,
+                                            U                   alpha_device_host,
+                                            const rocsparse_int* __restrict__ bsr_row_ptr_A,
+                                            const rocsparse_int* __restrict__ bsr_col_ind_A,
+                                            const T* __restrict__ bsr_val_A,
+                                            const rocsparse_int* __restrict__ bsr_row_ptr_B,
+                                            const rocsparse_int* __restrict__ bsr_col_ind_B,
+                                            const T* __restrict__ bsr_val_B,
+                                            U beta_device_host,
+                                            const rocsparse_int* __restrict__ bsr_row_ptr_D,
+                                            const rocsparse_int* __restrict__ bsr_col_ind_D,
+                                            const T* __restrict__ bsr_val_D,
+                                            const rocsparse_int* __restrict__ bsr_row_ptr_C,
+                                            const rocsparse_int* __restrict__ bsr_col_ind_C,
+                                            T* __restrict__ bsr_val_C,
+                                            rocsparse_index_base idx_base_A,
+                                            rocsparse_index_base idx_base_B,
+                                            rocsparse_index_base idx_base_C,
+                                            rocsparse_index_base idx_base_D,
+                                            bool                 mul,
+                                            bool                 add)
+{
+    T alpha = (mul == true) ? load_scalar_device_host(alpha_device_host) : static_cast<T>(0);
+    T beta  = (add == true) ? load_scalar_device_host(beta_device_host) : static_cast<T>(0);
+
+    bsrgemm_fill_block_per_row_general_device<BLOCKSIZE>(dir,
+                                                         bsr_dim,
+                                                         alpha,
+                                                         bsr_row_ptr_A,
+                                                         bsr_col_ind_A,
+                                                         bsr_val_A,
+                                                         bsr_row_ptr_B,
+                                                         bsr_col_ind_B,
+                                                         bsr_val_B,
+                                                         beta,
+                                                         bsr_row_ptr_D,
+                                                         bsr_col_ind_D,
+                                                         bsr_val_D,
+                                                         bsr_row_ptr_C,
+                                                         bsr_col_ind_C,
+                                                         bsr_val_C,
+                                                         idx_base_A,
+                                                         idx_base_B,
+                                                         idx_base_C,
+                                                         idx_base_D,
+                                                         mul,
+                                                         add);
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_bsrgemm_dispatch(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nb,
+                                            rocsparse_int             kb,
+                                            rocsparse_int             block_dim,
+                                            U                         alpha_device_host,
+                                            const T*                  alpha,
+                                            const rocsparse_mat_descr descr_A,
+                                            rocsparse_int             nnzb_A,
+                                            const T*                  bsr_val_A,
+                                            const rocsparse_int*      bsr_row_ptr_A,
+                                            const rocsparse_int*      bsr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            rocsparse_int             nnzb_B,
+                                            const T*                  bsr_val_B,
+                                            const rocsparse_int*      bsr_row_ptr_B,
+                                            const rocsparse_int*      bsr_col_ind_B,
+                                            U                         beta_device_host,
+                                            const T*                  beta,
+                                            const rocsparse_mat_descr descr_D,
+                                            rocsparse_int             nnzb_D,
+                                            const T*                  bsr_val_D,
+                                            const rocsparse_int*      bsr_row_ptr_D,
+                                            const rocsparse_int*      bsr_col_ind_D,
+                                            const rocsparse_mat_descr descr_C,
+                                            T*                        bsr_val_C,
+                                            const rocsparse_int*      bsr_row_ptr_C,
+                                            rocsparse_int*            bsr_col_ind_C,
+                                            const rocsparse_mat_info  info_C,
+                                            void*                     temp_buffer,
+                                            bool                      mul,
+                                            bool                      add)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Index bases of unused matrices are not accessed
+    rocsparse_index_base base_A = (mul == true) ? descr_A->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_B = (mul == true) ? descr_B->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_D = (add == true) ? descr_D->base : rocsparse_index_base_zero;
+
+#define BSRGEMM_FILL_LAUNCH(BLOCKSIZE_, WFSIZE_, BLOCKDIM_, CHUNKSIZE_)                        \
+    hipLaunchKernelGGL(                                                                        \
+        (bsrgemm_fill_block_per_row_multipass<BLOCKSIZE_, WFSIZE_, BLOCKDIM_, CHUNKSIZE_>),    \
+        dim3(mb),                                                                              \
+        dim3(BLOCKSIZE_),                                                                      \
+        0,                                                                                     \
+        stream,                                                                                \
+        dir,                                                                                   \
+        nb,                                                                                    \
+        block_dim,                                                                             \
+        alpha_device_host,                                                                     \
+        bsr_row_ptr_A,                                                                         \
+        bsr_col_ind_A,                                                                         \
+        bsr_val_A,                                                                             \
+        bsr_row_ptr_B,                                                                         \
+        bsr_col_ind_B,                                                                         \
+        bsr_val_B,                                                                             \
+        beta_device_host,                                                                      \
+        bsr_row_ptr_D,                                                                         \
+        bsr_col_ind_D,                                                                         \
+        bsr_val_D,                                                                             \
+        bsr_row_ptr_C,                                                                         \
+        bsr_col_ind_C,                                                                         \
+        bsr_val_C,                                                                             \
+        base_A,                                                                                \
+        base_B,                                                                                \
+        descr_C->base,                                                                         \
+        base_D,                                                                                \
+        mul,                                                                                   \
+        add)
+
+#define BSRGEMM_FILL_DISPATCH(BLOCKSIZE_, BLOCKDIM_, CHUNKSIZE_)           \
+    if(handle->wavefront_size == 32)                                       \
+    {                                                                      \
+        BSRGEMM_FILL_LAUNCH(BLOCKSIZE_, 32, BLOCKDIM_, CHUNKSIZE_);        \
+    }                                                                      \
+    else                                                                   \
+    {                                                                      \
+        BSRGEMM_FILL_LAUNCH(BLOCKSIZE_, 64, BLOCKDIM_, CHUNKSIZE_);        \
+    }
+
+    // The accumulated blocks of a chunk are kept in shared memory. The chunk size is
+    // chosen such that the accumulator does not exceed 2048 entries, and such that
+    // the number of threads is at least the chunk size.
+    if(block_dim <= 2)
+    {
+        BSRGEMM_FILL_DISPATCH(256, 2, 256);
+    }
+    else if(block_dim <= 4)
+    {
+        BSRGEMM_FILL_DISPATCH(256, 4, 128);
+    }
+    else if(block_dim <= 8)
+    {
+        BSRGEMM_FILL_DISPATCH(256, 8, 32);
+    }
+    else if(block_dim <= 16)
+    {
+        BSRGEMM_FILL_DISPATCH(256, 16, 8);
+    }
+    else if(block_dim <= 32)
+    {
+        BSRGEMM_FILL_DISPATCH(1024, 32, 2);
+    }
+    else
+    {
+        // The blocks do not fit into shared memory. The block column entries of C are
+        // computed by csrgemm on the block patterns first, using the values of C as
+        // scratch memory. The blocks of C are accumulated in global memory afterwards.
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_template(handle,
+                                                             rocsparse_operation_none,
+                                                             rocsparse_operation_none,
+                                                             mb,
+                                                             nb,
+                                                             kb,
+                                                             alpha,
+                                                             descr_A,
+                                                             nnzb_A,
+                                                             bsr_val_A,
+                                                             bsr_row_ptr_A,
+                                                             bsr_col_ind_A,
+                                                             descr_B,
+                                                             nnzb_B,
+                                                             bsr_val_B,
+                                                             bsr_row_ptr_B,
+                                                             bsr_col_ind_B,
+                                                             beta,
+                                                             descr_D,
+                                                             nnzb_D,
+                                                             bsr_val_D,
+                                                             bsr_row_ptr_D,
+                                                             bsr_col_ind_D,
+                                                             descr_C,
+                                                             bsr_val_C,
+                                                             bsr_row_ptr_C,
+                                                             bsr_col_ind_C,
+                                                             info_C,
+                                                             temp_buffer));
+
+#define BSRGEMM_DIM 256
+        hipLaunchKernelGGL((bsrgemm_fill_block_per_row_general<BSRGEMM_DIM>),
+                           dim3(mb),
+                           dim3(BSRGEMM_DIM),
+                           0,
+                           stream,
+                           dir,
+                           block_dim,
+                           alpha_device_host,
+                           bsr_row_ptr_A,
+                           bsr_col_ind_A,
+                           bsr_val_A,
+                           bsr_row_ptr_B,
+                           bsr_col_ind_B,
+                           bsr_val_B,
+                           beta_device_host,
+                           bsr_row_ptr_D,
+                           bsr_col_ind_D,
+                           bsr_val_D,
+                           bsr_row_ptr_C,
+                           bsr_col_ind_C,
+                           bsr_val_C,
+                           base_A,
+                           base_B,
+                           descr_C->base,
+                           base_D,
+                           mul,
+                           add);
+#undef BSRGEMM_DIM
+    }
+
+#undef BSRGEMM_FILL_DISPATCH
+#undef BSRGEMM_FILL_LAUNCH
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrgemm_buffer_size_template(rocsparse_handle          handle,
+                                                        rocsparse_direction       dir,
+                                                        rocsparse_operation       trans_A,
+                                                        rocsparse_operation       trans_B,
+                                                        rocsparse_int             mb,
+                                                        rocsparse_int             nb,
+                                                        rocsparse_int             kb,
+                                                        rocsparse_int             block_dim,
+                                                        const T*                  alpha,
+                                                        const rocsparse_mat_descr descr_A,
+                                                        rocsparse_int             nnzb_A,
+                                                        const rocsparse_int*      bsr_row_ptr_A,
+                                                        const rocsparse_int*      bsr_col_ind_A,
+                                                        const rocsparse_mat_descr descr_B,
+                                                        rocsparse_int             nnzb_B,
+                                                        const rocsparse_int*      bsr_row_ptr_B,
+                                                        const rocsparse_int*      bsr_col_ind_B,
+                                                        const T*                  beta,
+                                                        const rocsparse_mat_descr descr_D,
+                                                        rocsparse_int             nnzb_D,
+                                                        const rocsparse_int*      bsr_row_ptr_D,
+                                                        const rocsparse_int*      bsr_col_ind_D,
+                                                        rocsparse_mat_info        info_C,
+                                                        size_t*                   buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrgemm_buffer_size"),
+              dir,
+              trans_A,
+              trans_B,
+              mb,
+              nb,
+              kb,
+              block_dim,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha),
+              (const void*&)descr_A,
+              nnzb_A,
+              (const void*&)bsr_row_ptr_A,
+              (const void*&)bsr_col_ind_A,
+              (const void*&)descr_B,
+              nnzb_B,
+              (const void*&)bsr_row_ptr_B,
+              (const void*&)bsr_col_ind_B,
+              LOG_TRACE_SCALAR_VALUE(handle, beta),
+              (const void*&)descr_D,
+              nnzb_D,
+              (const void*&)bsr_row_ptr_D,
+              (const void*&)bsr_col_ind_D,
+              (const void*&)info_C,
+              (const void*&)buffer_size);
+
+    if(rocsparse_enum_utils::is_invalid(dir) || rocsparse_enum_utils::is_invalid(trans_A)
+       || rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Only non-transposed products are supported
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check block dimension
+    if(block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // The temporary storage only depends on the block patterns of A, B and D
+    return rocsparse_csrgemm_buffer_size_template(handle,
+                                                  trans_A,
+                                                  trans_B,
+                                                  mb,
+                                                  nb,
+                                                  kb,
+                                                  alpha,
+                                                  descr_A,
+                                                  nnzb_A,
+                                                  bsr_row_ptr_A,
+                                                  bsr_col_ind_A,
+                                                  descr_B,
+                                                  nnzb_B,
+                                                  bsr_row_ptr_B,
+                                                  bsr_col_ind_B,
+                                                  beta,
+                                                  descr_D,
+                                                  nnzb_D,
+                                                  bsr_row_ptr_D,
+                                                  bsr_col_ind_D,
+                                                  info_C,
+                                                  buffer_size);
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrgemm_template(rocsparse_handle          handle,
+                                            rocsparse_direction       dir,
+                                            rocsparse_operation       trans_A,
+                                            rocsparse_operation       trans_B,
+                                            rocsparse_int             mb,
+                                            rocsparse_int             nb,
+                                            rocsparse_int             kb,
+                                            rocsparse_int             block_dim,
+                                            const T*                  alpha,
+                                            const rocsparse_mat_descr descr_A,
+                                            rocsparse_int             nnzb_A,
+                                            const T*                  bsr_val_A,
+                                            const rocsparse_int*      bsr_row_ptr_A,
+                                            const rocsparse_int*      bsr_col_ind_A,
+                                            const rocsparse_mat_descr descr_B,
+                                            rocsparse_int             nnzb_B,
+                                            const T*                  bsr_val_B,
+                                            const rocsparse_int*      bsr_row_ptr_B,
+                                            const rocsparse_int*      bsr_col_ind_B,
+                                            const T*                  beta,
+                                            const rocsparse_mat_descr descr_D,
+                                            rocsparse_int             nnzb_D,
+                                            const T*                  bsr_val_D,
+                                            const rocsparse_int*      bsr_row_ptr_D,
+                                            const rocsparse_int*      bsr_col_ind_D,
+                                            const rocsparse_mat_descr descr_C,
+                                            T*                        bsr_val_C,
+                                            const rocsparse_int*      bsr_row_ptr_C,
+                                            rocsparse_int*            bsr_col_ind_C,
+                                            const rocsparse_mat_info  info_C,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrgemm"),
+              dir,
+              trans_A,
+              trans_B,
+              mb,
+              nb,
+              kb,
+              block_dim,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha),
+              (const void*&)descr_A,
+              nnzb_A,
+              (const void*&)bsr_val_A,
+              (const void*&)bsr_row_ptr_A,
+              (const void*&)bsr_col_ind_A,
+              (const void*&)descr_B,
+              nnzb_B,
+              (const void*&)bsr_val_B,
+              (const void*&)bsr_row_ptr_B,
+              (const void*&)bsr_col_ind_B,
+              LOG_TRACE_SCALAR_VALUE(handle, beta),
+              (const void*&)descr_D,
+              nnzb_D,
+              (const void*&)bsr_val_D,
+              (const void*&)bsr_row_ptr_D,
+              (const void*&)bsr_col_ind_D,
+              (const void*&)descr_C,
+              (const void*&)bsr_val_C,
+              (const void*&)bsr_row_ptr_C,
+              (const void*&)bsr_col_ind_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    if(rocsparse_enum_utils::is_invalid(dir) || rocsparse_enum_utils::is_invalid(trans_A)
+       || rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Only non-transposed products are supported
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(mb < 0 || nb < 0 || kb < 0 || nnzb_A < 0 || nnzb_B < 0 || nnzb_D < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // If block dimension is one we can simply call csrgemm
+    if(block_dim == 1)
+    {
+        return rocsparse_csrgemm_template(handle,
+                                          trans_A,
+                                          trans_B,
+                                          mb,
+                                          nb,
+                                          kb,
+                                          alpha,
+                                          descr_A,
+                                          nnzb_A,
+                                          bsr_val_A,
+                                          bsr_row_ptr_A,
+                                          bsr_col_ind_A,
+                                          descr_B,
+                                          nnzb_B,
+                                          bsr_val_B,
+                                          bsr_row_ptr_B,
+                                          bsr_col_ind_B,
+                                          beta,
+                                          descr_D,
+                                          nnzb_D,
+                                          bsr_val_D,
+                                          bsr_row_ptr_D,
+                                          bsr_col_ind_D,
+                                          descr_C,
+                                          bsr_val_C,
+                                          bsr_row_ptr_C,
+                                          bsr_col_ind_C,
+                                          info_C,
+                                          temp_buffer);
+    }
+
+    // Check for valid rocsparse_mat_info and rocsparse_csrgemm_info
+    if(info_C == nullptr || info_C->csrgemm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    bool mul = info_C->csrgemm_info->mul;
+    bool add = info_C->csrgemm_info->add;
+
+    // C = 0
+    if(mul == false && add == false)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check valid descriptors and scalars
+    if(descr_C == nullptr
+       || (mul == true && (alpha == nullptr || descr_A == nullptr || descr_B == nullptr))
+       || (add == true && (beta == nullptr || descr_D == nullptr)))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(mul == true)
+    {
+        if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+        {
+            return rocsparse_status_invalid_value;
+        }
+        if(descr_B->base != rocsparse_index_base_zero && descr_B->base != rocsparse_index_base_one)
+        {
+            return rocsparse_status_invalid_value;
+        }
+    }
+
+    if(add == true)
+    {
+        if(descr_D->base != rocsparse_index_base_zero && descr_D->base != rocsparse_index_base_one)
+        {
+            return rocsparse_status_invalid_value;
+        }
+    }
+
+    // Check matrix type
+    if(descr_C->type != rocsparse_matrix_type_general
+       || (mul == true
+           && (descr_A->type != rocsparse_matrix_type_general
+               || descr_B->type != rocsparse_matrix_type_general))
+       || (add == true && descr_D->type != rocsparse_matrix_type_general))
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Skip the parts that do not contribute any block to C
+    bool mul_C = (mul == true && kb != 0 && nnzb_A != 0 && nnzb_B != 0);
+    bool add_C = (add == true && nnzb_D != 0);
+
+    if(mul_C == false && add_C == false)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check valid pointers
+    if(bsr_val_C == nullptr || bsr_row_ptr_C == nullptr || bsr_col_ind_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(mul_C == true
+       && (bsr_val_A == nullptr || bsr_row_ptr_A == nullptr || bsr_col_ind_A == nullptr
+           || bsr_val_B == nullptr || bsr_row_ptr_B == nullptr || bsr_col_ind_B == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(add_C == true
+       && (bsr_val_D == nullptr || bsr_row_ptr_D == nullptr || bsr_col_ind_D == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_bsrgemm_dispatch(handle,
+                                          dir,
+                                          mb,
+                                          nb,
+                                          kb,
+                                          block_dim,
+                                          alpha,
+                                          alpha,
+                                          descr_A,
+                                          nnzb_A,
+                                          bsr_val_A,
+                                          bsr_row_ptr_A,
+                                          bsr_col_ind_A,
+                                          descr_B,
+                                          nnzb_B,
+                                          bsr_val_B,
+                                          bsr_row_ptr_B,
+                                          bsr_col_ind_B,
+                                          beta,
+                                          beta,
+                                          descr_D,
+                                          nnzb_D,
+                                          bsr_val_D,
+                                          bsr_row_ptr_D,
+                                          bsr_col_ind_D,
+                                          descr_C,
+                                          bsr_val_C,
+                                          bsr_row_ptr_C,
+                                          bsr_col_ind_C,
+                                          info_C,
+                                          temp_buffer,
+                                          mul_C,
+                                          add_C);
+    }
+    else
+    {
+        return rocsparse_bsrgemm_dispatch(handle,
+                                          dir,
+                                          mb,
+                                          nb,
+                                          kb,
+                                          block_dim,
+                                          (mul_C == true) ? *alpha : static_cast<T>(0),
+                                          alpha,
+                                          descr_A,
+                                          nnzb_A,
+                                          bsr_val_A,
+                                          bsr_row_ptr_A,
+                                          bsr_col_ind_A,
+                                          descr_B,
+                                          nnzb_B,
+                                          bsr_val_B,
+                                          bsr_row_ptr_B,
+                                          bsr_col_ind_B,
+                                          (add_C == true) ? *beta : static_cast<T>(0),
+                                          beta,
+                                          descr_D,
+                                          nnzb_D,
+                                          bsr_val_D,
+                                          bsr_row_ptr_D,
+                                          bsr_col_ind_D,
+                                          descr_C,
+                                          bsr_val_C,
+                                          bsr_row_ptr_C,
+                                          bsr_col_ind_C,
+                                          info_C,
+                                          temp_buffer,
+                                          mul_C,
+                                          add_C);
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+//
+// rocsparse_xbsrgemm_buffer_size
+//
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_direction       dir,           \
+                                     rocsparse_operation       trans_A,       \
+                                     rocsparse_operation       trans_B,       \
+                                     rocsparse_int             mb,            \
+                                     rocsparse_int             nb,            \
+                                     rocsparse_int             kb,            \
+                                     rocsparse_int             block_dim,     \
+                                     const TYPE*               alpha,         \
+                                     const rocsparse_mat_descr descr_A,       \
+                                     rocsparse_int             nnzb_A,        \
+                                     const rocsparse_int*      bsr_row_ptr_A, \
+                                     const rocsparse_int*      bsr_col_ind_A, \
+                                     const rocsparse_mat_descr descr_B,       \
+                                     rocsparse_int             nnzb_B,        \
+                                     const rocsparse_int*      bsr_row_ptr_B, \
+                                     const rocsparse_int*      bsr_col_ind_B, \
+                                     const TYPE*               beta,          \
+                                     const rocsparse_mat_descr descr_D,       \
+                                     rocsparse_int             nnzb_D,        \
+                                     const rocsparse_int*      bsr_row_ptr_D, \
+                                     const rocsparse_int*      bsr_col_ind_D, \
+                                     rocsparse_mat_info        info_C,        \
+                                     size_t*                   buffer_size)   \
+    {                                                                         \
+        return rocsparse_bsrgemm_buffer_size_template(handle,                 \
+                                                      dir,                    \
+                                                      trans_A,                \
+                                                      trans_B,                \
+                                                      mb,                     \
+                                                      nb,                     \
+                                                      kb,                     \
+                                                      block_dim,              \
+                                                      alpha,                  \
+                                                      descr_A,                \
+                                                      nnzb_A,                 \
+                                                      bsr_row_ptr_A,          \
+                                                      bsr_col_ind_A,          \
+                                                      descr_B,                \
+                                                      nnzb_B,                 \
+                                                      bsr_row_ptr_B,          \
+                                                      bsr_col_ind_B,          \
+                                                      beta,                   \
+                                                      descr_D,                \
+                                                      nnzb_D,                 \
+                                                      bsr_row_ptr_D,          \
+                                                      bsr_col_ind_D,          \
+                                                      info_C,                 \
+                                                      buffer_size);           \
+    }
+
+C_IMPL(rocsparse_sbsrgemm_buffer_size, float);
+C_IMPL(rocsparse_dbsrgemm_buffer_size, double);
+C_IMPL(rocsparse_cbsrgemm_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zbsrgemm_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+//
+// rocsparse_bsrgemm_nnzb
+//
+extern "C" rocsparse_status rocsparse_bsrgemm_nnzb(rocsparse_handle          handle,
+                                                   rocsparse_direction       dir,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   rocsparse_int             mb,
+                                                   rocsparse_int             nb,
+                                                   rocsparse_int             kb,
+                                                   rocsparse_int             block_dim,
+                                                   const rocsparse_mat_descr descr_A,
+                                                   rocsparse_int             nnzb_A,
+                                                   const rocsparse_int*      bsr_row_ptr_A,
+                                                   const rocsparse_int*      bsr_col_ind_A,
+                                                   const rocsparse_mat_descr descr_B,
+                                                   rocsparse_int             nnzb_B,
+                                                   const rocsparse_int*      bsr_row_ptr_B,
+                                                   const rocsparse_int*      bsr_col_ind_B,
+                                                   const rocsparse_mat_descr descr_D,
+                                                   rocsparse_int             nnzb_D,
+                                                   const rocsparse_int*      bsr_row_ptr_D,
+                                                   const rocsparse_int*      bsr_col_ind_D,
+                                                   const rocsparse_mat_descr descr_C,
+                                                   rocsparse_int*            bsr_row_ptr_C,
+                                                   rocsparse_int*            nnzb_C,
+                                                   const rocsparse_mat_info  info_C,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_bsrgemm_nnzb",
+              dir,
+              trans_A,
+              trans_B,
+              mb,
+              nb,
+              kb,
+              block_dim,
+              (const void*&)descr_A,
+              nnzb_A,
+              (const void*&)bsr_row_ptr_A,
+              (const void*&)bsr_col_ind_A,
+              (const void*&)descr_B,
+              nnzb_B,
+              (const void*&)bsr_row_ptr_B,
+              (const void*&)bsr_col_ind_B,
+              (const void*&)descr_D,
+              nnzb_D,
+              (const void*&)bsr_row_ptr_D,
+              (const void*&)bsr_col_ind_D,
+              (const void*&)descr_C,
+              (const void*&)bsr_row_ptr_C,
+              (const void*&)nnzb_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    if(rocsparse_enum_utils::is_invalid(dir) || rocsparse_enum_utils::is_invalid(trans_A)
+       || rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Only non-transposed products are supported
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check block dimension
+    if(block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // The block pattern of C is the sparsity pattern of the product of the block
+    // patterns of A and B, added to the block pattern of D
+    return rocsparse_csrgemm_nnz_template(handle,
+                                          trans_A,
+                                          trans_B,
+                                          mb,
+                                          nb,
+                                          kb,
+                                          descr_A,
+                                          nnzb_A,
+                                          bsr_row_ptr_A,
+                                          bsr_col_ind_A,
+                                          descr_B,
+                                          nnzb_B,
+                                          bsr_row_ptr_B,
+                                          bsr_col_ind_B,
+                                          descr_D,
+                                          nnzb_D,
+                                          bsr_row_ptr_D,
+                                          bsr_col_ind_D,
+                                          descr_C,
+                                          bsr_row_ptr_C,
+                                          nnzb_C,
+                                          info_C,
+                                          temp_buffer);
+}
+
+//
+// rocsparse_xbsrgemm
+//
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_direction       dir,           \
+                                     rocsparse_operation       trans_A,       \
+                                     rocsparse_operation       trans_B,       \
+                                     rocsparse_int             mb,            \
+                                     rocsparse_int             nb,            \
+                                     rocsparse_int             kb,            \
+                                     rocsparse_int             block_dim,     \
+                                     const TYPE*               alpha,         \
+                                     const rocsparse_mat_descr descr_A,       \
+                                     rocsparse_int             nnzb_A,        \
+                                     const TYPE*               bsr_val_A,     \
+                                     const rocsparse_int*      bsr_row_ptr_A, \
+                                     const rocsparse_int*      bsr_col_ind_A, \
+                                     const rocsparse_mat_descr descr_B,       \
+                                     rocsparse_int             nnzb_B,        \
+                                     const TYPE*               bsr_val_B,     \
+                                     const rocsparse_int*      bsr_row_ptr_B, \
+                                     const rocsparse_int*      bsr_col_ind_B, \
+                                     const TYPE*               beta,          \
+                                     const rocsparse_mat_descr descr_D,       \
+                                     rocsparse_int             nnzb_D,        \
+                                     const TYPE*               bsr_val_D,     \
+                                     const rocsparse_int*      bsr_row_ptr_D, \
+                                     const rocsparse_int*      bsr_col_ind_D, \
+                                     const rocsparse_mat_descr descr_C,       \
+                                     TYPE*                     bsr_val_C,     \
+                                     const rocsparse_int*      bsr_row_ptr_C, \
+                                     rocsparse_int*            bsr_col_ind_C, \
+                                     const rocsparse_mat_info  info_C,        \
+                                     void*                     temp_buffer)   \
+    {                                                                         \
+        return rocsparse_bsrgemm_template(handle,                             \
+                                          dir,                                \
+                                          trans_A,                            \
+                                          trans_B,                            \
+                                          mb,                                 \
+                                          nb,                                 \
+                                          kb,                                 \
+                                          block_dim,                          \
+                                          alpha,                              \
+                                          descr_A,                            \
+                                          nnzb_A,                             \
+                                          bsr_val_A,                          \
+                                          bsr_row_ptr_A,                      \
+                                          bsr_col_ind_A,                      \
+                                          descr_B,                            \
+                                          nnzb_B,                             \
+                                          bsr_val_B,                          \
+                                          bsr_row_ptr_B,                      \
+                                          bsr_col_ind_B,                      \
+                                          beta,                               \
+                                          descr_D,                            \
+                                          nnzb_D,                             \
+                                          bsr_val_D,                          \
+                                          bsr_row_ptr_D,                      \
+                                          bsr_col_ind_D,                      \
+                                          descr_C,                            \
+                                          bsr_val_C,                          \
+                                          bsr_row_ptr_C,                      \
+                                          bsr_col_ind_C,                      \
+                                          info_C,                             \
+                                          temp_buffer);                       \
+    }
+
+C_IMPL(rocsparse_sbsrgemm, float);
+C_IMPL(rocsparse_dbsrgemm, double);
+C_IMPL(rocsparse_cbsrgemm, rocsparse_float_complex);
+C_IMPL(rocsparse_zbsrgemm, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -0,0 +1,658 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+
+#include "csrewise_device.h"
+#include "csrgeam_device.h"
+#include <rocprim/rocprim.hpp>
+
+template <rocsparse_ewise_pattern PATTERN, rocsparse_ewise_op OP, typename T>
+static rocsparse_status rocsparse_csrewise_launch(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             n,
+                                                  const rocsparse_mat_descr descr_A,
+                                                  const T*                  csr_val_A,
+                                                  const rocsparse_int*      csr_row_ptr_A,
+                                                  const rocsparse_int*      csr_col_ind_A,
+                                                  const rocsparse_mat_descr descr_B,
+                                                  const T*                  csr_val_B,
+                                                  const rocsparse_int*      csr_row_ptr_B,
+                                                  const rocsparse_int*      csr_col_ind_B,
+                                                  const rocsparse_mat_descr descr_C,
+                                                  T*                        csr_val_C,
+                                                  const rocsparse_int*      csr_row_ptr_C,
+                                                  rocsparse_int*            csr_col_ind_C)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSREWISE_DIM 256
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrewise_fill_multipass_device<CSREWISE_DIM, 32, PATTERN, OP>),
+                           dim3((m - 1) / (CSREWISE_DIM / 32) + 1),
+                           dim3(CSREWISE_DIM),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_val_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_val_B,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           csr_val_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrewise_fill_multipass_device<CSREWISE_DIM, 64, PATTERN, OP>),
+                           dim3((m - 1) / (CSREWISE_DIM / 64) + 1),
+                           dim3(CSREWISE_DIM),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_val_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_val_B,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           csr_val_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
+    }
+#undef CSREWISE_DIM
+
+    return rocsparse_status_success;
+}
+
+template <rocsparse_ewise_op OP, typename T>
+static rocsparse_status rocsparse_csrewise_pattern_dispatch(rocsparse_handle          handle,
+                                                            rocsparse_ewise_pattern   pattern,
+                                                            rocsparse_int             m,
+                                                            rocsparse_int             n,
+                                                            const rocsparse_mat_descr descr_A,
+                                                            const T*                  csr_val_A,
+                                                            const rocsparse_int*      csr_row_ptr_A,
+                                                            const rocsparse_int*      csr_col_ind_A,
+                                                            const rocsparse_mat_descr descr_B,
+                                                            const T*                  csr_val_B,
+                                                            const rocsparse_int*      csr_row_ptr_B,
+                                                            const rocsparse_int*      csr_col_ind_B,
+                                                            const rocsparse_mat_descr descr_C,
+                                                            T*                        csr_val_C,
+                                                            const rocsparse_int*      csr_row_ptr_C,
+                                                            rocsparse_int*            csr_col_ind_C)
+{
+    switch(pattern)
+    {
+#define PATTERN_CASE(PATTERN)                                         \
+    case PATTERN:                                                     \
+    {                                                                 \
+        return rocsparse_csrewise_launch<PATTERN, OP>(handle,         \
+                                                      m,              \
+                                                      n,              \
+                                                      descr_A,        \
+                                                      csr_val_A,      \
+                                                      csr_row_ptr_A,  \
+                                                      csr_col_ind_A,  \
+                                                      descr_B,        \
+                                                      csr_val_B,      \
+                                                      csr_row_ptr_B,  \
+                                                      csr_col_ind_B,  \
+                                                      descr_C,        \
+                                                      csr_val_C,      \
+                                                      csr_row_ptr_C,  \
+                                                      csr_col_ind_C); \
+    }
+
+        PATTERN_CASE(rocsparse_ewise_pattern_intersection);
+        PATTERN_CASE(rocsparse_ewise_pattern_union);
+
+#undef PATTERN_CASE
+    }
+
+    // LCOV_EXCL_START
+    return rocsparse_status_invalid_value;
+    // LCOV_EXCL_STOP
+}
+
+#define OP_CASE(OP)                                                    \
+    case OP:                                                           \
+    {                                                                  \
+        return rocsparse_csrewise_pattern_dispatch<OP>(handle,         \
+                                                       pattern,        \
+                                                       m,              \
+                                                       n,              \
+                                                       descr_A,        \
+                                                       csr_val_A,      \
+                                                       csr_row_ptr_A,  \
+                                                       csr_col_ind_A,  \
+                                                       descr_B,        \
+                                                       csr_val_B,      \
+                                                       csr_row_ptr_B,  \
+                                                       csr_col_ind_B,  \
+                                                       descr_C,        \
+                                                       csr_val_C,      \
+                                                       csr_row_ptr_C,  \
+                                                       csr_col_ind_C); \
+    }
+
+// All binary operators are instantiated for real data types
+template <typename T,
+          typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value,
+                                  int>::type
+          = 0>
+static rocsparse_status rocsparse_csrewise_dispatch(rocsparse_handle          handle,
+                                                    rocsparse_ewise_pattern   pattern,
+                                                    rocsparse_ewise_op        op,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    const rocsparse_mat_descr descr_A,
+                                                    const T*                  csr_val_A,
+                                                    const rocsparse_int*      csr_row_ptr_A,
+                                                    const rocsparse_int*      csr_col_ind_A,
+                                                    const rocsparse_mat_descr descr_B,
+                                                    const T*                  csr_val_B,
+                                                    const rocsparse_int*      csr_row_ptr_B,
+                                                    const rocsparse_int*      csr_col_ind_B,
+                                                    const rocsparse_mat_descr descr_C,
+                                                    T*                        csr_val_C,
+                                                    const rocsparse_int*      csr_row_ptr_C,
+                                                    rocsparse_int*            csr_col_ind_C)
+{
+    switch(op)
+    {
+        OP_CASE(rocsparse_ewise_op_add);
+        OP_CASE(rocsparse_ewise_op_sub);
+        OP_CASE(rocsparse_ewise_op_mul);
+        OP_CASE(rocsparse_ewise_op_div);
+        OP_CASE(rocsparse_ewise_op_min);
+        OP_CASE(rocsparse_ewise_op_max);
+    }
+
+    // LCOV_EXCL_START
+    return rocsparse_status_invalid_value;
+    // LCOV_EXCL_STOP
+}
+
+// Complex data types are not ordered, hence min and max are not supported
+template <typename T,
+          typename std::enable_if<std::is_same<T, rocsparse_float_complex>::value
+                                      || std::is_same<T, rocsparse_double_complex>::value,
+                                  int>::type
+          = 0>
+static rocsparse_status rocsparse_csrewise_dispatch(rocsparse_handle          handle,
+                                                    rocsparse_ewise_pattern   pattern,
+                                                    rocsparse_ewise_op        op,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    const rocsparse_mat_descr descr_A,
+                                                    const T*                  csr_val_A,
+                                                    const rocsparse_int*      csr_row_ptr_A,
+                                                    const rocsparse_int*      csr_col_ind_A,
+                                                    const rocsparse_mat_descr descr_B,
+                                                    const T*                  csr_val_B,
+                                                    const rocsparse_int*      csr_row_ptr_B,
+                                                    const rocsparse_int*      csr_col_ind_B,
+                                                    const rocsparse_mat_descr descr_C,
+                                                    T*                        csr_val_C,
+                                                    const rocsparse_int*      csr_row_ptr_C,
+                                                    rocsparse_int*            csr_col_ind_C)
+{
+    switch(op)
+    {
+        OP_CASE(rocsparse_ewise_op_add);
+        OP_CASE(rocsparse_ewise_op_sub);
+        OP_CASE(rocsparse_ewise_op_mul);
+        OP_CASE(rocsparse_ewise_op_div);
+
+    case rocsparse_ewise_op_min:
+    case rocsparse_ewise_op_max:
+    {
+        return rocsparse_status_not_implemented;
+    }
+    }
+
+    // LCOV_EXCL_START
+    return rocsparse_status_invalid_value;
+    // LCOV_EXCL_STOP
+}
+
+#undef OP_CASE
+
+template <typename T>
+rocsparse_status rocsparse_csrewise_template(rocsparse_handle          handle,
+                                             rocsparse_ewise_pattern   pattern,
+                                             rocsparse_ewise_op        op,
+                                             rocsparse_int             m,
+                                             rocsparse_int             n,
+                                             const rocsparse_mat_descr descr_A,
+                                             rocsparse_int             nnz_A,
+                                             const T*                  csr_val_A,
+                                             const rocsparse_int*      csr_row_ptr_A,
+                                             const rocsparse_int*      csr_col_ind_A,
+                                             const rocsparse_mat_descr descr_B,
+                                             rocsparse_int             nnz_B,
+                                             const T*                  csr_val_B,
+                                             const rocsparse_int*      csr_row_ptr_B,
+                                             const rocsparse_int*      csr_col_ind_B,
+                                             const rocsparse_mat_descr descr_C,
+                                             T*                        csr_val_C,
+                                             const rocsparse_int*      csr_row_ptr_C,
+                                             rocsparse_int*            csr_col_ind_C)
+{
+    // Check for valid handle and descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_A == nullptr || descr_B == nullptr || descr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrewise"),
+              pattern,
+              op,
+              m,
+              n,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_val_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C);
+
+    // Check pattern and binary operator
+    if(rocsparse_enum_utils::is_invalid(pattern) || rocsparse_enum_utils::is_invalid(op))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_B->base != rocsparse_index_base_zero && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general
+       || descr_B->type != rocsparse_matrix_type_general
+       || descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || nnz_A < 0 || nnz_B < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible, C does not have any entries
+    if(m == 0 || n == 0 || (nnz_A == 0 && nnz_B == 0)
+       || (pattern == rocsparse_ewise_pattern_intersection && (nnz_A == 0 || nnz_B == 0)))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check valid pointers
+    if(csr_row_ptr_A == nullptr || csr_row_ptr_B == nullptr || csr_val_C == nullptr
+       || csr_row_ptr_C == nullptr || csr_col_ind_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz_A > 0 && (csr_val_A == nullptr || csr_col_ind_A == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(nnz_B > 0 && (csr_val_B == nullptr || csr_col_ind_B == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    return rocsparse_csrewise_dispatch(handle,
+                                       pattern,
+                                       op,
+                                       m,
+                                       n,
+                                       descr_A,
+                                       csr_val_A,
+                                       csr_row_ptr_A,
+                                       csr_col_ind_A,
+                                       descr_B,
+                                       csr_val_B,
+                                       csr_row_ptr_B,
+                                       csr_col_ind_B,
+                                       descr_C,
+                                       csr_val_C,
+                                       csr_row_ptr_C,
+                                       csr_col_ind_C);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrewise_nnz(rocsparse_handle          handle,
+                                                   rocsparse_ewise_pattern   pattern,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   const rocsparse_mat_descr descr_A,
+                                                   rocsparse_int             nnz_A,
+                                                   const rocsparse_int*      csr_row_ptr_A,
+                                                   const rocsparse_int*      csr_col_ind_A,
+                                                   const rocsparse_mat_descr descr_B,
+                                                   rocsparse_int             nnz_B,
+                                                   const rocsparse_int*      csr_row_ptr_B,
+                                                   const rocsparse_int*      csr_col_ind_B,
+                                                   const rocsparse_mat_descr descr_C,
+                                                   rocsparse_int*            csr_row_ptr_C,
+                                                   rocsparse_int*            nnz_C)
+{
+    // Check for valid handle and descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_A == nullptr || descr_B == nullptr || descr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrewise_nnz",
+              pattern,
+              m,
+              n,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C);
+
+    // Check pattern
+    if(rocsparse_enum_utils::is_invalid(pattern))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_B->base != rocsparse_index_base_zero && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general
+       || descr_B->type != rocsparse_matrix_type_general
+       || descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || nnz_A < 0 || nnz_B < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid nnz_C pointer
+    if(nnz_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            *nnz_C = 0;
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), handle->stream));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check valid pointers. Column indices are not accessed for empty matrices, while
+    // the row pointers of C are still initialized.
+    if(csr_row_ptr_A == nullptr || csr_row_ptr_B == nullptr || csr_row_ptr_C == nullptr
+       || (nnz_A > 0 && csr_col_ind_A == nullptr) || (nnz_B > 0 && csr_col_ind_B == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSREWISE_DIM 256
+#define NNZ_LAUNCH(WFSIZE, PATTERN)                                                    \
+    hipLaunchKernelGGL((csrewise_nnz_multipass_device<CSREWISE_DIM, WFSIZE, PATTERN>), \
+                       dim3((m - 1) / (CSREWISE_DIM / WFSIZE) + 1),                    \
+                       dim3(CSREWISE_DIM),                                             \
+                       0,                                                              \
+                       stream,                                                         \
+                       m,                                                              \
+                       n,                                                              \
+                       csr_row_ptr_A,                                                  \
+                       csr_col_ind_A,                                                  \
+                       csr_row_ptr_B,                                                  \
+                       csr_col_ind_B,                                                  \
+                       csr_row_ptr_C,                                                  \
+                       descr_A->base,                                                  \
+                       descr_B->base)
+
+    if(pattern == rocsparse_ewise_pattern_intersection)
+    {
+        if(handle->wavefront_size == 32)
+        {
+            NNZ_LAUNCH(32, rocsparse_ewise_pattern_intersection);
+        }
+        else
+        {
+            NNZ_LAUNCH(64, rocsparse_ewise_pattern_intersection);
+        }
+    }
+    else
+    {
+        if(handle->wavefront_size == 32)
+        {
+            NNZ_LAUNCH(32, rocsparse_ewise_pattern_union);
+        }
+        else
+        {
+            NNZ_LAUNCH(64, rocsparse_ewise_pattern_union);
+        }
+    }
+
+#undef NNZ_LAUNCH
+#undef CSREWISE_DIM
+
+    // Exclusive sum to obtain row pointers of C
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                descr_C->base,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    bool  rocprim_alloc;
+    void* rocprim_buffer;
+
+    if(handle->buffer_size >= rocprim_size)
+    {
+        rocprim_buffer = handle->buffer;
+        rocprim_alloc  = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&rocprim_buffer, rocprim_size));
+        rocprim_alloc = true;
+    }
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                descr_C->base,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    if(rocprim_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(rocprim_buffer));
+    }
+
+    // Extract the number of non-zero elements of C
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        // Blocking mode
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust index base of nnz_C
+        *nnz_C -= descr_C->base;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+        // Adjust index base of nnz_C
+        if(descr_C->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csrgeam_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_C);
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_ewise_pattern   pattern,       \
+                                     rocsparse_ewise_op        op,            \
+                                     rocsparse_int             m,             \
+                                     rocsparse_int             n,             \
+                                     const rocsparse_mat_descr descr_A,       \
+                                     rocsparse_int             nnz_A,         \
+                                     const TYPE*               csr_val_A,     \
+                                     const rocsparse_int*      csr_row_ptr_A, \
+                                     const rocsparse_int*      csr_col_ind_A, \
+                                     const rocsparse_mat_descr descr_B,       \
+                                     rocsparse_int             nnz_B,         \
+                                     const TYPE*               csr_val_B,     \
+                                     const rocsparse_int*      csr_row_ptr_B, \
+                                     const rocsparse_int*      csr_col_ind_B, \
+                                     const rocsparse_mat_descr descr_C,       \
+                                     TYPE*                     csr_val_C,     \
+                                     const rocsparse_int*      csr_row_ptr_C, \
+                                     rocsparse_int*            csr_col_ind_C) \
+    {                                                                         \
+        return rocsparse_csrewise_template(handle,                            \
+                                           pattern,                           \
+                                           op,                                \
+                                           m,                                 \
+                                           n,                                 \
+                                           descr_A,                           \
+                                           nnz_A,                             \
+                                           csr_val_A,                         \
+                                           csr_row_ptr_A,                     \
+                                           csr_col_ind_A,                     \
+                                           descr_B,                           \
+                                           nnz_B,                             \
+                                           csr_val_B,                         \
+                                           csr_row_ptr_B,                     \
+                                           csr_col_ind_B,                     \
+                                           descr_C,                           \
+                                           csr_val_C,                         \
+                                           csr_row_ptr_C,                     \
+                                           csr_col_ind_C);                    \
+    }
+
+C_IMPL(rocsparse_scsrewise, float);
+C_IMPL(rocsparse_dcsrewise, double);
+C_IMPL(rocsparse_ccsrewise, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrewise, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -0,0 +1,554 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "handle.h"
+#include "utility.h"
+
+#include "csrgeam_device.h"
+#include <rocprim/rocprim.hpp>
+
+#include <vector>
+
+// Check the operands A_i of the n-ary sum and collect their CSR arrays, such that they
+// can be transferred to the device at once. The total number of non-zero entries of all
+// operands is returned in nnz_total.
+static rocsparse_status
+    rocsparse_csrgeam_multi_operands(rocsparse_int                       num_mat,
+                                     const rocsparse_mat_descr*          descr_A,
+                                     const rocsparse_int*                nnz_A,
+                                     const void* const*                  csr_val_A,
+                                     const rocsparse_int* const*         csr_row_ptr_A,
+                                     const rocsparse_int* const*         csr_col_ind_A,
+                                     std::vector<csrgeam_multi_operand>& operands,
+                                     int64_t&                            nnz_total)
+{
+    operands.resize(num_mat);
+    nnz_total = 0;
+
+    for(rocsparse_int i = 0; i < num_mat; ++i)
+    {
+        if(descr_A[i] == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        // Check index base
+        if(descr_A[i]->base != rocsparse_index_base_zero
+           && descr_A[i]->base != rocsparse_index_base_one)
+        {
+            return rocsparse_status_invalid_value;
+        }
+
+        // Check matrix type
+        if(descr_A[i]->type != rocsparse_matrix_type_general)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        // Check valid sizes
+        if(nnz_A[i] < 0)
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        // Check valid pointers, column indices and values are not accessed for empty
+        // operands
+        if(csr_row_ptr_A[i] == nullptr)
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        if(nnz_A[i] > 0
+           && (csr_col_ind_A[i] == nullptr || (csr_val_A != nullptr && csr_val_A[i] == nullptr)))
+        {
+            return rocsparse_status_invalid_pointer;
+        }
+
+        operands[i].csr_row_ptr = csr_row_ptr_A[i];
+        operands[i].csr_col_ind = csr_col_ind_A[i];
+        operands[i].csr_val     = (csr_val_A != nullptr) ? csr_val_A[i] : nullptr;
+        operands[i].idx_base    = descr_A[i]->base;
+
+        nnz_total += nnz_A[i];
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrgeam_multi_template(rocsparse_handle            handle,
+                                                  rocsparse_int               m,
+                                                  rocsparse_int               n,
+                                                  rocsparse_int               num_mat,
+                                                  const T*                    alpha,
+                                                  const rocsparse_mat_descr*  descr_A,
+                                                  const rocsparse_int*        nnz_A,
+                                                  const T* const*             csr_val_A,
+                                                  const rocsparse_int* const* csr_row_ptr_A,
+                                                  const rocsparse_int* const* csr_col_ind_A,
+                                                  const rocsparse_mat_descr   descr_C,
+                                                  T*                          csr_val_C,
+                                                  const rocsparse_int*        csr_row_ptr_C,
+                                                  rocsparse_int*              csr_col_ind_C)
+{
+    // Check for valid handle and descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgeam_multi"),
+              m,
+              n,
+              num_mat,
+              (const void*&)alpha,
+              (const void*&)descr_A,
+              (const void*&)nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C);
+
+    // Check index base
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || num_mat < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || num_mat == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check valid pointers
+    if(alpha == nullptr || descr_A == nullptr || nnz_A == nullptr || csr_val_A == nullptr
+       || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    std::vector<csrgeam_multi_operand> operands;
+    int64_t                            nnz_total;
+
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrgeam_multi_operands(num_mat,
+                                         descr_A,
+                                         nnz_A,
+                                         reinterpret_cast<const void* const*>(csr_val_A),
+                                         csr_row_ptr_A,
+                                         csr_col_ind_A,
+                                         operands,
+                                         nnz_total));
+
+    // Quick return if possible
+    if(nnz_total == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check valid pointers
+    if(csr_val_C == nullptr || csr_row_ptr_C == nullptr || csr_col_ind_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The operands are transferred to the device, followed by the scalars alpha_i if
+    // they reside on the host
+    size_t operand_bytes = ((sizeof(csrgeam_multi_operand) * num_mat - 1) / 256 + 1) * 256;
+    size_t alpha_bytes   = (handle->pointer_mode == rocsparse_pointer_mode_host)
+                               ? ((sizeof(T) * num_mat - 1) / 256 + 1) * 256
+                               : 0;
+
+    bool  temp_alloc;
+    char* temp_buffer;
+
+    if(handle->buffer_size >= operand_bytes + alpha_bytes)
+    {
+        temp_buffer = reinterpret_cast<char*>(handle->buffer);
+        temp_alloc  = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&temp_buffer, operand_bytes + alpha_bytes));
+        temp_alloc = true;
+    }
+
+    csrgeam_multi_operand* d_operands = reinterpret_cast<csrgeam_multi_operand*>(temp_buffer);
+    const T*               d_alpha    = alpha;
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(d_operands,
+                                       operands.data(),
+                                       sizeof(csrgeam_multi_operand) * num_mat,
+                                       hipMemcpyHostToDevice,
+                                       stream));
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        T* d_alpha_host = reinterpret_cast<T*>(temp_buffer + operand_bytes);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            d_alpha_host, alpha, sizeof(T) * num_mat, hipMemcpyHostToDevice, stream));
+
+        d_alpha = d_alpha_host;
+    }
+
+#define CSRGEAM_DIM 256
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrgeam_multi_fill_multipass_device<CSRGEAM_DIM, 32>),
+                           dim3((m - 1) / (CSRGEAM_DIM / 32) + 1),
+                           dim3(CSRGEAM_DIM),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           num_mat,
+                           d_alpha,
+                           d_operands,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           csr_val_C,
+                           descr_C->base);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrgeam_multi_fill_multipass_device<CSRGEAM_DIM, 64>),
+                           dim3((m - 1) / (CSRGEAM_DIM / 64) + 1),
+                           dim3(CSRGEAM_DIM),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           num_mat,
+                           d_alpha,
+                           d_operands,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           csr_val_C,
+                           descr_C->base);
+    }
+#undef CSRGEAM_DIM
+
+    if(temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(temp_buffer));
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrgeam_multi_nnz(rocsparse_handle            handle,
+                                                        rocsparse_int               m,
+                                                        rocsparse_int               n,
+                                                        rocsparse_int               num_mat,
+                                                        const rocsparse_mat_descr*  descr_A,
+                                                        const rocsparse_int*        nnz_A,
+                                                        const rocsparse_int* const* csr_row_ptr_A,
+                                                        const rocsparse_int* const* csr_col_ind_A,
+                                                        const rocsparse_mat_descr   descr_C,
+                                                        rocsparse_int*              csr_row_ptr_C,
+                                                        rocsparse_int*              nnz_C)
+{
+    // Check for valid handle and descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrgeam_multi_nnz",
+              m,
+              n,
+              num_mat,
+              (const void*&)descr_A,
+              (const void*&)nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C);
+
+    // Check index base
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || num_mat < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid nnz_C pointer
+    if(nnz_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_host)
+        {
+            *nnz_C = 0;
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), handle->stream));
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check valid pointers
+    if(csr_row_ptr_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(num_mat > 0
+       && (descr_A == nullptr || nnz_A == nullptr || csr_row_ptr_A == nullptr
+           || csr_col_ind_A == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    std::vector<csrgeam_multi_operand> operands;
+    int64_t                            nnz_total;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgeam_multi_operands(num_mat,
+                                                               descr_A,
+                                                               nnz_A,
+                                                               nullptr,
+                                                               csr_row_ptr_A,
+                                                               csr_col_ind_A,
+                                                               operands,
+                                                               nnz_total));
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Transfer the operands to the device
+    size_t operand_bytes = sizeof(csrgeam_multi_operand) * num_mat;
+
+    bool                   operand_alloc;
+    csrgeam_multi_operand* d_operands;
+
+    if(handle->buffer_size >= operand_bytes)
+    {
+        d_operands    = reinterpret_cast<csrgeam_multi_operand*>(handle->buffer);
+        operand_alloc = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&d_operands, operand_bytes));
+        operand_alloc = true;
+    }
+
+    if(num_mat > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            d_operands, operands.data(), operand_bytes, hipMemcpyHostToDevice, stream));
+    }
+
+#define CSRGEAM_DIM 256
+    if(handle->wavefront_size == 32)
+    {
+        hipLaunchKernelGGL((csrgeam_multi_nnz_multipass_device<CSRGEAM_DIM, 32>),
+                           dim3((m - 1) / (CSRGEAM_DIM / 32) + 1),
+                           dim3(CSRGEAM_DIM),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           num_mat,
+                           d_operands,
+                           csr_row_ptr_C);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrgeam_multi_nnz_multipass_device<CSRGEAM_DIM, 64>),
+                           dim3((m - 1) / (CSRGEAM_DIM / 64) + 1),
+                           dim3(CSRGEAM_DIM),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           num_mat,
+                           d_operands,
+                           csr_row_ptr_C);
+    }
+#undef CSRGEAM_DIM
+
+    if(operand_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(d_operands));
+    }
+
+    // Exclusive sum to obtain row pointers of C
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                descr_C->base,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    bool  rocprim_alloc;
+    void* rocprim_buffer;
+
+    if(handle->buffer_size >= rocprim_size)
+    {
+        rocprim_buffer = handle->buffer;
+        rocprim_alloc  = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&rocprim_buffer, rocprim_size));
+        rocprim_alloc = true;
+    }
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                descr_C->base,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    if(rocprim_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(rocprim_buffer));
+    }
+
+    // Extract the number of non-zero elements of C
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        // Blocking mode
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // Adjust index base of nnz_C
+        *nnz_C -= descr_C->base;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnz_C, csr_row_ptr_C + m, sizeof(rocsparse_int), hipMemcpyDeviceToDevice, stream));
+
+        // Adjust index base of nnz_C
+        if(descr_C->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csrgeam_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_C);
+        }
+    }
+
+    return rocsparse_status_success;
+}
+
+#define C_IMPL(NAME, TYPE)                                                      \
+    extern "C" rocsparse_status NAME(rocsparse_handle            handle,        \
+                                     rocsparse_int               m,             \
+                                     rocsparse_int               n,             \
+                                     rocsparse_int               num_mat,       \
+                                     const TYPE*                 alpha,         \
+                                     const rocsparse_mat_descr*  descr_A,       \
+                                     const rocsparse_int*        nnz_A,         \
+                                     const TYPE* const*          csr_val_A,     \
+                                     const rocsparse_int* const* csr_row_ptr_A, \
+                                     const rocsparse_int* const* csr_col_ind_A, \
+                                     const rocsparse_mat_descr   descr_C,       \
+                                     TYPE*                       csr_val_C,     \
+                                     const rocsparse_int*        csr_row_ptr_C, \
+                                     rocsparse_int*              csr_col_ind_C) \
+    {                                                                           \
+        return rocsparse_csrgeam_multi_template(handle,                         \
+                                                m,                              \
+                                                n,                              \
+                                                num_mat,                        \
+                                                alpha,                          \
+                                                descr_A,                        \
+                                                nnz_A,                          \
+                                                csr_val_A,                      \
+                                                csr_row_ptr_A,                  \
+                                                csr_col_ind_A,                  \
+                                                descr_C,                        \
+                                                csr_val_C,                      \
+                                                csr_row_ptr_C,                  \
+                                                csr_col_ind_C);                 \
+    }
+
+C_IMPL(rocsparse_scsrgeam_multi, float);
+C_IMPL(rocsparse_dcsrgeam_multi, double);
+C_IMPL(rocsparse_ccsrgeam_multi, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrgeam_multi, rocsparse_double_complex);
+
+#undef C_IMPL
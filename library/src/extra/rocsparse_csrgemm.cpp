@@ -25,15 +25,17 @@
 #include "rocsparse_csrgemm.hpp"
 #include "../conversion/rocsparse_identity.hpp"
 #include "csrgemm_device.h"
+#include "csrgemm_esc_device.h"
 #include "definitions.h"
 #include "utility.h"
 
 #include <rocprim/rocprim.hpp>
 
-template <unsigned int BLOCKSIZE,
-          unsigned int WFSIZE,
-          unsigned int HASHSIZE,
-          unsigned int HASHVAL,
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          unsigned int       HASHSIZE,
+          unsigned int       HASHVAL,
+          rocsparse_semiring SEMIRING,
           typename I,
           typename J,
           typename T>
@@ -61,38 +63,49 @@ __launch_bounds__(BLOCKSIZE) __global__
                                               rocsparse_index_base idx_base_C,
                                               rocsparse_index_base idx_base_D,
                                               bool                 mul,
-                                              bool                 add)
+                                              bool                 add,
+                                              const I* __restrict__ csr_row_ptr_M,
+                                              const J* __restrict__ csr_col_ind_M,
+                                              rocsparse_index_base idx_base_M,
+                                              bool                 complement_M,
+                                              int                  triangle_M)
 {
-    csrgemm_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(m,
-                                                                         nk,
-                                                                         offset,
-                                                                         perm,
-                                                                         alpha,
-                                                                         csr_row_ptr_A,
-                                                                         csr_col_ind_A,
-                                                                         csr_val_A,
-                                                                         csr_row_ptr_B,
-                                                                         csr_col_ind_B,
-                                                                         csr_val_B,
-                                                                         beta,
-                                                                         csr_row_ptr_D,
-                                                                         csr_col_ind_D,
-                                                                         csr_val_D,
-                                                                         csr_row_ptr_C,
-                                                                         csr_col_ind_C,
-                                                                         csr_val_C,
-                                                                         idx_base_A,
-                                                                         idx_base_B,
-                                                                         idx_base_C,
-                                                                         idx_base_D,
-                                                                         mul,
-                                                                         add);
+    csrgemm_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL, SEMIRING>(m,
+                                                                                   nk,
+                                                                                   offset,
+                                                                                   perm,
+                                                                                   alpha,
+                                                                                   csr_row_ptr_A,
+                                                                                   csr_col_ind_A,
+                                                                                   csr_val_A,
+                                                                                   csr_row_ptr_B,
+                                                                                   csr_col_ind_B,
+                                                                                   csr_val_B,
+                                                                                   beta,
+                                                                                   csr_row_ptr_D,
+                                                                                   csr_col_ind_D,
+                                                                                   csr_val_D,
+                                                                                   csr_row_ptr_C,
+                                                                                   csr_col_ind_C,
+                                                                                   csr_val_C,
+                                                                                   idx_base_A,
+                                                                                   idx_base_B,
+                                                                                   idx_base_C,
+                                                                                   idx_base_D,
+                                                                                   mul,
+                                                                                   add,
+                                                                                   csr_row_ptr_M,
+                                                                                   csr_col_ind_M,
+                                                                                   idx_base_M,
+                                                                                   complement_M,
+                                                                                   triangle_M);
 }
 
-template <unsigned int BLOCKSIZE,
-          unsigned int WFSIZE,
-          unsigned int HASHSIZE,
-          unsigned int HASHVAL,
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          unsigned int       HASHSIZE,
+          unsigned int       HASHVAL,
+          rocsparse_semiring SEMIRING,
           typename I,
           typename J,
           typename T>
@@ -120,9 +133,14 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                 rocsparse_index_base idx_base_C,
                                                 rocsparse_index_base idx_base_D,
                                                 bool                 mul,
-                                                bool                 add)
+                                                bool                 add,
+                                                const I* __restrict__ csr_row_ptr_M,
+                                                const J* __restrict__ csr_col_ind_M,
+                                                rocsparse_index_base idx_base_M,
+                                                bool                 complement_M,
+                                                int                  triangle_M)
 {
-    csrgemm_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
+    csrgemm_fill_wf_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL, SEMIRING>(
         m,
         nk,
         offset,
@@ -146,13 +164,19 @@ __launch_bounds__(BLOCKSIZE) __global__
         idx_base_C,
         idx_base_D,
         mul,
-        add);
+        add,
+        csr_row_ptr_M,
+        csr_col_ind_M,
+        idx_base_M,
+        complement_M,
+        triangle_M);
 }
 
-template <unsigned int BLOCKSIZE,
-          unsigned int WFSIZE,
-          unsigned int HASHSIZE,
-          unsigned int HASHVAL,
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          unsigned int       HASHSIZE,
+          unsigned int       HASHVAL,
+          rocsparse_semiring SEMIRING,
           typename I,
           typename J,
           typename T>
@@ -179,37 +203,49 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                  rocsparse_index_base idx_base_C,
                                                  rocsparse_index_base idx_base_D,
                                                  bool                 mul,
-                                                 bool                 add)
+                                                 bool                 add,
+                                                 const I* __restrict__ csr_row_ptr_M,
+                                                 const J* __restrict__ csr_col_ind_M,
+                                                 rocsparse_index_base idx_base_M,
+                                                 bool                 complement_M,
+                                                 int                  triangle_M)
 {
-    csrgemm_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(nk,
-                                                                            offset,
-                                                                            perm,
-                                                                            alpha,
-                                                                            csr_row_ptr_A,
-                                                                            csr_col_ind_A,
-                                                                            csr_val_A,
-                                                                            csr_row_ptr_B,
-                                                                            csr_col_ind_B,
-                                                                            csr_val_B,
-                                                                            beta,
-                                                                            csr_row_ptr_D,
-                                                                            csr_col_ind_D,
-                                                                            csr_val_D,
-                                                                            csr_row_ptr_C,
-                                                                            csr_col_ind_C,
-                                                                            csr_val_C,
-                                                                            idx_base_A,
-                                                                            idx_base_B,
-                                                                            idx_base_C,
-                                                                            idx_base_D,
-                                                                            mul,
-                                                                            add);
+    csrgemm_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL, SEMIRING>(
+        nk,
+        offset,
+        perm,
+        alpha,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_val_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_val_B,
+        beta,
+        csr_row_ptr_D,
+        csr_col_ind_D,
+        csr_val_D,
+        csr_row_ptr_C,
+        csr_col_ind_C,
+        csr_val_C,
+        idx_base_A,
+        idx_base_B,
+        idx_base_C,
+        idx_base_D,
+        mul,
+        add,
+        csr_row_ptr_M,
+        csr_col_ind_M,
+        idx_base_M,
+        complement_M,
+        triangle_M);
 }
 
-template <unsigned int BLOCKSIZE,
-          unsigned int WFSIZE,
-          unsigned int HASHSIZE,
-          unsigned int HASHVAL,
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          unsigned int       HASHSIZE,
+          unsigned int       HASHVAL,
+          rocsparse_semiring SEMIRING,
           typename I,
           typename J,
           typename T>
@@ -236,9 +272,14 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                    rocsparse_index_base idx_base_C,
                                                    rocsparse_index_base idx_base_D,
                                                    bool                 mul,
-                                                   bool                 add)
+                                                   bool                 add,
+                                                   const I* __restrict__ csr_row_ptr_M,
+                                                   const J* __restrict__ csr_col_ind_M,
+                                                   rocsparse_index_base idx_base_M,
+                                                   bool                 complement_M,
+                                                   int                  triangle_M)
 {
-    csrgemm_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL>(
+    csrgemm_fill_block_per_row_device<BLOCKSIZE, WFSIZE, HASHSIZE, HASHVAL, SEMIRING>(
         nk,
         offset,
         perm,
@@ -261,12 +302,18 @@ __launch_bounds__(BLOCKSIZE) __global__
         idx_base_C,
         idx_base_D,
         mul,
-        add);
+        add,
+        csr_row_ptr_M,
+        csr_col_ind_M,
+        idx_base_M,
+        complement_M,
+        triangle_M);
 }
 
-template <unsigned int BLOCKSIZE,
-          unsigned int WFSIZE,
-          unsigned int CHUNKSIZE,
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          unsigned int       CHUNKSIZE,
+          rocsparse_semiring SEMIRING,
           typename I,
           typename J,
           typename T>
@@ -294,37 +341,49 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                            rocsparse_index_base idx_base_C,
                                                            rocsparse_index_base idx_base_D,
                                                            bool                 mul,
-                                                           bool                 add)
+                                                           bool                 add,
+                                                           const I* __restrict__ csr_row_ptr_M,
+                                                           const J* __restrict__ csr_col_ind_M,
+                                                           rocsparse_index_base idx_base_M,
+                                                           bool                 complement_M,
+                                                           int                  triangle_M)
 {
-    csrgemm_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE>(n,
-                                                                              offset,
-                                                                              perm,
-                                                                              alpha,
-                                                                              csr_row_ptr_A,
-                                                                              csr_col_ind_A,
-                                                                              csr_val_A,
-                                                                              csr_row_ptr_B,
-                                                                              csr_col_ind_B,
-                                                                              csr_val_B,
-                                                                              beta,
-                                                                              csr_row_ptr_D,
-                                                                              csr_col_ind_D,
-                                                                              csr_val_D,
-                                                                              csr_row_ptr_C,
-                                                                              csr_col_ind_C,
-                                                                              csr_val_C,
-                                                                              workspace_B,
-                                                                              idx_base_A,
-                                                                              idx_base_B,
-                                                                              idx_base_C,
-                                                                              idx_base_D,
-                                                                              mul,
-                                                                              add);
+    csrgemm_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE, SEMIRING>(
+        n,
+        offset,
+        perm,
+        alpha,
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_val_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_val_B,
+        beta,
+        csr_row_ptr_D,
+        csr_col_ind_D,
+        csr_val_D,
+        csr_row_ptr_C,
+        csr_col_ind_C,
+        csr_val_C,
+        workspace_B,
+        idx_base_A,
+        idx_base_B,
+        idx_base_C,
+        idx_base_D,
+        mul,
+        add,
+        csr_row_ptr_M,
+        csr_col_ind_M,
+        idx_base_M,
+        complement_M,
+        triangle_M);
 }
 
-template <unsigned int BLOCKSIZE,
-          unsigned int WFSIZE,
-          unsigned int CHUNKSIZE,
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          unsigned int       CHUNKSIZE,
+          rocsparse_semiring SEMIRING,
           typename I,
           typename J,
           typename T>
@@ -352,9 +411,14 @@ __launch_bounds__(BLOCKSIZE) __global__
                                                              rocsparse_index_base idx_base_C,
                                                              rocsparse_index_base idx_base_D,
                                                              bool                 mul,
-                                                             bool                 add)
+                                                             bool                 add,
+                                                             const I* __restrict__ csr_row_ptr_M,
+                                                             const J* __restrict__ csr_col_ind_M,
+                                                             rocsparse_index_base idx_base_M,
+                                                             bool                 complement_M,
+                                                             int                  triangle_M)
 {
-    csrgemm_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE>(
+    csrgemm_fill_block_per_row_multipass_device<BLOCKSIZE, WFSIZE, CHUNKSIZE, SEMIRING>(
         n,
         offset,
         perm,
@@ -378,12 +442,147 @@ __launch_bounds__(BLOCKSIZE) __global__
         idx_base_C,
         idx_base_D,
         mul,
-        add);
+        add,
+        csr_row_ptr_M,
+        csr_col_ind_M,
+        idx_base_M,
+        complement_M,
+        triangle_M);
+}
+
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          rocsparse_semiring SEMIRING,
+          typename I,
+          typename J,
+          typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_esc_expand_host_pointer(J n,
+                                         const J* __restrict__ offset,
+                                         const J* __restrict__ perm,
+                                         T alpha,
+                                         const I* __restrict__ csr_row_ptr_A,
+                                         const J* __restrict__ csr_col_ind_A,
+                                         const T* __restrict__ csr_val_A,
+                                         const I* __restrict__ csr_row_ptr_B,
+                                         const J* __restrict__ csr_col_ind_B,
+                                         const T* __restrict__ csr_val_B,
+                                         T beta,
+                                         const I* __restrict__ csr_row_ptr_D,
+                                         const J* __restrict__ csr_col_ind_D,
+                                         const T* __restrict__ csr_val_D,
+                                         const I* __restrict__ esc_row_ptr,
+                                         J* __restrict__ esc_col_ind,
+                                         T* __restrict__ esc_val,
+                                         rocsparse_index_base idx_base_A,
+                                         rocsparse_index_base idx_base_B,
+                                         rocsparse_index_base idx_base_D,
+                                         bool                 mul,
+                                         bool                 add,
+                                         const I* __restrict__ csr_row_ptr_M,
+                                         const J* __restrict__ csr_col_ind_M,
+                                         rocsparse_index_base idx_base_M,
+                                         bool                 complement_M,
+                                         int                  triangle_M)
+{
+    csrgemm_esc_expand_device<BLOCKSIZE, WFSIZE, SEMIRING>(n,
+                                                           offset,
+                                                           perm,
+                                                           alpha,
+                                                           csr_row_ptr_A,
+                                                           csr_col_ind_A,
+                                                           csr_val_A,
+                                                           csr_row_ptr_B,
+                                                           csr_col_ind_B,
+                                                           csr_val_B,
+                                                           beta,
+                                                           csr_row_ptr_D,
+                                                           csr_col_ind_D,
+                                                           csr_val_D,
+                                                           esc_row_ptr,
+                                                           esc_col_ind,
+                                                           esc_val,
+                                                           idx_base_A,
+                                                           idx_base_B,
+                                                           idx_base_D,
+                                                           mul,
+                                                           add,
+                                                           csr_row_ptr_M,
+                                                           csr_col_ind_M,
+                                                           idx_base_M,
+                                                           complement_M,
+                                                           triangle_M);
+}
+
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WFSIZE,
+          rocsparse_semiring SEMIRING,
+          typename I,
+          typename J,
+          typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_esc_expand_device_pointer(J n,
+                                           const J* __restrict__ offset,
+                                           const J* __restrict__ perm,
+                                           const T* __restrict__ alpha,
+                                           const I* __restrict__ csr_row_ptr_A,
+                                           const J* __restrict__ csr_col_ind_A,
+                                           const T* __restrict__ csr_val_A,
+                                           const I* __restrict__ csr_row_ptr_B,
+                                           const J* __restrict__ csr_col_ind_B,
+                                           const T* __restrict__ csr_val_B,
+                                           const T* __restrict__ beta,
+                                           const I* __restrict__ csr_row_ptr_D,
+                                           const J* __restrict__ csr_col_ind_D,
+                                           const T* __restrict__ csr_val_D,
+                                           const I* __restrict__ esc_row_ptr,
+                                           J* __restrict__ esc_col_ind,
+                                           T* __restrict__ esc_val,
+                                           rocsparse_index_base idx_base_A,
+                                           rocsparse_index_base idx_base_B,
+                                           rocsparse_index_base idx_base_D,
+                                           bool                 mul,
+                                           bool                 add,
+                                           const I* __restrict__ csr_row_ptr_M,
+                                           const J* __restrict__ csr_col_ind_M,
+                                           rocsparse_index_base idx_base_M,
+                                           bool                 complement_M,
+                                           int                  triangle_M)
+{
+    csrgemm_esc_expand_device<BLOCKSIZE, WFSIZE, SEMIRING>(
+        n,
+        offset,
+        perm,
+        (mul == true) ? *alpha : static_cast<T>(0),
+        csr_row_ptr_A,
+        csr_col_ind_A,
+        csr_val_A,
+        csr_row_ptr_B,
+        csr_col_ind_B,
+        csr_val_B,
+        (add == true) ? *beta : static_cast<T>(0),
+        csr_row_ptr_D,
+        csr_col_ind_D,
+        csr_val_D,
+        esc_row_ptr,
+        esc_col_ind,
+        esc_val,
+        idx_base_A,
+        idx_base_B,
+        idx_base_D,
+        mul,
+        add,
+        csr_row_ptr_M,
+        csr_col_ind_M,
+        idx_base_M,
+        complement_M,
+        triangle_M);
 }
 
 // Disable for rocsparse_double_complex, as well as double and rocsparse_float_complex
 // if I == J == int64_t, as required size would exceed available memory
-template <typename I,
+template <rocsparse_semiring SEMIRING,
+          typename I,
           typename J,
           typename T,
           typename std::enable_if<
@@ -420,12 +619,18 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                                                 rocsparse_index_base base_C,
                                                 rocsparse_index_base base_D,
                                                 bool                 mul,
-                                                bool                 add)
+                                                bool                 add,
+                                                const I*             csr_row_ptr_M,
+                                                const J*             csr_col_ind_M,
+                                                rocsparse_index_base base_M,
+                                                bool                 complement_M,
+                                                int                  triangle_M)
 {
     return rocsparse_status_internal_error;
 }
 
-template <typename I,
+template <rocsparse_semiring SEMIRING,
+          typename I,
           typename J,
           typename T,
           typename std::enable_if<
@@ -462,7 +667,12 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                                                 rocsparse_index_base base_C,
                                                 rocsparse_index_base base_D,
                                                 bool                 mul,
-                                                bool                 add)
+                                                bool                 add,
+                                                const I*             csr_row_ptr_M,
+                                                const J*             csr_col_ind_M,
+                                                rocsparse_index_base base_M,
+                                                bool                 complement_M,
+                                                int                  triangle_M)
 {
 #define CSRGEMM_DIM 1024
 #define CSRGEMM_SUB 64
@@ -472,7 +682,8 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
         hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<CSRGEMM_DIM,
                                                                       CSRGEMM_SUB,
                                                                       CSRGEMM_HASHSIZE,
-                                                                      CSRGEMM_FLL_HASH>),
+                                                                      CSRGEMM_FLL_HASH,
+                                                                      SEMIRING>),
                            dim3(group_size),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -499,14 +710,20 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                            base_C,
                            base_D,
                            mul,
-                           add);
+                           add,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M,
+                           triangle_M);
     }
     else
     {
         hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<CSRGEMM_DIM,
                                                                     CSRGEMM_SUB,
                                                                     CSRGEMM_HASHSIZE,
-                                                                    CSRGEMM_FLL_HASH>),
+                                                                    CSRGEMM_FLL_HASH,
+                                                                    SEMIRING>),
                            dim3(group_size),
                            dim3(CSRGEMM_DIM),
                            0,
@@ -533,7 +750,12 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
                            base_C,
                            base_D,
                            mul,
-                           add);
+                           add,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M,
+                           triangle_M);
     }
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
@@ -542,55 +764,388 @@ static inline rocsparse_status csrgemm_launcher(rocsparse_handle     handle,
     return rocsparse_status_success;
 }
 
-template <typename I, typename J, typename T>
-static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handle,
-                                                               rocsparse_operation       trans_A,
-                                                               rocsparse_operation       trans_B,
-                                                               J                         m,
-                                                               J                         n,
-                                                               J                         k,
-                                                               const T*                  alpha,
-                                                               const rocsparse_mat_descr descr_A,
-                                                               I                         nnz_A,
-                                                               const T*                  csr_val_A,
-                                                               const I* csr_row_ptr_A,
-                                                               const J* csr_col_ind_A,
-                                                               const rocsparse_mat_descr descr_B,
-                                                               I                         nnz_B,
-                                                               const T*                  csr_val_B,
-                                                               const I* csr_row_ptr_B,
-                                                               const J* csr_col_ind_B,
-                                                               const T* beta,
-                                                               const rocsparse_mat_descr descr_D,
-                                                               I                         nnz_D,
-                                                               const T*                  csr_val_D,
-                                                               const I* csr_row_ptr_D,
-                                                               const J* csr_col_ind_D,
-                                                               const rocsparse_mat_descr descr_C,
-                                                               T*                        csr_val_C,
-                                                               const I* csr_row_ptr_C,
-                                                               J*       csr_col_ind_C,
-                                                               const rocsparse_mat_info info_C,
-                                                               void*                    temp_buffer)
+// Maximum size of the ESC buffer. Without an explicit memory budget, the buffer is
+// limited to an eighth of the device memory.
+static inline size_t rocsparse_csrgemm_esc_limit(rocsparse_handle handle)
+{
+    if(handle->memory_budget != std::numeric_limits<size_t>::max())
+    {
+        return handle->memory_budget;
+    }
+
+    return handle->properties.totalGlobalMem / 8;
+}
+
+// Grow the ESC buffer of the csrgemm info, preserving the first keep_bytes bytes. Returns
+// rocsparse_status_memory_error, if the buffer cannot be allocated.
+static inline rocsparse_status rocsparse_csrgemm_esc_reserve(rocsparse_handle       handle,
+                                                             rocsparse_csrgemm_info info,
+                                                             size_t                 bytes,
+                                                             size_t                 keep_bytes)
+{
+    if(info->esc_buffer_bytes >= bytes)
+    {
+        return rocsparse_status_success;
+    }
+
+    void* esc_buffer;
+    if(hipMalloc(&esc_buffer, bytes) != hipSuccess)
+    {
+        // Clear the error state, such that the caller can fall back
+        (void)hipGetLastError();
+        return rocsparse_status_memory_error;
+    }
+
+    if(info->esc_buffer != nullptr)
+    {
+        if(keep_bytes > 0)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                esc_buffer, info->esc_buffer, keep_bytes, hipMemcpyDeviceToDevice, handle->stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+        }
+
+        RETURN_IF_HIP_ERROR(hipFree(info->esc_buffer));
+    }
+
+    info->esc_buffer       = esc_buffer;
+    info->esc_buffer_bytes = bytes;
+
+    return rocsparse_status_success;
+}
+
+// Expand-sort-compress for the rows of a group. If the buffer would exceed the ESC limit,
+// or cannot be allocated, the group is left untouched and processed is set to false, such
+// that the caller can fall back to the multipass kernel. The ESC buffer is sized, and the
+// expanded row offsets are computed, together with the row grouping of C. If the row
+// grouping is re-used, so are the ESC buffer and its row offsets, without any allocation
+// or synchronization.
+template <rocsparse_semiring SEMIRING, typename I, typename J, typename T>
+static inline rocsparse_status csrgemm_esc_launcher(rocsparse_handle       handle,
+                                                    rocsparse_csrgemm_info info,
+                                                    bool                   reuse_plan,
+                                                    J                      group_size,
+                                                    const J*               group_offset,
+                                                    const J*               perm,
+                                                    J                      n,
+                                                    const T*               alpha,
+                                                    const I*               csr_row_ptr_A,
+                                                    const J*               csr_col_ind_A,
+                                                    const T*               csr_val_A,
+                                                    const I*               csr_row_ptr_B,
+                                                    const J*               csr_col_ind_B,
+                                                    const T*               csr_val_B,
+                                                    const T*               beta,
+                                                    const I*               csr_row_ptr_D,
+                                                    const J*               csr_col_ind_D,
+                                                    const T*               csr_val_D,
+                                                    const I*               csr_row_ptr_C,
+                                                    J*                     csr_col_ind_C,
+                                                    T*                     csr_val_C,
+                                                    rocsparse_index_base   base_A,
+                                                    rocsparse_index_base   base_B,
+                                                    rocsparse_index_base   base_C,
+                                                    rocsparse_index_base   base_D,
+                                                    bool                   mul,
+                                                    bool                   add,
+                                                    const I*               csr_row_ptr_M,
+                                                    const J*               csr_col_ind_M,
+                                                    rocsparse_index_base   base_M,
+                                                    bool                   complement_M,
+                                                    int                    triangle_M,
+                                                    bool*                  processed)
 {
-    // Stream
     hipStream_t stream = handle->stream;
 
-    // Index base
-    rocsparse_index_base base_A
-        = info_C->csrgemm_info->mul ? descr_A->base : rocsparse_index_base_zero;
-    rocsparse_index_base base_B
-        = info_C->csrgemm_info->mul ? descr_B->base : rocsparse_index_base_zero;
-    rocsparse_index_base base_D
-        = info_C->csrgemm_info->add ? descr_D->base : rocsparse_index_base_zero;
+    *processed = false;
 
-    // Flag for exceeding shared memory
-    constexpr bool exceeding_smem
-        = std::is_same<T, rocsparse_double_complex>::value
-          || (std::is_same<T, double>::value && std::is_same<I, int64_t>::value
-              && std::is_same<J, int64_t>::value)
-          || (std::is_same<T, rocsparse_float_complex>::value && std::is_same<I, int64_t>::value
-              && std::is_same<J, int64_t>::value);
+    // Expanded row offsets of the group
+    size_t row_ptr_bytes = ((sizeof(I) * (group_size + 1) - 1) / 256 + 1) * 256;
+
+    // The ESC buffer has been sized by the row grouping that is re-used
+    bool esc_planned = (reuse_plan == true && info->plan_esc_valid == true);
+
+    I nnz_esc;
+
+    if(esc_planned == true)
+    {
+        // The row grouping already decided for the multipass kernel
+        if(info->plan_esc_processed == false)
+        {
+            return rocsparse_status_success;
+        }
+
+        nnz_esc = static_cast<I>(info->plan_esc_nnz);
+    }
+    else
+    {
+        // Record the decision for the multipass kernel, until ESC succeeds
+        info->plan_esc_valid     = true;
+        info->plan_esc_processed = false;
+
+        // rocprim buffer for the scan of the expanded row offsets
+        size_t rocprim_size;
+        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                    rocprim_size,
+                                                    (I*)nullptr,
+                                                    (I*)nullptr,
+                                                    static_cast<I>(0),
+                                                    group_size + 1,
+                                                    rocprim::plus<I>(),
+                                                    stream));
+
+        size_t scan_bytes = ((rocprim_size - 1) / 256 + 1) * 256;
+
+        if(row_ptr_bytes + scan_bytes > rocsparse_csrgemm_esc_limit(handle))
+        {
+            return rocsparse_status_success;
+        }
+
+        rocsparse_status status
+            = rocsparse_csrgemm_esc_reserve(handle, info, row_ptr_bytes + scan_bytes, 0);
+
+        if(status == rocsparse_status_memory_error)
+        {
+            return rocsparse_status_success;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(status);
+
+        I*    esc_row_ptr = reinterpret_cast<I*>(info->esc_buffer);
+        void* scan_buffer = reinterpret_cast<char*>(info->esc_buffer) + row_ptr_bytes;
+
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 32
+        // Number of expanded entries per row
+        hipLaunchKernelGGL((csrgemm_esc_row_products<CSRGEMM_DIM, CSRGEMM_SUB>),
+                           dim3((group_size - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           group_size,
+                           group_offset,
+                           perm,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_row_ptr_D,
+                           esc_row_ptr,
+                           base_A,
+                           mul,
+                           add);
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+        RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(scan_buffer,
+                                                    rocprim_size,
+                                                    esc_row_ptr,
+                                                    esc_row_ptr,
+                                                    static_cast<I>(0),
+                                                    group_size + 1,
+                                                    rocprim::plus<I>(),
+                                                    stream));
+
+        // Total number of expanded entries
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &nnz_esc, esc_row_ptr + group_size, sizeof(I), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // rocprim segmented sort is limited to 32 bit sizes
+        if(static_cast<int64_t>(nnz_esc) > std::numeric_limits<unsigned int>::max())
+        {
+            return rocsparse_status_success;
+        }
+    }
+
+    // Number of bits to sort, masked entries carry column index n
+    unsigned int end_bit = 64 - __builtin_clzll(static_cast<unsigned long long>(n));
+
+    // rocprim buffer for the segmented sort
+    rocprim::double_buffer<J> keys(nullptr, nullptr);
+    rocprim::double_buffer<T> vals(nullptr, nullptr);
+
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(nullptr,
+                                                            rocprim_size,
+                                                            keys,
+                                                            vals,
+                                                            static_cast<unsigned int>(nnz_esc),
+                                                            static_cast<unsigned int>(group_size),
+                                                            (I*)nullptr,
+                                                            (I*)nullptr,
+                                                            0,
+                                                            end_bit,
+                                                            stream));
+
+    size_t col_bytes  = ((sizeof(J) * nnz_esc - 1) / 256 + 1) * 256;
+    size_t val_bytes  = ((sizeof(T) * nnz_esc - 1) / 256 + 1) * 256;
+    size_t sort_bytes = ((rocprim_size - 1) / 256 + 1) * 256;
+    size_t esc_bytes  = row_ptr_bytes + 2 * col_bytes + 2 * val_bytes + sort_bytes;
+
+    if(esc_planned == false)
+    {
+        // Fall back to the multipass kernel if the ESC buffer exceeds the ESC limit
+        if(esc_bytes > rocsparse_csrgemm_esc_limit(handle))
+        {
+            return rocsparse_status_success;
+        }
+
+        rocsparse_status status
+            = rocsparse_csrgemm_esc_reserve(handle, info, esc_bytes, row_ptr_bytes);
+
+        if(status == rocsparse_status_memory_error)
+        {
+            return rocsparse_status_success;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(status);
+
+        info->plan_esc_processed = true;
+        info->plan_esc_nnz       = nnz_esc;
+    }
+
+    char* ptr = reinterpret_cast<char*>(info->esc_buffer);
+
+    I* esc_row_ptr = reinterpret_cast<I*>(ptr);
+    ptr += row_ptr_bytes;
+    J* esc_col_ind1 = reinterpret_cast<J*>(ptr);
+    ptr += col_bytes;
+    J* esc_col_ind2 = reinterpret_cast<J*>(ptr);
+    ptr += col_bytes;
+    T* esc_val1 = reinterpret_cast<T*>(ptr);
+    ptr += val_bytes;
+    T* esc_val2 = reinterpret_cast<T*>(ptr);
+    ptr += val_bytes;
+    void* sort_buffer = reinterpret_cast<void*>(ptr);
+
+#define CSRGEMM_DIM 512
+#define CSRGEMM_SUB 16
+    // Expand all intermediate products
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrgemm_esc_expand_device_pointer<CSRGEMM_DIM, CSRGEMM_SUB, SEMIRING>),
+                           dim3(group_size),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           n,
+                           group_offset,
+                           perm,
+                           alpha,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_val_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_val_B,
+                           beta,
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           csr_val_D,
+                           esc_row_ptr,
+                           esc_col_ind1,
+                           esc_val1,
+                           base_A,
+                           base_B,
+                           base_D,
+                           mul,
+                           add,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M,
+                           triangle_M);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrgemm_esc_expand_host_pointer<CSRGEMM_DIM, CSRGEMM_SUB, SEMIRING>),
+                           dim3(group_size),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           n,
+                           group_offset,
+                           perm,
+                           mul ? *alpha : static_cast<T>(0),
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_val_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_val_B,
+                           add ? *beta : static_cast<T>(0),
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           csr_val_D,
+                           esc_row_ptr,
+                           esc_col_ind1,
+                           esc_val1,
+                           base_A,
+                           base_B,
+                           base_D,
+                           mul,
+                           add,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M,
+                           triangle_M);
+    }
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+
+    // Sort the expanded entries of each row by column index
+    keys = rocprim::double_buffer<J>(esc_col_ind1, esc_col_ind2);
+    vals = rocprim::double_buffer<T>(esc_val1, esc_val2);
+
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(sort_buffer,
+                                                            rocprim_size,
+                                                            keys,
+                                                            vals,
+                                                            static_cast<unsigned int>(nnz_esc),
+                                                            static_cast<unsigned int>(group_size),
+                                                            esc_row_ptr,
+                                                            esc_row_ptr + 1,
+                                                            0,
+                                                            end_bit,
+                                                            stream));
+
+#define CSRGEMM_DIM 256
+    // Compress duplicates into C
+    hipLaunchKernelGGL((csrgemm_esc_compress<CSRGEMM_DIM, SEMIRING>),
+                       dim3(group_size),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       n,
+                       group_offset,
+                       perm,
+                       esc_row_ptr,
+                       keys.current(),
+                       vals.current(),
+                       csr_row_ptr_C,
+                       csr_col_ind_C,
+                       csr_val_C,
+                       base_C);
+#undef CSRGEMM_DIM
+
+    *processed = true;
+
+    return rocsparse_status_success;
+}
+
+// Sort the rows of C into groups of similar non-zero entries per row
+template <typename I, typename J, bool EXCEEDING_SMEM>
+static inline rocsparse_status rocsparse_csrgemm_group_template(rocsparse_handle handle,
+                                                                J                m,
+                                                                const I*         csr_row_ptr_C,
+                                                                J*               h_group_size,
+                                                                J**              group_offset,
+                                                                J**              perm,
+                                                                void*            temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
 
     // Temporary buffer
     char* buffer = reinterpret_cast<char*>(temp_buffer);
@@ -627,11 +1182,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
     J* d_group_offset = reinterpret_cast<J*>(buffer);
     buffer += sizeof(J) * 256;
 
-    // Group size buffer
-    J h_group_size[CSRGEMM_MAXGROUPS];
-
     // Initialize group sizes with zero
-    memset(&h_group_size[0], 0, sizeof(J) * CSRGEMM_MAXGROUPS);
+    memset(h_group_size, 0, sizeof(J) * CSRGEMM_MAXGROUPS);
 
     // Permutation array
     J* d_perm = nullptr;
@@ -660,7 +1212,7 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         // Determine number of rows per group
 #define CSRGEMM_DIM 256
         hipLaunchKernelGGL(
-            (csrgemm_group_reduce_part2<CSRGEMM_DIM, CSRGEMM_MAXGROUPS, exceeding_smem>),
+            (csrgemm_group_reduce_part2<CSRGEMM_DIM, CSRGEMM_MAXGROUPS, EXCEEDING_SMEM>),
             dim3(CSRGEMM_DIM),
             dim3(CSRGEMM_DIM),
             0,
@@ -697,43 +1249,263 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                                     rocprim::plus<J>(),
                                                     stream));
 
-        // Copy group sizes to host
-        RETURN_IF_HIP_ERROR(hipMemcpyAsync(&h_group_size,
-                                           d_group_size,
-                                           sizeof(J) * CSRGEMM_MAXGROUPS,
-                                           hipMemcpyDeviceToHost,
-                                           stream));
+        // Copy group sizes to host
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_group_size,
+                                           d_group_size,
+                                           sizeof(J) * CSRGEMM_MAXGROUPS,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // Create identity permutation for group access
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_create_identity_permutation_template(handle, m, tmp_perm));
+
+        rocprim::double_buffer<int> d_keys(tmp_groups, tmp_keys);
+        rocprim::double_buffer<J>   d_vals(tmp_perm, tmp_vals);
+
+        // Sort pairs (by groups)
+        RETURN_IF_HIP_ERROR(
+            rocprim::radix_sort_pairs(nullptr, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
+        rocprim_buffer = reinterpret_cast<void*>(buffer);
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+            rocprim_buffer, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
+
+        d_perm = d_vals.current();
+
+        // Release tmp_groups buffer
+        buffer -= ((sizeof(int) * m - 1) / 256 + 1) * 256;
+
+        // Release tmp_keys buffer
+        buffer -= ((sizeof(int) * m - 1) / 256 + 1) * 256;
+    }
+    else
+    {
+        // First group processes all rows
+        h_group_size[0] = m;
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(J), stream));
+    }
+
+    *group_offset = d_group_offset;
+    *perm         = d_perm;
+
+    return rocsparse_status_success;
+}
+
+// Keep the row grouping of C for subsequent numerical phases
+template <typename J>
+static inline rocsparse_status rocsparse_csrgemm_keep_plan(rocsparse_handle       handle,
+                                                           rocsparse_csrgemm_info info,
+                                                           J                      m,
+                                                           const void*            csr_row_ptr_C,
+                                                           bool                   exceeding_smem,
+                                                           const J*               h_group_size,
+                                                           const J*               group_offset,
+                                                           const J*               perm)
+{
+    info->plan_valid     = false;
+    info->plan_esc_valid = false;
+
+    size_t offset_bytes = ((sizeof(J) * CSRGEMM_MAXGROUPS - 1) / 256 + 1) * 256;
+    size_t perm_bytes   = (perm != nullptr) ? sizeof(J) * m : 0;
+
+    // The row grouping is not kept, if it exceeds the memory budget of the handle
+    if(offset_bytes + perm_bytes > handle->memory_budget)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(info->plan_buffer_bytes < offset_bytes + perm_bytes)
+    {
+        if(info->plan_buffer != nullptr)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(info->plan_buffer));
+            info->plan_buffer       = nullptr;
+            info->plan_buffer_bytes = 0;
+        }
+
+        RETURN_IF_HIP_ERROR(hipMalloc(&info->plan_buffer, offset_bytes + perm_bytes));
+        info->plan_buffer_bytes = offset_bytes + perm_bytes;
+    }
+
+    char* plan_buffer = reinterpret_cast<char*>(info->plan_buffer);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(plan_buffer,
+                                       group_offset,
+                                       sizeof(J) * CSRGEMM_MAXGROUPS,
+                                       hipMemcpyDeviceToDevice,
+                                       handle->stream));
+
+    if(perm != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            plan_buffer + offset_bytes, perm, perm_bytes, hipMemcpyDeviceToDevice, handle->stream));
+    }
+
+    for(int i = 0; i < CSRGEMM_MAXGROUPS; ++i)
+    {
+        info->plan_group_size[i] = h_group_size[i];
+    }
+
+    info->plan_m              = m;
+    info->plan_index_size     = sizeof(J);
+    info->plan_row_ptr_C      = csr_row_ptr_C;
+    info->plan_exceeding_smem = exceeding_smem;
+    info->plan_use_perm       = (perm != nullptr);
+    info->plan_valid          = true;
+
+    return rocsparse_status_success;
+}
+
+template <rocsparse_semiring SEMIRING = rocsparse_semiring_plus_times,
+          typename I,
+          typename J,
+          typename T>
+static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle          handle,
+                                                               rocsparse_operation       trans_A,
+                                                               rocsparse_operation       trans_B,
+                                                               J                         m,
+                                                               J                         n,
+                                                               J                         k,
+                                                               const T*                  alpha,
+                                                               const rocsparse_mat_descr descr_A,
+                                                               I                         nnz_A,
+                                                               const T*                  csr_val_A,
+                                                               const I* csr_row_ptr_A,
+                                                               const J* csr_col_ind_A,
+                                                               const rocsparse_mat_descr descr_B,
+                                                               I                         nnz_B,
+                                                               const T*                  csr_val_B,
+                                                               const I* csr_row_ptr_B,
+                                                               const J* csr_col_ind_B,
+                                                               const T* beta,
+                                                               const rocsparse_mat_descr descr_D,
+                                                               I                         nnz_D,
+                                                               const T*                  csr_val_D,
+                                                               const I* csr_row_ptr_D,
+                                                               const J* csr_col_ind_D,
+                                                               const rocsparse_mat_descr descr_C,
+                                                               T*                        csr_val_C,
+                                                               const I* csr_row_ptr_C,
+                                                               J*       csr_col_ind_C,
+                                                               const rocsparse_mat_info info_C,
+                                                               void*                    temp_buffer)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Index base
+    rocsparse_index_base base_A
+        = info_C->csrgemm_info->mul ? descr_A->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_B
+        = info_C->csrgemm_info->mul ? descr_B->base : rocsparse_index_base_zero;
+    rocsparse_index_base base_D
+        = info_C->csrgemm_info->add ? descr_D->base : rocsparse_index_base_zero;
 
-        // Wait for host transfer to finish
-        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    // Structural mask of C, if any
+    const I*             csr_row_ptr_M = (const I*)info_C->csrgemm_info->mask_row_ptr;
+    const J*             csr_col_ind_M = (const J*)info_C->csrgemm_info->mask_col_ind;
+    rocsparse_index_base base_M        = info_C->csrgemm_info->mask_base;
+    bool                 complement_M  = info_C->csrgemm_info->mask_complement;
+    int                  triangle_M    = info_C->csrgemm_info->mask_triangle;
 
-        // Create identity permutation for group access
-        RETURN_IF_ROCSPARSE_ERROR(
-            rocsparse_create_identity_permutation_template(handle, m, tmp_perm));
+    // Flag for exceeding shared memory
+    constexpr bool exceeding_smem
+        = std::is_same<T, rocsparse_double_complex>::value
+          || (std::is_same<T, double>::value && std::is_same<I, int64_t>::value
+              && std::is_same<J, int64_t>::value)
+          || (std::is_same<T, rocsparse_float_complex>::value && std::is_same<I, int64_t>::value
+              && std::is_same<J, int64_t>::value);
 
-        rocprim::double_buffer<int> d_keys(tmp_groups, tmp_keys);
-        rocprim::double_buffer<J>   d_vals(tmp_perm, tmp_vals);
+    // Row groups of C
+    J  h_group_size[CSRGEMM_MAXGROUPS];
+    J* d_group_offset;
+    J* d_perm;
 
-        // Sort pairs (by groups)
-        RETURN_IF_HIP_ERROR(
-            rocprim::radix_sort_pairs(nullptr, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
-        rocprim_buffer = reinterpret_cast<void*>(buffer);
-        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
-            rocprim_buffer, rocprim_size, d_keys, d_vals, m, 0, 3, stream));
+    rocsparse_csrgemm_info csrgemm_info = info_C->csrgemm_info;
 
-        d_perm = d_vals.current();
+    // Re-use the row grouping of a previous call, if the sparsity pattern of C is unchanged.
+    // This avoids sorting the rows and the synchronizing transfers of the group sizes.
+    bool reuse_plan = csrgemm_info->plan_valid == true && csrgemm_info->plan_m == m
+                      && csrgemm_info->plan_index_size == sizeof(J)
+                      && csrgemm_info->plan_row_ptr_C == csr_row_ptr_C
+                      && csrgemm_info->plan_exceeding_smem == exceeding_smem;
 
-        // Release tmp_groups buffer
-        buffer -= ((sizeof(int) * m - 1) / 256 + 1) * 256;
+    if(reuse_plan == true)
+    {
+        char*  plan_buffer  = reinterpret_cast<char*>(csrgemm_info->plan_buffer);
+        size_t offset_bytes = ((sizeof(J) * CSRGEMM_MAXGROUPS - 1) / 256 + 1) * 256;
 
-        // Release tmp_keys buffer
-        buffer -= ((sizeof(int) * m - 1) / 256 + 1) * 256;
+        d_group_offset = reinterpret_cast<J*>(plan_buffer);
+        d_perm         = csrgemm_info->plan_use_perm
+                             ? reinterpret_cast<J*>(plan_buffer + offset_bytes)
+                             : nullptr;
+
+        for(int i = 0; i < CSRGEMM_MAXGROUPS; ++i)
+        {
+            h_group_size[i] = static_cast<J>(csrgemm_info->plan_group_size[i]);
+        }
     }
     else
     {
-        // First group processes all rows
-        h_group_size[0] = m;
-        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_group_offset, 0, sizeof(J), stream));
+        RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrgemm_group_template<I, J, exceeding_smem>(
+            handle, m, csr_row_ptr_C, h_group_size, &d_group_offset, &d_perm, temp_buffer)));
+
+        if(csrgemm_info->plan_keep == true)
+        {
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_keep_plan(handle,
+                                                                  csrgemm_info,
+                                                                  m,
+                                                                  csr_row_ptr_C,
+                                                                  exceeding_smem,
+                                                                  h_group_size,
+                                                                  d_group_offset,
+                                                                  d_perm));
+        }
+    }
+
+    // Rows of the heaviest group are processed by expand-sort-compress, if its buffer
+    // fits into the ESC limit and can be allocated. Otherwise, the multipass kernel is used.
+    bool esc_group = false;
+
+    if(h_group_size[7] > 0)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            csrgemm_esc_launcher<SEMIRING>(handle,
+                                           csrgemm_info,
+                                           reuse_plan,
+                                           h_group_size[7],
+                                           &d_group_offset[7],
+                                           d_perm,
+                                           n,
+                                           alpha,
+                                           csr_row_ptr_A,
+                                           csr_col_ind_A,
+                                           csr_val_A,
+                                           csr_row_ptr_B,
+                                           csr_col_ind_B,
+                                           csr_val_B,
+                                           beta,
+                                           csr_row_ptr_D,
+                                           csr_col_ind_D,
+                                           csr_val_D,
+                                           csr_row_ptr_C,
+                                           csr_col_ind_C,
+                                           csr_val_C,
+                                           base_A,
+                                           base_B,
+                                           descr_C->base,
+                                           base_D,
+                                           csrgemm_info->mul,
+                                           csrgemm_info->add,
+                                           csr_row_ptr_M,
+                                           csr_col_ind_M,
+                                           base_M,
+                                           complement_M,
+                                           triangle_M,
+                                           &esc_group));
     }
 
     // Compute columns and accumulate values for each group
@@ -750,7 +1522,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_wf_per_row_device_pointer<CSRGEMM_DIM,
                                                                        CSRGEMM_SUB,
                                                                        CSRGEMM_HASHSIZE,
-                                                                       CSRGEMM_FLL_HASH>),
+                                                                       CSRGEMM_FLL_HASH,
+                                                                       SEMIRING>),
                                dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -778,7 +1551,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -793,7 +1571,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_wf_per_row_device_pointer<CSRGEMM_DIM,
                                                                        CSRGEMM_SUB,
                                                                        CSRGEMM_HASHSIZE,
-                                                                       CSRGEMM_FLL_HASH>),
+                                                                       CSRGEMM_FLL_HASH,
+                                                                       SEMIRING>),
                                dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -821,7 +1600,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -836,7 +1620,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<CSRGEMM_DIM,
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
-                                                                          CSRGEMM_FLL_HASH>),
+                                                                          CSRGEMM_FLL_HASH,
+                                                                          SEMIRING>),
                                dim3(h_group_size[2]),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -863,7 +1648,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -878,7 +1668,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<CSRGEMM_DIM,
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
-                                                                          CSRGEMM_FLL_HASH>),
+                                                                          CSRGEMM_FLL_HASH,
+                                                                          SEMIRING>),
                                dim3(h_group_size[3]),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -905,7 +1696,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -920,7 +1716,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<CSRGEMM_DIM,
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
-                                                                          CSRGEMM_FLL_HASH>),
+                                                                          CSRGEMM_FLL_HASH,
+                                                                          SEMIRING>),
                                dim3(h_group_size[4]),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -947,7 +1744,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -962,7 +1764,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_block_per_row_device_pointer<CSRGEMM_DIM,
                                                                           CSRGEMM_SUB,
                                                                           CSRGEMM_HASHSIZE,
-                                                                          CSRGEMM_FLL_HASH>),
+                                                                          CSRGEMM_FLL_HASH,
+                                                                          SEMIRING>),
                                dim3(h_group_size[5]),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -989,7 +1792,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -999,38 +1807,43 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         // Group 6: 2049 - 4096 non-zeros per row
         if(h_group_size[6] > 0 && !exceeding_smem)
         {
-            RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher(handle,
-                                                       h_group_size[6],
-                                                       &d_group_offset[6],
-                                                       d_perm,
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       alpha,
-                                                       csr_row_ptr_A,
-                                                       csr_col_ind_A,
-                                                       csr_val_A,
-                                                       csr_row_ptr_B,
-                                                       csr_col_ind_B,
-                                                       csr_val_B,
-                                                       beta,
-                                                       csr_row_ptr_D,
-                                                       csr_col_ind_D,
-                                                       csr_val_D,
-                                                       csr_row_ptr_C,
-                                                       csr_col_ind_C,
-                                                       csr_val_C,
-                                                       base_A,
-                                                       base_B,
-                                                       descr_C->base,
-                                                       base_D,
-                                                       info_C->csrgemm_info->mul,
-                                                       info_C->csrgemm_info->add));
+            RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher<SEMIRING>(handle,
+                                                                 h_group_size[6],
+                                                                 &d_group_offset[6],
+                                                                 d_perm,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 alpha,
+                                                                 csr_row_ptr_A,
+                                                                 csr_col_ind_A,
+                                                                 csr_val_A,
+                                                                 csr_row_ptr_B,
+                                                                 csr_col_ind_B,
+                                                                 csr_val_B,
+                                                                 beta,
+                                                                 csr_row_ptr_D,
+                                                                 csr_col_ind_D,
+                                                                 csr_val_D,
+                                                                 csr_row_ptr_C,
+                                                                 csr_col_ind_C,
+                                                                 csr_val_C,
+                                                                 base_A,
+                                                                 base_B,
+                                                                 descr_C->base,
+                                                                 base_D,
+                                                                 info_C->csrgemm_info->mul,
+                                                                 info_C->csrgemm_info->add,
+                                                                 csr_row_ptr_M,
+                                                                 csr_col_ind_M,
+                                                                 base_M,
+                                                                 complement_M,
+                                                                 triangle_M));
         }
 #endif
 
         // Group 7: more than 4096 non-zeros per row
-        if(h_group_size[7] > 0)
+        if(h_group_size[7] > 0 && esc_group == false)
         {
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 16
@@ -1039,14 +1852,28 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
 
             if(info_C->csrgemm_info->mul == true)
             {
-                // Allocate additional buffer for C = alpha * A * B
-                RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(I) * nnz_A));
+                // Additional buffer for C = alpha * A * B, which is kept for subsequent calls
+                if(csrgemm_info->workspace_bytes < sizeof(I) * nnz_A)
+                {
+                    if(csrgemm_info->workspace != nullptr)
+                    {
+                        RETURN_IF_HIP_ERROR(hipFree(csrgemm_info->workspace));
+                        csrgemm_info->workspace       = nullptr;
+                        csrgemm_info->workspace_bytes = 0;
+                    }
+
+                    RETURN_IF_HIP_ERROR(hipMalloc(&csrgemm_info->workspace, sizeof(I) * nnz_A));
+                    csrgemm_info->workspace_bytes = sizeof(I) * nnz_A;
+                }
+
+                workspace_B = reinterpret_cast<I*>(csrgemm_info->workspace);
             }
 
             hipLaunchKernelGGL(
                 (csrgemm_fill_block_per_row_multipass_device_pointer<CSRGEMM_DIM,
                                                                      CSRGEMM_SUB,
-                                                                     CSRGEMM_CHUNKSIZE>),
+                                                                     CSRGEMM_CHUNKSIZE,
+                                                                     SEMIRING>),
                 dim3(h_group_size[7]),
                 dim3(CSRGEMM_DIM),
                 0,
@@ -1074,12 +1901,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                 descr_C->base,
                 base_D,
                 info_C->csrgemm_info->mul,
-                info_C->csrgemm_info->add);
-
-            if(info_C->csrgemm_info->mul == true)
-            {
-                RETURN_IF_HIP_ERROR(hipFree(workspace_B));
-            }
+                info_C->csrgemm_info->add,
+                csr_row_ptr_M,
+                csr_col_ind_M,
+                base_M,
+                complement_M,
+                triangle_M);
 #undef CSRGEMM_CHUNKSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1096,7 +1923,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_wf_per_row_host_pointer<CSRGEMM_DIM,
                                                                      CSRGEMM_SUB,
                                                                      CSRGEMM_HASHSIZE,
-                                                                     CSRGEMM_FLL_HASH>),
+                                                                     CSRGEMM_FLL_HASH,
+                                                                     SEMIRING>),
                                dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -1124,7 +1952,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1139,7 +1972,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_wf_per_row_host_pointer<CSRGEMM_DIM,
                                                                      CSRGEMM_SUB,
                                                                      CSRGEMM_HASHSIZE,
-                                                                     CSRGEMM_FLL_HASH>),
+                                                                     CSRGEMM_FLL_HASH,
+                                                                     SEMIRING>),
                                dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -1167,7 +2001,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1182,7 +2021,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<CSRGEMM_DIM,
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
-                                                                        CSRGEMM_FLL_HASH>),
+                                                                        CSRGEMM_FLL_HASH,
+                                                                        SEMIRING>),
                                dim3(h_group_size[2]),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -1209,7 +2049,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1224,7 +2069,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<CSRGEMM_DIM,
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
-                                                                        CSRGEMM_FLL_HASH>),
+                                                                        CSRGEMM_FLL_HASH,
+                                                                        SEMIRING>),
                                dim3(h_group_size[3]),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -1251,7 +2097,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1266,7 +2117,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<CSRGEMM_DIM,
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
-                                                                        CSRGEMM_FLL_HASH>),
+                                                                        CSRGEMM_FLL_HASH,
+                                                                        SEMIRING>),
                                dim3(h_group_size[4]),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -1293,7 +2145,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1308,7 +2165,8 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
             hipLaunchKernelGGL((csrgemm_fill_block_per_row_host_pointer<CSRGEMM_DIM,
                                                                         CSRGEMM_SUB,
                                                                         CSRGEMM_HASHSIZE,
-                                                                        CSRGEMM_FLL_HASH>),
+                                                                        CSRGEMM_FLL_HASH,
+                                                                        SEMIRING>),
                                dim3(h_group_size[5]),
                                dim3(CSRGEMM_DIM),
                                0,
@@ -1335,7 +2193,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                                descr_C->base,
                                base_D,
                                info_C->csrgemm_info->mul,
-                               info_C->csrgemm_info->add);
+                               info_C->csrgemm_info->add,
+                               csr_row_ptr_M,
+                               csr_col_ind_M,
+                               base_M,
+                               complement_M,
+                               triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1345,38 +2208,43 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
         // Group 6: 2049 - 4096 non-zeros per row
         if(h_group_size[6] > 0 && !exceeding_smem)
         {
-            RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher(handle,
-                                                       h_group_size[6],
-                                                       &d_group_offset[6],
-                                                       d_perm,
-                                                       m,
-                                                       n,
-                                                       k,
-                                                       alpha,
-                                                       csr_row_ptr_A,
-                                                       csr_col_ind_A,
-                                                       csr_val_A,
-                                                       csr_row_ptr_B,
-                                                       csr_col_ind_B,
-                                                       csr_val_B,
-                                                       beta,
-                                                       csr_row_ptr_D,
-                                                       csr_col_ind_D,
-                                                       csr_val_D,
-                                                       csr_row_ptr_C,
-                                                       csr_col_ind_C,
-                                                       csr_val_C,
-                                                       base_A,
-                                                       base_B,
-                                                       descr_C->base,
-                                                       base_D,
-                                                       info_C->csrgemm_info->mul,
-                                                       info_C->csrgemm_info->add));
+            RETURN_IF_ROCSPARSE_ERROR(csrgemm_launcher<SEMIRING>(handle,
+                                                                 h_group_size[6],
+                                                                 &d_group_offset[6],
+                                                                 d_perm,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 alpha,
+                                                                 csr_row_ptr_A,
+                                                                 csr_col_ind_A,
+                                                                 csr_val_A,
+                                                                 csr_row_ptr_B,
+                                                                 csr_col_ind_B,
+                                                                 csr_val_B,
+                                                                 beta,
+                                                                 csr_row_ptr_D,
+                                                                 csr_col_ind_D,
+                                                                 csr_val_D,
+                                                                 csr_row_ptr_C,
+                                                                 csr_col_ind_C,
+                                                                 csr_val_C,
+                                                                 base_A,
+                                                                 base_B,
+                                                                 descr_C->base,
+                                                                 base_D,
+                                                                 info_C->csrgemm_info->mul,
+                                                                 info_C->csrgemm_info->add,
+                                                                 csr_row_ptr_M,
+                                                                 csr_col_ind_M,
+                                                                 base_M,
+                                                                 complement_M,
+                                                                 triangle_M));
         }
 #endif
 
         // Group 7: more than 4096 non-zeros per row
-        if(h_group_size[7] > 0)
+        if(h_group_size[7] > 0 && esc_group == false)
         {
 #define CSRGEMM_DIM 512
 #define CSRGEMM_SUB 16
@@ -1385,14 +2253,28 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
 
             if(info_C->csrgemm_info->mul == true)
             {
-                // Allocate additional buffer for C = alpha * A * B
-                RETURN_IF_HIP_ERROR(hipMalloc((void**)&workspace_B, sizeof(I) * nnz_A));
+                // Additional buffer for C = alpha * A * B, which is kept for subsequent calls
+                if(csrgemm_info->workspace_bytes < sizeof(I) * nnz_A)
+                {
+                    if(csrgemm_info->workspace != nullptr)
+                    {
+                        RETURN_IF_HIP_ERROR(hipFree(csrgemm_info->workspace));
+                        csrgemm_info->workspace       = nullptr;
+                        csrgemm_info->workspace_bytes = 0;
+                    }
+
+                    RETURN_IF_HIP_ERROR(hipMalloc(&csrgemm_info->workspace, sizeof(I) * nnz_A));
+                    csrgemm_info->workspace_bytes = sizeof(I) * nnz_A;
+                }
+
+                workspace_B = reinterpret_cast<I*>(csrgemm_info->workspace);
             }
 
             hipLaunchKernelGGL(
                 (csrgemm_fill_block_per_row_multipass_host_pointer<CSRGEMM_DIM,
                                                                    CSRGEMM_SUB,
-                                                                   CSRGEMM_CHUNKSIZE>),
+                                                                   CSRGEMM_CHUNKSIZE,
+                                                                   SEMIRING>),
                 dim3(h_group_size[7]),
                 dim3(CSRGEMM_DIM),
                 0,
@@ -1420,12 +2302,12 @@ static inline rocsparse_status rocsparse_csrgemm_calc_template(rocsparse_handle
                 descr_C->base,
                 base_D,
                 info_C->csrgemm_info->mul,
-                info_C->csrgemm_info->add);
-
-            if(info_C->csrgemm_info->mul == true)
-            {
-                RETURN_IF_HIP_ERROR(hipFree(workspace_B));
-            }
+                info_C->csrgemm_info->add,
+                csr_row_ptr_M,
+                csr_col_ind_M,
+                base_M,
+                complement_M,
+                triangle_M);
 #undef CSRGEMM_CHUNKSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1613,7 +2495,10 @@ static inline rocsparse_status rocsparse_csrgemm_multadd_template(rocsparse_hand
                                            temp_buffer);
 }
 
-template <typename I, typename J, typename T>
+template <rocsparse_semiring SEMIRING = rocsparse_semiring_plus_times,
+          typename I,
+          typename J,
+          typename T>
 static inline rocsparse_status rocsparse_csrgemm_mult_template(rocsparse_handle          handle,
                                                                rocsparse_operation       trans_A,
                                                                rocsparse_operation       trans_B,
@@ -1695,35 +2580,35 @@ static inline rocsparse_status rocsparse_csrgemm_mult_template(rocsparse_handle
     }
 
     // Perform gemm calculation
-    return rocsparse_csrgemm_calc_template(handle,
-                                           trans_A,
-                                           trans_B,
-                                           m,
-                                           n,
-                                           k,
-                                           alpha,
-                                           descr_A,
-                                           nnz_A,
-                                           csr_val_A,
-                                           csr_row_ptr_A,
-                                           csr_col_ind_A,
-                                           descr_B,
-                                           nnz_B,
-                                           csr_val_B,
-                                           csr_row_ptr_B,
-                                           csr_col_ind_B,
-                                           (const T*)nullptr,
-                                           nullptr,
-                                           (I)0,
-                                           (const T*)nullptr,
-                                           (const I*)nullptr,
-                                           (const J*)nullptr,
-                                           descr_C,
-                                           csr_val_C,
-                                           csr_row_ptr_C,
-                                           csr_col_ind_C,
-                                           info_C,
-                                           temp_buffer);
+    return rocsparse_csrgemm_calc_template<SEMIRING>(handle,
+                                                     trans_A,
+                                                     trans_B,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     descr_A,
+                                                     nnz_A,
+                                                     csr_val_A,
+                                                     csr_row_ptr_A,
+                                                     csr_col_ind_A,
+                                                     descr_B,
+                                                     nnz_B,
+                                                     csr_val_B,
+                                                     csr_row_ptr_B,
+                                                     csr_col_ind_B,
+                                                     (const T*)nullptr,
+                                                     nullptr,
+                                                     (I)0,
+                                                     (const T*)nullptr,
+                                                     (const I*)nullptr,
+                                                     (const J*)nullptr,
+                                                     descr_C,
+                                                     csr_val_C,
+                                                     csr_row_ptr_C,
+                                                     csr_col_ind_C,
+                                                     info_C,
+                                                     temp_buffer);
 }
 
 template <unsigned int BLOCKSIZE, typename I, typename T>
@@ -1856,6 +2741,184 @@ static inline rocsparse_status rocsparse_csrgemm_scal_template(rocsparse_handle
     return rocsparse_status_success;
 }
 
+template <typename I, typename J>
+rocsparse_status rocsparse_csrgemm_symbolic_template(rocsparse_handle          handle,
+                                                     J                         m,
+                                                     J                         n,
+                                                     J                         k,
+                                                     const rocsparse_mat_descr descr_A,
+                                                     I                         nnz_A,
+                                                     const I*                  csr_row_ptr_A,
+                                                     const J*                  csr_col_ind_A,
+                                                     const rocsparse_mat_descr descr_B,
+                                                     I                         nnz_B,
+                                                     const I*                  csr_row_ptr_B,
+                                                     const J*                  csr_col_ind_B,
+                                                     const rocsparse_mat_descr descr_C,
+                                                     const I*                  csr_row_ptr_C,
+                                                     J*                        csr_col_ind_C,
+                                                     const rocsparse_mat_info  info_C,
+                                                     void*                     temp_buffer)
+{
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_A == 0 || nnz_B == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Row groups of C. There is no value array in shared memory, rows with more than
+    // 2048 entries are processed by the multipass kernel.
+    J  h_group_size[CSRGEMM_MAXGROUPS];
+    J* d_group_offset;
+    J* d_perm;
+
+    RETURN_IF_ROCSPARSE_ERROR((rocsparse_csrgemm_group_template<I, J, true>(
+        handle, m, csr_row_ptr_C, h_group_size, &d_group_offset, &d_perm, temp_buffer)));
+
+    // Group 0: 0 - 16 non-zeros per row
+    if(h_group_size[0] > 0)
+    {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 8
+#define CSRGEMM_HASHSIZE 16
+        hipLaunchKernelGGL((csrgemm_symbolic_wf_per_row<CSRGEMM_DIM,
+                                                        CSRGEMM_SUB,
+                                                        CSRGEMM_HASHSIZE,
+                                                        CSRGEMM_FLL_HASH>),
+                           dim3((h_group_size[0] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           h_group_size[0],
+                           &d_group_offset[0],
+                           d_perm,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
+#undef CSRGEMM_HASHSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
+    // Group 1: 17 - 32 non-zeros per row
+    if(h_group_size[1] > 0)
+    {
+#define CSRGEMM_DIM 256
+#define CSRGEMM_SUB 16
+#define CSRGEMM_HASHSIZE 32
+        hipLaunchKernelGGL((csrgemm_symbolic_wf_per_row<CSRGEMM_DIM,
+                                                        CSRGEMM_SUB,
+                                                        CSRGEMM_HASHSIZE,
+                                                        CSRGEMM_FLL_HASH>),
+                           dim3((h_group_size[1] - 1) / (CSRGEMM_DIM / CSRGEMM_SUB) + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           h_group_size[1],
+                           &d_group_offset[1],
+                           d_perm,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
+#undef CSRGEMM_HASHSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
+    // Groups 2 - 5: 33 - 2048 non-zeros per row, one block per row
+#define CSRGEMM_SYMBOLIC_BLOCK_LAUNCH(GROUP_, DIM_, SUB_, HASHSIZE_)                   \
+    if(h_group_size[GROUP_] > 0)                                                       \
+    {                                                                                  \
+        hipLaunchKernelGGL(                                                            \
+            (csrgemm_symbolic_block_per_row<DIM_, SUB_, HASHSIZE_, CSRGEMM_FLL_HASH>), \
+            dim3(h_group_size[GROUP_]),                                                \
+            dim3(DIM_),                                                                \
+            0,                                                                         \
+            stream,                                                                    \
+            &d_group_offset[GROUP_],                                                   \
+            d_perm,                                                                    \
+            csr_row_ptr_A,                                                             \
+            csr_col_ind_A,                                                             \
+            csr_row_ptr_B,                                                             \
+            csr_col_ind_B,                                                             \
+            csr_row_ptr_C,                                                             \
+            csr_col_ind_C,                                                             \
+            descr_A->base,                                                             \
+            descr_B->base,                                                             \
+            descr_C->base);                                                            \
+    }
+
+    CSRGEMM_SYMBOLIC_BLOCK_LAUNCH(2, 128, 16, 256);
+    CSRGEMM_SYMBOLIC_BLOCK_LAUNCH(3, 256, 32, 512);
+    CSRGEMM_SYMBOLIC_BLOCK_LAUNCH(4, 512, 32, 1024);
+    CSRGEMM_SYMBOLIC_BLOCK_LAUNCH(5, 1024, 32, 2048);
+#undef CSRGEMM_SYMBOLIC_BLOCK_LAUNCH
+
+    // Group 7: more than 2048 non-zeros per row
+    if(h_group_size[7] > 0)
+    {
+        rocsparse_csrgemm_info csrgemm_info = info_C->csrgemm_info;
+
+        // Additional buffer, which is kept for subsequent calls
+        if(csrgemm_info->workspace_bytes < sizeof(I) * nnz_A)
+        {
+            if(csrgemm_info->workspace != nullptr)
+            {
+                RETURN_IF_HIP_ERROR(hipFree(csrgemm_info->workspace));
+                csrgemm_info->workspace       = nullptr;
+                csrgemm_info->workspace_bytes = 0;
+            }
+
+            RETURN_IF_HIP_ERROR(hipMalloc(&csrgemm_info->workspace, sizeof(I) * nnz_A));
+            csrgemm_info->workspace_bytes = sizeof(I) * nnz_A;
+        }
+
+#define CSRGEMM_DIM 512
+#define CSRGEMM_SUB 16
+#define CSRGEMM_CHUNKSIZE 2048
+        hipLaunchKernelGGL((csrgemm_symbolic_block_per_row_multipass<CSRGEMM_DIM,
+                                                                     CSRGEMM_SUB,
+                                                                     CSRGEMM_CHUNKSIZE>),
+                           dim3(h_group_size[7]),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           n,
+                           &d_group_offset[7],
+                           d_perm,
+                           csr_row_ptr_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           csr_col_ind_B,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           reinterpret_cast<I*>(csrgemm_info->workspace),
+                           descr_A->base,
+                           descr_B->base,
+                           descr_C->base);
+#undef CSRGEMM_CHUNKSIZE
+#undef CSRGEMM_SUB
+#undef CSRGEMM_DIM
+    }
+
+    return rocsparse_status_success;
+}
+
 template <typename I, typename J, typename T>
 rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                                             rocsparse_operation       trans_A,
@@ -1946,6 +3009,41 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
         return rocsparse_status_invalid_pointer;
     }
 
+    // Products with transposed operands
+    if(info_C->csrgemm_info->mul == true
+       && (trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none))
+    {
+        return rocsparse_csrgemm_transpose_template(handle,
+                                                    trans_A,
+                                                    trans_B,
+                                                    m,
+                                                    n,
+                                                    k,
+                                                    alpha,
+                                                    descr_A,
+                                                    nnz_A,
+                                                    csr_val_A,
+                                                    csr_row_ptr_A,
+                                                    csr_col_ind_A,
+                                                    descr_B,
+                                                    nnz_B,
+                                                    csr_val_B,
+                                                    csr_row_ptr_B,
+                                                    csr_col_ind_B,
+                                                    beta,
+                                                    descr_D,
+                                                    nnz_D,
+                                                    csr_val_D,
+                                                    csr_row_ptr_D,
+                                                    csr_col_ind_D,
+                                                    descr_C,
+                                                    csr_val_C,
+                                                    csr_row_ptr_C,
+                                                    csr_col_ind_C,
+                                                    info_C,
+                                                    temp_buffer);
+    }
+
     // Either mult, add or multadd need to be performed
     if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == true)
     {
@@ -2035,6 +3133,222 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+// Semirings are only instantiated for real data types
+template <rocsparse_semiring SEMIRING,
+          typename I,
+          typename J,
+          typename T,
+          typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value,
+                                  int>::type
+          = 0>
+static inline rocsparse_status
+    rocsparse_csrgemm_semiring_mult(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    J                         m,
+                                    J                         n,
+                                    J                         k,
+                                    const T*                  alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    I                         nnz_A,
+                                    const T*                  csr_val_A,
+                                    const I*                  csr_row_ptr_A,
+                                    const J*                  csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    I                         nnz_B,
+                                    const T*                  csr_val_B,
+                                    const I*                  csr_row_ptr_B,
+                                    const J*                  csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    T*                        csr_val_C,
+                                    const I*                  csr_row_ptr_C,
+                                    J*                        csr_col_ind_C,
+                                    const rocsparse_mat_info  info_C,
+                                    void*                     temp_buffer)
+{
+    return rocsparse_csrgemm_mult_template<SEMIRING>(handle,
+                                                     trans_A,
+                                                     trans_B,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     descr_A,
+                                                     nnz_A,
+                                                     csr_val_A,
+                                                     csr_row_ptr_A,
+                                                     csr_col_ind_A,
+                                                     descr_B,
+                                                     nnz_B,
+                                                     csr_val_B,
+                                                     csr_row_ptr_B,
+                                                     csr_col_ind_B,
+                                                     descr_C,
+                                                     csr_val_C,
+                                                     csr_row_ptr_C,
+                                                     csr_col_ind_C,
+                                                     info_C,
+                                                     temp_buffer);
+}
+
+// Complex data types only support (+, x)
+template <rocsparse_semiring SEMIRING,
+          typename I,
+          typename J,
+          typename T,
+          typename std::enable_if<std::is_same<T, rocsparse_float_complex>::value
+                                      || std::is_same<T, rocsparse_double_complex>::value,
+                                  int>::type
+          = 0>
+static inline rocsparse_status
+    rocsparse_csrgemm_semiring_mult(rocsparse_handle          handle,
+                                    rocsparse_operation       trans_A,
+                                    rocsparse_operation       trans_B,
+                                    J                         m,
+                                    J                         n,
+                                    J                         k,
+                                    const T*                  alpha,
+                                    const rocsparse_mat_descr descr_A,
+                                    I                         nnz_A,
+                                    const T*                  csr_val_A,
+                                    const I*                  csr_row_ptr_A,
+                                    const J*                  csr_col_ind_A,
+                                    const rocsparse_mat_descr descr_B,
+                                    I                         nnz_B,
+                                    const T*                  csr_val_B,
+                                    const I*                  csr_row_ptr_B,
+                                    const J*                  csr_col_ind_B,
+                                    const rocsparse_mat_descr descr_C,
+                                    T*                        csr_val_C,
+                                    const I*                  csr_row_ptr_C,
+                                    J*                        csr_col_ind_C,
+                                    const rocsparse_mat_info  info_C,
+                                    void*                     temp_buffer)
+{
+    if(SEMIRING != rocsparse_semiring_plus_times)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    return rocsparse_csrgemm_mult_template<rocsparse_semiring_plus_times>(handle,
+                                                                          trans_A,
+                                                                          trans_B,
+                                                                          m,
+                                                                          n,
+                                                                          k,
+                                                                          alpha,
+                                                                          descr_A,
+                                                                          nnz_A,
+                                                                          csr_val_A,
+                                                                          csr_row_ptr_A,
+                                                                          csr_col_ind_A,
+                                                                          descr_B,
+                                                                          nnz_B,
+                                                                          csr_val_B,
+                                                                          csr_row_ptr_B,
+                                                                          csr_col_ind_B,
+                                                                          descr_C,
+                                                                          csr_val_C,
+                                                                          csr_row_ptr_C,
+                                                                          csr_col_ind_C,
+                                                                          info_C,
+                                                                          temp_buffer);
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrgemm_semiring_template(rocsparse_handle          handle,
+                                                     rocsparse_semiring        semiring,
+                                                     rocsparse_operation       trans_A,
+                                                     rocsparse_operation       trans_B,
+                                                     J                         m,
+                                                     J                         n,
+                                                     J                         k,
+                                                     const T*                  alpha,
+                                                     const rocsparse_mat_descr descr_A,
+                                                     I                         nnz_A,
+                                                     const T*                  csr_val_A,
+                                                     const I*                  csr_row_ptr_A,
+                                                     const J*                  csr_col_ind_A,
+                                                     const rocsparse_mat_descr descr_B,
+                                                     I                         nnz_B,
+                                                     const T*                  csr_val_B,
+                                                     const I*                  csr_row_ptr_B,
+                                                     const J*                  csr_col_ind_B,
+                                                     const rocsparse_mat_descr descr_C,
+                                                     T*                        csr_val_C,
+                                                     const I*                  csr_row_ptr_C,
+                                                     J*                        csr_col_ind_C,
+                                                     const rocsparse_mat_info  info_C,
+                                                     void*                     temp_buffer)
+{
+    // Check for valid rocsparse_mat_info
+    if(info_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid rocsparse_csrgemm_info
+    if(info_C->csrgemm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Only C = alpha * A * B is supported, i.e. the product must have been set up without D
+    if(info_C->csrgemm_info->mul == false || info_C->csrgemm_info->add == true)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Transposed operands are only supported for the conventional arithmetic
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    switch(semiring)
+    {
+#define SEMIRING_CASE(SEMIRING)                                         \
+    case SEMIRING:                                                      \
+    {                                                                   \
+        return rocsparse_csrgemm_semiring_mult<SEMIRING>(handle,        \
+                                                         trans_A,       \
+                                                         trans_B,       \
+                                                         m,             \
+                                                         n,             \
+                                                         k,             \
+                                                         alpha,         \
+                                                         descr_A,       \
+                                                         nnz_A,         \
+                                                         csr_val_A,     \
+                                                         csr_row_ptr_A, \
+                                                         csr_col_ind_A, \
+                                                         descr_B,       \
+                                                         nnz_B,         \
+                                                         csr_val_B,     \
+                                                         csr_row_ptr_B, \
+                                                         csr_col_ind_B, \
+                                                         descr_C,       \
+                                                         csr_val_C,     \
+                                                         csr_row_ptr_C, \
+                                                         csr_col_ind_C, \
+                                                         info_C,        \
+                                                         temp_buffer);  \
+    }
+
+        SEMIRING_CASE(rocsparse_semiring_plus_times);
+        SEMIRING_CASE(rocsparse_semiring_min_plus);
+        SEMIRING_CASE(rocsparse_semiring_max_times);
+        SEMIRING_CASE(rocsparse_semiring_or_and);
+        SEMIRING_CASE(rocsparse_semiring_plus_pair);
+
+#undef SEMIRING_CASE
+    }
+
+    // LCOV_EXCL_START
+    return rocsparse_status_invalid_value;
+    // LCOV_EXCL_STOP
+}
+
 #define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                       \
     template rocsparse_status rocsparse_csrgemm_template<ITYPE, JTYPE, TTYPE>( \
         rocsparse_handle          handle,                                      \
@@ -2080,6 +3394,72 @@ INSTANTIATE(int64_t, int64_t, double);
 INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
 INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
 
+#define INSTANTIATE_SYMBOLIC(ITYPE, JTYPE)                                       \
+    template rocsparse_status rocsparse_csrgemm_symbolic_template<ITYPE, JTYPE>( \
+        rocsparse_handle          handle,                                        \
+        JTYPE                     m,                                             \
+        JTYPE                     n,                                             \
+        JTYPE                     k,                                             \
+        const rocsparse_mat_descr descr_A,                                       \
+        ITYPE                     nnz_A,                                         \
+        const ITYPE*              csr_row_ptr_A,                                 \
+        const JTYPE*              csr_col_ind_A,                                 \
+        const rocsparse_mat_descr descr_B,                                       \
+        ITYPE                     nnz_B,                                         \
+        const ITYPE*              csr_row_ptr_B,                                 \
+        const JTYPE*              csr_col_ind_B,                                 \
+        const rocsparse_mat_descr descr_C,                                       \
+        const ITYPE*              csr_row_ptr_C,                                 \
+        JTYPE*                    csr_col_ind_C,                                 \
+        const rocsparse_mat_info  info_C,                                        \
+        void*                     temp_buffer);
+
+INSTANTIATE_SYMBOLIC(int32_t, int32_t);
+INSTANTIATE_SYMBOLIC(int64_t, int32_t);
+INSTANTIATE_SYMBOLIC(int64_t, int64_t);
+#undef INSTANTIATE_SYMBOLIC
+
+#define INSTANTIATE_SEMIRING(ITYPE, JTYPE, TTYPE)                                       \
+    template rocsparse_status rocsparse_csrgemm_semiring_template<ITYPE, JTYPE, TTYPE>( \
+        rocsparse_handle          handle,                                               \
+        rocsparse_semiring        semiring,                                             \
+        rocsparse_operation       trans_A,                                              \
+        rocsparse_operation       trans_B,                                              \
+        JTYPE                     m,                                                    \
+        JTYPE                     n,                                                    \
+        JTYPE                     k,                                                    \
+        const TTYPE*              alpha,                                                \
+        const rocsparse_mat_descr descr_A,                                              \
+        ITYPE                     nnz_A,                                                \
+        const TTYPE*              csr_val_A,                                            \
+        const ITYPE*              csr_row_ptr_A,                                        \
+        const JTYPE*              csr_col_ind_A,                                        \
+        const rocsparse_mat_descr descr_B,                                              \
+        ITYPE                     nnz_B,                                                \
+        const TTYPE*              csr_val_B,                                            \
+        const ITYPE*              csr_row_ptr_B,                                        \
+        const JTYPE*              csr_col_ind_B,                                        \
+        const rocsparse_mat_descr descr_C,                                              \
+        TTYPE*                    csr_val_C,                                            \
+        const ITYPE*              csr_row_ptr_C,                                        \
+        JTYPE*                    csr_col_ind_C,                                        \
+        const rocsparse_mat_info  info_C,                                               \
+        void*                     temp_buffer);
+
+INSTANTIATE_SEMIRING(int32_t, int32_t, float);
+INSTANTIATE_SEMIRING(int32_t, int32_t, double);
+INSTANTIATE_SEMIRING(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE_SEMIRING(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE_SEMIRING(int64_t, int32_t, float);
+INSTANTIATE_SEMIRING(int64_t, int32_t, double);
+INSTANTIATE_SEMIRING(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE_SEMIRING(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE_SEMIRING(int64_t, int64_t, float);
+INSTANTIATE_SEMIRING(int64_t, int64_t, double);
+INSTANTIATE_SEMIRING(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE_SEMIRING(int64_t, int64_t, rocsparse_double_complex);
+#undef INSTANTIATE_SEMIRING
+
 /*
  * ===========================================================================
  *    C wrapper
@@ -28,7 +28,6 @@
 
 #include "handle.h"
 
-#define CSRGEMM_MAXGROUPS 8
 #define CSRGEMM_NNZ_HASH 79
 #define CSRGEMM_FLL_HASH 137
 
@@ -112,4 +111,137 @@ rocsparse_status rocsparse_csrgemm_template(rocsparse_handle          handle,
                                             const rocsparse_mat_info  info_C,
                                             void*                     temp_buffer);
 
+// Column indices of C = A * B, without reading any values. The row pointer of C has to be
+// computed by rocsparse_csrgemm_nnz_template() with the same info_C and temp_buffer.
+template <typename I, typename J>
+rocsparse_status rocsparse_csrgemm_symbolic_template(rocsparse_handle          handle,
+                                                     J                         m,
+                                                     J                         n,
+                                                     J                         k,
+                                                     const rocsparse_mat_descr descr_A,
+                                                     I                         nnz_A,
+                                                     const I*                  csr_row_ptr_A,
+                                                     const J*                  csr_col_ind_A,
+                                                     const rocsparse_mat_descr descr_B,
+                                                     I                         nnz_B,
+                                                     const I*                  csr_row_ptr_B,
+                                                     const J*                  csr_col_ind_B,
+                                                     const rocsparse_mat_descr descr_C,
+                                                     const I*                  csr_row_ptr_C,
+                                                     J*                        csr_col_ind_C,
+                                                     const rocsparse_mat_info  info_C,
+                                                     void*                     temp_buffer);
+
+// Products where op(A) = A^T or op(B) = B^T. The transposed sparsity patterns of A and B
+// are kept in the csrgemm info, and the product is computed by the non-transposed hash
+// kernels. If descr_C is of type rocsparse_matrix_type_symmetric, the full product
+// A^T * A or A * A^T is kept in the csrgemm info and only the triangle selected by the
+// fill mode of descr_C is copied into C.
+template <typename I, typename J, typename T>
+rocsparse_status
+    rocsparse_csrgemm_transpose_buffer_size_template(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans_A,
+                                                     rocsparse_operation       trans_B,
+                                                     J                         m,
+                                                     J                         n,
+                                                     J                         k,
+                                                     const T*                  alpha,
+                                                     const rocsparse_mat_descr descr_A,
+                                                     I                         nnz_A,
+                                                     const I*                  csr_row_ptr_A,
+                                                     const J*                  csr_col_ind_A,
+                                                     const rocsparse_mat_descr descr_B,
+                                                     I                         nnz_B,
+                                                     const I*                  csr_row_ptr_B,
+                                                     const J*                  csr_col_ind_B,
+                                                     const T*                  beta,
+                                                     const rocsparse_mat_descr descr_D,
+                                                     I                         nnz_D,
+                                                     const I*                  csr_row_ptr_D,
+                                                     const J*                  csr_col_ind_D,
+                                                     rocsparse_mat_info        info_C,
+                                                     size_t*                   buffer_size);
+
+template <typename I, typename J>
+rocsparse_status rocsparse_csrgemm_transpose_nnz_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans_A,
+                                                          rocsparse_operation       trans_B,
+                                                          J                         m,
+                                                          J                         n,
+                                                          J                         k,
+                                                          const rocsparse_mat_descr descr_A,
+                                                          I                         nnz_A,
+                                                          const I*                  csr_row_ptr_A,
+                                                          const J*                  csr_col_ind_A,
+                                                          const rocsparse_mat_descr descr_B,
+                                                          I                         nnz_B,
+                                                          const I*                  csr_row_ptr_B,
+                                                          const J*                  csr_col_ind_B,
+                                                          const rocsparse_mat_descr descr_D,
+                                                          I                         nnz_D,
+                                                          const I*                  csr_row_ptr_D,
+                                                          const J*                  csr_col_ind_D,
+                                                          const rocsparse_mat_descr descr_C,
+                                                          I*                        csr_row_ptr_C,
+                                                          I*                        nnz_C,
+                                                          const rocsparse_mat_info  info_C,
+                                                          void*                     temp_buffer);
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrgemm_transpose_template(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans_A,
+                                                      rocsparse_operation       trans_B,
+                                                      J                         m,
+                                                      J                         n,
+                                                      J                         k,
+                                                      const T*                  alpha,
+                                                      const rocsparse_mat_descr descr_A,
+                                                      I                         nnz_A,
+                                                      const T*                  csr_val_A,
+                                                      const I*                  csr_row_ptr_A,
+                                                      const J*                  csr_col_ind_A,
+                                                      const rocsparse_mat_descr descr_B,
+                                                      I                         nnz_B,
+                                                      const T*                  csr_val_B,
+                                                      const I*                  csr_row_ptr_B,
+                                                      const J*                  csr_col_ind_B,
+                                                      const T*                  beta,
+                                                      const rocsparse_mat_descr descr_D,
+                                                      I                         nnz_D,
+                                                      const T*                  csr_val_D,
+                                                      const I*                  csr_row_ptr_D,
+                                                      const J*                  csr_col_ind_D,
+                                                      const rocsparse_mat_descr descr_C,
+                                                      T*                        csr_val_C,
+                                                      const I*                  csr_row_ptr_C,
+                                                      J*                        csr_col_ind_C,
+                                                      const rocsparse_mat_info  info_C,
+                                                      void*                     temp_buffer);
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrgemm_semiring_template(rocsparse_handle          handle,
+                                                     rocsparse_semiring        semiring,
+                                                     rocsparse_operation       trans_A,
+                                                     rocsparse_operation       trans_B,
+                                                     J                         m,
+                                                     J                         n,
+                                                     J                         k,
+                                                     const T*                  alpha,
+                                                     const rocsparse_mat_descr descr_A,
+                                                     I                         nnz_A,
+                                                     const T*                  csr_val_A,
+                                                     const I*                  csr_row_ptr_A,
+                                                     const J*                  csr_col_ind_A,
+                                                     const rocsparse_mat_descr descr_B,
+                                                     I                         nnz_B,
+                                                     const T*                  csr_val_B,
+                                                     const I*                  csr_row_ptr_B,
+                                                     const J*                  csr_col_ind_B,
+                                                     const rocsparse_mat_descr descr_C,
+                                                     T*                        csr_val_C,
+                                                     const I*                  csr_row_ptr_C,
+                                                     J*                        csr_col_ind_C,
+                                                     const rocsparse_mat_info  info_C,
+                                                     void*                     temp_buffer);
+
 #endif // ROCSPARSE_CSRGEMM_HPP
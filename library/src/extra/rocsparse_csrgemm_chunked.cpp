@@ -0,0 +1,419 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "rocsparse_csrgemm.hpp"
+#include "utility.h"
+
+#include "csrgemm_chunked_device.h"
+
+#include <vector>
+
+// Bytes of panel buffer required to hold rows rows with nnz entries of C
+template <typename T>
+static inline size_t rocsparse_csrgemm_chunked_panel_bytes(rocsparse_int rows, rocsparse_int nnz)
+{
+    return ((sizeof(rocsparse_int) * (rows + 1) + 255) / 256) * 256
+           + ((sizeof(rocsparse_int) * nnz + 255) / 256) * 256 + sizeof(T) * nnz;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrgemm_chunked_template(rocsparse_handle          handle,
+                                                    rocsparse_operation       trans_A,
+                                                    rocsparse_operation       trans_B,
+                                                    rocsparse_int             m,
+                                                    rocsparse_int             n,
+                                                    rocsparse_int             k,
+                                                    const T*                  alpha,
+                                                    const rocsparse_mat_descr descr_A,
+                                                    rocsparse_int             nnz_A,
+                                                    const T*                  csr_val_A,
+                                                    const rocsparse_int*      csr_row_ptr_A,
+                                                    const rocsparse_int*      csr_col_ind_A,
+                                                    const rocsparse_mat_descr descr_B,
+                                                    rocsparse_int             nnz_B,
+                                                    const T*                  csr_val_B,
+                                                    const rocsparse_int*      csr_row_ptr_B,
+                                                    const rocsparse_int*      csr_col_ind_B,
+                                                    const T*                  beta,
+                                                    const rocsparse_mat_descr descr_D,
+                                                    rocsparse_int             nnz_D,
+                                                    const T*                  csr_val_D,
+                                                    const rocsparse_int*      csr_row_ptr_D,
+                                                    const rocsparse_int*      csr_col_ind_D,
+                                                    const rocsparse_mat_descr descr_C,
+                                                    T*                        csr_val_C,
+                                                    const rocsparse_int*      csr_row_ptr_C,
+                                                    rocsparse_int*            csr_col_ind_C,
+                                                    const rocsparse_mat_info  info_C,
+                                                    size_t                    panel_buffer_size,
+                                                    void*                     panel_buffer,
+                                                    void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgemm_chunked"),
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha),
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_val_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              LOG_TRACE_SCALAR_VALUE(handle, beta),
+              (const void*&)descr_D,
+              nnz_D,
+              (const void*&)csr_val_D,
+              (const void*&)csr_row_ptr_D,
+              (const void*&)csr_col_ind_D,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)info_C,
+              panel_buffer_size,
+              (const void*&)panel_buffer,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrgemm_chunked -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--alpha",
+              LOG_BENCH_SCALAR_VALUE(handle, alpha),
+              "--beta",
+              LOG_BENCH_SCALAR_VALUE(handle, beta));
+
+    // Check for valid rocsparse_mat_info
+    if(info_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid rocsparse_csrgemm_info
+    if(info_C->csrgemm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check operation
+    if(rocsparse_enum_utils::is_invalid(trans_A) || rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Row panels of C are computed from row panels of A, transposed operands are not supported
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    bool mul = info_C->csrgemm_info->mul;
+    bool add = info_C->csrgemm_info->add;
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || (mul == true && (k < 0 || nnz_A < 0 || nnz_B < 0))
+       || (add == true && nnz_D < 0))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_C == nullptr || csr_val_C == nullptr || csr_row_ptr_C == nullptr
+       || csr_col_ind_C == nullptr || panel_buffer == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // C = beta * D only, where C and D share their sparsity pattern
+    bool scal = (mul == false || k == 0 || nnz_A == 0 || nnz_B == 0);
+
+    // Quick return if possible, csr_row_ptr_C has not been filled by
+    // rocsparse_csrgemm_nnz() in these cases
+    if(m == 0 || n == 0 || (scal == true && (add == false || nnz_D == 0)))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Row pointer array of C on the host, required to partition C into panels
+    std::vector<rocsparse_int> hcsr_row_ptr_C(m + 1);
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(hcsr_row_ptr_C.data(),
+                                       csr_row_ptr_C,
+                                       sizeof(rocsparse_int) * (m + 1),
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Quick return if C is empty
+    if(hcsr_row_ptr_C[m] == hcsr_row_ptr_C[0])
+    {
+        return rocsparse_status_success;
+    }
+
+    // Greedily split the rows of C into panels that fit into the panel buffer.
+    // The partition is done entirely upfront, such that no computation is
+    // started if a single row of C exceeds the buffer.
+    std::vector<rocsparse_int> panel_ptr(1, 0);
+
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int row_begin = panel_ptr.back();
+
+        if(rocsparse_csrgemm_chunked_panel_bytes<T>(i + 1 - row_begin,
+                                                    hcsr_row_ptr_C[i + 1]
+                                                        - hcsr_row_ptr_C[row_begin])
+           > panel_buffer_size)
+        {
+            // Row i has to start a new panel, which must be able to hold it
+            if(i == row_begin
+               || rocsparse_csrgemm_chunked_panel_bytes<T>(
+                      1, hcsr_row_ptr_C[i + 1] - hcsr_row_ptr_C[i])
+                      > panel_buffer_size)
+            {
+                return rocsparse_status_invalid_size;
+            }
+
+            panel_ptr.push_back(i);
+        }
+    }
+
+    panel_ptr.push_back(m);
+
+    rocsparse_int num_panels = static_cast<rocsparse_int>(panel_ptr.size()) - 1;
+
+    // The panel row pointer array is overwritten for every panel, thus a grouping
+    // kept from a previous call cannot be reused, and the grouping of a panel is
+    // not kept either
+    info_C->csrgemm_info->plan_valid = false;
+
+    for(rocsparse_int p = 0; p < num_panels; ++p)
+    {
+        rocsparse_int row_begin = panel_ptr[p];
+        rocsparse_int rows      = panel_ptr[p + 1] - row_begin;
+        rocsparse_int offset    = hcsr_row_ptr_C[row_begin] - hcsr_row_ptr_C[0];
+        rocsparse_int nnz       = hcsr_row_ptr_C[row_begin + rows] - hcsr_row_ptr_C[row_begin];
+
+        // Nothing to do for empty panels
+        if(nnz == 0)
+        {
+            continue;
+        }
+
+        // Panel buffer
+        char* ptr = reinterpret_cast<char*>(panel_buffer);
+
+        rocsparse_int* panel_row_ptr = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += ((sizeof(rocsparse_int) * (rows + 1) + 255) / 256) * 256;
+
+        rocsparse_int* panel_col_ind = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += ((sizeof(rocsparse_int) * nnz + 255) / 256) * 256;
+
+        T* panel_val = reinterpret_cast<T*>(ptr);
+
+#define CSRGEMM_DIM 512
+        hipLaunchKernelGGL((csrgemm_chunked_row_ptr_kernel<CSRGEMM_DIM>),
+                           dim3(rows / CSRGEMM_DIM + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           rows,
+                           row_begin,
+                           csr_row_ptr_C,
+                           panel_row_ptr,
+                           descr_C->base);
+#undef CSRGEMM_DIM
+
+        // Rows of D of this panel. For C = beta * D, the entries of D are
+        // processed as a contiguous block, equivalent to the panel of C.
+        rocsparse_int        panel_nnz_D     = nnz_D;
+        const T*             panel_val_D     = csr_val_D;
+        const rocsparse_int* panel_row_ptr_D = csr_row_ptr_D;
+        const rocsparse_int* panel_col_ind_D = csr_col_ind_D;
+
+        if(csr_row_ptr_D != nullptr)
+        {
+            panel_row_ptr_D += row_begin;
+        }
+
+        if(scal == true && csr_val_D != nullptr && csr_col_ind_D != nullptr)
+        {
+            panel_nnz_D = nnz;
+            panel_val_D += offset;
+            panel_col_ind_D += offset;
+        }
+
+        // Compute the panel of C
+        info_C->csrgemm_info->plan_keep = false;
+
+        rocsparse_status status = rocsparse_csrgemm_template(
+            handle,
+            trans_A,
+            trans_B,
+            rows,
+            n,
+            k,
+            alpha,
+            descr_A,
+            nnz_A,
+            csr_val_A,
+            (csr_row_ptr_A != nullptr) ? csr_row_ptr_A + row_begin : nullptr,
+            csr_col_ind_A,
+            descr_B,
+            nnz_B,
+            csr_val_B,
+            csr_row_ptr_B,
+            csr_col_ind_B,
+            beta,
+            descr_D,
+            panel_nnz_D,
+            panel_val_D,
+            panel_row_ptr_D,
+            panel_col_ind_D,
+            descr_C,
+            panel_val,
+            (const rocsparse_int*)panel_row_ptr,
+            panel_col_ind,
+            info_C,
+            temp_buffer);
+
+        info_C->csrgemm_info->plan_keep = true;
+
+        RETURN_IF_ROCSPARSE_ERROR(status);
+
+        // Stream the panel out to the host. The panel buffer is only reused
+        // by subsequent work on the same stream, after the copies completed.
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(csr_col_ind_C + offset,
+                                           panel_col_ind,
+                                           sizeof(rocsparse_int) * nnz,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            csr_val_C + offset, panel_val, sizeof(T) * nnz, hipMemcpyDeviceToHost, stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                        \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,            \
+                                     rocsparse_operation       trans_A,           \
+                                     rocsparse_operation       trans_B,           \
+                                     rocsparse_int             m,                 \
+                                     rocsparse_int             n,                 \
+                                     rocsparse_int             k,                 \
+                                     const TYPE*               alpha,             \
+                                     const rocsparse_mat_descr descr_A,           \
+                                     rocsparse_int             nnz_A,             \
+                                     const TYPE*               csr_val_A,         \
+                                     const rocsparse_int*      csr_row_ptr_A,     \
+                                     const rocsparse_int*      csr_col_ind_A,     \
+                                     const rocsparse_mat_descr descr_B,           \
+                                     rocsparse_int             nnz_B,             \
+                                     const TYPE*               csr_val_B,         \
+                                     const rocsparse_int*      csr_row_ptr_B,     \
+                                     const rocsparse_int*      csr_col_ind_B,     \
+                                     const TYPE*               beta,              \
+                                     const rocsparse_mat_descr descr_D,           \
+                                     rocsparse_int             nnz_D,             \
+                                     const TYPE*               csr_val_D,         \
+                                     const rocsparse_int*      csr_row_ptr_D,     \
+                                     const rocsparse_int*      csr_col_ind_D,     \
+                                     const rocsparse_mat_descr descr_C,           \
+                                     TYPE*                     csr_val_C,         \
+                                     const rocsparse_int*      csr_row_ptr_C,     \
+                                     rocsparse_int*            csr_col_ind_C,     \
+                                     const rocsparse_mat_info  info_C,            \
+                                     size_t                    panel_buffer_size, \
+                                     void*                     panel_buffer,      \
+                                     void*                     temp_buffer)       \
+    {                                                                             \
+        return rocsparse_csrgemm_chunked_template(handle,                         \
+                                                  trans_A,                        \
+                                                  trans_B,                        \
+                                                  m,                              \
+                                                  n,                              \
+                                                  k,                              \
+                                                  alpha,                          \
+                                                  descr_A,                        \
+                                                  nnz_A,                          \
+                                                  csr_val_A,                      \
+                                                  csr_row_ptr_A,                  \
+                                                  csr_col_ind_A,                  \
+                                                  descr_B,                        \
+                                                  nnz_B,                          \
+                                                  csr_val_B,                      \
+                                                  csr_row_ptr_B,                  \
+                                                  csr_col_ind_B,                  \
+                                                  beta,                           \
+                                                  descr_D,                        \
+                                                  nnz_D,                          \
+                                                  csr_val_D,                      \
+                                                  csr_row_ptr_D,                  \
+                                                  csr_col_ind_D,                  \
+                                                  descr_C,                        \
+                                                  csr_val_C,                      \
+                                                  csr_row_ptr_C,                  \
+                                                  csr_col_ind_C,                  \
+                                                  info_C,                         \
+                                                  panel_buffer_size,              \
+                                                  panel_buffer,                   \
+                                                  temp_buffer);                   \
+    }
+
+C_IMPL(rocsparse_scsrgemm_chunked, float);
+C_IMPL(rocsparse_dcsrgemm_chunked, double);
+C_IMPL(rocsparse_ccsrgemm_chunked, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrgemm_chunked, rocsparse_double_complex);
+
+#undef C_IMPL
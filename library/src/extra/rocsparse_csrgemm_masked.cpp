@@ -0,0 +1,495 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "rocsparse_csrgemm.hpp"
+#include "utility.h"
+
+// Attach a structural mask to (or detach it from) the csrgemm info
+static inline void rocsparse_csrgemm_masked_set(rocsparse_csrgemm_info info,
+                                                const rocsparse_int*   csr_row_ptr_M,
+                                                const rocsparse_int*   csr_col_ind_M,
+                                                rocsparse_index_base   base_M,
+                                                bool                   complement_M)
+{
+    info->mask_row_ptr    = csr_row_ptr_M;
+    info->mask_col_ind    = csr_col_ind_M;
+    info->mask_base       = base_M;
+    info->mask_complement = complement_M;
+}
+
+static rocsparse_status
+    rocsparse_csrgemm_masked_nnz_template(rocsparse_handle          handle,
+                                          rocsparse_operation       trans_A,
+                                          rocsparse_operation       trans_B,
+                                          rocsparse_int             m,
+                                          rocsparse_int             n,
+                                          rocsparse_int             k,
+                                          const rocsparse_mat_descr descr_A,
+                                          rocsparse_int             nnz_A,
+                                          const rocsparse_int*      csr_row_ptr_A,
+                                          const rocsparse_int*      csr_col_ind_A,
+                                          const rocsparse_mat_descr descr_B,
+                                          rocsparse_int             nnz_B,
+                                          const rocsparse_int*      csr_row_ptr_B,
+                                          const rocsparse_int*      csr_col_ind_B,
+                                          const rocsparse_mat_descr descr_M,
+                                          rocsparse_int             nnz_M,
+                                          const rocsparse_int*      csr_row_ptr_M,
+                                          const rocsparse_int*      csr_col_ind_M,
+                                          rocsparse_mask_type       mask_type,
+                                          const rocsparse_mat_descr descr_C,
+                                          rocsparse_int*            csr_row_ptr_C,
+                                          rocsparse_int*            nnz_C,
+                                          const rocsparse_mat_info  info_C,
+                                          void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrgemm_masked_nnz",
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)descr_M,
+              nnz_M,
+              (const void*&)csr_row_ptr_M,
+              (const void*&)csr_col_ind_M,
+              mask_type,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    // Check for valid rocsparse_mat_info
+    if(info_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid rocsparse_csrgemm_info
+    if(info_C->csrgemm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check operation and mask type
+    if(rocsparse_enum_utils::is_invalid(trans_A) || rocsparse_enum_utils::is_invalid(trans_B)
+       || rocsparse_enum_utils::is_invalid(mask_type))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // The mask is only applied to non-transposed operands
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Masked csrgemm only supports C = alpha * op(A) * op(B), i.e. the csrgemm info
+    // has to be set up by rocsparse_Xcsrgemm_buffer_size() with beta == nullptr
+    if(info_C->csrgemm_info->mul == false || info_C->csrgemm_info->add == true)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check valid sizes of the mask
+    if(m < 0 || n < 0 || nnz_M < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers of the mask
+    if(descr_M == nullptr || csr_row_ptr_M == nullptr || csr_col_ind_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base of the mask
+    if(descr_M->base != rocsparse_index_base_zero && descr_M->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type of the mask
+    if(descr_M->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Attach the mask to the csrgemm info, such that the hash kernels skip all entries
+    // of C that are excluded by the mask
+    rocsparse_csrgemm_masked_set(info_C->csrgemm_info,
+                                 csr_row_ptr_M,
+                                 csr_col_ind_M,
+                                 descr_M->base,
+                                 mask_type == rocsparse_mask_type_complement);
+
+    // Compute the row pointers of C = alpha * op(A) * op(B), restricted to the mask
+    rocsparse_status status = rocsparse_csrgemm_nnz_template(handle,
+                                                             trans_A,
+                                                             trans_B,
+                                                             m,
+                                                             n,
+                                                             k,
+                                                             descr_A,
+                                                             nnz_A,
+                                                             csr_row_ptr_A,
+                                                             csr_col_ind_A,
+                                                             descr_B,
+                                                             nnz_B,
+                                                             csr_row_ptr_B,
+                                                             csr_col_ind_B,
+                                                             nullptr,
+                                                             (rocsparse_int)0,
+                                                             (const rocsparse_int*)nullptr,
+                                                             (const rocsparse_int*)nullptr,
+                                                             descr_C,
+                                                             csr_row_ptr_C,
+                                                             nnz_C,
+                                                             info_C,
+                                                             temp_buffer);
+
+    // Detach the mask, such that subsequent unmasked calls are not affected
+    rocsparse_csrgemm_masked_set(
+        info_C->csrgemm_info, nullptr, nullptr, rocsparse_index_base_zero, false);
+
+    return status;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrgemm_masked_template(rocsparse_handle          handle,
+                                                   rocsparse_operation       trans_A,
+                                                   rocsparse_operation       trans_B,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             n,
+                                                   rocsparse_int             k,
+                                                   const T*                  alpha,
+                                                   const rocsparse_mat_descr descr_A,
+                                                   rocsparse_int             nnz_A,
+                                                   const T*                  csr_val_A,
+                                                   const rocsparse_int*      csr_row_ptr_A,
+                                                   const rocsparse_int*      csr_col_ind_A,
+                                                   const rocsparse_mat_descr descr_B,
+                                                   rocsparse_int             nnz_B,
+                                                   const T*                  csr_val_B,
+                                                   const rocsparse_int*      csr_row_ptr_B,
+                                                   const rocsparse_int*      csr_col_ind_B,
+                                                   const rocsparse_mat_descr descr_M,
+                                                   rocsparse_int             nnz_M,
+                                                   const rocsparse_int*      csr_row_ptr_M,
+                                                   const rocsparse_int*      csr_col_ind_M,
+                                                   rocsparse_mask_type       mask_type,
+                                                   const rocsparse_mat_descr descr_C,
+                                                   T*                        csr_val_C,
+                                                   const rocsparse_int*      csr_row_ptr_C,
+                                                   rocsparse_int*            csr_col_ind_C,
+                                                   const rocsparse_mat_info  info_C,
+                                                   void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrgemm_masked"),
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha),
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_val_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              (const void*&)descr_M,
+              nnz_M,
+              (const void*&)csr_row_ptr_M,
+              (const void*&)csr_col_ind_M,
+              mask_type,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrgemm_masked -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--alpha",
+              LOG_BENCH_SCALAR_VALUE(handle, alpha));
+
+    // Check for valid rocsparse_mat_info
+    if(info_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid rocsparse_csrgemm_info
+    if(info_C->csrgemm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check operation and mask type
+    if(rocsparse_enum_utils::is_invalid(trans_A) || rocsparse_enum_utils::is_invalid(trans_B)
+       || rocsparse_enum_utils::is_invalid(mask_type))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // The mask is only applied to non-transposed operands
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Masked csrgemm only supports C = alpha * op(A) * op(B), i.e. the csrgemm info
+    // has to be set up by rocsparse_Xcsrgemm_buffer_size() with beta == nullptr
+    if(info_C->csrgemm_info->mul == false || info_C->csrgemm_info->add == true)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check valid sizes of the mask
+    if(m < 0 || n < 0 || nnz_M < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers of the mask
+    if(descr_M == nullptr || csr_row_ptr_M == nullptr || csr_col_ind_M == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base of the mask
+    if(descr_M->base != rocsparse_index_base_zero && descr_M->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type of the mask
+    if(descr_M->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Attach the mask to the csrgemm info, such that the hash kernels skip all entries
+    // of C that are excluded by the mask
+    rocsparse_csrgemm_masked_set(info_C->csrgemm_info,
+                                 csr_row_ptr_M,
+                                 csr_col_ind_M,
+                                 descr_M->base,
+                                 mask_type == rocsparse_mask_type_complement);
+
+    // Compute C = alpha * op(A) * op(B), restricted to the mask
+    rocsparse_status status = rocsparse_csrgemm_template(handle,
+                                                         trans_A,
+                                                         trans_B,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         descr_A,
+                                                         nnz_A,
+                                                         csr_val_A,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         descr_B,
+                                                         nnz_B,
+                                                         csr_val_B,
+                                                         csr_row_ptr_B,
+                                                         csr_col_ind_B,
+                                                         (const T*)nullptr,
+                                                         nullptr,
+                                                         (rocsparse_int)0,
+                                                         (const T*)nullptr,
+                                                         (const rocsparse_int*)nullptr,
+                                                         (const rocsparse_int*)nullptr,
+                                                         descr_C,
+                                                         csr_val_C,
+                                                         csr_row_ptr_C,
+                                                         csr_col_ind_C,
+                                                         info_C,
+                                                         temp_buffer);
+
+    // Detach the mask, such that subsequent unmasked calls are not affected
+    rocsparse_csrgemm_masked_set(
+        info_C->csrgemm_info, nullptr, nullptr, rocsparse_index_base_zero, false);
+
+    return status;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrgemm_masked_nnz(rocsparse_handle          handle,
+                                                         rocsparse_operation       trans_A,
+                                                         rocsparse_operation       trans_B,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             n,
+                                                         rocsparse_int             k,
+                                                         const rocsparse_mat_descr descr_A,
+                                                         rocsparse_int             nnz_A,
+                                                         const rocsparse_int*      csr_row_ptr_A,
+                                                         const rocsparse_int*      csr_col_ind_A,
+                                                         const rocsparse_mat_descr descr_B,
+                                                         rocsparse_int             nnz_B,
+                                                         const rocsparse_int*      csr_row_ptr_B,
+                                                         const rocsparse_int*      csr_col_ind_B,
+                                                         const rocsparse_mat_descr descr_M,
+                                                         rocsparse_int             nnz_M,
+                                                         const rocsparse_int*      csr_row_ptr_M,
+                                                         const rocsparse_int*      csr_col_ind_M,
+                                                         rocsparse_mask_type       mask_type,
+                                                         const rocsparse_mat_descr descr_C,
+                                                         rocsparse_int*            csr_row_ptr_C,
+                                                         rocsparse_int*            nnz_C,
+                                                         const rocsparse_mat_info  info_C,
+                                                         void*                     temp_buffer)
+{
+    return rocsparse_csrgemm_masked_nnz_template(handle,
+                                                 trans_A,
+                                                 trans_B,
+                                                 m,
+                                                 n,
+                                                 k,
+                                                 descr_A,
+                                                 nnz_A,
+                                                 csr_row_ptr_A,
+                                                 csr_col_ind_A,
+                                                 descr_B,
+                                                 nnz_B,
+                                                 csr_row_ptr_B,
+                                                 csr_col_ind_B,
+                                                 descr_M,
+                                                 nnz_M,
+                                                 csr_row_ptr_M,
+                                                 csr_col_ind_M,
+                                                 mask_type,
+                                                 descr_C,
+                                                 csr_row_ptr_C,
+                                                 nnz_C,
+                                                 info_C,
+                                                 temp_buffer);
+}
+
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_operation       trans_A,       \
+                                     rocsparse_operation       trans_B,       \
+                                     rocsparse_int             m,             \
+                                     rocsparse_int             n,             \
+                                     rocsparse_int             k,             \
+                                     const TYPE*               alpha,         \
+                                     const rocsparse_mat_descr descr_A,       \
+                                     rocsparse_int             nnz_A,         \
+                                     const TYPE*               csr_val_A,     \
+                                     const rocsparse_int*      csr_row_ptr_A, \
+                                     const rocsparse_int*      csr_col_ind_A, \
+                                     const rocsparse_mat_descr descr_B,       \
+                                     rocsparse_int             nnz_B,         \
+                                     const TYPE*               csr_val_B,     \
+                                     const rocsparse_int*      csr_row_ptr_B, \
+                                     const rocsparse_int*      csr_col_ind_B, \
+                                     const rocsparse_mat_descr descr_M,       \
+                                     rocsparse_int             nnz_M,         \
+                                     const rocsparse_int*      csr_row_ptr_M, \
+                                     const rocsparse_int*      csr_col_ind_M, \
+                                     rocsparse_mask_type       mask_type,     \
+                                     const rocsparse_mat_descr descr_C,       \
+                                     TYPE*                     csr_val_C,     \
+                                     const rocsparse_int*      csr_row_ptr_C, \
+                                     rocsparse_int*            csr_col_ind_C, \
+                                     const rocsparse_mat_info  info_C,        \
+                                     void*                     temp_buffer)   \
+    {                                                                         \
+        return rocsparse_csrgemm_masked_template(handle,                      \
+                                                 trans_A,                     \
+                                                 trans_B,                     \
+                                                 m,                           \
+                                                 n,                           \
+                                                 k,                           \
+                                                 alpha,                       \
+                                                 descr_A,                     \
+                                                 nnz_A,                       \
+                                                 csr_val_A,                   \
+                                                 csr_row_ptr_A,               \
+                                                 csr_col_ind_A,               \
+                                                 descr_B,                     \
+                                                 nnz_B,                       \
+                                                 csr_val_B,                   \
+                                                 csr_row_ptr_B,               \
+                                                 csr_col_ind_B,               \
+                                                 descr_M,                     \
+                                                 nnz_M,                       \
+                                                 csr_row_ptr_M,               \
+                                                 csr_col_ind_M,               \
+                                                 mask_type,                   \
+                                                 descr_C,                     \
+                                                 csr_val_C,                   \
+                                                 csr_row_ptr_C,               \
+                                                 csr_col_ind_C,               \
+                                                 info_C,                      \
+                                                 temp_buffer);                \
+    }
+
+C_IMPL(rocsparse_scsrgemm_masked, float);
+C_IMPL(rocsparse_dcsrgemm_masked, double);
+C_IMPL(rocsparse_ccsrgemm_masked, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrgemm_masked, rocsparse_double_complex);
+
+#undef C_IMPL
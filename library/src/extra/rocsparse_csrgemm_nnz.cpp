@@ -424,6 +424,34 @@ rocsparse_status rocsparse_csrgemm_buffer_size_template(rocsparse_handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // Products with transposed operands
+    if(alpha != nullptr
+       && (trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none))
+    {
+        return rocsparse_csrgemm_transpose_buffer_size_template(handle,
+                                                                trans_A,
+                                                                trans_B,
+                                                                m,
+                                                                n,
+                                                                k,
+                                                                alpha,
+                                                                descr_A,
+                                                                nnz_A,
+                                                                csr_row_ptr_A,
+                                                                csr_col_ind_A,
+                                                                descr_B,
+                                                                nnz_B,
+                                                                csr_row_ptr_B,
+                                                                csr_col_ind_B,
+                                                                beta,
+                                                                descr_D,
+                                                                nnz_D,
+                                                                csr_row_ptr_D,
+                                                                csr_col_ind_D,
+                                                                info_C,
+                                                                buffer_size);
+    }
+
     // Clear csrgemm info
     RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrgemm_info(info_C->csrgemm_info));
 
@@ -633,6 +661,13 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
     rocsparse_index_base base_D
         = info_C->csrgemm_info->add ? descr_D->base : rocsparse_index_base_zero;
 
+    // Structural mask of C, if any
+    const I*             csr_row_ptr_M = (const I*)info_C->csrgemm_info->mask_row_ptr;
+    const J*             csr_col_ind_M = (const J*)info_C->csrgemm_info->mask_col_ind;
+    rocsparse_index_base base_M        = info_C->csrgemm_info->mask_base;
+    bool                 complement_M  = info_C->csrgemm_info->mask_complement;
+    int                  triangle_M    = info_C->csrgemm_info->mask_triangle;
+
     // Temporary buffer
     char* buffer = reinterpret_cast<char*>(temp_buffer);
 
@@ -656,7 +691,9 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                        csr_row_ptr_C,
                        base_A,
                        info_C->csrgemm_info->mul,
-                       info_C->csrgemm_info->add);
+                       info_C->csrgemm_info->add,
+                       csr_row_ptr_M,
+                       complement_M);
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
 
@@ -819,7 +856,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
             base_B,
             base_D,
             info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+            info_C->csrgemm_info->add,
+            csr_row_ptr_M,
+            csr_col_ind_M,
+            base_M,
+            complement_M,
+            triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -851,7 +893,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
             base_B,
             base_D,
             info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+            info_C->csrgemm_info->add,
+            csr_row_ptr_M,
+            csr_col_ind_M,
+            base_M,
+            complement_M,
+            triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -884,7 +931,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                            base_B,
                            base_D,
                            info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           info_C->csrgemm_info->add,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M,
+                           triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -917,7 +969,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                            base_B,
                            base_D,
                            info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           info_C->csrgemm_info->add,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M,
+                           triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -950,7 +1007,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                            base_B,
                            base_D,
                            info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           info_C->csrgemm_info->add,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M,
+                           triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -983,7 +1045,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                            base_B,
                            base_D,
                            info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           info_C->csrgemm_info->add,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M,
+                           triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1016,7 +1083,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
                            base_B,
                            base_D,
                            info_C->csrgemm_info->mul,
-                           info_C->csrgemm_info->add);
+                           info_C->csrgemm_info->add,
+                           csr_row_ptr_M,
+                           csr_col_ind_M,
+                           base_M,
+                           complement_M,
+                           triangle_M);
 #undef CSRGEMM_HASHSIZE
 #undef CSRGEMM_SUB
 #undef CSRGEMM_DIM
@@ -1057,7 +1129,12 @@ static inline rocsparse_status rocsparse_csrgemm_nnz_calc(rocsparse_handle
             base_B,
             base_D,
             info_C->csrgemm_info->mul,
-            info_C->csrgemm_info->add);
+            info_C->csrgemm_info->add,
+            csr_row_ptr_M,
+            csr_col_ind_M,
+            base_M,
+            complement_M,
+            triangle_M);
 
         if(info_C->csrgemm_info->mul == true)
         {
@@ -1463,6 +1540,39 @@ rocsparse_status rocsparse_csrgemm_nnz_template(rocsparse_handle          handle
         return rocsparse_status_invalid_pointer;
     }
 
+    // The sparsity pattern of C is recomputed, thus the row grouping of previous
+    // numerical phases cannot be re-used anymore
+    info_C->csrgemm_info->plan_valid = false;
+
+    // Products with transposed operands
+    if(info_C->csrgemm_info->mul == true
+       && (trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none))
+    {
+        return rocsparse_csrgemm_transpose_nnz_template(handle,
+                                                        trans_A,
+                                                        trans_B,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        descr_A,
+                                                        nnz_A,
+                                                        csr_row_ptr_A,
+                                                        csr_col_ind_A,
+                                                        descr_B,
+                                                        nnz_B,
+                                                        csr_row_ptr_B,
+                                                        csr_col_ind_B,
+                                                        descr_D,
+                                                        nnz_D,
+                                                        csr_row_ptr_D,
+                                                        csr_col_ind_D,
+                                                        descr_C,
+                                                        csr_row_ptr_C,
+                                                        nnz_C,
+                                                        info_C,
+                                                        temp_buffer);
+    }
+
     // Either mult, add or multadd need to be performed
     if(info_C->csrgemm_info->mul == true && info_C->csrgemm_info->add == true)
     {
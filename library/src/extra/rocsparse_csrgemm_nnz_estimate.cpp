@@ -0,0 +1,433 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "rocsparse_csrgemm.hpp"
+#include "utility.h"
+
+#include "csrgemm_estimate_device.h"
+
+#include <cmath>
+#include <vector>
+
+// Extrapolate the non-zero entries of the sampled rows to the full matrix, using a
+// ratio estimator with respect to the intermediate products
+template <typename J>
+static void rocsparse_csrgemm_nnz_estimate_ratio(J                           m,
+                                                 J                           n,
+                                                 J                           nsamples,
+                                                 int64_t                     nnz_products,
+                                                 const std::vector<int64_t>& sample_products,
+                                                 const std::vector<double>&  sample_nnz,
+                                                 int64_t*                    nnz_C,
+                                                 int64_t*                    nnz_C_lower,
+                                                 int64_t*                    nnz_C_upper)
+{
+    // Upper bound of non-zero entries in C
+    double bound = std::min(static_cast<double>(nnz_products),
+                            static_cast<double>(m) * static_cast<double>(n));
+
+    double sum_x = 0.0;
+    double sum_y = 0.0;
+
+    for(J i = 0; i < nsamples; ++i)
+    {
+        sum_x += static_cast<double>(sample_products[i]);
+        sum_y += sample_nnz[i];
+    }
+
+    // Sampled rows do not generate any products
+    if(sum_x == 0.0)
+    {
+        *nnz_C       = 0;
+        *nnz_C_lower = 0;
+        *nnz_C_upper = (nnz_products > 0) ? static_cast<int64_t>(bound) : 0;
+
+        return;
+    }
+
+    // Ratio of non-zero entries and intermediate products
+    double ratio    = sum_y / sum_x;
+    double estimate = ratio * static_cast<double>(nnz_products);
+
+    // Sampling fraction
+    double f = static_cast<double>(nsamples) / static_cast<double>(m);
+
+    double lower = estimate;
+    double upper = estimate;
+
+    if(f < 1.0)
+    {
+        if(nsamples < 2)
+        {
+            // Variance cannot be estimated from a single sample
+            lower = 0.0;
+            upper = bound;
+        }
+        else
+        {
+            // Sample variance of the residuals
+            double s2 = 0.0;
+
+            for(J i = 0; i < nsamples; ++i)
+            {
+                double r = sample_nnz[i] - ratio * static_cast<double>(sample_products[i]);
+                s2 += r * r;
+            }
+
+            s2 /= (nsamples - 1);
+
+            // Standard error of the extrapolated total, including the finite population
+            // correction
+            double se = static_cast<double>(m) * std::sqrt((1.0 - f) / nsamples * s2);
+
+            // 95% confidence interval
+            lower = estimate - 1.96 * se;
+            upper = estimate + 1.96 * se;
+        }
+    }
+
+    estimate = std::max(0.0, std::min(estimate, bound));
+    lower    = std::max(0.0, std::min(lower, estimate));
+    upper    = std::max(estimate, std::min(upper, bound));
+
+    *nnz_C       = static_cast<int64_t>(std::llround(estimate));
+    *nnz_C_lower = static_cast<int64_t>(std::floor(lower));
+    *nnz_C_upper = static_cast<int64_t>(std::ceil(upper));
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_csrgemm_nnz_estimate_template(rocsparse_handle          handle,
+                                                         rocsparse_operation       trans_A,
+                                                         rocsparse_operation       trans_B,
+                                                         J                         m,
+                                                         J                         n,
+                                                         J                         k,
+                                                         const rocsparse_mat_descr descr_A,
+                                                         I                         nnz_A,
+                                                         const I*                  csr_row_ptr_A,
+                                                         const J*                  csr_col_ind_A,
+                                                         const rocsparse_mat_descr descr_B,
+                                                         I                         nnz_B,
+                                                         const I*                  csr_row_ptr_B,
+                                                         const J*                  csr_col_ind_B,
+                                                         J                         sample_size,
+                                                         int64_t*                  nnz_products,
+                                                         int64_t*                  nnz_C,
+                                                         int64_t*                  nnz_C_lower,
+                                                         int64_t*                  nnz_C_upper)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrgemm_nnz_estimate",
+              trans_A,
+              trans_B,
+              m,
+              n,
+              k,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_B,
+              nnz_B,
+              (const void*&)csr_row_ptr_B,
+              (const void*&)csr_col_ind_B,
+              sample_size,
+              (const void*&)nnz_products,
+              (const void*&)nnz_C,
+              (const void*&)nnz_C_lower,
+              (const void*&)nnz_C_upper);
+
+    // Check operation
+    if(rocsparse_enum_utils::is_invalid(trans_A) || rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || sample_size <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_B == nullptr || csr_row_ptr_B == nullptr || csr_col_ind_B == nullptr
+       || nnz_products == nullptr || nnz_C == nullptr || nnz_C_lower == nullptr
+       || nnz_C_upper == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(descr_B->base != rocsparse_index_base_zero && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Only non-transposed matrices are supported
+    if(trans_A != rocsparse_operation_none || trans_B != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general
+       || descr_B->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Host side results
+    int64_t h_nnz_products = 0;
+    int64_t h_nnz_C        = 0;
+    int64_t h_nnz_C_lower  = 0;
+    int64_t h_nnz_C_upper  = 0;
+
+    // Quick return if possible, C does not have any non-zero entries
+    if(m > 0 && n > 0 && k > 0 && nnz_A > 0 && nnz_B > 0)
+    {
+        // Number of sampled rows
+        J nsamples = std::min(sample_size, m);
+
+#define CSRGEMM_DIM 256
+        // Temporary storage for partial sums and sampled rows
+        size_t products_size = ((sizeof(int64_t) * CSRGEMM_DIM - 1) / 256 + 1) * 256;
+        size_t samples_size  = ((sizeof(int64_t) * nsamples - 1) / 256 + 1) * 256;
+        size_t nnz_size      = ((sizeof(double) * nsamples - 1) / 256 + 1) * 256;
+
+        size_t required_size = products_size + samples_size + nnz_size;
+
+        bool  temp_alloc       = false;
+        void* temp_storage_ptr = nullptr;
+        if(handle->buffer_size >= required_size)
+        {
+            temp_storage_ptr = handle->buffer;
+            temp_alloc       = false;
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMalloc(&temp_storage_ptr, required_size));
+            temp_alloc = true;
+        }
+
+        // Buffer
+        char* ptr = reinterpret_cast<char*>(temp_storage_ptr);
+
+        int64_t* workspace = reinterpret_cast<int64_t*>(ptr);
+        ptr += products_size;
+
+        int64_t* sample_products = reinterpret_cast<int64_t*>(ptr);
+        ptr += samples_size;
+
+        double* sample_nnz = reinterpret_cast<double*>(ptr);
+
+        // Total number of intermediate products
+        hipLaunchKernelGGL((csrgemm_estimate_products_part1<CSRGEMM_DIM>),
+                           dim3(CSRGEMM_DIM),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           nnz_A,
+                           csr_col_ind_A,
+                           csr_row_ptr_B,
+                           workspace,
+                           descr_A->base);
+
+        hipLaunchKernelGGL((csrgemm_estimate_products_part2<CSRGEMM_DIM>),
+                           dim3(1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           workspace);
+
+        // Intermediate products and non-zero entries of the sampled rows
+        if(handle->wavefront_size == 32)
+        {
+            hipLaunchKernelGGL((csrgemm_estimate_sample<CSRGEMM_DIM,
+                                                        32,
+                                                        2048,
+                                                        65536,
+                                                        CSRGEMM_FLL_HASH>),
+                               dim3(nsamples),
+                               dim3(CSRGEMM_DIM),
+                               0,
+                               stream,
+                               m,
+                               n,
+                               nsamples,
+                               csr_row_ptr_A,
+                               csr_col_ind_A,
+                               csr_row_ptr_B,
+                               csr_col_ind_B,
+                               sample_products,
+                               sample_nnz,
+                               descr_A->base,
+                               descr_B->base);
+        }
+        else
+        {
+            hipLaunchKernelGGL((csrgemm_estimate_sample<CSRGEMM_DIM,
+                                                        64,
+                                                        2048,
+                                                        65536,
+                                                        CSRGEMM_FLL_HASH>),
+                               dim3(nsamples),
+                               dim3(CSRGEMM_DIM),
+                               0,
+                               stream,
+                               m,
+                               n,
+                               nsamples,
+                               csr_row_ptr_A,
+                               csr_col_ind_A,
+                               csr_row_ptr_B,
+                               csr_col_ind_B,
+                               sample_products,
+                               sample_nnz,
+                               descr_A->base,
+                               descr_B->base);
+        }
+#undef CSRGEMM_DIM
+
+        // Copy sampled data to host
+        std::vector<int64_t> h_sample_products(nsamples);
+        std::vector<double>  h_sample_nnz(nsamples);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &h_nnz_products, workspace, sizeof(int64_t), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_sample_products.data(),
+                                           sample_products,
+                                           sizeof(int64_t) * nsamples,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(h_sample_nnz.data(),
+                                           sample_nnz,
+                                           sizeof(double) * nsamples,
+                                           hipMemcpyDeviceToHost,
+                                           stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(temp_alloc)
+        {
+            RETURN_IF_HIP_ERROR(hipFree(temp_storage_ptr));
+        }
+
+        // Extrapolate to the full matrix
+        rocsparse_csrgemm_nnz_estimate_ratio(m,
+                                             n,
+                                             nsamples,
+                                             h_nnz_products,
+                                             h_sample_products,
+                                             h_sample_nnz,
+                                             &h_nnz_C,
+                                             &h_nnz_C_lower,
+                                             &h_nnz_C_upper);
+    }
+
+    // Write results
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnz_products, &h_nnz_products, sizeof(int64_t), hipMemcpyHostToDevice, stream));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(nnz_C, &h_nnz_C, sizeof(int64_t), hipMemcpyHostToDevice, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnz_C_lower, &h_nnz_C_lower, sizeof(int64_t), hipMemcpyHostToDevice, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            nnz_C_upper, &h_nnz_C_upper, sizeof(int64_t), hipMemcpyHostToDevice, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    else
+    {
+        *nnz_products = h_nnz_products;
+        *nnz_C        = h_nnz_C;
+        *nnz_C_lower  = h_nnz_C_lower;
+        *nnz_C_upper  = h_nnz_C_upper;
+    }
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrgemm_nnz_estimate(rocsparse_handle          handle,
+                                                           rocsparse_operation       trans_A,
+                                                           rocsparse_operation       trans_B,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             n,
+                                                           rocsparse_int             k,
+                                                           const rocsparse_mat_descr descr_A,
+                                                           rocsparse_int             nnz_A,
+                                                           const rocsparse_int*      csr_row_ptr_A,
+                                                           const rocsparse_int*      csr_col_ind_A,
+                                                           const rocsparse_mat_descr descr_B,
+                                                           rocsparse_int             nnz_B,
+                                                           const rocsparse_int*      csr_row_ptr_B,
+                                                           const rocsparse_int*      csr_col_ind_B,
+                                                           rocsparse_int             sample_size,
+                                                           int64_t*                  nnz_products,
+                                                           int64_t*                  nnz_C,
+                                                           int64_t*                  nnz_C_lower,
+                                                           int64_t*                  nnz_C_upper)
+{
+    return rocsparse_csrgemm_nnz_estimate_template(handle,
+                                                   trans_A,
+                                                   trans_B,
+                                                   m,
+                                                   n,
+                                                   k,
+                                                   descr_A,
+                                                   nnz_A,
+                                                   csr_row_ptr_A,
+                                                   csr_col_ind_A,
+                                                   descr_B,
+                                                   nnz_B,
+                                                   csr_row_ptr_B,
+                                                   csr_col_ind_B,
+                                                   sample_size,
+                                                   nnz_products,
+                                                   nnz_C,
+                                                   nnz_C_lower,
+                                                   nnz_C_upper);
+}
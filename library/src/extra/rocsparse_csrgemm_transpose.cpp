@@ -0,0 +1,1224 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "../conversion/rocsparse_csr2coo.hpp"
+#include "../conversion/rocsparse_identity.hpp"
+#include "definitions.h"
+#include "rocsparse_csrgemm.hpp"
+#include "utility.h"
+
+#include "csrgemm_device.h"
+#include "csrgemm_transpose_device.h"
+
+#include <rocprim/rocprim.hpp>
+
+template <unsigned int BLOCKSIZE, typename I, typename J, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrgemm_symmetric_fill(J m,
+                                U beta_device_host,
+                                const I* __restrict__ csr_row_ptr_D,
+                                const J* __restrict__ csr_col_ind_D,
+                                const T* __restrict__ csr_val_D,
+                                const I* __restrict__ csr_row_ptr_C,
+                                J* __restrict__ csr_col_ind_C,
+                                T* __restrict__ csr_val_C,
+                                rocsparse_index_base idx_base_D,
+                                rocsparse_index_base idx_base_C,
+                                rocsparse_fill_mode  fill_mode)
+{
+    T beta = load_scalar_device_host(beta_device_host);
+    csrgemm_symmetric_fill_device<BLOCKSIZE>(m,
+                                             beta,
+                                             csr_row_ptr_D,
+                                             csr_col_ind_D,
+                                             csr_val_D,
+                                             csr_row_ptr_C,
+                                             csr_col_ind_C,
+                                             csr_val_C,
+                                             idx_base_D,
+                                             idx_base_C,
+                                             fill_mode);
+}
+
+// Bytes of the transposed sparsity pattern of a matrix with q columns and nnz entries
+template <typename I, typename J>
+static inline size_t csrgemm_transpose_pattern_bytes(J q, I nnz)
+{
+    return ((sizeof(I) * (q + 1) - 1) / 256 + 1) * 256 + ((sizeof(J) * nnz - 1) / 256 + 1) * 256
+           + ((sizeof(I) * nnz - 1) / 256 + 1) * 256;
+}
+
+// Bytes of the values of a transposed matrix with nnz entries
+template <typename T, typename I>
+static inline size_t csrgemm_transpose_values_bytes(I nnz)
+{
+    return ((sizeof(T) * nnz - 1) / 256 + 1) * 256;
+}
+
+// Entry points into a transposed sparsity pattern stored in the temporary buffer
+template <typename I, typename J>
+static inline void csrgemm_transpose_pattern_pointers(
+    void* buffer, J q, I nnz, I** csr_row_ptr_T, J** csr_col_ind_T, I** perm_T)
+{
+    char* ptr = reinterpret_cast<char*>(buffer);
+
+    *csr_row_ptr_T = reinterpret_cast<I*>(ptr);
+    ptr += ((sizeof(I) * (q + 1) - 1) / 256 + 1) * 256;
+    *csr_col_ind_T = reinterpret_cast<J*>(ptr);
+    ptr += ((sizeof(J) * nnz - 1) / 256 + 1) * 256;
+    *perm_T = reinterpret_cast<I*>(ptr);
+}
+
+// Bytes of temporary storage required to transpose the sparsity pattern of a matrix
+// with nnz entries
+template <typename I, typename J>
+static inline rocsparse_status
+    csrgemm_transpose_pattern_buffer_size(rocsparse_handle handle, I nnz, size_t* buffer_size)
+{
+    rocprim::double_buffer<J> keys(nullptr, nullptr);
+    rocprim::double_buffer<I> vals(nullptr, nullptr);
+
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        nullptr, rocprim_size, keys, vals, nnz, 0, sizeof(J) * 8, handle->stream));
+
+    *buffer_size = ((rocprim_size - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(J) * nnz - 1) / 256 + 1) * 256 * 2;
+    *buffer_size += ((sizeof(I) * nnz - 1) / 256 + 1) * 256 * 2;
+
+    return rocsparse_status_success;
+}
+
+// Transpose the sparsity pattern of the p x q matrix into the given part of the temporary
+// buffer, keeping track of the permutation into the values of the matrix. The work buffer
+// holds the sort.
+template <typename I, typename J>
+static rocsparse_status csrgemm_transpose_pattern(rocsparse_handle     handle,
+                                                  void*                buffer,
+                                                  J                    p,
+                                                  J                    q,
+                                                  I                    nnz,
+                                                  const I*             csr_row_ptr,
+                                                  const J*             csr_col_ind,
+                                                  rocsparse_index_base idx_base,
+                                                  void*                work_buffer)
+{
+    hipStream_t stream = handle->stream;
+
+    I* csr_row_ptr_T;
+    J* csr_col_ind_T;
+    I* perm_T;
+    csrgemm_transpose_pattern_pointers(buffer, q, nnz, &csr_row_ptr_T, &csr_col_ind_T, &perm_T);
+
+    // Work buffer entry points
+    char* ptr = reinterpret_cast<char*>(work_buffer);
+
+    J* tmp_key1 = reinterpret_cast<J*>(ptr);
+    ptr += ((sizeof(J) * nnz - 1) / 256 + 1) * 256;
+
+    J* tmp_key2 = reinterpret_cast<J*>(ptr);
+    ptr += ((sizeof(J) * nnz - 1) / 256 + 1) * 256;
+
+    I* tmp_perm1 = reinterpret_cast<I*>(ptr);
+    ptr += ((sizeof(I) * nnz - 1) / 256 + 1) * 256;
+
+    I* tmp_perm2 = reinterpret_cast<I*>(ptr);
+    ptr += ((sizeof(I) * nnz - 1) / 256 + 1) * 256;
+
+    void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+    // Stable sort the entries of B by column, keeping track of their position
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        tmp_key1, csr_col_ind, sizeof(J) * nnz, hipMemcpyDeviceToDevice, stream));
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_create_identity_permutation_template(handle, nnz, tmp_perm1));
+
+    rocprim::double_buffer<J> keys(tmp_key1, tmp_key2);
+    rocprim::double_buffer<I> vals(tmp_perm1, tmp_perm2);
+
+    unsigned int startbit = 0;
+    unsigned int endbit   = 64 - __builtin_clzll(static_cast<unsigned long long>(q) + idx_base);
+
+    size_t size;
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, size, keys, vals, nnz, startbit, endbit, stream));
+    RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+        tmp_rocprim, size, keys, vals, nnz, startbit, endbit, stream));
+
+#define CSRGEMM_DIM 512
+    // Row pointers of B^T
+    hipLaunchKernelGGL((csrgemm_transpose_row_ptr<CSRGEMM_DIM>),
+                       dim3(q / CSRGEMM_DIM + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       q,
+                       nnz,
+                       keys.current(),
+                       csr_row_ptr_T,
+                       idx_base);
+
+    // Row indices of B, become the column indices of B^T
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csr2coo_template(handle, csr_row_ptr, nnz, p, keys.alternate(), idx_base));
+
+    hipLaunchKernelGGL((csrgemm_transpose_col_ind<CSRGEMM_DIM>),
+                       dim3((nnz - 1) / CSRGEMM_DIM + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       nnz,
+                       vals.current(),
+                       keys.alternate(),
+                       perm_T,
+                       csr_col_ind_T);
+#undef CSRGEMM_DIM
+
+    return rocsparse_status_success;
+}
+
+// Gather the values of a matrix into the given part of the temporary buffer, following
+// its transposed pattern computed by rocsparse_csrgemm_nnz()
+template <typename I, typename J, typename T>
+static rocsparse_status csrgemm_transpose_values(rocsparse_handle handle,
+                                                 void*            buffer,
+                                                 void*            val,
+                                                 J                q,
+                                                 I                nnz,
+                                                 const T*         csr_val,
+                                                 const I**        csr_row_ptr_T,
+                                                 const J**        csr_col_ind_T,
+                                                 const T**        csr_val_T)
+{
+    I* row_ptr_T;
+    J* col_ind_T;
+    I* perm_T;
+    csrgemm_transpose_pattern_pointers(buffer, q, nnz, &row_ptr_T, &col_ind_T, &perm_T);
+
+    T* val_T = reinterpret_cast<T*>(val);
+
+#define CSRGEMM_DIM 512
+    hipLaunchKernelGGL((csrgemm_transpose_gather<CSRGEMM_DIM>),
+                       dim3((nnz - 1) / CSRGEMM_DIM + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       handle->stream,
+                       nnz,
+                       perm_T,
+                       csr_val,
+                       val_T);
+#undef CSRGEMM_DIM
+
+    *csr_row_ptr_T = row_ptr_T;
+    *csr_col_ind_T = col_ind_T;
+    *csr_val_T     = val_T;
+
+    return rocsparse_status_success;
+}
+
+// Symbolic phase of a symmetric C. Only the triangle selected by the fill mode of C is
+// computed: the hash kernels of the non-transposed product skip all columns outside of the
+// triangle. If the product is empty, the row pointers of C count the entries of D within
+// the triangle.
+template <typename I, typename J>
+static rocsparse_status csrgemm_symmetric_nnz(rocsparse_handle          handle,
+                                              J                         m,
+                                              J                         n,
+                                              J                         k,
+                                              const rocsparse_mat_descr descr_A,
+                                              I                         nnz_A,
+                                              const I*                  csr_row_ptr_A,
+                                              const J*                  csr_col_ind_A,
+                                              const rocsparse_mat_descr descr_B,
+                                              I                         nnz_B,
+                                              const I*                  csr_row_ptr_B,
+                                              const J*                  csr_col_ind_B,
+                                              const rocsparse_mat_descr descr_D,
+                                              I                         nnz_D,
+                                              const I*                  csr_row_ptr_D,
+                                              const J*                  csr_col_ind_D,
+                                              const rocsparse_mat_descr descr_C,
+                                              I*                        csr_row_ptr_C,
+                                              I*                        nnz_C,
+                                              const rocsparse_mat_info  info_C,
+                                              void*                     temp_buffer)
+{
+    hipStream_t            stream       = handle->stream;
+    rocsparse_csrgemm_info csrgemm_info = info_C->csrgemm_info;
+
+    bool empty = (k == 0 || nnz_A == 0 || nnz_B == 0);
+
+    if(empty == false || csrgemm_info->add == false)
+    {
+        // The triangle is filtered by the kernels, which operate on a general C
+        _rocsparse_mat_descr descr_G = *descr_C;
+        descr_G.type                 = rocsparse_matrix_type_general;
+
+        csrgemm_info->mask_triangle = (descr_C->fill_mode == rocsparse_fill_mode_upper) ? 1 : -1;
+
+        rocsparse_status status = rocsparse_csrgemm_nnz_template(handle,
+                                                                 rocsparse_operation_none,
+                                                                 rocsparse_operation_none,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 descr_A,
+                                                                 nnz_A,
+                                                                 csr_row_ptr_A,
+                                                                 csr_col_ind_A,
+                                                                 descr_B,
+                                                                 nnz_B,
+                                                                 csr_row_ptr_B,
+                                                                 csr_col_ind_B,
+                                                                 descr_D,
+                                                                 nnz_D,
+                                                                 csr_row_ptr_D,
+                                                                 csr_col_ind_D,
+                                                                 &descr_G,
+                                                                 csr_row_ptr_C,
+                                                                 nnz_C,
+                                                                 info_C,
+                                                                 temp_buffer);
+
+        csrgemm_info->mask_triangle = 0;
+
+        return status;
+    }
+
+#define CSRGEMM_DIM 256
+    // Number of entries of each row of the triangle of D
+    hipLaunchKernelGGL((csrgemm_symmetric_row_nnz<CSRGEMM_DIM>),
+                       dim3((m - 1) / CSRGEMM_DIM + 1),
+                       dim3(CSRGEMM_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_D,
+                       csr_col_ind_D,
+                       csr_row_ptr_C,
+                       descr_D->base,
+                       descr_C->fill_mode);
+#undef CSRGEMM_DIM
+
+    // Exclusive sum to obtain row pointers of C
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                static_cast<I>(descr_C->base),
+                                                m + 1,
+                                                rocprim::plus<I>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(temp_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_C,
+                                                csr_row_ptr_C,
+                                                static_cast<I>(descr_C->base),
+                                                m + 1,
+                                                rocprim::plus<I>(),
+                                                stream));
+
+    // Store nnz of C
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(nnz_C, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToDevice, stream));
+
+        // Adjust nnz by index base
+        if(descr_C->base == rocsparse_index_base_one)
+        {
+            hipLaunchKernelGGL((csrgemm_index_base<1>), dim3(1), dim3(1), 0, stream, nnz_C);
+        }
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(nnz_C, csr_row_ptr_C + m, sizeof(I), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // Adjust nnz by index base
+        *nnz_C -= descr_C->base;
+    }
+
+    return rocsparse_status_success;
+}
+
+// Numerical phase of a symmetric C. The triangle selected by the fill mode of C is computed
+// by the non-transposed product, which skips all columns outside of the triangle. If the
+// product is empty, the entries of beta * D within the triangle are copied into C.
+template <typename I, typename J, typename T>
+static rocsparse_status csrgemm_symmetric(rocsparse_handle          handle,
+                                          J                         m,
+                                          J                         n,
+                                          J                         k,
+                                          const T*                  alpha,
+                                          const rocsparse_mat_descr descr_A,
+                                          I                         nnz_A,
+                                          const T*                  csr_val_A,
+                                          const I*                  csr_row_ptr_A,
+                                          const J*                  csr_col_ind_A,
+                                          const rocsparse_mat_descr descr_B,
+                                          I                         nnz_B,
+                                          const T*                  csr_val_B,
+                                          const I*                  csr_row_ptr_B,
+                                          const J*                  csr_col_ind_B,
+                                          const T*                  beta,
+                                          const rocsparse_mat_descr descr_D,
+                                          I                         nnz_D,
+                                          const T*                  csr_val_D,
+                                          const I*                  csr_row_ptr_D,
+                                          const J*                  csr_col_ind_D,
+                                          const rocsparse_mat_descr descr_C,
+                                          T*                        csr_val_C,
+                                          const I*                  csr_row_ptr_C,
+                                          J*                        csr_col_ind_C,
+                                          const rocsparse_mat_info  info_C,
+                                          void*                     temp_buffer)
+{
+    hipStream_t            stream       = handle->stream;
+    rocsparse_csrgemm_info csrgemm_info = info_C->csrgemm_info;
+
+    bool empty = (k == 0 || nnz_A == 0 || nnz_B == 0);
+
+    if(empty == false || csrgemm_info->add == false)
+    {
+        // The triangle is filtered by the kernels, which operate on a general C
+        _rocsparse_mat_descr descr_G = *descr_C;
+        descr_G.type                 = rocsparse_matrix_type_general;
+
+        csrgemm_info->mask_triangle = (descr_C->fill_mode == rocsparse_fill_mode_upper) ? 1 : -1;
+
+        rocsparse_status status = rocsparse_csrgemm_template(handle,
+                                                             rocsparse_operation_none,
+                                                             rocsparse_operation_none,
+                                                             m,
+                                                             n,
+                                                             k,
+                                                             alpha,
+                                                             descr_A,
+                                                             nnz_A,
+                                                             csr_val_A,
+                                                             csr_row_ptr_A,
+                                                             csr_col_ind_A,
+                                                             descr_B,
+                                                             nnz_B,
+                                                             csr_val_B,
+                                                             csr_row_ptr_B,
+                                                             csr_col_ind_B,
+                                                             beta,
+                                                             descr_D,
+                                                             nnz_D,
+                                                             csr_val_D,
+                                                             csr_row_ptr_D,
+                                                             csr_col_ind_D,
+                                                             &descr_G,
+                                                             csr_val_C,
+                                                             csr_row_ptr_C,
+                                                             csr_col_ind_C,
+                                                             info_C,
+                                                             temp_buffer);
+
+        csrgemm_info->mask_triangle = 0;
+
+        return status;
+    }
+
+#define CSRGEMM_DIM 256
+    // Copy the triangle of beta * D into C
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((csrgemm_symmetric_fill<CSRGEMM_DIM>),
+                           dim3((m - 1) / CSRGEMM_DIM + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           m,
+                           beta,
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           csr_val_D,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           csr_val_C,
+                           descr_D->base,
+                           descr_C->base,
+                           descr_C->fill_mode);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrgemm_symmetric_fill<CSRGEMM_DIM>),
+                           dim3((m - 1) / CSRGEMM_DIM + 1),
+                           dim3(CSRGEMM_DIM),
+                           0,
+                           stream,
+                           m,
+                           *beta,
+                           csr_row_ptr_D,
+                           csr_col_ind_D,
+                           csr_val_D,
+                           csr_row_ptr_C,
+                           csr_col_ind_C,
+                           csr_val_C,
+                           descr_D->base,
+                           descr_C->base,
+                           descr_C->fill_mode);
+    }
+#undef CSRGEMM_DIM
+
+    return rocsparse_status_success;
+}
+
+// Check the operations and the matrix types. A symmetric C is only supported for the
+// products A^T * A and A * A^T.
+template <typename I, typename J>
+static inline rocsparse_status csrgemm_transpose_check(rocsparse_operation       trans_A,
+                                                       rocsparse_operation       trans_B,
+                                                       J                         m,
+                                                       J                         n,
+                                                       const rocsparse_mat_descr descr_A,
+                                                       I                         nnz_A,
+                                                       const I*                  csr_row_ptr_A,
+                                                       const J*                  csr_col_ind_A,
+                                                       const void*               csr_val_A,
+                                                       const rocsparse_mat_descr descr_B,
+                                                       I                         nnz_B,
+                                                       const I*                  csr_row_ptr_B,
+                                                       const J*                  csr_col_ind_B,
+                                                       const void*               csr_val_B,
+                                                       const rocsparse_mat_descr descr_C)
+{
+    // Check operations
+    if(rocsparse_enum_utils::is_invalid(trans_A) || rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans_A == rocsparse_operation_conjugate_transpose
+       || trans_B == rocsparse_operation_conjugate_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix type
+    if(descr_A->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(descr_B->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    if(descr_C->type == rocsparse_matrix_type_symmetric)
+    {
+        // B has to be A, with exactly one of both operands transposed
+        if(trans_A == trans_B || nnz_A != nnz_B || csr_row_ptr_A != csr_row_ptr_B
+           || csr_col_ind_A != csr_col_ind_B || csr_val_A != csr_val_B
+           || descr_A->base != descr_B->base)
+        {
+            return rocsparse_status_not_implemented;
+        }
+
+        if(m != n)
+        {
+            return rocsparse_status_invalid_size;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status
+    rocsparse_csrgemm_transpose_buffer_size_template(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans_A,
+                                                     rocsparse_operation       trans_B,
+                                                     J                         m,
+                                                     J                         n,
+                                                     J                         k,
+                                                     const T*                  alpha,
+                                                     const rocsparse_mat_descr descr_A,
+                                                     I                         nnz_A,
+                                                     const I*                  csr_row_ptr_A,
+                                                     const J*                  csr_col_ind_A,
+                                                     const rocsparse_mat_descr descr_B,
+                                                     I                         nnz_B,
+                                                     const I*                  csr_row_ptr_B,
+                                                     const J*                  csr_col_ind_B,
+                                                     const T*                  beta,
+                                                     const rocsparse_mat_descr descr_D,
+                                                     I                         nnz_D,
+                                                     const I*                  csr_row_ptr_D,
+                                                     const J*                  csr_col_ind_D,
+                                                     rocsparse_mat_info        info_C,
+                                                     size_t*                   buffer_size)
+{
+    // Check operations
+    if(rocsparse_enum_utils::is_invalid(trans_A) || rocsparse_enum_utils::is_invalid(trans_B))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans_A == rocsparse_operation_conjugate_transpose
+       || trans_B == rocsparse_operation_conjugate_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Set up the csrgemm info and check all remaining arguments. The product is computed
+    // from the sparsity patterns of op(A) and op(B) by the non-transposed product, which
+    // requires the same work space.
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_buffer_size_template(handle,
+                                                                     rocsparse_operation_none,
+                                                                     rocsparse_operation_none,
+                                                                     m,
+                                                                     n,
+                                                                     k,
+                                                                     alpha,
+                                                                     descr_A,
+                                                                     nnz_A,
+                                                                     csr_row_ptr_A,
+                                                                     csr_col_ind_A,
+                                                                     descr_B,
+                                                                     nnz_B,
+                                                                     csr_row_ptr_B,
+                                                                     csr_col_ind_B,
+                                                                     beta,
+                                                                     descr_D,
+                                                                     nnz_D,
+                                                                     csr_row_ptr_D,
+                                                                     csr_col_ind_D,
+                                                                     info_C,
+                                                                     buffer_size));
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // rocprim buffer for the row pointers of a symmetric C = beta * D
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                (I*)nullptr,
+                                                (I*)nullptr,
+                                                static_cast<I>(0),
+                                                m + 1,
+                                                rocprim::plus<I>(),
+                                                handle->stream));
+
+    *buffer_size = std::max(*buffer_size, ((rocprim_size - 1) / 256 + 1) * 256);
+
+    if(k == 0 || nnz_A == 0 || nnz_B == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Work space to transpose the patterns of A and B. The transposed patterns and their
+    // values are kept in front of the work space, as they are computed by
+    // rocsparse_csrgemm_nnz() and used by rocsparse_csrgemm().
+    size_t transpose_size;
+    size_t trans_offset = 0;
+
+    if(trans_A == rocsparse_operation_transpose)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            csrgemm_transpose_pattern_buffer_size<I, J>(handle, nnz_A, &transpose_size));
+
+        *buffer_size = std::max(*buffer_size, transpose_size);
+        trans_offset += csrgemm_transpose_pattern_bytes(m, nnz_A);
+        trans_offset += csrgemm_transpose_values_bytes<T>(nnz_A);
+    }
+
+    if(trans_B == rocsparse_operation_transpose)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(
+            csrgemm_transpose_pattern_buffer_size<I, J>(handle, nnz_B, &transpose_size));
+
+        *buffer_size = std::max(*buffer_size, transpose_size);
+        trans_offset += csrgemm_transpose_pattern_bytes(k, nnz_B);
+        trans_offset += csrgemm_transpose_values_bytes<T>(nnz_B);
+    }
+
+    info_C->csrgemm_info->trans_offset = trans_offset;
+    *buffer_size += trans_offset;
+
+    return rocsparse_status_success;
+}
+
+template <typename I, typename J>
+rocsparse_status rocsparse_csrgemm_transpose_nnz_template(rocsparse_handle          handle,
+                                                          rocsparse_operation       trans_A,
+                                                          rocsparse_operation       trans_B,
+                                                          J                         m,
+                                                          J                         n,
+                                                          J                         k,
+                                                          const rocsparse_mat_descr descr_A,
+                                                          I                         nnz_A,
+                                                          const I*                  csr_row_ptr_A,
+                                                          const J*                  csr_col_ind_A,
+                                                          const rocsparse_mat_descr descr_B,
+                                                          I                         nnz_B,
+                                                          const I*                  csr_row_ptr_B,
+                                                          const J*                  csr_col_ind_B,
+                                                          const rocsparse_mat_descr descr_D,
+                                                          I                         nnz_D,
+                                                          const I*                  csr_row_ptr_D,
+                                                          const J*                  csr_col_ind_D,
+                                                          const rocsparse_mat_descr descr_C,
+                                                          I*                        csr_row_ptr_C,
+                                                          I*                        nnz_C,
+                                                          const rocsparse_mat_info  info_C,
+                                                          void*                     temp_buffer)
+{
+    bool add = info_C->csrgemm_info->add;
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || (add == true && nnz_D < 0))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_B == nullptr || csr_row_ptr_B == nullptr || csr_col_ind_B == nullptr
+       || descr_C == nullptr || csr_row_ptr_C == nullptr || nnz_C == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(add == true && (descr_D == nullptr || csr_row_ptr_D == nullptr || csr_col_ind_D == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_B->base != rocsparse_index_base_zero && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(add == true && descr_D->base != rocsparse_index_base_zero
+       && descr_D->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(add == true && descr_D->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(csrgemm_transpose_check(trans_A,
+                                                      trans_B,
+                                                      m,
+                                                      n,
+                                                      descr_A,
+                                                      nnz_A,
+                                                      csr_row_ptr_A,
+                                                      csr_col_ind_A,
+                                                      nullptr,
+                                                      descr_B,
+                                                      nnz_B,
+                                                      csr_row_ptr_B,
+                                                      csr_col_ind_B,
+                                                      nullptr,
+                                                      descr_C));
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(I), handle->stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    bool symmetric = (descr_C->type == rocsparse_matrix_type_symmetric);
+    bool empty     = (k == 0 || nnz_A == 0 || nnz_B == 0);
+
+    rocsparse_csrgemm_info csrgemm_info = info_C->csrgemm_info;
+
+    // Temporary buffer. The transposed patterns are kept in front of the work space of the
+    // non-transposed product, such that the numerical phase only gathers the values.
+    char* ptr         = reinterpret_cast<char*>(temp_buffer);
+    void* work_buffer = ptr + csrgemm_info->trans_offset;
+
+    // Sparsity patterns of op(A) and op(B)
+    const I* csr_row_ptr_opA = csr_row_ptr_A;
+    const J* csr_col_ind_opA = csr_col_ind_A;
+    const I* csr_row_ptr_opB = csr_row_ptr_B;
+    const J* csr_col_ind_opB = csr_col_ind_B;
+
+    // A is of dimension k x m
+    if(trans_A == rocsparse_operation_transpose && empty == false)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(csrgemm_transpose_pattern(handle,
+                                                            ptr,
+                                                            k,
+                                                            m,
+                                                            nnz_A,
+                                                            csr_row_ptr_A,
+                                                            csr_col_ind_A,
+                                                            descr_A->base,
+                                                            work_buffer));
+
+        I* row_ptr_AT;
+        J* col_ind_AT;
+        I* perm_AT;
+        csrgemm_transpose_pattern_pointers(ptr, m, nnz_A, &row_ptr_AT, &col_ind_AT, &perm_AT);
+
+        csr_row_ptr_opA = row_ptr_AT;
+        csr_col_ind_opA = col_ind_AT;
+
+        ptr += csrgemm_transpose_pattern_bytes(m, nnz_A);
+    }
+
+    // B is of dimension n x k
+    if(trans_B == rocsparse_operation_transpose && empty == false)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(csrgemm_transpose_pattern(handle,
+                                                            ptr,
+                                                            n,
+                                                            k,
+                                                            nnz_B,
+                                                            csr_row_ptr_B,
+                                                            csr_col_ind_B,
+                                                            descr_B->base,
+                                                            work_buffer));
+
+        I* row_ptr_BT;
+        J* col_ind_BT;
+        I* perm_BT;
+        csrgemm_transpose_pattern_pointers(ptr, k, nnz_B, &row_ptr_BT, &col_ind_BT, &perm_BT);
+
+        csr_row_ptr_opB = row_ptr_BT;
+        csr_col_ind_opB = col_ind_BT;
+    }
+
+    csrgemm_info->trans_valid = true;
+
+    if(symmetric == true)
+    {
+        return csrgemm_symmetric_nnz(handle,
+                                     m,
+                                     n,
+                                     k,
+                                     descr_A,
+                                     nnz_A,
+                                     csr_row_ptr_opA,
+                                     csr_col_ind_opA,
+                                     descr_B,
+                                     nnz_B,
+                                     csr_row_ptr_opB,
+                                     csr_col_ind_opB,
+                                     descr_D,
+                                     nnz_D,
+                                     csr_row_ptr_D,
+                                     csr_col_ind_D,
+                                     descr_C,
+                                     csr_row_ptr_C,
+                                     nnz_C,
+                                     info_C,
+                                     work_buffer);
+    }
+
+    // C = alpha * op(A) * op(B) + beta * D is computed by the non-transposed product
+    return rocsparse_csrgemm_nnz_template(handle,
+                                          rocsparse_operation_none,
+                                          rocsparse_operation_none,
+                                          m,
+                                          n,
+                                          k,
+                                          descr_A,
+                                          nnz_A,
+                                          csr_row_ptr_opA,
+                                          csr_col_ind_opA,
+                                          descr_B,
+                                          nnz_B,
+                                          csr_row_ptr_opB,
+                                          csr_col_ind_opB,
+                                          descr_D,
+                                          nnz_D,
+                                          csr_row_ptr_D,
+                                          csr_col_ind_D,
+                                          descr_C,
+                                          csr_row_ptr_C,
+                                          nnz_C,
+                                          info_C,
+                                          work_buffer);
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_csrgemm_transpose_template(rocsparse_handle          handle,
+                                                      rocsparse_operation       trans_A,
+                                                      rocsparse_operation       trans_B,
+                                                      J                         m,
+                                                      J                         n,
+                                                      J                         k,
+                                                      const T*                  alpha,
+                                                      const rocsparse_mat_descr descr_A,
+                                                      I                         nnz_A,
+                                                      const T*                  csr_val_A,
+                                                      const I*                  csr_row_ptr_A,
+                                                      const J*                  csr_col_ind_A,
+                                                      const rocsparse_mat_descr descr_B,
+                                                      I                         nnz_B,
+                                                      const T*                  csr_val_B,
+                                                      const I*                  csr_row_ptr_B,
+                                                      const J*                  csr_col_ind_B,
+                                                      const T*                  beta,
+                                                      const rocsparse_mat_descr descr_D,
+                                                      I                         nnz_D,
+                                                      const T*                  csr_val_D,
+                                                      const I*                  csr_row_ptr_D,
+                                                      const J*                  csr_col_ind_D,
+                                                      const rocsparse_mat_descr descr_C,
+                                                      T*                        csr_val_C,
+                                                      const I*                  csr_row_ptr_C,
+                                                      J*                        csr_col_ind_C,
+                                                      const rocsparse_mat_info  info_C,
+                                                      void*                     temp_buffer)
+{
+    bool add = info_C->csrgemm_info->add;
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_A < 0 || nnz_B < 0 || (add == true && nnz_D < 0))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(alpha == nullptr || descr_A == nullptr || csr_val_A == nullptr || csr_row_ptr_A == nullptr
+       || csr_col_ind_A == nullptr || descr_B == nullptr || csr_val_B == nullptr
+       || csr_row_ptr_B == nullptr || csr_col_ind_B == nullptr || descr_C == nullptr
+       || csr_val_C == nullptr || csr_row_ptr_C == nullptr || csr_col_ind_C == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(add == true
+       && (beta == nullptr || descr_D == nullptr || csr_val_D == nullptr
+           || csr_row_ptr_D == nullptr || csr_col_ind_D == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_B->base != rocsparse_index_base_zero && descr_B->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(add == true && descr_D->base != rocsparse_index_base_zero
+       && descr_D->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(add == true && descr_D->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(csrgemm_transpose_check(trans_A,
+                                                      trans_B,
+                                                      m,
+                                                      n,
+                                                      descr_A,
+                                                      nnz_A,
+                                                      csr_row_ptr_A,
+                                                      csr_col_ind_A,
+                                                      csr_val_A,
+                                                      descr_B,
+                                                      nnz_B,
+                                                      csr_row_ptr_B,
+                                                      csr_col_ind_B,
+                                                      csr_val_B,
+                                                      descr_C));
+
+    // Quick return if possible
+    if(m == 0 || n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    bool symmetric = (descr_C->type == rocsparse_matrix_type_symmetric);
+    bool empty     = (k == 0 || nnz_A == 0 || nnz_B == 0);
+
+    rocsparse_csrgemm_info csrgemm_info = info_C->csrgemm_info;
+
+    bool transposed_A = (trans_A == rocsparse_operation_transpose && empty == false);
+    bool transposed_B = (trans_B == rocsparse_operation_transpose && empty == false);
+
+    // The transposed patterns are computed by rocsparse_csrgemm_nnz()
+    if((transposed_A == true || transposed_B == true) && csrgemm_info->trans_valid == false)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Temporary buffer. The transposed patterns obtained during the symbolic phase are
+    // followed by their values, in front of the work space of the non-transposed product.
+    size_t pattern_AT_bytes = transposed_A ? csrgemm_transpose_pattern_bytes(m, nnz_A) : 0;
+    size_t pattern_BT_bytes = transposed_B ? csrgemm_transpose_pattern_bytes(k, nnz_B) : 0;
+    size_t val_AT_bytes     = transposed_A ? csrgemm_transpose_values_bytes<T>(nnz_A) : 0;
+
+    char* pattern_AT = reinterpret_cast<char*>(temp_buffer);
+    char* pattern_BT = pattern_AT + pattern_AT_bytes;
+    char* val_AT     = pattern_BT + pattern_BT_bytes;
+    char* val_BT     = val_AT + val_AT_bytes;
+
+    void* work_buffer = pattern_AT + csrgemm_info->trans_offset;
+
+    // op(A) and op(B), gathered into the transposed patterns
+    const I* csr_row_ptr_opA = csr_row_ptr_A;
+    const J* csr_col_ind_opA = csr_col_ind_A;
+    const T* csr_val_opA     = csr_val_A;
+    const I* csr_row_ptr_opB = csr_row_ptr_B;
+    const J* csr_col_ind_opB = csr_col_ind_B;
+    const T* csr_val_opB     = csr_val_B;
+
+    if(transposed_A == true)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(csrgemm_transpose_values(handle,
+                                                           pattern_AT,
+                                                           val_AT,
+                                                           m,
+                                                           nnz_A,
+                                                           csr_val_A,
+                                                           &csr_row_ptr_opA,
+                                                           &csr_col_ind_opA,
+                                                           &csr_val_opA));
+    }
+
+    if(transposed_B == true)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(csrgemm_transpose_values(handle,
+                                                           pattern_BT,
+                                                           val_BT,
+                                                           k,
+                                                           nnz_B,
+                                                           csr_val_B,
+                                                           &csr_row_ptr_opB,
+                                                           &csr_col_ind_opB,
+                                                           &csr_val_opB));
+    }
+
+    if(symmetric == true)
+    {
+        return csrgemm_symmetric(handle,
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 descr_A,
+                                 nnz_A,
+                                 csr_val_opA,
+                                 csr_row_ptr_opA,
+                                 csr_col_ind_opA,
+                                 descr_B,
+                                 nnz_B,
+                                 csr_val_opB,
+                                 csr_row_ptr_opB,
+                                 csr_col_ind_opB,
+                                 beta,
+                                 descr_D,
+                                 nnz_D,
+                                 csr_val_D,
+                                 csr_row_ptr_D,
+                                 csr_col_ind_D,
+                                 descr_C,
+                                 csr_val_C,
+                                 csr_row_ptr_C,
+                                 csr_col_ind_C,
+                                 info_C,
+                                 work_buffer);
+    }
+
+    // C = alpha * op(A) * op(B) + beta * D is computed by the non-transposed product
+    return rocsparse_csrgemm_template(handle,
+                                      rocsparse_operation_none,
+                                      rocsparse_operation_none,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_A,
+                                      nnz_A,
+                                      csr_val_opA,
+                                      csr_row_ptr_opA,
+                                      csr_col_ind_opA,
+                                      descr_B,
+                                      nnz_B,
+                                      csr_val_opB,
+                                      csr_row_ptr_opB,
+                                      csr_col_ind_opB,
+                                      beta,
+                                      descr_D,
+                                      nnz_D,
+                                      csr_val_D,
+                                      csr_row_ptr_D,
+                                      csr_col_ind_D,
+                                      descr_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info_C,
+                                      work_buffer);
+}
+
+#define INSTANTIATE(ITYPE, JTYPE)                                                     \
+    template rocsparse_status rocsparse_csrgemm_transpose_nnz_template<ITYPE, JTYPE>( \
+        rocsparse_handle          handle,                                             \
+        rocsparse_operation       trans_A,                                            \
+        rocsparse_operation       trans_B,                                            \
+        JTYPE                     m,                                                  \
+        JTYPE                     n,                                                  \
+        JTYPE                     k,                                                  \
+        const rocsparse_mat_descr descr_A,                                            \
+        ITYPE                     nnz_A,                                              \
+        const ITYPE*              csr_row_ptr_A,                                      \
+        const JTYPE*              csr_col_ind_A,                                      \
+        const rocsparse_mat_descr descr_B,                                            \
+        ITYPE                     nnz_B,                                              \
+        const ITYPE*              csr_row_ptr_B,                                      \
+        const JTYPE*              csr_col_ind_B,                                      \
+        const rocsparse_mat_descr descr_D,                                            \
+        ITYPE                     nnz_D,                                              \
+        const ITYPE*              csr_row_ptr_D,                                      \
+        const JTYPE*              csr_col_ind_D,                                      \
+        const rocsparse_mat_descr descr_C,                                            \
+        ITYPE*                    csr_row_ptr_C,                                      \
+        ITYPE*                    nnz_C,                                              \
+        const rocsparse_mat_info  info_C,                                             \
+        void*                     temp_buffer);
+
+INSTANTIATE(int32_t, int32_t);
+INSTANTIATE(int64_t, int32_t);
+INSTANTIATE(int64_t, int64_t);
+#undef INSTANTIATE
+
+#define INSTANTIATE(ITYPE, JTYPE, TTYPE)                                                        \
+    template rocsparse_status                                                                   \
+        rocsparse_csrgemm_transpose_buffer_size_template<ITYPE, JTYPE, TTYPE>(                  \
+            rocsparse_handle          handle,                                                   \
+            rocsparse_operation       trans_A,                                                  \
+            rocsparse_operation       trans_B,                                                  \
+            JTYPE                     m,                                                        \
+            JTYPE                     n,                                                        \
+            JTYPE                     k,                                                        \
+            const TTYPE*              alpha,                                                    \
+            const rocsparse_mat_descr descr_A,                                                  \
+            ITYPE                     nnz_A,                                                    \
+            const ITYPE*              csr_row_ptr_A,                                            \
+            const JTYPE*              csr_col_ind_A,                                            \
+            const rocsparse_mat_descr descr_B,                                                  \
+            ITYPE                     nnz_B,                                                    \
+            const ITYPE*              csr_row_ptr_B,                                            \
+            const JTYPE*              csr_col_ind_B,                                            \
+            const TTYPE*              beta,                                                     \
+            const rocsparse_mat_descr descr_D,                                                  \
+            ITYPE                     nnz_D,                                                    \
+            const ITYPE*              csr_row_ptr_D,                                            \
+            const JTYPE*              csr_col_ind_D,                                            \
+            rocsparse_mat_info        info_C,                                                   \
+            size_t*                   buffer_size);                                             \
+    template rocsparse_status rocsparse_csrgemm_transpose_template<ITYPE, JTYPE, TTYPE>(        \
+        rocsparse_handle          handle,                                                       \
+        rocsparse_operation       trans_A,                                                      \
+        rocsparse_operation       trans_B,                                                      \
+        JTYPE                     m,                                                            \
+        JTYPE                     n,                                                            \
+        JTYPE                     k,                                                            \
+        const TTYPE*              alpha,                                                        \
+        const rocsparse_mat_descr descr_A,                                                      \
+        ITYPE                     nnz_A,                                                        \
+        const TTYPE*              csr_val_A,                                                    \
+        const ITYPE*              csr_row_ptr_A,                                                \
+        const JTYPE*              csr_col_ind_A,                                                \
+        const rocsparse_mat_descr descr_B,                                                      \
+        ITYPE                     nnz_B,                                                        \
+        const TTYPE*              csr_val_B,                                                    \
+        const ITYPE*              csr_row_ptr_B,                                                \
+        const JTYPE*              csr_col_ind_B,                                                \
+        const TTYPE*              beta,                                                         \
+        const rocsparse_mat_descr descr_D,                                                      \
+        ITYPE                     nnz_D,                                                        \
+        const TTYPE*              csr_val_D,                                                    \
+        const ITYPE*              csr_row_ptr_D,                                                \
+        const JTYPE*              csr_col_ind_D,                                                \
+        const rocsparse_mat_descr descr_C,                                                      \
+        TTYPE*                    csr_val_C,                                                    \
+        const ITYPE*              csr_row_ptr_C,                                                \
+        JTYPE*                    csr_col_ind_C,                                                \
+        const rocsparse_mat_info  info_C,                                                       \
+        void*                     temp_buffer);
+
+INSTANTIATE(int32_t, int32_t, float);
+INSTANTIATE(int32_t, int32_t, double);
+INSTANTIATE(int32_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int32_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int32_t, float);
+INSTANTIATE(int64_t, int32_t, double);
+INSTANTIATE(int64_t, int32_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int32_t, rocsparse_double_complex);
+INSTANTIATE(int64_t, int64_t, float);
+INSTANTIATE(int64_t, int64_t, double);
+INSTANTIATE(int64_t, int64_t, rocsparse_float_complex);
+INSTANTIATE(int64_t, int64_t, rocsparse_double_complex);
+#undef INSTANTIATE
@@ -0,0 +1,1069 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_csrrap.hpp"
+#include "definitions.h"
+#include "rocsparse_csrgemm.hpp"
+#include "utility.h"
+
+#include "csrgemm_estimate_device.h"
+#include "csrrap_device.h"
+
+#include <rocprim/rocprim.hpp>
+
+// The temporary storage buffer holds the pattern of R^T, if required, and the pattern
+// of A * P, followed by their values and the csrgemm work space. Returns the entry
+// point of the values.
+static char* rocsparse_csrrap_buffer_index(rocsparse_csrrap_info info,
+                                           rocsparse_int         m,
+                                           rocsparse_int         k,
+                                           rocsparse_int         nnz_R,
+                                           void*                 temp_buffer,
+                                           rocsparse_int**       rt_row_ptr,
+                                           rocsparse_int**       rt_col_ind,
+                                           rocsparse_int**       rt_perm,
+                                           rocsparse_int**       ap_row_ptr,
+                                           rocsparse_int**       ap_col_ind)
+{
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    *rt_row_ptr = nullptr;
+    *rt_col_ind = nullptr;
+    *rt_perm    = nullptr;
+
+    if(info->trans_R == rocsparse_operation_transpose)
+    {
+        *rt_row_ptr = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+        *rt_col_ind = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += sizeof(rocsparse_int) * ((nnz_R - 1) / 256 + 1) * 256;
+
+        *rt_perm = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += sizeof(rocsparse_int) * ((nnz_R - 1) / 256 + 1) * 256;
+    }
+
+    *ap_row_ptr = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (k / 256 + 1) * 256;
+
+    *ap_col_ind = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((info->nnz_AP_max - 1) / 256 + 1) * 256;
+
+    return ptr;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrrap_buffer_size_template(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans_R,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             n,
+                                                       rocsparse_int             k,
+                                                       const T*                  alpha,
+                                                       const rocsparse_mat_descr descr_R,
+                                                       rocsparse_int             nnz_R,
+                                                       const rocsparse_int*      csr_row_ptr_R,
+                                                       const rocsparse_int*      csr_col_ind_R,
+                                                       const rocsparse_mat_descr descr_A,
+                                                       rocsparse_int             nnz_A,
+                                                       const rocsparse_int*      csr_row_ptr_A,
+                                                       const rocsparse_int*      csr_col_ind_A,
+                                                       const rocsparse_mat_descr descr_P,
+                                                       rocsparse_int             nnz_P,
+                                                       const rocsparse_int*      csr_row_ptr_P,
+                                                       const rocsparse_int*      csr_col_ind_P,
+                                                       rocsparse_mat_info        info_C,
+                                                       size_t*                   buffer_size)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrrap_buffer_size"),
+              trans_R,
+              m,
+              n,
+              k,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha),
+              (const void*&)descr_R,
+              nnz_R,
+              (const void*&)csr_row_ptr_R,
+              (const void*&)csr_col_ind_R,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_P,
+              nnz_P,
+              (const void*&)csr_row_ptr_P,
+              (const void*&)csr_col_ind_P,
+              (const void*&)info_C,
+              (const void*&)buffer_size);
+
+    // Check for valid rocsparse_mat_info
+    if(info_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check operation
+    if(rocsparse_enum_utils::is_invalid(trans_R))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(trans_R == rocsparse_operation_conjugate_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_R < 0 || nnz_A < 0 || nnz_P < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_R == nullptr || csr_row_ptr_R == nullptr || csr_col_ind_R == nullptr
+       || descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_P == nullptr || csr_row_ptr_P == nullptr || csr_col_ind_P == nullptr
+       || buffer_size == nullptr || alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_R->base != rocsparse_index_base_zero && descr_R->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_P->base != rocsparse_index_base_zero && descr_P->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_R->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(descr_A->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+    if(descr_P->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Clear csrrap info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrrap_info(info_C->csrrap_info));
+
+    // Create csrrap info
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csrrap_info(&info_C->csrrap_info));
+
+    rocsparse_csrrap_info info = info_C->csrrap_info;
+
+    info->trans_R = trans_R;
+
+    // Meta data of both products
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info->ap_info));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_mat_info(&info->rap_info));
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_R == 0 || nnz_A == 0 || nnz_P == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The number of intermediate products of A * P bounds its number of non-zero
+    // entries
+    int64_t* workspace = reinterpret_cast<int64_t*>(handle->buffer);
+
+#define CSRRAP_DIM 256
+    hipLaunchKernelGGL((csrgemm_estimate_products_part1<CSRRAP_DIM>),
+                       dim3(CSRRAP_DIM),
+                       dim3(CSRRAP_DIM),
+                       0,
+                       stream,
+                       nnz_A,
+                       csr_col_ind_A,
+                       csr_row_ptr_P,
+                       workspace,
+                       descr_A->base);
+
+    hipLaunchKernelGGL((csrgemm_estimate_products_part2<CSRRAP_DIM>),
+                       dim3(1),
+                       dim3(CSRRAP_DIM),
+                       0,
+                       stream,
+                       workspace);
+#undef CSRRAP_DIM
+
+    int64_t nnz_products;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &nnz_products, workspace, sizeof(int64_t), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    nnz_products = std::min(nnz_products, static_cast<int64_t>(k) * n);
+    nnz_products = std::min(nnz_products,
+                            static_cast<int64_t>(std::numeric_limits<rocsparse_int>::max()));
+
+    info->nnz_AP_max = static_cast<rocsparse_int>(nnz_products);
+
+    // Pattern and values of R^T and A * P, see rocsparse_csrrap_buffer_index()
+    info->work_offset = (sizeof(rocsparse_int) + sizeof(T))
+                        * ((info->nnz_AP_max - 1) / 256 + 1) * 256;
+    info->work_offset += sizeof(rocsparse_int) * (k / 256 + 1) * 256;
+
+    if(trans_R == rocsparse_operation_transpose)
+    {
+        info->work_offset += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+        info->work_offset
+            += (sizeof(rocsparse_int) * 2 + sizeof(T)) * ((nnz_R - 1) / 256 + 1) * 256;
+    }
+
+    // Buffer size of A * P
+    size_t ap_size;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrgemm_buffer_size_template(handle,
+                                               rocsparse_operation_none,
+                                               rocsparse_operation_none,
+                                               k,
+                                               n,
+                                               k,
+                                               alpha,
+                                               descr_A,
+                                               nnz_A,
+                                               csr_row_ptr_A,
+                                               csr_col_ind_A,
+                                               descr_P,
+                                               nnz_P,
+                                               csr_row_ptr_P,
+                                               csr_col_ind_P,
+                                               (const T*)nullptr,
+                                               nullptr,
+                                               (rocsparse_int)0,
+                                               (const rocsparse_int*)nullptr,
+                                               (const rocsparse_int*)nullptr,
+                                               info->ap_info,
+                                               &ap_size));
+
+    // Buffer size of op(R) * (A * P). The patterns of R^T and A * P are not known
+    // yet. The buffer size of the product only depends on the number of rows of
+    // the left factor, thus the patterns of R and P are passed in their place.
+    size_t rap_size;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrgemm_buffer_size_template(handle,
+                                               rocsparse_operation_none,
+                                               rocsparse_operation_none,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               descr_R,
+                                               nnz_R,
+                                               csr_row_ptr_R,
+                                               csr_col_ind_R,
+                                               &info->ap_descr,
+                                               nnz_P,
+                                               csr_row_ptr_P,
+                                               csr_col_ind_P,
+                                               (const T*)nullptr,
+                                               nullptr,
+                                               (rocsparse_int)0,
+                                               (const rocsparse_int*)nullptr,
+                                               (const rocsparse_int*)nullptr,
+                                               info->rap_info,
+                                               &rap_size));
+
+    size_t work_size = std::max(ap_size, rap_size);
+
+    // Transposition of R
+    if(trans_R == rocsparse_operation_transpose)
+    {
+        // rocprim buffer
+        rocsparse_int* ptr = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+        rocprim::double_buffer<rocsparse_int> dummy(ptr, ptr);
+
+        size_t rt_size;
+        RETURN_IF_HIP_ERROR(
+            rocprim::radix_sort_pairs(nullptr, rt_size, dummy, dummy, nnz_R, 0, 32, stream));
+
+        rt_size = ((rt_size - 1) / 256 + 1) * 256;
+
+        // Sort keys, permutation and their double buffers
+        rt_size += sizeof(rocsparse_int) * ((nnz_R - 1) / 256 + 1) * 256 * 4;
+
+        work_size = std::max(work_size, rt_size);
+    }
+
+    *buffer_size = info->work_offset + work_size;
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrrap_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_R,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr_R,
+                                           rocsparse_int             nnz_R,
+                                           const T*                  csr_val_R,
+                                           const rocsparse_int*      csr_row_ptr_R,
+                                           const rocsparse_int*      csr_col_ind_R,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const T*                  csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_P,
+                                           rocsparse_int             nnz_P,
+                                           const T*                  csr_val_P,
+                                           const rocsparse_int*      csr_row_ptr_P,
+                                           const rocsparse_int*      csr_col_ind_P,
+                                           const rocsparse_mat_descr descr_C,
+                                           T*                        csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           rocsparse_int*            csr_col_ind_C,
+                                           const rocsparse_mat_info  info_C,
+                                           void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrrap"),
+              trans_R,
+              m,
+              n,
+              k,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha),
+              (const void*&)descr_R,
+              nnz_R,
+              (const void*&)csr_val_R,
+              (const void*&)csr_row_ptr_R,
+              (const void*&)csr_col_ind_R,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_P,
+              nnz_P,
+              (const void*&)csr_val_P,
+              (const void*&)csr_row_ptr_P,
+              (const void*&)csr_col_ind_P,
+              (const void*&)descr_C,
+              (const void*&)csr_val_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)csr_col_ind_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrrap -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ",
+              "--alpha",
+              LOG_BENCH_SCALAR_VALUE(handle, alpha));
+
+    // Check for valid rocsparse_mat_info
+    if(info_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid rocsparse_csrrap_info
+    if(info_C->csrrap_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_csrrap_info info = info_C->csrrap_info;
+
+    // Check operation
+    if(rocsparse_enum_utils::is_invalid(trans_R))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Operation must match the analysis
+    if(trans_R != info->trans_R)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_R < 0 || nnz_A < 0 || nnz_P < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_R == nullptr || csr_val_R == nullptr || csr_row_ptr_R == nullptr
+       || csr_col_ind_R == nullptr || descr_A == nullptr || csr_val_A == nullptr
+       || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr || descr_P == nullptr
+       || csr_val_P == nullptr || csr_row_ptr_P == nullptr || csr_col_ind_P == nullptr
+       || descr_C == nullptr || csr_val_C == nullptr || csr_row_ptr_C == nullptr
+       || csr_col_ind_C == nullptr || temp_buffer == nullptr || alpha == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_R == 0 || nnz_A == 0 || nnz_P == 0
+       || info->nnz_AP == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Patterns of R^T and A * P, that have been computed by rocsparse_csrrap_nnz()
+    rocsparse_int* rt_row_ptr;
+    rocsparse_int* rt_col_ind;
+    rocsparse_int* rt_perm;
+    rocsparse_int* ap_row_ptr;
+    rocsparse_int* ap_col_ind;
+
+    char* ptr = rocsparse_csrrap_buffer_index(info,
+                                              m,
+                                              k,
+                                              nnz_R,
+                                              temp_buffer,
+                                              &rt_row_ptr,
+                                              &rt_col_ind,
+                                              &rt_perm,
+                                              &ap_row_ptr,
+                                              &ap_col_ind);
+
+    // Left factor op(R)
+    const T*             val_R     = csr_val_R;
+    const rocsparse_int* row_ptr_R = csr_row_ptr_R;
+    const rocsparse_int* col_ind_R = csr_col_ind_R;
+
+    if(trans_R == rocsparse_operation_transpose)
+    {
+        T* rt_val = reinterpret_cast<T*>(ptr);
+        ptr += sizeof(T) * ((nnz_R - 1) / 256 + 1) * 256;
+
+        // Gather the values of R^T using the permutation obtained during the
+        // symbolic phase
+#define CSRRAP_DIM 512
+        hipLaunchKernelGGL((csrrap_gather_kernel<CSRRAP_DIM>),
+                           dim3((nnz_R - 1) / CSRRAP_DIM + 1),
+                           dim3(CSRRAP_DIM),
+                           0,
+                           stream,
+                           nnz_R,
+                           rt_perm,
+                           csr_val_R,
+                           rt_val);
+#undef CSRRAP_DIM
+
+        val_R     = rt_val;
+        row_ptr_R = rt_row_ptr;
+        col_ind_R = rt_col_ind;
+    }
+
+    // Values of the intermediate product A * P
+    T* ap_val = reinterpret_cast<T*>(ptr);
+
+    // Work space of both products
+    void* work_buffer = reinterpret_cast<char*>(temp_buffer) + info->work_offset;
+
+    // Scalar one, either on host or device
+    T  h_one = static_cast<T>(1);
+    T* d_one;
+    rocsparse_one(handle, &d_one);
+
+    const T* one = (handle->pointer_mode == rocsparse_pointer_mode_device) ? d_one : &h_one;
+
+    // A * P
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_template(handle,
+                                                         rocsparse_operation_none,
+                                                         rocsparse_operation_none,
+                                                         k,
+                                                         n,
+                                                         k,
+                                                         one,
+                                                         descr_A,
+                                                         nnz_A,
+                                                         csr_val_A,
+                                                         csr_row_ptr_A,
+                                                         csr_col_ind_A,
+                                                         descr_P,
+                                                         nnz_P,
+                                                         csr_val_P,
+                                                         csr_row_ptr_P,
+                                                         csr_col_ind_P,
+                                                         (const T*)nullptr,
+                                                         nullptr,
+                                                         (rocsparse_int)0,
+                                                         (const T*)nullptr,
+                                                         (const rocsparse_int*)nullptr,
+                                                         (const rocsparse_int*)nullptr,
+                                                         &info->ap_descr,
+                                                         ap_val,
+                                                         ap_row_ptr,
+                                                         ap_col_ind,
+                                                         info->ap_info,
+                                                         work_buffer));
+
+    // alpha * op(R) * (A * P)
+    return rocsparse_csrgemm_template(handle,
+                                      rocsparse_operation_none,
+                                      rocsparse_operation_none,
+                                      m,
+                                      n,
+                                      k,
+                                      alpha,
+                                      descr_R,
+                                      nnz_R,
+                                      val_R,
+                                      row_ptr_R,
+                                      col_ind_R,
+                                      &info->ap_descr,
+                                      info->nnz_AP,
+                                      (const T*)ap_val,
+                                      (const rocsparse_int*)ap_row_ptr,
+                                      (const rocsparse_int*)ap_col_ind,
+                                      (const T*)nullptr,
+                                      nullptr,
+                                      (rocsparse_int)0,
+                                      (const T*)nullptr,
+                                      (const rocsparse_int*)nullptr,
+                                      (const rocsparse_int*)nullptr,
+                                      descr_C,
+                                      csr_val_C,
+                                      csr_row_ptr_C,
+                                      csr_col_ind_C,
+                                      info->rap_info,
+                                      work_buffer);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_operation       trans_R,       \
+                                     rocsparse_int             m,             \
+                                     rocsparse_int             n,             \
+                                     rocsparse_int             k,             \
+                                     const TYPE*               alpha,         \
+                                     const rocsparse_mat_descr descr_R,       \
+                                     rocsparse_int             nnz_R,         \
+                                     const rocsparse_int*      csr_row_ptr_R, \
+                                     const rocsparse_int*      csr_col_ind_R, \
+                                     const rocsparse_mat_descr descr_A,       \
+                                     rocsparse_int             nnz_A,         \
+                                     const rocsparse_int*      csr_row_ptr_A, \
+                                     const rocsparse_int*      csr_col_ind_A, \
+                                     const rocsparse_mat_descr descr_P,       \
+                                     rocsparse_int             nnz_P,         \
+                                     const rocsparse_int*      csr_row_ptr_P, \
+                                     const rocsparse_int*      csr_col_ind_P, \
+                                     rocsparse_mat_info        info_C,        \
+                                     size_t*                   buffer_size)   \
+    {                                                                         \
+        return rocsparse_csrrap_buffer_size_template(handle,                  \
+                                                     trans_R,                 \
+                                                     m,                       \
+                                                     n,                       \
+                                                     k,                       \
+                                                     alpha,                   \
+                                                     descr_R,                 \
+                                                     nnz_R,                   \
+                                                     csr_row_ptr_R,           \
+                                                     csr_col_ind_R,           \
+                                                     descr_A,                 \
+                                                     nnz_A,                   \
+                                                     csr_row_ptr_A,           \
+                                                     csr_col_ind_A,           \
+                                                     descr_P,                 \
+                                                     nnz_P,                   \
+                                                     csr_row_ptr_P,           \
+                                                     csr_col_ind_P,           \
+                                                     info_C,                  \
+                                                     buffer_size);            \
+    }
+
+C_IMPL(rocsparse_scsrrap_buffer_size, float);
+C_IMPL(rocsparse_dcsrrap_buffer_size, double);
+C_IMPL(rocsparse_ccsrrap_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrrap_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_operation       trans_R,       \
+                                     rocsparse_int             m,             \
+                                     rocsparse_int             n,             \
+                                     rocsparse_int             k,             \
+                                     const TYPE*               alpha,         \
+                                     const rocsparse_mat_descr descr_R,       \
+                                     rocsparse_int             nnz_R,         \
+                                     const TYPE*               csr_val_R,     \
+                                     const rocsparse_int*      csr_row_ptr_R, \
+                                     const rocsparse_int*      csr_col_ind_R, \
+                                     const rocsparse_mat_descr descr_A,       \
+                                     rocsparse_int             nnz_A,         \
+                                     const TYPE*               csr_val_A,     \
+                                     const rocsparse_int*      csr_row_ptr_A, \
+                                     const rocsparse_int*      csr_col_ind_A, \
+                                     const rocsparse_mat_descr descr_P,       \
+                                     rocsparse_int             nnz_P,         \
+                                     const TYPE*               csr_val_P,     \
+                                     const rocsparse_int*      csr_row_ptr_P, \
+                                     const rocsparse_int*      csr_col_ind_P, \
+                                     const rocsparse_mat_descr descr_C,       \
+                                     TYPE*                     csr_val_C,     \
+                                     const rocsparse_int*      csr_row_ptr_C, \
+                                     rocsparse_int*            csr_col_ind_C, \
+                                     const rocsparse_mat_info  info_C,        \
+                                     void*                     temp_buffer)   \
+    {                                                                         \
+        return rocsparse_csrrap_template(handle,                              \
+                                         trans_R,                             \
+                                         m,                                   \
+                                         n,                                   \
+                                         k,                                   \
+                                         alpha,                               \
+                                         descr_R,                             \
+                                         nnz_R,                               \
+                                         csr_val_R,                           \
+                                         csr_row_ptr_R,                       \
+                                         csr_col_ind_R,                       \
+                                         descr_A,                             \
+                                         nnz_A,                               \
+                                         csr_val_A,                           \
+                                         csr_row_ptr_A,                       \
+                                         csr_col_ind_A,                       \
+                                         descr_P,                             \
+                                         nnz_P,                               \
+                                         csr_val_P,                           \
+                                         csr_row_ptr_P,                       \
+                                         csr_col_ind_P,                       \
+                                         descr_C,                             \
+                                         csr_val_C,                           \
+                                         csr_row_ptr_C,                       \
+                                         csr_col_ind_C,                       \
+                                         info_C,                              \
+                                         temp_buffer);                        \
+    }
+
+C_IMPL(rocsparse_scsrrap, float);
+C_IMPL(rocsparse_dcsrrap, double);
+C_IMPL(rocsparse_ccsrrap, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrrap, rocsparse_double_complex);
+
+#undef C_IMPL
+
+//
+// rocsparse_csrrap_nnz
+//
+extern "C" rocsparse_status rocsparse_csrrap_nnz(rocsparse_handle          handle,
+                                                 rocsparse_operation       trans_R,
+                                                 rocsparse_int             m,
+                                                 rocsparse_int             n,
+                                                 rocsparse_int             k,
+                                                 const rocsparse_mat_descr descr_R,
+                                                 rocsparse_int             nnz_R,
+                                                 const rocsparse_int*      csr_row_ptr_R,
+                                                 const rocsparse_int*      csr_col_ind_R,
+                                                 const rocsparse_mat_descr descr_A,
+                                                 rocsparse_int             nnz_A,
+                                                 const rocsparse_int*      csr_row_ptr_A,
+                                                 const rocsparse_int*      csr_col_ind_A,
+                                                 const rocsparse_mat_descr descr_P,
+                                                 rocsparse_int             nnz_P,
+                                                 const rocsparse_int*      csr_row_ptr_P,
+                                                 const rocsparse_int*      csr_col_ind_P,
+                                                 const rocsparse_mat_descr descr_C,
+                                                 rocsparse_int*            csr_row_ptr_C,
+                                                 rocsparse_int*            nnz_C,
+                                                 const rocsparse_mat_info  info_C,
+                                                 void*                     temp_buffer)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrap_nnz",
+              trans_R,
+              m,
+              n,
+              k,
+              (const void*&)descr_R,
+              nnz_R,
+              (const void*&)csr_row_ptr_R,
+              (const void*&)csr_col_ind_R,
+              (const void*&)descr_A,
+              nnz_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_P,
+              nnz_P,
+              (const void*&)csr_row_ptr_P,
+              (const void*&)csr_col_ind_P,
+              (const void*&)descr_C,
+              (const void*&)csr_row_ptr_C,
+              (const void*&)nnz_C,
+              (const void*&)info_C,
+              (const void*&)temp_buffer);
+
+    // Check for valid rocsparse_mat_info
+    if(info_C == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for valid rocsparse_csrrap_info
+    if(info_C->csrrap_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_csrrap_info info = info_C->csrrap_info;
+
+    // Check operation
+    if(rocsparse_enum_utils::is_invalid(trans_R))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Operation must match the buffer size query
+    if(trans_R != info->trans_R)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check valid sizes
+    if(m < 0 || n < 0 || k < 0 || nnz_R < 0 || nnz_A < 0 || nnz_P < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check valid pointers
+    if(descr_R == nullptr || csr_row_ptr_R == nullptr || csr_col_ind_R == nullptr
+       || descr_A == nullptr || csr_row_ptr_A == nullptr || csr_col_ind_A == nullptr
+       || descr_P == nullptr || csr_row_ptr_P == nullptr || csr_col_ind_P == nullptr
+       || descr_C == nullptr || csr_row_ptr_C == nullptr || nnz_C == nullptr
+       || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check index base
+    if(descr_R->base != rocsparse_index_base_zero && descr_R->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_C->base != rocsparse_index_base_zero && descr_C->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check matrix type
+    if(descr_C->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Clear data of a previous symbolic phase
+    info->nnz_AP = 0;
+
+    // Quick return if possible
+    if(m == 0 || n == 0 || k == 0 || nnz_R == 0 || nnz_A == 0 || nnz_P == 0)
+    {
+        if(m > 0)
+        {
+#define CSRRAP_DIM 512
+            hipLaunchKernelGGL((csrrap_set_base_kernel<CSRRAP_DIM>),
+                               dim3(m / CSRRAP_DIM + 1),
+                               dim3(CSRRAP_DIM),
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr_C,
+                               descr_C->base);
+#undef CSRRAP_DIM
+        }
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Patterns of R^T and A * P
+    rocsparse_int* rt_row_ptr;
+    rocsparse_int* rt_col_ind;
+    rocsparse_int* rt_perm;
+    rocsparse_int* ap_row_ptr;
+    rocsparse_int* ap_col_ind;
+
+    rocsparse_csrrap_buffer_index(info,
+                                  m,
+                                  k,
+                                  nnz_R,
+                                  temp_buffer,
+                                  &rt_row_ptr,
+                                  &rt_col_ind,
+                                  &rt_perm,
+                                  &ap_row_ptr,
+                                  &ap_col_ind);
+
+    // Work space of both products and of the transposition
+    void* work_buffer = reinterpret_cast<char*>(temp_buffer) + info->work_offset;
+
+    // Left factor op(R)
+    const rocsparse_int* row_ptr_R = csr_row_ptr_R;
+    const rocsparse_int* col_ind_R = csr_col_ind_R;
+
+    // Build the pattern of R^T, R is of dimension k x m
+    if(trans_R == rocsparse_operation_transpose)
+    {
+        unsigned int startbit = 0;
+        unsigned int endbit   = rocsparse_clz(m);
+
+        // Temporary buffer entry points
+        char* ptr = reinterpret_cast<char*>(work_buffer);
+
+        rocsparse_int* tmp_key1 = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += sizeof(rocsparse_int) * ((nnz_R - 1) / 256 + 1) * 256;
+
+        rocsparse_int* tmp_key2 = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += sizeof(rocsparse_int) * ((nnz_R - 1) / 256 + 1) * 256;
+
+        rocsparse_int* tmp_perm1 = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += sizeof(rocsparse_int) * ((nnz_R - 1) / 256 + 1) * 256;
+
+        rocsparse_int* tmp_perm2 = reinterpret_cast<rocsparse_int*>(ptr);
+        ptr += sizeof(rocsparse_int) * ((nnz_R - 1) / 256 + 1) * 256;
+
+        void* tmp_rocprim = reinterpret_cast<void*>(ptr);
+
+        // Stable sort the entries of R by column, keeping track of their position
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(tmp_key1,
+                                           csr_col_ind_R,
+                                           sizeof(rocsparse_int) * nnz_R,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, nnz_R, tmp_perm1));
+
+        rocprim::double_buffer<rocsparse_int> keys(tmp_key1, tmp_key2);
+        rocprim::double_buffer<rocsparse_int> vals(tmp_perm1, tmp_perm2);
+
+        size_t size = 0;
+
+        RETURN_IF_HIP_ERROR(
+            rocprim::radix_sort_pairs(nullptr, size, keys, vals, nnz_R, startbit, endbit, stream));
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+            tmp_rocprim, size, keys, vals, nnz_R, startbit, endbit, stream));
+
+        // Row pointers of R^T
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_coo2csr(handle, keys.current(), nnz_R, m, rt_row_ptr, descr_R->base));
+
+        // Row indices of R, become the column indices of R^T
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csr2coo(handle, csr_row_ptr_R, nnz_R, k, keys.alternate(), descr_R->base));
+
+#define CSRRAP_DIM 512
+        hipLaunchKernelGGL((csrrap_transpose_kernel<CSRRAP_DIM>),
+                           dim3((nnz_R - 1) / CSRRAP_DIM + 1),
+                           dim3(CSRRAP_DIM),
+                           0,
+                           stream,
+                           nnz_R,
+                           vals.current(),
+                           keys.alternate(),
+                           rt_perm,
+                           rt_col_ind);
+#undef CSRRAP_DIM
+
+        row_ptr_R = rt_row_ptr;
+        col_ind_R = rt_col_ind;
+    }
+
+    // Symbolic product A * P, stored with zero based indexing. The non-zero count is
+    // also written to the device when in device pointer mode
+    rocsparse_int* nnz_AP = (handle->pointer_mode == rocsparse_pointer_mode_device)
+                                ? reinterpret_cast<rocsparse_int*>(handle->buffer)
+                                : &info->nnz_AP;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrgemm_nnz_template(handle,
+                                                             rocsparse_operation_none,
+                                                             rocsparse_operation_none,
+                                                             k,
+                                                             n,
+                                                             k,
+                                                             descr_A,
+                                                             nnz_A,
+                                                             csr_row_ptr_A,
+                                                             csr_col_ind_A,
+                                                             descr_P,
+                                                             nnz_P,
+                                                             csr_row_ptr_P,
+                                                             csr_col_ind_P,
+                                                             nullptr,
+                                                             (rocsparse_int)0,
+                                                             (const rocsparse_int*)nullptr,
+                                                             (const rocsparse_int*)nullptr,
+                                                             &info->ap_descr,
+                                                             ap_row_ptr,
+                                                             nnz_AP,
+                                                             info->ap_info,
+                                                             work_buffer));
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &info->nnz_AP, ap_row_ptr + k, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // A * P is structurally zero, and so is C
+    if(info->nnz_AP == 0)
+    {
+#define CSRRAP_DIM 512
+        hipLaunchKernelGGL((csrrap_set_base_kernel<CSRRAP_DIM>),
+                           dim3(m / CSRRAP_DIM + 1),
+                           dim3(CSRRAP_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr_C,
+                           descr_C->base);
+#undef CSRRAP_DIM
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_C, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_C = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Column indices of A * P. Only the sparsity pattern is computed, no values are read,
+    // such that the symbolic phase does not depend on the data type.
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrgemm_symbolic_template(handle,
+                                            k,
+                                            n,
+                                            k,
+                                            descr_A,
+                                            nnz_A,
+                                            csr_row_ptr_A,
+                                            csr_col_ind_A,
+                                            descr_P,
+                                            nnz_P,
+                                            csr_row_ptr_P,
+                                            csr_col_ind_P,
+                                            &info->ap_descr,
+                                            (const rocsparse_int*)ap_row_ptr,
+                                            ap_col_ind,
+                                            info->ap_info,
+                                            work_buffer));
+
+    // Symbolic product op(R) * (A * P)
+    return rocsparse_csrgemm_nnz_template(handle,
+                                          rocsparse_operation_none,
+                                          rocsparse_operation_none,
+                                          m,
+                                          n,
+                                          k,
+                                          descr_R,
+                                          nnz_R,
+                                          row_ptr_R,
+                                          col_ind_R,
+                                          &info->ap_descr,
+                                          info->nnz_AP,
+                                          (const rocsparse_int*)ap_row_ptr,
+                                          (const rocsparse_int*)ap_col_ind,
+                                          nullptr,
+                                          (rocsparse_int)0,
+                                          (const rocsparse_int*)nullptr,
+                                          (const rocsparse_int*)nullptr,
+                                          descr_C,
+                                          csr_row_ptr_C,
+                                          nnz_C,
+                                          info->rap_info,
+                                          work_buffer);
+}
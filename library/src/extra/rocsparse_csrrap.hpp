@@ -0,0 +1,82 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef ROCSPARSE_CSRRAP_HPP
+#define ROCSPARSE_CSRRAP_HPP
+
+#include "handle.h"
+
+template <typename T>
+rocsparse_status rocsparse_csrrap_buffer_size_template(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans_R,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             n,
+                                                       rocsparse_int             k,
+                                                       const T*                  alpha,
+                                                       const rocsparse_mat_descr descr_R,
+                                                       rocsparse_int             nnz_R,
+                                                       const rocsparse_int*      csr_row_ptr_R,
+                                                       const rocsparse_int*      csr_col_ind_R,
+                                                       const rocsparse_mat_descr descr_A,
+                                                       rocsparse_int             nnz_A,
+                                                       const rocsparse_int*      csr_row_ptr_A,
+                                                       const rocsparse_int*      csr_col_ind_A,
+                                                       const rocsparse_mat_descr descr_P,
+                                                       rocsparse_int             nnz_P,
+                                                       const rocsparse_int*      csr_row_ptr_P,
+                                                       const rocsparse_int*      csr_col_ind_P,
+                                                       rocsparse_mat_info        info_C,
+                                                       size_t*                   buffer_size);
+
+template <typename T>
+rocsparse_status rocsparse_csrrap_template(rocsparse_handle          handle,
+                                           rocsparse_operation       trans_R,
+                                           rocsparse_int             m,
+                                           rocsparse_int             n,
+                                           rocsparse_int             k,
+                                           const T*                  alpha,
+                                           const rocsparse_mat_descr descr_R,
+                                           rocsparse_int             nnz_R,
+                                           const T*                  csr_val_R,
+                                           const rocsparse_int*      csr_row_ptr_R,
+                                           const rocsparse_int*      csr_col_ind_R,
+                                           const rocsparse_mat_descr descr_A,
+                                           rocsparse_int             nnz_A,
+                                           const T*                  csr_val_A,
+                                           const rocsparse_int*      csr_row_ptr_A,
+                                           const rocsparse_int*      csr_col_ind_A,
+                                           const rocsparse_mat_descr descr_P,
+                                           rocsparse_int             nnz_P,
+                                           const T*                  csr_val_P,
+                                           const rocsparse_int*      csr_row_ptr_P,
+                                           const rocsparse_int*      csr_col_ind_P,
+                                           const rocsparse_mat_descr descr_C,
+                                           T*                        csr_val_C,
+                                           const rocsparse_int*      csr_row_ptr_C,
+                                           rocsparse_int*            csr_col_ind_C,
+                                           const rocsparse_mat_info  info_C,
+                                           void*                     temp_buffer);
+
+#endif // ROCSPARSE_CSRRAP_HPP
@@ -87,6 +87,11 @@ rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
                                            size_t*                     buffer_size,
                                            void*                       temp_buffer)
 {
+    // Dimensions of op(A) and op(B)
+    J m = (J)((trans_A == rocsparse_operation_none) ? A->rows : A->cols);
+    J n = (J)((trans_B == rocsparse_operation_none) ? B->cols : B->rows);
+    J k = (J)((trans_A == rocsparse_operation_none) ? A->cols : A->rows);
+
     // STAGE 1 - compute required buffer size of temp_buffer
     if(stage == rocsparse_spgemm_stage_buffer_size
        || (stage == rocsparse_spgemm_stage_auto && temp_buffer == nullptr))
@@ -97,9 +102,9 @@ rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
             return rocsparse_csrgemm_buffer_size_template(handle,
                                                           trans_A,
                                                           trans_B,
-                                                          (J)A->rows,
-                                                          (J)B->cols,
-                                                          (J)A->cols,
+                                                          m,
+                                                          n,
+                                                          k,
                                                           (const T*)alpha,
                                                           A->descr,
                                                           (I)A->nnz,
@@ -138,9 +143,9 @@ rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
             rocsparse_status status = rocsparse_csrgemm_nnz_template(handle,
                                                                      trans_A,
                                                                      trans_B,
-                                                                     (J)A->rows,
-                                                                     (J)B->cols,
-                                                                     (J)A->cols,
+                                                                     m,
+                                                                     n,
+                                                                     k,
                                                                      A->descr,
                                                                      (I)A->nnz,
                                                                      (const I*)A->row_data,
@@ -178,9 +183,9 @@ rocsparse_status rocsparse_spgemm_template(rocsparse_handle            handle,
             return rocsparse_csrgemm_template(handle,
                                               trans_A,
                                               trans_B,
-                                              (J)A->rows,
-                                              (J)B->cols,
-                                              (J)A->cols,
+                                              m,
+                                              n,
+                                              k,
                                               (const T*)alpha,
                                               A->descr,
                                               (I)A->nnz,
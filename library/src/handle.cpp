@@ -287,6 +287,12 @@ rocsparse_status rocsparse_destroy_trm_info(rocsparse_trm_info info)
         info->trmt_col_ind = nullptr;
     }
 
+    if(info->trmt_dep_count != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->trmt_dep_count));
+        info->trmt_dep_count = nullptr;
+    }
+
     // Destruct
     try
     {
@@ -340,10 +346,64 @@ bool rocsparse_check_trm_shared(const rocsparse_mat_info info, rocsparse_trm_inf
         ++shared;
     if(trm == info->csrsm_upper_info)
         ++shared;
+    if(trm == info->csrsmt_lower_info)
+        ++shared;
+    if(trm == info->csrsmt_upper_info)
+        ++shared;
 
     return (shared > 0) ? true : false;
 }
 
+/********************************************************************************
+ * \brief rocsparse_trm_pattern_match checks if the given trm info structure has
+ * been gathered for a sparsity pattern with the given fingerprint.
+ *******************************************************************************/
+bool rocsparse_trm_pattern_match(rocsparse_trm_info trm,
+                                 rocsparse_int      m,
+                                 rocsparse_int      nnz,
+                                 unsigned long long pattern_hash)
+{
+    if(trm == nullptr)
+    {
+        return false;
+    }
+
+    return trm->m == m && trm->nnz == nnz && trm->pattern_hash == pattern_hash;
+}
+
+/********************************************************************************
+ * \brief rocsparse_trm_use_level_set decides whether the triangular solve should
+ * process the given trm info level by level, or using the sync-free scheme.
+ *******************************************************************************/
+bool rocsparse_trm_use_level_set(rocsparse_handle       handle,
+                                 rocsparse_trm_info     trm,
+                                 rocsparse_solve_policy policy)
+{
+    // Level information is required
+    if(trm == nullptr || trm->nlevels == 0
+       || trm->level_ptr.size() != static_cast<size_t>(trm->nlevels) + 1)
+    {
+        return false;
+    }
+
+    if(policy == rocsparse_solve_policy_sync_free)
+    {
+        return false;
+    }
+
+    if(policy == rocsparse_solve_policy_level_set)
+    {
+        return true;
+    }
+
+    // Each level requires its own kernel launch. This only pays off, if the
+    // average level is wide enough to keep all compute units busy with a few
+    // wavefronts each, such that no wavefront has to spin on its dependencies.
+    rocsparse_int avg_width = trm->m / trm->nlevels;
+
+    return avg_width >= 4 * handle->properties.multiProcessorCount;
+}
+
 /********************************************************************************
  * \brief rocsparse_csrgemm_info is a structure holding the rocsparse csrgemm
  * info data gathered during csrgemm_buffer_size. It must be initialized using
@@ -381,6 +441,139 @@ rocsparse_status rocsparse_destroy_csrgemm_info(rocsparse_csrgemm_info info)
         return rocsparse_status_success;
     }
 
+    // Clear row grouping and workspace
+    if(info->plan_buffer != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->plan_buffer));
+        info->plan_buffer = nullptr;
+    }
+
+    if(info->workspace != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->workspace));
+        info->workspace = nullptr;
+    }
+
+    if(info->esc_buffer != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->esc_buffer));
+        info->esc_buffer = nullptr;
+    }
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csrrap_info is a structure holding the rocsparse csrrap
+ * info data gathered during csrrap_buffer_size and csrrap_nnz. It must be
+ * initialized using the rocsparse_create_csrrap_info() routine. It should be
+ * destroyed at the end using rocsparse_destroy_csrrap_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrrap_info(rocsparse_csrrap_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csrrap_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy csrrap info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrrap_info(rocsparse_csrrap_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Clear csrgemm meta data
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(info->ap_info));
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(info->rap_info));
+
+    // Destruct
+    try
+    {
+        delete info;
+    }
+    catch(const rocsparse_status& status)
+    {
+        return status;
+    }
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief rocsparse_csriluk_info is a structure holding the level of fill pattern
+ * that has been computed by csriluk_nnz. It must be initialized using the
+ * rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csriluk_info(rocsparse_csriluk_info* info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else
+    {
+        // Allocate
+        try
+        {
+            *info = new _rocsparse_csriluk_info;
+        }
+        catch(const rocsparse_status& status)
+        {
+            return status;
+        }
+        return rocsparse_status_success;
+    }
+}
+
+/********************************************************************************
+ * \brief Destroy csriluk info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csriluk_info(rocsparse_csriluk_info info)
+{
+    if(info == nullptr)
+    {
+        return rocsparse_status_success;
+    }
+
+    if(info->lu_row_ptr != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->lu_row_ptr));
+        info->lu_row_ptr = nullptr;
+    }
+
+    if(info->lu_col_ind != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(info->lu_col_ind));
+        info->lu_col_ind = nullptr;
+    }
+
     // Destruct
     try
     {
@@ -31,12 +31,15 @@
 #include <fstream>
 #include <hip/hip_runtime_api.h>
 #include <iostream>
+#include <limits>
 #include <vector>
 
 /*! \brief typedefs to opaque info structs */
 typedef struct _rocsparse_trm_info*     rocsparse_trm_info;
 typedef struct _rocsparse_csrmv_info*   rocsparse_csrmv_info;
 typedef struct _rocsparse_csrgemm_info* rocsparse_csrgemm_info;
+typedef struct _rocsparse_csrrap_info*  rocsparse_csrrap_info;
+typedef struct _rocsparse_csriluk_info* rocsparse_csriluk_info;
 
 /********************************************************************************
  * \brief rocsparse_handle is a structure holding the rocsparse library context.
@@ -74,6 +77,8 @@ struct _rocsparse_handle
     // device buffer
     size_t buffer_size;
     void*  buffer;
+    // device memory budget for persistent meta data
+    size_t memory_budget = std::numeric_limits<size_t>::max();
     // device one
     float*  sone;
     double* done;
@@ -166,6 +171,8 @@ struct _rocsparse_mat_info
     rocsparse_trm_info     csrsmt_upper_info = nullptr;
     rocsparse_trm_info     csrsmt_lower_info = nullptr;
     rocsparse_csrgemm_info csrgemm_info      = nullptr;
+    rocsparse_csrrap_info  csrrap_info       = nullptr;
+    rocsparse_csriluk_info csriluk_info      = nullptr;
 
     // zero pivot for csrsv, csrsm, csrilu0, csric0
     rocsparse_int* zero_pivot = nullptr;
@@ -175,6 +182,9 @@ struct _rocsparse_mat_info
     int         use_double_prec_tol = 0;
     const void* boost_tol           = nullptr;
     const void* boost_val           = nullptr;
+
+    // number of jacobi sweeps for approximate csrsv (0 = exact solve)
+    rocsparse_int csrsv_nsweeps = 0;
 };
 
 /********************************************************************************
@@ -226,6 +236,17 @@ struct _rocsparse_trm_info
     rocsparse_int* trmt_perm    = nullptr;
     rocsparse_int* trmt_row_ptr = nullptr;
     rocsparse_int* trmt_col_ind = nullptr;
+    // device array to hold the number of dependencies of each row of the transposed
+    // matrix, if the transposed solve operates on the original matrix instead
+    int* trmt_dep_count = nullptr;
+
+    // number of levels in the dependency graph
+    rocsparse_int nlevels = 0;
+    // host array to hold the first position of each level in row_map (nlevels + 1)
+    std::vector<rocsparse_int> level_ptr;
+
+    // fingerprint of the sparsity pattern that has been analyzed
+    unsigned long long pattern_hash = 0;
 
     // some data to verify correct execution
     rocsparse_int               m;
@@ -255,6 +276,26 @@ rocsparse_status rocsparse_destroy_trm_info(rocsparse_trm_info info);
  *******************************************************************************/
 bool rocsparse_check_trm_shared(const rocsparse_mat_info info, rocsparse_trm_info trm);
 
+/********************************************************************************
+ * \brief rocsparse_trm_pattern_match checks if the given trm info structure has
+ * been gathered for a sparsity pattern with the given fingerprint.
+ *******************************************************************************/
+bool rocsparse_trm_pattern_match(rocsparse_trm_info trm,
+                                 rocsparse_int      m,
+                                 rocsparse_int      nnz,
+                                 unsigned long long pattern_hash);
+
+/********************************************************************************
+ * \brief rocsparse_trm_use_level_set decides whether the triangular solve should
+ * process the given trm info level by level, or using the sync-free scheme.
+ *******************************************************************************/
+bool rocsparse_trm_use_level_set(rocsparse_handle       handle,
+                                 rocsparse_trm_info     trm,
+                                 rocsparse_solve_policy policy);
+
+// Number of row groups of C in csrgemm, grouped by their number of non-zero entries
+#define CSRGEMM_MAXGROUPS 8
+
 /********************************************************************************
  * \brief rocsparse_csrgemm_info is a structure holding the rocsparse csrgemm
  * info data gathered during csrgemm_buffer_size. It must be initialized using
@@ -267,6 +308,53 @@ struct _rocsparse_csrgemm_info
     bool mul = true;
     // Perform beta * D
     bool add = true;
+
+    // Row grouping of C, computed by the first numerical phase and re-used by
+    // subsequent calls as long as the sparsity pattern of C does not change. It is
+    // not kept if plan_keep is false, e.g. for the panels of a chunked product.
+    bool        plan_keep           = true;
+    bool        plan_valid          = false;
+    int64_t     plan_m              = 0;
+    size_t      plan_index_size     = 0;
+    const void* plan_row_ptr_C      = nullptr;
+    bool        plan_exceeding_smem = false;
+    int64_t     plan_group_size[CSRGEMM_MAXGROUPS];
+    bool        plan_use_perm = false;
+
+    // Device storage for group offsets, followed by the row permutation
+    void*  plan_buffer       = nullptr;
+    size_t plan_buffer_bytes = 0;
+
+    // Device workspace of the multipass kernel
+    void*  workspace       = nullptr;
+    size_t workspace_bytes = 0;
+
+    // Expand-sort-compress path for the heaviest row group. Its decision and the number
+    // of expanded entries are part of the row grouping. The device workspace starts with
+    // the expanded row offsets and is kept between calls.
+    bool    plan_esc_valid     = false;
+    bool    plan_esc_processed = false;
+    int64_t plan_esc_nnz       = 0;
+
+    void*  esc_buffer       = nullptr;
+    size_t esc_buffer_bytes = 0;
+
+    // Offset of the work space of the non-transposed product in the temporary buffer, if
+    // op(A) = A^T or op(B) = B^T. The transposed sparsity patterns of A and B, including
+    // the permutation into their values, are kept in front of it by the symbolic phase,
+    // followed by the values gathered by the numerical phase. The patterns are valid once
+    // computed by the symbolic phase.
+    size_t trans_offset = 0;
+    bool   trans_valid  = false;
+
+    // Structural mask of C, only set during masked csrgemm
+    const void*          mask_row_ptr    = nullptr;
+    const void*          mask_col_ind    = nullptr;
+    rocsparse_index_base mask_base       = rocsparse_index_base_zero;
+    bool                 mask_complement = false;
+
+    // Triangle C is restricted to, only set if C is symmetric: upper (> 0) or lower (< 0)
+    int mask_triangle = 0;
 };
 
 /********************************************************************************
@@ -282,6 +370,87 @@ rocsparse_status rocsparse_create_csrgemm_info(rocsparse_csrgemm_info* info);
  *******************************************************************************/
 rocsparse_status rocsparse_destroy_csrgemm_info(rocsparse_csrgemm_info info);
 
+/********************************************************************************
+ * \brief rocsparse_csrrap_info is a structure holding the rocsparse csrrap
+ * info data gathered during csrrap_buffer_size and csrrap_nnz. It describes the
+ * sparsity pattern of the intermediate product A * P and, if required, the
+ * transposed pattern of R, that are kept in the temporary storage buffer, such that
+ * the numerical phase can be repeated for changing values. It must be initialized
+ * using the rocsparse_create_csrrap_info() routine. It should be destroyed at the
+ * end using rocsparse_destroy_csrrap_info().
+ *******************************************************************************/
+struct _rocsparse_csrrap_info
+{
+    // operation on R
+    rocsparse_operation trans_R = rocsparse_operation_none;
+
+    // csrgemm meta data of A * P and of op(R) * (A * P)
+    rocsparse_mat_info ap_info  = nullptr;
+    rocsparse_mat_info rap_info = nullptr;
+
+    // descriptor of the intermediate product A * P (zero based)
+    _rocsparse_mat_descr ap_descr;
+
+    // intermediate product A * P, its upper bound of non-zero entries sizes the
+    // temporary storage buffer
+    rocsparse_int nnz_AP     = 0;
+    rocsparse_int nnz_AP_max = 0;
+
+    // offset in bytes of the csrgemm work space within the temporary storage buffer
+    size_t work_offset = 0;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csrrap_info is a structure holding the rocsparse csrrap
+ * info data gathered during csrrap_buffer_size and csrrap_nnz. It must be
+ * initialized using the rocsparse_create_csrrap_info() routine. It should be
+ * destroyed at the end using rocsparse_destroy_csrrap_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csrrap_info(rocsparse_csrrap_info* info);
+
+/********************************************************************************
+ * \brief Destroy csrrap info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csrrap_info(rocsparse_csrrap_info info);
+
+/********************************************************************************
+ * \brief rocsparse_csriluk_info is a structure holding the level of fill pattern
+ * that has been computed on the device by csriluk_nnz, such that csriluk_symbolic
+ * does not need to repeat the symbolic factorization. It must be initialized using
+ * the rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
+ *******************************************************************************/
+struct _rocsparse_csriluk_info
+{
+    // set by csriluk_nnz and cleared by csriluk_symbolic, once the pattern has been
+    // consumed
+    bool pattern_ready = false;
+
+    // parameters the pattern has been computed for
+    rocsparse_int        m             = 0;
+    rocsparse_int        nnz           = 0;
+    rocsparse_int        level_of_fill = 0;
+    rocsparse_index_base base          = rocsparse_index_base_zero;
+
+    // row pointers and column indices of the pattern (zero based, device memory)
+    rocsparse_int  nnz_lu     = 0;
+    rocsparse_int* lu_row_ptr = nullptr;
+    rocsparse_int* lu_col_ind = nullptr;
+};
+
+/********************************************************************************
+ * \brief rocsparse_csriluk_info is a structure holding the level of fill pattern
+ * that has been computed by csriluk_nnz. It must be initialized using the
+ * rocsparse_create_csriluk_info() routine. It should be destroyed at the end
+ * using rocsparse_destroy_csriluk_info().
+ *******************************************************************************/
+rocsparse_status rocsparse_create_csriluk_info(rocsparse_csriluk_info* info);
+
+/********************************************************************************
+ * \brief Destroy csriluk info.
+ *******************************************************************************/
+rocsparse_status rocsparse_destroy_csriluk_info(rocsparse_csriluk_info info);
+
 /********************************************************************************
  * \brief ELL format indexing
  *******************************************************************************/
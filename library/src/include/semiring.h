@@ -0,0 +1,262 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef SEMIRING_H
+#define SEMIRING_H
+
+#include "common.h"
+
+#include <limits>
+
+// Semiring operations (add, mul) together with the identity of add (zero) and of
+// mul (one). Each semiring also provides the fused update add(mul(a, b), c), a
+// wavefront reduction and an atomic update with respect to add.
+template <rocsparse_semiring SEMIRING, typename T>
+struct rocsparse_semiring_ops;
+
+// Atomic update of a 32 bit floating point value with respect to the add of a semiring
+template <typename OPS>
+static __device__ __forceinline__ void rocsparse_atomic_semiring_add(float* ptr, float val)
+{
+    unsigned int* address = reinterpret_cast<unsigned int*>(ptr);
+    unsigned int  old     = *address;
+    unsigned int  assumed;
+
+    do
+    {
+        assumed = old;
+        old     = atomicCAS(
+            address, assumed, __float_as_uint(OPS::add(__uint_as_float(assumed), val)));
+    } while(assumed != old);
+}
+
+// Atomic update of a 64 bit floating point value with respect to the add of a semiring
+template <typename OPS>
+static __device__ __forceinline__ void rocsparse_atomic_semiring_add(double* ptr, double val)
+{
+    unsigned long long* address = reinterpret_cast<unsigned long long*>(ptr);
+    unsigned long long  old     = *address;
+    unsigned long long  assumed;
+
+    do
+    {
+        assumed = old;
+        old     = atomicCAS(address,
+                            assumed,
+                            __double_as_longlong(OPS::add(__longlong_as_double(assumed), val)));
+    } while(assumed != old);
+}
+
+// Wavefront reduction with respect to the add of a semiring
+template <unsigned int WFSIZE, typename OPS, typename T>
+static __device__ __forceinline__ T rocsparse_wfreduce_semiring(T val)
+{
+    for(unsigned int i = WFSIZE >> 1; i > 0; i >>= 1)
+    {
+        val = OPS::add(val, __shfl_xor(val, i));
+    }
+
+    return val;
+}
+
+// (+, x)
+template <typename T>
+struct rocsparse_semiring_ops<rocsparse_semiring_plus_times, T>
+{
+    static __device__ __forceinline__ T zero()
+    {
+        return static_cast<T>(0);
+    }
+    static __device__ __forceinline__ T one()
+    {
+        return static_cast<T>(1);
+    }
+    static __device__ __forceinline__ T add(T a, T b)
+    {
+        return a + b;
+    }
+    static __device__ __forceinline__ T mul(T a, T b)
+    {
+        return a * b;
+    }
+    static __device__ __forceinline__ T fma(T a, T b, T c)
+    {
+        return rocsparse_fma(a, b, c);
+    }
+    template <unsigned int WFSIZE>
+    static __device__ __forceinline__ T wfreduce(T val)
+    {
+        return rocsparse_wfreduce_sum<WFSIZE>(val);
+    }
+    static __device__ __forceinline__ void atomic_add(T* ptr, T val)
+    {
+        atomicAdd(ptr, val);
+    }
+};
+
+// (min, +)
+template <typename T>
+struct rocsparse_semiring_ops<rocsparse_semiring_min_plus, T>
+{
+    static __device__ __forceinline__ T zero()
+    {
+        return std::numeric_limits<T>::infinity();
+    }
+    static __device__ __forceinline__ T one()
+    {
+        return static_cast<T>(0);
+    }
+    static __device__ __forceinline__ T add(T a, T b)
+    {
+        return (b < a) ? b : a;
+    }
+    static __device__ __forceinline__ T mul(T a, T b)
+    {
+        return a + b;
+    }
+    static __device__ __forceinline__ T fma(T a, T b, T c)
+    {
+        return add(mul(a, b), c);
+    }
+    template <unsigned int WFSIZE>
+    static __device__ __forceinline__ T wfreduce(T val)
+    {
+        return rocsparse_wfreduce_semiring<WFSIZE, rocsparse_semiring_ops>(val);
+    }
+    static __device__ __forceinline__ void atomic_add(T* ptr, T val)
+    {
+        rocsparse_atomic_semiring_add<rocsparse_semiring_ops>(ptr, val);
+    }
+};
+
+// (max, x)
+template <typename T>
+struct rocsparse_semiring_ops<rocsparse_semiring_max_times, T>
+{
+    static __device__ __forceinline__ T zero()
+    {
+        return -std::numeric_limits<T>::infinity();
+    }
+    static __device__ __forceinline__ T one()
+    {
+        return static_cast<T>(1);
+    }
+    static __device__ __forceinline__ T add(T a, T b)
+    {
+        return (b > a) ? b : a;
+    }
+    static __device__ __forceinline__ T mul(T a, T b)
+    {
+        return a * b;
+    }
+    static __device__ __forceinline__ T fma(T a, T b, T c)
+    {
+        return add(mul(a, b), c);
+    }
+    template <unsigned int WFSIZE>
+    static __device__ __forceinline__ T wfreduce(T val)
+    {
+        return rocsparse_wfreduce_semiring<WFSIZE, rocsparse_semiring_ops>(val);
+    }
+    static __device__ __forceinline__ void atomic_add(T* ptr, T val)
+    {
+        rocsparse_atomic_semiring_add<rocsparse_semiring_ops>(ptr, val);
+    }
+};
+
+// (or, and), where any non-zero value is true
+template <typename T>
+struct rocsparse_semiring_ops<rocsparse_semiring_or_and, T>
+{
+    static __device__ __forceinline__ T zero()
+    {
+        return static_cast<T>(0);
+    }
+    static __device__ __forceinline__ T one()
+    {
+        return static_cast<T>(1);
+    }
+    static __device__ __forceinline__ T add(T a, T b)
+    {
+        return (a != static_cast<T>(0) || b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    }
+    static __device__ __forceinline__ T mul(T a, T b)
+    {
+        return (a != static_cast<T>(0) && b != static_cast<T>(0)) ? static_cast<T>(1)
+                                                                  : static_cast<T>(0);
+    }
+    static __device__ __forceinline__ T fma(T a, T b, T c)
+    {
+        return add(mul(a, b), c);
+    }
+    template <unsigned int WFSIZE>
+    static __device__ __forceinline__ T wfreduce(T val)
+    {
+        return rocsparse_wfreduce_semiring<WFSIZE, rocsparse_semiring_ops>(val);
+    }
+    static __device__ __forceinline__ void atomic_add(T* ptr, T val)
+    {
+        rocsparse_atomic_semiring_add<rocsparse_semiring_ops>(ptr, val);
+    }
+};
+
+// (+, pair), where each product contributes one, i.e. the result counts the
+// structural products
+template <typename T>
+struct rocsparse_semiring_ops<rocsparse_semiring_plus_pair, T>
+{
+    static __device__ __forceinline__ T zero()
+    {
+        return static_cast<T>(0);
+    }
+    static __device__ __forceinline__ T one()
+    {
+        return static_cast<T>(1);
+    }
+    static __device__ __forceinline__ T add(T a, T b)
+    {
+        return a + b;
+    }
+    static __device__ __forceinline__ T mul(T a, T b)
+    {
+        return static_cast<T>(1);
+    }
+    static __device__ __forceinline__ T fma(T a, T b, T c)
+    {
+        return c + static_cast<T>(1);
+    }
+    template <unsigned int WFSIZE>
+    static __device__ __forceinline__ T wfreduce(T val)
+    {
+        return rocsparse_wfreduce_sum<WFSIZE>(val);
+    }
+    static __device__ __forceinline__ void atomic_add(T* ptr, T val)
+    {
+        atomicAdd(ptr, val);
+    }
+};
+
+#endif // SEMIRING_H
@@ -370,12 +370,92 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_sddmm_alg value_)
     return true;
 };
 
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_gtsv_interleaved_alg value_)
+{
+    switch(value_)
+    {
+    case rocsparse_gtsv_interleaved_alg_default:
+    case rocsparse_gtsv_interleaved_alg_thomas:
+    case rocsparse_gtsv_interleaved_alg_lu:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_mask_type value_)
+{
+    switch(value_)
+    {
+    case rocsparse_mask_type_structural:
+    case rocsparse_mask_type_complement:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_semiring value_)
+{
+    switch(value_)
+    {
+    case rocsparse_semiring_plus_times:
+    case rocsparse_semiring_min_plus:
+    case rocsparse_semiring_max_times:
+    case rocsparse_semiring_or_and:
+    case rocsparse_semiring_plus_pair:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_ewise_pattern value_)
+{
+    switch(value_)
+    {
+    case rocsparse_ewise_pattern_intersection:
+    case rocsparse_ewise_pattern_union:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
+template <>
+inline bool rocsparse_enum_utils::is_invalid(rocsparse_ewise_op value_)
+{
+    switch(value_)
+    {
+    case rocsparse_ewise_op_add:
+    case rocsparse_ewise_op_sub:
+    case rocsparse_ewise_op_mul:
+    case rocsparse_ewise_op_div:
+    case rocsparse_ewise_op_min:
+    case rocsparse_ewise_op_max:
+    {
+        return false;
+    }
+    }
+    return true;
+};
+
 template <>
 inline bool rocsparse_enum_utils::is_invalid(rocsparse_solve_policy value_)
 {
     switch(value_)
     {
     case rocsparse_solve_policy_auto:
+    case rocsparse_solve_policy_sync_free:
+    case rocsparse_solve_policy_level_set:
     {
         return false;
     }
@@ -390,6 +470,7 @@ inline bool rocsparse_enum_utils::is_invalid(rocsparse_analysis_policy value_)
     {
     case rocsparse_analysis_policy_reuse:
     case rocsparse_analysis_policy_force:
+    case rocsparse_analysis_policy_numeric:
     {
         return false;
     }
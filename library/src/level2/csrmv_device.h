@@ -27,8 +27,14 @@
 #define CSRMV_DEVICE_H
 
 #include "common.h"
+#include "semiring.h"
 
-template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename I, typename J, typename T>
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WF_SIZE,
+          rocsparse_semiring SEMIRING = rocsparse_semiring_plus_times,
+          typename I,
+          typename J,
+          typename T>
 static __device__ void csrmvn_general_device(J                    m,
                                              T                    alpha,
                                              const I*             row_offset,
@@ -39,6 +45,8 @@ static __device__ void csrmvn_general_device(J                    m,
                                              T*                   y,
                                              rocsparse_index_base idx_base)
 {
+    typedef rocsparse_semiring_ops<SEMIRING, T> ops;
+
     int lid = hipThreadIdx_x & (WF_SIZE - 1);
 
     J gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
@@ -51,28 +59,28 @@ static __device__ void csrmvn_general_device(J                    m,
         I row_start = row_offset[row] - idx_base;
         I row_end   = row_offset[row + 1] - idx_base;
 
-        T sum = static_cast<T>(0);
+        T sum = ops::zero();
 
         // Loop over non-zero elements
         for(I j = row_start + lid; j < row_end; j += WF_SIZE)
         {
-            sum = rocsparse_fma(
-                alpha * csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+            sum = ops::fma(
+                ops::mul(alpha, csr_val[j]), rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
         }
 
         // Obtain row sum using parallel reduction
-        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+        sum = ops::template wfreduce<WF_SIZE>(sum);
 
         // First thread of each wavefront writes result into global memory
         if(lid == WF_SIZE - 1)
         {
-            if(beta == static_cast<T>(0))
+            if(beta == ops::zero())
             {
                 y[row] = sum;
             }
             else
             {
-                y[row] = rocsparse_fma(beta, y[row], sum);
+                y[row] = ops::fma(beta, y[row], sum);
             }
         }
     }
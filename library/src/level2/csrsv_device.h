@@ -504,4 +504,424 @@ __device__ void csrsv_device(rocsparse_int m,
     }
 }
 
+// Determine the first position of each level in the row map. Depths are stored
+// as level + 1 and have been sorted in ascending order.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_level_ptr_kernel(rocsparse_int m,
+                                const int* __restrict__ depth,
+                                rocsparse_int* __restrict__ level_ptr)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(gid >= m)
+    {
+        return;
+    }
+
+    int level = depth[gid];
+
+    // First row of a new level
+    if(gid == 0 || depth[gid - 1] != level)
+    {
+        level_ptr[level - 1] = gid;
+    }
+}
+
+// Mixing function of the splitmix64 generator
+__device__ __forceinline__ unsigned long long csr_pattern_mix(unsigned long long x)
+{
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+// Compute a fingerprint of the sparsity pattern. Each entry of the row pointer and
+// column index arrays is mixed together with its position, such that the sum over
+// all entries does not depend on the order of summation.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csr_pattern_hash_kernel(rocsparse_int m,
+                                 rocsparse_int nnz,
+                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                 unsigned long long* __restrict__ hash)
+{
+    int           tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ unsigned long long sdata[BLOCKSIZE];
+
+    unsigned long long local_hash = 0;
+
+    if(gid <= m)
+    {
+        local_hash += csr_pattern_mix((static_cast<unsigned long long>(gid) << 32)
+                                      | static_cast<unsigned int>(csr_row_ptr[gid]));
+    }
+
+    if(gid < nnz)
+    {
+        local_hash += csr_pattern_mix(((static_cast<unsigned long long>(gid) << 32)
+                                       | static_cast<unsigned int>(csr_col_ind[gid]))
+                                      ^ 0x9e3779b97f4a7c15ULL);
+    }
+
+    sdata[tid] = local_hash;
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0)
+    {
+        atomicAdd(hash, sdata[0]);
+    }
+}
+
+// Solve all rows of a single level. All dependencies of this level have been
+// resolved by previous launches, thus no synchronization is required.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+__device__ void csrsv_level_device(rocsparse_int m,
+                                   T             alpha,
+                                   const rocsparse_int* __restrict__ csr_row_ptr,
+                                   const rocsparse_int* __restrict__ csr_col_ind,
+                                   const T* __restrict__ csr_val,
+                                   const T* __restrict__ x,
+                                   T* __restrict__ y,
+                                   const rocsparse_int* __restrict__ map,
+                                   rocsparse_int offset,
+                                   rocsparse_int* __restrict__ zero_pivot,
+                                   rocsparse_index_base idx_base,
+                                   rocsparse_fill_mode  fill_mode,
+                                   rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Index into the row map
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // Get the row this wavefront will operate on
+    rocsparse_int row = map[idx + offset];
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Local summation variable
+    T local_sum = static_cast<T>(0);
+
+    // Local diagonal entry
+    T local_diag = static_cast<T>(0);
+
+    if(lid == 0)
+    {
+        // Lane 0 initializes its local sum with alpha and x
+        local_sum = alpha * rocsparse_nontemporal_load(x + row);
+    }
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        // Current column this lane operates on
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        // Skip entries outside of the triangular part
+        if((fill_mode == rocsparse_fill_mode_upper && local_col < row)
+           || (fill_mode == rocsparse_fill_mode_lower && local_col > row))
+        {
+            continue;
+        }
+
+        // Local value this lane operates with
+        T local_val = rocsparse_nontemporal_load(csr_val + j);
+
+        // Diagonal entry
+        if(local_col == row)
+        {
+            if(diag_type == rocsparse_diag_type_non_unit)
+            {
+                // Check for numerical zero
+                if(local_val == static_cast<T>(0))
+                {
+                    // Numerical zero pivot found, avoid division by 0
+                    // and store index for later use.
+                    atomicMin(zero_pivot, row + idx_base);
+                    local_val = static_cast<T>(1);
+                }
+
+                local_diag = local_val;
+            }
+
+            continue;
+        }
+
+        // Local sum computation for each lane
+        local_sum = rocsparse_fma(-local_val, y[local_col], local_sum);
+    }
+
+    // Gather all local sums and the diagonal entry for each lane
+    local_sum  = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+    local_diag = rocsparse_wfreduce_sum<WF_SIZE>(local_diag);
+
+    if(lid == WF_SIZE - 1)
+    {
+        // If we have non unit diagonal, take the diagonal into account
+        // For unit diagonal, this would be multiplication with one
+        if(diag_type == rocsparse_diag_type_non_unit)
+        {
+            local_sum = local_sum / local_diag;
+        }
+
+        // Store the rows result in y
+        y[row] = local_sum;
+    }
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+__device__ void csrsv_jacobi_device(rocsparse_int m,
+                                    T             alpha,
+                                    const rocsparse_int* __restrict__ csr_row_ptr,
+                                    const rocsparse_int* __restrict__ csr_col_ind,
+                                    const T* __restrict__ csr_val,
+                                    const rocsparse_int* __restrict__ diag_ind,
+                                    const T* __restrict__ x,
+                                    const T* __restrict__ y_old,
+                                    T* __restrict__ y_new,
+                                    rocsparse_int* __restrict__ zero_pivot,
+                                    rocsparse_index_base idx_base,
+                                    rocsparse_fill_mode  fill_mode,
+                                    rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Each wavefront processes one row
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Local summation variable
+    T local_sum = static_cast<T>(0);
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        // Current column this lane operates on
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        // Skip the diagonal and entries outside of the triangular part
+        if(local_col == row || (fill_mode == rocsparse_fill_mode_upper && local_col < row)
+           || (fill_mode == rocsparse_fill_mode_lower && local_col > row))
+        {
+            continue;
+        }
+
+        // Local sum computation for each lane, using the previous iterate only
+        local_sum = rocsparse_fma(
+            rocsparse_nontemporal_load(csr_val + j), y_old[local_col], local_sum);
+    }
+
+    // Gather all local sums
+    local_sum = rocsparse_wfreduce_sum<WF_SIZE>(local_sum);
+
+    if(lid == WF_SIZE - 1)
+    {
+        T val = alpha * x[row] - local_sum;
+
+        // If we have non unit diagonal, take the diagonal into account
+        // For unit diagonal, this would be multiplication with one
+        if(diag_type == rocsparse_diag_type_non_unit)
+        {
+            // Structural zero pivots have already been recorded during analysis
+            rocsparse_int diag_j     = diag_ind[row];
+            T             local_diag = (diag_j == -1) ? static_cast<T>(1) : csr_val[diag_j];
+
+            // Check for numerical zero
+            if(local_diag == static_cast<T>(0))
+            {
+                // Numerical zero pivot found, avoid division by 0
+                // and store index for later use.
+                atomicMin(zero_pivot, row + idx_base);
+                local_diag = static_cast<T>(1);
+            }
+
+            val = val / local_diag;
+        }
+
+        // Store the rows result of the current sweep
+        y_new[row] = val;
+    }
+}
+
+// Count the number of dependencies of each row of the transposed triangular matrix,
+// which are the off-diagonal entries in the corresponding column of the original
+// matrix.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_transpose_dep_count_kernel(rocsparse_int m,
+                                          const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const rocsparse_int* __restrict__ csr_col_ind,
+                                          int* __restrict__ dep_count,
+                                          rocsparse_index_base idx_base,
+                                          rocsparse_fill_mode  fill_mode)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    // Each wavefront processes one row
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        // Only strictly triangular entries introduce a dependency
+        if((fill_mode == rocsparse_fill_mode_lower && col < row)
+           || (fill_mode == rocsparse_fill_mode_upper && col > row))
+        {
+            atomicAdd(&dep_count[col], 1);
+        }
+    }
+}
+
+// Transposed triangular solve on the original matrix. Row i of the original matrix
+// holds column i of the transposed matrix. Once the solution of a row is known, its
+// contribution is pushed to all rows of the transposed matrix that depend on it.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP, typename T>
+__device__ void csrsv_transpose_push_device(rocsparse_int m,
+                                            T             alpha,
+                                            const rocsparse_int* __restrict__ csr_row_ptr,
+                                            const rocsparse_int* __restrict__ csr_col_ind,
+                                            const T* __restrict__ csr_val,
+                                            const rocsparse_int* __restrict__ diag_ind,
+                                            const T* __restrict__ x,
+                                            T* __restrict__ y,
+                                            T* __restrict__ sum,
+                                            int* __restrict__ dep_count,
+                                            rocsparse_int* __restrict__ zero_pivot,
+                                            rocsparse_index_base idx_base,
+                                            rocsparse_fill_mode  fill_mode,
+                                            rocsparse_diag_type  diag_type)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    int wid = hipThreadIdx_x / WF_SIZE;
+
+    rocsparse_int idx = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    // Do not run out of bounds
+    if(idx >= m)
+    {
+        return;
+    }
+
+    // The transposed matrix of a lower triangular matrix is upper triangular and
+    // has to be processed starting with the last row
+    rocsparse_int row = (fill_mode == rocsparse_fill_mode_lower) ? m - 1 - idx : idx;
+
+    // Spin loop until all contributions to this row have been pushed
+    int          local_count   = atomicOr(&dep_count[row], 0);
+    unsigned int times_through = 0;
+    while(local_count)
+    {
+        if(SLEEP)
+        {
+            for(unsigned int i = 0; i < times_through; ++i)
+            {
+                __builtin_amdgcn_s_sleep(1);
+            }
+
+            if(times_through < 3907)
+            {
+                ++times_through;
+            }
+        }
+
+        local_count = atomicOr(&dep_count[row], 0);
+    }
+
+    // Wait for the contributions to be visible globally
+    __threadfence();
+
+    T local_diag = static_cast<T>(1);
+
+    if(diag_type == rocsparse_diag_type_non_unit)
+    {
+        // Structural zero pivots have already been recorded during analysis
+        rocsparse_int diag_j = diag_ind[row];
+
+        if(diag_j != -1)
+        {
+            local_diag = csr_val[diag_j];
+        }
+
+        // Check for numerical zero
+        if(local_diag == static_cast<T>(0))
+        {
+            // Numerical zero pivot found, avoid division by 0
+            // and store index for later use.
+            if(lid == 0)
+            {
+                atomicMin(zero_pivot, row + idx_base);
+            }
+
+            local_diag = static_cast<T>(1);
+        }
+    }
+
+    // Solution of this row, each lane holds a copy
+    T local_y = (alpha * x[row] - sum[row]) / local_diag;
+
+    // Current row entry point and exit point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+    {
+        rocsparse_int local_col = rocsparse_nontemporal_load(csr_col_ind + j) - idx_base;
+
+        // Skip the diagonal and entries outside of the triangular part
+        if((fill_mode == rocsparse_fill_mode_lower && local_col >= row)
+           || (fill_mode == rocsparse_fill_mode_upper && local_col <= row))
+        {
+            continue;
+        }
+
+        // Push the contribution of this row
+        atomicAdd(&sum[local_col], rocsparse_nontemporal_load(csr_val + j) * local_y);
+
+        // Make sure the contribution is visible before resolving the dependency
+        __threadfence();
+
+        atomicSub(&dep_count[local_col], 1);
+    }
+
+    if(lid == 0)
+    {
+        y[row] = local_y;
+    }
+}
+
 #endif // CSRSV_DEVICE_H
@@ -139,6 +139,15 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Fingerprint of the sparsity pattern, if only the values have changed
+    unsigned long long pattern_hash = 0;
+
+    if(analysis == rocsparse_analysis_policy_numeric)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash(
+            handle, mb, nnzb, bsr_row_ptr, bsr_col_ind, temp_buffer, &pattern_hash));
+    }
+
     // Switch between lower and upper triangular analysis
     if(descr->fill_mode == rocsparse_fill_mode_upper)
     {
@@ -167,6 +176,26 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
             //                return rocsparse_status_success;
             //            }
         }
+        else if(analysis == rocsparse_analysis_policy_numeric)
+        {
+            // Only the values have changed, re-use the meta data if it has been
+            // gathered for the same sparsity pattern
+            rocsparse_trm_info* bsrsv = (trans == rocsparse_operation_none)
+                                            ? &info->bsrsv_upper_info
+                                            : &info->bsrsvt_upper_info;
+
+            if(rocsparse_trm_pattern_match(*bsrsv, mb, nnzb, pattern_hash))
+            {
+                return rocsparse_status_success;
+            }
+
+            // The pattern has changed. Meta data that is shared with other routines
+            // is left to them, they will detect the change on their own.
+            if(rocsparse_check_trm_shared(info, *bsrsv))
+            {
+                *bsrsv = nullptr;
+            }
+        }
 
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used.
@@ -234,6 +263,26 @@ rocsparse_status rocsparse_bsrsv_analysis_template(rocsparse_handle          han
             //     return rocsparse_status_success;
             // }
         }
+        else if(analysis == rocsparse_analysis_policy_numeric)
+        {
+            // Only the values have changed, re-use the meta data if it has been
+            // gathered for the same sparsity pattern
+            rocsparse_trm_info* bsrsv = (trans == rocsparse_operation_none)
+                                            ? &info->bsrsv_lower_info
+                                            : &info->bsrsvt_lower_info;
+
+            if(rocsparse_trm_pattern_match(*bsrsv, mb, nnzb, pattern_hash))
+            {
+                return rocsparse_status_success;
+            }
+
+            // The pattern has changed. Meta data that is shared with other routines
+            // is left to them, they will detect the change on their own.
+            if(rocsparse_check_trm_shared(info, *bsrsv))
+            {
+                *bsrsv = nullptr;
+            }
+        }
 
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used.
@@ -84,11 +84,11 @@
 
 #define LAUNCH_BSRSV_LOWER_SHARED(bsize, wfsize, dim, arch)            \
     hipLaunchKernelGGL((bsrsv_lower_shared<bsize, wfsize, dim, arch>), \
-                       dim3((wfsize * mb - 1) / bsize + 1),            \
+                       dim3((wfsize * local_mb - 1) / bsize + 1),      \
                        dim3(bsize),                                    \
                        0,                                              \
                        stream,                                         \
-                       mb,                                             \
+                       local_mb,                                       \
                        alpha_device_host,                              \
                        local_bsr_row_ptr,                              \
                        local_bsr_col_ind,                              \
@@ -97,7 +97,7 @@
                        x,                                              \
                        y,                                              \
                        done_array,                                     \
-                       bsrsv->row_map,                                 \
+                       local_row_map,                                  \
                        info->zero_pivot,                               \
                        descr->base,                                    \
                        descr->diag_type,                               \
@@ -105,11 +105,11 @@
 
 #define LAUNCH_BSRSV_UPPER_SHARED(bsize, wfsize, dim, arch)            \
     hipLaunchKernelGGL((bsrsv_upper_shared<bsize, wfsize, dim, arch>), \
-                       dim3((wfsize * mb - 1) / bsize + 1),            \
+                       dim3((wfsize * local_mb - 1) / bsize + 1),      \
                        dim3(bsize),                                    \
                        0,                                              \
                        stream,                                         \
-                       mb,                                             \
+                       local_mb,                                       \
                        alpha_device_host,                              \
                        local_bsr_row_ptr,                              \
                        local_bsr_col_ind,                              \
@@ -118,7 +118,7 @@
                        x,                                              \
                        y,                                              \
                        done_array,                                     \
-                       bsrsv->row_map,                                 \
+                       local_row_map,                                  \
                        info->zero_pivot,                               \
                        descr->base,                                    \
                        descr->diag_type,                               \
@@ -150,11 +150,11 @@
 
 #define LAUNCH_BSRSV_LOWER_GENERAL(bsize, wfsize, arch)            \
     hipLaunchKernelGGL((bsrsv_lower_general<bsize, wfsize, arch>), \
-                       dim3((wfsize * mb - 1) / bsize + 1),        \
+                       dim3((wfsize * local_mb - 1) / bsize + 1),  \
                        dim3(bsize),                                \
                        0,                                          \
                        stream,                                     \
-                       mb,                                         \
+                       local_mb,                                   \
                        alpha_device_host,                          \
                        local_bsr_row_ptr,                          \
                        local_bsr_col_ind,                          \
@@ -163,7 +163,7 @@
                        x,                                          \
                        y,                                          \
                        done_array,                                 \
-                       bsrsv->row_map,                             \
+                       local_row_map,                              \
                        info->zero_pivot,                           \
                        descr->base,                                \
                        descr->diag_type,                           \
@@ -171,11 +171,11 @@
 
 #define LAUNCH_BSRSV_UPPER_GENERAL(bsize, wfsize, arch)            \
     hipLaunchKernelGGL((bsrsv_upper_general<bsize, wfsize, arch>), \
-                       dim3((wfsize * mb - 1) / bsize + 1),        \
+                       dim3((wfsize * local_mb - 1) / bsize + 1),  \
                        dim3(bsize),                                \
                        0,                                          \
                        stream,                                     \
-                       mb,                                         \
+                       local_mb,                                   \
                        alpha_device_host,                          \
                        local_bsr_row_ptr,                          \
                        local_bsr_col_ind,                          \
@@ -184,7 +184,7 @@
                        x,                                          \
                        y,                                          \
                        done_array,                                 \
-                       bsrsv->row_map,                             \
+                       local_row_map,                              \
                        info->zero_pivot,                           \
                        descr->base,                                \
                        descr->diag_type,                           \
@@ -421,40 +421,54 @@ rocsparse_status rocsparse_bsrsv_solve_dispatch(rocsparse_handle          handle
     int gcnArch = handle->properties.gcnArch;
     int asicRev = handle->asic_rev;
 
-    if(handle->wavefront_size == 64)
+    // With level-set scheduling, each level is processed by a separate launch. All
+    // dependencies of a level have been marked done by previous launches, such that
+    // the sync-free kernels never have to spin.
+    bool          level_set = rocsparse_trm_use_level_set(handle, bsrsv, policy);
+    rocsparse_int nlaunches = level_set ? bsrsv->nlevels : 1;
+
+    for(rocsparse_int l = 0; l < nlaunches; ++l)
     {
-        if(bsr_dim <= 8)
-        {
-            // Launch shared memory based kernel for small BSR block dimensions
-            LAUNCH_BSRSV_SHARED(fill_mode, handle->pointer_mode, 128, 64, 8, gcnArch, asicRev);
-        }
-        else if(bsr_dim <= 16)
-        {
-            // Launch shared memory based kernel for small BSR block dimensions
-            LAUNCH_BSRSV_SHARED(fill_mode, handle->pointer_mode, 128, 64, 16, gcnArch, asicRev);
-        }
-        else if(bsr_dim <= 32)
+        rocsparse_int offset = level_set ? bsrsv->level_ptr[l] : 0;
+
+        rocsparse_int  local_mb      = level_set ? bsrsv->level_ptr[l + 1] - offset : mb;
+        rocsparse_int* local_row_map = bsrsv->row_map + offset;
+
+        if(handle->wavefront_size == 64)
         {
-            // Launch shared memory based kernel for small BSR block dimensions
-            LAUNCH_BSRSV_SHARED(fill_mode, handle->pointer_mode, 128, 64, 32, gcnArch, asicRev);
+            if(bsr_dim <= 8)
+            {
+                // Launch shared memory based kernel for small BSR block dimensions
+                LAUNCH_BSRSV_SHARED(fill_mode, handle->pointer_mode, 128, 64, 8, gcnArch, asicRev);
+            }
+            else if(bsr_dim <= 16)
+            {
+                // Launch shared memory based kernel for small BSR block dimensions
+                LAUNCH_BSRSV_SHARED(fill_mode, handle->pointer_mode, 128, 64, 16, gcnArch, asicRev);
+            }
+            else if(bsr_dim <= 32)
+            {
+                // Launch shared memory based kernel for small BSR block dimensions
+                LAUNCH_BSRSV_SHARED(fill_mode, handle->pointer_mode, 128, 64, 32, gcnArch, asicRev);
+            }
+            else
+            {
+                // Launch general algorithm for large BSR block dimensions (> 32x32)
+                LAUNCH_BSRSV_GENERAL(fill_mode, handle->pointer_mode, 128, 64, gcnArch, asicRev);
+            }
         }
         else
         {
-            // Launch general algorithm for large BSR block dimensions (> 32x32)
-            LAUNCH_BSRSV_GENERAL(fill_mode, handle->pointer_mode, 128, 64, gcnArch, asicRev);
-        }
-    }
-    else
-    {
-        //
-        // This is wavefront 32, let's exclude it.
-        //
-        // LCOV_EXCL_START;
+            //
+            // This is wavefront 32, let's exclude it.
+            //
+            // LCOV_EXCL_START;
 
-        // Launch general algorithm
-        LAUNCH_BSRSV_GENERAL(fill_mode, handle->pointer_mode, 128, 32, gcnArch, asicRev);
+            // Launch general algorithm
+            LAUNCH_BSRSV_GENERAL(fill_mode, handle->pointer_mode, 128, 32, gcnArch, asicRev);
 
-        // LCOV_EXCL_STOP;
+            // LCOV_EXCL_STOP;
+        }
     }
 
     return rocsparse_status_success;
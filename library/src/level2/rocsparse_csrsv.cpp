@@ -116,6 +116,93 @@ extern "C" rocsparse_status rocsparse_csrsv_zero_pivot(rocsparse_handle
     return rocsparse_status_success;
 }
 
+extern "C" rocsparse_status rocsparse_csrsv_level_info(rocsparse_handle          handle,
+                                                       rocsparse_operation       trans,
+                                                       const rocsparse_mat_descr descr,
+                                                       rocsparse_mat_info        info,
+                                                       rocsparse_int*            nlevels)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrsv_level_info",
+              trans,
+              (const void*&)descr,
+              (const void*&)info,
+              (const void*&)nlevels);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check operation type
+    if(trans != rocsparse_operation_none && trans != rocsparse_operation_transpose)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check pointer arguments
+    if(nlevels == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_trm_info csrsv
+        = (descr->fill_mode == rocsparse_fill_mode_upper)
+              ? ((trans == rocsparse_operation_none) ? info->csrsv_upper_info
+                                                     : info->csrsvt_upper_info)
+              : ((trans == rocsparse_operation_none) ? info->csrsv_lower_info
+                                                     : info->csrsvt_lower_info);
+
+    // If m == 0 || nnz == 0 it can happen, that info structure is not created.
+    // In this case, there are no levels.
+    *nlevels = (csrsv != nullptr) ? csrsv->nlevels : 0;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrsv_jacobi_sweeps(rocsparse_handle   handle,
+                                                          rocsparse_mat_info info,
+                                                          rocsparse_int      nsweeps)
+{
+    // Check for valid handle and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrsv_jacobi_sweeps", (const void*&)info, nsweeps);
+
+    // Check sizes
+    if(nsweeps < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    info->csrsv_nsweeps = nsweeps;
+
+    return rocsparse_status_success;
+}
+
 extern "C" rocsparse_status rocsparse_csrsv_clear(rocsparse_handle          handle,
                                                   const rocsparse_mat_descr descr,
                                                   rocsparse_mat_info        info)
@@ -40,6 +40,14 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle
                                                       rocsparse_mat_info        info,
                                                       size_t*                   buffer_size);
 
+rocsparse_status rocsparse_csr_pattern_hash(rocsparse_handle     handle,
+                                            rocsparse_int        m,
+                                            rocsparse_int        nnz,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            void*                temp_buffer,
+                                            unsigned long long*  pattern_hash);
+
 template <typename T>
 rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                         rocsparse_operation       trans,
@@ -29,6 +29,44 @@
 #include "utility.h"
 #include <rocprim/rocprim.hpp>
 
+rocsparse_status rocsparse_csr_pattern_hash(rocsparse_handle     handle,
+                                            rocsparse_int        m,
+                                            rocsparse_int        nnz,
+                                            const rocsparse_int* csr_row_ptr,
+                                            const rocsparse_int* csr_col_ind,
+                                            void*                temp_buffer,
+                                            unsigned long long*  pattern_hash)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // The fingerprint is accumulated in the first bytes of the temporary buffer
+    unsigned long long* d_hash = reinterpret_cast<unsigned long long*>(temp_buffer);
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_hash, 0, sizeof(unsigned long long), stream));
+
+#define CSRSV_DIM 1024
+    hipLaunchKernelGGL((csr_pattern_hash_kernel<CSRSV_DIM>),
+                       dim3((std::max(m + 1, nnz) - 1) / CSRSV_DIM + 1),
+                       dim3(CSRSV_DIM),
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       d_hash);
+#undef CSRSV_DIM
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        pattern_hash, d_hash, sizeof(unsigned long long), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                         rocsparse_operation       trans,
@@ -460,6 +498,49 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
                                            stream));
     }
 
+    // Build level sets from the sorted depths. Since the depth of each row is one
+    // larger than the maximum depth of its dependencies, all levels in [1, nlevels]
+    // are occupied.
+    int nlevels;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &nlevels, keys.current() + m - 1, sizeof(int), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // workspace is not used anymore and can hold the device level pointers
+    rocsparse_int* d_level_ptr = workspace;
+
+#define CSRSV_DIM 1024
+    hipLaunchKernelGGL((csrsv_level_ptr_kernel<CSRSV_DIM>),
+                       dim3((m - 1) / CSRSV_DIM + 1),
+                       dim3(CSRSV_DIM),
+                       0,
+                       stream,
+                       m,
+                       keys.current(),
+                       d_level_ptr);
+#undef CSRSV_DIM
+
+    info->nlevels = nlevels;
+    info->level_ptr.resize(nlevels + 1);
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(info->level_ptr.data(),
+                                       d_level_ptr,
+                                       sizeof(rocsparse_int) * nlevels,
+                                       hipMemcpyDeviceToHost,
+                                       stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    info->level_ptr[nlevels] = m;
+
+    // Fingerprint of the sparsity pattern, to verify that the meta data can be
+    // re-used when only the values change
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash(
+        handle, m, nnz, csr_row_ptr, csr_col_ind, temp_buffer, &info->pattern_hash));
+
     // Store some pointers to verify correct execution
     info->m           = m;
     info->nnz         = nnz;
@@ -470,6 +551,103 @@ rocsparse_status rocsparse_trm_analysis(rocsparse_handle          handle,
     return rocsparse_status_success;
 }
 
+template <typename T>
+static rocsparse_status rocsparse_csrsv_trm_analysis(rocsparse_handle          handle,
+                                                     rocsparse_operation       trans,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_trm_info        info,
+                                                     rocsparse_int**           zero_pivot,
+                                                     void*                     temp_buffer)
+{
+    // Size of the transposed sparsity pattern, including its permutation
+    size_t transpose_size = sizeof(rocsparse_int) * (2 * static_cast<size_t>(nnz) + m + 1);
+
+    // Store the transposed matrix, if it fits into the memory budget
+    if(trans == rocsparse_operation_none || transpose_size <= handle->memory_budget)
+    {
+        return rocsparse_trm_analysis(handle,
+                                      trans,
+                                      m,
+                                      nnz,
+                                      descr,
+                                      csr_val,
+                                      csr_row_ptr,
+                                      csr_col_ind,
+                                      info,
+                                      zero_pivot,
+                                      temp_buffer);
+    }
+
+    // Otherwise, the transposed solve operates on the original matrix. Analyze
+    // the original matrix to obtain its diagonal entries and structural zero pivots.
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(handle,
+                                                     rocsparse_operation_none,
+                                                     m,
+                                                     nnz,
+                                                     descr,
+                                                     csr_val,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     info,
+                                                     zero_pivot,
+                                                     temp_buffer));
+
+    // Levels of the original matrix do not apply to the transposed solve
+    info->nlevels = 0;
+    info->level_ptr.clear();
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Count the dependencies of each row of the transposed matrix
+    RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->trmt_dep_count, sizeof(int) * m));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(info->trmt_dep_count, 0, sizeof(int) * m, stream));
+
+#define CSRSV_DIM 1024
+    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
+    dim3 csrsv_threads(CSRSV_DIM);
+
+    if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        hipLaunchKernelGGL((csrsv_transpose_dep_count_kernel<CSRSV_DIM, 32>),
+                           csrsv_blocks,
+                           csrsv_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           info->trmt_dep_count,
+                           descr->base,
+                           descr->fill_mode);
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        hipLaunchKernelGGL((csrsv_transpose_dep_count_kernel<CSRSV_DIM, 64>),
+                           csrsv_blocks,
+                           csrsv_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           info->trmt_dep_count,
+                           descr->base,
+                           descr->fill_mode);
+    }
+#undef CSRSV_DIM
+
+    return rocsparse_status_success;
+}
+
 template <typename T>
 rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          handle,
                                                    rocsparse_operation       trans,
@@ -573,6 +751,15 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Fingerprint of the sparsity pattern, if only the values have changed
+    unsigned long long pattern_hash = 0;
+
+    if(analysis == rocsparse_analysis_policy_numeric)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash(
+            handle, m, nnz, csr_row_ptr, csr_col_ind, temp_buffer, &pattern_hash));
+    }
+
     // Switch between lower and upper triangular analysis
     if(descr->fill_mode == rocsparse_fill_mode_upper)
     {
@@ -609,6 +796,26 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                 return rocsparse_status_success;
             }
         }
+        else if(analysis == rocsparse_analysis_policy_numeric)
+        {
+            // Only the values have changed, re-use the meta data if it has been
+            // gathered for the same sparsity pattern
+            rocsparse_trm_info* csrsv = (trans == rocsparse_operation_none)
+                                            ? &info->csrsv_upper_info
+                                            : &info->csrsvt_upper_info;
+
+            if(rocsparse_trm_pattern_match(*csrsv, m, nnz, pattern_hash))
+            {
+                return rocsparse_status_success;
+            }
+
+            // The pattern has changed. Meta data that is shared with other routines
+            // is left to them, they will detect the change on their own.
+            if(rocsparse_check_trm_shared(info, *csrsv))
+            {
+                *csrsv = nullptr;
+            }
+        }
 
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used.
@@ -626,7 +833,7 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                                                                 : &info->csrsvt_upper_info));
 
         // Perform analysis
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_trm_analysis(
             handle,
             trans,
             m,
@@ -685,6 +892,26 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                 return rocsparse_status_success;
             }
         }
+        else if(analysis == rocsparse_analysis_policy_numeric)
+        {
+            // Only the values have changed, re-use the meta data if it has been
+            // gathered for the same sparsity pattern
+            rocsparse_trm_info* csrsv = (trans == rocsparse_operation_none)
+                                            ? &info->csrsv_lower_info
+                                            : &info->csrsvt_lower_info;
+
+            if(rocsparse_trm_pattern_match(*csrsv, m, nnz, pattern_hash))
+            {
+                return rocsparse_status_success;
+            }
+
+            // The pattern has changed. Meta data that is shared with other routines
+            // is left to them, they will detect the change on their own.
+            if(rocsparse_check_trm_shared(info, *csrsv))
+            {
+                *csrsv = nullptr;
+            }
+        }
 
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used.
@@ -700,7 +927,7 @@ rocsparse_status rocsparse_csrsv_analysis_template(rocsparse_handle          han
                                                                 : &info->csrsvt_lower_info));
 
         // Perform analysis
-        RETURN_IF_ROCSPARSE_ERROR(rocsparse_trm_analysis(
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrsv_trm_analysis(
             handle,
             trans,
             m,
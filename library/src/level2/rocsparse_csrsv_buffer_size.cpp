@@ -165,6 +165,19 @@ rocsparse_status rocsparse_csrsv_buffer_size_template(rocsparse_handle
         *buffer_size = std::max(*buffer_size, transpose_size);
     }
 
+    // The solve phase requires the done array, the transposed values and the
+    // iterate of the approximate Jacobi solve
+    size_t solve_size = 256;
+    solve_size += sizeof(int) * ((m - 1) / 256 + 1) * 256;
+    solve_size += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+
+    if(trans == rocsparse_operation_transpose)
+    {
+        solve_size += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
+    }
+
+    *buffer_size = std::max(*buffer_size, solve_size);
+
     return rocsparse_status_success;
 }
 
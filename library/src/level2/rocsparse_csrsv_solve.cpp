@@ -64,6 +64,179 @@ __launch_bounds__(BLOCKSIZE) __global__
                                             diag_type);
 }
 
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_level_kernel(rocsparse_int m,
+                            U             alpha_device_host,
+                            const rocsparse_int* __restrict__ csr_row_ptr,
+                            const rocsparse_int* __restrict__ csr_col_ind,
+                            const T* __restrict__ csr_val,
+                            const T* __restrict__ x,
+                            T* __restrict__ y,
+                            const rocsparse_int* __restrict__ map,
+                            rocsparse_int offset,
+                            rocsparse_int* __restrict__ zero_pivot,
+                            rocsparse_index_base idx_base,
+                            rocsparse_fill_mode  fill_mode,
+                            rocsparse_diag_type  diag_type)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrsv_level_device<BLOCKSIZE, WF_SIZE>(m,
+                                           alpha,
+                                           csr_row_ptr,
+                                           csr_col_ind,
+                                           csr_val,
+                                           x,
+                                           y,
+                                           map,
+                                           offset,
+                                           zero_pivot,
+                                           idx_base,
+                                           fill_mode,
+                                           diag_type);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_jacobi_kernel(rocsparse_int m,
+                             U             alpha_device_host,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             const T* __restrict__ csr_val,
+                             const rocsparse_int* __restrict__ diag_ind,
+                             const T* __restrict__ x,
+                             const T* __restrict__ y_old,
+                             T* __restrict__ y_new,
+                             rocsparse_int* __restrict__ zero_pivot,
+                             rocsparse_index_base idx_base,
+                             rocsparse_fill_mode  fill_mode,
+                             rocsparse_diag_type  diag_type)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrsv_jacobi_device<BLOCKSIZE, WF_SIZE>(m,
+                                            alpha,
+                                            csr_row_ptr,
+                                            csr_col_ind,
+                                            csr_val,
+                                            diag_ind,
+                                            x,
+                                            y_old,
+                                            y_new,
+                                            zero_pivot,
+                                            idx_base,
+                                            fill_mode,
+                                            diag_type);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, bool SLEEP, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrsv_transpose_push_kernel(rocsparse_int m,
+                                     U             alpha_device_host,
+                                     const rocsparse_int* __restrict__ csr_row_ptr,
+                                     const rocsparse_int* __restrict__ csr_col_ind,
+                                     const T* __restrict__ csr_val,
+                                     const rocsparse_int* __restrict__ diag_ind,
+                                     const T* __restrict__ x,
+                                     T* __restrict__ y,
+                                     T* __restrict__ sum,
+                                     int* __restrict__ dep_count,
+                                     rocsparse_int* __restrict__ zero_pivot,
+                                     rocsparse_index_base idx_base,
+                                     rocsparse_fill_mode  fill_mode,
+                                     rocsparse_diag_type  diag_type)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    csrsv_transpose_push_device<BLOCKSIZE, WF_SIZE, SLEEP>(m,
+                                                           alpha,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           csr_val,
+                                                           diag_ind,
+                                                           x,
+                                                           y,
+                                                           sum,
+                                                           dep_count,
+                                                           zero_pivot,
+                                                           idx_base,
+                                                           fill_mode,
+                                                           diag_type);
+}
+
+#define LAUNCH_CSRSV_TRANSPOSE_PUSH(wfsize, sleep)                              \
+    hipLaunchKernelGGL((csrsv_transpose_push_kernel<CSRSV_DIM, wfsize, sleep>), \
+                       csrsv_blocks,                                            \
+                       csrsv_threads,                                           \
+                       0,                                                       \
+                       stream,                                                  \
+                       m,                                                       \
+                       alpha_device_host,                                       \
+                       csr_row_ptr,                                             \
+                       csr_col_ind,                                             \
+                       csr_val,                                                 \
+                       csrsv->trm_diag_ind,                                     \
+                       x,                                                       \
+                       y,                                                       \
+                       sum,                                                     \
+                       dep_count,                                               \
+                       info->zero_pivot,                                        \
+                       descr->base,                                             \
+                       descr->fill_mode,                                        \
+                       descr->diag_type)
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrsv_transpose_push(rocsparse_handle          handle,
+                                                rocsparse_int             m,
+                                                U                         alpha_device_host,
+                                                const rocsparse_mat_descr descr,
+                                                const T*                  csr_val,
+                                                const rocsparse_int*      csr_row_ptr,
+                                                const rocsparse_int*      csr_col_ind,
+                                                rocsparse_mat_info        info,
+                                                rocsparse_trm_info        csrsv,
+                                                const T*                  x,
+                                                T*                        y,
+                                                int*                      dep_count,
+                                                T*                        sum)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Initialize dependency counters and partial sums
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        dep_count, csrsv->trmt_dep_count, sizeof(int) * m, hipMemcpyDeviceToDevice, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(sum, 0, sizeof(T) * m, stream));
+
+    // Determine gcnArch
+    int gcnArch = handle->properties.gcnArch;
+    int asicRev = handle->asic_rev;
+
+#define CSRSV_DIM 1024
+    dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
+    dim3 csrsv_threads(CSRSV_DIM);
+
+    // gfx908
+    if(gcnArch == 908 && asicRev < 2)
+    {
+        // LCOV_EXCL_START
+        LAUNCH_CSRSV_TRANSPOSE_PUSH(64, true);
+        // LCOV_EXCL_STOP
+    }
+    else if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        LAUNCH_CSRSV_TRANSPOSE_PUSH(32, false);
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        LAUNCH_CSRSV_TRANSPOSE_PUSH(64, false);
+    }
+#undef CSRSV_DIM
+
+    return rocsparse_status_success;
+}
+
 template <typename T, typename U>
 rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle,
                                                 rocsparse_operation       trans,
@@ -129,7 +302,26 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
     // transposed matrix values
     if(trans == rocsparse_operation_transpose)
     {
+        // Without stored transposed pattern, solve on the original matrix
+        if(csrsv->trmt_dep_count != nullptr)
+        {
+            return rocsparse_csrsv_transpose_push(handle,
+                                                  m,
+                                                  alpha_device_host,
+                                                  descr,
+                                                  csr_val,
+                                                  csr_row_ptr,
+                                                  csr_col_ind,
+                                                  info,
+                                                  csrsv,
+                                                  x,
+                                                  y,
+                                                  done_array,
+                                                  reinterpret_cast<T*>(ptr));
+        }
+
         T* csrt_val = reinterpret_cast<T*>(ptr);
+        ptr += sizeof(T) * ((nnz - 1) / 256 + 1) * 256;
 
         // Gather values
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_gthr_template(
@@ -143,6 +335,143 @@ rocsparse_status rocsparse_csrsv_solve_dispatch(rocsparse_handle          handle
                                                              : rocsparse_fill_mode_lower;
     }
 
+    // Approximate solve, using a fixed number of Jacobi sweeps
+    // y_k+1 = D^-1 (alpha * x - (T - D) * y_k), starting with y_0 = 0
+    if(info->csrsv_nsweeps > 0)
+    {
+        rocsparse_int nsweeps = info->csrsv_nsweeps;
+
+        // Jacobi iterate
+        T* tmp = reinterpret_cast<T*>(ptr);
+
+        // Choose the initial iterate such that the final sweep writes into y
+        T* y_old = (nsweeps & 1) ? tmp : y;
+        T* y_new = (nsweeps & 1) ? y : tmp;
+
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(y_old, 0, sizeof(T) * m, stream));
+
+#define CSRSV_DIM 1024
+        dim3 csrsv_blocks((handle->wavefront_size * m - 1) / CSRSV_DIM + 1);
+        dim3 csrsv_threads(CSRSV_DIM);
+
+        for(rocsparse_int k = 0; k < nsweeps; ++k)
+        {
+            if(handle->wavefront_size == 32)
+            {
+                // LCOV_EXCL_START
+                hipLaunchKernelGGL((csrsv_jacobi_kernel<CSRSV_DIM, 32>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   m,
+                                   alpha_device_host,
+                                   local_csr_row_ptr,
+                                   local_csr_col_ind,
+                                   local_csr_val,
+                                   csrsv->trm_diag_ind,
+                                   x,
+                                   y_old,
+                                   y_new,
+                                   info->zero_pivot,
+                                   descr->base,
+                                   fill_mode,
+                                   descr->diag_type);
+                // LCOV_EXCL_STOP
+            }
+            else
+            {
+                assert(handle->wavefront_size == 64);
+                hipLaunchKernelGGL((csrsv_jacobi_kernel<CSRSV_DIM, 64>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   m,
+                                   alpha_device_host,
+                                   local_csr_row_ptr,
+                                   local_csr_col_ind,
+                                   local_csr_val,
+                                   csrsv->trm_diag_ind,
+                                   x,
+                                   y_old,
+                                   y_new,
+                                   info->zero_pivot,
+                                   descr->base,
+                                   fill_mode,
+                                   descr->diag_type);
+            }
+
+            std::swap(y_old, y_new);
+        }
+#undef CSRSV_DIM
+
+        return rocsparse_status_success;
+    }
+
+    // Level-set scheduling, one launch per level
+    if(rocsparse_trm_use_level_set(handle, csrsv, policy))
+    {
+#define CSRSV_DIM 1024
+        for(rocsparse_int l = 0; l < csrsv->nlevels; ++l)
+        {
+            rocsparse_int offset = csrsv->level_ptr[l];
+            rocsparse_int width  = csrsv->level_ptr[l + 1] - offset;
+
+            dim3 csrsv_blocks((handle->wavefront_size * width - 1) / CSRSV_DIM + 1);
+            dim3 csrsv_threads(CSRSV_DIM);
+
+            if(handle->wavefront_size == 32)
+            {
+                // LCOV_EXCL_START
+                hipLaunchKernelGGL((csrsv_level_kernel<CSRSV_DIM, 32>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   width,
+                                   alpha_device_host,
+                                   local_csr_row_ptr,
+                                   local_csr_col_ind,
+                                   local_csr_val,
+                                   x,
+                                   y,
+                                   csrsv->row_map,
+                                   offset,
+                                   info->zero_pivot,
+                                   descr->base,
+                                   fill_mode,
+                                   descr->diag_type);
+                // LCOV_EXCL_STOP
+            }
+            else
+            {
+                assert(handle->wavefront_size == 64);
+                hipLaunchKernelGGL((csrsv_level_kernel<CSRSV_DIM, 64>),
+                                   csrsv_blocks,
+                                   csrsv_threads,
+                                   0,
+                                   stream,
+                                   width,
+                                   alpha_device_host,
+                                   local_csr_row_ptr,
+                                   local_csr_col_ind,
+                                   local_csr_val,
+                                   x,
+                                   y,
+                                   csrsv->row_map,
+                                   offset,
+                                   info->zero_pivot,
+                                   descr->base,
+                                   fill_mode,
+                                   descr->diag_type);
+            }
+        }
+#undef CSRSV_DIM
+
+        return rocsparse_status_success;
+    }
+
     // Determine gcnArch
     int gcnArch = handle->properties.gcnArch;
     int asicRev = handle->asic_rev;
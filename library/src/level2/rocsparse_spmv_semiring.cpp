@@ -0,0 +1,464 @@
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "handle.h"
+#include "rocsparse.h"
+#include "utility.h"
+
+#include "csrmv_device.h"
+
+template <unsigned int       BLOCKSIZE,
+          unsigned int       WF_SIZE,
+          rocsparse_semiring SEMIRING,
+          typename I,
+          typename J,
+          typename T,
+          typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrmvn_semiring_kernel(J m,
+                                U alpha_device_host,
+                                const I* __restrict__ csr_row_ptr,
+                                const J* __restrict__ csr_col_ind,
+                                const T* __restrict__ csr_val,
+                                const T* __restrict__ x,
+                                U beta_device_host,
+                                T* __restrict__ y,
+                                rocsparse_index_base idx_base)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+
+    csrmvn_general_device<BLOCKSIZE, WF_SIZE, SEMIRING>(
+        m, alpha, csr_row_ptr, csr_col_ind, csr_val, x, beta, y, idx_base);
+}
+
+template <rocsparse_semiring SEMIRING, typename I, typename J, typename T, typename U>
+static rocsparse_status
+    rocsparse_csrmv_semiring_dispatch(rocsparse_handle          handle,
+                                      J                         m,
+                                      I                         nnz,
+                                      U                         alpha_device_host,
+                                      const rocsparse_mat_descr descr,
+                                      const T*                  csr_val,
+                                      const I*                  csr_row_ptr,
+                                      const J*                  csr_col_ind,
+                                      const T*                  x,
+                                      U                         beta_device_host,
+                                      T*                        y)
+{
+#define CSRMVN_DIM 512
+#define CSRMVN_SEMIRING_LAUNCH(WF_SIZE)                                                \
+    hipLaunchKernelGGL((csrmvn_semiring_kernel<CSRMVN_DIM, WF_SIZE, SEMIRING>),        \
+                       dim3((m - 1) / CSRMVN_DIM + 1),                                 \
+                       dim3(CSRMVN_DIM),                                               \
+                       0,                                                              \
+                       handle->stream,                                                 \
+                       m,                                                              \
+                       alpha_device_host,                                              \
+                       csr_row_ptr,                                                    \
+                       csr_col_ind,                                                    \
+                       csr_val,                                                        \
+                       x,                                                              \
+                       beta_device_host,                                               \
+                       y,                                                              \
+                       descr->base)
+
+    // Each row is processed by a sub-wavefront, that fits the average row length
+    J nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        CSRMVN_SEMIRING_LAUNCH(2);
+    }
+    else if(nnz_per_row < 8)
+    {
+        CSRMVN_SEMIRING_LAUNCH(4);
+    }
+    else if(nnz_per_row < 16)
+    {
+        CSRMVN_SEMIRING_LAUNCH(8);
+    }
+    else if(nnz_per_row < 32)
+    {
+        CSRMVN_SEMIRING_LAUNCH(16);
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        CSRMVN_SEMIRING_LAUNCH(32);
+    }
+    else
+    {
+        CSRMVN_SEMIRING_LAUNCH(64);
+    }
+
+#undef CSRMVN_SEMIRING_LAUNCH
+#undef CSRMVN_DIM
+
+    return rocsparse_status_success;
+}
+
+// Semirings are only instantiated for real data types
+template <typename I,
+          typename J,
+          typename T,
+          typename U,
+          typename std::enable_if<std::is_same<T, float>::value || std::is_same<T, double>::value,
+                                  int>::type
+          = 0>
+static rocsparse_status
+    rocsparse_csrmv_semiring_template(rocsparse_handle          handle,
+                                      rocsparse_semiring        semiring,
+                                      J                         m,
+                                      I                         nnz,
+                                      U                         alpha_device_host,
+                                      const rocsparse_mat_descr descr,
+                                      const T*                  csr_val,
+                                      const I*                  csr_row_ptr,
+                                      const J*                  csr_col_ind,
+                                      const T*                  x,
+                                      U                         beta_device_host,
+                                      T*                        y)
+{
+    switch(semiring)
+    {
+#define SEMIRING_CASE(SEMIRING)                                                            \
+    case SEMIRING:                                                                         \
+    {                                                                                      \
+        return rocsparse_csrmv_semiring_dispatch<SEMIRING>(handle,                         \
+                                                           m,                              \
+                                                           nnz,                            \
+                                                           alpha_device_host,              \
+                                                           descr,                          \
+                                                           csr_val,                        \
+                                                           csr_row_ptr,                    \
+                                                           csr_col_ind,                    \
+                                                           x,                              \
+                                                           beta_device_host,               \
+                                                           y);                             \
+    }
+
+        SEMIRING_CASE(rocsparse_semiring_plus_times);
+        SEMIRING_CASE(rocsparse_semiring_min_plus);
+        SEMIRING_CASE(rocsparse_semiring_max_times);
+        SEMIRING_CASE(rocsparse_semiring_or_and);
+        SEMIRING_CASE(rocsparse_semiring_plus_pair);
+
+#undef SEMIRING_CASE
+    }
+
+    // LCOV_EXCL_START
+    return rocsparse_status_invalid_value;
+    // LCOV_EXCL_STOP
+}
+
+// Complex data types only support (+, x)
+template <typename I,
+          typename J,
+          typename T,
+          typename U,
+          typename std::enable_if<std::is_same<T, rocsparse_float_complex>::value
+                                      || std::is_same<T, rocsparse_double_complex>::value,
+                                  int>::type
+          = 0>
+static rocsparse_status
+    rocsparse_csrmv_semiring_template(rocsparse_handle          handle,
+                                      rocsparse_semiring        semiring,
+                                      J                         m,
+                                      I                         nnz,
+                                      U                         alpha_device_host,
+                                      const rocsparse_mat_descr descr,
+                                      const T*                  csr_val,
+                                      const I*                  csr_row_ptr,
+                                      const J*                  csr_col_ind,
+                                      const T*                  x,
+                                      U                         beta_device_host,
+                                      T*                        y)
+{
+    if(semiring != rocsparse_semiring_plus_times)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    return rocsparse_csrmv_semiring_dispatch<rocsparse_semiring_plus_times>(handle,
+                                                                            m,
+                                                                            nnz,
+                                                                            alpha_device_host,
+                                                                            descr,
+                                                                            csr_val,
+                                                                            csr_row_ptr,
+                                                                            csr_col_ind,
+                                                                            x,
+                                                                            beta_device_host,
+                                                                            y);
+}
+
+template <typename I, typename J, typename T>
+rocsparse_status rocsparse_spmv_semiring_template(rocsparse_handle            handle,
+                                                  rocsparse_operation         trans,
+                                                  rocsparse_semiring          semiring,
+                                                  const void*                 alpha,
+                                                  const rocsparse_spmat_descr mat,
+                                                  const rocsparse_dnvec_descr x,
+                                                  const void*                 beta,
+                                                  const rocsparse_dnvec_descr y)
+{
+    // Only CSR format is supported
+    if(mat->format != rocsparse_format_csr)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Only non-transposed is supported
+    if(trans != rocsparse_operation_none)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check matrix type
+    if(mat->descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Quick return if possible. Rows without entries are still written, since they
+    // hold the zero of the semiring.
+    if(mat->rows == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(mat->row_data == nullptr || x->values == nullptr || y->values == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(mat->nnz != 0 && (mat->col_data == nullptr || mat->val_data == nullptr))
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // The pair operation ignores its operands, such that beta (x) y would not depend
+    // on y. Thus, (+, pair) does not support the accumulation into y.
+    if(semiring == rocsparse_semiring_plus_pair)
+    {
+        T h_beta;
+
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                &h_beta, beta, sizeof(T), hipMemcpyDeviceToHost, handle->stream));
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(handle->stream));
+        }
+        else
+        {
+            h_beta = *(const T*)beta;
+        }
+
+        if(h_beta != static_cast<T>(0))
+        {
+            return rocsparse_status_invalid_value;
+        }
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrmv_semiring_template(handle,
+                                                 semiring,
+                                                 (J)mat->rows,
+                                                 (I)mat->nnz,
+                                                 (const T*)alpha,
+                                                 mat->descr,
+                                                 (const T*)mat->val_data,
+                                                 (const I*)mat->row_data,
+                                                 (const J*)mat->col_data,
+                                                 (const T*)x->values,
+                                                 (const T*)beta,
+                                                 (T*)y->values);
+    }
+    else
+    {
+        return rocsparse_csrmv_semiring_template(handle,
+                                                 semiring,
+                                                 (J)mat->rows,
+                                                 (I)mat->nnz,
+                                                 *(const T*)alpha,
+                                                 mat->descr,
+                                                 (const T*)mat->val_data,
+                                                 (const I*)mat->row_data,
+                                                 (const J*)mat->col_data,
+                                                 (const T*)x->values,
+                                                 *(const T*)beta,
+                                                 (T*)y->values);
+    }
+}
+
+template <typename... Ts>
+rocsparse_status rocsparse_spmv_semiring_dynamic_dispatch(rocsparse_indextype itype,
+                                                          rocsparse_indextype jtype,
+                                                          rocsparse_datatype  ctype,
+                                                          Ts&&... ts)
+{
+    switch(ctype)
+    {
+
+#define DATATYPE_CASE(ENUMVAL, TYPE)                                                    \
+    case ENUMVAL:                                                                       \
+    {                                                                                   \
+        switch(itype)                                                                   \
+        {                                                                               \
+        case rocsparse_indextype_u16:                                                   \
+        {                                                                               \
+            return rocsparse_status_not_implemented;                                    \
+        }                                                                               \
+        case rocsparse_indextype_i32:                                                   \
+        {                                                                               \
+            switch(jtype)                                                               \
+            {                                                                           \
+            case rocsparse_indextype_u16:                                               \
+            case rocsparse_indextype_i64:                                               \
+            {                                                                           \
+                return rocsparse_status_not_implemented;                                \
+            }                                                                           \
+            case rocsparse_indextype_i32:                                               \
+            {                                                                           \
+                return rocsparse_spmv_semiring_template<int32_t, int32_t, TYPE>(ts...); \
+            }                                                                           \
+            }                                                                           \
+        }                                                                               \
+        case rocsparse_indextype_i64:                                                   \
+        {                                                                               \
+            switch(jtype)                                                               \
+            {                                                                           \
+            case rocsparse_indextype_u16:                                               \
+            {                                                                           \
+                return rocsparse_status_not_implemented;                                \
+            }                                                                           \
+            case rocsparse_indextype_i32:                                               \
+            {                                                                           \
+                return rocsparse_spmv_semiring_template<int64_t, int32_t, TYPE>(ts...); \
+            }                                                                           \
+            case rocsparse_indextype_i64:                                               \
+            {                                                                           \
+                return rocsparse_spmv_semiring_template<int64_t, int64_t, TYPE>(ts...); \
+            }                                                                           \
+            }                                                                           \
+        }                                                                               \
+        }                                                                               \
+    }
+
+        DATATYPE_CASE(rocsparse_datatype_f32_r, float);
+        DATATYPE_CASE(rocsparse_datatype_f64_r, double);
+        DATATYPE_CASE(rocsparse_datatype_f32_c, rocsparse_float_complex);
+        DATATYPE_CASE(rocsparse_datatype_f64_c, rocsparse_double_complex);
+
+#undef DATATYPE_CASE
+    }
+    // LCOV_EXCL_START
+    return rocsparse_status_invalid_value;
+    // LCOV_EXCL_STOP
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_spmv_semiring(rocsparse_handle            handle,
+                                                    rocsparse_operation         trans,
+                                                    rocsparse_semiring          semiring,
+                                                    const void*                 alpha,
+                                                    const rocsparse_spmat_descr mat,
+                                                    const rocsparse_dnvec_descr x,
+                                                    const void*                 beta,
+                                                    const rocsparse_dnvec_descr y,
+                                                    rocsparse_datatype          compute_type)
+{
+    // Check for invalid handle
+    RETURN_IF_INVALID_HANDLE(handle);
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_spmv_semiring",
+              trans,
+              semiring,
+              (const void*&)alpha,
+              (const void*&)mat,
+              (const void*&)x,
+              (const void*&)beta,
+              (const void*&)y,
+              compute_type);
+
+    // Check for invalid descriptors
+    RETURN_IF_NULLPTR(mat);
+    RETURN_IF_NULLPTR(x);
+    RETURN_IF_NULLPTR(y);
+
+    // Check for valid pointers
+    RETURN_IF_NULLPTR(alpha);
+    RETURN_IF_NULLPTR(beta);
+
+    if(rocsparse_enum_utils::is_invalid(trans))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(semiring))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    if(rocsparse_enum_utils::is_invalid(compute_type))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check if descriptors are initialized
+    // LCOV_EXCL_START
+    if(mat->init == false || x->init == false || y->init == false)
+    {
+        return rocsparse_status_not_initialized;
+    }
+    // LCOV_EXCL_STOP
+
+    // Check for matching types while we do not support mixed precision computation
+    if(compute_type != mat->data_type || compute_type != x->data_type
+       || compute_type != y->data_type)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    return rocsparse_spmv_semiring_dynamic_dispatch(mat->row_type,
+                                                    mat->col_type,
+                                                    compute_type,
+                                                    handle,
+                                                    trans,
+                                                    semiring,
+                                                    alpha,
+                                                    mat,
+                                                    x,
+                                                    beta,
+                                                    y);
+}
@@ -296,13 +296,13 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
     }
 
     // Check analysis policy
-    if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force)
+    if(rocsparse_enum_utils::is_invalid(analysis))
     {
         return rocsparse_status_invalid_value;
     }
 
     // Check solve policy
-    if(solve != rocsparse_solve_policy_auto)
+    if(rocsparse_enum_utils::is_invalid(solve))
     {
         return rocsparse_status_invalid_value;
     }
@@ -334,6 +334,15 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
         return rocsparse_status_invalid_pointer;
     }
 
+    // Fingerprint of the sparsity pattern, if only the values have changed
+    unsigned long long pattern_hash = 0;
+
+    if(analysis == rocsparse_analysis_policy_numeric)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash(
+            handle, m, nnz, csr_row_ptr, csr_col_ind, temp_buffer, &pattern_hash));
+    }
+
     // Switch between lower and upper triangular analysis
     if(descr->fill_mode == rocsparse_fill_mode_upper)
     {
@@ -363,13 +372,34 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
                 return rocsparse_status_success;
             }
 
-            if(trans_A == rocsparse_operation_transpose && info->csrsvt_upper_info != nullptr)
+            if(trans_A == rocsparse_operation_transpose && info->csrsvt_upper_info != nullptr
+               && info->csrsvt_upper_info->trmt_dep_count == nullptr)
             {
                 // csrsv meta data
                 info->csrsmt_upper_info = info->csrsvt_upper_info;
                 return rocsparse_status_success;
             }
         }
+        else if(analysis == rocsparse_analysis_policy_numeric)
+        {
+            // Only the values have changed, re-use the meta data if it has been
+            // gathered for the same sparsity pattern
+            rocsparse_trm_info* csrsm = (trans_A == rocsparse_operation_none)
+                                            ? &info->csrsm_upper_info
+                                            : &info->csrsmt_upper_info;
+
+            if(rocsparse_trm_pattern_match(*csrsm, m, nnz, pattern_hash))
+            {
+                return rocsparse_status_success;
+            }
+
+            // The pattern has changed. Meta data that is shared with other routines
+            // is left to them, they will detect the change on their own.
+            if(rocsparse_check_trm_shared(info, *csrsm))
+            {
+                *csrsm = nullptr;
+            }
+        }
 
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used
@@ -439,13 +469,34 @@ rocsparse_status rocsparse_csrsm_analysis_template(rocsparse_handle          han
                 return rocsparse_status_success;
             }
 
-            if(trans_A == rocsparse_operation_transpose && info->csrsvt_lower_info != nullptr)
+            if(trans_A == rocsparse_operation_transpose && info->csrsvt_lower_info != nullptr
+               && info->csrsvt_lower_info->trmt_dep_count == nullptr)
             {
                 // csrsv meta data
                 info->csrsm_upper_info = info->csrsvt_lower_info;
                 return rocsparse_status_success;
             }
         }
+        else if(analysis == rocsparse_analysis_policy_numeric)
+        {
+            // Only the values have changed, re-use the meta data if it has been
+            // gathered for the same sparsity pattern
+            rocsparse_trm_info* csrsm = (trans_A == rocsparse_operation_none)
+                                            ? &info->csrsm_lower_info
+                                            : &info->csrsmt_lower_info;
+
+            if(rocsparse_trm_pattern_match(*csrsm, m, nnz, pattern_hash))
+            {
+                return rocsparse_status_success;
+            }
+
+            // The pattern has changed. Meta data that is shared with other routines
+            // is left to them, they will detect the change on their own.
+            if(rocsparse_check_trm_shared(info, *csrsm))
+            {
+                *csrsm = nullptr;
+            }
+        }
 
         // User is explicitly asking to force a re-analysis, or no valid data has been
         // found to be re-used
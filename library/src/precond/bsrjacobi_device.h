@@ -0,0 +1,430 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef BSRJACOBI_DEVICE_H
+#define BSRJACOBI_DEVICE_H
+
+#include "common.h"
+
+// Position of the diagonal block within a BSR row, -1 if the block is missing
+__device__ __forceinline__ rocsparse_int bsrjacobi_find_diag(rocsparse_int        row,
+                                                             const rocsparse_int* bsr_row_ptr,
+                                                             const rocsparse_int* bsr_col_ind,
+                                                             rocsparse_index_base idx_base)
+{
+    rocsparse_int row_begin = bsr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = bsr_row_ptr[row + 1] - idx_base;
+
+    // Binary search, column indices are sorted
+    while(row_begin < row_end)
+    {
+        rocsparse_int mid = row_begin + ((row_end - row_begin) >> 1);
+        rocsparse_int col = bsr_col_ind[mid] - idx_base;
+
+        if(col == row)
+        {
+            return mid;
+        }
+        else if(col < row)
+        {
+            row_begin = mid + 1;
+        }
+        else
+        {
+            row_end = mid;
+        }
+    }
+
+    return -1;
+}
+
+// Gauss-Jordan inversion with partial pivoting of the diagonal blocks. Each group of
+// BSRDIM x BSRDIM threads inverts one block in shared memory, such that BLOCKSIZE / BSRDIM^2
+// block rows are processed per thread block. bsr_dim may be smaller than BSRDIM.
+template <unsigned int BLOCKSIZE, unsigned int BSRDIM, typename T>
+__device__ void bsrjacobi_setup_device(rocsparse_direction  dir,
+                                       rocsparse_int        mb,
+                                       const rocsparse_int* bsr_row_ptr,
+                                       const rocsparse_int* bsr_col_ind,
+                                       const T*             bsr_val,
+                                       rocsparse_int        bsr_dim,
+                                       T*                   bsr_diag_inv,
+                                       rocsparse_int*       zero_pivot,
+                                       rocsparse_index_base idx_base)
+{
+    // Number of block rows per thread block
+    constexpr static unsigned int NROWS = BLOCKSIZE / (BSRDIM * BSRDIM);
+
+    // Local block row and position of the thread within the block
+    rocsparse_int lid = threadIdx.x / (BSRDIM * BSRDIM);
+    rocsparse_int bi  = (threadIdx.x % (BSRDIM * BSRDIM)) / BSRDIM;
+    rocsparse_int bj  = threadIdx.x % BSRDIM;
+
+    // Current block row
+    rocsparse_int row = blockIdx.x * NROWS + lid;
+
+    // Threads that do not belong to a block row still take part in the synchronization
+    bool active = (lid < NROWS && row < mb);
+    bool inside = (active && bi < bsr_dim && bj < bsr_dim);
+    bool leader = (active && bi == 0 && bj == 0);
+
+    // Zero pivot tracker
+    bool pivot = false;
+
+    // Shared memory to hold the blocks and the row permutations
+    __shared__ T             sdata[NROWS][BSRDIM][BSRDIM + 1];
+    __shared__ rocsparse_int sperm[NROWS][BSRDIM];
+    __shared__ rocsparse_int sdiag[NROWS];
+
+    if(leader)
+    {
+        sdiag[lid] = bsrjacobi_find_diag(row, bsr_row_ptr, bsr_col_ind, idx_base);
+    }
+
+    __syncthreads();
+
+    // Load the diagonal block, a missing block is treated as zero block
+    if(inside)
+    {
+        rocsparse_int diag = sdiag[lid];
+
+        sdata[lid][bi][bj]
+            = (diag != -1) ? bsr_val[BSR_IND(diag, bi, bj, dir)] : static_cast<T>(0);
+    }
+
+    __syncthreads();
+
+    for(rocsparse_int k = 0; k < bsr_dim; ++k)
+    {
+        // Search the pivot row
+        if(leader)
+        {
+            rocsparse_int p   = k;
+            auto          max = rocsparse_abs(sdata[lid][k][k]);
+
+            for(rocsparse_int i = k + 1; i < bsr_dim; ++i)
+            {
+                auto val = rocsparse_abs(sdata[lid][i][k]);
+
+                if(val > max)
+                {
+                    p   = i;
+                    max = val;
+                }
+            }
+
+            sperm[lid][k] = p;
+        }
+
+        __syncthreads();
+
+        // Swap rows k and p
+        if(inside && bi == k)
+        {
+            rocsparse_int p = sperm[lid][k];
+
+            if(p != k)
+            {
+                T tmp             = sdata[lid][k][bj];
+                sdata[lid][k][bj] = sdata[lid][p][bj];
+                sdata[lid][p][bj] = tmp;
+            }
+        }
+
+        __syncthreads();
+
+        T diag = static_cast<T>(1);
+        T aik  = static_cast<T>(0);
+        T akj  = static_cast<T>(0);
+        T aij  = static_cast<T>(0);
+
+        if(inside)
+        {
+            diag = sdata[lid][k][k];
+            aik  = sdata[lid][bi][k];
+            akj  = sdata[lid][k][bj];
+            aij  = sdata[lid][bi][bj];
+
+            // Singular block, carry on with a unit pivot
+            if(diag == static_cast<T>(0))
+            {
+                pivot = true;
+                diag  = static_cast<T>(1);
+            }
+        }
+
+        // Make sure all values have been read before updating
+        __syncthreads();
+
+        if(inside)
+        {
+            if(bi == k && bj == k)
+            {
+                sdata[lid][bi][bj] = static_cast<T>(1) / diag;
+            }
+            else if(bi == k)
+            {
+                sdata[lid][bi][bj] = akj / diag;
+            }
+            else if(bj == k)
+            {
+                sdata[lid][bi][bj] = -aik / diag;
+            }
+            else
+            {
+                sdata[lid][bi][bj] = aij - aik * akj / diag;
+            }
+        }
+
+        __syncthreads();
+    }
+
+    // Undo the row permutations by swapping columns in reverse order
+    for(rocsparse_int k = bsr_dim - 1; k >= 0; --k)
+    {
+        if(inside && bj == k)
+        {
+            rocsparse_int p = sperm[lid][k];
+
+            if(p != k)
+            {
+                T tmp             = sdata[lid][bi][k];
+                sdata[lid][bi][k] = sdata[lid][bi][p];
+                sdata[lid][bi][p] = tmp;
+            }
+        }
+
+        __syncthreads();
+    }
+
+    // Write the inverted block back to global memory
+    if(inside)
+    {
+        bsr_diag_inv[BSR_IND(row, bi, bj, dir)] = sdata[lid][bi][bj];
+    }
+
+    // A zero pivot is found by all threads of the block, only one of them reports it
+    if(leader && pivot)
+    {
+        atomicMin(zero_pivot, row + idx_base);
+    }
+}
+
+// Gauss-Jordan inversion with partial pivoting for arbitrary block dimensions. Each
+// thread block inverts one block in place in global memory, the row permutation is
+// stored in perm.
+template <unsigned int BLOCKSIZE, typename T>
+__device__ void bsrjacobi_setup_general_device(rocsparse_direction  dir,
+                                               rocsparse_int        mb,
+                                               const rocsparse_int* bsr_row_ptr,
+                                               const rocsparse_int* bsr_col_ind,
+                                               const T*             bsr_val,
+                                               rocsparse_int        bsr_dim,
+                                               T*                   bsr_diag_inv,
+                                               rocsparse_int*       perm,
+                                               rocsparse_int*       zero_pivot,
+                                               rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = threadIdx.x;
+
+    // Current block row
+    rocsparse_int row = blockIdx.x;
+
+    // Permutation of the current block row
+    perm += row * bsr_dim;
+
+    // Zero pivot tracker
+    bool pivot = false;
+
+    __shared__ rocsparse_int sdiag;
+
+    if(tid == 0)
+    {
+        sdiag = bsrjacobi_find_diag(row, bsr_row_ptr, bsr_col_ind, idx_base);
+    }
+
+    __syncthreads();
+
+    // Load the diagonal block, a missing block is treated as zero block
+    for(rocsparse_int idx = tid; idx < bsr_dim * bsr_dim; idx += BLOCKSIZE)
+    {
+        rocsparse_int bi = idx / bsr_dim;
+        rocsparse_int bj = idx % bsr_dim;
+
+        bsr_diag_inv[BSR_IND(row, bi, bj, dir)]
+            = (sdiag != -1) ? bsr_val[BSR_IND(sdiag, bi, bj, dir)] : static_cast<T>(0);
+    }
+
+    __syncthreads();
+
+    for(rocsparse_int k = 0; k < bsr_dim; ++k)
+    {
+        // Search the pivot row
+        if(tid == 0)
+        {
+            rocsparse_int p   = k;
+            auto          max = rocsparse_abs(bsr_diag_inv[BSR_IND(row, k, k, dir)]);
+
+            for(rocsparse_int i = k + 1; i < bsr_dim; ++i)
+            {
+                auto val = rocsparse_abs(bsr_diag_inv[BSR_IND(row, i, k, dir)]);
+
+                if(val > max)
+                {
+                    p   = i;
+                    max = val;
+                }
+            }
+
+            perm[k] = p;
+        }
+
+        __syncthreads();
+
+        rocsparse_int p = perm[k];
+
+        // Swap rows k and p
+        if(p != k)
+        {
+            for(rocsparse_int bj = tid; bj < bsr_dim; bj += BLOCKSIZE)
+            {
+                T tmp                                  = bsr_diag_inv[BSR_IND(row, k, bj, dir)];
+                bsr_diag_inv[BSR_IND(row, k, bj, dir)] = bsr_diag_inv[BSR_IND(row, p, bj, dir)];
+                bsr_diag_inv[BSR_IND(row, p, bj, dir)] = tmp;
+            }
+        }
+
+        __syncthreads();
+
+        T diag = bsr_diag_inv[BSR_IND(row, k, k, dir)];
+
+        // Singular block, carry on with a unit pivot
+        if(diag == static_cast<T>(0))
+        {
+            pivot = true;
+            diag  = static_cast<T>(1);
+        }
+
+        // Update all entries outside of row and column k, they are not modified here
+        for(rocsparse_int idx = tid; idx < bsr_dim * bsr_dim; idx += BLOCKSIZE)
+        {
+            rocsparse_int bi = idx / bsr_dim;
+            rocsparse_int bj = idx % bsr_dim;
+
+            if(bi != k && bj != k)
+            {
+                bsr_diag_inv[BSR_IND(row, bi, bj, dir)]
+                    -= bsr_diag_inv[BSR_IND(row, bi, k, dir)]
+                       * bsr_diag_inv[BSR_IND(row, k, bj, dir)] / diag;
+            }
+        }
+
+        __syncthreads();
+
+        // Update row and column k
+        for(rocsparse_int idx = tid; idx < bsr_dim; idx += BLOCKSIZE)
+        {
+            if(idx == k)
+            {
+                bsr_diag_inv[BSR_IND(row, k, k, dir)] = static_cast<T>(1) / diag;
+            }
+            else
+            {
+                bsr_diag_inv[BSR_IND(row, k, idx, dir)] /= diag;
+                bsr_diag_inv[BSR_IND(row, idx, k, dir)]
+                    = -bsr_diag_inv[BSR_IND(row, idx, k, dir)] / diag;
+            }
+        }
+
+        __syncthreads();
+    }
+
+    // Undo the row permutations by swapping columns in reverse order
+    for(rocsparse_int k = bsr_dim - 1; k >= 0; --k)
+    {
+        rocsparse_int p = perm[k];
+
+        if(p != k)
+        {
+            for(rocsparse_int bi = tid; bi < bsr_dim; bi += BLOCKSIZE)
+            {
+                T tmp                                  = bsr_diag_inv[BSR_IND(row, bi, k, dir)];
+                bsr_diag_inv[BSR_IND(row, bi, k, dir)] = bsr_diag_inv[BSR_IND(row, bi, p, dir)];
+                bsr_diag_inv[BSR_IND(row, bi, p, dir)] = tmp;
+            }
+        }
+
+        __syncthreads();
+    }
+
+    if(tid == 0 && pivot)
+    {
+        atomicMin(zero_pivot, row + idx_base);
+    }
+}
+
+// y = alpha * D^{-1} * x + beta * y, where D^{-1} holds the inverted diagonal blocks
+template <unsigned int BLOCKSIZE, typename T>
+__device__ void bsrjacobi_apply_device(rocsparse_direction dir,
+                                       rocsparse_int       mb,
+                                       rocsparse_int       bsr_dim,
+                                       T                   alpha,
+                                       const T* __restrict__ bsr_diag_inv,
+                                       const T* __restrict__ x,
+                                       T beta,
+                                       T* __restrict__ y)
+{
+    rocsparse_int gid = blockIdx.x * BLOCKSIZE + threadIdx.x;
+
+    if(gid >= mb * bsr_dim)
+    {
+        return;
+    }
+
+    // Block row and row within the block
+    rocsparse_int row = gid / bsr_dim;
+    rocsparse_int bi  = gid % bsr_dim;
+
+    // Offset into x
+    x += row * bsr_dim;
+
+    T sum = static_cast<T>(0);
+
+    for(rocsparse_int bj = 0; bj < bsr_dim; ++bj)
+    {
+        sum = rocsparse_fma(bsr_diag_inv[BSR_IND(row, bi, bj, dir)], x[bj], sum);
+    }
+
+    if(beta != static_cast<T>(0))
+    {
+        y[gid] = rocsparse_fma(beta, y[gid], alpha * sum);
+    }
+    else
+    {
+        y[gid] = alpha * sum;
+    }
+}
+
+#endif // BSRJACOBI_DEVICE_H
@@ -0,0 +1,283 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRCHEB_DEVICE_H
+#define CSRCHEB_DEVICE_H
+
+#include "common.h"
+
+// Initial residual r = b - A x and search direction d = r / theta
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+__device__ void csrcheb_residual_device(rocsparse_int        m,
+                                        const rocsparse_int* csr_row_ptr,
+                                        const rocsparse_int* csr_col_ind,
+                                        const T*             csr_val,
+                                        T                    inv_theta,
+                                        const T*             b,
+                                        const T*             x,
+                                        T*                   r,
+                                        T*                   d,
+                                        rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(csr_val[j], rocsparse_ldg(x + csr_col_ind[j] - idx_base), sum);
+        }
+
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        if(lid == WF_SIZE - 1)
+        {
+            T res = b[row] - sum;
+
+            r[row] = res;
+            d[row] = res * inv_theta;
+        }
+    }
+}
+
+// Fused Chebyshev step, the product A d is combined with the three-term recurrence
+//   x = x + d
+//   r = r - A d
+//   d = alpha * d + beta * r
+// The new direction is written to d_next since d is still read by other rows.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+__device__ void csrcheb_step_device(rocsparse_int        m,
+                                    const rocsparse_int* csr_row_ptr,
+                                    const rocsparse_int* csr_col_ind,
+                                    const T*             csr_val,
+                                    T                    alpha,
+                                    T                    beta,
+                                    const T*             d,
+                                    T*                   d_next,
+                                    T*                   r,
+                                    T*                   x,
+                                    rocsparse_index_base idx_base)
+{
+    int lid = hipThreadIdx_x & (WF_SIZE - 1);
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(csr_val[j], rocsparse_ldg(d + csr_col_ind[j] - idx_base), sum);
+        }
+
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        if(lid == WF_SIZE - 1)
+        {
+            T dk  = d[row];
+            T res = r[row] - sum;
+
+            x[row]      = x[row] + dk;
+            r[row]      = res;
+            d_next[row] = alpha * dk + beta * res;
+        }
+    }
+}
+
+// Last Chebyshev step x = x + d, no product with A is required
+template <unsigned int BLOCKSIZE, typename T>
+__device__ void csrcheb_update_device(rocsparse_int m, const T* d, T* x)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    x[row] = x[row] + d[row];
+}
+
+// Deterministic start vector of the power iteration with entries in [-1, 1), the partial
+// sums of its squared norm are stored per block
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__device__ void csrcheb_power_init_device(rocsparse_int m, T* v, T* partial_dot, U* partial_nrm)
+{
+    int tid = hipThreadIdx_x;
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int inc = hipGridDim_x * BLOCKSIZE;
+
+    __shared__ U snrm[BLOCKSIZE];
+
+    U nrm = static_cast<U>(0);
+
+    for(rocsparse_int row = gid; row < m; row += inc)
+    {
+        uint32_t hash = static_cast<uint32_t>(row) * 2654435761u;
+        U        val  = static_cast<U>((hash >> 16) & 0xffff) / static_cast<U>(32768) - 1;
+
+        v[row] = static_cast<T>(val);
+        nrm += val * val;
+    }
+
+    snrm[tid] = nrm;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, snrm);
+
+    if(tid == 0)
+    {
+        partial_dot[hipBlockIdx_x] = static_cast<T>(0);
+        partial_nrm[hipBlockIdx_x] = snrm[0];
+    }
+}
+
+// Power iteration step w = A v / ||v||, the partial sums of v^H w / ||v|| and ||w||^2 are
+// stored per block. The squared norm of v is read from device memory such that the
+// iteration does not require any synchronization with the host.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__device__ void csrcheb_power_device(rocsparse_int        m,
+                                     const rocsparse_int* csr_row_ptr,
+                                     const rocsparse_int* csr_col_ind,
+                                     const T*             csr_val,
+                                     const T*             v,
+                                     T*                   w,
+                                     const U*             nrm2,
+                                     T*                   partial_dot,
+                                     U*                   partial_nrm,
+                                     rocsparse_index_base idx_base)
+{
+    int tid = hipThreadIdx_x;
+    int lid = tid & (WF_SIZE - 1);
+
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+    rocsparse_int nwf = hipGridDim_x * BLOCKSIZE / WF_SIZE;
+
+    __shared__ T sdot[BLOCKSIZE];
+    __shared__ U snrm[BLOCKSIZE];
+
+    // A vanishing vector stays zero
+    U scale = (*nrm2 > static_cast<U>(0)) ? static_cast<U>(1) / sqrt(*nrm2) : static_cast<U>(0);
+
+    T dot = static_cast<T>(0);
+    U nrm = static_cast<U>(0);
+
+    // Loop over rows
+    for(rocsparse_int row = gid / WF_SIZE; row < m; row += nwf)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int j = row_begin + lid; j < row_end; j += WF_SIZE)
+        {
+            sum = rocsparse_fma(csr_val[j], rocsparse_ldg(v + csr_col_ind[j] - idx_base), sum);
+        }
+
+        sum = rocsparse_wfreduce_sum<WF_SIZE>(sum);
+
+        if(lid == WF_SIZE - 1)
+        {
+            sum = sum * static_cast<T>(scale);
+
+            w[row] = sum;
+
+            dot = rocsparse_fma(rocsparse_conj(v[row]) * static_cast<T>(scale), sum, dot);
+            nrm += rocsparse_real(rocsparse_conj(sum) * sum);
+        }
+    }
+
+    sdot[tid] = dot;
+    snrm[tid] = nrm;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdot);
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, snrm);
+
+    if(tid == 0)
+    {
+        partial_dot[hipBlockIdx_x] = sdot[0];
+        partial_nrm[hipBlockIdx_x] = snrm[0];
+    }
+}
+
+// Reduction of the partial sums, the Rayleigh quotient is the current estimate of the
+// largest eigenvalue
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__device__ void csrcheb_power_reduce_device(rocsparse_int nblocks,
+                                            const T*      partial_dot,
+                                            const U*      partial_nrm,
+                                            U*            nrm2,
+                                            U*            lambda)
+{
+    int tid = hipThreadIdx_x;
+
+    __shared__ T sdot[BLOCKSIZE];
+    __shared__ U snrm[BLOCKSIZE];
+
+    T dot = static_cast<T>(0);
+    U nrm = static_cast<U>(0);
+
+    for(rocsparse_int i = tid; i < nblocks; i += BLOCKSIZE)
+    {
+        dot = dot + partial_dot[i];
+        nrm += partial_nrm[i];
+    }
+
+    sdot[tid] = dot;
+    snrm[tid] = nrm;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sdot);
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, snrm);
+
+    if(tid == 0)
+    {
+        *lambda = rocsparse_real(sdot[0]);
+        *nrm2   = snrm[0];
+    }
+}
+
+#endif // CSRCHEB_DEVICE_H
@@ -0,0 +1,378 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRCOLOR_DEVICE_H
+#define CSRCOLOR_DEVICE_H
+
+#include "common.h"
+
+// Priority of a row, used to break symmetry between neighbouring rows
+__device__ __forceinline__ unsigned int csrcolor_hash(unsigned int x)
+{
+    x = ((x >> 16) ^ x) * 0x45d9f3b;
+    x = ((x >> 16) ^ x) * 0x45d9f3b;
+    x = (x >> 16) ^ x;
+
+    return x;
+}
+
+// Returns true, if row j has higher priority than row i
+__device__ __forceinline__ bool csrcolor_greater(rocsparse_int j, rocsparse_int i)
+{
+    unsigned int hj = csrcolor_hash(j);
+    unsigned int hi = csrcolor_hash(i);
+
+    return (hj > hi) || (hj == hi && j > i);
+}
+
+// Jones-Plassmann round. Each uncolored row that has the highest (lowest) priority
+// among all of its uncolored neighbours is assigned the color 2 * round (2 * round + 1).
+// Rows that have been colored within the current round are still considered to be
+// uncolored, thus the result does not depend on the order of execution.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_assign_kernel(rocsparse_int m,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                rocsparse_int round,
+                                rocsparse_int* __restrict__ coloring,
+                                rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int first_color = 2 * round;
+
+    // Skip rows that have been colored in a previous round
+    rocsparse_int color = coloring[row];
+
+    if(color != -1 && color < first_color)
+    {
+        return;
+    }
+
+    bool is_max = true;
+    bool is_min = true;
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        // Skip diagonal
+        if(col == row)
+        {
+            continue;
+        }
+
+        // Skip neighbours that have been colored in a previous round
+        rocsparse_int col_color = coloring[col];
+
+        if(col_color != -1 && col_color < first_color)
+        {
+            continue;
+        }
+
+        if(csrcolor_greater(col, row))
+        {
+            is_max = false;
+        }
+        else
+        {
+            is_min = false;
+        }
+    }
+
+    if(is_max)
+    {
+        coloring[row] = first_color;
+    }
+    else if(is_min)
+    {
+        coloring[row] = first_color + 1;
+    }
+}
+
+// For structurally unsymmetric matrices, two neighbouring rows might have been
+// assigned the same color in the current round. The row with lower priority is
+// marked to lose its color.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_conflict_kernel(rocsparse_int m,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                  rocsparse_int round,
+                                  const rocsparse_int* __restrict__ coloring,
+                                  int* __restrict__ conflict,
+                                  rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Only rows that have been colored in the current round can conflict
+    rocsparse_int color = coloring[row];
+
+    if(color < 2 * round)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col != row && coloring[col] == color)
+        {
+            conflict[csrcolor_greater(col, row) ? row : col] = 1;
+        }
+    }
+}
+
+// Reset the color of all conflicting rows and count the remaining uncolored rows
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_resolve_kernel(rocsparse_int m,
+                                 const int* __restrict__ conflict,
+                                 rocsparse_int* __restrict__ coloring,
+                                 rocsparse_int* __restrict__ remaining)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    __shared__ rocsparse_int sdata[BLOCKSIZE];
+
+    rocsparse_int uncolored = 0;
+
+    if(row < m)
+    {
+        if(conflict[row] == 1)
+        {
+            coloring[row] = -1;
+        }
+
+        uncolored = (coloring[row] == -1) ? 1 : 0;
+    }
+
+    sdata[hipThreadIdx_x] = uncolored;
+
+    __syncthreads();
+
+    rocsparse_blockreduce_sum<BLOCKSIZE>(hipThreadIdx_x, sdata);
+
+    if(hipThreadIdx_x == 0 && sdata[0] > 0)
+    {
+        atomicAdd(remaining, sdata[0]);
+    }
+}
+
+// Count the rows of each color and determine the row with lowest index of each color.
+// The latter is never moved by the balancing, such that no color can become empty.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_histogram_kernel(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ coloring,
+                                   rocsparse_int* __restrict__ color_size,
+                                   rocsparse_int* __restrict__ color_keeper)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int color = coloring[row];
+
+    atomicAdd(&color_size[color], 1);
+    atomicMin(&color_keeper[color], row);
+}
+
+// Balancing round. Rows of colors that hold more than target rows are moved into
+// colors that hold less than target rows, if none of their neighbours carries the
+// new color. Decisions are solely based on the coloring of the previous round,
+// thus the result does not depend on the order of execution.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_balance_kernel(rocsparse_int m,
+                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                 rocsparse_int ncolors,
+                                 rocsparse_int target,
+                                 rocsparse_int round,
+                                 const rocsparse_int* __restrict__ color_size,
+                                 const rocsparse_int* __restrict__ color_keeper,
+                                 const rocsparse_int* __restrict__ prev_coloring,
+                                 rocsparse_int* __restrict__ coloring,
+                                 rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int color = prev_coloring[row];
+    rocsparse_int size  = color_size[color];
+
+    // Only rows of over-full colors are moved
+    if(size <= target || color_keeper[color] == row)
+    {
+        return;
+    }
+
+    // Select roughly as many rows as the color exceeds the target
+    unsigned int h = csrcolor_hash(csrcolor_hash(row) + round);
+
+    if(h % size >= size - target)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Spread the rows over the under-full colors, starting at a pseudo-random color
+    rocsparse_int start = h % ncolors;
+
+    for(rocsparse_int k = 0; k < ncolors; ++k)
+    {
+        rocsparse_int c = (start + k) % ncolors;
+
+        if(color_size[c] >= target)
+        {
+            continue;
+        }
+
+        bool admissible = true;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            if(prev_coloring[csr_col_ind[j] - idx_base] == c)
+            {
+                admissible = false;
+                break;
+            }
+        }
+
+        if(admissible)
+        {
+            coloring[row] = c;
+            return;
+        }
+    }
+}
+
+// For structurally unsymmetric matrices, a moved row might conflict with a row it is
+// not connected to in its own row. Moved rows that conflict are marked to be reset.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_balance_conflict_kernel(rocsparse_int m,
+                                          const rocsparse_int* __restrict__ csr_row_ptr,
+                                          const rocsparse_int* __restrict__ csr_col_ind,
+                                          const rocsparse_int* __restrict__ prev_coloring,
+                                          const rocsparse_int* __restrict__ coloring,
+                                          int* __restrict__ conflict,
+                                          rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int color     = coloring[row];
+    bool          row_moved = (color != prev_coloring[row]);
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col == row || coloring[col] != color)
+        {
+            continue;
+        }
+
+        bool col_moved = (color != prev_coloring[col]);
+
+        if(row_moved && col_moved)
+        {
+            conflict[csrcolor_greater(col, row) ? row : col] = 1;
+        }
+        else if(row_moved)
+        {
+            conflict[row] = 1;
+        }
+        else if(col_moved)
+        {
+            conflict[col] = 1;
+        }
+    }
+}
+
+// Move conflicting rows back to their previous color
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcolor_balance_resolve_kernel(rocsparse_int m,
+                                         const int* __restrict__ conflict,
+                                         const rocsparse_int* __restrict__ prev_coloring,
+                                         rocsparse_int* __restrict__ coloring)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(conflict[row] == 1)
+    {
+        coloring[row] = prev_coloring[row];
+    }
+}
+
+#endif // CSRCOLOR_DEVICE_H
@@ -0,0 +1,269 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRFSAI_DEVICE_H
+#define CSRFSAI_DEVICE_H
+
+#include "common.h"
+
+// Number of entries of each row of G, that is the strictly lower part of the pattern and the
+// diagonal. Column indices of the pattern are sorted.
+template <unsigned int BLOCKSIZE>
+__device__ void csrfsai_nnz_device(rocsparse_int        m,
+                                   const rocsparse_int* csr_row_ptr_S,
+                                   const rocsparse_int* csr_col_ind_S,
+                                   rocsparse_int*       csr_row_ptr_G,
+                                   rocsparse_index_base idx_base_S,
+                                   rocsparse_index_base idx_base_G)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row == 0)
+    {
+        csr_row_ptr_G[0] = idx_base_G;
+    }
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr_S[row] - idx_base_S;
+    rocsparse_int row_end   = csr_row_ptr_S[row + 1] - idx_base_S;
+    rocsparse_int row_first = row_begin;
+
+    // Binary search for the first entry that is not in the strictly lower part
+    while(row_begin < row_end)
+    {
+        rocsparse_int mid = row_begin + ((row_end - row_begin) >> 1);
+
+        if(csr_col_ind_S[mid] - idx_base_S < row)
+        {
+            row_begin = mid + 1;
+        }
+        else
+        {
+            row_end = mid;
+        }
+    }
+
+    csr_row_ptr_G[row + 1] = row_begin - row_first + 1;
+}
+
+// Column indices of G
+template <unsigned int BLOCKSIZE>
+__device__ void csrfsai_fill_device(rocsparse_int        m,
+                                    const rocsparse_int* csr_row_ptr_S,
+                                    const rocsparse_int* csr_col_ind_S,
+                                    const rocsparse_int* csr_row_ptr_G,
+                                    rocsparse_int*       csr_col_ind_G,
+                                    rocsparse_index_base idx_base_S,
+                                    rocsparse_index_base idx_base_G)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin_S = csr_row_ptr_S[row] - idx_base_S;
+    rocsparse_int row_begin_G = csr_row_ptr_G[row] - idx_base_G;
+    rocsparse_int row_end_G   = csr_row_ptr_G[row + 1] - idx_base_G;
+
+    for(rocsparse_int j = row_begin_G; j < row_end_G - 1; ++j)
+    {
+        csr_col_ind_G[j] = csr_col_ind_S[row_begin_S + j - row_begin_G] - idx_base_S + idx_base_G;
+    }
+
+    csr_col_ind_G[row_end_G - 1] = row + idx_base_G;
+}
+
+// Each wavefront computes the rows of G by solving the local problems A(J, J) g = e_n,
+// where J holds the column indices of the row of G. The local matrix is assembled into a
+// dense n x n column major slot of the workspace and factorized by Cholesky decomposition,
+// such that g = L^-H e_n is the row of G after scaling.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__device__ void csrfsai_device(rocsparse_int        m,
+                               const rocsparse_int* csr_row_ptr_A,
+                               const rocsparse_int* csr_col_ind_A,
+                               const T*             csr_val_A,
+                               const rocsparse_int* csr_row_ptr_G,
+                               const rocsparse_int* csr_col_ind_G,
+                               T*                   csr_val_G,
+                               rocsparse_int        nmax,
+                               T*                   workspace,
+                               rocsparse_int*       zero_pivot,
+                               rocsparse_index_base idx_base_A,
+                               rocsparse_index_base idx_base_G)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    // Global wavefront id and number of wavefronts
+    rocsparse_int gid = hipBlockIdx_x * (BLOCKSIZE / WFSIZE) + wid;
+    rocsparse_int nwf = hipGridDim_x * (BLOCKSIZE / WFSIZE);
+
+    // Dense slot of this wavefront
+    T* local = workspace + size_t(gid) * nmax * nmax;
+
+    for(rocsparse_int row = gid; row < m; row += nwf)
+    {
+        rocsparse_int row_begin = csr_row_ptr_G[row] - idx_base_G;
+        rocsparse_int n         = csr_row_ptr_G[row + 1] - idx_base_G - row_begin;
+
+        // Assemble the lower part of A(J, J)
+        for(rocsparse_int idx = lid; idx < n * n; idx += WFSIZE)
+        {
+            rocsparse_int p = idx % n;
+            rocsparse_int q = idx / n;
+
+            if(p < q)
+            {
+                continue;
+            }
+
+            rocsparse_int row_A = csr_col_ind_G[row_begin + p] - idx_base_G;
+            rocsparse_int col_A = csr_col_ind_G[row_begin + q] - idx_base_G;
+
+            rocsparse_int row_begin_A = csr_row_ptr_A[row_A] - idx_base_A;
+            rocsparse_int row_end_A   = csr_row_ptr_A[row_A + 1] - idx_base_A;
+
+            T val = static_cast<T>(0);
+
+            // Binary search for the entry, column indices of A are sorted
+            while(row_begin_A < row_end_A)
+            {
+                rocsparse_int mid = row_begin_A + ((row_end_A - row_begin_A) >> 1);
+                rocsparse_int col = csr_col_ind_A[mid] - idx_base_A;
+
+                if(col == col_A)
+                {
+                    val = csr_val_A[mid];
+                    break;
+                }
+                else if(col < col_A)
+                {
+                    row_begin_A = mid + 1;
+                }
+                else
+                {
+                    row_end_A = mid;
+                }
+            }
+
+            local[idx] = val;
+        }
+
+        __threadfence_block();
+
+        // Cholesky decomposition of the lower part
+        for(rocsparse_int k = 0; k < n; ++k)
+        {
+            auto diag = rocsparse_real(local[k + k * n]);
+
+            // The local problem is not positive definite
+            if(diag <= static_cast<decltype(diag)>(0))
+            {
+                if(lid == 0)
+                {
+                    atomicMin(zero_pivot, row + idx_base_A);
+                }
+
+                diag = static_cast<decltype(diag)>(1);
+            }
+
+            diag = sqrt(diag);
+
+            for(rocsparse_int p = k + 1 + lid; p < n; p += WFSIZE)
+            {
+                local[p + k * n] = local[p + k * n] / diag;
+            }
+
+            if(lid == 0)
+            {
+                local[k + k * n] = static_cast<T>(diag);
+            }
+
+            __threadfence_block();
+
+            // Update of the trailing lower part
+            rocsparse_int nk = n - k - 1;
+
+            for(rocsparse_int idx = lid; idx < nk * nk; idx += WFSIZE)
+            {
+                rocsparse_int p = k + 1 + idx % nk;
+                rocsparse_int q = k + 1 + idx / nk;
+
+                if(p >= q)
+                {
+                    local[p + q * n]
+                        = local[p + q * n] - local[p + k * n] * rocsparse_conj(local[q + k * n]);
+                }
+            }
+
+            __threadfence_block();
+        }
+
+        // Solve L^H g = e_n into the row of G, the conjugate is stored such that
+        // G A G^H has unit diagonal
+        T* g = csr_val_G + row_begin;
+
+        for(rocsparse_int j = lid; j < n; j += WFSIZE)
+        {
+            g[j] = (j == n - 1) ? static_cast<T>(1) : static_cast<T>(0);
+        }
+
+        __threadfence_block();
+
+        for(rocsparse_int k = n - 1; k >= 0; --k)
+        {
+            T gk = g[k] / local[k + k * n];
+
+            for(rocsparse_int j = lid; j < k; j += WFSIZE)
+            {
+                g[j] = g[j] - rocsparse_conj(local[k + j * n]) * gk;
+            }
+
+            __threadfence_block();
+
+            if(lid == 0)
+            {
+                g[k] = gk;
+            }
+
+            __threadfence_block();
+        }
+
+        for(rocsparse_int j = lid; j < n; j += WFSIZE)
+        {
+            g[j] = rocsparse_conj(g[j]);
+        }
+
+        __threadfence_block();
+    }
+}
+
+#endif // CSRFSAI_DEVICE_H
@@ -0,0 +1,327 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRILUK_DEVICE_H
+#define CSRILUK_DEVICE_H
+
+#include "common.h"
+
+// Copy the entries of A into the level-of-fill pattern of its incomplete LU factorization.
+// Fill-in entries are initialized with zero.
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+__device__ void csriluk_scatter_device(rocsparse_int m,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ csr_val,
+                                       const rocsparse_int* __restrict__ csr_row_ptr_lu,
+                                       const rocsparse_int* __restrict__ csr_col_ind_lu,
+                                       T* __restrict__ csr_val_lu,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WF_SIZE - 1);
+    rocsparse_int wid = hipThreadIdx_x / WF_SIZE;
+
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WF_SIZE + wid;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    rocsparse_int row_begin_lu = csr_row_ptr_lu[row] - idx_base;
+    rocsparse_int row_end_lu   = csr_row_ptr_lu[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin_lu + lid; j < row_end_lu; j += WF_SIZE)
+    {
+        rocsparse_int col = csr_col_ind_lu[j];
+
+        // Binary search for the column in the (sorted) row of A
+        rocsparse_int l = row_begin;
+        rocsparse_int r = row_end;
+
+        while(l < r)
+        {
+            rocsparse_int mid = (l + r) >> 1;
+
+            if(csr_col_ind[mid] < col)
+            {
+                l = mid + 1;
+            }
+            else
+            {
+                r = mid;
+            }
+        }
+
+        csr_val_lu[j] = (l < row_end && csr_col_ind[l] == col) ? csr_val[l] : static_cast<T>(0);
+    }
+}
+
+// Zero based copy of the sparsity pattern of A, where all entries have level 0
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csriluk_levels_init(rocsparse_int m,
+                             rocsparse_int nnz,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             rocsparse_int* __restrict__ row_ptr_P,
+                             rocsparse_int* __restrict__ col_ind_P,
+                             float* __restrict__ lev_P,
+                             rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid < m + 1)
+    {
+        row_ptr_P[gid] = csr_row_ptr[gid] - idx_base;
+    }
+
+    if(gid < nnz)
+    {
+        col_ind_P[gid] = csr_col_ind[gid] - idx_base;
+        lev_P[gid]     = 0.0f;
+    }
+}
+
+// Number of entries of the strictly lower part L and the strictly upper part U of each
+// row of the level-of-fill pattern P, that may still produce fill-in. Each thread
+// processes a row.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csriluk_levels_split_count(rocsparse_int m,
+                                    const rocsparse_int* __restrict__ row_ptr_P,
+                                    const rocsparse_int* __restrict__ col_ind_P,
+                                    const float* __restrict__ lev_P,
+                                    rocsparse_int level_of_fill,
+                                    rocsparse_int* __restrict__ row_nnz_L,
+                                    rocsparse_int* __restrict__ row_nnz_U)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int nnz_L = 0;
+    rocsparse_int nnz_U = 0;
+
+    for(rocsparse_int j = row_ptr_P[row]; j < row_ptr_P[row + 1]; ++j)
+    {
+        // Any fill-in from an entry of level k or larger exceeds the level of fill
+        if(lev_P[j] >= level_of_fill)
+        {
+            continue;
+        }
+
+        rocsparse_int col = col_ind_P[j];
+
+        nnz_L += (col < row);
+        nnz_U += (col > row);
+    }
+
+    row_nnz_L[row] = nnz_L;
+    row_nnz_U[row] = nnz_U;
+}
+
+// Split the level-of-fill pattern P into L and U. Each thread processes a row.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csriluk_levels_split_fill(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ row_ptr_P,
+                                   const rocsparse_int* __restrict__ col_ind_P,
+                                   const float* __restrict__ lev_P,
+                                   rocsparse_int level_of_fill,
+                                   const rocsparse_int* __restrict__ row_ptr_L,
+                                   rocsparse_int* __restrict__ col_ind_L,
+                                   float* __restrict__ lev_L,
+                                   const rocsparse_int* __restrict__ row_ptr_U,
+                                   rocsparse_int* __restrict__ col_ind_U,
+                                   float* __restrict__ lev_U)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int idx_L = row_ptr_L[row];
+    rocsparse_int idx_U = row_ptr_U[row];
+
+    for(rocsparse_int j = row_ptr_P[row]; j < row_ptr_P[row + 1]; ++j)
+    {
+        float lev = lev_P[j];
+
+        if(lev >= level_of_fill)
+        {
+            continue;
+        }
+
+        rocsparse_int col = col_ind_P[j];
+
+        if(col < row)
+        {
+            col_ind_L[idx_L] = col;
+            lev_L[idx_L]     = lev;
+            ++idx_L;
+        }
+        else if(col > row)
+        {
+            col_ind_U[idx_U] = col;
+            lev_U[idx_U]     = lev;
+            ++idx_U;
+        }
+    }
+}
+
+// Number of entries of each row of min(P, F), where F holds the fill-in levels
+// lev(i,h) + lev(h,j) + 1 of the current sweep. Entries that exceed the level of fill
+// are dropped. Each thread processes a row.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csriluk_levels_merge_count(rocsparse_int m,
+                                    const rocsparse_int* __restrict__ row_ptr_P,
+                                    const rocsparse_int* __restrict__ col_ind_P,
+                                    const rocsparse_int* __restrict__ row_ptr_F,
+                                    const rocsparse_int* __restrict__ col_ind_F,
+                                    const float* __restrict__ lev_F,
+                                    rocsparse_int level_of_fill,
+                                    rocsparse_int* __restrict__ row_nnz_Q)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int j     = row_ptr_P[row];
+    rocsparse_int end_P = row_ptr_P[row + 1];
+    rocsparse_int l     = row_ptr_F[row];
+    rocsparse_int end_F = row_ptr_F[row + 1];
+
+    // All entries of P are within the level of fill
+    rocsparse_int nnz = end_P - j;
+
+    while(l < end_F)
+    {
+        rocsparse_int col = col_ind_F[l];
+
+        // Both rows are sorted
+        while(j < end_P && col_ind_P[j] < col)
+        {
+            ++j;
+        }
+
+        if((j == end_P || col_ind_P[j] != col) && lev_F[l] <= level_of_fill)
+        {
+            ++nnz;
+        }
+
+        ++l;
+    }
+
+    row_nnz_Q[row] = nnz;
+}
+
+// Merge P and F into Q = min(P, F). Each thread processes a row.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csriluk_levels_merge_fill(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ row_ptr_P,
+                                   const rocsparse_int* __restrict__ col_ind_P,
+                                   const float* __restrict__ lev_P,
+                                   const rocsparse_int* __restrict__ row_ptr_F,
+                                   const rocsparse_int* __restrict__ col_ind_F,
+                                   const float* __restrict__ lev_F,
+                                   rocsparse_int level_of_fill,
+                                   const rocsparse_int* __restrict__ row_ptr_Q,
+                                   rocsparse_int* __restrict__ col_ind_Q,
+                                   float* __restrict__ lev_Q)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int j     = row_ptr_P[row];
+    rocsparse_int end_P = row_ptr_P[row + 1];
+    rocsparse_int l     = row_ptr_F[row];
+    rocsparse_int end_F = row_ptr_F[row + 1];
+    rocsparse_int idx   = row_ptr_Q[row];
+
+    while(j < end_P || l < end_F)
+    {
+        // Column m marks the end of a row
+        rocsparse_int col_P = (j < end_P) ? col_ind_P[j] : m;
+        rocsparse_int col_F = (l < end_F) ? col_ind_F[l] : m;
+        rocsparse_int col   = min(col_P, col_F);
+
+        float lev = static_cast<float>(level_of_fill) + 1.0f;
+
+        if(col_P == col)
+        {
+            lev = lev_P[j++];
+        }
+
+        if(col_F == col)
+        {
+            lev = min(lev, lev_F[l++]);
+        }
+
+        if(lev <= level_of_fill)
+        {
+            col_ind_Q[idx] = col;
+            lev_Q[idx]     = lev;
+            ++idx;
+        }
+    }
+}
+
+// Copy of an index array, shifted by the index base
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csriluk_shift_index(rocsparse_int size,
+                             const rocsparse_int* __restrict__ in,
+                             rocsparse_int* __restrict__ out,
+                             rocsparse_index_base idx_base)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= size)
+    {
+        return;
+    }
+
+    out[gid] = in[gid] + idx_base;
+}
+
+#endif // CSRILUK_DEVICE_H
@@ -0,0 +1,815 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef CSRILUT_DEVICE_H
+#define CSRILUT_DEVICE_H
+
+#include "common.h"
+
+// Inserts key into the hash table of the working row and returns its position. New keys
+// are rejected (-1) once half of the table is occupied, such that probing always terminates.
+template <unsigned int SIZE>
+__device__ __forceinline__ int csrilut_hash_insert(rocsparse_int* __restrict__ table,
+                                                   int* __restrict__ fill,
+                                                   rocsparse_int key)
+{
+    // Compute hash
+    int hash = (key * 103) & (SIZE - 1);
+
+    // Hash operation
+    while(true)
+    {
+        if(table[hash] == key)
+        {
+            // key is already inserted, done
+            return hash;
+        }
+        else if(table[hash] == -1)
+        {
+            // Working row is full, drop the fill entry
+            if(atomicAdd(fill, 1) >= SIZE / 2)
+            {
+                atomicSub(fill, 1);
+                return -1;
+            }
+
+            if(atomicCAS(&table[hash], -1, key) == -1)
+            {
+                // inserted key into the table, done
+                return hash;
+            }
+
+            // Slot has been taken concurrently, probe it again
+            atomicSub(fill, 1);
+        }
+        else
+        {
+            // collision, compute new hash
+            hash = (hash + 1) & (SIZE - 1);
+        }
+    }
+}
+
+// Returns the position of key in the hash table of the working row, or -1 if the key
+// does not exist.
+template <unsigned int SIZE>
+__device__ __forceinline__ int csrilut_hash_find(const rocsparse_int* __restrict__ table,
+                                                 rocsparse_int key)
+{
+    // Compute hash
+    int hash = (key * 103) & (SIZE - 1);
+
+    // Hash operation
+    while(true)
+    {
+        if(table[hash] == key)
+        {
+            return hash;
+        }
+        else if(table[hash] == -1)
+        {
+            return -1;
+        }
+        else
+        {
+            // collision, compute new hash
+            hash = (hash + 1) & (SIZE - 1);
+        }
+    }
+}
+
+// Working row of a single row in global memory, used once the fill of a row does not fit
+// into the hash table in shared memory. The working row is dense, entry j is present if
+// mark[j] is equal to the current row, and list holds the columns of all present entries.
+// Before the working row is used, all previous rows have to be completed, such that the
+// rows that fall back to global memory are processed one at a time. Returns the number of
+// entries kept in the strictly lower and the strictly upper part and the diagonal in the
+// last lane.
+template <unsigned int WFSIZE, typename T, typename U>
+__device__ void csrilut_factorize_global_device(rocsparse_int m,
+                                                rocsparse_int row,
+                                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                                const rocsparse_int* __restrict__ csr_col_ind,
+                                                const T* __restrict__ csr_val,
+                                                U             tau,
+                                                rocsparse_int max_fill,
+                                                rocsparse_int* __restrict__ l_col,
+                                                T* __restrict__ l_val,
+                                                const rocsparse_int* __restrict__ u_nnz,
+                                                rocsparse_int* __restrict__ u_col,
+                                                T* __restrict__ u_val,
+                                                int* __restrict__ done,
+                                                rocsparse_int* __restrict__ mark,
+                                                rocsparse_int* __restrict__ list,
+                                                rocsparse_int* __restrict__ rank,
+                                                T* __restrict__ data,
+                                                int* __restrict__ fill,
+                                                rocsparse_index_base idx_base,
+                                                int*                 nnz_lower,
+                                                int*                 nnz_upper,
+                                                T*                   diag)
+{
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+
+    // Wait for all previous rows, including those that use the working row
+    for(rocsparse_int j = lid; j < row; j += WFSIZE)
+    {
+        while(!atomicOr(&done[j], 0))
+            ;
+    }
+
+    __threadfence();
+
+    if(lid == 0)
+    {
+        *fill = 0;
+    }
+
+    __threadfence_block();
+
+    // Scatter row of A into the working row
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        mark[col]                = row;
+        data[col]                = csr_val[j];
+        list[atomicAdd(fill, 1)] = col;
+    }
+
+    __threadfence();
+
+    // Eliminate the strictly lower part in increasing column order
+    rocsparse_int last = -1;
+
+    while(true)
+    {
+        // Smallest column index of the working row that has not been processed yet
+        int next = row;
+
+        for(rocsparse_int c = last + 1; c < row; c += WFSIZE)
+        {
+            rocsparse_int col = c + lid;
+
+            if(col < row && mark[col] == row)
+            {
+                next = col;
+            }
+
+            rocsparse_wfreduce_min<WFSIZE>(&next);
+            next = __shfl(next, WFSIZE - 1, WFSIZE);
+
+            if(next < row)
+            {
+                break;
+            }
+        }
+
+        // Strictly lower part has been processed
+        if(next == row)
+        {
+            break;
+        }
+
+        last = next;
+
+        // Diagonal entry of row next, already boosted
+        T diag_val = u_val[(max_fill + 1) * next];
+
+        // Skip this row if it has a zero pivot
+        if(diag_val == static_cast<T>(0))
+        {
+            break;
+        }
+
+        T val = data[next] / diag_val;
+
+        // Drop small multipliers
+        if(rocsparse_abs(val) <= tau)
+        {
+            val = static_cast<T>(0);
+        }
+
+        __threadfence();
+
+        if(lid == 0)
+        {
+            data[next] = val;
+        }
+
+        if(val == static_cast<T>(0))
+        {
+            continue;
+        }
+
+        // Merge the strictly upper part of row next into the working row. The columns of
+        // a row of U are unique, thus each entry is updated by a single lane.
+        rocsparse_int u_begin = (max_fill + 1) * next;
+        rocsparse_int u_end   = u_begin + u_nnz[next];
+
+        for(rocsparse_int k = u_begin + 1 + lid; k < u_end; k += WFSIZE)
+        {
+            rocsparse_int col = u_col[k];
+
+            if(mark[col] == row)
+            {
+                data[col] = rocsparse_fma(-val, u_val[k], data[col]);
+            }
+            else
+            {
+                mark[col]                = row;
+                data[col]                = -val * u_val[k];
+                list[atomicAdd(fill, 1)] = col;
+            }
+        }
+
+        __threadfence();
+    }
+
+    __threadfence_block();
+
+    int nnz = *fill;
+
+    // Rank each candidate among the entries of its triangular part, ties are broken by the
+    // column index
+    int lower_count = 0;
+    int upper_count = 0;
+
+    for(int j = lid; j < nnz; j += WFSIZE)
+    {
+        rocsparse_int key     = list[j];
+        U             abs_val = rocsparse_abs(data[key]);
+
+        rank[j] = max_fill;
+
+        if(key == row || abs_val <= tau)
+        {
+            continue;
+        }
+
+        bool lower = key < row;
+
+        lower_count += lower;
+        upper_count += !lower;
+
+        rocsparse_int r = 0;
+
+        for(int s = 0; s < nnz; ++s)
+        {
+            rocsparse_int col = list[s];
+
+            if(col == row || (col < row) != lower)
+            {
+                continue;
+            }
+
+            U abs_s = rocsparse_abs(data[col]);
+
+            if(abs_s > abs_val || (abs_s == abs_val && col < key))
+            {
+                ++r;
+            }
+        }
+
+        rank[j] = r;
+    }
+
+    __threadfence();
+
+    // Remove all entries that are not kept from the working row
+    for(int j = lid; j < nnz; j += WFSIZE)
+    {
+        rocsparse_int key = list[j];
+
+        if(key != row && rank[j] >= max_fill)
+        {
+            mark[key] = -1;
+        }
+    }
+
+    __threadfence();
+
+    // Write remaining entries sorted by column index
+    rocsparse_int offset = max_fill * row;
+
+    for(rocsparse_int c = 0; c < row; c += WFSIZE)
+    {
+        rocsparse_int col  = c + lid;
+        bool          keep = col < row && mark[col] == row;
+
+        uint64_t mask = __ballot(keep);
+
+        if(keep)
+        {
+            rocsparse_int pos = offset + __popcll(mask & ((uint64_t(1) << lid) - 1));
+
+            l_col[pos] = col;
+            l_val[pos] = data[col];
+        }
+
+        offset += __popcll(mask);
+    }
+
+    offset = (max_fill + 1) * row + 1;
+
+    for(rocsparse_int c = row + 1; c < m; c += WFSIZE)
+    {
+        rocsparse_int col  = c + lid;
+        bool          keep = col < m && mark[col] == row;
+
+        uint64_t mask = __ballot(keep);
+
+        if(keep)
+        {
+            rocsparse_int pos = offset + __popcll(mask & ((uint64_t(1) << lid) - 1));
+
+            u_col[pos] = col;
+            u_val[pos] = data[col];
+        }
+
+        offset += __popcll(mask);
+    }
+
+    rocsparse_wfreduce_sum<WFSIZE>(&lower_count);
+    rocsparse_wfreduce_sum<WFSIZE>(&upper_count);
+
+    *nnz_lower = lower_count;
+    *nnz_upper = upper_count;
+    *diag      = (mark[row] == row) ? data[row] : static_cast<T>(0);
+}
+
+// Sync-free threshold ILU, one wavefront per row. Row i is scattered into a hash table
+// in shared memory and the rows k < i of U are merged in increasing order of k, as soon
+// as they have been completed. Multipliers l_ik with |l_ik| <= tau_i are dropped, where
+// tau_i = tol * ||a_i||_2. Afterwards, the max_fill largest entries of the strictly
+// lower and the strictly upper part (that exceed tau_i) are kept, together with the
+// diagonal. L is stored with stride max_fill, U with stride max_fill + 1 and the
+// diagonal in front. If the fill of a row does not fit into the hash table, the row is
+// computed again in a working row in global memory.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, unsigned int HASH, typename T, typename U>
+__device__ void csrilut_factorize_device(rocsparse_int m,
+                                         const rocsparse_int* __restrict__ csr_row_ptr,
+                                         const rocsparse_int* __restrict__ csr_col_ind,
+                                         const T* __restrict__ csr_val,
+                                         U             tol,
+                                         rocsparse_int max_fill,
+                                         rocsparse_int* __restrict__ l_nnz,
+                                         rocsparse_int* __restrict__ l_col,
+                                         T* __restrict__ l_val,
+                                         rocsparse_int* __restrict__ u_nnz,
+                                         rocsparse_int* __restrict__ u_col,
+                                         T* __restrict__ u_val,
+                                         int* __restrict__ done,
+                                         rocsparse_int* __restrict__ work_mark,
+                                         rocsparse_int* __restrict__ work_list,
+                                         rocsparse_int* __restrict__ work_rank,
+                                         T* __restrict__ work_val,
+                                         rocsparse_int* __restrict__ zero_pivot,
+                                         rocsparse_index_base idx_base,
+                                         int                  boost,
+                                         U                    boost_tol,
+                                         T                    boost_val)
+{
+    // Number of slots of the working row of each wavefront
+    static constexpr unsigned int SIZE = WFSIZE * HASH;
+
+    int lid = hipThreadIdx_x & (WFSIZE - 1);
+    int wid = hipThreadIdx_x / WFSIZE;
+
+    __shared__ rocsparse_int stable[BLOCKSIZE * HASH];
+    __shared__ T             sdata[BLOCKSIZE * HASH];
+    __shared__ int           sfill[BLOCKSIZE / WFSIZE];
+    __shared__ int           soverflow[BLOCKSIZE / WFSIZE];
+
+    // Pointer to each wavefronts shared data
+    rocsparse_int* table    = &stable[wid * SIZE];
+    T*             data     = &sdata[wid * SIZE];
+    int*           fill     = &sfill[wid];
+    int*           overflow = &soverflow[wid];
+
+    // Initialize hash table with -1
+    for(unsigned int j = lid; j < SIZE; j += WFSIZE)
+    {
+        table[j] = -1;
+        data[j]  = static_cast<T>(0);
+    }
+
+    if(lid == 0)
+    {
+        *fill     = 0;
+        *overflow = 0;
+    }
+
+    __threadfence_block();
+
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    // Row entry point
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    // Scatter row of A into the working row and compute its norm
+    U nrm = static_cast<U>(0);
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        T   val = csr_val[j];
+        int idx = csrilut_hash_insert<SIZE>(table, fill, csr_col_ind[j] - idx_base);
+
+        if(idx != -1)
+        {
+            data[idx] = val;
+        }
+        else
+        {
+            // Working row is full
+            *overflow = 1;
+        }
+
+        U abs_val = rocsparse_abs(val);
+        nrm += abs_val * abs_val;
+    }
+
+    nrm = rocsparse_wfreduce_sum<WFSIZE>(nrm);
+
+    // Drop tolerance of the current row
+    U tau = tol * sqrt(__shfl(nrm, WFSIZE - 1, WFSIZE));
+
+    __threadfence_block();
+
+    // Eliminate the strictly lower part in increasing column order, as long as the
+    // working row does not overflow
+    rocsparse_int last = -1;
+
+    while(*overflow == 0)
+    {
+        // Smallest column index of the working row that has not been processed yet
+        int next = row;
+
+        for(unsigned int j = lid; j < SIZE; j += WFSIZE)
+        {
+            rocsparse_int key = table[j];
+
+            if(key > last && key < row)
+            {
+                next = min(next, key);
+            }
+        }
+
+        rocsparse_wfreduce_min<WFSIZE>(&next);
+        next = __shfl(next, WFSIZE - 1, WFSIZE);
+
+        // Strictly lower part has been processed
+        if(next == row)
+        {
+            break;
+        }
+
+        last = next;
+
+        // Spin loop until dependency has been resolved
+        while(!atomicOr(&done[next], 0))
+            ;
+
+        // Make sure updated U is visible
+        __threadfence();
+
+        // Diagonal entry of row next, already boosted
+        T diag_val = u_val[(max_fill + 1) * next];
+
+        // Skip this row if it has a zero pivot
+        if(diag_val == static_cast<T>(0))
+        {
+            break;
+        }
+
+        int idx = csrilut_hash_find<SIZE>(table, next);
+
+        T val = data[idx] / diag_val;
+
+        // Drop small multipliers
+        if(rocsparse_abs(val) <= tau)
+        {
+            val = static_cast<T>(0);
+        }
+
+        __threadfence_block();
+
+        if(lid == 0)
+        {
+            data[idx] = val;
+        }
+
+        if(val == static_cast<T>(0))
+        {
+            continue;
+        }
+
+        // Merge the strictly upper part of row next into the working row
+        rocsparse_int u_begin = (max_fill + 1) * next;
+        rocsparse_int u_end   = u_begin + u_nnz[next];
+
+        for(rocsparse_int k = u_begin + 1 + lid; k < u_end; k += WFSIZE)
+        {
+            int pos = csrilut_hash_insert<SIZE>(table, fill, u_col[k]);
+
+            if(pos != -1)
+            {
+                data[pos] = rocsparse_fma(-val, u_val[k], data[pos]);
+            }
+            else
+            {
+                // Fill-in does not fit into the working row
+                *overflow = 1;
+            }
+        }
+
+        __threadfence_block();
+    }
+
+    __threadfence_block();
+
+    int nnz_lower = 0;
+    int nnz_upper = 0;
+    T   diag_val;
+
+    if(*overflow)
+    {
+        // The fill does not fit into the hash table, start over in global memory
+        csrilut_factorize_global_device<WFSIZE>(m,
+                                                row,
+                                                csr_row_ptr,
+                                                csr_col_ind,
+                                                csr_val,
+                                                tau,
+                                                max_fill,
+                                                l_col,
+                                                l_val,
+                                                u_nnz,
+                                                u_col,
+                                                u_val,
+                                                done,
+                                                work_mark,
+                                                work_list,
+                                                work_rank,
+                                                work_val,
+                                                fill,
+                                                idx_base,
+                                                &nnz_lower,
+                                                &nnz_upper,
+                                                &diag_val);
+    }
+    else
+    {
+        // Rank each candidate among the entries of its triangular part, ties are broken by
+        // the column index. Only the max_fill largest entries are kept.
+        bool keep[HASH];
+
+        for(unsigned int t = 0; t < HASH; ++t)
+        {
+            rocsparse_int key     = table[lid + t * WFSIZE];
+            U             abs_val = rocsparse_abs(data[lid + t * WFSIZE]);
+
+            keep[t] = false;
+
+            if(key == -1 || key == row || abs_val <= tau)
+            {
+                continue;
+            }
+
+            bool lower = key < row;
+
+            nnz_lower += lower;
+            nnz_upper += !lower;
+
+            rocsparse_int rank = 0;
+
+            for(unsigned int s = 0; s < SIZE; ++s)
+            {
+                rocsparse_int col = table[s];
+
+                if(col == -1 || col == row || (col < row) != lower)
+                {
+                    continue;
+                }
+
+                U abs_s = rocsparse_abs(data[s]);
+
+                if(abs_s > abs_val || (abs_s == abs_val && col < key))
+                {
+                    ++rank;
+                }
+            }
+
+            keep[t] = rank < max_fill;
+        }
+
+        __threadfence_block();
+
+        // Remove all entries that are not kept from the working row
+        for(unsigned int t = 0; t < HASH; ++t)
+        {
+            rocsparse_int key = table[lid + t * WFSIZE];
+
+            if(key != -1 && key != row && !keep[t])
+            {
+                table[lid + t * WFSIZE] = -1;
+            }
+        }
+
+        __threadfence_block();
+
+        // Write remaining entries sorted by column index
+        for(unsigned int t = 0; t < HASH; ++t)
+        {
+            rocsparse_int key = table[lid + t * WFSIZE];
+
+            if(key == -1 || key == row)
+            {
+                continue;
+            }
+
+            bool lower = key < row;
+
+            rocsparse_int pos = 0;
+
+            for(unsigned int s = 0; s < SIZE; ++s)
+            {
+                rocsparse_int col = table[s];
+
+                if(col != -1 && col < key && (lower || col > row))
+                {
+                    ++pos;
+                }
+            }
+
+            if(lower)
+            {
+                l_col[max_fill * row + pos] = key;
+                l_val[max_fill * row + pos] = data[lid + t * WFSIZE];
+            }
+            else
+            {
+                u_col[(max_fill + 1) * row + 1 + pos] = key;
+                u_val[(max_fill + 1) * row + 1 + pos] = data[lid + t * WFSIZE];
+            }
+        }
+
+        rocsparse_wfreduce_sum<WFSIZE>(&nnz_lower);
+        rocsparse_wfreduce_sum<WFSIZE>(&nnz_upper);
+
+        int idx = csrilut_hash_find<SIZE>(table, row);
+
+        diag_val = (idx != -1) ? data[idx] : static_cast<T>(0);
+    }
+
+    if(lid == WFSIZE - 1)
+    {
+        // Numeric boost
+        if(boost)
+        {
+            diag_val = (boost_tol >= rocsparse_abs(diag_val)) ? boost_val : diag_val;
+        }
+        else if(diag_val == static_cast<T>(0))
+        {
+            // We are looking for the first zero pivot
+            atomicMin(zero_pivot, row + idx_base);
+        }
+
+        u_col[(max_fill + 1) * row] = row;
+        u_val[(max_fill + 1) * row] = diag_val;
+
+        l_nnz[row] = min(nnz_lower, max_fill);
+        u_nnz[row] = min(nnz_upper, max_fill) + 1;
+    }
+
+    // Make sure L and U are written to global memory
+    __threadfence();
+
+    if(lid == WFSIZE - 1)
+    {
+        // Last lane writes "we are done" flag
+        atomicOr(&done[row], 1);
+    }
+}
+
+// Number of entries of each row of the factorization
+template <unsigned int BLOCKSIZE, bool ICHOL>
+__device__ void csrilut_nnz_device(rocsparse_int m,
+                                   const rocsparse_int* __restrict__ l_nnz,
+                                   const rocsparse_int* __restrict__ u_nnz,
+                                   rocsparse_int* __restrict__ csr_row_ptr_lu,
+                                   rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    if(row == 0)
+    {
+        csr_row_ptr_lu[0] = idx_base;
+    }
+
+    // ICT only stores the diagonal of U
+    csr_row_ptr_lu[row + 1] = l_nnz[row] + (ICHOL ? 1 : u_nnz[row]);
+}
+
+// Copy L and U into the CSR output. For ICT, the lower factor is L D^1/2, where L is the
+// unit lower triangular factor and D the diagonal of U.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, bool ICHOL, typename T>
+__device__ void csrilut_copy_device(rocsparse_int m,
+                                    rocsparse_int max_fill,
+                                    const rocsparse_int* __restrict__ l_nnz,
+                                    const rocsparse_int* __restrict__ l_col,
+                                    const T* __restrict__ l_val,
+                                    const rocsparse_int* __restrict__ u_nnz,
+                                    const rocsparse_int* __restrict__ u_col,
+                                    const T* __restrict__ u_val,
+                                    const rocsparse_int* __restrict__ csr_row_ptr_lu,
+                                    rocsparse_int* __restrict__ csr_col_ind_lu,
+                                    T* __restrict__ csr_val_lu,
+                                    rocsparse_index_base idx_base)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr_lu[row] - idx_base;
+    rocsparse_int nnz_lower = l_nnz[row];
+
+    for(rocsparse_int j = lid; j < nnz_lower; j += WFSIZE)
+    {
+        rocsparse_int col = l_col[max_fill * row + j];
+        T             val = l_val[max_fill * row + j];
+
+        if(ICHOL)
+        {
+            val = val * static_cast<T>(sqrt(rocsparse_abs(u_val[(max_fill + 1) * col])));
+        }
+
+        csr_col_ind_lu[row_begin + j] = col + idx_base;
+        csr_val_lu[row_begin + j]     = val;
+    }
+
+    if(ICHOL)
+    {
+        if(lid == 0)
+        {
+            T diag_val = u_val[(max_fill + 1) * row];
+
+            csr_col_ind_lu[row_begin + nnz_lower] = row + idx_base;
+            csr_val_lu[row_begin + nnz_lower]     = static_cast<T>(sqrt(rocsparse_abs(diag_val)));
+        }
+    }
+    else
+    {
+        rocsparse_int nnz_upper = u_nnz[row];
+
+        for(rocsparse_int j = lid; j < nnz_upper; j += WFSIZE)
+        {
+            csr_col_ind_lu[row_begin + nnz_lower + j] = u_col[(max_fill + 1) * row + j] + idx_base;
+            csr_val_lu[row_begin + nnz_lower + j]     = u_val[(max_fill + 1) * row + j];
+        }
+    }
+}
+
+#endif // CSRILUT_DEVICE_H
@@ -0,0 +1,288 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#pragma once
+#ifndef CSRITILU0_DEVICE_H
+#define CSRITILU0_DEVICE_H
+
+#include "common.h"
+
+// Binary search for col in the sorted range [begin, end) of csr_col_ind. Returns the
+// position of the entry or -1, if the entry does not exist.
+__device__ __forceinline__ rocsparse_int
+    csritilu0_find(const rocsparse_int* __restrict__ csr_col_ind,
+                   rocsparse_int        begin,
+                   rocsparse_int        end,
+                   rocsparse_int        col,
+                   rocsparse_index_base idx_base)
+{
+    rocsparse_int l = begin;
+    rocsparse_int r = end;
+
+    col += idx_base;
+
+    while(l < r)
+    {
+        rocsparse_int mid = (l + r) >> 1;
+
+        if(csr_col_ind[mid] < col)
+        {
+            l = mid + 1;
+        }
+        else
+        {
+            r = mid;
+        }
+    }
+
+    return (l < end && csr_col_ind[l] == col) ? l : -1;
+}
+
+// Initial guess of the fixed-point iteration. For ILU0, the strictly lower part of A is
+// scaled by the diagonal of the corresponding column, L0 = tril(A) diag(A)^-1 and
+// U0 = triu(A). For IC0, L0 = tril(A) diag(A)^-1/2.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, bool ICHOL, typename T>
+__device__ void csritilu0_init_device(rocsparse_int m,
+                                      const rocsparse_int* __restrict__ csr_row_ptr,
+                                      const rocsparse_int* __restrict__ csr_col_ind,
+                                      const T* __restrict__ a_val,
+                                      T* __restrict__ csr_val,
+                                      const rocsparse_int* __restrict__ csr_diag_ind,
+                                      rocsparse_index_base idx_base)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+        T             val = a_val[j];
+
+        if(col < row)
+        {
+            rocsparse_int diag = csr_diag_ind[col];
+
+            if(diag != -1)
+            {
+                T diag_val = a_val[diag];
+
+                if(ICHOL)
+                {
+                    diag_val = sqrt(rocsparse_abs(diag_val));
+                }
+
+                if(diag_val != static_cast<T>(0))
+                {
+                    val = val / diag_val;
+                }
+            }
+        }
+        else if(ICHOL && col == row)
+        {
+            val = sqrt(rocsparse_abs(val));
+        }
+
+        // The strictly upper part is left untouched by the incomplete Cholesky
+        // factorization
+        if(!ICHOL || col <= row)
+        {
+            csr_val[j] = val;
+        }
+    }
+}
+
+// One fixed-point sweep of the iterative incomplete factorization. Every entry of the
+// factors is updated from the previous iterate, independently of all other entries:
+//
+//   ILU0:  l_ij = (a_ij - sum_{k < j} l_ik u_kj) / u_jj        for i > j
+//          u_ij =  a_ij - sum_{k < i} l_ik u_kj                 for i <= j
+//
+//   IC0:   l_ij = (a_ij - sum_{k < j} l_jk conj(l_ik)) / l_jj  for i > j
+//          l_ii = sqrt(a_ii - sum_{k < i} l_ik conj(l_ik))
+//
+// The squared nonlinear residual (A - LU) of the previous iterate is accumulated into
+// residual, if requested.
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, bool ICHOL, typename T, typename U>
+__device__ void csritilu0_sweep_device(rocsparse_int m,
+                                       const rocsparse_int* __restrict__ csr_row_ptr,
+                                       const rocsparse_int* __restrict__ csr_col_ind,
+                                       const T* __restrict__ a_val,
+                                       const T* __restrict__ lu_prev,
+                                       T* __restrict__ csr_val,
+                                       const rocsparse_int* __restrict__ csr_diag_ind,
+                                       U* __restrict__ residual,
+                                       rocsparse_int* __restrict__ zero_pivot,
+                                       rocsparse_index_base idx_base)
+{
+    rocsparse_int lid = hipThreadIdx_x & (WFSIZE - 1);
+    rocsparse_int wid = hipThreadIdx_x / WFSIZE;
+
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE / WFSIZE + wid;
+
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    U nrm = static_cast<U>(0);
+
+    // Each lane updates one entry of the row
+    for(rocsparse_int j = row_begin + lid; j < row_end; j += WFSIZE)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(ICHOL && col > row)
+        {
+            continue;
+        }
+
+        rocsparse_int kmax = min(row, col);
+
+        // Inner product of row i of L and column j of U (row j of L for IC0)
+        T sum = static_cast<T>(0);
+
+        for(rocsparse_int k = row_begin; k < row_end; ++k)
+        {
+            rocsparse_int kcol = csr_col_ind[k] - idx_base;
+
+            if(kcol >= kmax)
+            {
+                break;
+            }
+
+            if(ICHOL)
+            {
+                rocsparse_int idx = csritilu0_find(csr_col_ind,
+                                                   csr_row_ptr[col] - idx_base,
+                                                   csr_row_ptr[col + 1] - idx_base,
+                                                   kcol,
+                                                   idx_base);
+
+                if(idx != -1)
+                {
+                    sum = rocsparse_fma(lu_prev[idx], rocsparse_conj(lu_prev[k]), sum);
+                }
+            }
+            else
+            {
+                // Column j of U only has entries on and above the diagonal of row k
+                rocsparse_int begin = csr_diag_ind[kcol];
+                rocsparse_int end   = csr_row_ptr[kcol + 1] - idx_base;
+
+                if(begin == -1)
+                {
+                    begin = csr_row_ptr[kcol] - idx_base;
+                }
+
+                rocsparse_int idx = csritilu0_find(csr_col_ind, begin, end, col, idx_base);
+
+                if(idx != -1)
+                {
+                    sum = rocsparse_fma(lu_prev[k], lu_prev[idx], sum);
+                }
+            }
+        }
+
+        T s   = a_val[j] - sum;
+        T old = lu_prev[j];
+        T val = old;
+        T r   = static_cast<T>(0);
+
+        if(col < row)
+        {
+            rocsparse_int diag = csr_diag_ind[col];
+
+            // Structural zero pivots have been reported by the analysis
+            if(diag != -1)
+            {
+                T diag_val = lu_prev[diag];
+
+                if(diag_val == static_cast<T>(0))
+                {
+                    // We are looking for the first zero pivot
+                    atomicMin(zero_pivot, col + idx_base);
+                    r = s;
+                }
+                else
+                {
+                    val = s / diag_val;
+                    r   = s - old * (ICHOL ? rocsparse_conj(diag_val) : diag_val);
+                }
+            }
+        }
+        else if(ICHOL)
+        {
+            val = sqrt(rocsparse_abs(s));
+            r   = s - old * rocsparse_conj(old);
+        }
+        else
+        {
+            val = s;
+            r   = s - old;
+        }
+
+        csr_val[j] = val;
+
+        U abs_r = rocsparse_abs(r);
+        nrm += abs_r * abs_r;
+    }
+
+    if(residual != nullptr)
+    {
+        nrm = rocsparse_wfreduce_sum<WFSIZE>(nrm);
+
+        if(lid == WFSIZE - 1)
+        {
+            atomicAdd(residual, nrm);
+        }
+    }
+}
+
+// Turn the accumulated squared residuals into Frobenius norms
+template <unsigned int BLOCKSIZE, typename U>
+__device__ void csritilu0_norm_device(rocsparse_int nsweeps, U* __restrict__ history)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= nsweeps)
+    {
+        return;
+    }
+
+    history[gid] = sqrt(history[gid]);
+}
+
+#endif // CSRITILU0_DEVICE_H
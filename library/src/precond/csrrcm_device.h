@@ -0,0 +1,422 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef CSRRCM_DEVICE_H
+#define CSRRCM_DEVICE_H
+
+#include "common.h"
+
+// Computes the degree of each row, ignoring the diagonal entry, and initializes the
+// ordering state of all rows
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_init_kernel(rocsparse_int m,
+                            const rocsparse_int* __restrict__ csr_row_ptr,
+                            const rocsparse_int* __restrict__ csr_col_ind,
+                            rocsparse_int* __restrict__ degree,
+                            rocsparse_int* __restrict__ order,
+                            rocsparse_int* __restrict__ parent,
+                            rocsparse_int* __restrict__ dist,
+                            rocsparse_index_base idx_base)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    // Do not run out of bounds
+    if(row >= m)
+    {
+        return;
+    }
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    rocsparse_int deg = 0;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        if(csr_col_ind[j] - idx_base != row)
+        {
+            ++deg;
+        }
+    }
+
+    degree[row] = deg;
+    order[row]  = -1;
+    parent[row] = m;
+    dist[row]   = -1;
+}
+
+// Flags all rows without off-diagonal entries
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_isolated_flag_kernel(rocsparse_int m,
+                                     const rocsparse_int* __restrict__ degree,
+                                     rocsparse_int* __restrict__ flag)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row > m)
+    {
+        return;
+    }
+
+    // The additional entry is required to obtain the total count from the scan
+    flag[row] = (row < m && degree[row] == 0) ? 1 : 0;
+}
+
+// Places all rows without off-diagonal entries in front of the ordering, in
+// increasing row index
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_isolated_place_kernel(rocsparse_int m,
+                                      const rocsparse_int* __restrict__ degree,
+                                      const rocsparse_int* __restrict__ position,
+                                      rocsparse_int* __restrict__ cm,
+                                      rocsparse_int* __restrict__ order)
+{
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(row >= m || degree[row] != 0)
+    {
+        return;
+    }
+
+    rocsparse_int pos = position[row];
+
+    cm[pos]    = row;
+    order[row] = pos;
+}
+
+// Determines the row with minimum degree among the given rows. Ties are broken by
+// the smaller row index. Rows that have already been ordered are skipped, if the
+// ordering is given. The result is packed as (degree << 32 | row) and must be
+// initialized with all bits set.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_min_degree_kernel(rocsparse_int n,
+                                  const rocsparse_int* __restrict__ list,
+                                  const rocsparse_int* __restrict__ degree,
+                                  const rocsparse_int* __restrict__ order,
+                                  int64_t* __restrict__ result)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ int64_t sdata[BLOCKSIZE];
+
+    int64_t key = INT64_MAX;
+
+    if(gid < n)
+    {
+        rocsparse_int row = (list != nullptr) ? list[gid] : gid;
+
+        if(order == nullptr || order[row] == -1)
+        {
+            key = (static_cast<int64_t>(degree[row]) << 32) | row;
+        }
+    }
+
+    sdata[tid] = key;
+    __syncthreads();
+
+    rocsparse_blockreduce_min<BLOCKSIZE>(tid, sdata);
+
+    if(tid == 0 && sdata[0] != INT64_MAX)
+    {
+        atomicMin(result, sdata[0]);
+    }
+}
+
+// Expands one level of a breadth first search. All unvisited and unordered neighbours
+// of the current level [begin, end) are appended to the level list.
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_bfs_kernel(rocsparse_int begin,
+                           rocsparse_int end,
+                           rocsparse_int level,
+                           const rocsparse_int* __restrict__ csr_row_ptr,
+                           const rocsparse_int* __restrict__ csr_col_ind,
+                           const rocsparse_int* __restrict__ order,
+                           rocsparse_int* __restrict__ dist,
+                           rocsparse_int* __restrict__ list,
+                           rocsparse_int* __restrict__ count,
+                           rocsparse_index_base idx_base)
+{
+    rocsparse_int pos = begin + hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(pos >= end)
+    {
+        return;
+    }
+
+    rocsparse_int row = list[pos];
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col != row && order[col] == -1 && atomicCAS(&dist[col], -1, level + 1) == -1)
+        {
+            list[end + atomicAdd(count, 1)] = col;
+        }
+    }
+}
+
+// Resets the distances of all rows that have been visited by a breadth first search
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_bfs_reset_kernel(rocsparse_int n,
+                                 const rocsparse_int* __restrict__ list,
+                                 rocsparse_int* __restrict__ dist)
+{
+    rocsparse_int gid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(gid >= n)
+    {
+        return;
+    }
+
+    dist[list[gid]] = -1;
+}
+
+// Each unordered neighbour of the current level [begin, end) is claimed by the
+// ordered row with the smallest position, as in the sequential Cuthill-McKee scheme
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_claim_kernel(rocsparse_int begin,
+                             rocsparse_int end,
+                             const rocsparse_int* __restrict__ cm,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             const rocsparse_int* __restrict__ order,
+                             rocsparse_int* __restrict__ parent,
+                             rocsparse_index_base idx_base)
+{
+    rocsparse_int pos = begin + hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(pos >= end)
+    {
+        return;
+    }
+
+    rocsparse_int row = cm[pos];
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col != row && order[col] == -1)
+        {
+            atomicMin(&parent[col], pos);
+        }
+    }
+}
+
+// Counts the children, that have been claimed by each row of the current level
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_count_kernel(rocsparse_int begin,
+                             rocsparse_int end,
+                             const rocsparse_int* __restrict__ cm,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             const rocsparse_int* __restrict__ order,
+                             const rocsparse_int* __restrict__ parent,
+                             rocsparse_int* __restrict__ count,
+                             rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int pos = begin + tid;
+
+    if(pos > end)
+    {
+        return;
+    }
+
+    // The additional entry is required to obtain the total count from the scan
+    if(pos == end)
+    {
+        count[tid] = 0;
+        return;
+    }
+
+    rocsparse_int row = cm[pos];
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    rocsparse_int nchildren = 0;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col != row && order[col] == -1 && parent[col] == pos)
+        {
+            ++nchildren;
+        }
+    }
+
+    count[tid] = nchildren;
+}
+
+// Gathers the children of each row of the current level, together with their
+// degrees as sort keys
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_fill_kernel(rocsparse_int begin,
+                            rocsparse_int end,
+                            const rocsparse_int* __restrict__ cm,
+                            const rocsparse_int* __restrict__ csr_row_ptr,
+                            const rocsparse_int* __restrict__ csr_col_ind,
+                            const rocsparse_int* __restrict__ degree,
+                            const rocsparse_int* __restrict__ order,
+                            const rocsparse_int* __restrict__ parent,
+                            const rocsparse_int* __restrict__ offset,
+                            rocsparse_int* __restrict__ keys,
+                            rocsparse_int* __restrict__ vals,
+                            rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+    rocsparse_int pos = begin + tid;
+
+    if(pos >= end)
+    {
+        return;
+    }
+
+    rocsparse_int row = cm[pos];
+    rocsparse_int idx = offset[tid];
+
+    rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+    rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+    for(rocsparse_int j = row_begin; j < row_end; ++j)
+    {
+        rocsparse_int col = csr_col_ind[j] - idx_base;
+
+        if(col != row && order[col] == -1 && parent[col] == pos)
+        {
+            keys[idx] = degree[col];
+            vals[idx] = col;
+
+            ++idx;
+        }
+    }
+}
+
+// Assigns the positions of the rows that have been appended to the ordering
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_mark_kernel(rocsparse_int begin,
+                            rocsparse_int end,
+                            const rocsparse_int* __restrict__ cm,
+                            rocsparse_int* __restrict__ order)
+{
+    rocsparse_int pos = begin + hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(pos >= end)
+    {
+        return;
+    }
+
+    order[cm[pos]] = pos;
+}
+
+// Reverses the Cuthill-McKee ordering in place
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrrcm_reverse_kernel(rocsparse_int m, rocsparse_int* __restrict__ perm)
+{
+    rocsparse_int i = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(i >= m / 2)
+    {
+        return;
+    }
+
+    rocsparse_int tmp = perm[i];
+    perm[i]           = perm[m - 1 - i];
+    perm[m - 1 - i]   = tmp;
+}
+
+// Computes bandwidth max |i - j| and profile sum_i (i - min(i, min_j j)) of a matrix
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrbandwidth_kernel(rocsparse_int m,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             rocsparse_int* __restrict__ bandwidth,
+                             int64_t* __restrict__ profile,
+                             rocsparse_index_base idx_base)
+{
+    rocsparse_int tid = hipThreadIdx_x;
+    rocsparse_int row = hipBlockIdx_x * BLOCKSIZE + tid;
+
+    __shared__ rocsparse_int sband[BLOCKSIZE];
+    __shared__ int64_t       sprof[BLOCKSIZE];
+
+    rocsparse_int band = 0;
+    int64_t       prof = 0;
+
+    if(row < m)
+    {
+        rocsparse_int row_begin = csr_row_ptr[row] - idx_base;
+        rocsparse_int row_end   = csr_row_ptr[row + 1] - idx_base;
+
+        rocsparse_int first = row;
+
+        for(rocsparse_int j = row_begin; j < row_end; ++j)
+        {
+            rocsparse_int col = csr_col_ind[j] - idx_base;
+
+            band  = max(band, (col > row) ? col - row : row - col);
+            first = min(first, col);
+        }
+
+        prof = row - first;
+    }
+
+    sband[tid] = band;
+    sprof[tid] = prof;
+    __syncthreads();
+
+    rocsparse_blockreduce_max<BLOCKSIZE>(tid, sband);
+    rocsparse_blockreduce_sum<BLOCKSIZE>(tid, sprof);
+
+    if(tid == 0)
+    {
+        atomicMax(bandwidth, sband[0]);
+        atomicAdd(profile, sprof[0]);
+    }
+}
+
+#endif // CSRRCM_DEVICE_H
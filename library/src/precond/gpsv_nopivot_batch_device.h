@@ -0,0 +1,154 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GPSV_NOPIVOT_BATCH_DEVICE_H
+#define GPSV_NOPIVOT_BATCH_DEVICE_H
+
+#include "common.h"
+
+// Gaussian elimination without pivoting for a single penta-diagonal system. Entry i of
+// the system is stored at position offset + inc * i. Each row is normalized during the
+// forward elimination, such that only the two modified upper diagonals are required for
+// the backward substitution. They are stored interleaved at batch_count * i + batch, to
+// obtain coalesced accesses to the temporary storage.
+template <typename T>
+__device__ void gpsv_nopivot_batch_device(rocsparse_int m,
+                                          rocsparse_int batch,
+                                          rocsparse_int batch_count,
+                                          rocsparse_int offset,
+                                          rocsparse_int inc,
+                                          const T* __restrict__ ds,
+                                          const T* __restrict__ dl,
+                                          const T* __restrict__ d,
+                                          const T* __restrict__ du,
+                                          const T* __restrict__ dw,
+                                          T* __restrict__ u1,
+                                          T* __restrict__ u2,
+                                          T* __restrict__ x)
+{
+    // Modified upper diagonals and rhs of the two previous rows
+    T u1_prev2 = static_cast<T>(0);
+    T u2_prev2 = static_cast<T>(0);
+    T y_prev2  = static_cast<T>(0);
+    T u1_prev1 = static_cast<T>(0);
+    T u2_prev1 = static_cast<T>(0);
+    T y_prev1  = static_cast<T>(0);
+
+    // Forward elimination
+    for(rocsparse_int i = 0; i < m; ++i)
+    {
+        rocsparse_int idx = offset + inc * i;
+
+        T a = ds[idx];
+        T b = dl[idx] - a * u1_prev2;
+        T c = static_cast<T>(1) / (d[idx] - a * u2_prev2 - b * u1_prev1);
+
+        T u1i = (du[idx] - b * u2_prev1) * c;
+        T u2i = dw[idx] * c;
+        T yi  = (x[idx] - a * y_prev2 - b * y_prev1) * c;
+
+        u1[batch_count * i + batch] = u1i;
+        u2[batch_count * i + batch] = u2i;
+        x[idx]                      = yi;
+
+        u1_prev2 = u1_prev1;
+        u2_prev2 = u2_prev1;
+        y_prev2  = y_prev1;
+        u1_prev1 = u1i;
+        u2_prev1 = u2i;
+        y_prev1  = yi;
+    }
+
+    // Backward substitution
+    T x_next1 = static_cast<T>(0);
+    T x_next2 = static_cast<T>(0);
+
+    for(rocsparse_int i = m - 1; i >= 0; --i)
+    {
+        rocsparse_int idx = offset + inc * i;
+
+        T xi = x[idx] - u1[batch_count * i + batch] * x_next1
+               - u2[batch_count * i + batch] * x_next2;
+
+        x[idx] = xi;
+
+        x_next2 = x_next1;
+        x_next1 = xi;
+    }
+}
+
+// Strided batch, where entry i of system j is stored at position batch_stride * j + i
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gpsv_nopivot_strided_batch_kernel(rocsparse_int m,
+                                           rocsparse_int batch_count,
+                                           rocsparse_int batch_stride,
+                                           const T* __restrict__ ds,
+                                           const T* __restrict__ dl,
+                                           const T* __restrict__ d,
+                                           const T* __restrict__ du,
+                                           const T* __restrict__ dw,
+                                           T* __restrict__ u1,
+                                           T* __restrict__ u2,
+                                           T* __restrict__ x)
+{
+    rocsparse_int batch = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(batch >= batch_count)
+    {
+        return;
+    }
+
+    gpsv_nopivot_batch_device(
+        m, batch, batch_count, batch_stride * batch, 1, ds, dl, d, du, dw, u1, u2, x);
+}
+
+// Interleaved batch, where entry i of system j is stored at position batch_stride * i + j
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gpsv_nopivot_interleaved_batch_kernel(rocsparse_int m,
+                                               rocsparse_int batch_count,
+                                               rocsparse_int batch_stride,
+                                               const T* __restrict__ ds,
+                                               const T* __restrict__ dl,
+                                               const T* __restrict__ d,
+                                               const T* __restrict__ du,
+                                               const T* __restrict__ dw,
+                                               T* __restrict__ u1,
+                                               T* __restrict__ u2,
+                                               T* __restrict__ x)
+{
+    rocsparse_int batch = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(batch >= batch_count)
+    {
+        return;
+    }
+
+    gpsv_nopivot_batch_device(
+        m, batch, batch_count, batch, batch_stride, ds, dl, d, du, dw, u1, u2, x);
+}
+
+#endif // GPSV_NOPIVOT_BATCH_DEVICE_H
@@ -0,0 +1,417 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GTSV_DEVICE_H
+#define GTSV_DEVICE_H
+
+#include "common.h"
+
+// SPIKE algorithm with partial pivoting based on paper "A parallel hybrid banded system
+// solver: the SPIKE algorithm" by Eric Polizzi and Ahmed H. Sameh
+//
+// The rows of the tri-diagonal system are split into p partitions A_j of almost equal size.
+// Each partition is factorized independently using Gaussian elimination with partial
+// pivoting. The coupling of A_j to its neighbours is described by the spikes
+//
+//   v_j = A_j^-1 * (du[last] * e_last)
+//   w_j = A_j^-1 * (dl[first] * e_first)
+//
+// such that x_j = y_j - v_j * x_{j+1}[first] - w_j * x_{j-1}[last] with y_j = A_j^-1 * b_j.
+// The first and last unknown of all partitions form a reduced system of size 2p with two
+// sub- and two super-diagonals, that is solved using banded Gaussian elimination with
+// partial pivoting.
+
+// Leading dimension of the band storage of the reduced system. Row i of the reduced system
+// stores column c at position i * GTSV_BAND_LD + c - i + 2, where c - i lies in [-2, 4]
+// to make room for the fill-in introduced by row interchanges
+#define GTSV_BAND_LD 7
+
+// First row of partition j when splitting m rows into npart partitions
+__device__ __forceinline__ rocsparse_int gtsv_partition_begin(rocsparse_int m,
+                                                              rocsparse_int npart,
+                                                              rocsparse_int j)
+{
+    return j * (m / npart) + min(j, m % npart);
+}
+
+// Solve a single partition in place using its factorization
+template <typename T>
+__device__ void gtsv_spike_partition_solve_device(rocsparse_int        begin,
+                                                  rocsparse_int        end,
+                                                  const T*             L,
+                                                  const T*             U0,
+                                                  const T*             U1,
+                                                  const T*             U2,
+                                                  const rocsparse_int* P,
+                                                  T*                   x)
+{
+    // Forward substitution, applying the row interchanges of the factorization
+    T r = x[begin];
+
+    for(rocsparse_int i = begin; i < end - 1; ++i)
+    {
+        T rn = x[i + 1];
+
+        if(P[i] == 0)
+        {
+            x[i] = r;
+            r    = rn - L[i] * r;
+        }
+        else
+        {
+            x[i] = rn;
+            r    = r - L[i] * rn;
+        }
+    }
+
+    // Backward substitution
+    x[end - 1] = r / U0[end - 1];
+
+    if(end - begin > 1)
+    {
+        x[end - 2] = (x[end - 2] - U1[end - 2] * x[end - 1]) / U0[end - 2];
+    }
+
+    for(rocsparse_int i = end - 3; i >= begin; --i)
+    {
+        x[i] = (x[i] - U1[i] * x[i + 1] - U2[i] * x[i + 2]) / U0[i];
+    }
+}
+
+// Factorize each partition with partial pivoting and compute its spikes
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_spike_factorize_kernel(rocsparse_int m,
+                                     rocsparse_int npart,
+                                     const T* __restrict__ dl,
+                                     const T* __restrict__ d,
+                                     const T* __restrict__ du,
+                                     T* __restrict__ L,
+                                     T* __restrict__ U0,
+                                     T* __restrict__ U1,
+                                     T* __restrict__ U2,
+                                     rocsparse_int* __restrict__ P,
+                                     T* __restrict__ V,
+                                     T* __restrict__ W)
+{
+    rocsparse_int j = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(j >= npart)
+    {
+        return;
+    }
+
+    rocsparse_int begin = gtsv_partition_begin(m, npart, j);
+    rocsparse_int end   = gtsv_partition_begin(m, npart, j + 1);
+
+    // Active row of the elimination, holding the entries of columns i and i + 1
+    T a = d[begin];
+    T b = (begin + 1 < end) ? du[begin] : static_cast<T>(0);
+
+    for(rocsparse_int i = begin; i < end - 1; ++i)
+    {
+        T l  = dl[i + 1];
+        T dn = d[i + 1];
+        T un = (i + 2 < end) ? du[i + 1] : static_cast<T>(0);
+
+        if(rocsparse_abs(a) >= rocsparse_abs(l))
+        {
+            // Row i is the pivot row
+            T f = (a != static_cast<T>(0)) ? l / a : static_cast<T>(0);
+
+            L[i]  = f;
+            P[i]  = 0;
+            U0[i] = a;
+            U1[i] = b;
+            U2[i] = static_cast<T>(0);
+
+            a = dn - f * b;
+            b = un;
+        }
+        else
+        {
+            // Interchange rows i and i + 1
+            T f = a / l;
+
+            L[i]  = f;
+            P[i]  = 1;
+            U0[i] = l;
+            U1[i] = dn;
+            U2[i] = un;
+
+            a = b - f * dn;
+            b = -f * un;
+        }
+    }
+
+    U0[end - 1] = a;
+
+    // Right-hand sides of the spikes
+    for(rocsparse_int i = begin; i < end; ++i)
+    {
+        V[i] = static_cast<T>(0);
+        W[i] = static_cast<T>(0);
+    }
+
+    if(j > 0)
+    {
+        W[begin] = dl[begin];
+    }
+
+    if(j < npart - 1)
+    {
+        V[end - 1] = du[end - 1];
+    }
+
+    gtsv_spike_partition_solve_device(begin, end, L, U0, U1, U2, P, V);
+    gtsv_spike_partition_solve_device(begin, end, L, U0, U1, U2, P, W);
+}
+
+// Compute y_j = A_j^-1 * b_j in place for each partition and right-hand side
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_spike_solve_kernel(rocsparse_int m,
+                                 rocsparse_int npart,
+                                 rocsparse_int ldb,
+                                 const T* __restrict__ L,
+                                 const T* __restrict__ U0,
+                                 const T* __restrict__ U1,
+                                 const T* __restrict__ U2,
+                                 const rocsparse_int* __restrict__ P,
+                                 T* __restrict__ B)
+{
+    rocsparse_int j = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(j >= npart)
+    {
+        return;
+    }
+
+    rocsparse_int begin = gtsv_partition_begin(m, npart, j);
+    rocsparse_int end   = gtsv_partition_begin(m, npart, j + 1);
+
+    gtsv_spike_partition_solve_device(begin, end, L, U0, U1, U2, P, B + ldb * hipBlockIdx_y);
+}
+
+// Assemble the rows of the reduced system, that belong to each partition
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_spike_reduced_assemble_kernel(rocsparse_int m,
+                                            rocsparse_int npart,
+                                            const T* __restrict__ V,
+                                            const T* __restrict__ W,
+                                            T* __restrict__ RB)
+{
+    rocsparse_int j = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(j >= npart)
+    {
+        return;
+    }
+
+    rocsparse_int begin = gtsv_partition_begin(m, npart, j);
+    rocsparse_int end   = gtsv_partition_begin(m, npart, j + 1);
+
+    // Unknown 2 * j is the first and unknown 2 * j + 1 the last entry of partition j
+    T* top = RB + GTSV_BAND_LD * (2 * j);
+    T* bot = RB + GTSV_BAND_LD * (2 * j + 1);
+
+    for(rocsparse_int k = 0; k < GTSV_BAND_LD; ++k)
+    {
+        top[k] = static_cast<T>(0);
+        bot[k] = static_cast<T>(0);
+    }
+
+    top[2] = static_cast<T>(1);
+    bot[2] = static_cast<T>(1);
+
+    // Coupling to the last unknown of the previous partition
+    if(j > 0)
+    {
+        top[1] = W[begin];
+        bot[0] = W[end - 1];
+    }
+
+    // Coupling to the first unknown of the next partition
+    if(j < npart - 1)
+    {
+        top[4] = V[begin];
+        bot[3] = V[end - 1];
+    }
+}
+
+// Factorize the reduced system. Each elimination step depends on the previous one, such
+// that the factorization is sequential. Its cost is bounded by the number of partitions.
+template <typename T>
+__global__ void gtsv_spike_reduced_factorize_kernel(rocsparse_int nred,
+                                                    T* __restrict__ RB,
+                                                    rocsparse_int* __restrict__ RP)
+{
+    // Banded Gaussian elimination with partial pivoting
+    for(rocsparse_int k = 0; k < nred; ++k)
+    {
+        rocsparse_int last = min(k + 2, nred - 1);
+        rocsparse_int cmax = min(k + 4, nred - 1);
+
+        // Find pivot
+        rocsparse_int piv  = k;
+        auto          pmax = rocsparse_abs(RB[GTSV_BAND_LD * k + 2]);
+
+        for(rocsparse_int i = k + 1; i <= last; ++i)
+        {
+            auto val = rocsparse_abs(RB[GTSV_BAND_LD * i + k - i + 2]);
+
+            if(val > pmax)
+            {
+                pmax = val;
+                piv  = i;
+            }
+        }
+
+        RP[k] = piv;
+
+        if(piv != k)
+        {
+            for(rocsparse_int c = k; c <= cmax; ++c)
+            {
+                T tmp                                = RB[GTSV_BAND_LD * k + c - k + 2];
+                RB[GTSV_BAND_LD * k + c - k + 2]     = RB[GTSV_BAND_LD * piv + c - piv + 2];
+                RB[GTSV_BAND_LD * piv + c - piv + 2] = tmp;
+            }
+        }
+
+        T pivot = RB[GTSV_BAND_LD * k + 2];
+
+        // Eliminate column k
+        for(rocsparse_int i = k + 1; i <= last; ++i)
+        {
+            T f = RB[GTSV_BAND_LD * i + k - i + 2] / pivot;
+
+            RB[GTSV_BAND_LD * i + k - i + 2] = f;
+
+            for(rocsparse_int c = k + 1; c <= cmax; ++c)
+            {
+                RB[GTSV_BAND_LD * i + c - i + 2] -= f * RB[GTSV_BAND_LD * k + c - k + 2];
+            }
+        }
+    }
+}
+
+// Gather and solve the reduced system for each right-hand side
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_spike_reduced_solve_kernel(rocsparse_int m,
+                                         rocsparse_int n,
+                                         rocsparse_int npart,
+                                         rocsparse_int ldb,
+                                         const T* __restrict__ RB,
+                                         const rocsparse_int* __restrict__ RP,
+                                         const T* __restrict__ B,
+                                         T* __restrict__ XR)
+{
+    rocsparse_int col = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(col >= n)
+    {
+        return;
+    }
+
+    rocsparse_int nred = 2 * npart;
+
+    T* x = XR + nred * col;
+
+    // Gather first and last entry of each partition
+    for(rocsparse_int j = 0; j < npart; ++j)
+    {
+        x[2 * j]     = B[gtsv_partition_begin(m, npart, j) + ldb * col];
+        x[2 * j + 1] = B[gtsv_partition_begin(m, npart, j + 1) - 1 + ldb * col];
+    }
+
+    // Forward substitution
+    for(rocsparse_int k = 0; k < nred; ++k)
+    {
+        rocsparse_int piv = RP[k];
+
+        if(piv != k)
+        {
+            T tmp  = x[k];
+            x[k]   = x[piv];
+            x[piv] = tmp;
+        }
+
+        for(rocsparse_int i = k + 1; i <= min(k + 2, nred - 1); ++i)
+        {
+            x[i] -= RB[GTSV_BAND_LD * i + k - i + 2] * x[k];
+        }
+    }
+
+    // Backward substitution
+    for(rocsparse_int k = nred - 1; k >= 0; --k)
+    {
+        T sum = x[k];
+
+        for(rocsparse_int c = k + 1; c <= min(k + 4, nred - 1); ++c)
+        {
+            sum -= RB[GTSV_BAND_LD * k + c - k + 2] * x[c];
+        }
+
+        x[k] = sum / RB[GTSV_BAND_LD * k + 2];
+    }
+}
+
+// Recover the solution x_j = y_j - v_j * x_{j+1}[first] - w_j * x_{j-1}[last]
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_spike_recover_kernel(rocsparse_int m,
+                                   rocsparse_int npart,
+                                   rocsparse_int ldb,
+                                   const T* __restrict__ V,
+                                   const T* __restrict__ W,
+                                   const T* __restrict__ XR,
+                                   T* __restrict__ B)
+{
+    rocsparse_int j = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(j >= npart)
+    {
+        return;
+    }
+
+    rocsparse_int col  = hipBlockIdx_y;
+    rocsparse_int nred = 2 * npart;
+
+    rocsparse_int begin = gtsv_partition_begin(m, npart, j);
+    rocsparse_int end   = gtsv_partition_begin(m, npart, j + 1);
+
+    T xprev = (j > 0) ? XR[nred * col + 2 * j - 1] : static_cast<T>(0);
+    T xnext = (j < npart - 1) ? XR[nred * col + 2 * j + 2] : static_cast<T>(0);
+
+    for(rocsparse_int i = begin; i < end; ++i)
+    {
+        B[i + ldb * col] -= V[i] * xnext + W[i] * xprev;
+    }
+}
+
+#endif // GTSV_DEVICE_H
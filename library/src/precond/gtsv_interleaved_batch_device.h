@@ -0,0 +1,168 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GTSV_INTERLEAVED_BATCH_DEVICE_H
+#define GTSV_INTERLEAVED_BATCH_DEVICE_H
+
+#include "common.h"
+
+// Batched tri-diagonal solvers for interleaved storage, where entry i of system j is stored
+// at position batch_stride * i + j. Each thread solves one system, such that all memory
+// accesses of a wavefront are coalesced.
+
+// Thomas algorithm without pivoting
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_interleaved_batch_thomas_kernel(rocsparse_int m,
+                                              rocsparse_int batch_count,
+                                              rocsparse_int batch_stride,
+                                              const T* __restrict__ dl,
+                                              const T* __restrict__ d,
+                                              const T* __restrict__ du,
+                                              T* __restrict__ dc,
+                                              T* __restrict__ x)
+{
+    rocsparse_int batch = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(batch >= batch_count)
+    {
+        return;
+    }
+
+    // Forward elimination
+    T denom = static_cast<T>(1) / d[batch];
+
+    dc[batch] = du[batch] * denom;
+    x[batch]  = x[batch] * denom;
+
+    for(rocsparse_int i = 1; i < m; ++i)
+    {
+        rocsparse_int idx = batch_stride * i + batch;
+
+        T a = dl[idx];
+
+        denom = static_cast<T>(1) / (d[idx] - a * dc[batch_count * (i - 1) + batch]);
+
+        dc[batch_count * i + batch] = du[idx] * denom;
+        x[idx]                      = (x[idx] - a * x[idx - batch_stride]) * denom;
+    }
+
+    // Backward substitution
+    for(rocsparse_int i = m - 2; i >= 0; --i)
+    {
+        rocsparse_int idx = batch_stride * i + batch;
+
+        x[idx] -= dc[batch_count * i + batch] * x[idx + batch_stride];
+    }
+}
+
+// LU factorization with partial pivoting. The right-hand side is eliminated together with
+// the matrix, such that only the three diagonals of U need to be stored.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_interleaved_batch_lu_kernel(rocsparse_int m,
+                                          rocsparse_int batch_count,
+                                          rocsparse_int batch_stride,
+                                          const T* __restrict__ dl,
+                                          const T* __restrict__ d,
+                                          const T* __restrict__ du,
+                                          T* __restrict__ u0,
+                                          T* __restrict__ u1,
+                                          T* __restrict__ u2,
+                                          T* __restrict__ x)
+{
+    rocsparse_int batch = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(batch >= batch_count)
+    {
+        return;
+    }
+
+    // Active row of the elimination, holding the entries of columns i and i + 1
+    T a = d[batch];
+    T b = du[batch];
+    T r = x[batch];
+
+    for(rocsparse_int i = 0; i < m - 1; ++i)
+    {
+        rocsparse_int idx  = batch_stride * i + batch;
+        rocsparse_int next = idx + batch_stride;
+        rocsparse_int out  = batch_count * i + batch;
+
+        T l  = dl[next];
+        T dn = d[next];
+        T un = (i + 2 < m) ? du[next] : static_cast<T>(0);
+        T rn = x[next];
+
+        if(rocsparse_abs(a) >= rocsparse_abs(l))
+        {
+            // Row i is the pivot row
+            T f = (a != static_cast<T>(0)) ? l / a : static_cast<T>(0);
+
+            u0[out] = a;
+            u1[out] = b;
+            u2[out] = static_cast<T>(0);
+            x[idx]  = r;
+
+            a = dn - f * b;
+            b = un;
+            r = rn - f * r;
+        }
+        else
+        {
+            // Interchange rows i and i + 1
+            T f = a / l;
+
+            u0[out] = l;
+            u1[out] = dn;
+            u2[out] = un;
+            x[idx]  = rn;
+
+            a = b - f * dn;
+            b = -f * un;
+            r = r - f * rn;
+        }
+    }
+
+    // Backward substitution
+    T xi1 = r / a;
+    T xi2 = static_cast<T>(0);
+
+    x[batch_stride * (m - 1) + batch] = xi1;
+
+    for(rocsparse_int i = m - 2; i >= 0; --i)
+    {
+        rocsparse_int idx = batch_stride * i + batch;
+        rocsparse_int out = batch_count * i + batch;
+
+        T xi = (x[idx] - u1[out] * xi1 - u2[out] * xi2) / u0[out];
+
+        x[idx] = xi;
+        xi2    = xi1;
+        xi1    = xi;
+    }
+}
+
+#endif // GTSV_INTERLEAVED_BATCH_DEVICE_H
@@ -0,0 +1,167 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef GTSV_NOPIVOT_STRIDED_BATCH_DEVICE_H
+#define GTSV_NOPIVOT_STRIDED_BATCH_DEVICE_H
+
+#include "common.h"
+
+// Parallel cyclic reduction algorithm using shared memory, one thread block per system
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_nopivot_strided_batch_pcr_shared_kernel(rocsparse_int m,
+                                                      rocsparse_int batch_count,
+                                                      rocsparse_int batch_stride,
+                                                      const T* __restrict__ dl,
+                                                      const T* __restrict__ d,
+                                                      const T* __restrict__ du,
+                                                      T* __restrict__ x)
+{
+    rocsparse_int tid    = hipThreadIdx_x;
+    rocsparse_int offset = batch_stride * hipBlockIdx_x;
+
+    rocsparse_int iter   = static_cast<rocsparse_int>(log2(BLOCKSIZE / 2));
+    rocsparse_int stride = 1;
+
+    // Parallel cyclic reduction shared memory
+    __shared__ T sa[BLOCKSIZE];
+    __shared__ T sb[BLOCKSIZE];
+    __shared__ T sc[BLOCKSIZE];
+    __shared__ T srhs[BLOCKSIZE];
+    __shared__ T sx[BLOCKSIZE];
+
+    // Fill parallel cyclic reduction shared memory
+    sa[tid]   = (tid < m) ? dl[offset + tid] : static_cast<T>(0);
+    sb[tid]   = (tid < m) ? d[offset + tid] : static_cast<T>(0);
+    sc[tid]   = (tid < m) ? du[offset + tid] : static_cast<T>(0);
+    srhs[tid] = (tid < m) ? x[offset + tid] : static_cast<T>(0);
+
+    __syncthreads();
+
+    for(rocsparse_int j = 0; j < iter; j++)
+    {
+        rocsparse_int right = tid + stride;
+        if(right >= m)
+            right = m - 1;
+
+        rocsparse_int left = tid - stride;
+        if(left < 0)
+            left = 0;
+
+        T k1 = sa[tid] / sb[left];
+        T k2 = sc[tid] / sb[right];
+
+        T tb   = sb[tid] - sc[left] * k1 - sa[right] * k2;
+        T trhs = srhs[tid] - srhs[left] * k1 - srhs[right] * k2;
+        T ta   = -sa[left] * k1;
+        T tc   = -sc[right] * k2;
+
+        __syncthreads();
+
+        sb[tid]   = tb;
+        srhs[tid] = trhs;
+        sa[tid]   = ta;
+        sc[tid]   = tc;
+
+        stride <<= 1;
+
+        __syncthreads();
+    }
+
+    if(tid < BLOCKSIZE / 2)
+    {
+        rocsparse_int i = tid;
+        rocsparse_int j = tid + stride;
+
+        if(j < m)
+        {
+            // Solve 2x2 systems
+            T det = sb[j] * sb[i] - sc[i] * sa[j];
+            det   = static_cast<T>(1) / det;
+
+            sx[i] = (sb[j] * srhs[i] - sc[i] * srhs[j]) * det;
+            sx[j] = (srhs[j] * sb[i] - srhs[i] * sa[j]) * det;
+        }
+        else
+        {
+            // Solve 1x1 systems
+            sx[i] = srhs[i] / sb[i];
+        }
+    }
+
+    __syncthreads();
+
+    if(tid < m)
+    {
+        x[offset + tid] = sx[tid];
+    }
+}
+
+// Thomas algorithm, one thread per system. The modified upper diagonal is stored
+// interleaved in dc, such that accesses to the temporary storage are coalesced.
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void gtsv_nopivot_strided_batch_thomas_kernel(rocsparse_int m,
+                                                  rocsparse_int batch_count,
+                                                  rocsparse_int batch_stride,
+                                                  const T* __restrict__ dl,
+                                                  const T* __restrict__ d,
+                                                  const T* __restrict__ du,
+                                                  T* __restrict__ dc,
+                                                  T* __restrict__ x)
+{
+    rocsparse_int batch = hipBlockIdx_x * BLOCKSIZE + hipThreadIdx_x;
+
+    if(batch >= batch_count)
+    {
+        return;
+    }
+
+    rocsparse_int offset = batch_stride * batch;
+
+    // Forward elimination
+    T denom = static_cast<T>(1) / d[offset];
+
+    dc[batch] = du[offset] * denom;
+    x[offset] = x[offset] * denom;
+
+    for(rocsparse_int i = 1; i < m; ++i)
+    {
+        T a = dl[offset + i];
+
+        denom = static_cast<T>(1) / (d[offset + i] - a * dc[batch_count * (i - 1) + batch]);
+
+        dc[batch_count * i + batch] = du[offset + i] * denom;
+        x[offset + i]               = (x[offset + i] - a * x[offset + i - 1]) * denom;
+    }
+
+    // Backward substitution
+    for(rocsparse_int i = m - 2; i >= 0; --i)
+    {
+        x[offset + i] -= dc[batch_count * i + batch] * x[offset + i + 1];
+    }
+}
+
+#endif // GTSV_NOPIVOT_STRIDED_BATCH_DEVICE_H
@@ -177,13 +177,13 @@ rocsparse_status rocsparse_bsric0_analysis_template(rocsparse_handle          ha
     }
 
     // Check analysis policy
-    if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force)
+    if(rocsparse_enum_utils::is_invalid(analysis))
     {
         return rocsparse_status_invalid_value;
     }
 
     // Check solve policy
-    if(solve != rocsparse_solve_policy_auto)
+    if(rocsparse_enum_utils::is_invalid(solve))
     {
         return rocsparse_status_invalid_value;
     }
@@ -253,6 +253,26 @@ rocsparse_status rocsparse_bsric0_analysis_template(rocsparse_handle          ha
             return rocsparse_status_success;
         }
     }
+    else if(analysis == rocsparse_analysis_policy_numeric)
+    {
+        // Only the values have changed, re-use the meta data if it has been
+        // gathered for the same sparsity pattern
+        unsigned long long pattern_hash;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash(
+            handle, mb, nnzb, bsr_row_ptr, bsr_col_ind, temp_buffer, &pattern_hash));
+
+        if(rocsparse_trm_pattern_match(info->bsric0_info, mb, nnzb, pattern_hash))
+        {
+            return rocsparse_status_success;
+        }
+
+        // The pattern has changed. Meta data that is shared with other routines
+        // is left to them, they will detect the change on their own.
+        if(rocsparse_check_trm_shared(info, info->bsric0_info))
+        {
+            info->bsric0_info = nullptr;
+        }
+    }
 
     // User is explicitly asking to force a re-analysis, or no valid data has been
     // found to be re-used.
@@ -0,0 +1,645 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "definitions.h"
+#include "utility.h"
+
+#include "bsrjacobi_device.h"
+
+template <unsigned int BLOCKSIZE, unsigned int BSRDIM, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrjacobi_setup_kernel(rocsparse_direction dir,
+                                rocsparse_int       mb,
+                                const rocsparse_int* __restrict__ bsr_row_ptr,
+                                const rocsparse_int* __restrict__ bsr_col_ind,
+                                const T* __restrict__ bsr_val,
+                                rocsparse_int bsr_dim,
+                                T* __restrict__ bsr_diag_inv,
+                                rocsparse_int* __restrict__ zero_pivot,
+                                rocsparse_index_base idx_base)
+{
+    bsrjacobi_setup_device<BLOCKSIZE, BSRDIM>(
+        dir, mb, bsr_row_ptr, bsr_col_ind, bsr_val, bsr_dim, bsr_diag_inv, zero_pivot, idx_base);
+}
+
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrjacobi_setup_general_kernel(rocsparse_direction dir,
+                                        rocsparse_int       mb,
+                                        const rocsparse_int* __restrict__ bsr_row_ptr,
+                                        const rocsparse_int* __restrict__ bsr_col_ind,
+                                        const T* __restrict__ bsr_val,
+                                        rocsparse_int bsr_dim,
+                                        T* __restrict__ bsr_diag_inv,
+                                        rocsparse_int* __restrict__ perm,
+                                        rocsparse_int* __restrict__ zero_pivot,
+                                        rocsparse_index_base idx_base)
+{
+    bsrjacobi_setup_general_device<BLOCKSIZE>(dir,
+                                              mb,
+                                              bsr_row_ptr,
+                                              bsr_col_ind,
+                                              bsr_val,
+                                              bsr_dim,
+                                              bsr_diag_inv,
+                                              perm,
+                                              zero_pivot,
+                                              idx_base);
+}
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void bsrjacobi_apply_kernel(rocsparse_direction dir,
+                                rocsparse_int       mb,
+                                rocsparse_int       bsr_dim,
+                                U                   alpha_device_host,
+                                const T* __restrict__ bsr_diag_inv,
+                                const T* __restrict__ x,
+                                U beta_device_host,
+                                T* __restrict__ y)
+{
+    auto alpha = load_scalar_device_host(alpha_device_host);
+    auto beta  = load_scalar_device_host(beta_device_host);
+
+    if(alpha == static_cast<T>(0) && beta == static_cast<T>(1))
+    {
+        return;
+    }
+
+    bsrjacobi_apply_device<BLOCKSIZE>(dir, mb, bsr_dim, alpha, bsr_diag_inv, x, beta, y);
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrjacobi_buffer_size_template(rocsparse_handle          handle,
+                                                          rocsparse_direction       dir,
+                                                          rocsparse_int             mb,
+                                                          rocsparse_int             nnzb,
+                                                          const rocsparse_mat_descr descr,
+                                                          const T*                  bsr_val,
+                                                          const rocsparse_int*      bsr_row_ptr,
+                                                          const rocsparse_int*      bsr_col_ind,
+                                                          rocsparse_int             block_dim,
+                                                          size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrjacobi_buffer_size"),
+              dir,
+              mb,
+              nnzb,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)buffer_size);
+
+    // Check direction
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0 || nnzb < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nnzb == 0)
+    {
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr || bsr_row_ptr == nullptr || bsr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Blocks up to 32 x 32 are inverted in shared memory, larger blocks require the row
+    // permutation to be stored
+    if(block_dim <= 32)
+    {
+        *buffer_size = 4;
+    }
+    else
+    {
+        *buffer_size = ((sizeof(rocsparse_int) * mb * block_dim - 1) / 256 + 1) * 256;
+    }
+
+    return rocsparse_status_success;
+}
+
+#define LAUNCH_BSRJACOBI_SETUP(BLOCKSIZE, BSRDIM)                            \
+    hipLaunchKernelGGL((bsrjacobi_setup_kernel<BLOCKSIZE, BSRDIM>),          \
+                       dim3((mb - 1) / (BLOCKSIZE / (BSRDIM * BSRDIM)) + 1), \
+                       dim3(BLOCKSIZE),                                      \
+                       0,                                                    \
+                       stream,                                               \
+                       dir,                                                  \
+                       mb,                                                   \
+                       bsr_row_ptr,                                          \
+                       bsr_col_ind,                                          \
+                       bsr_val,                                              \
+                       block_dim,                                            \
+                       bsr_diag_inv,                                         \
+                       info->zero_pivot,                                     \
+                       descr->base)
+
+template <typename T>
+rocsparse_status rocsparse_bsrjacobi_setup_template(rocsparse_handle          handle,
+                                                    rocsparse_direction       dir,
+                                                    rocsparse_int             mb,
+                                                    rocsparse_int             nnzb,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  bsr_val,
+                                                    const rocsparse_int*      bsr_row_ptr,
+                                                    const rocsparse_int*      bsr_col_ind,
+                                                    rocsparse_int             block_dim,
+                                                    rocsparse_mat_info        info,
+                                                    T*                        bsr_diag_inv,
+                                                    void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrjacobi_setup"),
+              dir,
+              mb,
+              nnzb,
+              (const void*&)descr,
+              (const void*&)bsr_val,
+              (const void*&)bsr_row_ptr,
+              (const void*&)bsr_col_ind,
+              block_dim,
+              (const void*&)info,
+              (const void*&)bsr_diag_inv,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f bsrjacobi -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> "
+              "--blockdim",
+              block_dim);
+
+    // Check direction
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(mb < 0 || nnzb < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0 || nnzb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(bsr_val == nullptr || bsr_row_ptr == nullptr || bsr_col_ind == nullptr
+       || bsr_diag_inv == nullptr || temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Allocate buffer to hold zero pivot
+    if(info->zero_pivot == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->zero_pivot, sizeof(rocsparse_int)));
+    }
+
+    // Initialize zero pivot
+    rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+    // Wait for device transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Block dimensions supported by the bsrmv kernels are processed by specialized kernels
+    if(block_dim <= 2)
+    {
+        LAUNCH_BSRJACOBI_SETUP(256, 2);
+    }
+    else if(block_dim == 3)
+    {
+        LAUNCH_BSRJACOBI_SETUP(256, 3);
+    }
+    else if(block_dim == 4)
+    {
+        LAUNCH_BSRJACOBI_SETUP(256, 4);
+    }
+    else if(block_dim == 5)
+    {
+        LAUNCH_BSRJACOBI_SETUP(256, 5);
+    }
+    else if(block_dim <= 8)
+    {
+        LAUNCH_BSRJACOBI_SETUP(256, 8);
+    }
+    else if(block_dim <= 16)
+    {
+        LAUNCH_BSRJACOBI_SETUP(256, 16);
+    }
+    else if(block_dim <= 32)
+    {
+        LAUNCH_BSRJACOBI_SETUP(1024, 32);
+    }
+    else
+    {
+        // Row permutation of each block
+        rocsparse_int* perm = reinterpret_cast<rocsparse_int*>(temp_buffer);
+
+        hipLaunchKernelGGL((bsrjacobi_setup_general_kernel<256>),
+                           dim3(mb),
+                           dim3(256),
+                           0,
+                           stream,
+                           dir,
+                           mb,
+                           bsr_row_ptr,
+                           bsr_col_ind,
+                           bsr_val,
+                           block_dim,
+                           bsr_diag_inv,
+                           perm,
+                           info->zero_pivot,
+                           descr->base);
+    }
+
+    return rocsparse_status_success;
+}
+
+#undef LAUNCH_BSRJACOBI_SETUP
+
+template <typename T, typename U>
+rocsparse_status rocsparse_bsrjacobi_apply_dispatch(rocsparse_handle    handle,
+                                                    rocsparse_direction dir,
+                                                    rocsparse_int       mb,
+                                                    rocsparse_int       block_dim,
+                                                    U                   alpha_device_host,
+                                                    const T*            bsr_diag_inv,
+                                                    const T*            x,
+                                                    U                   beta_device_host,
+                                                    T*                  y)
+{
+#define BSRJACOBI_DIM 256
+    hipLaunchKernelGGL((bsrjacobi_apply_kernel<BSRJACOBI_DIM>),
+                       dim3((mb * block_dim - 1) / BSRJACOBI_DIM + 1),
+                       dim3(BSRJACOBI_DIM),
+                       0,
+                       handle->stream,
+                       dir,
+                       mb,
+                       block_dim,
+                       alpha_device_host,
+                       bsr_diag_inv,
+                       x,
+                       beta_device_host,
+                       y);
+#undef BSRJACOBI_DIM
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_bsrjacobi_apply_template(rocsparse_handle    handle,
+                                                    rocsparse_direction dir,
+                                                    rocsparse_int       mb,
+                                                    rocsparse_int       block_dim,
+                                                    const T*            alpha_device_host,
+                                                    const T*            bsr_diag_inv,
+                                                    const T*            x,
+                                                    const T*            beta_device_host,
+                                                    T*                  y)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xbsrjacobi_apply"),
+              dir,
+              mb,
+              block_dim,
+              LOG_TRACE_SCALAR_VALUE(handle, alpha_device_host),
+              (const void*&)bsr_diag_inv,
+              (const void*&)x,
+              LOG_TRACE_SCALAR_VALUE(handle, beta_device_host),
+              (const void*&)y);
+
+    // Check direction
+    if(rocsparse_enum_utils::is_invalid(dir))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Check sizes
+    if(mb < 0 || block_dim <= 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(mb == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(alpha_device_host == nullptr || beta_device_host == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Another quick return
+    if(handle->pointer_mode == rocsparse_pointer_mode_host
+       && *alpha_device_host == static_cast<T>(0) && *beta_device_host == static_cast<T>(1))
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check the remaining pointer arguments
+    if(bsr_diag_inv == nullptr || x == nullptr || y == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_bsrjacobi_apply_dispatch(
+            handle, dir, mb, block_dim, alpha_device_host, bsr_diag_inv, x, beta_device_host, y);
+    }
+    else
+    {
+        return rocsparse_bsrjacobi_apply_dispatch(
+            handle, dir, mb, block_dim, *alpha_device_host, bsr_diag_inv, x, *beta_device_host, y);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                  \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_direction       dir,         \
+                                     rocsparse_int             mb,          \
+                                     rocsparse_int             nnzb,        \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               bsr_val,     \
+                                     const rocsparse_int*      bsr_row_ptr, \
+                                     const rocsparse_int*      bsr_col_ind, \
+                                     rocsparse_int             block_dim,   \
+                                     size_t*                   buffer_size) \
+    {                                                                       \
+        return rocsparse_bsrjacobi_buffer_size_template(handle,             \
+                                                        dir,                \
+                                                        mb,                 \
+                                                        nnzb,               \
+                                                        descr,              \
+                                                        bsr_val,            \
+                                                        bsr_row_ptr,        \
+                                                        bsr_col_ind,        \
+                                                        block_dim,          \
+                                                        buffer_size);       \
+    }
+
+C_IMPL(rocsparse_sbsrjacobi_buffer_size, float);
+C_IMPL(rocsparse_dbsrjacobi_buffer_size, double);
+C_IMPL(rocsparse_cbsrjacobi_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zbsrjacobi_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                   \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,       \
+                                     rocsparse_direction       dir,          \
+                                     rocsparse_int             mb,           \
+                                     rocsparse_int             nnzb,         \
+                                     const rocsparse_mat_descr descr,        \
+                                     const TYPE*               bsr_val,      \
+                                     const rocsparse_int*      bsr_row_ptr,  \
+                                     const rocsparse_int*      bsr_col_ind,  \
+                                     rocsparse_int             block_dim,    \
+                                     rocsparse_mat_info        info,         \
+                                     TYPE*                     bsr_diag_inv, \
+                                     void*                     temp_buffer)  \
+    {                                                                        \
+        return rocsparse_bsrjacobi_setup_template(handle,                    \
+                                                  dir,                       \
+                                                  mb,                        \
+                                                  nnzb,                      \
+                                                  descr,                     \
+                                                  bsr_val,                   \
+                                                  bsr_row_ptr,               \
+                                                  bsr_col_ind,               \
+                                                  block_dim,                 \
+                                                  info,                      \
+                                                  bsr_diag_inv,              \
+                                                  temp_buffer);              \
+    }
+
+C_IMPL(rocsparse_sbsrjacobi_setup, float);
+C_IMPL(rocsparse_dbsrjacobi_setup, double);
+C_IMPL(rocsparse_cbsrjacobi_setup, rocsparse_float_complex);
+C_IMPL(rocsparse_zbsrjacobi_setup, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                \
+    extern "C" rocsparse_status NAME(rocsparse_handle    handle,          \
+                                     rocsparse_direction dir,             \
+                                     rocsparse_int       mb,              \
+                                     rocsparse_int       block_dim,       \
+                                     const TYPE*         alpha,           \
+                                     const TYPE*         bsr_diag_inv,    \
+                                     const TYPE*         x,               \
+                                     const TYPE*         beta,            \
+                                     TYPE*               y)               \
+    {                                                                     \
+        return rocsparse_bsrjacobi_apply_template(                        \
+            handle, dir, mb, block_dim, alpha, bsr_diag_inv, x, beta, y); \
+    }
+
+C_IMPL(rocsparse_sbsrjacobi_apply, float);
+C_IMPL(rocsparse_dbsrjacobi_apply, double);
+C_IMPL(rocsparse_cbsrjacobi_apply, rocsparse_float_complex);
+C_IMPL(rocsparse_zbsrjacobi_apply, rocsparse_double_complex);
+
+#undef C_IMPL
+
+extern "C" rocsparse_status rocsparse_bsrjacobi_zero_pivot(rocsparse_handle   handle,
+                                                           rocsparse_mat_info info,
+                                                           rocsparse_int*     position)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_bsrjacobi_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If mb == 0 || nnzb == 0 it can happen, that the zero pivot has not been allocated.
+    // In this case, always return -1.
+    if(info->zero_pivot == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
+}
@@ -0,0 +1,842 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "csrcheb_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+#define CSRCHEB_DIM 256
+#define CSRCHEB_MAX_BLOCKS 1024
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcheb_residual_kernel(rocsparse_int m,
+                                 const rocsparse_int* __restrict__ csr_row_ptr,
+                                 const rocsparse_int* __restrict__ csr_col_ind,
+                                 const T* __restrict__ csr_val,
+                                 T inv_theta,
+                                 const T* __restrict__ b,
+                                 const T* __restrict__ x,
+                                 T* __restrict__ r,
+                                 T* __restrict__ d,
+                                 rocsparse_index_base idx_base)
+{
+    csrcheb_residual_device<BLOCKSIZE, WF_SIZE>(
+        m, csr_row_ptr, csr_col_ind, csr_val, inv_theta, b, x, r, d, idx_base);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcheb_step_kernel(rocsparse_int m,
+                             const rocsparse_int* __restrict__ csr_row_ptr,
+                             const rocsparse_int* __restrict__ csr_col_ind,
+                             const T* __restrict__ csr_val,
+                             T alpha,
+                             T beta,
+                             const T* __restrict__ d,
+                             T* __restrict__ d_next,
+                             T* __restrict__ r,
+                             T* __restrict__ x,
+                             rocsparse_index_base idx_base)
+{
+    csrcheb_step_device<BLOCKSIZE, WF_SIZE>(
+        m, csr_row_ptr, csr_col_ind, csr_val, alpha, beta, d, d_next, r, x, idx_base);
+}
+
+template <unsigned int BLOCKSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcheb_update_kernel(rocsparse_int m, const T* __restrict__ d, T* __restrict__ x)
+{
+    csrcheb_update_device<BLOCKSIZE>(m, d, x);
+}
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__ void csrcheb_power_init_kernel(rocsparse_int m,
+                                                                       T* __restrict__ v,
+                                                                       T* __restrict__ partial_dot,
+                                                                       U* __restrict__ partial_nrm)
+{
+    csrcheb_power_init_device<BLOCKSIZE>(m, v, partial_dot, partial_nrm);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcheb_power_kernel(rocsparse_int m,
+                              const rocsparse_int* __restrict__ csr_row_ptr,
+                              const rocsparse_int* __restrict__ csr_col_ind,
+                              const T* __restrict__ csr_val,
+                              const T* __restrict__ v,
+                              T* __restrict__ w,
+                              const U* __restrict__ nrm2,
+                              T* __restrict__ partial_dot,
+                              U* __restrict__ partial_nrm,
+                              rocsparse_index_base idx_base)
+{
+    csrcheb_power_device<BLOCKSIZE, WF_SIZE>(
+        m, csr_row_ptr, csr_col_ind, csr_val, v, w, nrm2, partial_dot, partial_nrm, idx_base);
+}
+
+template <unsigned int BLOCKSIZE, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrcheb_power_reduce_kernel(rocsparse_int nblocks,
+                                     const T* __restrict__ partial_dot,
+                                     const U* __restrict__ partial_nrm,
+                                     U* __restrict__ nrm2,
+                                     U* __restrict__ lambda)
+{
+    csrcheb_power_reduce_device<BLOCKSIZE>(nblocks, partial_dot, partial_nrm, nrm2, lambda);
+}
+
+// Sub wavefront size that matches the average number of entries per row
+static unsigned int rocsparse_csrcheb_wfsize(rocsparse_handle handle,
+                                             rocsparse_int    m,
+                                             rocsparse_int    nnz)
+{
+    rocsparse_int nnz_per_row = nnz / m;
+
+    if(nnz_per_row < 4)
+    {
+        return 2;
+    }
+    else if(nnz_per_row < 8)
+    {
+        return 4;
+    }
+    else if(nnz_per_row < 16)
+    {
+        return 8;
+    }
+    else if(nnz_per_row < 32)
+    {
+        return 16;
+    }
+    else if(nnz_per_row < 64 || handle->wavefront_size == 32)
+    {
+        return 32;
+    }
+
+    return 64;
+}
+
+// Chunks of the temporary buffer, shared by the smoother and the eigenvalue estimate
+template <typename T, typename U>
+static void rocsparse_csrcheb_split_buffer(rocsparse_int m,
+                                           void*         temp_buffer,
+                                           T**           vec0,
+                                           T**           vec1,
+                                           T**           vec2,
+                                           T**           partial_dot,
+                                           U**           partial_nrm,
+                                           U**           scalars)
+{
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    *vec0 = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * m - 1) / 256 + 1) * 256;
+
+    *vec1 = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * m - 1) / 256 + 1) * 256;
+
+    *vec2 = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * m - 1) / 256 + 1) * 256;
+
+    *partial_dot = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * CSRCHEB_MAX_BLOCKS - 1) / 256 + 1) * 256;
+
+    *partial_nrm = reinterpret_cast<U*>(ptr);
+    ptr += ((sizeof(U) * CSRCHEB_MAX_BLOCKS - 1) / 256 + 1) * 256;
+
+    *scalars = reinterpret_cast<U*>(ptr);
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrcheb_buffer_size_template(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T*                  csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrcheb_buffer_size"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Three vectors of length m
+    *buffer_size = ((sizeof(T) * m - 1) / 256 + 1) * 256 * 3;
+
+    // Partial sums and scalars of the eigenvalue estimate
+    *buffer_size += ((sizeof(T) * CSRCHEB_MAX_BLOCKS - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(U) * CSRCHEB_MAX_BLOCKS - 1) / 256 + 1) * 256;
+    *buffer_size += 256;
+
+    return rocsparse_status_success;
+}
+
+template <unsigned int WF_SIZE, typename T, typename U>
+static rocsparse_status rocsparse_csrcheb_estimate_dispatch(rocsparse_handle     handle,
+                                                            rocsparse_int        m,
+                                                            const T*             csr_val,
+                                                            const rocsparse_int* csr_row_ptr,
+                                                            const rocsparse_int* csr_col_ind,
+                                                            rocsparse_int        iters,
+                                                            rocsparse_index_base idx_base,
+                                                            T*                   v,
+                                                            T*                   w,
+                                                            T*                   partial_dot,
+                                                            U*                   partial_nrm,
+                                                            U*                   nrm2,
+                                                            U*                   lambda)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Start vector and its squared norm
+    rocsparse_int nblocks_init = std::min((m - 1) / CSRCHEB_DIM + 1, CSRCHEB_MAX_BLOCKS);
+
+    hipLaunchKernelGGL((csrcheb_power_init_kernel<CSRCHEB_DIM>),
+                       dim3(nblocks_init),
+                       dim3(CSRCHEB_DIM),
+                       0,
+                       stream,
+                       m,
+                       v,
+                       partial_dot,
+                       partial_nrm);
+
+    hipLaunchKernelGGL((csrcheb_power_reduce_kernel<CSRCHEB_DIM>),
+                       dim3(1),
+                       dim3(CSRCHEB_DIM),
+                       0,
+                       stream,
+                       nblocks_init,
+                       partial_dot,
+                       partial_nrm,
+                       nrm2,
+                       lambda);
+
+    // Power iteration, the normalization is applied on the fly
+    rocsparse_int nblocks = std::min((m - 1) / (CSRCHEB_DIM / WF_SIZE) + 1, CSRCHEB_MAX_BLOCKS);
+
+    for(rocsparse_int iter = 0; iter < iters; ++iter)
+    {
+        hipLaunchKernelGGL((csrcheb_power_kernel<CSRCHEB_DIM, WF_SIZE>),
+                           dim3(nblocks),
+                           dim3(CSRCHEB_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           v,
+                           w,
+                           nrm2,
+                           partial_dot,
+                           partial_nrm,
+                           idx_base);
+
+        hipLaunchKernelGGL((csrcheb_power_reduce_kernel<CSRCHEB_DIM>),
+                           dim3(1),
+                           dim3(CSRCHEB_DIM),
+                           0,
+                           stream,
+                           nblocks,
+                           partial_dot,
+                           partial_nrm,
+                           nrm2,
+                           lambda);
+
+        std::swap(v, w);
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrcheb_estimate_template(rocsparse_handle          handle,
+                                                     rocsparse_int             m,
+                                                     rocsparse_int             nnz,
+                                                     const rocsparse_mat_descr descr,
+                                                     const T*                  csr_val,
+                                                     const rocsparse_int*      csr_row_ptr,
+                                                     const rocsparse_int*      csr_col_ind,
+                                                     rocsparse_int             iters,
+                                                     U*                        lambda_max,
+                                                     void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrcheb_estimate"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              iters,
+              (const void*&)lambda_max,
+              (const void*&)temp_buffer);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(iters < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check eigenvalue pointer
+    if(lambda_max == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible, the zero matrix has no positive eigenvalue
+    if(m == 0 || nnz == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(lambda_max, 0, sizeof(U), stream));
+        }
+        else
+        {
+            *lambda_max = static_cast<U>(0);
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Buffer
+    T* v;
+    T* w;
+    T* unused;
+    T* partial_dot;
+    U* partial_nrm;
+    U* scalars;
+
+    rocsparse_csrcheb_split_buffer(
+        m, temp_buffer, &v, &w, &unused, &partial_dot, &partial_nrm, &scalars);
+
+#define CSRCHEB_ESTIMATE_DISPATCH(WF_SIZE)                    \
+    rocsparse_csrcheb_estimate_dispatch<WF_SIZE>(handle,      \
+                                                 m,           \
+                                                 csr_val,     \
+                                                 csr_row_ptr, \
+                                                 csr_col_ind, \
+                                                 iters,       \
+                                                 descr->base, \
+                                                 v,           \
+                                                 w,           \
+                                                 partial_dot, \
+                                                 partial_nrm, \
+                                                 scalars,     \
+                                                 scalars + 1)
+
+    switch(rocsparse_csrcheb_wfsize(handle, m, nnz))
+    {
+    case 2:
+        RETURN_IF_ROCSPARSE_ERROR(CSRCHEB_ESTIMATE_DISPATCH(2));
+        break;
+    case 4:
+        RETURN_IF_ROCSPARSE_ERROR(CSRCHEB_ESTIMATE_DISPATCH(4));
+        break;
+    case 8:
+        RETURN_IF_ROCSPARSE_ERROR(CSRCHEB_ESTIMATE_DISPATCH(8));
+        break;
+    case 16:
+        RETURN_IF_ROCSPARSE_ERROR(CSRCHEB_ESTIMATE_DISPATCH(16));
+        break;
+    case 32:
+        RETURN_IF_ROCSPARSE_ERROR(CSRCHEB_ESTIMATE_DISPATCH(32));
+        break;
+    case 64:
+        RETURN_IF_ROCSPARSE_ERROR(CSRCHEB_ESTIMATE_DISPATCH(64));
+        break;
+    }
+
+#undef CSRCHEB_ESTIMATE_DISPATCH
+
+    // Copy the estimate to the output
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            lambda_max, scalars + 1, sizeof(U), hipMemcpyDeviceToDevice, stream));
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(lambda_max, scalars + 1, sizeof(U), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+    return rocsparse_status_success;
+}
+
+template <unsigned int WF_SIZE, typename T, typename U>
+static rocsparse_status rocsparse_csrcheb_dispatch(rocsparse_handle     handle,
+                                                   rocsparse_int        m,
+                                                   const T*             csr_val,
+                                                   const rocsparse_int* csr_row_ptr,
+                                                   const rocsparse_int* csr_col_ind,
+                                                   rocsparse_int        degree,
+                                                   U                    lambda_min,
+                                                   U                    lambda_max,
+                                                   const T*             b,
+                                                   T*                   x,
+                                                   rocsparse_index_base idx_base,
+                                                   T*                   r,
+                                                   T*                   d,
+                                                   T*                   d_next)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    dim3 blocks((m - 1) / (CSRCHEB_DIM / WF_SIZE) + 1);
+    dim3 threads(CSRCHEB_DIM);
+
+    // Center and half width of the eigenvalue interval
+    U theta = (lambda_max + lambda_min) / 2;
+    U delta = (lambda_max - lambda_min) / 2;
+    U sigma = theta / delta;
+    U rho   = static_cast<U>(1) / sigma;
+
+    // r = b - A x, d = r / theta
+    hipLaunchKernelGGL((csrcheb_residual_kernel<CSRCHEB_DIM, WF_SIZE>),
+                       blocks,
+                       threads,
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       csr_val,
+                       static_cast<T>(static_cast<U>(1) / theta),
+                       b,
+                       x,
+                       r,
+                       d,
+                       idx_base);
+
+    // Each step applies one product with A fused with the vector updates
+    for(rocsparse_int k = 1; k < degree; ++k)
+    {
+        U rho_next = static_cast<U>(1) / (2 * sigma - rho);
+
+        hipLaunchKernelGGL((csrcheb_step_kernel<CSRCHEB_DIM, WF_SIZE>),
+                           blocks,
+                           threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           static_cast<T>(rho_next * rho),
+                           static_cast<T>(2 * rho_next / delta),
+                           d,
+                           d_next,
+                           r,
+                           x,
+                           idx_base);
+
+        std::swap(d, d_next);
+        rho = rho_next;
+    }
+
+    // x = x + d
+    hipLaunchKernelGGL((csrcheb_update_kernel<CSRCHEB_DIM>),
+                       dim3((m - 1) / CSRCHEB_DIM + 1),
+                       threads,
+                       0,
+                       stream,
+                       m,
+                       d,
+                       x);
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csrcheb_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_int             degree,
+                                            U                         lambda_min,
+                                            U                         lambda_max,
+                                            const T*                  b,
+                                            T*                        x,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrcheb"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              degree,
+              lambda_min,
+              lambda_max,
+              (const void*&)b,
+              (const void*&)x,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f csrcheb -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> --nsweeps",
+              degree);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(degree < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // The eigenvalue interval must be positive and non-empty
+    if(lambda_min <= static_cast<U>(0) || lambda_max <= lambda_min)
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0 || degree == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(b == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Buffer
+    T* r;
+    T* d;
+    T* d_next;
+    T* partial_dot;
+    U* partial_nrm;
+    U* scalars;
+
+    rocsparse_csrcheb_split_buffer(
+        m, temp_buffer, &r, &d, &d_next, &partial_dot, &partial_nrm, &scalars);
+
+#define CSRCHEB_DISPATCH(WF_SIZE)                    \
+    rocsparse_csrcheb_dispatch<WF_SIZE>(handle,      \
+                                        m,           \
+                                        csr_val,     \
+                                        csr_row_ptr, \
+                                        csr_col_ind, \
+                                        degree,      \
+                                        lambda_min,  \
+                                        lambda_max,  \
+                                        b,           \
+                                        x,           \
+                                        descr->base, \
+                                        r,           \
+                                        d,           \
+                                        d_next)
+
+    switch(rocsparse_csrcheb_wfsize(handle, m, nnz))
+    {
+    case 2:
+        return CSRCHEB_DISPATCH(2);
+    case 4:
+        return CSRCHEB_DISPATCH(4);
+    case 8:
+        return CSRCHEB_DISPATCH(8);
+    case 16:
+        return CSRCHEB_DISPATCH(16);
+    case 32:
+        return CSRCHEB_DISPATCH(32);
+    case 64:
+        return CSRCHEB_DISPATCH(64);
+    }
+
+#undef CSRCHEB_DISPATCH
+
+    return rocsparse_status_internal_error;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE, REAL_TYPE)                                               \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,              \
+                                     rocsparse_int             m,                   \
+                                     rocsparse_int             nnz,                 \
+                                     const rocsparse_mat_descr descr,               \
+                                     const TYPE*               csr_val,             \
+                                     const rocsparse_int*      csr_row_ptr,         \
+                                     const rocsparse_int*      csr_col_ind,         \
+                                     size_t*                   buffer_size)         \
+    {                                                                               \
+        return rocsparse_csrcheb_buffer_size_template<TYPE, REAL_TYPE>(             \
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size); \
+    }
+
+C_IMPL(rocsparse_scsrcheb_buffer_size, float, float);
+C_IMPL(rocsparse_dcsrcheb_buffer_size, double, double);
+C_IMPL(rocsparse_ccsrcheb_buffer_size, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrcheb_buffer_size, rocsparse_double_complex, double);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE, REAL_TYPE)                                       \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_int             iters,       \
+                                     REAL_TYPE*                lambda_max,  \
+                                     void*                     temp_buffer) \
+    {                                                                       \
+        return rocsparse_csrcheb_estimate_template(handle,                  \
+                                                   m,                       \
+                                                   nnz,                     \
+                                                   descr,                   \
+                                                   csr_val,                 \
+                                                   csr_row_ptr,             \
+                                                   csr_col_ind,             \
+                                                   iters,                   \
+                                                   lambda_max,              \
+                                                   temp_buffer);            \
+    }
+
+C_IMPL(rocsparse_scsrcheb_estimate, float, float);
+C_IMPL(rocsparse_dcsrcheb_estimate, double, double);
+C_IMPL(rocsparse_ccsrcheb_estimate, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrcheb_estimate, rocsparse_double_complex, double);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE, REAL_TYPE)                                       \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     const TYPE*               csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_int             degree,      \
+                                     REAL_TYPE                 lambda_min,  \
+                                     REAL_TYPE                 lambda_max,  \
+                                     const TYPE*               b,           \
+                                     TYPE*                     x,           \
+                                     void*                     temp_buffer) \
+    {                                                                       \
+        return rocsparse_csrcheb_template(handle,                           \
+                                          m,                                \
+                                          nnz,                              \
+                                          descr,                            \
+                                          csr_val,                          \
+                                          csr_row_ptr,                      \
+                                          csr_col_ind,                      \
+                                          degree,                           \
+                                          lambda_min,                       \
+                                          lambda_max,                       \
+                                          b,                                \
+                                          x,                                \
+                                          temp_buffer);                     \
+    }
+
+C_IMPL(rocsparse_scsrcheb, float, float);
+C_IMPL(rocsparse_dcsrcheb, double, double);
+C_IMPL(rocsparse_ccsrcheb, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrcheb, rocsparse_double_complex, double);
+
+#undef C_IMPL
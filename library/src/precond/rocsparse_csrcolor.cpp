@@ -0,0 +1,451 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "utility.h"
+
+#include "csrcolor_device.h"
+
+#include <rocprim/rocprim.hpp>
+
+extern "C" rocsparse_status rocsparse_csrcolor_buffer_size(rocsparse_handle          handle,
+                                                           rocsparse_int             m,
+                                                           rocsparse_int             nnz,
+                                                           const rocsparse_mat_descr descr,
+                                                           const rocsparse_int*      csr_row_ptr,
+                                                           const rocsparse_int*      csr_col_ind,
+                                                           size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrcolor_buffer_size",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Remaining uncolored rows and number of colors
+    *buffer_size = 256;
+
+    // conflict array
+    *buffer_size += sizeof(int) * ((m - 1) / 256 + 1) * 256;
+
+    // sort keys and values
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256 * 3;
+
+    // rocprim buffer
+    size_t         rocprim_size;
+    size_t         rocprim_max = 0;
+    rocsparse_int* ptr         = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    rocprim::double_buffer<rocsparse_int> dummy(ptr, ptr);
+
+    RETURN_IF_HIP_ERROR(
+        rocprim::radix_sort_pairs(nullptr, rocprim_size, dummy, dummy, m, 0, 32, stream));
+    rocprim_max = std::max(rocprim_max, rocprim_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::reduce(
+        nullptr, rocprim_size, ptr, ptr, -1, m, rocprim::maximum<rocsparse_int>(), stream));
+    rocprim_max = std::max(rocprim_max, rocprim_size);
+
+    *buffer_size += ((rocprim_max - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrcolor(rocsparse_handle          handle,
+                                               rocsparse_int             m,
+                                               rocsparse_int             nnz,
+                                               const rocsparse_mat_descr descr,
+                                               const rocsparse_int*      csr_row_ptr,
+                                               const rocsparse_int*      csr_col_ind,
+                                               rocsparse_int*            ncolors,
+                                               rocsparse_int*            coloring,
+                                               rocsparse_int*            reordering,
+                                               void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrcolor",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)ncolors,
+              (const void*&)coloring,
+              (const void*&)reordering,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrcolor", "--mtx <matrix.mtx>");
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(ncolors == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(ncolors, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *ncolors = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(coloring == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Remaining uncolored rows
+    rocsparse_int* d_remaining = reinterpret_cast<rocsparse_int*>(ptr);
+
+    // Maximum color
+    rocsparse_int* d_max_color = d_remaining + 1;
+    ptr += 256;
+
+    // conflict array
+    int* conflict = reinterpret_cast<int*>(ptr);
+    ptr += sizeof(int) * ((m - 1) / 256 + 1) * 256;
+
+    // sort keys
+    rocsparse_int* keys1 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* keys2 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // sort values
+    rocsparse_int* vals1 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+    // Initialize all rows as uncolored
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(coloring, 0xFF, sizeof(rocsparse_int) * m, stream));
+
+#define CSRCOLOR_DIM 256
+    dim3 csrcolor_blocks((m - 1) / CSRCOLOR_DIM + 1);
+    dim3 csrcolor_threads(CSRCOLOR_DIM);
+
+    // Jones-Plassmann coloring, until all rows are colored
+    rocsparse_int remaining = m;
+    rocsparse_int round     = 0;
+
+    while(remaining > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_remaining, 0, sizeof(rocsparse_int), stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(conflict, 0, sizeof(int) * m, stream));
+
+        hipLaunchKernelGGL((csrcolor_assign_kernel<CSRCOLOR_DIM>),
+                           csrcolor_blocks,
+                           csrcolor_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           round,
+                           coloring,
+                           descr->base);
+
+        hipLaunchKernelGGL((csrcolor_conflict_kernel<CSRCOLOR_DIM>),
+                           csrcolor_blocks,
+                           csrcolor_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           round,
+                           coloring,
+                           conflict,
+                           descr->base);
+
+        hipLaunchKernelGGL((csrcolor_resolve_kernel<CSRCOLOR_DIM>),
+                           csrcolor_blocks,
+                           csrcolor_threads,
+                           0,
+                           stream,
+                           m,
+                           conflict,
+                           coloring,
+                           d_remaining);
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &remaining, d_remaining, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        ++round;
+    }
+
+    // Number of colors is the largest color plus one
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::reduce(nullptr,
+                                        rocprim_size,
+                                        coloring,
+                                        d_max_color,
+                                        -1,
+                                        m,
+                                        rocprim::maximum<rocsparse_int>(),
+                                        stream));
+    RETURN_IF_HIP_ERROR(rocprim::reduce(rocprim_buffer,
+                                        rocprim_size,
+                                        coloring,
+                                        d_max_color,
+                                        -1,
+                                        m,
+                                        rocprim::maximum<rocsparse_int>(),
+                                        stream));
+
+    rocsparse_int max_color;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &max_color, d_max_color, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    rocsparse_int h_ncolors = max_color + 1;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            ncolors, &h_ncolors, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+    }
+    else
+    {
+        *ncolors = h_ncolors;
+    }
+
+    // Balance the color classes, such that each color holds about m / ncolors rows
+    rocsparse_int  target        = (m - 1) / h_ncolors + 1;
+    rocsparse_int* prev_coloring = keys1;
+    rocsparse_int* color_size    = keys2;
+    rocsparse_int* color_keeper  = vals1;
+
+#define CSRCOLOR_BALANCE_ROUNDS 4
+    for(rocsparse_int iter = 0; iter < CSRCOLOR_BALANCE_ROUNDS; ++iter)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(color_size, 0, sizeof(rocsparse_int) * h_ncolors, stream));
+        RETURN_IF_HIP_ERROR(
+            hipMemsetAsync(color_keeper, 0x7F, sizeof(rocsparse_int) * h_ncolors, stream));
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(conflict, 0, sizeof(int) * m, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            prev_coloring, coloring, sizeof(rocsparse_int) * m, hipMemcpyDeviceToDevice, stream));
+
+        hipLaunchKernelGGL((csrcolor_histogram_kernel<CSRCOLOR_DIM>),
+                           csrcolor_blocks,
+                           csrcolor_threads,
+                           0,
+                           stream,
+                           m,
+                           coloring,
+                           color_size,
+                           color_keeper);
+
+        hipLaunchKernelGGL((csrcolor_balance_kernel<CSRCOLOR_DIM>),
+                           csrcolor_blocks,
+                           csrcolor_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           h_ncolors,
+                           target,
+                           iter,
+                           color_size,
+                           color_keeper,
+                           prev_coloring,
+                           coloring,
+                           descr->base);
+
+        hipLaunchKernelGGL((csrcolor_balance_conflict_kernel<CSRCOLOR_DIM>),
+                           csrcolor_blocks,
+                           csrcolor_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           prev_coloring,
+                           coloring,
+                           conflict,
+                           descr->base);
+
+        hipLaunchKernelGGL((csrcolor_balance_resolve_kernel<CSRCOLOR_DIM>),
+                           csrcolor_blocks,
+                           csrcolor_threads,
+                           0,
+                           stream,
+                           m,
+                           conflict,
+                           prev_coloring,
+                           coloring);
+    }
+#undef CSRCOLOR_BALANCE_ROUNDS
+#undef CSRCOLOR_DIM
+
+    // Reordering, such that all rows of the same color are contiguous
+    if(reordering != nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            keys1, coloring, sizeof(rocsparse_int) * m, hipMemcpyDeviceToDevice, stream));
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_identity_permutation(handle, m, vals1));
+
+        unsigned int startbit = 0;
+        unsigned int endbit   = rocsparse_clz(h_ncolors);
+
+        rocprim::double_buffer<rocsparse_int> keys(keys1, keys2);
+        rocprim::double_buffer<rocsparse_int> vals(vals1, reordering);
+
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+            nullptr, rocprim_size, keys, vals, m, startbit, endbit, stream));
+        RETURN_IF_HIP_ERROR(rocprim::radix_sort_pairs(
+            rocprim_buffer, rocprim_size, keys, vals, m, startbit, endbit, stream));
+
+        if(vals.current() != reordering)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(reordering,
+                                               vals.current(),
+                                               sizeof(rocsparse_int) * m,
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+        }
+    }
+
+    return rocsparse_status_success;
+}
@@ -0,0 +1,841 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "../extra/csrgemm_device.h"
+#include "csrfsai_device.h"
+#include "definitions.h"
+#include "utility.h"
+
+#include <rocprim/rocprim.hpp>
+
+#define CSRFSAI_DIM 256
+#define CSRFSAI_MAX_BLOCKS 256
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrfsai_nnz_kernel(rocsparse_int m,
+                            const rocsparse_int* __restrict__ csr_row_ptr_S,
+                            const rocsparse_int* __restrict__ csr_col_ind_S,
+                            rocsparse_int* __restrict__ csr_row_ptr_G,
+                            rocsparse_index_base idx_base_S,
+                            rocsparse_index_base idx_base_G)
+{
+    csrfsai_nnz_device<BLOCKSIZE>(
+        m, csr_row_ptr_S, csr_col_ind_S, csr_row_ptr_G, idx_base_S, idx_base_G);
+}
+
+template <unsigned int BLOCKSIZE>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrfsai_fill_kernel(rocsparse_int m,
+                             const rocsparse_int* __restrict__ csr_row_ptr_S,
+                             const rocsparse_int* __restrict__ csr_col_ind_S,
+                             const rocsparse_int* __restrict__ csr_row_ptr_G,
+                             rocsparse_int* __restrict__ csr_col_ind_G,
+                             rocsparse_index_base idx_base_S,
+                             rocsparse_index_base idx_base_G)
+{
+    csrfsai_fill_device<BLOCKSIZE>(
+        m, csr_row_ptr_S, csr_col_ind_S, csr_row_ptr_G, csr_col_ind_G, idx_base_S, idx_base_G);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrfsai_kernel(rocsparse_int m,
+                        const rocsparse_int* __restrict__ csr_row_ptr_A,
+                        const rocsparse_int* __restrict__ csr_col_ind_A,
+                        const T* __restrict__ csr_val_A,
+                        const rocsparse_int* __restrict__ csr_row_ptr_G,
+                        const rocsparse_int* __restrict__ csr_col_ind_G,
+                        T* __restrict__ csr_val_G,
+                        rocsparse_int nmax,
+                        T* __restrict__ workspace,
+                        rocsparse_int* __restrict__ zero_pivot,
+                        rocsparse_index_base idx_base_A,
+                        rocsparse_index_base idx_base_G)
+{
+    csrfsai_device<BLOCKSIZE, WFSIZE>(m,
+                                      csr_row_ptr_A,
+                                      csr_col_ind_A,
+                                      csr_val_A,
+                                      csr_row_ptr_G,
+                                      csr_col_ind_G,
+                                      csr_val_G,
+                                      nmax,
+                                      workspace,
+                                      zero_pivot,
+                                      idx_base_A,
+                                      idx_base_G);
+}
+
+// Maximum number of entries per row of G, the workspace holds CSRFSAI_DIM entries
+static rocsparse_status rocsparse_csrfsai_max_row_nnz(rocsparse_handle     handle,
+                                                      rocsparse_int        m,
+                                                      const rocsparse_int* csr_row_ptr_G,
+                                                      rocsparse_int*       workspace,
+                                                      rocsparse_int*       nmax)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    hipLaunchKernelGGL((csrgemm_max_row_nnz_part1<CSRFSAI_DIM>),
+                       dim3(CSRFSAI_DIM),
+                       dim3(CSRFSAI_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_G,
+                       workspace);
+
+    hipLaunchKernelGGL(
+        (csrgemm_max_row_nnz_part2<CSRFSAI_DIM>), dim3(1), dim3(CSRFSAI_DIM), 0, stream, workspace);
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(nmax, workspace, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
+
+// Number of wavefronts that process the rows of G, each of them owns a dense slot
+static rocsparse_int rocsparse_csrfsai_nslots(rocsparse_handle handle, rocsparse_int m)
+{
+    rocsparse_int nwf     = CSRFSAI_DIM / handle->wavefront_size;
+    rocsparse_int nblocks = std::min((m - 1) / nwf + 1, CSRFSAI_MAX_BLOCKS);
+
+    return nblocks * nwf;
+}
+
+extern "C" rocsparse_status rocsparse_csrfsai_nnz(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz_S,
+                                                  const rocsparse_mat_descr descr_S,
+                                                  const rocsparse_int*      csr_row_ptr_S,
+                                                  const rocsparse_int*      csr_col_ind_S,
+                                                  const rocsparse_mat_descr descr_G,
+                                                  rocsparse_int*            csr_row_ptr_G,
+                                                  rocsparse_int*            nnz_G)
+{
+    // Check for valid handle and matrix descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_S == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrfsai_nnz",
+              m,
+              nnz_S,
+              (const void*&)descr_S,
+              (const void*&)csr_row_ptr_S,
+              (const void*&)csr_col_ind_S,
+              (const void*&)descr_G,
+              (const void*&)csr_row_ptr_G,
+              (const void*&)nnz_G);
+
+    // Check index base
+    if(descr_S->base != rocsparse_index_base_zero && descr_S->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_G->base != rocsparse_index_base_zero && descr_G->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_S->type != rocsparse_matrix_type_general
+       || descr_G->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_S < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check nnz pointer
+    if(nnz_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_G, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_G = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr_S == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_S == nullptr && nnz_S != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Number of entries per row of G
+    hipLaunchKernelGGL((csrfsai_nnz_kernel<CSRFSAI_DIM>),
+                       dim3((m - 1) / CSRFSAI_DIM + 1),
+                       dim3(CSRFSAI_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_S,
+                       csr_col_ind_S,
+                       csr_row_ptr_G,
+                       descr_S->base,
+                       descr_G->base);
+
+    // Exclusive sum to obtain the row pointers of G
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_G,
+                                                csr_row_ptr_G,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    bool  temp_alloc     = false;
+    void* rocprim_buffer = nullptr;
+    if(handle->buffer_size >= rocprim_size)
+    {
+        rocprim_buffer = handle->buffer;
+        temp_alloc     = false;
+    }
+    else
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc(&rocprim_buffer, rocprim_size));
+        temp_alloc = true;
+    }
+
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_G,
+                                                csr_row_ptr_G,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    if(temp_alloc == true)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(rocprim_buffer));
+    }
+
+    // Number of entries of G
+    rocsparse_int nnz;
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        &nnz, csr_row_ptr_G + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    nnz -= descr_G->base;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(nnz_G, &nnz, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+        // Wait for device transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    else
+    {
+        *nnz_G = nnz;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrfsai_buffer_size_template(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz_A,
+                                                        const rocsparse_mat_descr descr_A,
+                                                        const T*                  csr_val_A,
+                                                        const rocsparse_int*      csr_row_ptr_A,
+                                                        const rocsparse_int*      csr_col_ind_A,
+                                                        const rocsparse_mat_descr descr_G,
+                                                        const rocsparse_int*      csr_row_ptr_G,
+                                                        size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptors
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrfsai_buffer_size"),
+              m,
+              nnz_A,
+              (const void*&)descr_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              (const void*&)descr_G,
+              (const void*&)csr_row_ptr_G,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_G->base != rocsparse_index_base_zero && descr_G->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_A->type != rocsparse_matrix_type_general
+       || descr_G->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_A < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz_A == 0)
+    {
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Largest local problem
+    rocsparse_int nmax;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrfsai_max_row_nnz(
+        handle, m, csr_row_ptr_G, reinterpret_cast<rocsparse_int*>(handle->buffer), &nmax));
+
+    // Workspace of the maximum reduction
+    *buffer_size = ((sizeof(rocsparse_int) * CSRFSAI_DIM - 1) / 256 + 1) * 256;
+
+    // Dense slots of the local problems
+    *buffer_size += ((sizeof(T) * rocsparse_csrfsai_nslots(handle, m) * nmax * nmax - 1) / 256 + 1)
+                    * 256;
+
+    return rocsparse_status_success;
+}
+
+template <unsigned int WFSIZE, typename T>
+static rocsparse_status rocsparse_csrfsai_dispatch(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   const rocsparse_mat_descr descr_A,
+                                                   const T*                  csr_val_A,
+                                                   const rocsparse_int*      csr_row_ptr_A,
+                                                   const rocsparse_int*      csr_col_ind_A,
+                                                   rocsparse_mat_info        info,
+                                                   const rocsparse_mat_descr descr_G,
+                                                   T*                        csr_val_G,
+                                                   const rocsparse_int*      csr_row_ptr_G,
+                                                   const rocsparse_int*      csr_col_ind_G,
+                                                   rocsparse_int             nmax,
+                                                   T*                        workspace)
+{
+    hipLaunchKernelGGL((csrfsai_kernel<CSRFSAI_DIM, WFSIZE>),
+                       dim3(rocsparse_csrfsai_nslots(handle, m) / (CSRFSAI_DIM / WFSIZE)),
+                       dim3(CSRFSAI_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       csr_row_ptr_A,
+                       csr_col_ind_A,
+                       csr_val_A,
+                       csr_row_ptr_G,
+                       csr_col_ind_G,
+                       csr_val_G,
+                       nmax,
+                       workspace,
+                       info->zero_pivot,
+                       descr_A->base,
+                       descr_G->base);
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrfsai_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz_A,
+                                            const rocsparse_mat_descr descr_A,
+                                            const T*                  csr_val_A,
+                                            const rocsparse_int*      csr_row_ptr_A,
+                                            const rocsparse_int*      csr_col_ind_A,
+                                            rocsparse_int             nnz_S,
+                                            const rocsparse_mat_descr descr_S,
+                                            const rocsparse_int*      csr_row_ptr_S,
+                                            const rocsparse_int*      csr_col_ind_S,
+                                            rocsparse_mat_info        info,
+                                            const rocsparse_mat_descr descr_G,
+                                            T*                        csr_val_G,
+                                            const rocsparse_int*      csr_row_ptr_G,
+                                            rocsparse_int*            csr_col_ind_G,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle, matrix descriptors and info structure
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_S == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(descr_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrfsai"),
+              m,
+              nnz_A,
+              (const void*&)descr_A,
+              (const void*&)csr_val_A,
+              (const void*&)csr_row_ptr_A,
+              (const void*&)csr_col_ind_A,
+              nnz_S,
+              (const void*&)descr_S,
+              (const void*&)csr_row_ptr_S,
+              (const void*&)csr_col_ind_S,
+              (const void*&)info,
+              (const void*&)descr_G,
+              (const void*&)csr_val_G,
+              (const void*&)csr_row_ptr_G,
+              (const void*&)csr_col_ind_G,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrfsai -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr_A->base != rocsparse_index_base_zero && descr_A->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_S->base != rocsparse_index_base_zero && descr_S->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_G->base != rocsparse_index_base_zero && descr_G->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr_A->type != rocsparse_matrix_type_general
+       || descr_S->type != rocsparse_matrix_type_general
+       || descr_G->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_A < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_S < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz_A == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_A == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_S == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_S == nullptr && nnz_S != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_G == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Workspace of the maximum reduction
+    rocsparse_int* workspace = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * CSRFSAI_DIM - 1) / 256 + 1) * 256;
+
+    // Dense slots of the local problems
+    T* local = reinterpret_cast<T*>(ptr);
+
+    // Allocate buffer to hold zero pivot
+    if(info->zero_pivot == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&info->zero_pivot, sizeof(rocsparse_int)));
+    }
+
+    // Initialize zero pivot
+    rocsparse_int max = std::numeric_limits<rocsparse_int>::max();
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        info->zero_pivot, &max, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+    // Column indices of G
+    hipLaunchKernelGGL((csrfsai_fill_kernel<CSRFSAI_DIM>),
+                       dim3((m - 1) / CSRFSAI_DIM + 1),
+                       dim3(CSRFSAI_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr_S,
+                       csr_col_ind_S,
+                       csr_row_ptr_G,
+                       csr_col_ind_G,
+                       descr_S->base,
+                       descr_G->base);
+
+    // Largest local problem
+    rocsparse_int nmax;
+    RETURN_IF_ROCSPARSE_ERROR(
+        rocsparse_csrfsai_max_row_nnz(handle, m, csr_row_ptr_G, workspace, &nmax));
+
+    // Local problems
+    if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        return rocsparse_csrfsai_dispatch<32>(handle,
+                                              m,
+                                              descr_A,
+                                              csr_val_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              info,
+                                              descr_G,
+                                              csr_val_G,
+                                              csr_row_ptr_G,
+                                              csr_col_ind_G,
+                                              nmax,
+                                              local);
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        return rocsparse_csrfsai_dispatch<64>(handle,
+                                              m,
+                                              descr_A,
+                                              csr_val_A,
+                                              csr_row_ptr_A,
+                                              csr_col_ind_A,
+                                              info,
+                                              descr_G,
+                                              csr_val_G,
+                                              csr_row_ptr_G,
+                                              csr_col_ind_G,
+                                              nmax,
+                                              local);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_int             m,             \
+                                     rocsparse_int             nnz_A,         \
+                                     const rocsparse_mat_descr descr_A,       \
+                                     const TYPE*               csr_val_A,     \
+                                     const rocsparse_int*      csr_row_ptr_A, \
+                                     const rocsparse_int*      csr_col_ind_A, \
+                                     const rocsparse_mat_descr descr_G,       \
+                                     const rocsparse_int*      csr_row_ptr_G, \
+                                     size_t*                   buffer_size)   \
+    {                                                                         \
+        return rocsparse_csrfsai_buffer_size_template(handle,                 \
+                                                      m,                      \
+                                                      nnz_A,                  \
+                                                      descr_A,                \
+                                                      csr_val_A,              \
+                                                      csr_row_ptr_A,          \
+                                                      csr_col_ind_A,          \
+                                                      descr_G,                \
+                                                      csr_row_ptr_G,          \
+                                                      buffer_size);           \
+    }
+
+C_IMPL(rocsparse_scsrfsai_buffer_size, float);
+C_IMPL(rocsparse_dcsrfsai_buffer_size, double);
+C_IMPL(rocsparse_ccsrfsai_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrfsai_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,        \
+                                     rocsparse_int             m,             \
+                                     rocsparse_int             nnz_A,         \
+                                     const rocsparse_mat_descr descr_A,       \
+                                     const TYPE*               csr_val_A,     \
+                                     const rocsparse_int*      csr_row_ptr_A, \
+                                     const rocsparse_int*      csr_col_ind_A, \
+                                     rocsparse_int             nnz_S,         \
+                                     const rocsparse_mat_descr descr_S,       \
+                                     const rocsparse_int*      csr_row_ptr_S, \
+                                     const rocsparse_int*      csr_col_ind_S, \
+                                     rocsparse_mat_info        info,          \
+                                     const rocsparse_mat_descr descr_G,       \
+                                     TYPE*                     csr_val_G,     \
+                                     const rocsparse_int*      csr_row_ptr_G, \
+                                     rocsparse_int*            csr_col_ind_G, \
+                                     void*                     temp_buffer)   \
+    {                                                                         \
+        return rocsparse_csrfsai_template(handle,                             \
+                                          m,                                  \
+                                          nnz_A,                              \
+                                          descr_A,                            \
+                                          csr_val_A,                          \
+                                          csr_row_ptr_A,                      \
+                                          csr_col_ind_A,                      \
+                                          nnz_S,                              \
+                                          descr_S,                            \
+                                          csr_row_ptr_S,                      \
+                                          csr_col_ind_S,                      \
+                                          info,                               \
+                                          descr_G,                            \
+                                          csr_val_G,                          \
+                                          csr_row_ptr_G,                      \
+                                          csr_col_ind_G,                      \
+                                          temp_buffer);                       \
+    }
+
+C_IMPL(rocsparse_scsrfsai, float);
+C_IMPL(rocsparse_dcsrfsai, double);
+C_IMPL(rocsparse_ccsrfsai, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrfsai, rocsparse_double_complex);
+
+#undef C_IMPL
+
+extern "C" rocsparse_status rocsparse_csrfsai_zero_pivot(rocsparse_handle   handle,
+                                                         rocsparse_mat_info info,
+                                                         rocsparse_int*     position)
+{
+    // Check for valid handle and matrix info
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle, "rocsparse_csrfsai_zero_pivot", (const void*&)info, (const void*&)position);
+
+    // Check pointer arguments
+    if(position == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // If m == 0 || nnz_A == 0 it can happen, that the zero pivot has not been allocated.
+    // In this case, always return -1.
+    if(info->zero_pivot == nullptr)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *position = -1;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Differentiate between pointer modes
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        // rocsparse_pointer_mode_device
+        rocsparse_int pivot;
+
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            &pivot, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(pivot == std::numeric_limits<rocsparse_int>::max())
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(position, 255, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(position,
+                                               info->zero_pivot,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToDevice,
+                                               stream));
+
+            return rocsparse_status_zero_pivot;
+        }
+    }
+    else
+    {
+        // rocsparse_pointer_mode_host
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(position, info->zero_pivot, sizeof(rocsparse_int), hipMemcpyDeviceToHost));
+
+        // If no zero pivot is found, set -1
+        if(*position == std::numeric_limits<rocsparse_int>::max())
+        {
+            *position = -1;
+        }
+        else
+        {
+            return rocsparse_status_zero_pivot;
+        }
+    }
+
+    return rocsparse_status_success;
+}
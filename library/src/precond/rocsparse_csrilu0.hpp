@@ -134,13 +134,13 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
     }
 
     // Check analysis policy
-    if(analysis != rocsparse_analysis_policy_reuse && analysis != rocsparse_analysis_policy_force)
+    if(rocsparse_enum_utils::is_invalid(analysis))
     {
         return rocsparse_status_invalid_value;
     }
 
     // Check solve policy
-    if(solve != rocsparse_solve_policy_auto)
+    if(rocsparse_enum_utils::is_invalid(solve))
     {
         return rocsparse_status_invalid_value;
     }
@@ -206,7 +206,8 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
             info->csrilu0_info = info->csrsv_lower_info;
             return rocsparse_status_success;
         }
-        else if(info->csrsvt_upper_info != nullptr)
+        else if(info->csrsvt_upper_info != nullptr
+                && info->csrsvt_upper_info->trmt_dep_count == nullptr)
         {
             // csrsvt meta data
             info->csrilu0_info = info->csrsvt_upper_info;
@@ -225,6 +226,26 @@ rocsparse_status rocsparse_csrilu0_analysis_template(rocsparse_handle          h
             return rocsparse_status_success;
         }
     }
+    else if(analysis == rocsparse_analysis_policy_numeric)
+    {
+        // Only the values have changed, re-use the meta data if it has been
+        // gathered for the same sparsity pattern
+        unsigned long long pattern_hash;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csr_pattern_hash(
+            handle, m, nnz, csr_row_ptr, csr_col_ind, temp_buffer, &pattern_hash));
+
+        if(rocsparse_trm_pattern_match(info->csrilu0_info, m, nnz, pattern_hash))
+        {
+            return rocsparse_status_success;
+        }
+
+        // The pattern has changed. Meta data that is shared with other routines
+        // is left to them, they will detect the change on their own.
+        if(rocsparse_check_trm_shared(info, info->csrilu0_info))
+        {
+            info->csrilu0_info = nullptr;
+        }
+    }
 
     // User is explicitly asking to force a re-analysis, or no valid data has been
     // found to be re-used.
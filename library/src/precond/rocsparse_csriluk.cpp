@@ -0,0 +1,969 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "utility.h"
+
+#include "../extra/rocsparse_csrgemm.hpp"
+#include "csriluk_device.h"
+#include "rocsparse_csrilu0.hpp"
+
+#include <rocprim/rocprim.hpp>
+
+template <unsigned int BLOCKSIZE, unsigned int WF_SIZE, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csriluk_scatter_kernel(rocsparse_int m,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                const T* __restrict__ csr_val,
+                                const rocsparse_int* __restrict__ csr_row_ptr_lu,
+                                const rocsparse_int* __restrict__ csr_col_ind_lu,
+                                T* __restrict__ csr_val_lu,
+                                rocsparse_index_base idx_base)
+{
+    csriluk_scatter_device<BLOCKSIZE, WF_SIZE>(
+        m, csr_row_ptr, csr_col_ind, csr_val, csr_row_ptr_lu, csr_col_ind_lu, csr_val_lu, idx_base);
+}
+
+// Level-of-fill pattern in zero based CSR format, the level of each entry is stored as its
+// value
+struct csriluk_levels
+{
+    rocsparse_int  nnz      = 0;
+    rocsparse_int  capacity = 0;
+    rocsparse_int* row_ptr  = nullptr;
+    rocsparse_int* col_ind  = nullptr;
+    float*         lev      = nullptr;
+};
+
+// Device storage of the level-of-fill computation
+struct csriluk_workspace
+{
+    csriluk_levels P;
+    csriluk_levels Q;
+    csriluk_levels L;
+    csriluk_levels U;
+    csriluk_levels F;
+
+    rocsparse_mat_info info_F = nullptr;
+
+    void*  buffer      = nullptr;
+    size_t buffer_size = 0;
+};
+
+static rocsparse_status
+    csriluk_levels_reserve(csriluk_levels& A, rocsparse_int m, rocsparse_int nnz)
+{
+    if(A.row_ptr == nullptr)
+    {
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&A.row_ptr, sizeof(rocsparse_int) * (m + 1)));
+    }
+
+    if(A.capacity < nnz)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(A.col_ind));
+        RETURN_IF_HIP_ERROR(hipFree(A.lev));
+
+        A.col_ind  = nullptr;
+        A.lev      = nullptr;
+        A.capacity = 0;
+
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&A.col_ind, sizeof(rocsparse_int) * nnz));
+        RETURN_IF_HIP_ERROR(hipMalloc((void**)&A.lev, sizeof(float) * nnz));
+
+        A.capacity = nnz;
+    }
+
+    A.nnz = nnz;
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status csriluk_levels_free(csriluk_levels& A)
+{
+    RETURN_IF_HIP_ERROR(hipFree(A.row_ptr));
+    RETURN_IF_HIP_ERROR(hipFree(A.col_ind));
+    RETURN_IF_HIP_ERROR(hipFree(A.lev));
+
+    A.row_ptr  = nullptr;
+    A.col_ind  = nullptr;
+    A.lev      = nullptr;
+    A.capacity = 0;
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status csriluk_workspace_reserve(csriluk_workspace& w, size_t size)
+{
+    if(w.buffer_size < size)
+    {
+        RETURN_IF_HIP_ERROR(hipFree(w.buffer));
+
+        w.buffer      = nullptr;
+        w.buffer_size = 0;
+
+        RETURN_IF_HIP_ERROR(hipMalloc(&w.buffer, size));
+
+        w.buffer_size = size;
+    }
+
+    return rocsparse_status_success;
+}
+
+static rocsparse_status csriluk_workspace_free(csriluk_workspace& w)
+{
+    RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_free(w.P));
+    RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_free(w.Q));
+    RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_free(w.L));
+    RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_free(w.U));
+    RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_free(w.F));
+
+    if(w.info_F != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_mat_info(w.info_F));
+        w.info_F = nullptr;
+    }
+
+    RETURN_IF_HIP_ERROR(hipFree(w.buffer));
+
+    w.buffer      = nullptr;
+    w.buffer_size = 0;
+
+    return rocsparse_status_success;
+}
+
+// Exclusive scan of the row entries that have been written to row_ptr, the total number
+// of entries is returned in nnz
+static rocsparse_status csriluk_levels_scan(rocsparse_handle   handle,
+                                            rocsparse_int      m,
+                                            rocsparse_int*     row_ptr,
+                                            csriluk_workspace& w,
+                                            rocsparse_int*     nnz)
+{
+    hipStream_t stream = handle->stream;
+
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                rocprim_size,
+                                                row_ptr,
+                                                row_ptr,
+                                                0,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_ROCSPARSE_ERROR(csriluk_workspace_reserve(w, rocprim_size));
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(w.buffer,
+                                                rocprim_size,
+                                                row_ptr,
+                                                row_ptr,
+                                                0,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(nnz, row_ptr + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    return rocsparse_status_success;
+}
+
+// Compute the level-of-fill pattern of the incomplete LU factorization on the device.
+// The level of an entry is given by
+//
+//     lev(i,j) = min(lev_A(i,j), min_{h < min(i,j)} lev(i,h) + lev(h,j) + 1),
+//
+// where all entries of A have level 0. Starting with the pattern P of A, each sweep
+// splits P into its strictly lower part L and strictly upper part U, computes the
+// fill-in F = L * U over the (min, +) semiring with alpha = 1 and merges min(P, F) into
+// P. Entries with a level larger than k are dropped. After sweep s, all entries up to
+// level s have their final level, such that k sweeps are sufficient. The pattern is
+// returned in w.P. Requires host pointer mode.
+static rocsparse_status rocsparse_csriluk_sweeps(rocsparse_handle     handle,
+                                                 rocsparse_int        m,
+                                                 rocsparse_int        nnz,
+                                                 rocsparse_index_base idx_base,
+                                                 const rocsparse_int* csr_row_ptr,
+                                                 const rocsparse_int* csr_col_ind,
+                                                 rocsparse_int        level_of_fill,
+                                                 csriluk_workspace&   w)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+#define CSRILUK_DIM 256
+    RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_reserve(w.P, m, nnz));
+
+    hipLaunchKernelGGL((csriluk_levels_init<CSRILUK_DIM>),
+                       dim3((std::max(m + 1, nnz) - 1) / CSRILUK_DIM + 1),
+                       dim3(CSRILUK_DIM),
+                       0,
+                       stream,
+                       m,
+                       nnz,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       w.P.row_ptr,
+                       w.P.col_ind,
+                       w.P.lev,
+                       idx_base);
+
+    // Intermediate matrices are zero based and of general type
+    _rocsparse_mat_descr descr;
+
+    float alpha = 1.0f;
+
+    dim3 csriluk_blocks((m - 1) / CSRILUK_DIM + 1);
+    dim3 csriluk_threads(CSRILUK_DIM);
+
+    for(rocsparse_int sweep = 0; sweep < level_of_fill; ++sweep)
+    {
+        // Split P into L and U
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_reserve(w.L, m, 0));
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_reserve(w.U, m, 0));
+
+        hipLaunchKernelGGL((csriluk_levels_split_count<CSRILUK_DIM>),
+                           csriluk_blocks,
+                           csriluk_threads,
+                           0,
+                           stream,
+                           m,
+                           w.P.row_ptr,
+                           w.P.col_ind,
+                           w.P.lev,
+                           level_of_fill,
+                           w.L.row_ptr,
+                           w.U.row_ptr);
+
+        rocsparse_int nnz_L;
+        rocsparse_int nnz_U;
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_scan(handle, m, w.L.row_ptr, w, &nnz_L));
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_scan(handle, m, w.U.row_ptr, w, &nnz_U));
+
+        // No further fill-in
+        if(nnz_L == 0 || nnz_U == 0)
+        {
+            break;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_reserve(w.L, m, nnz_L));
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_reserve(w.U, m, nnz_U));
+
+        hipLaunchKernelGGL((csriluk_levels_split_fill<CSRILUK_DIM>),
+                           csriluk_blocks,
+                           csriluk_threads,
+                           0,
+                           stream,
+                           m,
+                           w.P.row_ptr,
+                           w.P.col_ind,
+                           w.P.lev,
+                           level_of_fill,
+                           w.L.row_ptr,
+                           w.L.col_ind,
+                           w.L.lev,
+                           w.U.row_ptr,
+                           w.U.col_ind,
+                           w.U.lev);
+
+        // Fill-in levels F = L * U over the (min, +) semiring
+        size_t gemm_size;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrgemm_buffer_size_template(handle,
+                                                   rocsparse_operation_none,
+                                                   rocsparse_operation_none,
+                                                   m,
+                                                   m,
+                                                   m,
+                                                   &alpha,
+                                                   &descr,
+                                                   nnz_L,
+                                                   (const rocsparse_int*)w.L.row_ptr,
+                                                   (const rocsparse_int*)w.L.col_ind,
+                                                   &descr,
+                                                   nnz_U,
+                                                   (const rocsparse_int*)w.U.row_ptr,
+                                                   (const rocsparse_int*)w.U.col_ind,
+                                                   (const float*)nullptr,
+                                                   nullptr,
+                                                   (rocsparse_int)0,
+                                                   (const rocsparse_int*)nullptr,
+                                                   (const rocsparse_int*)nullptr,
+                                                   w.info_F,
+                                                   &gemm_size));
+
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_workspace_reserve(w, gemm_size));
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_reserve(w.F, m, 0));
+
+        rocsparse_int nnz_F;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrgemm_nnz_template(handle,
+                                           rocsparse_operation_none,
+                                           rocsparse_operation_none,
+                                           m,
+                                           m,
+                                           m,
+                                           &descr,
+                                           nnz_L,
+                                           (const rocsparse_int*)w.L.row_ptr,
+                                           (const rocsparse_int*)w.L.col_ind,
+                                           &descr,
+                                           nnz_U,
+                                           (const rocsparse_int*)w.U.row_ptr,
+                                           (const rocsparse_int*)w.U.col_ind,
+                                           nullptr,
+                                           (rocsparse_int)0,
+                                           (const rocsparse_int*)nullptr,
+                                           (const rocsparse_int*)nullptr,
+                                           &descr,
+                                           w.F.row_ptr,
+                                           &nnz_F,
+                                           w.info_F,
+                                           w.buffer));
+
+        if(nnz_F == 0)
+        {
+            break;
+        }
+
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_reserve(w.F, m, nnz_F));
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrgemm_semiring_template(handle,
+                                                rocsparse_semiring_min_plus,
+                                                rocsparse_operation_none,
+                                                rocsparse_operation_none,
+                                                m,
+                                                m,
+                                                m,
+                                                &alpha,
+                                                &descr,
+                                                nnz_L,
+                                                (const float*)w.L.lev,
+                                                (const rocsparse_int*)w.L.row_ptr,
+                                                (const rocsparse_int*)w.L.col_ind,
+                                                &descr,
+                                                nnz_U,
+                                                (const float*)w.U.lev,
+                                                (const rocsparse_int*)w.U.row_ptr,
+                                                (const rocsparse_int*)w.U.col_ind,
+                                                &descr,
+                                                w.F.lev,
+                                                (const rocsparse_int*)w.F.row_ptr,
+                                                w.F.col_ind,
+                                                w.info_F,
+                                                w.buffer));
+
+        // Q = min(P, F)
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_reserve(w.Q, m, 0));
+
+        hipLaunchKernelGGL((csriluk_levels_merge_count<CSRILUK_DIM>),
+                           csriluk_blocks,
+                           csriluk_threads,
+                           0,
+                           stream,
+                           m,
+                           w.P.row_ptr,
+                           w.P.col_ind,
+                           w.F.row_ptr,
+                           w.F.col_ind,
+                           w.F.lev,
+                           level_of_fill,
+                           w.Q.row_ptr);
+
+        rocsparse_int nnz_Q;
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_scan(handle, m, w.Q.row_ptr, w, &nnz_Q));
+        RETURN_IF_ROCSPARSE_ERROR(csriluk_levels_reserve(w.Q, m, nnz_Q));
+
+        hipLaunchKernelGGL((csriluk_levels_merge_fill<CSRILUK_DIM>),
+                           csriluk_blocks,
+                           csriluk_threads,
+                           0,
+                           stream,
+                           m,
+                           w.P.row_ptr,
+                           w.P.col_ind,
+                           w.P.lev,
+                           w.F.row_ptr,
+                           w.F.col_ind,
+                           w.F.lev,
+                           level_of_fill,
+                           w.Q.row_ptr,
+                           w.Q.col_ind,
+                           w.Q.lev);
+
+        std::swap(w.P, w.Q);
+    }
+#undef CSRILUK_DIM
+
+    return rocsparse_status_success;
+}
+
+// Compute the level-of-fill pattern and store it in iluk
+static rocsparse_status rocsparse_csriluk_pattern(rocsparse_handle       handle,
+                                                  rocsparse_int          m,
+                                                  rocsparse_int          nnz,
+                                                  rocsparse_index_base   idx_base,
+                                                  const rocsparse_int*   csr_row_ptr,
+                                                  const rocsparse_int*   csr_col_ind,
+                                                  rocsparse_int          level_of_fill,
+                                                  rocsparse_csriluk_info iluk)
+{
+    csriluk_workspace w;
+
+    // The number of entries of the intermediate matrices is required on the host
+    rocsparse_pointer_mode pointer_mode = handle->pointer_mode;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, rocsparse_pointer_mode_host));
+
+    rocsparse_status status = rocsparse_create_mat_info(&w.info_F);
+
+    if(status == rocsparse_status_success)
+    {
+        status = rocsparse_csriluk_sweeps(
+            handle, m, nnz, idx_base, csr_row_ptr, csr_col_ind, level_of_fill, w);
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_set_pointer_mode(handle, pointer_mode));
+
+    if(status == rocsparse_status_success)
+    {
+        // Keep the pattern, its levels are not required anymore
+        iluk->m             = m;
+        iluk->nnz           = nnz;
+        iluk->level_of_fill = level_of_fill;
+        iluk->base          = idx_base;
+        iluk->nnz_lu        = w.P.nnz;
+        iluk->lu_row_ptr    = w.P.row_ptr;
+        iluk->lu_col_ind    = w.P.col_ind;
+        iluk->pattern_ready = true;
+
+        w.P.row_ptr = nullptr;
+        w.P.col_ind = nullptr;
+    }
+
+    RETURN_IF_ROCSPARSE_ERROR(csriluk_workspace_free(w));
+
+    return status;
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_nnz(rocsparse_handle          handle,
+                                                  rocsparse_int             m,
+                                                  rocsparse_int             nnz,
+                                                  const rocsparse_mat_descr descr,
+                                                  const rocsparse_int*      csr_row_ptr,
+                                                  const rocsparse_int*      csr_col_ind,
+                                                  rocsparse_int             level_of_fill,
+                                                  rocsparse_mat_info        info,
+                                                  rocsparse_int*            csr_row_ptr_lu,
+                                                  rocsparse_int*            nnz_lu)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_nnz",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              level_of_fill,
+              (const void*&)info,
+              (const void*&)csr_row_ptr_lu,
+              (const void*&)nnz_lu);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(level_of_fill < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(nnz_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(nnz_lu, 0, sizeof(rocsparse_int), stream));
+        }
+        else
+        {
+            *nnz_lu = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Symbolic factorization, the pattern is kept for rocsparse_csriluk_symbolic()
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    info->csriluk_info = nullptr;
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csriluk_info(&info->csriluk_info));
+
+    rocsparse_csriluk_info iluk = info->csriluk_info;
+
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_csriluk_pattern(
+        handle, m, nnz, descr->base, csr_row_ptr, csr_col_ind, level_of_fill, iluk));
+
+#define CSRILUK_DIM 256
+    hipLaunchKernelGGL((csriluk_shift_index<CSRILUK_DIM>),
+                       dim3(m / CSRILUK_DIM + 1),
+                       dim3(CSRILUK_DIM),
+                       0,
+                       stream,
+                       m + 1,
+                       iluk->lu_row_ptr,
+                       csr_row_ptr_lu,
+                       descr->base);
+#undef CSRILUK_DIM
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(nnz_lu,
+                                           iluk->lu_row_ptr + m,
+                                           sizeof(rocsparse_int),
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+    }
+    else
+    {
+        *nnz_lu = iluk->nnz_lu;
+    }
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csriluk_symbolic(rocsparse_handle          handle,
+                                                       rocsparse_int             m,
+                                                       rocsparse_int             nnz,
+                                                       const rocsparse_mat_descr descr,
+                                                       const rocsparse_int*      csr_row_ptr,
+                                                       const rocsparse_int*      csr_col_ind,
+                                                       rocsparse_int             level_of_fill,
+                                                       rocsparse_mat_info        info,
+                                                       rocsparse_int*            csr_col_ind_lu)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csriluk_symbolic",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              level_of_fill,
+              (const void*&)info,
+              (const void*&)csr_col_ind_lu);
+
+    log_bench(handle, "./rocsparse-bench -f csriluk", "--mtx <matrix.mtx>");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(level_of_fill < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Symbolic factorization
+    rocsparse_csriluk_info iluk = info->csriluk_info;
+
+    // Re-use the pattern that has been computed by rocsparse_csriluk_nnz(), if it has not
+    // been consumed yet
+    if(iluk == nullptr || iluk->pattern_ready == false || iluk->m != m || iluk->nnz != nnz
+       || iluk->level_of_fill != level_of_fill || iluk->base != descr->base)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+        info->csriluk_info = nullptr;
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_create_csriluk_info(&info->csriluk_info));
+
+        iluk = info->csriluk_info;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csriluk_pattern(
+            handle, m, nnz, descr->base, csr_row_ptr, csr_col_ind, level_of_fill, iluk));
+    }
+
+    if(iluk->nnz_lu > 0)
+    {
+#define CSRILUK_DIM 256
+        hipLaunchKernelGGL((csriluk_shift_index<CSRILUK_DIM>),
+                           dim3((iluk->nnz_lu - 1) / CSRILUK_DIM + 1),
+                           dim3(CSRILUK_DIM),
+                           0,
+                           stream,
+                           iluk->nnz_lu,
+                           iluk->lu_col_ind,
+                           csr_col_ind_lu,
+                           descr->base);
+#undef CSRILUK_DIM
+    }
+
+    // The pattern has been consumed and is not required anymore
+    RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    info->csriluk_info = nullptr;
+
+    return rocsparse_status_success;
+}
+
+template <typename T, typename U>
+rocsparse_status rocsparse_csriluk_template(rocsparse_handle          handle,
+                                           rocsparse_int             m,
+                                           rocsparse_int             nnz,
+                                           const rocsparse_mat_descr descr,
+                                           const T*                  csr_val,
+                                           const rocsparse_int*      csr_row_ptr,
+                                           const rocsparse_int*      csr_col_ind,
+                                           rocsparse_int             nnz_lu,
+                                           T*                        csr_val_lu,
+                                           const rocsparse_int*      csr_row_ptr_lu,
+                                           const rocsparse_int*      csr_col_ind_lu,
+                                           rocsparse_mat_info        info,
+                                           rocsparse_solve_policy    policy,
+                                           void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsriluk"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              nnz_lu,
+              (const void*&)csr_val_lu,
+              (const void*&)csr_row_ptr_lu,
+              (const void*&)csr_col_ind_lu,
+              (const void*&)info,
+              policy,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csriluk -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(rocsparse_enum_utils::is_invalid(policy))
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz_lu < nnz)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz_lu == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    if(info->csrilu0_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Copy the entries of A into the pattern of the factorization
+#define CSRILUK_DIM 256
+    if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        hipLaunchKernelGGL((csriluk_scatter_kernel<CSRILUK_DIM, 32>),
+                           dim3((32 * m - 1) / CSRILUK_DIM + 1),
+                           dim3(CSRILUK_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           csr_row_ptr_lu,
+                           csr_col_ind_lu,
+                           csr_val_lu,
+                           descr->base);
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        hipLaunchKernelGGL((csriluk_scatter_kernel<CSRILUK_DIM, 64>),
+                           dim3((64 * m - 1) / CSRILUK_DIM + 1),
+                           dim3(CSRILUK_DIM),
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           csr_row_ptr_lu,
+                           csr_col_ind_lu,
+                           csr_val_lu,
+                           descr->base);
+    }
+#undef CSRILUK_DIM
+
+    // Numeric factorization on the level-of-fill pattern
+    return rocsparse_csrilu0_template<T, U>(handle,
+                                            m,
+                                            nnz_lu,
+                                            descr,
+                                            csr_val_lu,
+                                            csr_row_ptr_lu,
+                                            csr_col_ind_lu,
+                                            info,
+                                            policy,
+                                            temp_buffer);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE, REAL_TYPE)                                          \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,         \
+                                     rocsparse_int             m,              \
+                                     rocsparse_int             nnz,            \
+                                     const rocsparse_mat_descr descr,          \
+                                     const TYPE*               csr_val,        \
+                                     const rocsparse_int*      csr_row_ptr,    \
+                                     const rocsparse_int*      csr_col_ind,    \
+                                     rocsparse_int             nnz_lu,         \
+                                     TYPE*                     csr_val_lu,     \
+                                     const rocsparse_int*      csr_row_ptr_lu, \
+                                     const rocsparse_int*      csr_col_ind_lu, \
+                                     rocsparse_mat_info        info,           \
+                                     rocsparse_solve_policy    policy,         \
+                                     void*                     temp_buffer)    \
+    {                                                                          \
+        if(info != nullptr && info->use_double_prec_tol)                       \
+        {                                                                      \
+            return rocsparse_csriluk_template<TYPE, double>(handle,            \
+                                                            m,                 \
+                                                            nnz,               \
+                                                            descr,             \
+                                                            csr_val,           \
+                                                            csr_row_ptr,       \
+                                                            csr_col_ind,       \
+                                                            nnz_lu,            \
+                                                            csr_val_lu,        \
+                                                            csr_row_ptr_lu,    \
+                                                            csr_col_ind_lu,    \
+                                                            info,              \
+                                                            policy,            \
+                                                            temp_buffer);      \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            return rocsparse_csriluk_template<TYPE, REAL_TYPE>(handle,         \
+                                                               m,              \
+                                                               nnz,            \
+                                                               descr,          \
+                                                               csr_val,        \
+                                                               csr_row_ptr,    \
+                                                               csr_col_ind,    \
+                                                               nnz_lu,         \
+                                                               csr_val_lu,     \
+                                                               csr_row_ptr_lu, \
+                                                               csr_col_ind_lu, \
+                                                               info,           \
+                                                               policy,         \
+                                                               temp_buffer);   \
+        }                                                                      \
+    }
+
+C_IMPL(rocsparse_scsriluk, float, float);
+C_IMPL(rocsparse_dcsriluk, double, double);
+C_IMPL(rocsparse_ccsriluk, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsriluk, rocsparse_double_complex, double);
+
+#undef C_IMPL
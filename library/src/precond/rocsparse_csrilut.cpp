@@ -0,0 +1,909 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "definitions.h"
+#include "utility.h"
+
+#include "csrilut_device.h"
+
+#include <rocprim/rocprim.hpp>
+
+template <unsigned int BLOCKSIZE,
+          unsigned int WFSIZE,
+          unsigned int HASH,
+          typename T,
+          typename U,
+          typename V,
+          typename W>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrilut_factorize_kernel(rocsparse_int m,
+                                  const rocsparse_int* __restrict__ csr_row_ptr,
+                                  const rocsparse_int* __restrict__ csr_col_ind,
+                                  const T* __restrict__ csr_val,
+                                  U             tol,
+                                  rocsparse_int max_fill,
+                                  rocsparse_int* __restrict__ l_nnz,
+                                  rocsparse_int* __restrict__ l_col,
+                                  T* __restrict__ l_val,
+                                  rocsparse_int* __restrict__ u_nnz,
+                                  rocsparse_int* __restrict__ u_col,
+                                  T* __restrict__ u_val,
+                                  int* __restrict__ done,
+                                  rocsparse_int* __restrict__ work_mark,
+                                  rocsparse_int* __restrict__ work_list,
+                                  rocsparse_int* __restrict__ work_rank,
+                                  T* __restrict__ work_val,
+                                  rocsparse_int* __restrict__ zero_pivot,
+                                  rocsparse_index_base idx_base,
+                                  int                  enable_boost,
+                                  V                    boost_tol_device_host,
+                                  W                    boost_val_device_host)
+{
+    auto boost_tol = (enable_boost) ? load_scalar_device_host(boost_tol_device_host)
+                                    : zero_scalar_device_host(boost_tol_device_host);
+
+    auto boost_val = (enable_boost) ? load_scalar_device_host(boost_val_device_host)
+                                    : zero_scalar_device_host(boost_val_device_host);
+
+    csrilut_factorize_device<BLOCKSIZE, WFSIZE, HASH>(m,
+                                                      csr_row_ptr,
+                                                      csr_col_ind,
+                                                      csr_val,
+                                                      tol,
+                                                      max_fill,
+                                                      l_nnz,
+                                                      l_col,
+                                                      l_val,
+                                                      u_nnz,
+                                                      u_col,
+                                                      u_val,
+                                                      done,
+                                                      work_mark,
+                                                      work_list,
+                                                      work_rank,
+                                                      work_val,
+                                                      zero_pivot,
+                                                      idx_base,
+                                                      enable_boost,
+                                                      boost_tol,
+                                                      boost_val);
+}
+
+template <unsigned int BLOCKSIZE, bool ICHOL>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrilut_nnz_kernel(rocsparse_int m,
+                            const rocsparse_int* __restrict__ l_nnz,
+                            const rocsparse_int* __restrict__ u_nnz,
+                            rocsparse_int* __restrict__ csr_row_ptr_lu,
+                            rocsparse_index_base idx_base)
+{
+    csrilut_nnz_device<BLOCKSIZE, ICHOL>(m, l_nnz, u_nnz, csr_row_ptr_lu, idx_base);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, bool ICHOL, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csrilut_copy_kernel(rocsparse_int m,
+                             rocsparse_int max_fill,
+                             const rocsparse_int* __restrict__ l_nnz,
+                             const rocsparse_int* __restrict__ l_col,
+                             const T* __restrict__ l_val,
+                             const rocsparse_int* __restrict__ u_nnz,
+                             const rocsparse_int* __restrict__ u_col,
+                             const T* __restrict__ u_val,
+                             const rocsparse_int* __restrict__ csr_row_ptr_lu,
+                             rocsparse_int* __restrict__ csr_col_ind_lu,
+                             T* __restrict__ csr_val_lu,
+                             rocsparse_index_base idx_base)
+{
+    csrilut_copy_device<BLOCKSIZE, WFSIZE, ICHOL>(m,
+                                                  max_fill,
+                                                  l_nnz,
+                                                  l_col,
+                                                  l_val,
+                                                  u_nnz,
+                                                  u_col,
+                                                  u_val,
+                                                  csr_row_ptr_lu,
+                                                  csr_col_ind_lu,
+                                                  csr_val_lu,
+                                                  idx_base);
+}
+
+// Maximum number of entries of the factorization, row i holds at most min(max_fill, i)
+// entries in the strictly lower part, min(max_fill, m - 1 - i) entries in the strictly
+// upper part and the diagonal.
+template <bool ICHOL>
+static rocsparse_status rocsparse_csrilut_nnz_template(rocsparse_handle handle,
+                                                       rocsparse_int    m,
+                                                       rocsparse_int    max_fill,
+                                                       rocsparse_int*   nnz_lu)
+{
+    // Check for valid handle
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              ICHOL ? "rocsparse_csrict_nnz" : "rocsparse_csrilut_nnz",
+              m,
+              max_fill,
+              (const void*&)nnz_lu);
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(max_fill < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(nnz_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Sum of min(max_fill, i) over all rows
+    int64_t p     = std::min(max_fill, std::max(m - 1, 0));
+    int64_t lower = p * (p + 1) / 2 + p * (m - 1 - p);
+
+    int64_t bound = (ICHOL ? lower : 2 * lower) + m;
+
+    // The fill budget exceeds the index range
+    if(bound > std::numeric_limits<rocsparse_int>::max())
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    rocsparse_int nnz = static_cast<rocsparse_int>(bound);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        hipStream_t stream = handle->stream;
+
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(nnz_lu, &nnz, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+        // Wait for device transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+    else
+    {
+        *nnz_lu = nnz;
+    }
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_csrilut_buffer_size_template(rocsparse_handle          handle,
+                                                        rocsparse_int             m,
+                                                        rocsparse_int             nnz,
+                                                        const rocsparse_mat_descr descr,
+                                                        const T*                  csr_val,
+                                                        const rocsparse_int*      csr_row_ptr,
+                                                        const rocsparse_int*      csr_col_ind,
+                                                        rocsparse_int             max_fill,
+                                                        size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsrilut_buffer_size"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              max_fill,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(max_fill < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Fill per row in each triangular part
+    size_t p = std::min(max_fill, m - 1);
+
+    // done array
+    *buffer_size = ((sizeof(int) * m - 1) / 256 + 1) * 256;
+
+    // Working row in global memory
+    *buffer_size += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256 * 3;
+    *buffer_size += ((sizeof(T) * m - 1) / 256 + 1) * 256;
+
+    // Number of entries in each row of L and U
+    *buffer_size += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256 * 2;
+
+    // L and U, stored with fixed stride per row
+    *buffer_size += ((sizeof(rocsparse_int) * m * (2 * p + 1) - 1) / 256 + 1) * 256;
+    *buffer_size += ((sizeof(T) * m * (2 * p + 1) - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    size_t         rocprim_size;
+    rocsparse_int* ptr = nullptr;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(
+        nullptr, rocprim_size, ptr, ptr, m + 1, rocprim::plus<rocsparse_int>(), handle->stream));
+
+    *buffer_size += rocprim_size;
+
+    return rocsparse_status_success;
+}
+
+template <unsigned int WFSIZE, typename T, typename U, typename V, typename W>
+static rocsparse_status rocsparse_csrilut_factorize(rocsparse_handle          handle,
+                                                    rocsparse_int             m,
+                                                    const rocsparse_mat_descr descr,
+                                                    const T*                  csr_val,
+                                                    const rocsparse_int*      csr_row_ptr,
+                                                    const rocsparse_int*      csr_col_ind,
+                                                    rocsparse_mat_info        info,
+                                                    U                         tol,
+                                                    rocsparse_int             max_fill,
+                                                    rocsparse_int*            l_nnz,
+                                                    rocsparse_int*            l_col,
+                                                    T*                        l_val,
+                                                    rocsparse_int*            u_nnz,
+                                                    rocsparse_int*            u_col,
+                                                    T*                        u_val,
+                                                    int*                      done,
+                                                    rocsparse_int*            work_mark,
+                                                    rocsparse_int*            work_list,
+                                                    rocsparse_int*            work_rank,
+                                                    T*                        work_val,
+                                                    V                         boost_tol_device_host,
+                                                    W                         boost_val_device_host)
+{
+#define CSRILUT_DIM 256
+    dim3 csrilut_blocks((WFSIZE * m - 1) / CSRILUT_DIM + 1);
+    dim3 csrilut_threads(CSRILUT_DIM);
+
+    // The working row of each wavefront holds up to WFSIZE * HASH / 2 entries. Larger
+    // matrices use the largest hash table, rows whose fill does not fit fall back to the
+    // working row in global memory.
+    if(m <= WFSIZE)
+    {
+        hipLaunchKernelGGL((csrilut_factorize_kernel<CSRILUT_DIM, WFSIZE, 2>),
+                           csrilut_blocks,
+                           csrilut_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           tol,
+                           max_fill,
+                           l_nnz,
+                           l_col,
+                           l_val,
+                           u_nnz,
+                           u_col,
+                           u_val,
+                           done,
+                           work_mark,
+                           work_list,
+                           work_rank,
+                           work_val,
+                           info->zero_pivot,
+                           descr->base,
+                           info->boost_enable,
+                           boost_tol_device_host,
+                           boost_val_device_host);
+    }
+    else if(m <= 2 * WFSIZE)
+    {
+        hipLaunchKernelGGL((csrilut_factorize_kernel<CSRILUT_DIM, WFSIZE, 4>),
+                           csrilut_blocks,
+                           csrilut_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           tol,
+                           max_fill,
+                           l_nnz,
+                           l_col,
+                           l_val,
+                           u_nnz,
+                           u_col,
+                           u_val,
+                           done,
+                           work_mark,
+                           work_list,
+                           work_rank,
+                           work_val,
+                           info->zero_pivot,
+                           descr->base,
+                           info->boost_enable,
+                           boost_tol_device_host,
+                           boost_val_device_host);
+    }
+    else
+    {
+        hipLaunchKernelGGL((csrilut_factorize_kernel<CSRILUT_DIM, WFSIZE, 8>),
+                           csrilut_blocks,
+                           csrilut_threads,
+                           0,
+                           handle->stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           csr_val,
+                           tol,
+                           max_fill,
+                           l_nnz,
+                           l_col,
+                           l_val,
+                           u_nnz,
+                           u_col,
+                           u_val,
+                           done,
+                           work_mark,
+                           work_list,
+                           work_rank,
+                           work_val,
+                           info->zero_pivot,
+                           descr->base,
+                           info->boost_enable,
+                           boost_tol_device_host,
+                           boost_val_device_host);
+    }
+#undef CSRILUT_DIM
+
+    return rocsparse_status_success;
+}
+
+template <bool ICHOL, typename T, typename U, typename V, typename W>
+static rocsparse_status rocsparse_csrilut_dispatch(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   const rocsparse_mat_descr descr,
+                                                   const T*                  csr_val,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_mat_info        info,
+                                                   U                         tol,
+                                                   rocsparse_int             max_fill,
+                                                   rocsparse_int*            csr_row_ptr_lu,
+                                                   rocsparse_int*            csr_col_ind_lu,
+                                                   T*                        csr_val_lu,
+                                                   void*                     temp_buffer,
+                                                   V                         boost_tol_device_host,
+                                                   W                         boost_val_device_host)
+{
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Fill per row in each triangular part
+    rocsparse_int p = std::min(max_fill, m - 1);
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // done array
+    int* done = reinterpret_cast<int*>(ptr);
+    ptr += ((sizeof(int) * m - 1) / 256 + 1) * 256;
+
+    // Working row in global memory, for rows whose fill does not fit into shared memory
+    rocsparse_int* work_mark = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* work_list = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* work_rank = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    T* work_val = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * m - 1) / 256 + 1) * 256;
+
+    // Number of entries in each row of L and U
+    rocsparse_int* l_nnz = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* u_nnz = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += ((sizeof(rocsparse_int) * m - 1) / 256 + 1) * 256;
+
+    // Column indices of L and U
+    rocsparse_int* l_col = reinterpret_cast<rocsparse_int*>(ptr);
+    rocsparse_int* u_col = l_col + size_t(m) * p;
+    ptr += ((sizeof(rocsparse_int) * m * (2 * p + 1) - 1) / 256 + 1) * 256;
+
+    // Values of L and U
+    T* l_val = reinterpret_cast<T*>(ptr);
+    T* u_val = l_val + size_t(m) * p;
+    ptr += ((sizeof(T) * m * (2 * p + 1) - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+    // Initialize buffers
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(done, 0, sizeof(int) * m, stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(work_mark, -1, sizeof(rocsparse_int) * m, stream));
+
+    // Factorization
+    if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrilut_factorize<32>(handle,
+                                                                  m,
+                                                                  descr,
+                                                                  csr_val,
+                                                                  csr_row_ptr,
+                                                                  csr_col_ind,
+                                                                  info,
+                                                                  tol,
+                                                                  p,
+                                                                  l_nnz,
+                                                                  l_col,
+                                                                  l_val,
+                                                                  u_nnz,
+                                                                  u_col,
+                                                                  u_val,
+                                                                  done,
+                                                                  work_mark,
+                                                                  work_list,
+                                                                  work_rank,
+                                                                  work_val,
+                                                                  boost_tol_device_host,
+                                                                  boost_val_device_host));
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrilut_factorize<64>(handle,
+                                                                  m,
+                                                                  descr,
+                                                                  csr_val,
+                                                                  csr_row_ptr,
+                                                                  csr_col_ind,
+                                                                  info,
+                                                                  tol,
+                                                                  p,
+                                                                  l_nnz,
+                                                                  l_col,
+                                                                  l_val,
+                                                                  u_nnz,
+                                                                  u_col,
+                                                                  u_val,
+                                                                  done,
+                                                                  work_mark,
+                                                                  work_list,
+                                                                  work_rank,
+                                                                  work_val,
+                                                                  boost_tol_device_host,
+                                                                  boost_val_device_host));
+    }
+
+#define CSRILUT_DIM 256
+    // Row pointer of the factorization
+    hipLaunchKernelGGL((csrilut_nnz_kernel<CSRILUT_DIM, ICHOL>),
+                       dim3((m - 1) / CSRILUT_DIM + 1),
+                       dim3(CSRILUT_DIM),
+                       0,
+                       stream,
+                       m,
+                       l_nnz,
+                       u_nnz,
+                       csr_row_ptr_lu,
+                       descr->base);
+
+    size_t rocprim_size;
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(nullptr,
+                                                rocprim_size,
+                                                csr_row_ptr_lu,
+                                                csr_row_ptr_lu,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+    RETURN_IF_HIP_ERROR(rocprim::inclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                csr_row_ptr_lu,
+                                                csr_row_ptr_lu,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    // Copy L and U into the factorization
+    if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        hipLaunchKernelGGL((csrilut_copy_kernel<CSRILUT_DIM, 32, ICHOL>),
+                           dim3((32 * m - 1) / CSRILUT_DIM + 1),
+                           dim3(CSRILUT_DIM),
+                           0,
+                           stream,
+                           m,
+                           p,
+                           l_nnz,
+                           l_col,
+                           l_val,
+                           u_nnz,
+                           u_col,
+                           u_val,
+                           csr_row_ptr_lu,
+                           csr_col_ind_lu,
+                           csr_val_lu,
+                           descr->base);
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        hipLaunchKernelGGL((csrilut_copy_kernel<CSRILUT_DIM, 64, ICHOL>),
+                           dim3((64 * m - 1) / CSRILUT_DIM + 1),
+                           dim3(CSRILUT_DIM),
+                           0,
+                           stream,
+                           m,
+                           p,
+                           l_nnz,
+                           l_col,
+                           l_val,
+                           u_nnz,
+                           u_col,
+                           u_val,
+                           csr_row_ptr_lu,
+                           csr_col_ind_lu,
+                           csr_val_lu,
+                           descr->base);
+    }
+#undef CSRILUT_DIM
+
+    return rocsparse_status_success;
+}
+
+template <bool ICHOL, typename T, typename U>
+rocsparse_status rocsparse_csrilut_template(rocsparse_handle          handle,
+                                            rocsparse_int             m,
+                                            rocsparse_int             nnz,
+                                            const rocsparse_mat_descr descr,
+                                            const T*                  csr_val,
+                                            const rocsparse_int*      csr_row_ptr,
+                                            const rocsparse_int*      csr_col_ind,
+                                            rocsparse_mat_info        info,
+                                            U                         tol,
+                                            rocsparse_int             max_fill,
+                                            rocsparse_int*            csr_row_ptr_lu,
+                                            rocsparse_int*            csr_col_ind_lu,
+                                            T*                        csr_val_lu,
+                                            void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>(ICHOL ? "rocsparse_Xcsrict" : "rocsparse_Xcsrilut"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              tol,
+              max_fill,
+              (const void*&)csr_row_ptr_lu,
+              (const void*&)csr_col_ind_lu,
+              (const void*&)csr_val_lu,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrilut -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(max_fill < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check drop tolerance
+    if(tol < static_cast<U>(0))
+    {
+        return rocsparse_status_invalid_value;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_val_lu == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    rocsparse_trm_info trm_info = ICHOL ? info->csric0_info : info->csrilu0_info;
+
+    if(trm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_device)
+    {
+        return rocsparse_csrilut_dispatch<ICHOL>(handle,
+                                                 m,
+                                                 descr,
+                                                 csr_val,
+                                                 csr_row_ptr,
+                                                 csr_col_ind,
+                                                 info,
+                                                 tol,
+                                                 max_fill,
+                                                 csr_row_ptr_lu,
+                                                 csr_col_ind_lu,
+                                                 csr_val_lu,
+                                                 temp_buffer,
+                                                 reinterpret_cast<const U*>(info->boost_tol),
+                                                 reinterpret_cast<const T*>(info->boost_val));
+    }
+    else
+    {
+        return rocsparse_csrilut_dispatch<ICHOL>(
+            handle,
+            m,
+            descr,
+            csr_val,
+            csr_row_ptr,
+            csr_col_ind,
+            info,
+            tol,
+            max_fill,
+            csr_row_ptr_lu,
+            csr_col_ind_lu,
+            csr_val_lu,
+            temp_buffer,
+            (info->boost_enable != 0) ? *reinterpret_cast<const U*>(info->boost_tol)
+                                      : static_cast<U>(0),
+            (info->boost_enable != 0) ? *reinterpret_cast<const T*>(info->boost_val)
+                                      : static_cast<T>(0));
+    }
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocsparse_status rocsparse_csrilut_nnz(rocsparse_handle handle,
+                                                  rocsparse_int    m,
+                                                  rocsparse_int    max_fill,
+                                                  rocsparse_int*   nnz_lu)
+{
+    return rocsparse_csrilut_nnz_template<false>(handle, m, max_fill, nnz_lu);
+}
+
+extern "C" rocsparse_status rocsparse_csrict_nnz(rocsparse_handle handle,
+                                                 rocsparse_int    m,
+                                                 rocsparse_int    max_fill,
+                                                 rocsparse_int*   nnz_l)
+{
+    return rocsparse_csrilut_nnz_template<true>(handle, m, max_fill, nnz_l);
+}
+
+#define C_IMPL(NAME, TYPE)                                                                    \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,                        \
+                                     rocsparse_int             m,                             \
+                                     rocsparse_int             nnz,                           \
+                                     const rocsparse_mat_descr descr,                         \
+                                     const TYPE*               csr_val,                       \
+                                     const rocsparse_int*      csr_row_ptr,                   \
+                                     const rocsparse_int*      csr_col_ind,                   \
+                                     rocsparse_int             max_fill,                      \
+                                     size_t*                   buffer_size)                   \
+    {                                                                                         \
+        return rocsparse_csrilut_buffer_size_template(                                        \
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, max_fill, buffer_size); \
+    }
+
+C_IMPL(rocsparse_scsrilut_buffer_size, float);
+C_IMPL(rocsparse_dcsrilut_buffer_size, double);
+C_IMPL(rocsparse_ccsrilut_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsrilut_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, ICHOL, TYPE, REAL_TYPE)                                          \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,                \
+                                     rocsparse_int             m,                     \
+                                     rocsparse_int             nnz,                   \
+                                     const rocsparse_mat_descr descr,                 \
+                                     const TYPE*               csr_val,               \
+                                     const rocsparse_int*      csr_row_ptr,           \
+                                     const rocsparse_int*      csr_col_ind,           \
+                                     rocsparse_mat_info        info,                  \
+                                     REAL_TYPE                 tol,                   \
+                                     rocsparse_int             max_fill,              \
+                                     rocsparse_int*            csr_row_ptr_lu,        \
+                                     rocsparse_int*            csr_col_ind_lu,        \
+                                     TYPE*                     csr_val_lu,            \
+                                     void*                     temp_buffer)           \
+    {                                                                                 \
+        if(info != nullptr && info->use_double_prec_tol)                              \
+        {                                                                             \
+            return rocsparse_csrilut_template<ICHOL, TYPE, double>(handle,            \
+                                                                   m,                 \
+                                                                   nnz,               \
+                                                                   descr,             \
+                                                                   csr_val,           \
+                                                                   csr_row_ptr,       \
+                                                                   csr_col_ind,       \
+                                                                   info,              \
+                                                                   tol,               \
+                                                                   max_fill,          \
+                                                                   csr_row_ptr_lu,    \
+                                                                   csr_col_ind_lu,    \
+                                                                   csr_val_lu,        \
+                                                                   temp_buffer);      \
+        }                                                                             \
+        else                                                                          \
+        {                                                                             \
+            return rocsparse_csrilut_template<ICHOL, TYPE, REAL_TYPE>(handle,         \
+                                                                      m,              \
+                                                                      nnz,            \
+                                                                      descr,          \
+                                                                      csr_val,        \
+                                                                      csr_row_ptr,    \
+                                                                      csr_col_ind,    \
+                                                                      info,           \
+                                                                      tol,            \
+                                                                      max_fill,       \
+                                                                      csr_row_ptr_lu, \
+                                                                      csr_col_ind_lu, \
+                                                                      csr_val_lu,     \
+                                                                      temp_buffer);   \
+        }                                                                             \
+    }
+
+C_IMPL(rocsparse_scsrilut, false, float, float);
+C_IMPL(rocsparse_dcsrilut, false, double, double);
+C_IMPL(rocsparse_ccsrilut, false, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrilut, false, rocsparse_double_complex, double);
+C_IMPL(rocsparse_scsrict, true, float, float);
+C_IMPL(rocsparse_dcsrict, true, double, double);
+C_IMPL(rocsparse_ccsrict, true, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsrict, true, rocsparse_double_complex, double);
+
+#undef C_IMPL
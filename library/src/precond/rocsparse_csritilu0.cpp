@@ -0,0 +1,439 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "definitions.h"
+#include "utility.h"
+
+#include "csritilu0_device.h"
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, bool ICHOL, typename T>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csritilu0_init_kernel(rocsparse_int m,
+                               const rocsparse_int* __restrict__ csr_row_ptr,
+                               const rocsparse_int* __restrict__ csr_col_ind,
+                               const T* __restrict__ a_val,
+                               T* __restrict__ csr_val,
+                               const rocsparse_int* __restrict__ csr_diag_ind,
+                               rocsparse_index_base idx_base)
+{
+    csritilu0_init_device<BLOCKSIZE, WFSIZE, ICHOL>(
+        m, csr_row_ptr, csr_col_ind, a_val, csr_val, csr_diag_ind, idx_base);
+}
+
+template <unsigned int BLOCKSIZE, unsigned int WFSIZE, bool ICHOL, typename T, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csritilu0_sweep_kernel(rocsparse_int m,
+                                const rocsparse_int* __restrict__ csr_row_ptr,
+                                const rocsparse_int* __restrict__ csr_col_ind,
+                                const T* __restrict__ a_val,
+                                const T* __restrict__ lu_prev,
+                                T* __restrict__ csr_val,
+                                const rocsparse_int* __restrict__ csr_diag_ind,
+                                U* __restrict__ residual,
+                                rocsparse_int* __restrict__ zero_pivot,
+                                rocsparse_index_base idx_base)
+{
+    csritilu0_sweep_device<BLOCKSIZE, WFSIZE, ICHOL>(m,
+                                                     csr_row_ptr,
+                                                     csr_col_ind,
+                                                     a_val,
+                                                     lu_prev,
+                                                     csr_val,
+                                                     csr_diag_ind,
+                                                     residual,
+                                                     zero_pivot,
+                                                     idx_base);
+}
+
+template <unsigned int BLOCKSIZE, typename U>
+__launch_bounds__(BLOCKSIZE) __global__
+    void csritilu0_norm_kernel(rocsparse_int nsweeps, U* __restrict__ history)
+{
+    csritilu0_norm_device<BLOCKSIZE>(nsweeps, history);
+}
+
+template <typename T>
+rocsparse_status rocsparse_csritilu0_buffer_size_template(rocsparse_handle          handle,
+                                                          rocsparse_int             m,
+                                                          rocsparse_int             nnz,
+                                                          const rocsparse_mat_descr descr,
+                                                          const T*                  csr_val,
+                                                          const rocsparse_int*      csr_row_ptr,
+                                                          const rocsparse_int*      csr_col_ind,
+                                                          size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xcsritilu0_buffer_size"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check buffer size argument
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Copy of the entries of A and the previous iterate of the factors
+    *buffer_size = ((sizeof(T) * nnz - 1) / 256 + 1) * 256 * 2;
+
+    return rocsparse_status_success;
+}
+
+template <bool ICHOL, typename T, typename U>
+rocsparse_status rocsparse_csritilu0_template(rocsparse_handle          handle,
+                                              rocsparse_int             m,
+                                              rocsparse_int             nnz,
+                                              const rocsparse_mat_descr descr,
+                                              T*                        csr_val,
+                                              const rocsparse_int*      csr_row_ptr,
+                                              const rocsparse_int*      csr_col_ind,
+                                              rocsparse_mat_info        info,
+                                              rocsparse_int             nsweeps,
+                                              U*                        history,
+                                              void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>(ICHOL ? "rocsparse_Xcsritic0" : "rocsparse_Xcsritilu0"),
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_val,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)info,
+              nsweeps,
+              (const void*&)history,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csritilu0 -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check index base
+    if(descr->base != rocsparse_index_base_zero && descr->base != rocsparse_index_base_one)
+    {
+        return rocsparse_status_invalid_value;
+    }
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nsweeps < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0 || nnz == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_val == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Check for analysis call
+    rocsparse_trm_info trm_info = ICHOL ? info->csric0_info : info->csrilu0_info;
+
+    if(trm_info == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Entries of A
+    T* a_val = reinterpret_cast<T*>(ptr);
+    ptr += ((sizeof(T) * nnz - 1) / 256 + 1) * 256;
+
+    // Previous iterate
+    T* lu_prev = reinterpret_cast<T*>(ptr);
+
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(a_val, csr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+
+    if(history != nullptr && nsweeps > 0)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(history, 0, sizeof(U) * nsweeps, stream));
+    }
+
+#define CSRITILU0_DIM 256
+    dim3 csritilu0_blocks((handle->wavefront_size * m - 1) / CSRITILU0_DIM + 1);
+    dim3 csritilu0_threads(CSRITILU0_DIM);
+
+    if(handle->wavefront_size == 32)
+    {
+        // LCOV_EXCL_START
+        hipLaunchKernelGGL((csritilu0_init_kernel<CSRITILU0_DIM, 32, ICHOL>),
+                           csritilu0_blocks,
+                           csritilu0_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           a_val,
+                           csr_val,
+                           trm_info->trm_diag_ind,
+                           descr->base);
+
+        for(rocsparse_int sweep = 0; sweep < nsweeps; ++sweep)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                lu_prev, csr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+
+            hipLaunchKernelGGL((csritilu0_sweep_kernel<CSRITILU0_DIM, 32, ICHOL>),
+                               csritilu0_blocks,
+                               csritilu0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               a_val,
+                               lu_prev,
+                               csr_val,
+                               trm_info->trm_diag_ind,
+                               (history != nullptr) ? history + sweep : nullptr,
+                               info->zero_pivot,
+                               descr->base);
+        }
+        // LCOV_EXCL_STOP
+    }
+    else
+    {
+        assert(handle->wavefront_size == 64);
+        hipLaunchKernelGGL((csritilu0_init_kernel<CSRITILU0_DIM, 64, ICHOL>),
+                           csritilu0_blocks,
+                           csritilu0_threads,
+                           0,
+                           stream,
+                           m,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           a_val,
+                           csr_val,
+                           trm_info->trm_diag_ind,
+                           descr->base);
+
+        for(rocsparse_int sweep = 0; sweep < nsweeps; ++sweep)
+        {
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+                lu_prev, csr_val, sizeof(T) * nnz, hipMemcpyDeviceToDevice, stream));
+
+            hipLaunchKernelGGL((csritilu0_sweep_kernel<CSRITILU0_DIM, 64, ICHOL>),
+                               csritilu0_blocks,
+                               csritilu0_threads,
+                               0,
+                               stream,
+                               m,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               a_val,
+                               lu_prev,
+                               csr_val,
+                               trm_info->trm_diag_ind,
+                               (history != nullptr) ? history + sweep : nullptr,
+                               info->zero_pivot,
+                               descr->base);
+        }
+    }
+
+    // Convergence history
+    if(history != nullptr && nsweeps > 0)
+    {
+        hipLaunchKernelGGL((csritilu0_norm_kernel<CSRITILU0_DIM>),
+                           dim3((nsweeps - 1) / CSRITILU0_DIM + 1),
+                           csritilu0_threads,
+                           0,
+                           stream,
+                           nsweeps,
+                           history);
+    }
+#undef CSRITILU0_DIM
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+#define C_IMPL(NAME, TYPE)                                                          \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,              \
+                                     rocsparse_int             m,                   \
+                                     rocsparse_int             nnz,                 \
+                                     const rocsparse_mat_descr descr,               \
+                                     const TYPE*               csr_val,             \
+                                     const rocsparse_int*      csr_row_ptr,         \
+                                     const rocsparse_int*      csr_col_ind,         \
+                                     size_t*                   buffer_size)         \
+    {                                                                               \
+        return rocsparse_csritilu0_buffer_size_template(                            \
+            handle, m, nnz, descr, csr_val, csr_row_ptr, csr_col_ind, buffer_size); \
+    }
+
+C_IMPL(rocsparse_scsritilu0_buffer_size, float);
+C_IMPL(rocsparse_dcsritilu0_buffer_size, double);
+C_IMPL(rocsparse_ccsritilu0_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zcsritilu0_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, ICHOL, TYPE, REAL_TYPE)                                \
+    extern "C" rocsparse_status NAME(rocsparse_handle          handle,      \
+                                     rocsparse_int             m,           \
+                                     rocsparse_int             nnz,         \
+                                     const rocsparse_mat_descr descr,       \
+                                     TYPE*                     csr_val,     \
+                                     const rocsparse_int*      csr_row_ptr, \
+                                     const rocsparse_int*      csr_col_ind, \
+                                     rocsparse_mat_info        info,        \
+                                     rocsparse_int             nsweeps,     \
+                                     REAL_TYPE*                history,     \
+                                     void*                     temp_buffer) \
+    {                                                                       \
+        return rocsparse_csritilu0_template<ICHOL>(handle,                  \
+                                                   m,                       \
+                                                   nnz,                     \
+                                                   descr,                   \
+                                                   csr_val,                 \
+                                                   csr_row_ptr,             \
+                                                   csr_col_ind,             \
+                                                   info,                    \
+                                                   nsweeps,                 \
+                                                   history,                 \
+                                                   temp_buffer);            \
+    }
+
+C_IMPL(rocsparse_scsritilu0, false, float, float);
+C_IMPL(rocsparse_dcsritilu0, false, double, double);
+C_IMPL(rocsparse_ccsritilu0, false, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsritilu0, false, rocsparse_double_complex, double);
+C_IMPL(rocsparse_scsritic0, true, float, float);
+C_IMPL(rocsparse_dcsritic0, true, double, double);
+C_IMPL(rocsparse_ccsritic0, true, rocsparse_float_complex, float);
+C_IMPL(rocsparse_zcsritic0, true, rocsparse_double_complex, double);
+
+#undef C_IMPL
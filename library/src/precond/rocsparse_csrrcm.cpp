@@ -0,0 +1,784 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "definitions.h"
+#include "utility.h"
+
+#include "csrrcm_device.h"
+
+#include <rocprim/rocprim.hpp>
+
+#define CSRRCM_DIM 256
+
+// Returns the row with minimum degree (ties broken by the smaller index) among the
+// first n rows of list (or all rows, if list is nullptr), skipping rows that have
+// already been ordered, or -1 if no such row exists
+static rocsparse_status rocsparse_csrrcm_min_degree(hipStream_t          stream,
+                                                    rocsparse_int        n,
+                                                    const rocsparse_int* list,
+                                                    const rocsparse_int* degree,
+                                                    const rocsparse_int* order,
+                                                    int64_t*             d_min,
+                                                    rocsparse_int*       row)
+{
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_min, 0xFF, sizeof(int64_t), stream));
+
+    hipLaunchKernelGGL((csrrcm_min_degree_kernel<CSRRCM_DIM>),
+                       dim3((n - 1) / CSRRCM_DIM + 1),
+                       dim3(CSRRCM_DIM),
+                       0,
+                       stream,
+                       n,
+                       list,
+                       degree,
+                       order,
+                       d_min);
+
+    int64_t key;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&key, d_min, sizeof(int64_t), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    *row = (key < 0) ? -1 : static_cast<rocsparse_int>(key & 0xFFFFFFFF);
+
+    return rocsparse_status_success;
+}
+
+// Level-synchronous breadth first search starting at root, restricted to unordered
+// rows. On return, list contains all visited rows ordered by level and
+// [level_begin, level_end) is the last level. The distances of all visited rows must
+// be reset by the caller.
+static rocsparse_status rocsparse_csrrcm_bfs(hipStream_t          stream,
+                                             rocsparse_int        root,
+                                             const rocsparse_int* csr_row_ptr,
+                                             const rocsparse_int* csr_col_ind,
+                                             rocsparse_index_base idx_base,
+                                             const rocsparse_int* order,
+                                             rocsparse_int*       dist,
+                                             rocsparse_int*       list,
+                                             rocsparse_int*       d_count,
+                                             rocsparse_int*       eccentricity,
+                                             rocsparse_int*       level_begin,
+                                             rocsparse_int*       level_end)
+{
+    rocsparse_int zero = 0;
+
+    RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+        dist + root, &zero, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(list, &root, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+    rocsparse_int begin = 0;
+    rocsparse_int end   = 1;
+    rocsparse_int level = 0;
+
+    while(true)
+    {
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(d_count, 0, sizeof(rocsparse_int), stream));
+
+        hipLaunchKernelGGL((csrrcm_bfs_kernel<CSRRCM_DIM>),
+                           dim3((end - begin - 1) / CSRRCM_DIM + 1),
+                           dim3(CSRRCM_DIM),
+                           0,
+                           stream,
+                           begin,
+                           end,
+                           level,
+                           csr_row_ptr,
+                           csr_col_ind,
+                           order,
+                           dist,
+                           list,
+                           d_count,
+                           idx_base);
+
+        rocsparse_int count;
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(&count, d_count, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+        if(count == 0)
+        {
+            break;
+        }
+
+        begin = end;
+        end += count;
+        ++level;
+    }
+
+    *eccentricity = level;
+    *level_begin  = begin;
+    *level_end    = end;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrrcm_buffer_size(rocsparse_handle          handle,
+                                                         rocsparse_int             m,
+                                                         rocsparse_int             nnz,
+                                                         const rocsparse_mat_descr descr,
+                                                         const rocsparse_int*      csr_row_ptr,
+                                                         const rocsparse_int*      csr_col_ind,
+                                                         size_t*                   buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrcm_buffer_size",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)buffer_size);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Level size and minimum degree
+    *buffer_size = 256;
+
+    // degree, order, parent, distance and level list arrays
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256 * 5;
+
+    // children count and offset arrays
+    *buffer_size += sizeof(rocsparse_int) * (m / 256 + 1) * 256 * 2;
+
+    // sort keys and values
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256 * 3;
+
+    // rocprim buffer
+    size_t         rocprim_size;
+    size_t         rocprim_max = 0;
+    rocsparse_int* ptr         = reinterpret_cast<rocsparse_int*>(buffer_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(
+        nullptr, rocprim_size, ptr, ptr, 0, m + 1, rocprim::plus<rocsparse_int>(), stream));
+    rocprim_max = std::max(rocprim_max, rocprim_size);
+
+    RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(
+        nullptr, rocprim_size, ptr, ptr, ptr, ptr, m, m, ptr, ptr + 1, 0, 32, stream));
+    rocprim_max = std::max(rocprim_max, rocprim_size);
+
+    *buffer_size += ((rocprim_max - 1) / 256 + 1) * 256;
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrrcm(rocsparse_handle          handle,
+                                             rocsparse_int             m,
+                                             rocsparse_int             nnz,
+                                             const rocsparse_mat_descr descr,
+                                             const rocsparse_int*      csr_row_ptr,
+                                             const rocsparse_int*      csr_col_ind,
+                                             rocsparse_int*            perm,
+                                             void*                     temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrrcm",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)perm,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f csrrcm", "--mtx <matrix.mtx>");
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(perm == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Buffer
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+
+    // Level size
+    rocsparse_int* d_count = reinterpret_cast<rocsparse_int*>(ptr);
+
+    // Minimum degree
+    int64_t* d_min = reinterpret_cast<int64_t*>(ptr + sizeof(int64_t));
+    ptr += 256;
+
+    // Degree of each row
+    rocsparse_int* degree = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Position of each row in the Cuthill-McKee ordering
+    rocsparse_int* order = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Position of the row that appends each row to the ordering
+    rocsparse_int* parent = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Breadth first search distances and level list
+    rocsparse_int* dist = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* list = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // Children count and offset
+    rocsparse_int* count = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+    rocsparse_int* offset = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * (m / 256 + 1) * 256;
+
+    // sort keys
+    rocsparse_int* keys1 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    rocsparse_int* keys2 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // sort values
+    rocsparse_int* vals1 = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+
+    // rocprim buffer
+    void* rocprim_buffer = reinterpret_cast<void*>(ptr);
+
+    size_t rocprim_size;
+
+    hipLaunchKernelGGL((csrrcm_init_kernel<CSRRCM_DIM>),
+                       dim3((m - 1) / CSRRCM_DIM + 1),
+                       dim3(CSRRCM_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       degree,
+                       order,
+                       parent,
+                       dist,
+                       descr->base);
+
+    // Rows without off-diagonal entries form components of their own and have minimum
+    // degree, thus they are placed first, in increasing row index
+    hipLaunchKernelGGL((csrrcm_isolated_flag_kernel<CSRRCM_DIM>),
+                       dim3(m / CSRRCM_DIM + 1),
+                       dim3(CSRRCM_DIM),
+                       0,
+                       stream,
+                       m,
+                       degree,
+                       count);
+
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(
+        nullptr, rocprim_size, count, offset, 0, m + 1, rocprim::plus<rocsparse_int>(), stream));
+    RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                rocprim_size,
+                                                count,
+                                                offset,
+                                                0,
+                                                m + 1,
+                                                rocprim::plus<rocsparse_int>(),
+                                                stream));
+
+    hipLaunchKernelGGL((csrrcm_isolated_place_kernel<CSRRCM_DIM>),
+                       dim3((m - 1) / CSRRCM_DIM + 1),
+                       dim3(CSRRCM_DIM),
+                       0,
+                       stream,
+                       m,
+                       degree,
+                       offset,
+                       perm,
+                       order);
+
+    rocsparse_int placed;
+    RETURN_IF_HIP_ERROR(
+        hipMemcpyAsync(&placed, offset + m, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+
+    // Wait for host transfer to finish
+    RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+    // Sort keys are bounded by the maximum degree
+    unsigned int startbit = 0;
+    unsigned int endbit   = rocsparse_clz(m);
+
+    // Order each connected component
+    while(placed < m)
+    {
+        // Start with an unordered row of minimum degree
+        rocsparse_int root;
+        RETURN_IF_ROCSPARSE_ERROR(
+            rocsparse_csrrcm_min_degree(stream, m, nullptr, degree, order, d_min, &root));
+
+        // George-Liu pseudo-peripheral node search. Restart the search from the row of
+        // minimum degree within the last level, as long as the eccentricity increases.
+        rocsparse_int ecc;
+        rocsparse_int level_begin;
+        rocsparse_int level_end;
+
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_bfs(stream,
+                                                       root,
+                                                       csr_row_ptr,
+                                                       csr_col_ind,
+                                                       descr->base,
+                                                       order,
+                                                       dist,
+                                                       list,
+                                                       d_count,
+                                                       &ecc,
+                                                       &level_begin,
+                                                       &level_end));
+
+        while(true)
+        {
+            rocsparse_int candidate;
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_min_degree(stream,
+                                                                  level_end - level_begin,
+                                                                  list + level_begin,
+                                                                  degree,
+                                                                  nullptr,
+                                                                  d_min,
+                                                                  &candidate));
+
+            hipLaunchKernelGGL((csrrcm_bfs_reset_kernel<CSRRCM_DIM>),
+                               dim3((level_end - 1) / CSRRCM_DIM + 1),
+                               dim3(CSRRCM_DIM),
+                               0,
+                               stream,
+                               level_end,
+                               list,
+                               dist);
+
+            rocsparse_int candidate_ecc;
+            rocsparse_int candidate_begin;
+            rocsparse_int candidate_end;
+
+            RETURN_IF_ROCSPARSE_ERROR(rocsparse_csrrcm_bfs(stream,
+                                                           candidate,
+                                                           csr_row_ptr,
+                                                           csr_col_ind,
+                                                           descr->base,
+                                                           order,
+                                                           dist,
+                                                           list,
+                                                           d_count,
+                                                           &candidate_ecc,
+                                                           &candidate_begin,
+                                                           &candidate_end));
+
+            if(candidate_ecc <= ecc)
+            {
+                hipLaunchKernelGGL((csrrcm_bfs_reset_kernel<CSRRCM_DIM>),
+                                   dim3((candidate_end - 1) / CSRRCM_DIM + 1),
+                                   dim3(CSRRCM_DIM),
+                                   0,
+                                   stream,
+                                   candidate_end,
+                                   list,
+                                   dist);
+                break;
+            }
+
+            root        = candidate;
+            ecc         = candidate_ecc;
+            level_begin = candidate_begin;
+            level_end   = candidate_end;
+        }
+
+        // Cuthill-McKee ordering of the component, starting at the pseudo-peripheral row
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            perm + placed, &root, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            order + root, &placed, sizeof(rocsparse_int), hipMemcpyHostToDevice, stream));
+
+        rocsparse_int begin = placed;
+        rocsparse_int end   = placed + 1;
+
+        while(begin < end)
+        {
+            rocsparse_int nlevel = end - begin;
+
+            // Each unordered row is appended by its neighbour that comes first within the
+            // current level
+            hipLaunchKernelGGL((csrrcm_claim_kernel<CSRRCM_DIM>),
+                               dim3((nlevel - 1) / CSRRCM_DIM + 1),
+                               dim3(CSRRCM_DIM),
+                               0,
+                               stream,
+                               begin,
+                               end,
+                               perm,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               order,
+                               parent,
+                               descr->base);
+
+            hipLaunchKernelGGL((csrrcm_count_kernel<CSRRCM_DIM>),
+                               dim3(nlevel / CSRRCM_DIM + 1),
+                               dim3(CSRRCM_DIM),
+                               0,
+                               stream,
+                               begin,
+                               end,
+                               perm,
+                               csr_row_ptr,
+                               csr_col_ind,
+                               order,
+                               parent,
+                               count,
+                               descr->base);
+
+            RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(nullptr,
+                                                        rocprim_size,
+                                                        count,
+                                                        offset,
+                                                        0,
+                                                        nlevel + 1,
+                                                        rocprim::plus<rocsparse_int>(),
+                                                        stream));
+            RETURN_IF_HIP_ERROR(rocprim::exclusive_scan(rocprim_buffer,
+                                                        rocprim_size,
+                                                        count,
+                                                        offset,
+                                                        0,
+                                                        nlevel + 1,
+                                                        rocprim::plus<rocsparse_int>(),
+                                                        stream));
+
+            rocsparse_int nchildren;
+            RETURN_IF_HIP_ERROR(hipMemcpyAsync(&nchildren,
+                                               offset + nlevel,
+                                               sizeof(rocsparse_int),
+                                               hipMemcpyDeviceToHost,
+                                               stream));
+
+            // Wait for host transfer to finish
+            RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+
+            if(nchildren > 0)
+            {
+                hipLaunchKernelGGL((csrrcm_fill_kernel<CSRRCM_DIM>),
+                                   dim3((nlevel - 1) / CSRRCM_DIM + 1),
+                                   dim3(CSRRCM_DIM),
+                                   0,
+                                   stream,
+                                   begin,
+                                   end,
+                                   perm,
+                                   csr_row_ptr,
+                                   csr_col_ind,
+                                   degree,
+                                   order,
+                                   parent,
+                                   offset,
+                                   keys1,
+                                   vals1,
+                                   descr->base);
+
+                // The children of each row are appended in increasing degree. Radix sort
+                // is stable, thus ties are broken by the smaller row index.
+                RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(nullptr,
+                                                                        rocprim_size,
+                                                                        keys1,
+                                                                        keys2,
+                                                                        vals1,
+                                                                        perm + end,
+                                                                        nchildren,
+                                                                        nlevel,
+                                                                        offset,
+                                                                        offset + 1,
+                                                                        startbit,
+                                                                        endbit,
+                                                                        stream));
+                RETURN_IF_HIP_ERROR(rocprim::segmented_radix_sort_pairs(rocprim_buffer,
+                                                                        rocprim_size,
+                                                                        keys1,
+                                                                        keys2,
+                                                                        vals1,
+                                                                        perm + end,
+                                                                        nchildren,
+                                                                        nlevel,
+                                                                        offset,
+                                                                        offset + 1,
+                                                                        startbit,
+                                                                        endbit,
+                                                                        stream));
+
+                hipLaunchKernelGGL((csrrcm_mark_kernel<CSRRCM_DIM>),
+                                   dim3((nchildren - 1) / CSRRCM_DIM + 1),
+                                   dim3(CSRRCM_DIM),
+                                   0,
+                                   stream,
+                                   end,
+                                   end + nchildren,
+                                   perm,
+                                   order);
+            }
+
+            begin = end;
+            end += nchildren;
+        }
+
+        placed = end;
+    }
+
+    // Reverse the Cuthill-McKee ordering
+    hipLaunchKernelGGL((csrrcm_reverse_kernel<CSRRCM_DIM>),
+                       dim3((m / 2) / CSRRCM_DIM + 1),
+                       dim3(CSRRCM_DIM),
+                       0,
+                       stream,
+                       m,
+                       perm);
+
+    return rocsparse_status_success;
+}
+
+extern "C" rocsparse_status rocsparse_csrbandwidth(rocsparse_handle          handle,
+                                                   rocsparse_int             m,
+                                                   rocsparse_int             nnz,
+                                                   const rocsparse_mat_descr descr,
+                                                   const rocsparse_int*      csr_row_ptr,
+                                                   const rocsparse_int*      csr_col_ind,
+                                                   rocsparse_int*            bandwidth,
+                                                   int64_t*                  profile)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(descr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Logging
+    log_trace(handle,
+              "rocsparse_csrbandwidth",
+              m,
+              nnz,
+              (const void*&)descr,
+              (const void*&)csr_row_ptr,
+              (const void*&)csr_col_ind,
+              (const void*&)bandwidth,
+              (const void*&)profile);
+
+    // Check matrix type
+    if(descr->type != rocsparse_matrix_type_general)
+    {
+        return rocsparse_status_not_implemented;
+    }
+
+    // Check sizes
+    if(m < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+    else if(nnz < 0)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check pointer arguments
+    if(bandwidth == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(profile == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Stream
+    hipStream_t stream = handle->stream;
+
+    // Quick return if possible
+    if(m == 0)
+    {
+        if(handle->pointer_mode == rocsparse_pointer_mode_device)
+        {
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(bandwidth, 0, sizeof(rocsparse_int), stream));
+            RETURN_IF_HIP_ERROR(hipMemsetAsync(profile, 0, sizeof(int64_t), stream));
+        }
+        else
+        {
+            *bandwidth = 0;
+            *profile   = 0;
+        }
+
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(csr_row_ptr == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(csr_col_ind == nullptr && nnz != 0)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Get workspace from handle device buffer, if results are returned on the host
+    int64_t*       d_profile   = profile;
+    rocsparse_int* d_bandwidth = bandwidth;
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        d_profile   = reinterpret_cast<int64_t*>(handle->buffer);
+        d_bandwidth = reinterpret_cast<rocsparse_int*>(d_profile + 1);
+    }
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_bandwidth, 0, sizeof(rocsparse_int), stream));
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(d_profile, 0, sizeof(int64_t), stream));
+
+    hipLaunchKernelGGL((csrbandwidth_kernel<CSRRCM_DIM>),
+                       dim3((m - 1) / CSRRCM_DIM + 1),
+                       dim3(CSRRCM_DIM),
+                       0,
+                       stream,
+                       m,
+                       csr_row_ptr,
+                       csr_col_ind,
+                       d_bandwidth,
+                       d_profile,
+                       descr->base);
+
+    if(handle->pointer_mode == rocsparse_pointer_mode_host)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            bandwidth, d_bandwidth, sizeof(rocsparse_int), hipMemcpyDeviceToHost, stream));
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(profile, d_profile, sizeof(int64_t), hipMemcpyDeviceToHost, stream));
+
+        // Wait for host transfer to finish
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+    return rocsparse_status_success;
+}
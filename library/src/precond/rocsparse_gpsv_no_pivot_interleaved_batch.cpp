@@ -0,0 +1,275 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_gpsv_no_pivot_interleaved_batch.hpp"
+
+#include "gpsv_nopivot_batch_device.h"
+
+#define GPSV_BATCH_DIM 128
+
+template <typename T>
+rocsparse_status
+    rocsparse_gpsv_no_pivot_interleaved_batch_buffer_size_template(rocsparse_handle handle,
+                                                                   rocsparse_int    m,
+                                                                   const T*         ds,
+                                                                   const T*         dl,
+                                                                   const T*         d,
+                                                                   const T*         du,
+                                                                   const T*         dw,
+                                                                   const T*         x,
+                                                                   rocsparse_int    batch_count,
+                                                                   rocsparse_int    batch_stride,
+                                                                   size_t*          buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgpsv_no_pivot_interleaved_batch_buffer_size"),
+              m,
+              (const void*&)ds,
+              (const void*&)dl,
+              (const void*&)d,
+              (const void*&)du,
+              (const void*&)dw,
+              (const void*&)x,
+              batch_count,
+              batch_stride,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m <= 1 || batch_count < 0 || batch_stride < batch_count)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(batch_count == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(ds == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dl == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(d == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(du == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dw == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    *buffer_size = 0;
+
+    *buffer_size += sizeof(T) * ((m * batch_count - 1) / 256 + 1) * 256; // u1
+    *buffer_size += sizeof(T) * ((m * batch_count - 1) / 256 + 1) * 256; // u2
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_gpsv_no_pivot_interleaved_batch_template(rocsparse_handle handle,
+                                                                    rocsparse_int    m,
+                                                                    const T*         ds,
+                                                                    const T*         dl,
+                                                                    const T*         d,
+                                                                    const T*         du,
+                                                                    const T*         dw,
+                                                                    T*               x,
+                                                                    rocsparse_int    batch_count,
+                                                                    rocsparse_int    batch_stride,
+                                                                    void*            temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgpsv_no_pivot_interleaved_batch"),
+              m,
+              (const void*&)ds,
+              (const void*&)dl,
+              (const void*&)d,
+              (const void*&)du,
+              (const void*&)dw,
+              (const void*&)x,
+              batch_count,
+              batch_stride,
+              (const void*&)temp_buffer);
+
+    log_bench(handle,
+              "./rocsparse-bench -f gpsv_no_pivot_interleaved_batch -r",
+              replaceX<T>("X"),
+              "--mtx <matrix.mtx> ");
+
+    // Check sizes
+    if(m <= 1 || batch_count < 0 || batch_stride < batch_count)
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(batch_count == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(ds == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dl == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(d == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(du == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(dw == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(x == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    T*    u1  = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m * batch_count - 1) / 256 + 1) * 256;
+    T* u2 = reinterpret_cast<T*>(ptr);
+
+    hipLaunchKernelGGL((gpsv_nopivot_interleaved_batch_kernel<GPSV_BATCH_DIM>),
+                       dim3((batch_count - 1) / GPSV_BATCH_DIM + 1),
+                       dim3(GPSV_BATCH_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       batch_count,
+                       batch_stride,
+                       ds,
+                       dl,
+                       d,
+                       du,
+                       dw,
+                       u1,
+                       u2,
+                       x);
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+#define C_IMPL(NAME, TYPE)                                                            \
+    extern "C" rocsparse_status NAME(rocsparse_handle handle,                         \
+                                     rocsparse_int    m,                              \
+                                     const TYPE*      ds,                             \
+                                     const TYPE*      dl,                             \
+                                     const TYPE*      d,                              \
+                                     const TYPE*      du,                             \
+                                     const TYPE*      dw,                             \
+                                     const TYPE*      x,                              \
+                                     rocsparse_int    batch_count,                    \
+                                     rocsparse_int    batch_stride,                   \
+                                     size_t*          buffer_size)                    \
+    {                                                                                 \
+        return rocsparse_gpsv_no_pivot_interleaved_batch_buffer_size_template(        \
+            handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, buffer_size); \
+    }
+
+C_IMPL(rocsparse_sgpsv_no_pivot_interleaved_batch_buffer_size, float);
+C_IMPL(rocsparse_dgpsv_no_pivot_interleaved_batch_buffer_size, double);
+C_IMPL(rocsparse_cgpsv_no_pivot_interleaved_batch_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zgpsv_no_pivot_interleaved_batch_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                            \
+    extern "C" rocsparse_status NAME(rocsparse_handle handle,                         \
+                                     rocsparse_int    m,                              \
+                                     const TYPE*      ds,                             \
+                                     const TYPE*      dl,                             \
+                                     const TYPE*      d,                              \
+                                     const TYPE*      du,                             \
+                                     const TYPE*      dw,                             \
+                                     TYPE*            x,                              \
+                                     rocsparse_int    batch_count,                    \
+                                     rocsparse_int    batch_stride,                   \
+                                     void*            temp_buffer)                    \
+    {                                                                                 \
+        return rocsparse_gpsv_no_pivot_interleaved_batch_template(                    \
+            handle, m, ds, dl, d, du, dw, x, batch_count, batch_stride, temp_buffer); \
+    }
+
+C_IMPL(rocsparse_sgpsv_no_pivot_interleaved_batch, float);
+C_IMPL(rocsparse_dgpsv_no_pivot_interleaved_batch, double);
+C_IMPL(rocsparse_cgpsv_no_pivot_interleaved_batch, rocsparse_float_complex);
+C_IMPL(rocsparse_zgpsv_no_pivot_interleaved_batch, rocsparse_double_complex);
+
+#undef C_IMPL
@@ -0,0 +1,356 @@
+/*! \file */
+/* ************************************************************************
+ * Copyright (c) 2021 Advanced Micro Devices, Inc.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocsparse_gtsv.hpp"
+
+#include "gtsv_device.h"
+
+#define GTSV_DIM 64
+#define GTSV_MAX_PARTITIONS 8192
+
+// Number of SPIKE partitions. The rows are split into partitions of at most 32 rows, up
+// to GTSV_MAX_PARTITIONS partitions. Larger systems use GTSV_MAX_PARTITIONS partitions of
+// more rows, such that the reduced system has at most 2 * GTSV_MAX_PARTITIONS unknowns.
+// Its banded factorization is the only sequential part of the solver.
+static rocsparse_int rocsparse_gtsv_partition_count(rocsparse_int m)
+{
+    return std::min((m - 1) / 32 + 1, GTSV_MAX_PARTITIONS);
+}
+
+template <typename T>
+rocsparse_status rocsparse_gtsv_buffer_size_template(rocsparse_handle handle,
+                                                     rocsparse_int    m,
+                                                     rocsparse_int    n,
+                                                     const T*         dl,
+                                                     const T*         d,
+                                                     const T*         du,
+                                                     const T*         B,
+                                                     rocsparse_int    ldb,
+                                                     size_t*          buffer_size)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgtsv_buffer_size"),
+              m,
+              n,
+              (const void*&)dl,
+              (const void*&)d,
+              (const void*&)du,
+              (const void*&)B,
+              ldb,
+              (const void*&)buffer_size);
+
+    // Check sizes
+    if(m <= 1 || n < 0 || ldb < std::max(1, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Check for valid buffer_size pointer
+    if(buffer_size == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    // Quick return if possible
+    if(n == 0)
+    {
+        // Do not return 0 as buffer size
+        *buffer_size = 4;
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(dl == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(d == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(du == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_int nred = 2 * rocsparse_gtsv_partition_count(m);
+
+    *buffer_size = 0;
+
+    *buffer_size += sizeof(T) * ((m - 1) / 256 + 1) * 256; // L
+    *buffer_size += sizeof(T) * ((m - 1) / 256 + 1) * 256; // U0
+    *buffer_size += sizeof(T) * ((m - 1) / 256 + 1) * 256; // U1
+    *buffer_size += sizeof(T) * ((m - 1) / 256 + 1) * 256; // U2
+    *buffer_size += sizeof(T) * ((m - 1) / 256 + 1) * 256; // V
+    *buffer_size += sizeof(T) * ((m - 1) / 256 + 1) * 256; // W
+    *buffer_size += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256; // P
+    *buffer_size += sizeof(T) * ((GTSV_BAND_LD * nred - 1) / 256 + 1) * 256; // RB
+    *buffer_size += sizeof(rocsparse_int) * ((nred - 1) / 256 + 1) * 256; // RP
+    *buffer_size += sizeof(T) * ((nred * n - 1) / 256 + 1) * 256; // XR
+
+    return rocsparse_status_success;
+}
+
+template <typename T>
+rocsparse_status rocsparse_gtsv_template(rocsparse_handle handle,
+                                         rocsparse_int    m,
+                                         rocsparse_int    n,
+                                         const T*         dl,
+                                         const T*         d,
+                                         const T*         du,
+                                         T*               B,
+                                         rocsparse_int    ldb,
+                                         void*            temp_buffer)
+{
+    // Check for valid handle and matrix descriptor
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+
+    // Logging
+    log_trace(handle,
+              replaceX<T>("rocsparse_Xgtsv"),
+              m,
+              n,
+              (const void*&)dl,
+              (const void*&)d,
+              (const void*&)du,
+              (const void*&)B,
+              ldb,
+              (const void*&)temp_buffer);
+
+    log_bench(handle, "./rocsparse-bench -f gtsv -r", replaceX<T>("X"), "--mtx <matrix.mtx> ");
+
+    // Check sizes
+    if(m <= 1 || n < 0 || ldb < std::max(1, m))
+    {
+        return rocsparse_status_invalid_size;
+    }
+
+    // Quick return if possible
+    if(n == 0)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Check pointer arguments
+    if(dl == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(d == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(du == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(B == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    else if(temp_buffer == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+
+    rocsparse_int npart = rocsparse_gtsv_partition_count(m);
+    rocsparse_int nred  = 2 * npart;
+
+    char* ptr = reinterpret_cast<char*>(temp_buffer);
+    T*    L   = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+    T* U0 = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+    T* U1 = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+    T* U2 = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+    T* V = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+    T* W = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((m - 1) / 256 + 1) * 256;
+    rocsparse_int* P = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((m - 1) / 256 + 1) * 256;
+    T* RB = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((GTSV_BAND_LD * nred - 1) / 256 + 1) * 256;
+    rocsparse_int* RP = reinterpret_cast<rocsparse_int*>(ptr);
+    ptr += sizeof(rocsparse_int) * ((nred - 1) / 256 + 1) * 256;
+    T* XR = reinterpret_cast<T*>(ptr);
+    ptr += sizeof(T) * ((nred * n - 1) / 256 + 1) * 256;
+
+    // Stage 1: Factorize all partitions with partial pivoting and compute the spikes
+    hipLaunchKernelGGL((gtsv_spike_factorize_kernel<GTSV_DIM>),
+                       dim3((npart - 1) / GTSV_DIM + 1),
+                       dim3(GTSV_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       npart,
+                       dl,
+                       d,
+                       du,
+                       L,
+                       U0,
+                       U1,
+                       U2,
+                       P,
+                       V,
+                       W);
+
+    // Stage 2: Solve all partitions for all right-hand sides
+    hipLaunchKernelGGL((gtsv_spike_solve_kernel<GTSV_DIM>),
+                       dim3((npart - 1) / GTSV_DIM + 1, n),
+                       dim3(GTSV_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       npart,
+                       ldb,
+                       L,
+                       U0,
+                       U1,
+                       U2,
+                       P,
+                       B);
+
+    // A single partition does not couple to anything
+    if(npart == 1)
+    {
+        return rocsparse_status_success;
+    }
+
+    // Stage 3: Assemble and factorize the reduced system of the first and last unknowns of
+    // each partition. The factorization with partial pivoting runs in a single thread.
+    hipLaunchKernelGGL((gtsv_spike_reduced_assemble_kernel<GTSV_DIM>),
+                       dim3((npart - 1) / GTSV_DIM + 1),
+                       dim3(GTSV_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       npart,
+                       V,
+                       W,
+                       RB);
+
+    hipLaunchKernelGGL((gtsv_spike_reduced_factorize_kernel<T>),
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       handle->stream,
+                       nred,
+                       RB,
+                       RP);
+
+    // Stage 4: Solve the reduced system for all right-hand sides
+    hipLaunchKernelGGL((gtsv_spike_reduced_solve_kernel<GTSV_DIM>),
+                       dim3((n - 1) / GTSV_DIM + 1),
+                       dim3(GTSV_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       n,
+                       npart,
+                       ldb,
+                       RB,
+                       RP,
+                       B,
+                       XR);
+
+    // Stage 5: Recover the solution from the spikes
+    hipLaunchKernelGGL((gtsv_spike_recover_kernel<GTSV_DIM>),
+                       dim3((npart - 1) / GTSV_DIM + 1, n),
+                       dim3(GTSV_DIM),
+                       0,
+                       handle->stream,
+                       m,
+                       npart,
+                       ldb,
+                       V,
+                       W,
+                       XR,
+                       B);
+
+    return rocsparse_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+#define C_IMPL(NAME, TYPE)                                                                        \
+    extern "C" rocsparse_status NAME(rocsparse_handle handle,                                     \
+                                     rocsparse_int    m,                                          \
+                                     rocsparse_int    n,                                          \
+                                     const TYPE*      dl,                                         \
+                                     const TYPE*      d,                                          \
+                                     const TYPE*      du,                                         \
+                                     const TYPE*      B,                                          \
+                                     rocsparse_int    ldb,                                        \
+                                     size_t*          buffer_size)                                \
+    {                                                                                             \
+        return rocsparse_gtsv_buffer_size_template(handle, m, n, dl, d, du, B, ldb, buffer_size); \
+    }
+
+C_IMPL(rocsparse_sgtsv_buffer_size, float);
+C_IMPL(rocsparse_dgtsv_buffer_size, double);
+C_IMPL(rocsparse_cgtsv_buffer_size, rocsparse_float_complex);
+C_IMPL(rocsparse_zgtsv_buffer_size, rocsparse_double_complex);
+
+#undef C_IMPL
+
+#define C_IMPL(NAME, TYPE)                                                            \
+    extern "C" rocsparse_status NAME(rocsparse_handle handle,                         \
+                                     rocsparse_int    m,                              \
+                                     rocsparse_int    n,                              \
+                                     const TYPE*      dl,                             \
+                                     const TYPE*      d,                              \
+                                     const TYPE*      du,                             \
+                                     TYPE*            B,                              \
+                                     rocsparse_int    ldb,                            \
+                                     void*            temp_buffer)                    \
+    {                                                                                 \
+        return rocsparse_gtsv_template(handle, m, n, dl, d, du, B, ldb, temp_buffer); \
+    }
+
+C_IMPL(rocsparse_sgtsv, float);
+C_IMPL(rocsparse_dgtsv, double);
+C_IMPL(rocsparse_cgtsv, rocsparse_float_complex);
+C_IMPL(rocsparse_zgtsv, rocsparse_double_complex);
+
+#undef C_IMPL
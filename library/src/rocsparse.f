@@ -93,6 +93,27 @@ module rocsparse
             integer(c_int) :: pointer_mode
         end function rocsparse_get_pointer_mode
 
+!       rocsparse_memory_budget
+        function rocsparse_set_memory_budget(handle, budget) &
+                bind(c, name = 'rocsparse_set_memory_budget')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_set_memory_budget
+            type(c_ptr), value :: handle
+            integer(c_size_t), value :: budget
+        end function rocsparse_set_memory_budget
+
+        function rocsparse_get_memory_budget(handle, budget) &
+                bind(c, name = 'rocsparse_get_memory_budget')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_get_memory_budget
+            type(c_ptr), value :: handle
+            integer(c_size_t) :: budget
+        end function rocsparse_get_memory_budget
+
 !       rocsparse_version
         function rocsparse_get_version(handle, version) &
                 bind(c, name = 'rocsparse_get_version')
@@ -1316,6 +1337,32 @@ module rocsparse
             type(c_ptr), value :: position
         end function rocsparse_csrsv_zero_pivot
 
+!       rocsparse_csrsv_level_info
+        function rocsparse_csrsv_level_info(handle, trans, descr, info, nlevels) &
+                bind(c, name = 'rocsparse_csrsv_level_info')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrsv_level_info
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: info
+            type(c_ptr), value :: nlevels
+        end function rocsparse_csrsv_level_info
+
+!       rocsparse_csrsv_jacobi_sweeps
+        function rocsparse_csrsv_jacobi_sweeps(handle, info, nsweeps) &
+                bind(c, name = 'rocsparse_csrsv_jacobi_sweeps')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrsv_jacobi_sweeps
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+        end function rocsparse_csrsv_jacobi_sweeps
+
 !       rocsparse_csrsv_buffer_size
         function rocsparse_scsrsv_buffer_size(handle, trans, m, nnz, descr, csr_val, &
                 csr_row_ptr, csr_col_ind, info, buffer_size) &
@@ -2506,1552 +2553,5291 @@ module rocsparse
 !   extra SPARSE
 ! ===========================================================================
 
-!       rocsparse_csrgeam_nnz
-        function rocsparse_csrgeam_nnz(handle, m, n, descr_A, nnz_A, csr_row_ptr_A, &
-                csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_C, &
-                csr_row_ptr_C, nnz_C) &
-                bind(c, name = 'rocsparse_csrgeam_nnz')
+!       rocsparse_bsrgeam_nnzb
+        function rocsparse_bsrgeam_nnzb(handle, dir, mb, nb, block_dim, descr_A, nnzb_A, &
+                bsr_row_ptr_A, bsr_col_ind_A, descr_B, nnzb_B, bsr_row_ptr_B, &
+                bsr_col_ind_B, descr_C, bsr_row_ptr_C, nnzb_C) &
+                bind(c, name = 'rocsparse_bsrgeam_nnzb')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrgeam_nnz
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrgeam_nnzb
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: block_dim
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
             type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_row_ptr_C
-            type(c_ptr), value :: nnz_C
-        end function rocsparse_csrgeam_nnz
+            type(c_ptr), value :: bsr_row_ptr_C
+            type(c_ptr), value :: nnzb_C
+        end function rocsparse_bsrgeam_nnzb
 
-!       rocsparse_csrgeam
-        function rocsparse_scsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
-                bind(c, name = 'rocsparse_scsrgeam')
+!       rocsparse_bsrgeam
+        function rocsparse_sbsrgeam(handle, dir, mb, nb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, beta, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_sbsrgeam')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgeam
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrgeam
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: block_dim
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
             type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_scsrgeam
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_sbsrgeam
 
-        function rocsparse_dcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
-                bind(c, name = 'rocsparse_dcsrgeam')
+        function rocsparse_dbsrgeam(handle, dir, mb, nb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, beta, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_dbsrgeam')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgeam
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrgeam
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: block_dim
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
             type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_dcsrgeam
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_dbsrgeam
 
-        function rocsparse_ccsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
-                bind(c, name = 'rocsparse_ccsrgeam')
+        function rocsparse_cbsrgeam(handle, dir, mb, nb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, beta, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_cbsrgeam')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgeam
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrgeam
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: block_dim
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
             type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_ccsrgeam
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_cbsrgeam
 
-        function rocsparse_zcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
-                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
-                csr_col_ind_C) &
-                bind(c, name = 'rocsparse_zcsrgeam')
+        function rocsparse_zbsrgeam(handle, dir, mb, nb, block_dim, alpha, descr_A, &
+                nnzb_A, bsr_val_A, bsr_row_ptr_A, bsr_col_ind_A, beta, descr_B, nnzb_B, &
+                bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, descr_C, bsr_val_C, &
+                bsr_row_ptr_C, bsr_col_ind_C) &
+                bind(c, name = 'rocsparse_zbsrgeam')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgeam
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrgeam
             type(c_ptr), value :: handle
-            integer(c_int), value :: m
-            integer(c_int), value :: n
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: block_dim
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
             type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-        end function rocsparse_zcsrgeam
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+        end function rocsparse_zbsrgeam
 
-!       rocsparse_csrgemm_buffer_size
-        function rocsparse_scsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
-                buffer_size) &
-                bind(c, name = 'rocsparse_scsrgemm_buffer_size')
+!       rocsparse_bsrgemm_buffer_size
+        function rocsparse_sbsrgemm_buffer_size(handle, dir, trans_A, trans_B, mb, nb, &
+                kb, block_dim, alpha, descr_A, nnzb_A, bsr_row_ptr_A, bsr_col_ind_A, &
+                descr_B, nnzb_B, bsr_row_ptr_B, bsr_col_ind_B, beta, descr_D, nnzb_D, &
+                bsr_row_ptr_D, bsr_col_ind_D, info_C, buffer_size) &
+                bind(c, name = 'rocsparse_sbsrgemm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrgemm_buffer_size
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
+            integer(c_int), value :: nnzb_D
+            type(c_ptr), intent(in), value :: bsr_row_ptr_D
+            type(c_ptr), intent(in), value :: bsr_col_ind_D
             type(c_ptr), value :: info_C
             type(c_ptr), value :: buffer_size
-        end function rocsparse_scsrgemm_buffer_size
+        end function rocsparse_sbsrgemm_buffer_size
 
-        function rocsparse_dcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
-                buffer_size) &
-                bind(c, name = 'rocsparse_dcsrgemm_buffer_size')
+        function rocsparse_dbsrgemm_buffer_size(handle, dir, trans_A, trans_B, mb, nb, &
+                kb, block_dim, alpha, descr_A, nnzb_A, bsr_row_ptr_A, bsr_col_ind_A, &
+                descr_B, nnzb_B, bsr_row_ptr_B, bsr_col_ind_B, beta, descr_D, nnzb_D, &
+                bsr_row_ptr_D, bsr_col_ind_D, info_C, buffer_size) &
+                bind(c, name = 'rocsparse_dbsrgemm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrgemm_buffer_size
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
+            integer(c_int), value :: nnzb_D
+            type(c_ptr), intent(in), value :: bsr_row_ptr_D
+            type(c_ptr), intent(in), value :: bsr_col_ind_D
             type(c_ptr), value :: info_C
             type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsrgemm_buffer_size
+        end function rocsparse_dbsrgemm_buffer_size
 
-        function rocsparse_ccsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
-                buffer_size) &
-                bind(c, name = 'rocsparse_ccsrgemm_buffer_size')
+        function rocsparse_cbsrgemm_buffer_size(handle, dir, trans_A, trans_B, mb, nb, &
+                kb, block_dim, alpha, descr_A, nnzb_A, bsr_row_ptr_A, bsr_col_ind_A, &
+                descr_B, nnzb_B, bsr_row_ptr_B, bsr_col_ind_B, beta, descr_D, nnzb_D, &
+                bsr_row_ptr_D, bsr_col_ind_D, info_C, buffer_size) &
+                bind(c, name = 'rocsparse_cbsrgemm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrgemm_buffer_size
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
+            integer(c_int), value :: nnzb_D
+            type(c_ptr), intent(in), value :: bsr_row_ptr_D
+            type(c_ptr), intent(in), value :: bsr_col_ind_D
             type(c_ptr), value :: info_C
             type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsrgemm_buffer_size
+        end function rocsparse_cbsrgemm_buffer_size
 
-        function rocsparse_zcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
-                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
-                buffer_size) &
-                bind(c, name = 'rocsparse_zcsrgemm_buffer_size')
+        function rocsparse_zbsrgemm_buffer_size(handle, dir, trans_A, trans_B, mb, nb, &
+                kb, block_dim, alpha, descr_A, nnzb_A, bsr_row_ptr_A, bsr_col_ind_A, &
+                descr_B, nnzb_B, bsr_row_ptr_B, bsr_col_ind_B, beta, descr_D, nnzb_D, &
+                bsr_row_ptr_D, bsr_col_ind_D, info_C, buffer_size) &
+                bind(c, name = 'rocsparse_zbsrgemm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrgemm_buffer_size
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
-            type(c_ptr), intent(in), value :: alpha
-            type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
             type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
+            integer(c_int), value :: nnzb_D
+            type(c_ptr), intent(in), value :: bsr_row_ptr_D
+            type(c_ptr), intent(in), value :: bsr_col_ind_D
             type(c_ptr), value :: info_C
             type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsrgemm_buffer_size
+        end function rocsparse_zbsrgemm_buffer_size
 
-!       rocsparse_csrgemm_nnz
-        function rocsparse_csrgemm_nnz(handle, trans_A, trans_B, m, n, k, descr_A, &
-                nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
-                csr_col_ind_B, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, descr_C, &
-                csr_row_ptr_C, nnz_C, info_C, temp_buffer) &
-                bind(c, name = 'rocsparse_csrgemm_nnz')
+!       rocsparse_bsrgemm_nnzb
+        function rocsparse_bsrgemm_nnzb(handle, dir, trans_A, trans_B, mb, nb, kb, &
+                block_dim, descr_A, nnzb_A, bsr_row_ptr_A, bsr_col_ind_A, descr_B, &
+                nnzb_B, bsr_row_ptr_B, bsr_col_ind_B, descr_D, nnzb_D, bsr_row_ptr_D, &
+                bsr_col_ind_D, descr_C, bsr_row_ptr_C, nnzb_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_bsrgemm_nnzb')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrgemm_nnz
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrgemm_nnzb
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
-            integer(c_int), value :: m
-            integer(c_int), value :: n
-            integer(c_int), value :: k
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
             type(c_ptr), intent(in), value :: descr_A
-            integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_row_ptr_A
-            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
-            integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_row_ptr_B
-            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
             type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
+            integer(c_int), value :: nnzb_D
+            type(c_ptr), intent(in), value :: bsr_row_ptr_D
+            type(c_ptr), intent(in), value :: bsr_col_ind_D
             type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_row_ptr_C
-            type(c_ptr), value :: nnz_C
+            type(c_ptr), value :: bsr_row_ptr_C
+            type(c_ptr), value :: nnzb_C
             type(c_ptr), intent(in), value :: info_C
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_csrgemm_nnz
+        end function rocsparse_bsrgemm_nnzb
 
-!       rocsparse_csrgemm
-        function rocsparse_scsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
-                temp_buffer) &
-                bind(c, name = 'rocsparse_scsrgemm')
+!       rocsparse_bsrgemm
+        function rocsparse_sbsrgemm(handle, dir, trans_A, trans_B, mb, nb, kb, &
+                block_dim, alpha, descr_A, nnzb_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, descr_B, nnzb_B, bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, &
+                beta, descr_D, nnzb_D, bsr_val_D, bsr_row_ptr_D, bsr_col_ind_D, descr_C, &
+                bsr_val_C, bsr_row_ptr_C, bsr_col_ind_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsrgemm')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnzb_D
+            type(c_ptr), intent(in), value :: bsr_val_D
+            type(c_ptr), intent(in), value :: bsr_row_ptr_D
+            type(c_ptr), intent(in), value :: bsr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrgemm
+
+        function rocsparse_dbsrgemm(handle, dir, trans_A, trans_B, mb, nb, kb, &
+                block_dim, alpha, descr_A, nnzb_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, descr_B, nnzb_B, bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, &
+                beta, descr_D, nnzb_D, bsr_val_D, bsr_row_ptr_D, bsr_col_ind_D, descr_C, &
+                bsr_val_C, bsr_row_ptr_C, bsr_col_ind_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnzb_D
+            type(c_ptr), intent(in), value :: bsr_val_D
+            type(c_ptr), intent(in), value :: bsr_row_ptr_D
+            type(c_ptr), intent(in), value :: bsr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsrgemm
+
+        function rocsparse_cbsrgemm(handle, dir, trans_A, trans_B, mb, nb, kb, &
+                block_dim, alpha, descr_A, nnzb_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, descr_B, nnzb_B, bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, &
+                beta, descr_D, nnzb_D, bsr_val_D, bsr_row_ptr_D, bsr_col_ind_D, descr_C, &
+                bsr_val_C, bsr_row_ptr_C, bsr_col_ind_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnzb_D
+            type(c_ptr), intent(in), value :: bsr_val_D
+            type(c_ptr), intent(in), value :: bsr_row_ptr_D
+            type(c_ptr), intent(in), value :: bsr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsrgemm
+
+        function rocsparse_zbsrgemm(handle, dir, trans_A, trans_B, mb, nb, kb, &
+                block_dim, alpha, descr_A, nnzb_A, bsr_val_A, bsr_row_ptr_A, &
+                bsr_col_ind_A, descr_B, nnzb_B, bsr_val_B, bsr_row_ptr_B, bsr_col_ind_B, &
+                beta, descr_D, nnzb_D, bsr_val_D, bsr_row_ptr_D, bsr_col_ind_D, descr_C, &
+                bsr_val_C, bsr_row_ptr_C, bsr_col_ind_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrgemm
             type(c_ptr), value :: handle
+            integer(c_int), value :: dir
             integer(c_int), value :: trans_A
             integer(c_int), value :: trans_B
+            integer(c_int), value :: mb
+            integer(c_int), value :: nb
+            integer(c_int), value :: kb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnzb_A
+            type(c_ptr), intent(in), value :: bsr_val_A
+            type(c_ptr), intent(in), value :: bsr_row_ptr_A
+            type(c_ptr), intent(in), value :: bsr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnzb_B
+            type(c_ptr), intent(in), value :: bsr_val_B
+            type(c_ptr), intent(in), value :: bsr_row_ptr_B
+            type(c_ptr), intent(in), value :: bsr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnzb_D
+            type(c_ptr), intent(in), value :: bsr_val_D
+            type(c_ptr), intent(in), value :: bsr_row_ptr_D
+            type(c_ptr), intent(in), value :: bsr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: bsr_val_C
+            type(c_ptr), intent(in), value :: bsr_row_ptr_C
+            type(c_ptr), value :: bsr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsrgemm
+
+!       rocsparse_csrgeam_nnz
+        function rocsparse_csrgeam_nnz(handle, m, n, descr_A, nnz_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_C, &
+                csr_row_ptr_C, nnz_C) &
+                bind(c, name = 'rocsparse_csrgeam_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrgeam_nnz
+            type(c_ptr), value :: handle
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
-            type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
-            type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
             type(c_ptr), intent(in), value :: descr_B
             integer(c_int), value :: nnz_B
-            type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
             type(c_ptr), intent(in), value :: descr_C
-            type(c_ptr), value :: csr_val_C
-            type(c_ptr), intent(in), value :: csr_row_ptr_C
-            type(c_ptr), value :: csr_col_ind_C
-            type(c_ptr), intent(in), value :: info_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrgemm
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+        end function rocsparse_csrgeam_nnz
 
-        function rocsparse_dcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
-                temp_buffer) &
-                bind(c, name = 'rocsparse_dcsrgemm')
+!       rocsparse_csrgeam
+        function rocsparse_scsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_scsrgeam')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgeam
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_B
             integer(c_int), value :: nnz_B
             type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_val_C
             type(c_ptr), intent(in), value :: csr_row_ptr_C
             type(c_ptr), value :: csr_col_ind_C
-            type(c_ptr), intent(in), value :: info_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrgemm
+        end function rocsparse_scsrgeam
 
-        function rocsparse_ccsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
-                temp_buffer) &
-                bind(c, name = 'rocsparse_ccsrgemm')
+        function rocsparse_dcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_dcsrgeam')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgeam
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_B
             integer(c_int), value :: nnz_B
             type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_val_C
             type(c_ptr), intent(in), value :: csr_row_ptr_C
             type(c_ptr), value :: csr_col_ind_C
-            type(c_ptr), intent(in), value :: info_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrgemm
+        end function rocsparse_dcsrgeam
 
-        function rocsparse_zcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
-                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
-                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
-                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
-                temp_buffer) &
-                bind(c, name = 'rocsparse_zcsrgemm')
+        function rocsparse_ccsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_ccsrgeam')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgeam
             type(c_ptr), value :: handle
-            integer(c_int), value :: trans_A
-            integer(c_int), value :: trans_B
             integer(c_int), value :: m
             integer(c_int), value :: n
-            integer(c_int), value :: k
             type(c_ptr), intent(in), value :: alpha
             type(c_ptr), intent(in), value :: descr_A
             integer(c_int), value :: nnz_A
             type(c_ptr), intent(in), value :: csr_val_A
             type(c_ptr), intent(in), value :: csr_row_ptr_A
             type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
             type(c_ptr), intent(in), value :: descr_B
             integer(c_int), value :: nnz_B
             type(c_ptr), intent(in), value :: csr_val_B
             type(c_ptr), intent(in), value :: csr_row_ptr_B
             type(c_ptr), intent(in), value :: csr_col_ind_B
-            type(c_ptr), intent(in), value :: beta
-            type(c_ptr), intent(in), value :: descr_D
-            integer(c_int), value :: nnz_D
-            type(c_ptr), intent(in), value :: csr_val_D
-            type(c_ptr), intent(in), value :: csr_row_ptr_D
-            type(c_ptr), intent(in), value :: csr_col_ind_D
             type(c_ptr), intent(in), value :: descr_C
             type(c_ptr), value :: csr_val_C
             type(c_ptr), intent(in), value :: csr_row_ptr_C
             type(c_ptr), value :: csr_col_ind_C
-            type(c_ptr), intent(in), value :: info_C
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrgemm
+        end function rocsparse_ccsrgeam
+
+        function rocsparse_zcsrgeam(handle, m, n, alpha, descr_A, nnz_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, beta, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_zcsrgeam')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgeam
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_zcsrgeam
+
+!       rocsparse_csrgeam_multi_nnz
+        function rocsparse_csrgeam_multi_nnz(handle, m, n, num_mat, descr_A, nnz_A, &
+                csr_row_ptr_A, csr_col_ind_A, descr_C, csr_row_ptr_C, nnz_C) &
+                bind(c, name = 'rocsparse_csrgeam_multi_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrgeam_multi_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: num_mat
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+        end function rocsparse_csrgeam_multi_nnz
+
+!       rocsparse_csrgeam_multi
+        function rocsparse_scsrgeam_multi(handle, m, n, num_mat, alpha, descr_A, nnz_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C) &
+                bind(c, name = 'rocsparse_scsrgeam_multi')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgeam_multi
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: num_mat
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_scsrgeam_multi
+
+        function rocsparse_dcsrgeam_multi(handle, m, n, num_mat, alpha, descr_A, nnz_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C) &
+                bind(c, name = 'rocsparse_dcsrgeam_multi')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgeam_multi
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: num_mat
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_dcsrgeam_multi
+
+        function rocsparse_ccsrgeam_multi(handle, m, n, num_mat, alpha, descr_A, nnz_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C) &
+                bind(c, name = 'rocsparse_ccsrgeam_multi')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgeam_multi
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: num_mat
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_ccsrgeam_multi
+
+        function rocsparse_zcsrgeam_multi(handle, m, n, num_mat, alpha, descr_A, nnz_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_C, csr_val_C, &
+                csr_row_ptr_C, csr_col_ind_C) &
+                bind(c, name = 'rocsparse_zcsrgeam_multi')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgeam_multi
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: num_mat
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_zcsrgeam_multi
+
+!       rocsparse_csrewise_nnz
+        function rocsparse_csrewise_nnz(handle, pattern, m, n, descr_A, nnz_A, &
+                csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, descr_C, csr_row_ptr_C, nnz_C) &
+                bind(c, name = 'rocsparse_csrewise_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrewise_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: pattern
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+        end function rocsparse_csrewise_nnz
+
+!       rocsparse_csrewise
+
+        function rocsparse_scsrewise(handle, pattern, op, m, n, descr_A, nnz_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_scsrewise')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrewise
+            type(c_ptr), value :: handle
+            integer(c_int), value :: pattern
+            integer(c_int), value :: op
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_scsrewise
+
+        function rocsparse_dcsrewise(handle, pattern, op, m, n, descr_A, nnz_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_dcsrewise')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrewise
+            type(c_ptr), value :: handle
+            integer(c_int), value :: pattern
+            integer(c_int), value :: op
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_dcsrewise
+
+        function rocsparse_ccsrewise(handle, pattern, op, m, n, descr_A, nnz_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_ccsrewise')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrewise
+            type(c_ptr), value :: handle
+            integer(c_int), value :: pattern
+            integer(c_int), value :: op
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_ccsrewise
+
+        function rocsparse_zcsrewise(handle, pattern, op, m, n, descr_A, nnz_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, descr_C, csr_val_C, csr_row_ptr_C, &
+                csr_col_ind_C) &
+                bind(c, name = 'rocsparse_zcsrewise')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrewise
+            type(c_ptr), value :: handle
+            integer(c_int), value :: pattern
+            integer(c_int), value :: op
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+        end function rocsparse_zcsrewise
+
+!       rocsparse_csrgemm_buffer_size
+        function rocsparse_scsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_scsrgemm_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrgemm_buffer_size
+
+        function rocsparse_dcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_dcsrgemm_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrgemm_buffer_size
+
+        function rocsparse_ccsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_ccsrgemm_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrgemm_buffer_size
+
+        function rocsparse_zcsrgemm_buffer_size(handle, trans_A, trans_B, m, n, k, alpha, &
+                descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, beta, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, info_C, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_zcsrgemm_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrgemm_buffer_size
+
+!       rocsparse_csrgemm_nnz
+        function rocsparse_csrgemm_nnz(handle, trans_A, trans_B, m, n, k, descr_A, &
+                nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_row_ptr_B, &
+                csr_col_ind_B, descr_D, nnz_D, csr_row_ptr_D, csr_col_ind_D, descr_C, &
+                csr_row_ptr_C, nnz_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_csrgemm_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrgemm_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csrgemm_nnz
+
+!       rocsparse_csrgemm_nnz_estimate
+        function rocsparse_csrgemm_nnz_estimate(handle, trans_A, trans_B, &
+                m, n, k, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_row_ptr_B, csr_col_ind_B, sample_size, nnz_products, &
+                nnz_C, nnz_C_lower, nnz_C_upper) &
+                bind(c, name = 'rocsparse_csrgemm_nnz_estimate')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrgemm_nnz_estimate
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            integer(c_int), value :: sample_size
+            type(c_ptr), value :: nnz_products
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), value :: nnz_C_lower
+            type(c_ptr), value :: nnz_C_upper
+        end function rocsparse_csrgemm_nnz_estimate
+
+!       rocsparse_csrgemm
+        function rocsparse_scsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_scsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrgemm
+
+        function rocsparse_dcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrgemm
+
+        function rocsparse_ccsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrgemm
+
+        function rocsparse_zcsrgemm(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrgemm')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrgemm
+
+!       rocsparse_csrgemm_chunked
+        function rocsparse_scsrgemm_chunked(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                panel_buffer_size, panel_buffer, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrgemm_chunked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm_chunked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            integer(c_size_t), value :: panel_buffer_size
+            type(c_ptr), value :: panel_buffer
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrgemm_chunked
+
+        function rocsparse_dcsrgemm_chunked(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                panel_buffer_size, panel_buffer, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrgemm_chunked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm_chunked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            integer(c_size_t), value :: panel_buffer_size
+            type(c_ptr), value :: panel_buffer
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrgemm_chunked
+
+        function rocsparse_ccsrgemm_chunked(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                panel_buffer_size, panel_buffer, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrgemm_chunked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm_chunked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            integer(c_size_t), value :: panel_buffer_size
+            type(c_ptr), value :: panel_buffer
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrgemm_chunked
+
+        function rocsparse_zcsrgemm_chunked(handle, trans_A, trans_B, m, n, k, alpha, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_B, nnz_B, csr_val_B, &
+                csr_row_ptr_B, csr_col_ind_B, beta, descr_D, nnz_D, csr_val_D, csr_row_ptr_D, &
+                csr_col_ind_D, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                panel_buffer_size, panel_buffer, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrgemm_chunked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm_chunked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), intent(in), value :: descr_D
+            integer(c_int), value :: nnz_D
+            type(c_ptr), intent(in), value :: csr_val_D
+            type(c_ptr), intent(in), value :: csr_row_ptr_D
+            type(c_ptr), intent(in), value :: csr_col_ind_D
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            integer(c_size_t), value :: panel_buffer_size
+            type(c_ptr), value :: panel_buffer
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrgemm_chunked
+
+!       rocsparse_csrgemm_masked_nnz
+        function rocsparse_csrgemm_masked_nnz(handle, trans_A, trans_B, m, n, &
+                k, descr_A, nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_B, &
+                nnz_B, csr_row_ptr_B, csr_col_ind_B, descr_M, nnz_M, &
+                csr_row_ptr_M, csr_col_ind_M, mask_type, descr_C, &
+                csr_row_ptr_C, nnz_C, info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_csrgemm_masked_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrgemm_masked_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            integer(c_int), value :: mask_type
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csrgemm_masked_nnz
+
+!       rocsparse_csrgemm_masked
+        function rocsparse_scsrgemm_masked(handle, trans_A, trans_B, m, n, k, &
+                alpha, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_B, nnz_B, csr_val_B, csr_row_ptr_B, &
+                csr_col_ind_B, descr_M, nnz_M, csr_row_ptr_M, csr_col_ind_M, &
+                mask_type, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, &
+                info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrgemm_masked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrgemm_masked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            integer(c_int), value :: mask_type
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrgemm_masked
+
+        function rocsparse_dcsrgemm_masked(handle, trans_A, trans_B, m, n, k, &
+                alpha, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_B, nnz_B, csr_val_B, csr_row_ptr_B, &
+                csr_col_ind_B, descr_M, nnz_M, csr_row_ptr_M, csr_col_ind_M, &
+                mask_type, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, &
+                info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrgemm_masked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrgemm_masked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            integer(c_int), value :: mask_type
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrgemm_masked
+
+        function rocsparse_ccsrgemm_masked(handle, trans_A, trans_B, m, n, k, &
+                alpha, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_B, nnz_B, csr_val_B, csr_row_ptr_B, &
+                csr_col_ind_B, descr_M, nnz_M, csr_row_ptr_M, csr_col_ind_M, &
+                mask_type, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, &
+                info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrgemm_masked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrgemm_masked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            integer(c_int), value :: mask_type
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrgemm_masked
+
+        function rocsparse_zcsrgemm_masked(handle, trans_A, trans_B, m, n, k, &
+                alpha, descr_A, nnz_A, csr_val_A, csr_row_ptr_A, &
+                csr_col_ind_A, descr_B, nnz_B, csr_val_B, csr_row_ptr_B, &
+                csr_col_ind_B, descr_M, nnz_M, csr_row_ptr_M, csr_col_ind_M, &
+                mask_type, descr_C, csr_val_C, csr_row_ptr_C, csr_col_ind_C, &
+                info_C, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrgemm_masked')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrgemm_masked
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_A
+            integer(c_int), value :: trans_B
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_B
+            integer(c_int), value :: nnz_B
+            type(c_ptr), intent(in), value :: csr_val_B
+            type(c_ptr), intent(in), value :: csr_row_ptr_B
+            type(c_ptr), intent(in), value :: csr_col_ind_B
+            type(c_ptr), intent(in), value :: descr_M
+            integer(c_int), value :: nnz_M
+            type(c_ptr), intent(in), value :: csr_row_ptr_M
+            type(c_ptr), intent(in), value :: csr_col_ind_M
+            integer(c_int), value :: mask_type
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrgemm_masked
+
+!       rocsparse_csrrap_buffer_size
+        function rocsparse_scsrrap_buffer_size(handle, trans_R, m, n, k, &
+                alpha, descr_R, nnz_R, csr_row_ptr_R, csr_col_ind_R, descr_A, &
+                nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_P, nnz_P, &
+                csr_row_ptr_P, csr_col_ind_P, info_C, buffer_size) &
+                bind(c, name = 'rocsparse_scsrrap_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrrap_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_R
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrrap_buffer_size
+
+        function rocsparse_dcsrrap_buffer_size(handle, trans_R, m, n, k, &
+                alpha, descr_R, nnz_R, csr_row_ptr_R, csr_col_ind_R, descr_A, &
+                nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_P, nnz_P, &
+                csr_row_ptr_P, csr_col_ind_P, info_C, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrrap_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrrap_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_R
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrrap_buffer_size
+
+        function rocsparse_ccsrrap_buffer_size(handle, trans_R, m, n, k, &
+                alpha, descr_R, nnz_R, csr_row_ptr_R, csr_col_ind_R, descr_A, &
+                nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_P, nnz_P, &
+                csr_row_ptr_P, csr_col_ind_P, info_C, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrrap_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrrap_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_R
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrrap_buffer_size
+
+        function rocsparse_zcsrrap_buffer_size(handle, trans_R, m, n, k, &
+                alpha, descr_R, nnz_R, csr_row_ptr_R, csr_col_ind_R, descr_A, &
+                nnz_A, csr_row_ptr_A, csr_col_ind_A, descr_P, nnz_P, &
+                csr_row_ptr_P, csr_col_ind_P, info_C, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrrap_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrrap_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_R
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), value :: info_C
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrrap_buffer_size
+
+!       rocsparse_csrrap_nnz
+        function rocsparse_csrrap_nnz(handle, trans_R, m, n, k, descr_R, &
+                nnz_R, csr_row_ptr_R, csr_col_ind_R, descr_A, nnz_A, &
+                csr_row_ptr_A, csr_col_ind_A, descr_P, nnz_P, csr_row_ptr_P, &
+                csr_col_ind_P, descr_C, csr_row_ptr_C, nnz_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_csrrap_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrrap_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_R
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_row_ptr_C
+            type(c_ptr), value :: nnz_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csrrap_nnz
+
+!       rocsparse_csrrap
+        function rocsparse_scsrrap(handle, trans_R, m, n, k, alpha, descr_R, &
+                nnz_R, csr_val_R, csr_row_ptr_R, csr_col_ind_R, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_P, &
+                nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, descr_C, &
+                csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_scsrrap')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrrap
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_R
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrrap
+
+        function rocsparse_dcsrrap(handle, trans_R, m, n, k, alpha, descr_R, &
+                nnz_R, csr_val_R, csr_row_ptr_R, csr_col_ind_R, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_P, &
+                nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, descr_C, &
+                csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrrap')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrrap
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_R
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrrap
+
+        function rocsparse_ccsrrap(handle, trans_R, m, n, k, alpha, descr_R, &
+                nnz_R, csr_val_R, csr_row_ptr_R, csr_col_ind_R, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_P, &
+                nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, descr_C, &
+                csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrrap')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrrap
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_R
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrrap
+
+        function rocsparse_zcsrrap(handle, trans_R, m, n, k, alpha, descr_R, &
+                nnz_R, csr_val_R, csr_row_ptr_R, csr_col_ind_R, descr_A, &
+                nnz_A, csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_P, &
+                nnz_P, csr_val_P, csr_row_ptr_P, csr_col_ind_P, descr_C, &
+                csr_val_C, csr_row_ptr_C, csr_col_ind_C, info_C, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrrap')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrrap
+            type(c_ptr), value :: handle
+            integer(c_int), value :: trans_R
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: descr_R
+            integer(c_int), value :: nnz_R
+            type(c_ptr), intent(in), value :: csr_val_R
+            type(c_ptr), intent(in), value :: csr_row_ptr_R
+            type(c_ptr), intent(in), value :: csr_col_ind_R
+            type(c_ptr), intent(in), value :: descr_A
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_P
+            integer(c_int), value :: nnz_P
+            type(c_ptr), intent(in), value :: csr_val_P
+            type(c_ptr), intent(in), value :: csr_row_ptr_P
+            type(c_ptr), intent(in), value :: csr_col_ind_P
+            type(c_ptr), intent(in), value :: descr_C
+            type(c_ptr), value :: csr_val_C
+            type(c_ptr), intent(in), value :: csr_row_ptr_C
+            type(c_ptr), value :: csr_col_ind_C
+            type(c_ptr), intent(in), value :: info_C
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrrap
+
+! ===========================================================================
+!   preconditioner SPARSE
+! ===========================================================================
+
+!       rocsparse_bsric0_zero_pivot
+        function rocsparse_bsric0_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_bsric0_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_bsric0_zero_pivot
+
+!       rocsparse_bsric0_buffer_size
+        function rocsparse_sbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_sbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sbsric0_buffer_size
+
+        function rocsparse_dbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_dbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dbsric0_buffer_size
+
+        function rocsparse_cbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_cbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cbsric0_buffer_size
+
+        function rocsparse_zbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_zbsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zbsric0_buffer_size
+
+!       rocsparse_bsric0_analysis
+        function rocsparse_sbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsric0_analysis
+
+        function rocsparse_dbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsric0_analysis
+
+        function rocsparse_cbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsric0_analysis
+
+        function rocsparse_zbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsric0_analysis
+
+!       rocsparse_bsric0_clear
+        function rocsparse_bsric0_clear(handle, info) &
+                bind(c, name = 'rocsparse_bsric0_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_bsric0_clear
+
+!       rocsparse_bsric0
+        function rocsparse_sbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsric0
+
+        function rocsparse_dbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsric0
+
+        function rocsparse_cbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsric0
+
+        function rocsparse_zbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsric0
+
+!       rocsparse_bsrilu0_zero_pivot
+        function rocsparse_bsrilu0_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_bsrilu0_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_bsrilu0_zero_pivot
+
+!       rocsparse_bsrilu0_buffer_size
+        function rocsparse_sbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_sbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sbsrilu0_buffer_size
+
+        function rocsparse_dbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_dbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dbsrilu0_buffer_size
+
+        function rocsparse_cbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_cbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cbsrilu0_buffer_size
+
+        function rocsparse_zbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
+                bind(c, name = 'rocsparse_zbsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zbsrilu0_buffer_size
+
+!       rocsparse_bsrilu0_analysis
+        function rocsparse_sbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrilu0_analysis
+
+        function rocsparse_dbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsrilu0_analysis
+
+        function rocsparse_cbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsrilu0_analysis
+
+        function rocsparse_zbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsrilu0_analysis
+
+!       rocsparse_bsrilu0_clear
+        function rocsparse_bsrilu0_clear(handle, info) &
+                bind(c, name = 'rocsparse_bsrilu0_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_bsrilu0_clear
+
+!       rocsparse_bsrilu0
+        function rocsparse_sbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrilu0
+
+        function rocsparse_dbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsrilu0
+
+        function rocsparse_cbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsrilu0
+
+        function rocsparse_zbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
+                bsr_col_ind, block_dim, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsrilu0
+
+!       rocsparse_bsrjacobi_zero_pivot
+        function rocsparse_bsrjacobi_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_bsrjacobi_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_bsrjacobi_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_bsrjacobi_zero_pivot
+
+!       rocsparse_bsrjacobi_buffer_size
+        function rocsparse_sbsrjacobi_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, buffer_size) &
+                bind(c, name = 'rocsparse_sbsrjacobi_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrjacobi_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sbsrjacobi_buffer_size
+
+        function rocsparse_dbsrjacobi_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, buffer_size) &
+                bind(c, name = 'rocsparse_dbsrjacobi_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrjacobi_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dbsrjacobi_buffer_size
+
+        function rocsparse_cbsrjacobi_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, buffer_size) &
+                bind(c, name = 'rocsparse_cbsrjacobi_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrjacobi_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cbsrjacobi_buffer_size
+
+        function rocsparse_zbsrjacobi_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, buffer_size) &
+                bind(c, name = 'rocsparse_zbsrjacobi_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrjacobi_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zbsrjacobi_buffer_size
+
+!       rocsparse_bsrjacobi_setup
+        function rocsparse_sbsrjacobi_setup(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, bsr_diag_inv, temp_buffer) &
+                bind(c, name = 'rocsparse_sbsrjacobi_setup')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrjacobi_setup
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: bsr_diag_inv
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sbsrjacobi_setup
+
+        function rocsparse_dbsrjacobi_setup(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, bsr_diag_inv, temp_buffer) &
+                bind(c, name = 'rocsparse_dbsrjacobi_setup')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrjacobi_setup
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: bsr_diag_inv
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dbsrjacobi_setup
+
+        function rocsparse_cbsrjacobi_setup(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, bsr_diag_inv, temp_buffer) &
+                bind(c, name = 'rocsparse_cbsrjacobi_setup')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrjacobi_setup
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: bsr_diag_inv
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_cbsrjacobi_setup
+
+        function rocsparse_zbsrjacobi_setup(handle, dir, mb, nnzb, descr, bsr_val, &
+                bsr_row_ptr, bsr_col_ind, block_dim, info, bsr_diag_inv, temp_buffer) &
+                bind(c, name = 'rocsparse_zbsrjacobi_setup')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrjacobi_setup
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: nnzb
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: bsr_val
+            type(c_ptr), intent(in), value :: bsr_row_ptr
+            type(c_ptr), intent(in), value :: bsr_col_ind
+            integer(c_int), value :: block_dim
+            type(c_ptr), value :: info
+            type(c_ptr), value :: bsr_diag_inv
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zbsrjacobi_setup
+
+!       rocsparse_bsrjacobi_apply
+        function rocsparse_sbsrjacobi_apply(handle, dir, mb, block_dim, alpha, &
+                bsr_diag_inv, x, beta, y) &
+                bind(c, name = 'rocsparse_sbsrjacobi_apply')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrjacobi_apply
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: bsr_diag_inv
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_sbsrjacobi_apply
+
+        function rocsparse_dbsrjacobi_apply(handle, dir, mb, block_dim, alpha, &
+                bsr_diag_inv, x, beta, y) &
+                bind(c, name = 'rocsparse_dbsrjacobi_apply')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrjacobi_apply
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: bsr_diag_inv
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_dbsrjacobi_apply
+
+        function rocsparse_cbsrjacobi_apply(handle, dir, mb, block_dim, alpha, &
+                bsr_diag_inv, x, beta, y) &
+                bind(c, name = 'rocsparse_cbsrjacobi_apply')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrjacobi_apply
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: bsr_diag_inv
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_cbsrjacobi_apply
+
+        function rocsparse_zbsrjacobi_apply(handle, dir, mb, block_dim, alpha, &
+                bsr_diag_inv, x, beta, y) &
+                bind(c, name = 'rocsparse_zbsrjacobi_apply')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrjacobi_apply
+            type(c_ptr), value :: handle
+            integer(c_int), value :: dir
+            integer(c_int), value :: mb
+            integer(c_int), value :: block_dim
+            type(c_ptr), intent(in), value :: alpha
+            type(c_ptr), intent(in), value :: bsr_diag_inv
+            type(c_ptr), intent(in), value :: x
+            type(c_ptr), intent(in), value :: beta
+            type(c_ptr), value :: y
+        end function rocsparse_zbsrjacobi_apply
+
+!       rocsparse_csric0_zero_pivot
+        function rocsparse_csric0_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csric0_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csric0_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csric0_zero_pivot
+
+!       rocsparse_csric0_buffer_size
+        function rocsparse_scsric0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_scsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsric0_buffer_size
+
+        function rocsparse_dcsric0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_dcsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsric0_buffer_size
+
+        function rocsparse_ccsric0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_ccsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsric0_buffer_size
+
+        function rocsparse_zcsric0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_zcsric0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsric0_buffer_size
+
+!       rocsparse_csric0_analysis
+        function rocsparse_scsric0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_scsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsric0_analysis
+
+        function rocsparse_dcsric0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsric0_analysis
+
+        function rocsparse_ccsric0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsric0_analysis
+
+        function rocsparse_zcsric0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsric0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsric0_analysis
+
+!       rocsparse_csric0_clear
+        function rocsparse_csric0_clear(handle, info) &
+                bind(c, name = 'rocsparse_csric0_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csric0_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csric0_clear
+
+!       rocsparse_csric0
+        function rocsparse_scsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_scsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsric0
+
+        function rocsparse_dcsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsric0
+
+        function rocsparse_ccsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsric0
+
+        function rocsparse_zcsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsric0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsric0
+
+!       rocsparse_csrilu0_zero_pivot
+        function rocsparse_csrilu0_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csrilu0_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrilu0_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csrilu0_zero_pivot
+
+!       rocsparse_csrilu0_buffer_size
+        function rocsparse_scsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_scsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrilu0_buffer_size
+
+        function rocsparse_dcsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrilu0_buffer_size
+
+        function rocsparse_ccsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrilu0_buffer_size
+
+        function rocsparse_zcsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrilu0_buffer_size
+
+!       rocsparse_csrilu0_analysis
+        function rocsparse_scsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrilu0_analysis
+
+        function rocsparse_dcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrilu0_analysis
+
+        function rocsparse_ccsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrilu0_analysis
+
+        function rocsparse_zcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrilu0_analysis')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0_analysis
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: analysis
+            integer(c_int), value :: solve
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrilu0_analysis
+
+!       rocsparse_csrilu0_clear
+        function rocsparse_csrilu0_clear(handle, info) &
+                bind(c, name = 'rocsparse_csrilu0_clear')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrilu0_clear
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+        end function rocsparse_csrilu0_clear
+
+!       rocsparse_csrilu0
+        function rocsparse_scsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrilu0
+
+        function rocsparse_dcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrilu0
+
+        function rocsparse_ccsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrilu0
+
+        function rocsparse_zcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrilu0
+
+!       rocsparse_csriluk_nnz
+        function rocsparse_csriluk_nnz(handle, m, nnz, descr, csr_row_ptr, &
+                csr_col_ind, level_of_fill, info, csr_row_ptr_lu, nnz_lu) &
+                bind(c, name = 'rocsparse_csriluk_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csriluk_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: level_of_fill
+            type(c_ptr), value :: info
+            type(c_ptr), value :: csr_row_ptr_lu
+            type(c_ptr), value :: nnz_lu
+        end function rocsparse_csriluk_nnz
+
+!       rocsparse_csriluk_symbolic
+        function rocsparse_csriluk_symbolic(handle, m, nnz, descr, csr_row_ptr, &
+                csr_col_ind, level_of_fill, info, csr_col_ind_lu) &
+                bind(c, name = 'rocsparse_csriluk_symbolic')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csriluk_symbolic
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: level_of_fill
+            type(c_ptr), value :: info
+            type(c_ptr), value :: csr_col_ind_lu
+        end function rocsparse_csriluk_symbolic
+
+!       rocsparse_csriluk
+        function rocsparse_scsriluk(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, nnz_lu, csr_val_lu, csr_row_ptr_lu, csr_col_ind_lu, &
+                info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_scsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: nnz_lu
+            type(c_ptr), value :: csr_val_lu
+            type(c_ptr), intent(in), value :: csr_row_ptr_lu
+            type(c_ptr), intent(in), value :: csr_col_ind_lu
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsriluk
+
+        function rocsparse_dcsriluk(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, nnz_lu, csr_val_lu, csr_row_ptr_lu, csr_col_ind_lu, &
+                info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: nnz_lu
+            type(c_ptr), value :: csr_val_lu
+            type(c_ptr), intent(in), value :: csr_row_ptr_lu
+            type(c_ptr), intent(in), value :: csr_col_ind_lu
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsriluk
+
+        function rocsparse_ccsriluk(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, nnz_lu, csr_val_lu, csr_row_ptr_lu, csr_col_ind_lu, &
+                info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: nnz_lu
+            type(c_ptr), value :: csr_val_lu
+            type(c_ptr), intent(in), value :: csr_row_ptr_lu
+            type(c_ptr), intent(in), value :: csr_col_ind_lu
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsriluk
+
+        function rocsparse_zcsriluk(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, nnz_lu, csr_val_lu, csr_row_ptr_lu, csr_col_ind_lu, &
+                info, policy, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsriluk')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsriluk
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: nnz_lu
+            type(c_ptr), value :: csr_val_lu
+            type(c_ptr), intent(in), value :: csr_row_ptr_lu
+            type(c_ptr), intent(in), value :: csr_col_ind_lu
+            type(c_ptr), value :: info
+            integer(c_int), value :: policy
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsriluk
+
+!       rocsparse_csritilu0_buffer_size
+        function rocsparse_scsritilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_scsritilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsritilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsritilu0_buffer_size
+
+        function rocsparse_dcsritilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_dcsritilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsritilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsritilu0_buffer_size
+
+        function rocsparse_ccsritilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_ccsritilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsritilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsritilu0_buffer_size
+
+        function rocsparse_zcsritilu0_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_zcsritilu0_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsritilu0_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsritilu0_buffer_size
+
+!       rocsparse_csritilu0
+        function rocsparse_scsritilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, nsweeps, history, temp_buffer) &
+                bind(c, name = 'rocsparse_scsritilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsritilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            type(c_ptr), value :: history
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsritilu0
+
+        function rocsparse_dcsritilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, nsweeps, history, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsritilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsritilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            type(c_ptr), value :: history
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsritilu0
+
+        function rocsparse_ccsritilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, nsweeps, history, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsritilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsritilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            type(c_ptr), value :: history
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsritilu0
+
+        function rocsparse_zcsritilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, nsweeps, history, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsritilu0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsritilu0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            type(c_ptr), value :: history
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsritilu0
+
+!       rocsparse_csritic0
+        function rocsparse_scsritic0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, nsweeps, history, temp_buffer) &
+                bind(c, name = 'rocsparse_scsritic0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsritic0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            type(c_ptr), value :: history
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsritic0
+
+        function rocsparse_dcsritic0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, nsweeps, history, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsritic0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsritic0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            type(c_ptr), value :: history
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsritic0
+
+        function rocsparse_ccsritic0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, nsweeps, history, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsritic0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsritic0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            type(c_ptr), value :: history
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsritic0
+
+        function rocsparse_zcsritic0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, nsweeps, history, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsritic0')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsritic0
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            integer(c_int), value :: nsweeps
+            type(c_ptr), value :: history
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsritic0
+
+!       rocsparse_csrilut_nnz
+        function rocsparse_csrilut_nnz(handle, m, max_fill, nnz_lu) &
+                bind(c, name = 'rocsparse_csrilut_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrilut_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: nnz_lu
+        end function rocsparse_csrilut_nnz
+
+!       rocsparse_csrict_nnz
+        function rocsparse_csrict_nnz(handle, m, max_fill, nnz_l) &
+                bind(c, name = 'rocsparse_csrict_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrict_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: nnz_l
+        end function rocsparse_csrict_nnz
+
+!       rocsparse_csrilut_buffer_size
+        function rocsparse_scsrilut_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, max_fill, buffer_size) &
+                bind(c, name = 'rocsparse_scsrilut_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilut_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrilut_buffer_size
+
+        function rocsparse_dcsrilut_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, max_fill, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrilut_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilut_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrilut_buffer_size
+
+        function rocsparse_ccsrilut_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, max_fill, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrilut_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilut_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrilut_buffer_size
+
+        function rocsparse_zcsrilut_buffer_size(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, max_fill, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrilut_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilut_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrilut_buffer_size
+
+!       rocsparse_csrilut
+        function rocsparse_scsrilut(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, tol, max_fill, csr_row_ptr_lu, csr_col_ind_lu, &
+                csr_val_lu, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrilut')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilut
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            real(c_float), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: csr_row_ptr_lu
+            type(c_ptr), value :: csr_col_ind_lu
+            type(c_ptr), value :: csr_val_lu
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrilut
+
+        function rocsparse_dcsrilut(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, tol, max_fill, csr_row_ptr_lu, csr_col_ind_lu, &
+                csr_val_lu, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrilut')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilut
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            real(c_double), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: csr_row_ptr_lu
+            type(c_ptr), value :: csr_col_ind_lu
+            type(c_ptr), value :: csr_val_lu
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrilut
+
+        function rocsparse_ccsrilut(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, tol, max_fill, csr_row_ptr_lu, csr_col_ind_lu, &
+                csr_val_lu, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrilut')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilut
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            real(c_float), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: csr_row_ptr_lu
+            type(c_ptr), value :: csr_col_ind_lu
+            type(c_ptr), value :: csr_val_lu
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrilut
+
+        function rocsparse_zcsrilut(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, tol, max_fill, csr_row_ptr_lu, csr_col_ind_lu, &
+                csr_val_lu, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrilut')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilut
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            real(c_double), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: csr_row_ptr_lu
+            type(c_ptr), value :: csr_col_ind_lu
+            type(c_ptr), value :: csr_val_lu
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrilut
+
+!       rocsparse_csrict
+        function rocsparse_scsrict(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, tol, max_fill, csr_row_ptr_l, csr_col_ind_l, &
+                csr_val_l, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrict')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrict
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            real(c_float), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: csr_row_ptr_l
+            type(c_ptr), value :: csr_col_ind_l
+            type(c_ptr), value :: csr_val_l
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrict
+
+        function rocsparse_dcsrict(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, tol, max_fill, csr_row_ptr_l, csr_col_ind_l, &
+                csr_val_l, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrict')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrict
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            real(c_double), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: csr_row_ptr_l
+            type(c_ptr), value :: csr_col_ind_l
+            type(c_ptr), value :: csr_val_l
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrict
+
+        function rocsparse_ccsrict(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, tol, max_fill, csr_row_ptr_l, csr_col_ind_l, &
+                csr_val_l, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrict')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrict
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            real(c_float), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: csr_row_ptr_l
+            type(c_ptr), value :: csr_col_ind_l
+            type(c_ptr), value :: csr_val_l
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrict
+
+        function rocsparse_zcsrict(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, info, tol, max_fill, csr_row_ptr_l, csr_col_ind_l, &
+                csr_val_l, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrict')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrict
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: info
+            real(c_double), value :: tol
+            integer(c_int), value :: max_fill
+            type(c_ptr), value :: csr_row_ptr_l
+            type(c_ptr), value :: csr_col_ind_l
+            type(c_ptr), value :: csr_val_l
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrict
+
+!       rocsparse_csrfsai_zero_pivot
+        function rocsparse_csrfsai_zero_pivot(handle, info, position) &
+                bind(c, name = 'rocsparse_csrfsai_zero_pivot')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrfsai_zero_pivot
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: info
+            type(c_ptr), value :: position
+        end function rocsparse_csrfsai_zero_pivot
+
+!       rocsparse_csrfsai_nnz
+        function rocsparse_csrfsai_nnz(handle, m, nnz_S, descr_S, &
+                csr_row_ptr_S, csr_col_ind_S, descr_G, csr_row_ptr_G, nnz_G) &
+                bind(c, name = 'rocsparse_csrfsai_nnz')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrfsai_nnz
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz_S
+            type(c_ptr), intent(in), value :: descr_S
+            type(c_ptr), intent(in), value :: csr_row_ptr_S
+            type(c_ptr), intent(in), value :: csr_col_ind_S
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), value :: csr_row_ptr_G
+            type(c_ptr), value :: nnz_G
+        end function rocsparse_csrfsai_nnz
+
+!       rocsparse_csrfsai_buffer_size
+        function rocsparse_scsrfsai_buffer_size(handle, m, nnz_A, descr_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_G, &
+                csr_row_ptr_G, buffer_size) &
+                bind(c, name = 'rocsparse_scsrfsai_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrfsai_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_scsrfsai_buffer_size
+
+        function rocsparse_dcsrfsai_buffer_size(handle, m, nnz_A, descr_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_G, &
+                csr_row_ptr_G, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrfsai_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrfsai_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrfsai_buffer_size
+
+        function rocsparse_ccsrfsai_buffer_size(handle, m, nnz_A, descr_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_G, &
+                csr_row_ptr_G, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrfsai_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrfsai_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrfsai_buffer_size
 
-! ===========================================================================
-!   preconditioner SPARSE
-! ===========================================================================
+        function rocsparse_zcsrfsai_buffer_size(handle, m, nnz_A, descr_A, &
+                csr_val_A, csr_row_ptr_A, csr_col_ind_A, descr_G, &
+                csr_row_ptr_G, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrfsai_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrfsai_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrfsai_buffer_size
 
-!       rocsparse_bsric0_zero_pivot
-        function rocsparse_bsric0_zero_pivot(handle, info, position) &
-                bind(c, name = 'rocsparse_bsric0_zero_pivot')
+!       rocsparse_csrfsai
+        function rocsparse_scsrfsai(handle, m, nnz_A, descr_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, nnz_S, descr_S, csr_row_ptr_S, &
+                csr_col_ind_S, info, descr_G, csr_val_G, csr_row_ptr_G, &
+                csr_col_ind_G, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrfsai')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_zero_pivot
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrfsai
             type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnz_S
+            type(c_ptr), intent(in), value :: descr_S
+            type(c_ptr), intent(in), value :: csr_row_ptr_S
+            type(c_ptr), intent(in), value :: csr_col_ind_S
             type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_bsric0_zero_pivot
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), value :: csr_val_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: csr_col_ind_G
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrfsai
 
-!       rocsparse_bsric0_buffer_size
-        function rocsparse_sbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_sbsric0_buffer_size')
+        function rocsparse_dcsrfsai(handle, m, nnz_A, descr_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, nnz_S, descr_S, csr_row_ptr_S, &
+                csr_col_ind_S, info, descr_G, csr_val_G, csr_row_ptr_G, &
+                csr_col_ind_G, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrfsai')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrfsai
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnz_S
+            type(c_ptr), intent(in), value :: descr_S
+            type(c_ptr), intent(in), value :: csr_row_ptr_S
+            type(c_ptr), intent(in), value :: csr_col_ind_S
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_sbsric0_buffer_size
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), value :: csr_val_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: csr_col_ind_G
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrfsai
 
-        function rocsparse_dbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_dbsric0_buffer_size')
+        function rocsparse_ccsrfsai(handle, m, nnz_A, descr_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, nnz_S, descr_S, csr_row_ptr_S, &
+                csr_col_ind_S, info, descr_G, csr_val_G, csr_row_ptr_G, &
+                csr_col_ind_G, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrfsai')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrfsai
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnz_S
+            type(c_ptr), intent(in), value :: descr_S
+            type(c_ptr), intent(in), value :: csr_row_ptr_S
+            type(c_ptr), intent(in), value :: csr_col_ind_S
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_dbsric0_buffer_size
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), value :: csr_val_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: csr_col_ind_G
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrfsai
 
-        function rocsparse_cbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_cbsric0_buffer_size')
+        function rocsparse_zcsrfsai(handle, m, nnz_A, descr_A, csr_val_A, &
+                csr_row_ptr_A, csr_col_ind_A, nnz_S, descr_S, csr_row_ptr_S, &
+                csr_col_ind_S, info, descr_G, csr_val_G, csr_row_ptr_G, &
+                csr_col_ind_G, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrfsai')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrfsai
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz_A
+            type(c_ptr), intent(in), value :: descr_A
+            type(c_ptr), intent(in), value :: csr_val_A
+            type(c_ptr), intent(in), value :: csr_row_ptr_A
+            type(c_ptr), intent(in), value :: csr_col_ind_A
+            integer(c_int), value :: nnz_S
+            type(c_ptr), intent(in), value :: descr_S
+            type(c_ptr), intent(in), value :: csr_row_ptr_S
+            type(c_ptr), intent(in), value :: csr_col_ind_S
             type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_cbsric0_buffer_size
+            type(c_ptr), intent(in), value :: descr_G
+            type(c_ptr), value :: csr_val_G
+            type(c_ptr), intent(in), value :: csr_row_ptr_G
+            type(c_ptr), value :: csr_col_ind_G
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrfsai
 
-        function rocsparse_zbsric0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_zbsric0_buffer_size')
+!       rocsparse_csrcheb_buffer_size
+        function rocsparse_scsrcheb_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_scsrcheb_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrcheb_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: buffer_size
-        end function rocsparse_zbsric0_buffer_size
+        end function rocsparse_scsrcheb_buffer_size
 
-!       rocsparse_bsric0_analysis
-        function rocsparse_sbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsric0_analysis')
+        function rocsparse_dcsrcheb_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_dcsrcheb_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrcheb_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsric0_analysis
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dcsrcheb_buffer_size
 
-        function rocsparse_dbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsric0_analysis')
+        function rocsparse_ccsrcheb_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_ccsrcheb_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrcheb_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsric0_analysis
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_ccsrcheb_buffer_size
 
-        function rocsparse_cbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_cbsric0_analysis')
+        function rocsparse_zcsrcheb_buffer_size(handle, m, nnz, descr, &
+                csr_val, csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_zcsrcheb_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrcheb_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsric0_analysis
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zcsrcheb_buffer_size
 
-        function rocsparse_zbsric0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_zbsric0_analysis')
+!       rocsparse_csrcheb_estimate
+        function rocsparse_scsrcheb_estimate(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, iters, lambda_max, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrcheb_estimate')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrcheb_estimate
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: iters
+            type(c_ptr), value :: lambda_max
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsric0_analysis
+        end function rocsparse_scsrcheb_estimate
 
-!       rocsparse_bsric0_clear
-        function rocsparse_bsric0_clear(handle, info) &
-                bind(c, name = 'rocsparse_bsric0_clear')
+        function rocsparse_dcsrcheb_estimate(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, iters, lambda_max, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrcheb_estimate')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsric0_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrcheb_estimate
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-        end function rocsparse_bsric0_clear
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: iters
+            type(c_ptr), value :: lambda_max
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrcheb_estimate
 
-!       rocsparse_bsric0
-        function rocsparse_sbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsric0')
+        function rocsparse_ccsrcheb_estimate(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, iters, lambda_max, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrcheb_estimate')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrcheb_estimate
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: iters
+            type(c_ptr), value :: lambda_max
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsric0
+        end function rocsparse_ccsrcheb_estimate
 
-        function rocsparse_dbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsric0')
+        function rocsparse_zcsrcheb_estimate(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, iters, lambda_max, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrcheb_estimate')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrcheb_estimate
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: iters
+            type(c_ptr), value :: lambda_max
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsric0
+        end function rocsparse_zcsrcheb_estimate
 
-        function rocsparse_cbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_cbsric0')
+!       rocsparse_csrcheb
+        function rocsparse_scsrcheb(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, degree, lambda_min, lambda_max, b, &
+                x, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrcheb')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrcheb
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: degree
+            real(c_float), value :: lambda_min
+            real(c_float), value :: lambda_max
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsric0
+        end function rocsparse_scsrcheb
 
-        function rocsparse_zbsric0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_zbsric0')
+        function rocsparse_dcsrcheb(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, degree, lambda_min, lambda_max, b, &
+                x, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrcheb')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrcheb
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: degree
+            real(c_double), value :: lambda_min
+            real(c_double), value :: lambda_max
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsric0
+        end function rocsparse_dcsrcheb
 
-!       rocsparse_bsrilu0_zero_pivot
-        function rocsparse_bsrilu0_zero_pivot(handle, info, position) &
-                bind(c, name = 'rocsparse_bsrilu0_zero_pivot')
+        function rocsparse_ccsrcheb(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, degree, lambda_min, lambda_max, b, &
+                x, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrcheb')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_zero_pivot
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrcheb
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_bsrilu0_zero_pivot
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: degree
+            real(c_float), value :: lambda_min
+            real(c_float), value :: lambda_max
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrcheb
 
-!       rocsparse_bsrilu0_buffer_size
-        function rocsparse_sbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_sbsrilu0_buffer_size')
+        function rocsparse_zcsrcheb(handle, m, nnz, descr, csr_val, &
+                csr_row_ptr, csr_col_ind, degree, lambda_min, lambda_max, b, &
+                x, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrcheb')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrcheb
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_sbsrilu0_buffer_size
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            integer(c_int), value :: degree
+            real(c_double), value :: lambda_min
+            real(c_double), value :: lambda_max
+            type(c_ptr), intent(in), value :: b
+            type(c_ptr), value :: x
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrcheb
 
-        function rocsparse_dbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_dbsrilu0_buffer_size')
+!       rocsparse_csrcolor_buffer_size
+        function rocsparse_csrcolor_buffer_size(handle, m, nnz, descr, csr_row_ptr, &
+                csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_csrcolor_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrcolor_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: buffer_size
-        end function rocsparse_dbsrilu0_buffer_size
+        end function rocsparse_csrcolor_buffer_size
 
-        function rocsparse_cbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_cbsrilu0_buffer_size')
+!       rocsparse_csrcolor
+        function rocsparse_csrcolor(handle, m, nnz, descr, csr_row_ptr, &
+                csr_col_ind, ncolors, coloring, reordering, temp_buffer) &
+                bind(c, name = 'rocsparse_csrcolor')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrcolor
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_cbsrilu0_buffer_size
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: ncolors
+            type(c_ptr), value :: coloring
+            type(c_ptr), value :: reordering
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_csrcolor
 
-        function rocsparse_zbsrilu0_buffer_size(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, buffer_size) &
-                bind(c, name = 'rocsparse_zbsrilu0_buffer_size')
+!       rocsparse_csrrcm_buffer_size
+        function rocsparse_csrrcm_buffer_size(handle, m, nnz, descr, &
+                csr_row_ptr, csr_col_ind, buffer_size) &
+                bind(c, name = 'rocsparse_csrrcm_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrrcm_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
             type(c_ptr), value :: buffer_size
-        end function rocsparse_zbsrilu0_buffer_size
+        end function rocsparse_csrrcm_buffer_size
 
-!       rocsparse_bsrilu0_analysis
-        function rocsparse_sbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsrilu0_analysis')
+!       rocsparse_csrrcm
+        function rocsparse_csrrcm(handle, m, nnz, descr, csr_row_ptr, &
+                csr_col_ind, perm, temp_buffer) &
+                bind(c, name = 'rocsparse_csrrcm')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrrcm
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: perm
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsrilu0_analysis
+        end function rocsparse_csrrcm
 
-        function rocsparse_dbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsrilu0_analysis')
+!       rocsparse_csrbandwidth
+        function rocsparse_csrbandwidth(handle, m, nnz, descr, csr_row_ptr, &
+                csr_col_ind, bandwidth, profile) &
+                bind(c, name = 'rocsparse_csrbandwidth')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrbandwidth
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
             type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsrilu0_analysis
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), value :: bandwidth
+            type(c_ptr), value :: profile
+        end function rocsparse_csrbandwidth
 
-        function rocsparse_cbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_cbsrilu0_analysis')
+!       rocsparse_gtsv_buffer_size
+        function rocsparse_sgtsv_buffer_size(handle, m, n, dl, d, du, B, ldb, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_sgtsv_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgtsv_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsrilu0_analysis
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sgtsv_buffer_size
 
-        function rocsparse_zbsrilu0_analysis(handle, dir, mb, nnzb, descr, bsr_val, &
-                bsr_row_ptr, bsr_col_ind, block_dim, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_zbsrilu0_analysis')
+        function rocsparse_dgtsv_buffer_size(handle, m, n, dl, d, du, B, ldb, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_dgtsv_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgtsv_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsrilu0_analysis
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dgtsv_buffer_size
 
-!       rocsparse_bsrilu0_clear
-        function rocsparse_bsrilu0_clear(handle, info) &
-                bind(c, name = 'rocsparse_bsrilu0_clear')
+        function rocsparse_cgtsv_buffer_size(handle, m, n, dl, d, du, B, ldb, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_cgtsv_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_bsrilu0_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgtsv_buffer_size
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-        end function rocsparse_bsrilu0_clear
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cgtsv_buffer_size
 
-!       rocsparse_bsrilu0
-        function rocsparse_sbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_sbsrilu0')
+        function rocsparse_zgtsv_buffer_size(handle, m, n, dl, d, du, B, ldb, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_zgtsv_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_sbsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgtsv_buffer_size
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_sbsrilu0
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zgtsv_buffer_size
 
-        function rocsparse_dbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dbsrilu0')
+!       rocsparse_gtsv
+        function rocsparse_sgtsv(handle, m, n, dl, d, du, B, ldb, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_sgtsv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dbsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgtsv
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dbsrilu0
+        end function rocsparse_sgtsv
 
-        function rocsparse_cbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_cbsrilu0')
+        function rocsparse_dgtsv(handle, m, n, dl, d, du, B, ldb, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_dgtsv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_cbsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgtsv
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_cbsrilu0
+        end function rocsparse_dgtsv
 
-        function rocsparse_zbsrilu0(handle, dir, mb, nnzb, descr, bsr_val, bsr_row_ptr, &
-                bsr_col_ind, block_dim, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_zbsrilu0')
+        function rocsparse_cgtsv(handle, m, n, dl, d, du, B, ldb, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_cgtsv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zbsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgtsv
             type(c_ptr), value :: handle
-            integer(c_int), value :: dir
-            integer(c_int), value :: mb
-            integer(c_int), value :: nnzb
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: bsr_val
-            type(c_ptr), intent(in), value :: bsr_row_ptr
-            type(c_ptr), intent(in), value :: bsr_col_ind
-            integer(c_int), value :: block_dim
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zbsrilu0
+        end function rocsparse_cgtsv
 
-!       rocsparse_csric0_zero_pivot
-        function rocsparse_csric0_zero_pivot(handle, info, position) &
-                bind(c, name = 'rocsparse_csric0_zero_pivot')
+        function rocsparse_zgtsv(handle, m, n, dl, d, du, B, ldb, &
+                temp_buffer) &
+                bind(c, name = 'rocsparse_zgtsv')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csric0_zero_pivot
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgtsv
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_csric0_zero_pivot
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zgtsv
 
-!       rocsparse_csric0_buffer_size
-        function rocsparse_scsric0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_scsric0_buffer_size')
+!       rocsparse_gtsv_no_pivot_strided_batch_buffer_size
+        function rocsparse_sgtsv_no_pivot_strided_batch_buffer_size(handle, m, &
+                dl, d, du, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_sgtsv_no_pivot_strided_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgtsv_no_pivot_strided_batch_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: buffer_size
-        end function rocsparse_scsric0_buffer_size
+        end function rocsparse_sgtsv_no_pivot_strided_batch_buffer_size
 
-        function rocsparse_dcsric0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_dcsric0_buffer_size')
+        function rocsparse_dgtsv_no_pivot_strided_batch_buffer_size(handle, m, &
+                dl, d, du, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_dgtsv_no_pivot_strided_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgtsv_no_pivot_strided_batch_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsric0_buffer_size
+        end function rocsparse_dgtsv_no_pivot_strided_batch_buffer_size
 
-        function rocsparse_ccsric0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_ccsric0_buffer_size')
+        function rocsparse_cgtsv_no_pivot_strided_batch_buffer_size(handle, m, &
+                dl, d, du, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_cgtsv_no_pivot_strided_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgtsv_no_pivot_strided_batch_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsric0_buffer_size
+        end function rocsparse_cgtsv_no_pivot_strided_batch_buffer_size
 
-        function rocsparse_zcsric0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_zcsric0_buffer_size')
+        function rocsparse_zgtsv_no_pivot_strided_batch_buffer_size(handle, m, &
+                dl, d, du, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_zgtsv_no_pivot_strided_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgtsv_no_pivot_strided_batch_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsric0_buffer_size
+        end function rocsparse_zgtsv_no_pivot_strided_batch_buffer_size
 
-!       rocsparse_csric0_analysis
-        function rocsparse_scsric0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_scsric0_analysis')
+!       rocsparse_gtsv_no_pivot_strided_batch
+        function rocsparse_sgtsv_no_pivot_strided_batch(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_sgtsv_no_pivot_strided_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgtsv_no_pivot_strided_batch
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsric0_analysis
+        end function rocsparse_sgtsv_no_pivot_strided_batch
 
-        function rocsparse_dcsric0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsric0_analysis')
+        function rocsparse_dgtsv_no_pivot_strided_batch(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_dgtsv_no_pivot_strided_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgtsv_no_pivot_strided_batch
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsric0_analysis
+        end function rocsparse_dgtsv_no_pivot_strided_batch
 
-        function rocsparse_ccsric0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsric0_analysis')
+        function rocsparse_cgtsv_no_pivot_strided_batch(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_cgtsv_no_pivot_strided_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgtsv_no_pivot_strided_batch
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsric0_analysis
+        end function rocsparse_cgtsv_no_pivot_strided_batch
 
-        function rocsparse_zcsric0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsric0_analysis')
+        function rocsparse_zgtsv_no_pivot_strided_batch(handle, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_zgtsv_no_pivot_strided_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgtsv_no_pivot_strided_batch
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsric0_analysis
+        end function rocsparse_zgtsv_no_pivot_strided_batch
 
-!       rocsparse_csric0_clear
-        function rocsparse_csric0_clear(handle, info) &
-                bind(c, name = 'rocsparse_csric0_clear')
+!       rocsparse_gtsv_interleaved_batch_buffer_size
+        function rocsparse_sgtsv_interleaved_batch_buffer_size(handle, alg, m, &
+                dl, d, du, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_sgtsv_interleaved_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csric0_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgtsv_interleaved_batch_buffer_size
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-        end function rocsparse_csric0_clear
+            integer(kind(rocsparse_gtsv_interleaved_alg_default)), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sgtsv_interleaved_batch_buffer_size
 
-!       rocsparse_csric0
-        function rocsparse_scsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_scsric0')
+        function rocsparse_dgtsv_interleaved_batch_buffer_size(handle, alg, m, &
+                dl, d, du, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_dgtsv_interleaved_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgtsv_interleaved_batch_buffer_size
             type(c_ptr), value :: handle
+            integer(kind(rocsparse_gtsv_interleaved_alg_default)), value :: alg
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsric0
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dgtsv_interleaved_batch_buffer_size
 
-        function rocsparse_dcsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsric0')
+        function rocsparse_cgtsv_interleaved_batch_buffer_size(handle, alg, m, &
+                dl, d, du, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_cgtsv_interleaved_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgtsv_interleaved_batch_buffer_size
             type(c_ptr), value :: handle
+            integer(kind(rocsparse_gtsv_interleaved_alg_default)), value :: alg
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cgtsv_interleaved_batch_buffer_size
+
+        function rocsparse_zgtsv_interleaved_batch_buffer_size(handle, alg, m, &
+                dl, d, du, x, batch_count, batch_stride, buffer_size) &
+                bind(c, name = 'rocsparse_zgtsv_interleaved_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgtsv_interleaved_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(kind(rocsparse_gtsv_interleaved_alg_default)), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zgtsv_interleaved_batch_buffer_size
+
+!       rocsparse_gtsv_interleaved_batch
+        function rocsparse_sgtsv_interleaved_batch(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_sgtsv_interleaved_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgtsv_interleaved_batch
+            type(c_ptr), value :: handle
+            integer(kind(rocsparse_gtsv_interleaved_alg_default)), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsric0
+        end function rocsparse_sgtsv_interleaved_batch
 
-        function rocsparse_ccsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsric0')
+        function rocsparse_dgtsv_interleaved_batch(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_dgtsv_interleaved_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgtsv_interleaved_batch
             type(c_ptr), value :: handle
+            integer(kind(rocsparse_gtsv_interleaved_alg_default)), value :: alg
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsric0
+        end function rocsparse_dgtsv_interleaved_batch
 
-        function rocsparse_zcsric0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsric0')
+        function rocsparse_cgtsv_interleaved_batch(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_cgtsv_interleaved_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsric0
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgtsv_interleaved_batch
             type(c_ptr), value :: handle
+            integer(kind(rocsparse_gtsv_interleaved_alg_default)), value :: alg
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsric0
+        end function rocsparse_cgtsv_interleaved_batch
 
-!       rocsparse_csrilu0_zero_pivot
-        function rocsparse_csrilu0_zero_pivot(handle, info, position) &
-                bind(c, name = 'rocsparse_csrilu0_zero_pivot')
+        function rocsparse_zgtsv_interleaved_batch(handle, alg, m, dl, d, du, &
+                x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_zgtsv_interleaved_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgtsv_interleaved_batch
+            type(c_ptr), value :: handle
+            integer(kind(rocsparse_gtsv_interleaved_alg_default)), value :: alg
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zgtsv_interleaved_batch
+
+!       rocsparse_gpsv_no_pivot_strided_batch_buffer_size
+        function rocsparse_sgpsv_no_pivot_strided_batch_buffer_size(handle, m, &
+                ds, dl, d, du, dw, x, batch_count, batch_stride, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_sgpsv_no_pivot_strided_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrilu0_zero_pivot
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgpsv_no_pivot_strided_batch_buffer_size
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-            type(c_ptr), value :: position
-        end function rocsparse_csrilu0_zero_pivot
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sgpsv_no_pivot_strided_batch_buffer_size
 
-!       rocsparse_csrilu0_buffer_size
-        function rocsparse_scsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_scsrilu0_buffer_size')
+        function rocsparse_dgpsv_no_pivot_strided_batch_buffer_size(handle, m, &
+                ds, dl, d, du, dw, x, batch_count, batch_stride, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_dgpsv_no_pivot_strided_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgpsv_no_pivot_strided_batch_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: buffer_size
-        end function rocsparse_scsrilu0_buffer_size
+        end function rocsparse_dgpsv_no_pivot_strided_batch_buffer_size
 
-        function rocsparse_dcsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_dcsrilu0_buffer_size')
+        function rocsparse_cgpsv_no_pivot_strided_batch_buffer_size(handle, m, &
+                ds, dl, d, du, dw, x, batch_count, batch_stride, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_cgpsv_no_pivot_strided_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgpsv_no_pivot_strided_batch_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: buffer_size
-        end function rocsparse_dcsrilu0_buffer_size
+        end function rocsparse_cgpsv_no_pivot_strided_batch_buffer_size
 
-        function rocsparse_ccsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_ccsrilu0_buffer_size')
+        function rocsparse_zgpsv_no_pivot_strided_batch_buffer_size(handle, m, &
+                ds, dl, d, du, dw, x, batch_count, batch_stride, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_zgpsv_no_pivot_strided_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgpsv_no_pivot_strided_batch_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: buffer_size
-        end function rocsparse_ccsrilu0_buffer_size
+        end function rocsparse_zgpsv_no_pivot_strided_batch_buffer_size
 
-        function rocsparse_zcsrilu0_buffer_size(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, buffer_size) &
-                bind(c, name = 'rocsparse_zcsrilu0_buffer_size')
+!       rocsparse_gpsv_no_pivot_strided_batch
+        function rocsparse_sgpsv_no_pivot_strided_batch(handle, m, ds, dl, d, &
+                du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_sgpsv_no_pivot_strided_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0_buffer_size
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgpsv_no_pivot_strided_batch
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            type(c_ptr), value :: buffer_size
-        end function rocsparse_zcsrilu0_buffer_size
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_sgpsv_no_pivot_strided_batch
 
-!       rocsparse_csrilu0_analysis
-        function rocsparse_scsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_scsrilu0_analysis')
+        function rocsparse_dgpsv_no_pivot_strided_batch(handle, m, ds, dl, d, &
+                du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_dgpsv_no_pivot_strided_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgpsv_no_pivot_strided_batch
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrilu0_analysis
+        end function rocsparse_dgpsv_no_pivot_strided_batch
 
-        function rocsparse_dcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsrilu0_analysis')
+        function rocsparse_cgpsv_no_pivot_strided_batch(handle, m, ds, dl, d, &
+                du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_cgpsv_no_pivot_strided_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgpsv_no_pivot_strided_batch
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrilu0_analysis
+        end function rocsparse_cgpsv_no_pivot_strided_batch
 
-        function rocsparse_ccsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsrilu0_analysis')
+        function rocsparse_zgpsv_no_pivot_strided_batch(handle, m, ds, dl, d, &
+                du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_zgpsv_no_pivot_strided_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgpsv_no_pivot_strided_batch
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrilu0_analysis
+        end function rocsparse_zgpsv_no_pivot_strided_batch
 
-        function rocsparse_zcsrilu0_analysis(handle, m, nnz, descr, csr_val, &
-                csr_row_ptr, csr_col_ind, info, analysis, solve, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsrilu0_analysis')
+!       rocsparse_gpsv_no_pivot_interleaved_batch_buffer_size
+        function rocsparse_sgpsv_no_pivot_interleaved_batch_buffer_size(handle, &
+                m, ds, dl, d, du, dw, x, batch_count, batch_stride, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_sgpsv_no_pivot_interleaved_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0_analysis
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgpsv_no_pivot_interleaved_batch_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: analysis
-            integer(c_int), value :: solve
-            type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrilu0_analysis
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_sgpsv_no_pivot_interleaved_batch_buffer_size
 
-!       rocsparse_csrilu0_clear
-        function rocsparse_csrilu0_clear(handle, info) &
-                bind(c, name = 'rocsparse_csrilu0_clear')
+        function rocsparse_dgpsv_no_pivot_interleaved_batch_buffer_size(handle, &
+                m, ds, dl, d, du, dw, x, batch_count, batch_stride, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_dgpsv_no_pivot_interleaved_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_csrilu0_clear
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgpsv_no_pivot_interleaved_batch_buffer_size
             type(c_ptr), value :: handle
-            type(c_ptr), value :: info
-        end function rocsparse_csrilu0_clear
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_dgpsv_no_pivot_interleaved_batch_buffer_size
 
-!       rocsparse_csrilu0
-        function rocsparse_scsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_scsrilu0')
+        function rocsparse_cgpsv_no_pivot_interleaved_batch_buffer_size(handle, &
+                m, ds, dl, d, du, dw, x, batch_count, batch_stride, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_cgpsv_no_pivot_interleaved_batch_buffer_size')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_scsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgpsv_no_pivot_interleaved_batch_buffer_size
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_cgpsv_no_pivot_interleaved_batch_buffer_size
+
+        function rocsparse_zgpsv_no_pivot_interleaved_batch_buffer_size(handle, &
+                m, ds, dl, d, du, dw, x, batch_count, batch_stride, &
+                buffer_size) &
+                bind(c, name = 'rocsparse_zgpsv_no_pivot_interleaved_batch_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgpsv_no_pivot_interleaved_batch_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), intent(in), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_zgpsv_no_pivot_interleaved_batch_buffer_size
+
+!       rocsparse_gpsv_no_pivot_interleaved_batch
+        function rocsparse_sgpsv_no_pivot_interleaved_batch(handle, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_sgpsv_no_pivot_interleaved_batch')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_sgpsv_no_pivot_interleaved_batch
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_scsrilu0
+        end function rocsparse_sgpsv_no_pivot_interleaved_batch
 
-        function rocsparse_dcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_dcsrilu0')
+        function rocsparse_dgpsv_no_pivot_interleaved_batch(handle, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_dgpsv_no_pivot_interleaved_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_dgpsv_no_pivot_interleaved_batch
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_dcsrilu0
+        end function rocsparse_dgpsv_no_pivot_interleaved_batch
 
-        function rocsparse_ccsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_ccsrilu0')
+        function rocsparse_cgpsv_no_pivot_interleaved_batch(handle, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_cgpsv_no_pivot_interleaved_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_cgpsv_no_pivot_interleaved_batch
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_ccsrilu0
+        end function rocsparse_cgpsv_no_pivot_interleaved_batch
 
-        function rocsparse_zcsrilu0(handle, m, nnz, descr, csr_val, csr_row_ptr, &
-                csr_col_ind, info, policy, temp_buffer) &
-                bind(c, name = 'rocsparse_zcsrilu0')
+        function rocsparse_zgpsv_no_pivot_interleaved_batch(handle, m, ds, dl, &
+                d, du, dw, x, batch_count, batch_stride, temp_buffer) &
+                bind(c, name = 'rocsparse_zgpsv_no_pivot_interleaved_batch')
             use rocsparse_enums
             use iso_c_binding
             implicit none
-            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrilu0
+            integer(kind(rocsparse_status_success)) :: rocsparse_zgpsv_no_pivot_interleaved_batch
             type(c_ptr), value :: handle
             integer(c_int), value :: m
-            integer(c_int), value :: nnz
-            type(c_ptr), intent(in), value :: descr
-            type(c_ptr), intent(in), value :: csr_val
-            type(c_ptr), intent(in), value :: csr_row_ptr
-            type(c_ptr), intent(in), value :: csr_col_ind
-            type(c_ptr), value :: info
-            integer(c_int), value :: policy
+            type(c_ptr), intent(in), value :: ds
+            type(c_ptr), intent(in), value :: dl
+            type(c_ptr), intent(in), value :: d
+            type(c_ptr), intent(in), value :: du
+            type(c_ptr), intent(in), value :: dw
+            type(c_ptr), value :: x
+            integer(c_int), value :: batch_count
+            integer(c_int), value :: batch_stride
             type(c_ptr), value :: temp_buffer
-        end function rocsparse_zcsrilu0
+        end function rocsparse_zgpsv_no_pivot_interleaved_batch
 
 ! ===========================================================================
 !   conversion SPARSE
@@ -6216,6 +10002,109 @@ module rocsparse
             type(c_ptr), value :: temp_buffer
         end function rocsparse_coosort_by_column
 
+!       rocsparse_csrsympermute_buffer_size
+        function rocsparse_csrsympermute_buffer_size(handle, m, nnz, descr, csr_row_ptr, &
+                csr_col_ind, perm, buffer_size) &
+                bind(c, name = 'rocsparse_csrsympermute_buffer_size')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_csrsympermute_buffer_size
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: perm
+            type(c_ptr), value :: buffer_size
+        end function rocsparse_csrsympermute_buffer_size
+
+!       rocsparse_csrsympermute
+        function rocsparse_scsrsympermute(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, perm, csr_val_out, csr_row_ptr_out, csr_col_ind_out, temp_buffer) &
+                bind(c, name = 'rocsparse_scsrsympermute')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_scsrsympermute
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: perm
+            type(c_ptr), value :: csr_val_out
+            type(c_ptr), value :: csr_row_ptr_out
+            type(c_ptr), value :: csr_col_ind_out
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_scsrsympermute
+
+        function rocsparse_dcsrsympermute(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, perm, csr_val_out, csr_row_ptr_out, csr_col_ind_out, temp_buffer) &
+                bind(c, name = 'rocsparse_dcsrsympermute')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_dcsrsympermute
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: perm
+            type(c_ptr), value :: csr_val_out
+            type(c_ptr), value :: csr_row_ptr_out
+            type(c_ptr), value :: csr_col_ind_out
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_dcsrsympermute
+
+        function rocsparse_ccsrsympermute(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, perm, csr_val_out, csr_row_ptr_out, csr_col_ind_out, temp_buffer) &
+                bind(c, name = 'rocsparse_ccsrsympermute')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_ccsrsympermute
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: perm
+            type(c_ptr), value :: csr_val_out
+            type(c_ptr), value :: csr_row_ptr_out
+            type(c_ptr), value :: csr_col_ind_out
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_ccsrsympermute
+
+        function rocsparse_zcsrsympermute(handle, m, nnz, descr, csr_val, csr_row_ptr, &
+                csr_col_ind, perm, csr_val_out, csr_row_ptr_out, csr_col_ind_out, temp_buffer) &
+                bind(c, name = 'rocsparse_zcsrsympermute')
+            use rocsparse_enums
+            use iso_c_binding
+            implicit none
+            integer(kind(rocsparse_status_success)) :: rocsparse_zcsrsympermute
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: nnz
+            type(c_ptr), intent(in), value :: descr
+            type(c_ptr), intent(in), value :: csr_val
+            type(c_ptr), intent(in), value :: csr_row_ptr
+            type(c_ptr), intent(in), value :: csr_col_ind
+            type(c_ptr), intent(in), value :: perm
+            type(c_ptr), value :: csr_val_out
+            type(c_ptr), value :: csr_row_ptr_out
+            type(c_ptr), value :: csr_col_ind_out
+            type(c_ptr), value :: temp_buffer
+        end function rocsparse_zcsrsympermute
+
 !       rocsparse_bsr2csr
         function rocsparse_sbsr2csr(handle, dir, mb, nb, bsr_descr, bsr_val, bsr_row_ptr, &
                 bsr_col_ind, block_dim, csr_descr, csr_val, csr_row_ptr, csr_col_ind) &
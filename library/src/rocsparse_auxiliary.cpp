@@ -115,6 +115,40 @@ rocsparse_status rocsparse_get_pointer_mode(rocsparse_handle handle, rocsparse_p
     return rocsparse_status_success;
 }
 
+/********************************************************************************
+ * \brief Set the device memory budget for persistent meta data.
+ *******************************************************************************/
+rocsparse_status rocsparse_set_memory_budget(rocsparse_handle handle, size_t budget)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    handle->memory_budget = budget;
+    log_trace(handle, "rocsparse_set_memory_budget", budget);
+    return rocsparse_status_success;
+}
+
+/********************************************************************************
+ * \brief Get the device memory budget for persistent meta data.
+ *******************************************************************************/
+rocsparse_status rocsparse_get_memory_budget(rocsparse_handle handle, size_t* budget)
+{
+    // Check if handle is valid
+    if(handle == nullptr)
+    {
+        return rocsparse_status_invalid_handle;
+    }
+    else if(budget == nullptr)
+    {
+        return rocsparse_status_invalid_pointer;
+    }
+    *budget = handle->memory_budget;
+    log_trace(handle, "rocsparse_get_memory_budget", *budget);
+    return rocsparse_status_success;
+}
+
 /********************************************************************************
  *! \brief Set rocsparse stream used for all subsequent library function calls.
  * If not set, all hip kernels will take the default NULL stream.
@@ -645,6 +679,18 @@ rocsparse_status rocsparse_destroy_mat_info(rocsparse_mat_info info)
         RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrgemm_info(info->csrgemm_info));
     }
 
+    // Clear csrrap info struct
+    if(info->csrrap_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csrrap_info(info->csrrap_info));
+    }
+
+    // Clear csriluk info struct
+    if(info->csriluk_info != nullptr)
+    {
+        RETURN_IF_ROCSPARSE_ERROR(rocsparse_destroy_csriluk_info(info->csriluk_info));
+    }
+
     // Clear zero pivot
     if(info->zero_pivot != nullptr)
     {
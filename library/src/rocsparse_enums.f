@@ -84,11 +84,52 @@ module rocsparse_enums
     enum, bind(c)
         enumerator :: rocsparse_analysis_policy_reuse = 0
         enumerator :: rocsparse_analysis_policy_force = 1
+        enumerator :: rocsparse_analysis_policy_numeric = 2
     end enum
 
 !   rocsparse_solve_policy
     enum, bind(c)
         enumerator :: rocsparse_solve_policy_auto = 0
+        enumerator :: rocsparse_solve_policy_sync_free = 1
+        enumerator :: rocsparse_solve_policy_level_set = 2
+    end enum
+
+!   rocsparse_gtsv_interleaved_alg
+    enum, bind(c)
+        enumerator :: rocsparse_gtsv_interleaved_alg_default = 0
+        enumerator :: rocsparse_gtsv_interleaved_alg_thomas = 1
+        enumerator :: rocsparse_gtsv_interleaved_alg_lu = 2
+    end enum
+
+!   rocsparse_mask_type
+    enum, bind(c)
+        enumerator :: rocsparse_mask_type_structural = 0
+        enumerator :: rocsparse_mask_type_complement = 1
+    end enum
+
+!   rocsparse_semiring
+    enum, bind(c)
+        enumerator :: rocsparse_semiring_plus_times = 0
+        enumerator :: rocsparse_semiring_min_plus = 1
+        enumerator :: rocsparse_semiring_max_times = 2
+        enumerator :: rocsparse_semiring_or_and = 3
+        enumerator :: rocsparse_semiring_plus_pair = 4
+    end enum
+
+!   rocsparse_ewise_pattern
+    enum, bind(c)
+        enumerator :: rocsparse_ewise_pattern_intersection = 0
+        enumerator :: rocsparse_ewise_pattern_union = 1
+    end enum
+
+!   rocsparse_ewise_op
+    enum, bind(c)
+        enumerator :: rocsparse_ewise_op_add = 0
+        enumerator :: rocsparse_ewise_op_sub = 1
+        enumerator :: rocsparse_ewise_op_mul = 2
+        enumerator :: rocsparse_ewise_op_div = 3
+        enumerator :: rocsparse_ewise_op_min = 4
+        enumerator :: rocsparse_ewise_op_max = 5
     end enum
 
 !   rocsparse_pointer_mode
@@ -78,3 +78,9 @@ truncate -s 0 $logname
 for filename in ./matrices/*.csr; do
     $bench -f csrgemm --precision s --device $dev --sizen $sizen --alpha 1 --iters 200 --rocalution $filename 2>&1 | tee -a $logname
 done
+
+# Run csrgemm for R-MAT power law matrices, where the heaviest rows of C exceed the
+# hash table size
+for size in 65536 131072 262144 524288; do
+    $bench -f csrgemm --precision s --device $dev --sizem $size --sizen $size --sizek $size --alpha 1 --iters 200 --rmat 2>&1 | tee -a $logname
+done